@@ -30,14 +30,12 @@
  * track a single device's position. An event queue is used to provide a way for a user task to obtain
  * position information from the component as it is generated.
  *
- * Note that the queue is of length 1, and old values will be overwritten. Using a longer queue is
- * possible with some minor modifications however newer values are lost if the queue overruns. A circular
- * buffer where old values are lost would be better (maybe StreamBuffer in FreeRTOS 10.0.0?).
+ * The queue also carries debounced push-switch events. Switch edges raise an interrupt which arms a
+ * one-shot esp_timer; once the contacts have been quiet for ROTARY_ENCODER_SW_DEBOUNCE_US the level is
+ * sampled and a press or release event is published, timestamped with the first edge of the transition.
+ * If the queue overruns, newer events are lost.
  */
 
-/* This lib requires some work to add in functionality of a push button along with allowing for
-   non-interrupt driven quadrature reading */
-
 #ifndef ROTARY_ENCODER_H
 #define ROTARY_ENCODER_H
 
@@ -47,6 +45,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 
 #ifdef __cplusplus
@@ -70,37 +69,89 @@ typedef enum {
 typedef uint8_t table_row_t[TABLE_COLS];
 ///@endcond
 
+/**
+ * @brief Select the register-level, IRAM-resident quadrature ISR. When 0, the original gpio_get_level()
+ *        based handler is used instead, which is useful as a baseline when comparing ISR cost.
+ *
+ * The register read needs A and B in the same input register bank (both below GPIO32 or both GPIO32 and up).
+ * Otherwise, and when this is 0, the pins are read with gpio_get_level(), which runs from flash unless
+ * CONFIG_GPIO_CTRL_FUNC_IN_IRAM is set: with the GPIO ISR service installed with ESP_INTR_FLAG_IRAM, a step
+ * during a flash write would then fault. Keep A and B in one bank, or set that option.
+ */
+#ifndef ROTARY_ENCODER_FAST_ISR
+#define ROTARY_ENCODER_FAST_ISR 1
+#endif
+
+#ifndef ROTARY_ENCODER_SW_DEBOUNCE_US
+#define ROTARY_ENCODER_SW_DEBOUNCE_US       5000 ///< Quiet time required on the switch pin before its level is trusted
+#endif
+#define ROTARY_ENCODER_SW_ACTIVE_LEVEL      1    ///< GPIO level read on the switch pin while the switch is held
+#define ROTARY_ENCODER_EVENT_QUEUE_LENGTH   16   ///< Deep enough for a burst of steps plus a switch press/release pair
+
+#define ROTARY_ENCODER_ISR_HIST_BINS        16   ///< Number of bins in the ISR cycle count histogram (last bin collects overflow)
+#define ROTARY_ENCODER_ISR_HIST_BIN_CYCLES  64   ///< Width of each histogram bin in CPU cycles
+
+/**
+ * @brief Struct holds the cycle count profile of the quadrature ISR, recorded by the ISR itself.
+ */
+typedef struct {
+    uint32_t count;                                  ///< Number of ISR invocations recorded
+    uint32_t min_cycles;                             ///< Cheapest invocation seen
+    uint32_t max_cycles;                             ///< Most expensive invocation seen
+    uint64_t total_cycles;                           ///< Sum of all recorded invocations, for computing the mean
+    uint32_t hist[ROTARY_ENCODER_ISR_HIST_BINS];     ///< Bin i counts invocations of [i, i + 1) * ROTARY_ENCODER_ISR_HIST_BIN_CYCLES cycles
+} rotary_encoder_isr_stats_t;
+
 /**
  * @brief Struct represents the current state of the device in terms of incremental position and direction of last movement
  */
 typedef struct {
     rotary_encoder_position_t position;    ///< Numerical position since reset. This value increments on clockwise rotation, and decrements on counter-clockewise rotation. Counts full or half steps depending on mode. Set to zero on reset.
     rotary_encoder_direction_t direction;  ///< Direction of last movement. Set to NOT_SET on reset.
-    bool sw_status;                        ///< GPIO level for optional switch component. Needs to be updated with rotary_encoder_poll_sw()
+    bool sw_status;                        ///< Debounced state of the optional switch component, true while held
 } rotary_encoder_state_t;
 
+/**
+ * @brief Enum representing the kind of event published on the event queue.
+ */
+typedef enum {
+    ROTARY_ENCODER_EVENT_STEP = 0,         ///< Position changed by one (half) step
+    ROTARY_ENCODER_EVENT_SW_PRESS,         ///< Switch settled in the pressed state
+    ROTARY_ENCODER_EVENT_SW_RELEASE,       ///< Switch settled in the released state
+} rotary_encoder_event_type_t;
+
 /**
  * @brief Struct carries all the information needed by this driver to manage the rotary encoder device.
  *        The fields of this structure should not be accessed directly.
  */
-typedef struct {
+typedef struct rotary_encoder_info_t {
     gpio_num_t pin_a;                       ///< GPIO for Signal A from the rotary encoder device
     gpio_num_t pin_b;                       ///< GPIO for Signal B from the rotary encoder device
     gpio_num_t pin_sw;                      ///< GPIO for Optional switch pin from the rotary encoder device
     //bool pin_sw_int_en;
     int8_t HOLD_POS_TOP;
     int8_t HOLD_POS_BOT;
+    esp_timer_handle_t sw_timer;            ///< One-shot debounce timer armed by the switch ISR
+    volatile int64_t sw_first_edge_us;      ///< Time of the first switch edge since the last settled state
+    volatile int64_t sw_last_edge_us;       ///< Time of the most recent switch edge
     QueueHandle_t queue;                    ///< Handle for event queue, created by ::rotary_encoder_create_queue
     const table_row_t * table;              ///< Pointer to active state transition table
     uint8_t table_state;                    ///< Internal state
     volatile rotary_encoder_state_t state;  ///< Device state
+    uint32_t in_reg;                        ///< GPIO input register holding both A and B, or 0 if they live in different banks
+    uint8_t shift_a;                        ///< Bit position of pin A within in_reg
+    uint8_t shift_b;                        ///< Bit position of pin B within in_reg
+    volatile rotary_encoder_isr_stats_t isr_stats; ///< Cycle count profile of the quadrature ISR
 } rotary_encoder_info_t;
 
 /**
  * @brief Struct represents a queued event, used to communicate current position to a waiting task
  */
 typedef struct {
-    rotary_encoder_state_t state;  ///< The device state corresponding to this event
+    rotary_encoder_state_t state;          ///< The device state corresponding to this event
+    rotary_encoder_event_type_t type;      ///< What caused this event
+    int64_t timestamp_us;                  ///< esp_timer time of the edge that produced this event
+    const rotary_encoder_info_t * source;  ///< Device that produced this event, lets several devices share one queue
 } rotary_encoder_event_t;
 
 /**
@@ -110,6 +161,9 @@ typedef struct {
  * @param[in, out] info Pointer to allocated rotary encoder info structure.
  * @param[in] pin_a GPIO number for rotary encoder output A.
  * @param[in] pin_b GPIO number for rotary encoder output B.
+ * @param[in] pin_sw GPIO number for the push switch, or GPIO_NUM_NC if there is none.
+ * @param[in] enc_max Position at which clockwise steps are held.
+ * @param[in] enc_min Position at which counter-clockwise steps are held.
  * @return ESP_OK if successful, ESP_FAIL or ESP_ERR_* if an error occurred.
  */
 esp_err_t rotary_encoder_init(rotary_encoder_info_t * info, gpio_num_t pin_a, gpio_num_t pin_b, 
@@ -147,6 +201,7 @@ QueueHandle_t rotary_encoder_create_queue(void);
 /**
  * @brief Set the driver to use the specified queue as an event queue.
  *        It is recommended that a queue constructed by ::rotary_encoder_create_queue is used.
+ *        The same queue may be given to several devices, use rotary_encoder_event_t::source to tell them apart.
  * @param[in] info Pointer to initialised rotary encoder info structure.
  * @param[in] queue Handle to queue suitable for use as an event queue. See ::rotary_encoder_create_queue.
  * @return ESP_OK if successful, ESP_FAIL or ESP_ERR_* if an error occurred.
@@ -168,9 +223,23 @@ esp_err_t rotary_encoder_get_state(const rotary_encoder_info_t * info, rotary_en
  */
 esp_err_t rotary_encoder_reset(rotary_encoder_info_t * info);
 
+/**
+ * @brief Take a snapshot of the quadrature ISR cycle count profile.
+ * @param[in] info Pointer to initialised rotary encoder info structure.
+ * @param[out] stats Pointer to an allocated rotary_encoder_isr_stats_t struct that will receive the snapshot.
+ * @return ESP_OK if successful, ESP_FAIL or ESP_ERR_* if an error occurred.
+ */
+esp_err_t rotary_encoder_get_isr_stats(const rotary_encoder_info_t * info, rotary_encoder_isr_stats_t * stats);
+
+/**
+ * @brief Clear the quadrature ISR cycle count profile, e.g. before starting a new measurement run.
+ * @param[in] info Pointer to initialised rotary encoder info structure.
+ * @return ESP_OK if successful, ESP_FAIL or ESP_ERR_* if an error occurred.
+ */
+esp_err_t rotary_encoder_reset_isr_stats(rotary_encoder_info_t * info);
+
 /* Custom Functions (Kharper 03/2024) */
 esp_err_t rotary_encoder_wrap(rotary_encoder_info_t * info, int max);
-esp_err_t rotary_encoder_poll_switch(rotary_encoder_info_t * info);
 esp_err_t rotary_encoder_hold(rotary_encoder_info_t * info);
 
 #ifdef __cplusplus
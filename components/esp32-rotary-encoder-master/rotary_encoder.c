@@ -87,16 +87,22 @@
  * than 10 lines of logic.
  */
 
+#include <string.h>
+
 #include "rotary_encoder.h"
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
 #include "driver/gpio.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
 
 #define TAG "rotary_encoder"
 
-//#define ROTARY_ENCODER_DEBUG
+// Guards the ISR cycle count profile against torn snapshots from task context
+static portMUX_TYPE _isr_stats_mux = portMUX_INITIALIZER_UNLOCKED;
 
-// Use a single-item queue so that the last value can be easily overwritten by the interrupt handler
-#define EVENT_QUEUE_LENGTH 1
+//#define ROTARY_ENCODER_DEBUG
 
 #define TABLE_ROWS 7
 
@@ -112,7 +118,7 @@
 #define H_CW_BEGIN_M  0x4
 #define H_CCW_BEGIN_M 0x5
 
-static const uint8_t _ttable_half[TABLE_ROWS][TABLE_COLS] = {
+static const uint8_t DRAM_ATTR _ttable_half[TABLE_ROWS][TABLE_COLS] = {
     // 00                  01              10            11                   // BA
     {H_START_M,            H_CW_BEGIN,     H_CCW_BEGIN,  R_START},            // R_START (00)
     {H_START_M | DIR_CCW,  R_START,        H_CCW_BEGIN,  R_START},            // H_CCW_BEGIN
@@ -130,7 +136,7 @@ static const uint8_t _ttable_half[TABLE_ROWS][TABLE_COLS] = {
 #define F_CCW_FINAL 0x5
 #define F_CCW_NEXT  0x6
 
-static const uint8_t _ttable_full[TABLE_ROWS][TABLE_COLS] = {
+static const uint8_t DRAM_ATTR _ttable_full[TABLE_ROWS][TABLE_COLS] = {
     // 00        01           10           11                  // BA
     {R_START,    F_CW_BEGIN,  F_CCW_BEGIN, R_START},           // R_START
     {F_CW_NEXT,  R_START,     F_CW_FINAL,  R_START | DIR_CW},  // F_CW_FINAL
@@ -146,25 +152,114 @@ typedef enum {
     LV_INDEV_STATE_PRESSED
 } lv_indev_state_t;
 
-//volatile bool sw_interrupt_flag;
-//static void _sw_isr_handler(rotary_encoder_info_t * info) {
-    //uint32_t gpio_num = (uint32_t) arg;
-    //bool gpio_level = gpio_get_level(info->pin_sw);
-//    sw_interrupt_flag = gpio_level;
-//    //if (gpio_level == 0) {
-//    //    ESP_LOGI(TAG, "Falling edge detected on GPIO %d", gpio_num);
-//    //} else {
-//    //    ESP_LOGI(TAG, "Rising edge detected on GPIO %d", gpio_num);
-//    //}
-//}
+// Publish a debounced switch transition. Runs from the esp_timer task, so a blocking-free send is used.
+static void _sw_publish(rotary_encoder_info_t * info, bool pressed, int64_t edge_us) {
+
+    info->state.sw_status = pressed;
+
+    if (info->queue) {
+        rotary_encoder_event_t queue_event = {
+            .state = {
+                .position = info->state.position,
+                .direction = info->state.direction,
+                .sw_status = pressed,
+            },
+            .type = pressed ? ROTARY_ENCODER_EVENT_SW_PRESS : ROTARY_ENCODER_EVENT_SW_RELEASE,
+            .timestamp_us = edge_us,
+            .source = info,
+        };
+        xQueueSend(info->queue, &queue_event, 0);
+    }
+}
+
+// Debounce timer expiry. If the contacts bounced again while the timer was running, wait out the rest of the window.
+static void _sw_debounce_cb(void * args) {
+
+    rotary_encoder_info_t * info = (rotary_encoder_info_t *)args;
+
+    int64_t quiet_us = esp_timer_get_time() - info->sw_last_edge_us;
+    if (quiet_us < ROTARY_ENCODER_SW_DEBOUNCE_US) {
+        esp_timer_start_once(info->sw_timer, ROTARY_ENCODER_SW_DEBOUNCE_US - quiet_us);
+        return;
+    }
+
+    bool pressed = (gpio_get_level(info->pin_sw) == ROTARY_ENCODER_SW_ACTIVE_LEVEL);
+    if (pressed != info->state.sw_status) {
+        _sw_publish(info, pressed, info->sw_first_edge_us);
+    }
+}
+
+// Switch edge: note the time and make sure the debounce timer is running. The level is not read here as it may still be bouncing.
+static void IRAM_ATTR _isr_sw(void * args) {
+
+    rotary_encoder_info_t * info = (rotary_encoder_info_t *)args;
+    int64_t now = esp_timer_get_time();
+
+    info->sw_last_edge_us = now;
+    if (!esp_timer_is_active(info->sw_timer)) {
+        info->sw_first_edge_us = now;
+        esp_timer_start_once(info->sw_timer, ROTARY_ENCODER_SW_DEBOUNCE_US);
+    }
+}
+
+// Latch A and B with a single read of the GPIO input register so both pins are sampled at the same instant.
+// Falls back to the driver if the pins were placed in different register banks (i.e. one of them is >= GPIO32).
+static inline uint8_t IRAM_ATTR _read_pins(const rotary_encoder_info_t * info) {
+
+#if ROTARY_ENCODER_FAST_ISR
+    if (info->in_reg) {
+        uint32_t in = REG_READ(info->in_reg);
+        return (((in >> info->shift_b) & 1) << 1) | ((in >> info->shift_a) & 1);
+    }
+#endif
+    return (gpio_get_level(info->pin_b) << 1) | gpio_get_level(info->pin_a);
+}
+
+// Work out which input register (and which bits within it) carry the A and B pins
+static void _update_pin_masks(rotary_encoder_info_t * info) {
+
+    info->in_reg = 0;
+
+    if (info->pin_a < 32 && info->pin_b < 32) {
+        info->in_reg = GPIO_IN_REG;
+        info->shift_a = info->pin_a;
+        info->shift_b = info->pin_b;
+    }
+    else if (info->pin_a >= 32 && info->pin_b >= 32) {
+        info->in_reg = GPIO_IN1_REG;
+        info->shift_a = info->pin_a - 32;
+        info->shift_b = info->pin_b - 32;
+    }
+}
+
+static inline void IRAM_ATTR _record_isr_cycles(rotary_encoder_info_t * info, uint32_t cycles) {
+
+    uint32_t bin = cycles / ROTARY_ENCODER_ISR_HIST_BIN_CYCLES;
+    if (bin >= ROTARY_ENCODER_ISR_HIST_BINS) {
+        bin = ROTARY_ENCODER_ISR_HIST_BINS - 1;
+    }
+
+    portENTER_CRITICAL_ISR(&_isr_stats_mux);
+    volatile rotary_encoder_isr_stats_t * stats = &info->isr_stats;
+    if (stats->count == 0 || cycles < stats->min_cycles) {
+        stats->min_cycles = cycles;
+    }
+    if (cycles > stats->max_cycles) {
+        stats->max_cycles = cycles;
+    }
+    stats->total_cycles += cycles;
+    stats->hist[bin]++;
+    stats->count++;
+    portEXIT_CRITICAL_ISR(&_isr_stats_mux);
+}
 
-static uint8_t _process(rotary_encoder_info_t * info) {
+static uint8_t IRAM_ATTR _process(rotary_encoder_info_t * info) {
 
     uint8_t event = 0;
 
     if (info != NULL) {
         // Get state of input pins.
-        uint8_t pin_state = (gpio_get_level(info->pin_b) << 1) | gpio_get_level(info->pin_a);
+        uint8_t pin_state = _read_pins(info);
 
         // Determine new state from the pins and state table.
         #ifdef ROTARY_ENCODER_DEBUG
@@ -185,11 +280,14 @@ static uint8_t _process(rotary_encoder_info_t * info) {
     return event;
 }
 
-static void _isr_rotenc(void * args) {
+static void IRAM_ATTR _isr_rotenc(void * args) {
+
+    uint32_t start_cycles = esp_cpu_get_cycle_count();
 
     rotary_encoder_info_t * info = (rotary_encoder_info_t *)args;
     uint8_t event = _process(info);
     bool send_event = false;
+    BaseType_t task_woken = pdFALSE;
 
     // Factored on 04/27 to hold pos until a direction change occurs per reaching the max or min specified
     // If you want to disable this, && the actual value of HOLD_POS_TOP/HOLD_POS_BOTTOM with the conditional check, and set 
@@ -218,14 +316,21 @@ static void _isr_rotenc(void * args) {
             .state = {
                 .position = info->state.position,
                 .direction = info->state.direction,
+                .sw_status = info->state.sw_status,
             },
+            .type = ROTARY_ENCODER_EVENT_STEP,
+            .timestamp_us = esp_timer_get_time(),
+            .source = info,
         };
-        BaseType_t task_woken = pdFALSE;
         //xQueueOverwriteFromISR(info->queue, &queue_event, &task_woken);
         xQueueSendFromISR(info->queue, &queue_event, &task_woken);
-        if (task_woken) {
-            portYIELD_FROM_ISR();
-        }
+    }
+
+    // Record before yielding so the profile covers decode and queueing, not the context switch
+    _record_isr_cycles(info, esp_cpu_get_cycle_count() - start_cycles);
+
+    if (task_woken) {
+        portYIELD_FROM_ISR();
     }
 }
 
@@ -245,6 +350,8 @@ esp_err_t rotary_encoder_init(rotary_encoder_info_t * info, gpio_num_t pin_a, gp
         info->table_state = R_START;
         info->state.position = 0;
         info->state.direction = ROTARY_ENCODER_DIRECTION_NOT_SET;
+        _update_pin_masks(info);
+        rotary_encoder_reset_isr_stats(info);
 
         // configure GPIOs
         gpio_reset_pin(info->pin_a);
@@ -257,15 +364,28 @@ esp_err_t rotary_encoder_init(rotary_encoder_info_t * info, gpio_num_t pin_a, gp
         gpio_set_direction(info->pin_b, GPIO_MODE_INPUT);
         gpio_set_intr_type(info->pin_b, GPIO_INTR_ANYEDGE);
 
-        //if (info->pin_sw) {
+        if (info->pin_sw != GPIO_NUM_NC) {
             gpio_reset_pin(info->pin_sw);
             gpio_set_pull_mode(info->pin_sw, GPIO_FLOATING);
             gpio_set_direction(info->pin_sw, GPIO_MODE_INPUT);
-            //if(info->pin_sw_int_en) {
-            //    gpio_set_intr_type(info->pin_sw, GPIO_INTR_ANYEDGE);
-            //    gpio_isr_handler_add(info->pin_sw, _sw_isr_handler, info);
-            //}
-        //}
+            gpio_set_intr_type(info->pin_sw, GPIO_INTR_ANYEDGE);
+
+            const esp_timer_create_args_t sw_timer_args = {
+                .callback = &_sw_debounce_cb,
+                .arg = info,
+                .name = "rotenc_sw_debounce",
+            };
+            err = esp_timer_create(&sw_timer_args, &info->sw_timer);
+            if (err == ESP_OK) {
+                info->sw_first_edge_us = 0;
+                info->sw_last_edge_us = 0;
+                info->state.sw_status = (gpio_get_level(info->pin_sw) == ROTARY_ENCODER_SW_ACTIVE_LEVEL);
+                gpio_isr_handler_add(info->pin_sw, _isr_sw, info);
+            }
+            else {
+                ESP_LOGE(TAG, "couldn't create switch debounce timer");
+            }
+        }
         
         // install interrupt handlers
         gpio_isr_handler_add(info->pin_a, _isr_rotenc, info);
@@ -305,6 +425,7 @@ esp_err_t rotary_encoder_flip_direction(rotary_encoder_info_t * info) {
         gpio_num_t temp = info->pin_a;
         info->pin_a = info->pin_b;
         info->pin_b = temp;
+        _update_pin_masks(info);
     }
 
     else {
@@ -322,6 +443,14 @@ esp_err_t rotary_encoder_uninit(rotary_encoder_info_t * info) {
     if (info) {
         gpio_isr_handler_remove(info->pin_a);
         gpio_isr_handler_remove(info->pin_b);
+        if (info->pin_sw != GPIO_NUM_NC) {
+            gpio_isr_handler_remove(info->pin_sw);
+        }
+        if (info->sw_timer) {
+            esp_timer_stop(info->sw_timer);
+            esp_timer_delete(info->sw_timer);
+            info->sw_timer = NULL;
+        }
     }
 
     else {
@@ -333,7 +462,7 @@ esp_err_t rotary_encoder_uninit(rotary_encoder_info_t * info) {
 }
 
 QueueHandle_t rotary_encoder_create_queue(void) {
-    return xQueueCreate(EVENT_QUEUE_LENGTH, EVENT_QUEUE_LENGTH * sizeof(rotary_encoder_event_t));
+    return xQueueCreate(ROTARY_ENCODER_EVENT_QUEUE_LENGTH, sizeof(rotary_encoder_event_t));
 }
 
 esp_err_t rotary_encoder_set_queue(rotary_encoder_info_t * info, QueueHandle_t queue) {
@@ -360,7 +489,7 @@ esp_err_t rotary_encoder_get_state(const rotary_encoder_info_t * info, rotary_en
         // make a snapshot of the state
         state->position = info->state.position;
         state->direction = info->state.direction;
-        state->sw_status = gpio_get_level(info->pin_sw);
+        state->sw_status = info->state.sw_status;
     }
 
     else {
@@ -371,13 +500,32 @@ esp_err_t rotary_encoder_get_state(const rotary_encoder_info_t * info, rotary_en
     return err;
 }
 
-esp_err_t rotary_encoder_reset(rotary_encoder_info_t * info) {
+esp_err_t rotary_encoder_get_isr_stats(const rotary_encoder_info_t * info, rotary_encoder_isr_stats_t * stats) {
+
+    esp_err_t err = ESP_OK;
+
+    if (info && stats) {
+        portENTER_CRITICAL(&_isr_stats_mux);
+        memcpy(stats, (const void *)&info->isr_stats, sizeof(rotary_encoder_isr_stats_t));
+        portEXIT_CRITICAL(&_isr_stats_mux);
+    }
+
+    else {
+        ESP_LOGE(TAG, "info and/or stats is NULL");
+        err = ESP_ERR_INVALID_ARG;
+    }
+
+    return err;
+}
+
+esp_err_t rotary_encoder_reset_isr_stats(rotary_encoder_info_t * info) {
 
     esp_err_t err = ESP_OK;
 
     if (info) {
-        info->state.position = 0;
-        //info->state.direction = ROTARY_ENCODER_DIRECTION_NOT_SET;
+        portENTER_CRITICAL(&_isr_stats_mux);
+        memset((void *)&info->isr_stats, 0, sizeof(rotary_encoder_isr_stats_t));
+        portEXIT_CRITICAL(&_isr_stats_mux);
     }
 
     else {
@@ -388,12 +536,12 @@ esp_err_t rotary_encoder_reset(rotary_encoder_info_t * info) {
     return err;
 }
 
-esp_err_t rotary_encoder_hold(rotary_encoder_info_t * info) {
+esp_err_t rotary_encoder_reset(rotary_encoder_info_t * info) {
 
     esp_err_t err = ESP_OK;
 
     if (info) {
-        info->state.position = info->state.position;
+        info->state.position = 0;
         //info->state.direction = ROTARY_ENCODER_DIRECTION_NOT_SET;
     }
 
@@ -405,16 +553,12 @@ esp_err_t rotary_encoder_hold(rotary_encoder_info_t * info) {
     return err;
 }
 
-esp_err_t rotary_encoder_wrap(rotary_encoder_info_t * info, int max) {
+esp_err_t rotary_encoder_hold(rotary_encoder_info_t * info) {
 
     esp_err_t err = ESP_OK;
 
     if (info) {
-        if (info->state.position == 0) {
-            if (info->state.direction == ROTARY_ENCODER_DIRECTION_COUNTER_CLOCKWISE) {
-                info->state.position = max;
-            }
-        }
+        info->state.position = info->state.position;
         //info->state.direction = ROTARY_ENCODER_DIRECTION_NOT_SET;
     }
 
@@ -426,16 +570,17 @@ esp_err_t rotary_encoder_wrap(rotary_encoder_info_t * info, int max) {
     return err;
 }
 
-esp_err_t rotary_encoder_poll_switch(rotary_encoder_info_t * info) {
+esp_err_t rotary_encoder_wrap(rotary_encoder_info_t * info, int max) {
 
     esp_err_t err = ESP_OK;
 
     if (info) {
-        if (info->pin_sw) {
-            info->state.sw_status = gpio_get_level(info->pin_sw);
+        if (info->state.position == 0) {
+            if (info->state.direction == ROTARY_ENCODER_DIRECTION_COUNTER_CLOCKWISE) {
+                info->state.position = max;
+            }
         }
         //info->state.direction = ROTARY_ENCODER_DIRECTION_NOT_SET;
-        //ESP_LOGI(TAG, "GPIO STATUS: %s", "High" ? pin_state == 1 : "Low");
     }
 
     else {
@@ -444,4 +589,4 @@ esp_err_t rotary_encoder_poll_switch(rotary_encoder_info_t * info) {
     }
 
     return err;
-}
\ No newline at end of file
+}
@@ -10,6 +10,7 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "esp_log.h"
+#include "hal/gpio_ll.h"
 
 #define TAG "disp_spi"
 
@@ -34,34 +35,34 @@
 /******************************************************************************
  * Notes about DMA spi_transaction_ext_t structure pooling
  * 
- * An xQueue is used to hold a pool of reusable SPI spi_transaction_ext_t 
- * structures that get used for all DMA SPI transactions. While an xQueue may 
- * seem like overkill it is an already built-in RTOS feature that comes at 
- * little cost. xQueues are also ISR safe if it ever becomes necessary to 
- * access the pool in the ISR callback.
+ * A fixed array of reusable DMA capable spi_transaction_ext_t structures is 
+ * used for all queued DMA SPI transactions. Free entries are kept on a 
+ * lock-free, index based stack (a tag in the upper half of the head word 
+ * guards against ABA).
  * 
- * When a DMA request is sent, a transaction structure is removed from the 
- * pool, filled out, and passed off to the esp32 SPI driver. Later, when 
- * servicing pending SPI transaction results, the transaction structure is 
- * recycled back into the pool for later reuse. This matches the DMA SPI 
- * transaction life cycle requirements of the esp32 SPI driver.
+ * When a DMA request is sent, a transaction structure is popped from the 
+ * free list, filled out, counted as in flight and passed off to the esp32 
+ * SPI driver. When the transfer completes, spi_ready (the post transaction 
+ * callback, ISR context) drops the in flight count and, if a task is 
+ * waiting for the count to fall to some level, wakes it with a task 
+ * notification. Waiting therefore costs no CPU and ends as soon as the DMA 
+ * does, not on a tick boundary.
  * 
- * When polling or synchronously sending SPI requests, and as required by the 
- * esp32 SPI driver, all pending DMA transactions are first serviced. Then the 
- * polling SPI request takes place. 
+ * An entry only goes back on the free list once the driver has returned it 
+ * through its result queue (spi_device_get_trans_result). The driver calls 
+ * spi_ready before it queues the result, and reading the result still looks 
+ * at the entry's tx_buffer/tx_data (and frees a bounce buffer if they 
+ * differ), so an entry recycled from the ISR could be refilled and queued 
+ * again while its stale result was still pending. Results are drained 
+ * without blocking before each new DMA request, and completely before 
+ * polling or synchronous requests (which the driver requires to have no 
+ * queued transactions outstanding).
  * 
- * When sending an asynchronous DMA SPI request, if the pool is empty, some 
- * small percentage of pending transactions are first serviced before sending 
- * any new DMA SPI transactions. Not too many and not too few as this balance 
- * controls DMA transaction latency.
- * 
- * It is therefore not the design that all pending transactions must be 
- * serviced and placed back into the pool with DMA SPI requests - that 
- * will happen eventually. The pool just needs to contain enough to float some 
- * number of in-flight SPI requests to speed up the overall DMA SPI data rate 
- * and reduce transaction latency. If however a display driver uses some 
- * polling SPI requests or calls disp_wait_for_pending_transactions() directly,
- * the pool will reach the full state more often and speed up DMA queuing.
+ * When polling or synchronously sending SPI requests, all in flight DMA 
+ * transactions are first waited for as above. When sending an asynchronous 
+ * DMA SPI request with the free list empty, the caller sleeps in 
+ * spi_device_get_trans_result until the driver returns one, which the ISR's 
+ * result queue send wakes it from.
  * 
  *****************************************************************************/
 
@@ -69,14 +70,11 @@
  *      DEFINES
  *********************/
 #define SPI_TRANSACTION_POOL_SIZE 50	/* maximum number of DMA transactions simultaneously in-flight */
+#define SPI_TRANSACTION_POOL_NIL 0xFFFF	/* free list terminator */
 
-/* DMA Transactions to reserve before queueing additional DMA transactions. A 1/10th seems to be a good balance. Too many (or all) and it will increase latency. */
-#define SPI_TRANSACTION_POOL_RESERVE_PERCENTAGE 10
-#if SPI_TRANSACTION_POOL_SIZE >= SPI_TRANSACTION_POOL_RESERVE_PERCENTAGE
-#define SPI_TRANSACTION_POOL_RESERVE (SPI_TRANSACTION_POOL_SIZE / SPI_TRANSACTION_POOL_RESERVE_PERCENTAGE)	
-#else
-#define SPI_TRANSACTION_POOL_RESERVE 1	/* defines minimum size */
-#endif
+/* Task notification slot used to wake a task waiting for transactions to complete. Use a slot of its own when 
+ * there is more than one, so the application keeps index 0. */
+#define DISP_SPI_NOTIFY_INDEX (configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)
 
 /**********************
  *      TYPEDEFS
@@ -85,15 +83,29 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void IRAM_ATTR spi_pre (spi_transaction_t *trans);
 static void IRAM_ATTR spi_ready (spi_transaction_t *trans);
+static void pool_push(uint16_t index);
+static spi_transaction_ext_t *pool_pop(void);
+static void wait_in_flight(uint32_t level);
+static bool reap_one(TickType_t wait);
+static void reap_results(bool block);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static spi_host_device_t spi_host;
 static spi_device_handle_t spi;
-static QueueHandle_t TransactionPool = NULL;
+static spi_transaction_ext_t *TransactionPool = NULL;
+static volatile uint16_t pool_next[SPI_TRANSACTION_POOL_SIZE];
+static uint32_t pool_head = SPI_TRANSACTION_POOL_NIL;	/* tag << 16 | index of the first free entry */
+static uint32_t in_flight = 0;		/* queued DMA transactions not yet completed, dropped by spi_ready */
+static uint32_t unreaped = 0;		/* queued DMA transactions not yet returned by the driver (not on the free list), task side only */
+static TaskHandle_t waiter = NULL;	/* task sleeping until in_flight <= wait_level */
+static uint32_t wait_level = 0;
+static transaction_cb_t chained_pre_cb;
 static transaction_cb_t chained_post_cb;
+static int dc_gpio = -1;
 
 /**********************
  *      MACROS
@@ -105,6 +117,8 @@ static transaction_cb_t chained_post_cb;
 void disp_spi_add_device_config(spi_host_device_t host, spi_device_interface_config_t *devcfg)
 {
     spi_host=host;
+    chained_pre_cb=devcfg->pre_cb;
+    devcfg->pre_cb=spi_pre;
     chained_post_cb=devcfg->post_cb;
     devcfg->post_cb=spi_ready;
     esp_err_t ret=spi_bus_add_device(host, devcfg, &spi);
@@ -143,16 +157,13 @@ void disp_spi_add_device_with_speed(spi_host_device_t host, int clock_speed_hz)
 
     disp_spi_add_device_config(host, &devcfg);
 
-	/* create the transaction pool and fill it with ptrs to spi_transaction_ext_t to reuse */
+	/* create the transaction pool and put every entry on the free list */
 	if(TransactionPool == NULL) {
-		TransactionPool = xQueueCreate(SPI_TRANSACTION_POOL_SIZE, sizeof(spi_transaction_ext_t*));
+		TransactionPool = (spi_transaction_ext_t*)heap_caps_calloc(SPI_TRANSACTION_POOL_SIZE, sizeof(spi_transaction_ext_t), MALLOC_CAP_DMA);
 		assert(TransactionPool != NULL);
 		for (size_t i = 0; i < SPI_TRANSACTION_POOL_SIZE; i++)
 		{
-			spi_transaction_ext_t* pTransaction = (spi_transaction_ext_t*)heap_caps_malloc(sizeof(spi_transaction_ext_t), MALLOC_CAP_DMA);
-			assert(pTransaction != NULL);
-			memset(pTransaction, 0, sizeof(spi_transaction_ext_t));
-			xQueueSend(TransactionPool, &pTransaction, portMAX_DELAY);
+			pool_push(i);
 		}
 	}
 }
@@ -176,6 +187,22 @@ void disp_spi_remove_device()
     assert(ret==ESP_OK);
 }
 
+/* Chain a callback after the driver's own post transaction callback (which signals flush ready).
+ * Runs in ISR context for every transaction, check trans->user for DISP_SPI_SIGNAL_FLUSH.
+ * Set after the device has been added, adding a device replaces it with devcfg->post_cb. */
+void disp_spi_set_post_cb(transaction_cb_t post_cb)
+{
+    chained_post_cb = post_cb;
+}
+
+/* Data/command GPIO driven from the pre transaction callback for transactions flagged DISP_SPI_DC_CMD or
+ * DISP_SPI_DC_DATA, so a command and its parameters can be queued back to back without the CPU toggling DC
+ * between them. The pin must already be configured as an output. */
+void disp_spi_set_dc_pin(int dc_pin)
+{
+    dc_gpio = dc_pin;
+}
+
 void disp_spi_transaction(const uint8_t *data, size_t length,
     disp_spi_send_flag_t flags, uint8_t *out,
     uint64_t addr, uint8_t dummy_bits)
@@ -250,22 +277,21 @@ void disp_spi_transaction(const uint8_t *data, size_t length,
 		disp_wait_for_pending_transactions();	/* before synchronous queueing, all previous pending transactions need to be serviced */
         spi_device_transmit(spi, (spi_transaction_t *) &t);
     } else {
-		
-		/* if necessary, ensure we can queue new transactions by servicing some previous transactions */
-		if(uxQueueMessagesWaiting(TransactionPool) == 0) {
-			spi_transaction_t *presult;
-			while(uxQueueMessagesWaiting(TransactionPool) < SPI_TRANSACTION_POOL_RESERVE) {
-				if (spi_device_get_trans_result(spi, &presult, 1) == ESP_OK) {
-					xQueueSend(TransactionPool, &presult, portMAX_DELAY);	/* back to the pool to be reused */
-				}
-			}
-		}
+		reap_results(false);
 
-		spi_transaction_ext_t *pTransaction = NULL;
-		xQueueReceive(TransactionPool, &pTransaction, portMAX_DELAY);
+		spi_transaction_ext_t *pTransaction;
+		while ((pTransaction = pool_pop()) == NULL) {
+			reap_one(portMAX_DELAY);	/* sleep until the driver returns one */
+		}
         memcpy(pTransaction, &t, sizeof(t));
+
+		/* counted before queueing, the transfer may complete before spi_device_queue_trans returns */
+		__atomic_add_fetch(&in_flight, 1, __ATOMIC_SEQ_CST);
+		unreaped++;
         if (spi_device_queue_trans(spi, (spi_transaction_t *) pTransaction, portMAX_DELAY) != ESP_OK) {
-			xQueueSend(TransactionPool, &pTransaction, portMAX_DELAY);	/* send failed transaction back to the pool to be reused */
+			unreaped--;
+			__atomic_sub_fetch(&in_flight, 1, __ATOMIC_SEQ_CST);
+			pool_push(pTransaction - TransactionPool);	/* send failed transaction back to the pool to be reused */
         }
     }
 }
@@ -273,13 +299,8 @@ void disp_spi_transaction(const uint8_t *data, size_t length,
 
 void disp_wait_for_pending_transactions(void)
 {
-    spi_transaction_t *presult;
-
-	while(uxQueueMessagesWaiting(TransactionPool) < SPI_TRANSACTION_POOL_SIZE) {	/* service until the transaction reuse pool is full again */
-        if (spi_device_get_trans_result(spi, &presult, 1) == ESP_OK) {
-			xQueueSend(TransactionPool, &presult, portMAX_DELAY);
-        }
-    }
+	wait_in_flight(0);
+	reap_results(true);	/* every result is due, spi_ready has run for all of them (the driver queues each one just after) */
 }
 
 void disp_spi_acquire(void)
@@ -297,6 +318,19 @@ void disp_spi_release(void)
  *   STATIC FUNCTIONS
  **********************/
 
+static void IRAM_ATTR spi_pre(spi_transaction_t *trans)
+{
+    disp_spi_send_flag_t flags = (disp_spi_send_flag_t) trans->user;
+
+    if ((dc_gpio >= 0) && (flags & (DISP_SPI_DC_CMD | DISP_SPI_DC_DATA))) {
+        gpio_ll_set_level(&GPIO, dc_gpio, (flags & DISP_SPI_DC_DATA) ? 1 : 0);
+    }
+
+    if (chained_pre_cb) {
+        chained_pre_cb(trans);
+    }
+}
+
 static void IRAM_ATTR spi_ready(spi_transaction_t *trans)
 {
     disp_spi_send_flag_t flags = (disp_spi_send_flag_t) trans->user;
@@ -321,5 +355,85 @@ static void IRAM_ATTR spi_ready(spi_transaction_t *trans)
     if (chained_post_cb) {
         chained_post_cb(trans);
     }
+
+    /* Queued transactions are counted down here and recycled by reap_results, polling and synchronous ones live on 
+     * the caller's stack */
+    spi_transaction_ext_t *pTransaction = (spi_transaction_ext_t *) trans;
+    if (pTransaction >= TransactionPool && pTransaction < TransactionPool + SPI_TRANSACTION_POOL_SIZE) {
+        uint32_t remaining = __atomic_sub_fetch(&in_flight, 1, __ATOMIC_SEQ_CST);
+
+        TaskHandle_t task = waiter;
+        if (task != NULL && remaining <= wait_level) {
+            BaseType_t woken = pdFALSE;
+            vTaskNotifyGiveIndexedFromISR(task, DISP_SPI_NOTIFY_INDEX, &woken);
+            if (woken) {
+                portYIELD_FROM_ISR();
+            }
+        }
+    }
 }
 
+/* Free list push, task context */
+static void pool_push(uint16_t index)
+{
+    uint32_t head = __atomic_load_n(&pool_head, __ATOMIC_ACQUIRE);
+    uint32_t next;
+
+    do {
+        pool_next[index] = head & 0xFFFF;
+        next = ((head + 0x10000) & 0xFFFF0000) | index;
+    } while (!__atomic_compare_exchange_n(&pool_head, &head, next, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+}
+
+/* Free list pop, task context, NULL when every transaction is in flight */
+static spi_transaction_ext_t *pool_pop(void)
+{
+    uint32_t head = __atomic_load_n(&pool_head, __ATOMIC_ACQUIRE);
+    uint32_t next;
+    uint16_t index;
+
+    do {
+        index = head & 0xFFFF;
+        if (index == SPI_TRANSACTION_POOL_NIL) {
+            return NULL;
+        }
+        next = ((head + 0x10000) & 0xFFFF0000) | pool_next[index];
+    } while (!__atomic_compare_exchange_n(&pool_head, &head, next, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    return &TransactionPool[index];
+}
+
+/* Sleep until at most level queued transactions are in flight, woken by spi_ready */
+static void wait_in_flight(uint32_t level)
+{
+    while (__atomic_load_n(&in_flight, __ATOMIC_SEQ_CST) > level) {
+        wait_level = level;
+        __atomic_store_n(&waiter, xTaskGetCurrentTaskHandle(), __ATOMIC_SEQ_CST);
+
+        /* re-check once published, the last completion may have come before spi_ready could see us */
+        if (__atomic_load_n(&in_flight, __ATOMIC_SEQ_CST) > level) {
+            ulTaskNotifyTakeIndexed(DISP_SPI_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+        }
+        __atomic_store_n(&waiter, NULL, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* Take one completed queued transaction back from the driver and put its entry on the free list */
+static bool reap_one(TickType_t wait)
+{
+    spi_transaction_t *presult;
+
+    if (unreaped == 0 || spi_device_get_trans_result(spi, &presult, wait) != ESP_OK) {
+        return false;
+    }
+    unreaped--;
+    pool_push((spi_transaction_ext_t *) presult - TransactionPool);
+    return true;
+}
+
+/* Drain the driver's results for completed queued transactions, recycling their entries */
+static void reap_results(bool block)
+{
+    while (reap_one(block ? portMAX_DELAY : 0)) {
+    }
+}
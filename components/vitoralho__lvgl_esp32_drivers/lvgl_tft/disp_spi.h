@@ -40,6 +40,8 @@ typedef enum _disp_spi_send_flag_t {
     DISP_SPI_MODE_QIO           = 0x00000800, 
     DISP_SPI_MODE_DIOQIO_ADDR   = 0x00001000, 
 	DISP_SPI_VARIABLE_DUMMY		= 0x00002000,
+    DISP_SPI_DC_CMD             = 0x00004000, /* DC low for this transaction, driven by the pre transaction callback */
+    DISP_SPI_DC_DATA            = 0x00008000, /* DC high for this transaction, driven by the pre transaction callback */
 } disp_spi_send_flag_t;
 
 
@@ -51,6 +53,8 @@ void disp_spi_add_device_config(spi_host_device_t host, spi_device_interface_con
 void disp_spi_add_device_with_speed(spi_host_device_t host, int clock_speed_hz);
 void disp_spi_change_device_speed(int clock_speed_hz);
 void disp_spi_remove_device();
+void disp_spi_set_post_cb(transaction_cb_t post_cb);
+void disp_spi_set_dc_pin(int dc_pin);
 
 /*	Important! 
 	All buffers should also be 32-bit aligned and DMA capable to prevent extra allocations and copying.
@@ -17,9 +17,11 @@
 typedef struct {
     bool pwm_control; // true: LEDC is used, false: GPIO is used
     int index;        // Either GPIO or LEDC channel
+    bool fading;      // LEDC fade functions in use, duty goes through the thread-safe API
 } disp_backlight_t;
 
 static const char *TAG = "DISPLAY_BL";
+static bool fade_installed = false;
 
 disp_backlight_h disp_backlight_new(const disp_backlight_config_t *config)
 {
@@ -105,13 +107,51 @@ void disp_backlight_set(disp_backlight_h bckl, int brightness_percent)
 
     if (bckl_dev->pwm_control) {
         uint32_t duty_cycle = (1023 * brightness_percent) / 100; // LEDC resolution set to 10bits, thus: 100% = 1023
-        ESP_ERROR_CHECK(ledc_set_duty(LEDC_LOW_SPEED_MODE, bckl_dev->index, duty_cycle));
-        ESP_ERROR_CHECK(ledc_update_duty(LEDC_LOW_SPEED_MODE, bckl_dev->index));
+        if (bckl_dev->fading) {
+            // Cut a running fade short, ledc_set_duty_and_update() would wait for it to end
+            #if SOC_LEDC_SUPPORT_FADE_STOP
+            ledc_fade_stop(LEDC_LOW_SPEED_MODE, bckl_dev->index);
+            #endif
+            ESP_ERROR_CHECK(ledc_set_duty_and_update(LEDC_LOW_SPEED_MODE, bckl_dev->index, duty_cycle, 0));
+        } else {
+            ESP_ERROR_CHECK(ledc_set_duty(LEDC_LOW_SPEED_MODE, bckl_dev->index, duty_cycle));
+            ESP_ERROR_CHECK(ledc_update_duty(LEDC_LOW_SPEED_MODE, bckl_dev->index));
+        }
     } else {
         ESP_ERROR_CHECK(gpio_set_level(bckl_dev->index, brightness_percent));
     }
 }
 
+void disp_backlight_fade(disp_backlight_h bckl, int brightness_percent, int fade_ms)
+{
+    // Check input paramters
+    if (bckl == NULL)
+        return;
+    if (brightness_percent > 100)
+        brightness_percent = 100;
+    if (brightness_percent < 0)
+        brightness_percent = 0;
+
+    disp_backlight_t *bckl_dev = (disp_backlight_t *) bckl;
+    if (!bckl_dev->pwm_control || fade_ms <= 0) {
+        disp_backlight_set(bckl, brightness_percent);
+        return;
+    }
+
+    if (!fade_installed) {
+        ESP_ERROR_CHECK(ledc_fade_func_install(0));
+        fade_installed = true;
+    }
+    #if SOC_LEDC_SUPPORT_FADE_STOP
+    if (bckl_dev->fading) {
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, bckl_dev->index);
+    }
+    #endif
+    bckl_dev->fading = true;
+    uint32_t duty_cycle = (1023 * brightness_percent) / 100;
+    ESP_ERROR_CHECK(ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, bckl_dev->index, duty_cycle, fade_ms, LEDC_FADE_NO_WAIT));
+}
+
 void disp_backlight_delete(disp_backlight_h bckl)
 {
     if (bckl == NULL)
@@ -58,6 +58,19 @@ disp_backlight_h disp_backlight_new(const disp_backlight_config_t *config);
  * @param[in] brightness_percent Brightness in [%]
  */
 void disp_backlight_set(disp_backlight_h bckl, int brightness_percent);
+
+/**
+ * @brief Fade the backlight to a brightness in LEDC hardware, without waiting for the fade to end
+ *
+ * A later disp_backlight_set() or disp_backlight_fade() cuts a running fade short (on targets with
+ * SOC_LEDC_SUPPORT_FADE_STOP, elsewhere it waits for the fade to end).
+ * GPIO controlled backlight, or fade_ms of 0, is set at once.
+ *
+ * @param bckl                   Backlight controller handle
+ * @param[in] brightness_percent Brightness in [%] at the end of the fade
+ * @param[in] fade_ms            Fade time in [ms]
+ */
+void disp_backlight_fade(disp_backlight_h bckl, int brightness_percent, int fade_ms);
 void disp_backlight_delete(disp_backlight_h bckl);
 
 #ifdef __cplusplus
@@ -6,6 +6,7 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <assert.h>
 #include "ili9341.h"
 #include "disp_spi.h"
 #include "driver/gpio.h"
@@ -36,7 +37,9 @@ static void ili9341_set_orientation(uint8_t orientation);
 
 static void ili9341_send_cmd(uint8_t cmd);
 static void ili9341_send_data(void * data, uint16_t length);
-static void ili9341_send_color(void * data, uint16_t length);
+static void ili9341_send_color(void * data, size_t length);
+static void ili9341_queue_cmd(uint8_t cmd);
+static void ili9341_queue_data(const uint8_t * data, uint8_t length);
 
 /**********************
  *  STATIC VARIABLES
@@ -83,6 +86,7 @@ void ili9341_init(void)
 	//Initialize non-SPI GPIOs
     esp_rom_gpio_pad_select_gpio(ILI9341_DC);
 	gpio_set_direction(ILI9341_DC, GPIO_MODE_OUTPUT);
+	disp_spi_set_dc_pin(ILI9341_DC);
 
 #if ILI9341_USE_RST
     esp_rom_gpio_pad_select_gpio(ILI9341_RST);
@@ -122,7 +126,34 @@ void ili9341_init(void)
 void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
 	uint8_t data[4];
+	uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
+
+#if ILI9341_ASYNC_FLUSH
+	/*Everything is queued, nothing waits: DC follows each transaction from the SPI pre callback and
+	 *flush ready is signalled from spi_ready once the pixels are out. The parameters are at most 4 bytes,
+	 *so they are copied into the transactions and data[] need not outlive this call.*/
+
+	/*Column addresses*/
+	ili9341_queue_cmd(0x2A);
+	data[0] = (area->x1 >> 8) & 0xFF;
+	data[1] = area->x1 & 0xFF;
+	data[2] = (area->x2 >> 8) & 0xFF;
+	data[3] = area->x2 & 0xFF;
+	ili9341_queue_data(data, 4);
+
+	/*Page addresses*/
+	ili9341_queue_cmd(0x2B);
+	data[0] = (area->y1 >> 8) & 0xFF;
+	data[1] = area->y1 & 0xFF;
+	data[2] = (area->y2 >> 8) & 0xFF;
+	data[3] = area->y2 & 0xFF;
+	ili9341_queue_data(data, 4);
 
+	/*Memory write*/
+	ili9341_queue_cmd(0x2C);
+	disp_spi_transaction((const uint8_t *)color_map, size * 2,
+		DISP_SPI_SEND_QUEUED | DISP_SPI_SIGNAL_FLUSH | DISP_SPI_DC_DATA, NULL, 0, 0);
+#else
 	/*Column addresses*/
 	ili9341_send_cmd(0x2A);
 	data[0] = (area->x1 >> 8) & 0xFF;
@@ -141,8 +172,8 @@ void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * col
 
 	/*Memory write*/
 	ili9341_send_cmd(0x2C);
-	uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
 	ili9341_send_color((void*)color_map, size * 2);
+#endif
 }
 
 void ili9341_sleep_in()
@@ -178,13 +209,24 @@ static void ili9341_send_data(void * data, uint16_t length)
     disp_spi_send_data(data, length);
 }
 
-static void ili9341_send_color(void * data, uint16_t length)
+static void ili9341_send_color(void * data, size_t length)
 {
     disp_wait_for_pending_transactions();
     gpio_set_level(ILI9341_DC, 1);   /*Data mode*/
     disp_spi_send_colors(data, length);
 }
 
+static void ili9341_queue_cmd(uint8_t cmd)
+{
+    disp_spi_transaction(&cmd, 1, DISP_SPI_SEND_QUEUED | DISP_SPI_DC_CMD, NULL, 0, 0);
+}
+
+static void ili9341_queue_data(const uint8_t * data, uint8_t length)
+{
+    assert(length <= 4);    /*Copied into the transaction, see ili9341_flush*/
+    disp_spi_transaction(data, length, DISP_SPI_SEND_QUEUED | DISP_SPI_DC_DATA, NULL, 0, 0);
+}
+
 static void ili9341_set_orientation(uint8_t orientation)
 {
     // ESP_ASSERT(orientation < 4);
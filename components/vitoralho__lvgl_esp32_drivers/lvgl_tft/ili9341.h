@@ -31,6 +31,11 @@ extern "C" {
 #define ILI9341_RST       CONFIG_LV_DISP_PIN_RST
 #define ILI9341_INVERT_COLORS CONFIG_LV_INVERT_COLORS
 
+/* 1: flush queues CASET, PASET, RAMWR and the pixels as back to back DMA transactions with DC driven by the
+ * SPI pre transaction callback and returns at once. 0: each command and its data are sent polling, with the
+ * CPU toggling DC and waiting between them (original behaviour, kept for comparison). */
+#define ILI9341_ASYNC_FLUSH 1
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -0,0 +1,192 @@
+/*
+ * @file bench_banner.c
+ * @brief The scrolling banner (main/app_banner.c) moved as a label by LVGL and drawn from its pre-rendered strip,
+ *        on LVGL configured as on the device (glyph cache and RGB565 blend hooked): the main screen's banner box and
+ *        text on a 320 x 240 display drawn in strips, through one full scroll period at the refresh period. Each
+ *        frame's framebuffer is checksummed against the label's, and both are reported per second of scrolling:
+ *        CPU in lv_timer_handler (animation, layout, render) and bytes sent to the panel.
+ *
+ *   bench_banner [--check]
+ *
+ *   --check    fail unless every pre-rendered frame is the label's, and it sends fewer bytes and takes less CPU
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "app_include/app_banner.h"
+#include "app_include/app_glyph_cache.h"
+#include "app_include/app_blend_565.h"
+
+#define HOR_RES         320     // The panel in landscape, as the UI sees it
+#define VER_RES         240
+#define STRIP_LINES     12
+#define PERIOD_MS       5000    // ANIM_PERIOD_MS
+#define FRAMES          (PERIOD_MS / LV_DISP_DEF_REFR_PERIOD)
+#define ROUNDS          5       // Best of, per mode
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    double cpu_us_s;            // lv_timer_handler time per second of scrolling, best round
+    double bytes_s;             // Sent to the panel per second
+    uint32_t frames;            // Frames that flushed anything
+    bool same;                  // Every frame identical to the label's
+    app_banner_stats_t stats;
+} result_t;
+
+static lv_color_t fb[VER_RES][HOR_RES];
+static uint32_t label_sums[FRAMES];
+static uint64_t flushed_px;
+static uint32_t flushes;
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y][area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    flushes++;
+    flushed_px += lv_area_get_size(area);
+    lv_disp_flush_ready(disp_drv);
+}
+
+static uint32_t fb_sum(void) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    const uint8_t * p = (const uint8_t *)fb;
+    for (size_t i = 0; i < sizeof(fb); i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+/*---------------------------------------------------------------
+    One round: the banner as app_ui builds it, settled, then one
+    scroll period. Returns ns spent in lv_timer_handler
+---------------------------------------------------------------*/
+static int64_t run(bool prerender, uint32_t * sums, uint32_t * frames) {
+
+    int64_t ns = 0;
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 100, 30);
+    lv_obj_center(obj);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Sound Steering - Remote Module                By K. Harper");
+    lv_obj_add_flag(label, LV_OBJ_FLAG_FLOATING);
+    lv_obj_center(label);
+    lv_obj_update_layout(obj);
+    lv_obj_align(obj, LV_ALIGN_CENTER, -70, -75);
+    app_banner_start(label, lv_obj_get_width(obj) + 160, -lv_obj_get_width(label) - 20, PERIOD_MS, prerender);
+
+    lv_refr_now(NULL);
+    flushed_px = 0;
+    *frames = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+        uint32_t before = flushes;
+        int64_t start = host_ns();
+        lv_timer_handler();
+        ns += host_ns() - start;
+        *frames += (flushes != before);
+        sums[f] = fb_sum();
+    }
+    return ns;
+}
+
+static void bench(bool prerender, result_t * result) {
+
+    static uint32_t sums[FRAMES];
+    int64_t best = INT64_MAX;
+
+    result->same = true;
+    for (int r = 0; r < ROUNDS; r++) {
+        int64_t ns = run(prerender, prerender ? sums : label_sums, &result->frames);
+        best = LV_MIN(best, ns);
+        if (prerender) {
+            result->same &= (memcmp(sums, label_sums, sizeof(sums)) == 0);
+        }
+    }
+    result->cpu_us_s = best / 1000.0 / (PERIOD_MS / 1000.0);
+    result->bytes_s = flushed_px * sizeof(lv_color_t) / (PERIOD_MS / 1000.0);
+    app_banner_get_stats(&result->stats);
+}
+
+int main(int argc, char ** argv) {
+
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else {
+            printf("usage: %s [--check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static lv_color_t buf[HOR_RES * STRIP_LINES];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * STRIP_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    lv_disp_drv_register(&disp_drv);
+    app_glyph_cache_init();
+    app_blend_565_init();
+
+    printf("%dx%d, %d line strips, %d frames (one %d ms scroll period), best of %d\n", HOR_RES, VER_RES, STRIP_LINES,
+           FRAMES, PERIOD_MS, ROUNDS);
+
+    result_t label;
+    result_t strip;
+    bench(false, &label);
+    bench(true, &strip);
+
+    printf("label         %7.1f us/s CPU, %8.0f B/s to the panel, %3lu frames flushed\n", label.cpu_us_s,
+           label.bytes_s, (unsigned long)label.frames);
+    printf("pre-rendered  %7.1f us/s CPU (%.2fx), %8.0f B/s to the panel (%.2fx), %3lu frames flushed, %lu B strip, "
+           "%lu overlaps, %s\n", strip.cpu_us_s, label.cpu_us_s / strip.cpu_us_s, strip.bytes_s,
+           label.bytes_s / strip.bytes_s, (unsigned long)strip.frames, (unsigned long)strip.stats.strip_bytes,
+           (unsigned long)strip.stats.overlaps, strip.same ? "identical" : "DIFFERENT");
+
+    if (check) {
+        CHECK(!label.stats.prerendered);
+        CHECK(strip.stats.prerendered);
+        CHECK(strip.same);
+        CHECK(strip.bytes_s < label.bytes_s);
+        CHECK(strip.cpu_us_s < label.cpu_us_s);
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All banner checks passed\n");
+    }
+    return 0;
+}
@@ -0,0 +1,343 @@
+/*
+ * @file bench_blend.c
+ * @brief The RGB565 blend kernels (main/app_blend_565.c) against LVGL's lv_draw_sw_blend_basic, on LVGL configured
+ *        as on the device. Both blend into the same draw buffer from the same start:
+ *          - every colour / background / mix combination of each mixing kernel (fill with opacity, masked fill,
+ *            image with opacity), channel by channel
+ *          - random areas, clips, opacities, masks and images on an odd width buffer, so rows start at both
+ *            halfword alignments
+ *        and must leave the buffer bit for bit the same. Then each case is timed on a panel strip.
+ *
+ *   bench_blend [--check]
+ *
+ *   --check    fail unless every comparison is bit exact and the kernels that work on two pixels per word are
+ *              faster than LVGL's. Per pixel masked mixes are reported only: on the host's multiplier they
+ *              cost about what LVGL's do, the multiplies they save count on the ESP32
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "app_include/app_blend_565.h"
+
+#define HOR_RES         160
+#define STRIP_LINES     12      // The device's draw buffer
+#define BUF_W           161     // Random tests: odd, so every other row starts half a word in
+#define BUF_H           40
+#define RANDOM_RUNS     20000
+#define BENCH_NS        100000000LL     // Per case and blend, best of repeated passes within
+#define MIN_SPEEDUP     1.0     // Word wide kernels have to beat LVGL on the host too
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef void (*blend_fn_t)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+static lv_draw_ctx_t * ctx;
+static uint32_t rng = 12345;
+
+static uint32_t rnd(uint32_t n) {
+    rng = rng * 1664525u + 1013904223u;     // LCG, reproducible
+    return (rng >> 8) % n;
+}
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static lv_color_t rgb(uint32_t r, uint32_t g, uint32_t b) {
+    lv_color_t c;
+    LV_COLOR_SET_R(c, r);
+    LV_COLOR_SET_G(c, g);
+    LV_COLOR_SET_B(c, b);
+    return c;
+}
+
+// Colour i of 64: green takes every value, red and blue every value twice
+static lv_color_t ramp(uint32_t i) {
+    return rgb(i & 0x1F, i, (i * 7) & 0x1F);
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    lv_disp_flush_ready(disp_drv);
+}
+
+/*---------------------------------------------------------------
+    Blend dsc into buf (w x h, at 0,0) with both blends, from
+    the same start. True if they agree
+---------------------------------------------------------------*/
+static bool same_blend(lv_color_t * buf, lv_color_t * ref, lv_color_t * start, int32_t w, int32_t h,
+                       const lv_area_t * clip, lv_draw_sw_blend_dsc_t * dsc, lv_opa_t * mask, size_t mask_size) {
+
+    static lv_opa_t mask_copy[64 * 256];     // The biggest, exhaustive()'s
+    lv_area_t buf_area = {0, 0, w - 1, h - 1};
+    size_t size = (size_t)w * h * sizeof(lv_color_t);
+
+    ctx->buf_area = &buf_area;
+    ctx->clip_area = clip;
+    if (mask) {
+        memcpy(mask_copy, mask, mask_size);     // LVGL may round it in place, each blend gets the original
+    }
+
+    memcpy(ref, start, size);
+    ctx->buf = ref;
+    lv_draw_sw_blend_basic(ctx, dsc);
+
+    if (mask) {
+        memcpy(mask, mask_copy, mask_size);
+    }
+    memcpy(buf, start, size);
+    ctx->buf = buf;
+    app_blend_565(ctx, dsc);
+
+    return memcmp(buf, ref, size) == 0;
+}
+
+/*---------------------------------------------------------------
+    Every (foreground, background, mix) of each channel, through
+    each kernel that mixes. Returns the mismatching passes
+---------------------------------------------------------------*/
+static int exhaustive(void) {
+
+    static lv_color_t start[64 * 256], buf[64 * 256], ref[64 * 256], src[64 * 256];
+    static lv_opa_t mask[64 * 256];
+    int bad = 0;
+
+    // Masked fill, opaque: x is the mask, y the background
+    lv_area_t area = {0, 0, 255, 63};
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 256; x++) {
+            start[y * 256 + x] = ramp(y);
+            mask[y * 256 + x] = x;
+        }
+    }
+    for (int f = 0; f < 64; f++) {
+        lv_draw_sw_blend_dsc_t dsc = {.blend_area = &area, .mask_area = &area, .mask_buf = mask,
+                                      .mask_res = LV_DRAW_MASK_RES_CHANGED, .color = ramp(f), .opa = LV_OPA_COVER};
+        bad += !same_blend(buf, ref, start, 256, 64, &area, &dsc, mask, sizeof(mask));
+    }
+
+    // Fill and image with opacity: x the background, y the foreground (image) or nothing (fill)
+    lv_area_t row = {0, 0, 63, 63};
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            start[y * 64 + x] = ramp(x);
+            src[y * 64 + x] = ramp(y);
+        }
+    }
+    for (int opa = LV_OPA_MIN + 1; opa < LV_OPA_MAX; opa++) {
+        lv_draw_sw_blend_dsc_t map = {.blend_area = &row, .src_buf = src, .opa = opa};
+        bad += !same_blend(buf, ref, start, 64, 64, &row, &map, NULL, 0);
+        for (int f = 0; f < 64; f++) {
+            lv_draw_sw_blend_dsc_t fill = {.blend_area = &row, .color = ramp(f), .opa = opa};
+            bad += !same_blend(buf, ref, start, 64, 64, &row, &fill, NULL, 0);
+        }
+    }
+    return bad;
+}
+
+/*---------------------------------------------------------------
+    Random blends on the odd width buffer. Returns the mismatches
+---------------------------------------------------------------*/
+static int random_blends(int runs) {
+
+    static lv_color_t start[BUF_W * BUF_H], buf[BUF_W * BUF_H], ref[BUF_W * BUF_H], src[BUF_W * BUF_H];
+    static lv_opa_t mask[BUF_W * BUF_H * 2];
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_MAX + 1, LV_OPA_MAX, LV_OPA_MAX - 1, LV_OPA_50, LV_OPA_MIN + 1};
+    int bad = 0;
+
+    for (int r = 0; r < runs; r++) {
+        // Flat or noisy background
+        lv_color_t bg = {.full = (uint16_t)rnd(0x10000)};
+        bool flat = rnd(2);
+        for (int i = 0; i < BUF_W * BUF_H; i++) {
+            start[i].full = flat ? bg.full : (uint16_t)rnd(0x10000);
+            src[i].full = (uint16_t)rnd(0x10000);
+        }
+
+        lv_area_t area, clip, mask_area;
+        area.x1 = rnd(BUF_W) - 8;
+        area.y1 = rnd(BUF_H) - 4;
+        area.x2 = area.x1 + rnd(BUF_W);
+        area.y2 = area.y1 + rnd(12);
+        clip.x1 = rnd(BUF_W / 2);
+        clip.y1 = rnd(BUF_H / 2);
+        clip.x2 = clip.x1 + rnd(BUF_W - clip.x1);
+        clip.y2 = clip.y1 + rnd(BUF_H - clip.y1);
+
+        // The mask may be wider than the area, as LVGL's are for a strip of a bigger shape
+        mask_area = area;
+        mask_area.x1 -= rnd(3);
+        mask_area.x2 += rnd(3);
+        size_t mask_size = (size_t)lv_area_get_size(&mask_area);
+        for (size_t i = 0; i < mask_size; i++) {
+            uint32_t k = rnd(8);
+            mask[i] = (k < 3) ? LV_OPA_TRANSP : (k < 6) ? LV_OPA_COVER : (k == 6) ? LV_OPA_MAX + rnd(3) : rnd(256);
+        }
+
+        lv_draw_sw_blend_dsc_t dsc;
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.blend_area = &area;
+        dsc.opa = (rnd(3) == 0) ? (lv_opa_t)rnd(256) : opas[rnd(sizeof(opas))];
+        dsc.color.full = (uint16_t)rnd(0x10000);
+        dsc.src_buf = rnd(2) ? src : NULL;
+        switch (rnd(4)) {
+            case 0: dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER; break;
+            case 1: dsc.mask_res = LV_DRAW_MASK_RES_TRANSP; dsc.mask_buf = mask; dsc.mask_area = &mask_area; break;
+            default: dsc.mask_res = LV_DRAW_MASK_RES_CHANGED; dsc.mask_buf = mask; dsc.mask_area = &mask_area; break;
+        }
+
+        if (!same_blend(buf, ref, start, BUF_W, BUF_H, &clip, &dsc, dsc.mask_buf ? mask : NULL, mask_size)) {
+            if (bad++ < 5) {
+                printf("  differs: area %d,%d %d,%d clip %d,%d %d,%d opa %d %s mask_res %d\n", area.x1, area.y1,
+                       area.x2, area.y2, clip.x1, clip.y1, clip.x2, clip.y2, dsc.opa, dsc.src_buf ? "map" : "fill",
+                       dsc.mask_res);
+            }
+        }
+    }
+    return bad;
+}
+
+/*---------------------------------------------------------------
+    Timing on a panel strip
+---------------------------------------------------------------*/
+typedef struct {
+    const char * name;
+    bool image;
+    lv_opa_t opa;
+    int mask;                   // 0 none, 1 glyph like (mostly 0 and 255 runs), 2 gradient
+    bool held;                  // Two pixels per word, held to MIN_SPEEDUP
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    {"fill",                 false, LV_OPA_COVER, 0, false},
+    {"fill, opa",            false, LV_OPA_50,    0, true},
+    {"fill, glyph mask",     false, LV_OPA_COVER, 1, true},
+    {"fill, gradient mask",  false, LV_OPA_COVER, 2, false},
+    {"fill, mask + opa",     false, LV_OPA_70,    2, false},
+    {"image",                true,  LV_OPA_COVER, 0, false},
+    {"image, opa",           true,  LV_OPA_50,    0, true},
+    {"image, glyph mask",    true,  LV_OPA_COVER, 1, false},
+    {"image, gradient mask", true,  LV_OPA_COVER, 2, false},
+    {"image, mask + opa",    true,  LV_OPA_70,    2, false},
+};
+
+static double time_blend(blend_fn_t fn, lv_color_t * buf, lv_draw_sw_blend_dsc_t * dsc) {
+
+    lv_area_t buf_area = {0, 0, HOR_RES - 1, STRIP_LINES - 1};
+    int64_t best = INT64_MAX;
+    int64_t end = host_ns() + BENCH_NS;
+
+    ctx->buf = buf;
+    ctx->buf_area = &buf_area;
+    ctx->clip_area = &buf_area;
+    while (host_ns() < end) {
+        int64_t start = host_ns();
+        for (int i = 0; i < 20; i++) {
+            fn(ctx, dsc);
+        }
+        int64_t ns = (host_ns() - start) / 20;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+    return (double)HOR_RES * STRIP_LINES * 1000.0 / best;     // Mpx/s
+}
+
+static void bench(bool check) {
+
+    static lv_color_t buf[HOR_RES * STRIP_LINES], src[HOR_RES * STRIP_LINES];
+    static lv_opa_t mask[HOR_RES * STRIP_LINES];
+    lv_area_t area = {1, 0, HOR_RES - 2, STRIP_LINES - 1};      // Odd start, as a widget's edge usually is
+
+    for (int i = 0; i < HOR_RES * STRIP_LINES; i++) {
+        src[i] = ramp(i % 64);
+    }
+
+    printf("%dx%d strip, Mpx/s          LVGL   kernels\n", HOR_RES, STRIP_LINES);
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        const bench_case_t * bc = &cases[c];
+        for (int i = 0; i < HOR_RES * STRIP_LINES; i++) {
+            int x = i % HOR_RES;
+            mask[i] = (bc->mask == 1) ? ((x / 6) % 2 ? LV_OPA_COVER : (x % 6 == 0) ? LV_OPA_50 : LV_OPA_TRANSP) :
+                      (uint8_t)(x * 255 / HOR_RES);
+            buf[i] = lv_color_hex(0x202020);
+        }
+        lv_draw_sw_blend_dsc_t dsc;
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.blend_area = &area;
+        dsc.mask_area = &area;
+        dsc.mask_buf = bc->mask ? mask : NULL;
+        dsc.mask_res = bc->mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+        dsc.src_buf = bc->image ? src : NULL;
+        dsc.color = lv_color_hex(0x3080F0);
+        dsc.opa = bc->opa;
+
+        double lvgl = time_blend(lv_draw_sw_blend_basic, buf, &dsc);
+        double ours = time_blend(app_blend_565, buf, &dsc);
+        printf("%-24s %8.1f %8.1f  (%.2fx)\n", bc->name, lvgl, ours, ours / lvgl);
+        if (check && bc->held) {
+            CHECK(ours >= lvgl * MIN_SPEEDUP);
+        }
+    }
+}
+
+int main(int argc, char ** argv) {
+
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else {
+            printf("usage: %s [--check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static lv_color_t buf[HOR_RES * STRIP_LINES];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * STRIP_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = 120;
+    lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
+    _lv_refr_set_disp_refreshing(disp);     // Both blends read the driver's flags from the refreshing display
+    ctx = disp_drv.draw_ctx;
+
+    int bad = exhaustive();
+    printf("Exhaustive mixes: %s\n", bad ? "DIFFERENT" : "identical");
+    CHECK(bad == 0);
+
+    bad = random_blends(RANDOM_RUNS);
+    printf("%d random blends: %d different\n", RANDOM_RUNS, bad);
+    CHECK(bad == 0);
+
+    bench(check);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All blend checks passed\n");
+    }
+    return 0;
+}
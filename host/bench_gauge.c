@@ -0,0 +1,248 @@
+/*
+ * @file bench_gauge.c
+ * @brief Draw cost of the main screen's dials: the styled lv_arc (app_arc_create) against app_gauge
+ *        (app_arc_gauge_create), on LVGL configured as on the device. Each widget is swept through its range
+ *        one step at a time, the way the encoders and pots move it, and every value change is refreshed on its
+ *        own; full redraws (the widget under the scrolling banner or an image swap) are timed separately. The
+ *        two renders are also compared pixel for pixel, so the gauge keeps the arc's look.
+ *
+ *   bench_gauge [--check] [--dump]
+ *
+ *   --check    fail unless the gauge is cheaper per value change, invalidates no more pixels, and looks the same
+ *   --dump     write arc_<mode>.ppm and gauge_<mode>.ppm to the working directory
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "app_include/app_spi.h"
+#include "app_include/app_gauge.h"
+
+#define RES             100     // Display, one widget in the middle
+#define SIZE            APP_ARC_SIZE
+#define FULL_REDRAWS    200
+#define SWEEPS          5       // Up and down the range, per widget
+#define MAX_MEAN_DIFF   4.0     // Mean per channel difference over the display, of 255
+#define MAX_DIFF_PX     (RES * RES / 50)    // Pixels differing by more than 64 in any channel
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    const char * name;
+    lv_obj_t * (*create)(bool symmetric);
+    void (*set_value)(lv_obj_t * obj, int16_t value);
+} widget_t;
+
+typedef struct {
+    double full_us;             // Mean per full redraw
+    double change_us;           // Mean per value change
+    double change_px;
+    uint32_t changes;
+} result_t;
+
+static lv_color_t fb[RES][RES];
+static uint32_t frame_px;
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y][area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+    frame_px += px;
+}
+
+static lv_obj_t * arc_create(bool symmetric) {
+    return app_arc_create(lv_scr_act(), PARTIAL_ARC, SIZE, LV_ALIGN_CENTER, 0, 0, symmetric);
+}
+
+static void arc_set_value(lv_obj_t * obj, int16_t value) {
+    lv_arc_set_value(obj, value);
+}
+
+static lv_obj_t * gauge_create(bool symmetric) {
+    return app_arc_gauge_create(lv_scr_act(), SIZE, LV_ALIGN_CENTER, 0, 0, symmetric);
+}
+
+static const widget_t widgets[2] = {
+    {"lv_arc", arc_create, arc_set_value},
+    {"app_gauge", gauge_create, app_gauge_set_value},
+};
+
+// Refresh now and return the time taken, ns
+static int64_t refresh(void) {
+    int64_t start = host_ns();
+    lv_refr_now(NULL);
+    return host_ns() - start;
+}
+
+/*---------------------------------------------------------------
+    Time one widget, leave its render at the reference value in fb
+---------------------------------------------------------------*/
+static void bench(const widget_t * widget, bool symmetric, result_t * result) {
+
+    int16_t min = symmetric ? -60 : 0;
+    int16_t max = symmetric ? 60 : 100;
+    int64_t ns = 0;
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * obj = widget->create(symmetric);
+    widget->set_value(obj, min);
+    refresh();
+
+    for (int i = 0; i < FULL_REDRAWS; i++) {
+        lv_obj_invalidate(obj);
+        ns += refresh();
+    }
+    result->full_us = ns / 1000.0 / FULL_REDRAWS;
+
+    ns = 0;
+    frame_px = 0;
+    result->changes = 0;
+    for (int s = 0; s < SWEEPS; s++) {
+        for (int v = min + 1; v <= max; v++) {
+            widget->set_value(obj, (s & 1) ? max + min - v : v);
+            ns += refresh();
+            result->changes++;
+        }
+    }
+    result->change_us = ns / 1000.0 / result->changes;
+    result->change_px = (double)frame_px / result->changes;
+
+    // Reference render: a value off the sector boundaries of either mode
+    widget->set_value(obj, min + (max - min) * 3 / 8);
+    lv_obj_invalidate(lv_scr_act());
+    refresh();
+}
+
+static void ppm_write(const char * path, lv_color_t (*img)[RES]) {
+    FILE * f = fopen(path, "wb");
+    if (f == NULL) {
+        return;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", RES, RES);
+    for (int y = 0; y < RES; y++) {
+        for (int x = 0; x < RES; x++) {
+            uint32_t c = lv_color_to32(img[y][x]);
+            uint8_t rgb[3] = {(c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF};
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+static void compare(lv_color_t (*a)[RES], lv_color_t (*b)[RES], double * mean, int * diff_px) {
+    uint64_t sum = 0;
+    *diff_px = 0;
+    for (int y = 0; y < RES; y++) {
+        for (int x = 0; x < RES; x++) {
+            uint32_t ca = lv_color_to32(a[y][x]);
+            uint32_t cb = lv_color_to32(b[y][x]);
+            int worst = 0;
+            for (int shift = 0; shift < 24; shift += 8) {
+                int d = abs((int)((ca >> shift) & 0xFF) - (int)((cb >> shift) & 0xFF));
+                sum += d;
+                worst = LV_MAX(worst, d);
+            }
+            *diff_px += (worst > 64);
+        }
+    }
+    *mean = (double)sum / (RES * RES * 3);
+}
+
+int main(int argc, char ** argv) {
+
+    bool check = false;
+    bool dump = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else if (strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        }
+        else {
+            printf("usage: %s [--check] [--dump]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static lv_color_t buf[RES * RES];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    static lv_color_t renders[2][RES][RES];
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, RES * RES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.monitor_cb = monitor_cb;
+    disp_drv.hor_res = RES;
+    disp_drv.ver_res = RES;
+    lv_disp_drv_register(&disp_drv);
+
+    printf("%dpx dial, %d full redraws and %d sweeps through the range per widget\n", SIZE, FULL_REDRAWS, SWEEPS);
+    for (int mode = 0; mode < 2; mode++) {
+        const char * mode_name = mode ? "symmetrical" : "normal";
+        result_t results[2];
+
+        for (int w = 0; w < 2; w++) {
+            bench(&widgets[w], mode, &results[w]);
+            memcpy(renders[w], fb, sizeof(fb));
+            printf("%-12s %-10s full redraw %7.1f us, per value change %6.1f us and %6.0f px over %lu changes\n",
+                   mode_name, widgets[w].name, results[w].full_us, results[w].change_us, results[w].change_px,
+                   (unsigned long)results[w].changes);
+            if (dump) {
+                char path[64];
+                snprintf(path, sizeof(path), "%s_%s.ppm", w ? "gauge" : "arc", mode_name);
+                ppm_write(path, renders[w]);
+            }
+        }
+
+        double mean;
+        int diff_px;
+        compare(renders[0], renders[1], &mean, &diff_px);
+        printf("%-12s gauge %.1fx faster per change, %.1fx per full redraw; render differs by %.2f/255 mean, %d px\n",
+               mode_name, results[0].change_us / results[1].change_us, results[0].full_us / results[1].full_us,
+               mean, diff_px);
+
+        if (check) {
+            CHECK(results[1].change_us < results[0].change_us);
+            CHECK(results[1].full_us < results[0].full_us);
+            CHECK(results[1].change_px <= results[0].change_px);
+            CHECK(mean <= MAX_MEAN_DIFF);
+            CHECK(diff_px <= MAX_DIFF_PX);
+        }
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All gauge checks passed\n");
+    }
+    return 0;
+}
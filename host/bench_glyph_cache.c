@@ -0,0 +1,223 @@
+/*
+ * @file bench_glyph_cache.c
+ * @brief Text heavy redraws with and without the glyph cache (main/app_glyph_cache.c), on LVGL configured as on
+ *        the device: four dial value labels and the battery label change every frame and the banner scrolls a
+ *        pixel per frame, drawn in strips like the panel. The same frames are rendered by LVGL alone and with the
+ *        cache at a few budgets, each frame's framebuffer is checksummed against LVGL's, and the cache's hit rate,
+ *        evictions and heap are reported per budget.
+ *
+ *   bench_glyph_cache [--check]
+ *
+ *   --check    fail unless every budget renders every frame exactly as LVGL does, the default budget draws letters
+ *              faster than LVGL and holds the working set (hit rate), and no budget is overspent
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "app_include/app_glyph_cache.h"
+
+#define HOR_RES         160
+#define VER_RES         120
+#define STRIP_LINES     12      // Draw buffer height, the device renders the screen in strips too
+#define FRAMES          400
+#define ROUNDS          3       // Best of, per budget
+#define MIN_HIT_PCT     99      // At the default budget, the UI's text fits
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    double frame_us;            // Mean per frame, best round
+    double letter_ns;           // Mean per draw_letter call, same round
+    bool same;                  // Every frame identical to LVGL's
+    app_glyph_cache_stats_t stats;      // Over one round, from an empty cache
+    lv_mem_monitor_t mem;       // After the round
+} result_t;
+
+static lv_color_t fb[VER_RES][HOR_RES];
+static uint32_t lvgl_sums[FRAMES];
+
+static const uint32_t budgets[] = {0, 1024, 3072, APP_GLYPH_CACHE_BYTES};
+
+// draw_letter, timed around the cache (or LVGL's, with the cache off)
+static void (*cached_draw_letter)(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                                  uint32_t letter);
+static int64_t letter_ns;
+static uint32_t letters;
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y][area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void timed_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                              uint32_t letter) {
+    int64_t start = host_ns();
+    cached_draw_letter(draw_ctx, dsc, pos_p, letter);
+    letter_ns += host_ns() - start;
+    letters++;
+}
+
+static uint32_t fb_sum(void) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    const uint8_t * p = (const uint8_t *)fb;
+    for (size_t i = 0; i < sizeof(fb); i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+/*---------------------------------------------------------------
+    One round: build the screen, run the frames. Returns ns spent
+    refreshing
+---------------------------------------------------------------*/
+static int64_t run(uint32_t * sums) {
+
+    lv_obj_t * dials[4];
+    int64_t ns = 0;
+
+    lv_obj_clean(lv_scr_act());
+    for (int i = 0; i < 4; i++) {
+        dials[i] = lv_label_create(lv_scr_act());
+        lv_obj_align(dials[i], LV_ALIGN_TOP_LEFT, 10 + (i % 2) * 60, 10 + (i / 2) * 25);
+    }
+    lv_obj_t * vbat = lv_label_create(lv_scr_act());
+    lv_obj_align(vbat, LV_ALIGN_BOTTOM_LEFT, 10, -10);
+
+    lv_obj_t * box = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(box, 120, 30);
+    lv_obj_align(box, LV_ALIGN_CENTER, 0, 15);
+    lv_obj_t * banner = lv_label_create(box);
+    lv_label_set_text(banner, "Sound Steering - Remote Module                By K. Harper");
+
+    letter_ns = 0;
+    letters = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        for (int i = 0; i < 4; i++) {
+            lv_label_set_text_fmt(dials[i], "%d", (f * (i + 3) + i * 17) % 121 - 60);
+        }
+        int mv = 3300 + (f * 7) % 900;
+        lv_label_set_text_fmt(vbat, LV_SYMBOL_BATTERY_FULL " %d.%02dV", mv / 1000, (mv % 1000) / 10);
+        lv_obj_set_x(banner, 100 - (f % 400));
+
+        int64_t start = host_ns();
+        lv_refr_now(NULL);
+        ns += host_ns() - start;
+        sums[f] = fb_sum();
+    }
+    return ns;
+}
+
+static void bench(uint32_t budget, result_t * result) {
+
+    static uint32_t sums[FRAMES];
+    int64_t best = INT64_MAX;
+
+    result->same = true;
+    for (int r = 0; r < ROUNDS; r++) {
+        app_glyph_cache_set_budget(budget);     // Empty, so each round counts its own misses
+        app_glyph_cache_reset_stats();
+        int64_t ns = run(budget ? sums : lvgl_sums);
+        if (ns < best) {
+            best = ns;
+            result->letter_ns = (double)letter_ns / letters;
+        }
+        if (budget) {
+            result->same &= (memcmp(sums, lvgl_sums, sizeof(sums)) == 0);
+        }
+    }
+    result->frame_us = best / 1000.0 / FRAMES;
+    app_glyph_cache_get_stats(&result->stats);
+    lv_mem_monitor(&result->mem);
+}
+
+int main(int argc, char ** argv) {
+
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else {
+            printf("usage: %s [--check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static lv_color_t buf[HOR_RES * STRIP_LINES];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * STRIP_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    lv_disp_drv_register(&disp_drv);
+    app_glyph_cache_init();
+    cached_draw_letter = disp_drv.draw_ctx->draw_letter;
+    disp_drv.draw_ctx->draw_letter = timed_draw_letter;
+
+    printf("%dx%d, %d line strips, %d frames of 5 changing labels and a scrolling banner, best of %d\n", HOR_RES,
+           VER_RES, STRIP_LINES, FRAMES, ROUNDS);
+
+    result_t results[sizeof(budgets) / sizeof(budgets[0])];
+    for (size_t b = 0; b < sizeof(budgets) / sizeof(budgets[0]); b++) {
+        result_t * r = &results[b];
+        bench(budgets[b], r);
+        if (budgets[b] == 0) {
+            printf("LVGL         %7.1f us/frame, %6.1f ns/letter, heap %lu B\n", r->frame_us, r->letter_ns,
+                   (unsigned long)(r->mem.total_size - r->mem.free_size));
+            continue;
+        }
+        uint32_t lookups = r->stats.hits + r->stats.misses;
+        printf("%5lu B cache %7.1f us/frame (%.2fx), %6.1f ns/letter (%.2fx), %5.1f%% hits, %lu misses, %lu evictions, %lu bypassed, "
+               "%lu entries %lu B, heap %lu B, %s\n", (unsigned long)budgets[b], r->frame_us,
+               results[0].frame_us / r->frame_us, r->letter_ns, results[0].letter_ns / r->letter_ns, lookups ? 100.0 * r->stats.hits / lookups : 0.0,
+               (unsigned long)r->stats.misses, (unsigned long)r->stats.evictions, (unsigned long)r->stats.bypassed,
+               (unsigned long)r->stats.entries, (unsigned long)r->stats.bytes,
+               (unsigned long)(r->mem.total_size - r->mem.free_size), r->same ? "identical" : "DIFFERENT");
+
+        if (check) {
+            CHECK(r->same);
+            CHECK(r->stats.bytes <= budgets[b]);
+            CHECK(r->stats.bypassed == 0);
+            if (budgets[b] == APP_GLYPH_CACHE_BYTES) {
+                CHECK(r->letter_ns < results[0].letter_ns);
+                CHECK(r->stats.hits >= (uint64_t)lookups * MIN_HIT_PCT / 100);
+            }
+        }
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All glyph cache checks passed\n");
+    }
+    return 0;
+}
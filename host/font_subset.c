@@ -0,0 +1,889 @@
+/*
+ * @file font_subset.c
+ * @brief Generates app_font_ui, the device's LV_FONT_DEFAULT: lv_font_montserrat_14 (ASCII and the LVGL
+ *        symbols) cut down to the glyphs the UI can print. The UI sources are scanned for what reaches a label:
+ *          - the text of lv_label_set_text(), _set_text_static() and _ins_text() calls
+ *          - the format of lv_label_set_text_fmt() calls, with the characters each conversion can print
+ *            (digits and sign for %d, ...) and, for %s, the strings the argument is taken from: a literal or
+ *            a string table initialised in the scanned sources (app_icons[state])
+ *          - app_num_label_set() calls (main/app_num_label.c): prefix and a space, sign, digits, the decimal
+ *            point unless decimals is 0, and suffix
+ *          - LV_SYMBOL_... macros, read from LVGL's lv_symbol_def.h
+ *        Text the scan can't account for fails the build rather than rendering placeholder boxes on the device.
+ *
+ *        Glyphs are renumbered in code point order with their bitmaps and kerning classes (compacted to the
+ *        classes left in use). Runs of nearby code points get an LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL cmap each, a
+ *        direct table from code point to glyph, where the full font looks symbols up by binary search; a new
+ *        cmap is started where a gap would cost more table than a cmap.
+ *
+ *   font_subset [--check] [--out FILE] SOURCE...
+ *
+ *   --out FILE write the font source there (default: app_font_ui.c in the working directory)
+ *   --check    write nothing: fail unless every glyph, pair kerning and miss of the subset is what the full
+ *              font gives, for every character the UI prints
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "lvgl.h"
+
+#define FONT_NAME       "app_font_ui"
+#define MAX_TOKENS      20000
+#define MAX_TEXT        256     // Bytes of one label text
+#define MAX_TABLES      32
+#define MAX_GLYPHS      255     // FORMAT0_FULL offsets are 8 bit, glyph_id_start 0 keeps offset 0 as "missing"
+#define MAX_CMAPS       16
+#define LOOKUP_ROUNDS   20000
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef enum {
+    TOK_IDENT,
+    TOK_STRING,     // Decoded bytes in text/len
+    TOK_PUNCT,
+    TOK_OTHER,      // Numbers, character constants
+} tok_kind_t;
+
+typedef struct {
+    tok_kind_t kind;
+    char text[MAX_TEXT];
+    int len;
+    const char * file;
+    int line;
+} token_t;
+
+typedef struct {
+    char name[64];
+    int first;      // Tokens of the initialiser, between its braces
+    int last;
+} table_t;
+
+static token_t * tokens;
+static int token_count;
+static table_t tables[MAX_TABLES];
+static int table_count;
+static bool used[0x10000];      // Code points the UI prints
+
+// LV_SYMBOL_... definitions, from lv_symbol_def.h
+static token_t * symbols;
+static int symbol_count;
+
+/*---------------------------------------------------------------
+    C tokenizer: comments and preprocessor lines skipped, string
+    literals decoded
+---------------------------------------------------------------*/
+static const char * read_file(const char * path) {
+    FILE * f = fopen(path, "rb");
+    if (f == NULL) {
+        printf("FAIL can't read %s\n", path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char * text = malloc(size + 1);
+    text[fread(text, 1, size, f)] = '\0';
+    fclose(f);
+    return text;
+}
+
+static const char * decode_string(const char * p, token_t * tok) {
+
+    tok->len = 0;
+    for (p++; *p && *p != '"'; p++) {
+        int c = *p;
+        if (c == '\\') {
+            p++;
+            if (*p == 'x') {
+                c = (int)strtol(p + 1, (char **)&p, 16);
+                p--;
+            }
+            else if (*p >= '0' && *p <= '7') {
+                c = 0;
+                for (int i = 0; i < 3 && *p >= '0' && *p <= '7'; i++, p++) {
+                    c = c * 8 + (*p - '0');
+                }
+                p--;
+            }
+            else {
+                c = (*p == 'n') ? '\n' : (*p == 't') ? '\t' : *p;
+            }
+        }
+        if (tok->len < MAX_TEXT - 1) {
+            tok->text[tok->len++] = (char)c;
+        }
+    }
+    tok->text[tok->len] = '\0';
+    return *p ? p + 1 : p;
+}
+
+static void tokenize(const char * path, token_t * out, int * count, int max) {
+
+    const char * p = read_file(path);
+    int line = 1;
+    bool line_start = true;
+
+    while (*p && *count < max) {
+        if (*p == '\n') {
+            line++;
+            line_start = true;
+            p++;
+        }
+        else if (isspace((unsigned char)*p)) {
+            p++;
+        }
+        else if (p[0] == '/' && p[1] == '/') {
+            p = strchr(p, '\n') ? strchr(p, '\n') : p + strlen(p);
+        }
+        else if (p[0] == '/' && p[1] == '*') {
+            const char * end = strstr(p + 2, "*/");
+            for (end = end ? end + 2 : p + strlen(p); p < end; p++) {
+                line += (*p == '\n');
+            }
+        }
+        else if (*p == '#' && line_start) {
+            // Preprocessor line, with its continuations. #define LV_SYMBOL_... is read as tokens
+            if (strncmp(p, "#define", 7) == 0) {
+                p += 7;
+                line_start = false;
+                continue;
+            }
+            while (*p && !(*p == '\n' && p[-1] != '\\')) {
+                line += (*p == '\n');
+                p++;
+            }
+        }
+        else {
+            token_t * tok = &out[(*count)++];
+            tok->file = path;
+            tok->line = line;
+            line_start = false;
+            if (*p == '"') {
+                tok->kind = TOK_STRING;
+                p = decode_string(p, tok);
+            }
+            else if (isalpha((unsigned char)*p) || *p == '_') {
+                tok->kind = TOK_IDENT;
+                tok->len = 0;
+                while ((isalnum((unsigned char)*p) || *p == '_') && tok->len < MAX_TEXT - 1) {
+                    tok->text[tok->len++] = *p++;
+                }
+                tok->text[tok->len] = '\0';
+            }
+            else if (*p == '\'' || isdigit((unsigned char)*p)) {
+                tok->kind = TOK_OTHER;
+                char quote = *p;
+                p++;
+                while (*p && (quote == '\'' ? *p != '\'' : (isalnum((unsigned char)*p) || *p == '.'))) {
+                    p += (*p == '\\') ? 2 : 1;
+                }
+                p += (quote == '\'' && *p);
+                tok->text[0] = '\0';
+                tok->len = 0;
+            }
+            else {
+                tok->kind = TOK_PUNCT;
+                tok->text[0] = *p++;
+                tok->text[1] = '\0';
+                tok->len = 1;
+            }
+        }
+    }
+}
+
+static bool is_punct(int i, char c) {
+    return i < token_count && tokens[i].kind == TOK_PUNCT && tokens[i].text[0] == c;
+}
+
+// Index of the token closing the bracket opened at i
+static int matching(int i) {
+    char open = tokens[i].text[0];
+    char close = (open == '(') ? ')' : (open == '[') ? ']' : '}';
+    int depth = 0;
+    for (; i < token_count; i++) {
+        if (is_punct(i, open)) {
+            depth++;
+        }
+        else if (is_punct(i, close) && --depth == 0) {
+            return i;
+        }
+    }
+    return token_count - 1;
+}
+
+/*---------------------------------------------------------------
+    Text of an expression: literals and LV_SYMBOL_ macros
+    concatenated. False if it is anything else
+---------------------------------------------------------------*/
+static const token_t * find_symbol(const char * name) {
+    for (int s = 0; s + 1 < symbol_count; s++) {
+        if (symbols[s].kind == TOK_IDENT && symbols[s + 1].kind == TOK_STRING && strcmp(symbols[s].text, name) == 0) {
+            return &symbols[s + 1];
+        }
+    }
+    return NULL;
+}
+
+static bool literal_text(int first, int last, char * text, int * len) {
+    *len = 0;
+    for (int i = first; i <= last; i++) {
+        const token_t * tok = &tokens[i];
+        if (tok->kind == TOK_IDENT && strncmp(tok->text, "LV_SYMBOL_", 10) == 0 && find_symbol(tok->text)) {
+            tok = find_symbol(tok->text);
+        }
+        if (tok->kind != TOK_STRING || *len + tok->len >= MAX_TEXT) {
+            return false;
+        }
+        memcpy(text + *len, tok->text, tok->len);
+        *len += tok->len;
+    }
+    text[*len] = '\0';
+    return *len > 0 || first <= last;
+}
+
+static void use_utf8(const char * text, int len) {
+    for (uint32_t i = 0; i < (uint32_t)len;) {
+        uint32_t letter = _lv_txt_encoded_next(text, &i);
+        if (letter < 0x10000) {
+            used[letter] = true;
+        }
+    }
+}
+
+static void use_chars(const char * chars) {
+    use_utf8(chars, strlen(chars));
+}
+
+/*---------------------------------------------------------------
+    What an argument can print: a literal, or every string of a
+    table it indexes
+---------------------------------------------------------------*/
+static bool use_expression(int first, int last) {
+
+    char text[MAX_TEXT];
+    int len;
+
+    if (first > last) {
+        return false;
+    }
+    if (literal_text(first, last, text, &len)) {
+        use_utf8(text, len);
+        return true;
+    }
+    for (int i = first; i <= last; i++) {
+        for (int t = 0; tokens[i].kind == TOK_IDENT && t < table_count; t++) {
+            if (strcmp(tokens[i].text, tables[t].name) != 0) {
+                continue;
+            }
+            for (int j = tables[t].first; j <= tables[t].last; j++) {
+                if (literal_text(j, j, text, &len)) {
+                    use_utf8(text, len);
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// An argument that is just NULL
+static bool is_null(int first, int last) {
+    return first == last && tokens[first].kind == TOK_IDENT && strcmp(tokens[first].text, "NULL") == 0;
+}
+
+/*---------------------------------------------------------------
+    A printf format and its arguments
+---------------------------------------------------------------*/
+static bool use_format(const char * fmt, const int * args, int arg_count, int * arg) {
+
+    for (const char * p = fmt; *p; p++) {
+        if (*p != '%') {
+            continue;
+        }
+        p++;
+        while (*p && strchr("-+ #0", *p)) {
+            if (*p == '+' || *p == ' ') {
+                used[(uint8_t)*p] = true;
+            }
+            p++;
+        }
+        while (*p && (isdigit((unsigned char)*p) || *p == '.' || strchr("hljztL", *p))) {
+            p++;
+        }
+        switch (*p) {
+            case '%':
+                used['%'] = true;
+                continue;
+            case 'd':
+            case 'i':
+                use_chars("-0123456789");
+                break;
+            case 'u':
+                use_chars("0123456789");
+                break;
+            case 'x':
+                use_chars("0123456789abcdef");
+                break;
+            case 'X':
+                use_chars("0123456789ABCDEF");
+                break;
+            case 'f':
+                use_chars("-.0123456789");
+                break;
+            case 's':
+                if (*arg >= arg_count || !use_expression(args[*arg * 2], args[*arg * 2 + 1])) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+        (*arg)++;
+    }
+    return true;
+}
+
+/*---------------------------------------------------------------
+    Scan the sources: string tables first, then label calls
+---------------------------------------------------------------*/
+static void scan(void) {
+
+    typedef enum {
+        CALL_TEXT,
+        CALL_FMT,
+        CALL_NUM,       // app_num_label_set(nl, prefix, value, decimals, suffix)
+    } call_kind_t;
+
+    static const struct {
+        const char * name;
+        int text_arg;
+        call_kind_t kind;
+    } calls[] = {
+        {"lv_label_set_text", 1, CALL_TEXT},
+        {"lv_label_set_text_static", 1, CALL_TEXT},
+        {"lv_label_ins_text", 2, CALL_TEXT},
+        {"lv_label_set_text_fmt", 1, CALL_FMT},
+        {"app_num_label_set", 1, CALL_NUM},
+    };
+
+    // name[...] ... = { "..." ... }
+    for (int i = 0; i + 1 < token_count && table_count < MAX_TABLES; i++) {
+        if (tokens[i].kind != TOK_IDENT || !is_punct(i + 1, '[')) {
+            continue;
+        }
+        int j = i + 1;
+        while (is_punct(j, '[')) {
+            j = matching(j) + 1;
+        }
+        if (is_punct(j, '=') && is_punct(j + 1, '{')) {
+            table_t * table = &tables[table_count++];
+            snprintf(table->name, sizeof(table->name), "%.63s", tokens[i].text);
+            table->first = j + 2;
+            table->last = matching(j + 1) - 1;
+        }
+    }
+
+    for (int i = 0; i + 1 < token_count; i++) {
+        for (size_t c = 0; c < sizeof(calls) / sizeof(calls[0]); c++) {
+            if (tokens[i].kind != TOK_IDENT || strcmp(tokens[i].text, calls[c].name) != 0 || !is_punct(i + 1, '(')) {
+                continue;
+            }
+
+            // Arguments as token ranges
+            int args[32];
+            int arg_count = 0;
+            int end = matching(i + 1);
+            int start = i + 2;
+            for (int j = start; j <= end && arg_count < 16; j++) {
+                if (is_punct(j, '(') || is_punct(j, '[') || is_punct(j, '{')) {
+                    j = matching(j);
+                }
+                else if (is_punct(j, ',') || j == end) {
+                    args[arg_count * 2] = start;
+                    args[arg_count * 2 + 1] = j - 1;
+                    arg_count++;
+                    start = j + 1;
+                }
+            }
+
+            char text[MAX_TEXT];
+            int len;
+            bool ok = calls[c].text_arg < arg_count;
+            if (ok && calls[c].kind == CALL_FMT) {
+                int arg = calls[c].text_arg + 1;
+                ok = literal_text(args[calls[c].text_arg * 2], args[calls[c].text_arg * 2 + 1], text, &len) &&
+                     use_format(text, args, arg_count, &arg);
+            }
+            else if (ok && calls[c].kind == CALL_NUM) {
+                ok = (arg_count == 5);
+                if (ok && !is_null(args[2], args[3])) {
+                    ok = use_expression(args[2], args[3]);
+                    used[' '] = true;
+                }
+                if (ok && !is_null(args[8], args[9])) {
+                    ok = use_expression(args[8], args[9]);
+                }
+                use_chars("-0123456789");
+                if (args[6] != args[7] || strcmp(tokens[args[6]].text, "0") != 0) {
+                    used['.'] = true;
+                }
+            }
+            else if (ok) {
+                ok = use_expression(args[calls[c].text_arg * 2], args[calls[c].text_arg * 2 + 1]);
+            }
+            if (!ok) {
+                printf("FAIL %s:%d: can't tell what %s() prints\n", tokens[i].file, tokens[i].line, calls[c].name);
+                failures++;
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    The subset, built in memory as LVGL will read it
+---------------------------------------------------------------*/
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    lv_font_fmt_txt_glyph_dsc_t glyph_dsc[MAX_GLYPHS + 1];
+    uint32_t letters[MAX_GLYPHS + 1];      // Code point of each glyph id
+    uint32_t glyph_count;                  // With the reserved id 0
+    uint8_t * bitmap;
+    uint32_t bitmap_size;
+    lv_font_fmt_txt_cmap_t cmaps[MAX_CMAPS];
+    uint8_t * cmap_ofs[MAX_CMAPS];
+    lv_font_fmt_txt_kern_classes_t kern;
+    uint8_t * left_map;
+    uint8_t * right_map;
+    int8_t * kern_values;
+} subset_t;
+
+// The full font's glyph id of a letter, as lv_font_fmt_txt.c looks it up
+static uint32_t full_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter) {
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (rcp >= cmap->range_length) {
+            continue;
+        }
+        switch (cmap->type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                return cmap->glyph_id_start + rcp;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+            default:
+                for (uint16_t j = 0; j < cmap->list_length; j++) {
+                    if (cmap->unicode_list[j] == rcp) {
+                        return cmap->glyph_id_start +
+                               (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL ?
+                                ((const uint16_t *)cmap->glyph_id_ofs_list)[j] : j);
+                    }
+                }
+                return 0;
+        }
+    }
+    return 0;
+}
+
+static uint32_t glyph_bytes(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * g) {
+    return ((uint32_t)g->box_w * g->box_h * fdsc->bpp + 7) / 8;
+}
+
+// Flash taken by a font's tables, bytes
+static uint32_t font_bytes(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t * glyphs) {
+
+    uint32_t count = 0;
+    uint32_t bytes = sizeof(lv_font_t) + sizeof(*fdsc);
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t n = (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) ? cmap->range_length : cmap->list_length;
+        for (uint32_t j = 0; cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL && j < cmap->range_length; j++) {
+            n = LV_MAX(n, ((const uint8_t *)cmap->glyph_id_ofs_list)[j] + 1u);
+        }
+        count = LV_MAX(count, cmap->glyph_id_start + n);
+        bytes += sizeof(*cmap) + cmap->list_length * sizeof(uint16_t);
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            bytes += cmap->range_length + 1;
+        }
+        else if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            bytes += cmap->list_length * sizeof(uint16_t);
+        }
+    }
+    const lv_font_fmt_txt_glyph_dsc_t * last = &fdsc->glyph_dsc[count - 1];
+    bytes += count * sizeof(lv_font_fmt_txt_glyph_dsc_t) + last->bitmap_index + glyph_bytes(fdsc, last);
+    if (fdsc->kern_classes) {
+        const lv_font_fmt_txt_kern_classes_t * kern = fdsc->kern_dsc;
+        bytes += sizeof(*kern) + 2 * count + kern->left_class_cnt * kern->right_class_cnt;
+    }
+    *glyphs = count - 1;
+    return bytes;
+}
+
+static bool build(const lv_font_t * full, subset_t * sub) {
+
+    const lv_font_fmt_txt_dsc_t * fdsc = full->dsc;
+    const lv_font_fmt_txt_kern_classes_t * fkern = fdsc->kern_dsc;
+    uint32_t ids[MAX_GLYPHS + 1] = {0};      // Full font's glyph id of each subset glyph
+
+    memset(sub, 0, sizeof(*sub));
+    sub->glyph_count = 1;
+    sub->bitmap = malloc(fdsc->glyph_dsc[0].bitmap_index + 0x10000);
+    for (uint32_t letter = 0; letter < 0x10000; letter++) {
+        if (!used[letter]) {
+            continue;
+        }
+        uint32_t id = full_glyph_id(fdsc, letter);
+        if (id == 0) {
+            printf("FAIL the UI prints U+%04lX, which lv_font_montserrat_14 does not have\n", (unsigned long)letter);
+            return false;
+        }
+        if (sub->glyph_count > MAX_GLYPHS) {
+            printf("FAIL more than %d glyphs\n", MAX_GLYPHS);
+            return false;
+        }
+        const lv_font_fmt_txt_glyph_dsc_t * g = &fdsc->glyph_dsc[id];
+        uint32_t n = sub->glyph_count++;
+        ids[n] = id;
+        sub->letters[n] = letter;
+        sub->glyph_dsc[n] = *g;
+        sub->glyph_dsc[n].bitmap_index = sub->bitmap_size;
+        memcpy(sub->bitmap + sub->bitmap_size, &fdsc->glyph_bitmap[g->bitmap_index], glyph_bytes(fdsc, g));
+        sub->bitmap_size += glyph_bytes(fdsc, g);
+    }
+
+    // One FORMAT0_FULL cmap per cluster of code points
+    uint16_t cmap_num = 0;
+    for (uint32_t n = 1; n < sub->glyph_count; n++) {
+        lv_font_fmt_txt_cmap_t * cmap = &sub->cmaps[cmap_num - 1];
+        if (cmap_num == 0 || sub->letters[n] - sub->letters[n - 1] - 1 > sizeof(lv_font_fmt_txt_cmap_t)) {
+            if (cmap_num == MAX_CMAPS) {
+                printf("FAIL more than %d cmaps\n", MAX_CMAPS);
+                return false;
+            }
+            cmap = &sub->cmaps[cmap_num];
+            sub->cmap_ofs[cmap_num] = calloc(0x10000, 1);
+            cmap->range_start = sub->letters[n];
+            cmap->glyph_id_start = 0;
+            cmap->type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL;
+            cmap->glyph_id_ofs_list = sub->cmap_ofs[cmap_num];
+            cmap_num++;
+        }
+        // LVGL reads one past range_length (rcp > range_length), that entry stays 0: not found
+        cmap->range_length = sub->letters[n] - cmap->range_start + 1;
+        sub->cmap_ofs[cmap_num - 1][sub->letters[n] - cmap->range_start] = n;
+    }
+
+    // Kerning classes still in use, renumbered from 1
+    uint8_t left_new[256] = {0};
+    uint8_t right_new[256] = {0};
+    uint8_t left_old[256] = {0};
+    uint8_t right_old[256] = {0};
+    uint8_t left_cnt = 0;
+    uint8_t right_cnt = 0;
+    sub->left_map = calloc(sub->glyph_count, 1);
+    sub->right_map = calloc(sub->glyph_count, 1);
+    for (uint32_t n = 1; fdsc->kern_classes && n < sub->glyph_count; n++) {
+        uint8_t l = fkern->left_class_mapping[ids[n]];
+        uint8_t r = fkern->right_class_mapping[ids[n]];
+        if (l && !left_new[l]) {
+            left_new[l] = ++left_cnt;
+            left_old[left_cnt] = l;
+        }
+        if (r && !right_new[r]) {
+            right_new[r] = ++right_cnt;
+            right_old[right_cnt] = r;
+        }
+        sub->left_map[n] = left_new[l];
+        sub->right_map[n] = right_new[r];
+    }
+    sub->kern_values = calloc((size_t)left_cnt * right_cnt + 1, 1);
+    for (int l = 1; l <= left_cnt; l++) {
+        for (int r = 1; r <= right_cnt; r++) {
+            sub->kern_values[(l - 1) * right_cnt + (r - 1)] =
+                fkern->class_pair_values[(left_old[l] - 1) * fkern->right_class_cnt + (right_old[r] - 1)];
+        }
+    }
+    sub->kern = (lv_font_fmt_txt_kern_classes_t){
+        .class_pair_values = sub->kern_values,
+        .left_class_mapping = sub->left_map,
+        .right_class_mapping = sub->right_map,
+        .left_class_cnt = left_cnt,
+        .right_class_cnt = right_cnt,
+    };
+
+    sub->dsc = *fdsc;
+    sub->dsc.glyph_bitmap = sub->bitmap;
+    sub->dsc.glyph_dsc = sub->glyph_dsc;
+    sub->dsc.cmaps = sub->cmaps;
+    sub->dsc.cmap_num = cmap_num;
+    sub->dsc.kern_dsc = fdsc->kern_classes ? &sub->kern : NULL;
+    sub->dsc.cache = &sub->cache;
+    sub->font = *full;
+    sub->font.dsc = &sub->dsc;
+    sub->font.fallback = NULL;
+    return true;
+}
+
+/*---------------------------------------------------------------
+    Source text of the subset
+---------------------------------------------------------------*/
+static char * generate(const subset_t * sub, char ** sources, int source_count, size_t * len) {
+
+    char * text = NULL;
+    FILE * f = open_memstream(&text, len);
+    const lv_font_fmt_txt_dsc_t * dsc = &sub->dsc;
+
+    fprintf(f, "/*\n * Generated by host/font_subset from lv_font_montserrat_14, do not edit.\n");
+    fprintf(f, " * %lu glyphs, the characters printed by", (unsigned long)sub->glyph_count - 1);
+    for (int i = 0; i < source_count; i++) {
+        const char * base = strrchr(sources[i], '/');
+        fprintf(f, " %s", base ? base + 1 : sources[i]);
+    }
+    fprintf(f, ":\n *  ");
+    for (uint32_t n = 1; n < sub->glyph_count; n++) {
+        if (sub->letters[n] < 0x80) {
+            fprintf(f, "%c", (char)sub->letters[n]);
+        }
+        else {
+            fprintf(f, " U+%04lX", (unsigned long)sub->letters[n]);
+        }
+    }
+    fprintf(f, "\n */\n\n#include \"lvgl.h\"\n\n");
+
+    fprintf(f, "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {");
+    for (uint32_t i = 0; i < sub->bitmap_size; i++) {
+        fprintf(f, "%s0x%02x,", (i % 16) ? " " : "\n    ", sub->bitmap[i]);
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n");
+    for (uint32_t n = 0; n < sub->glyph_count; n++) {
+        const lv_font_fmt_txt_glyph_dsc_t * g = &sub->glyph_dsc[n];
+        fprintf(f, "    {.bitmap_index = %lu, .adv_w = %lu, .box_w = %u, .box_h = %u, .ofs_x = %d, .ofs_y = %d}, "
+                "/* U+%04lX */\n", (unsigned long)g->bitmap_index, (unsigned long)g->adv_w, g->box_w, g->box_h,
+                g->ofs_x, g->ofs_y, (unsigned long)sub->letters[n]);
+    }
+    fprintf(f, "};\n\n");
+
+    for (uint16_t i = 0; i < dsc->cmap_num; i++) {
+        fprintf(f, "static const uint8_t glyph_id_ofs_list_%u[] = {", i);
+        for (uint32_t j = 0; j <= dsc->cmaps[i].range_length; j++) {
+            fprintf(f, "%s%u,", (j % 16) ? " " : "\n    ", sub->cmap_ofs[i][j]);
+        }
+        fprintf(f, "\n};\n\n");
+    }
+    fprintf(f, "static const lv_font_fmt_txt_cmap_t cmaps[] = {\n");
+    for (uint16_t i = 0; i < dsc->cmap_num; i++) {
+        fprintf(f, "    {\n        .range_start = %lu, .range_length = %u, .glyph_id_start = 0,\n",
+                (unsigned long)dsc->cmaps[i].range_start, dsc->cmaps[i].range_length);
+        fprintf(f, "        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_%u, .list_length = 0, "
+                ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL\n    },\n", i);
+    }
+    fprintf(f, "};\n\n");
+
+    if (dsc->kern_classes) {
+        fprintf(f, "static const uint8_t kern_left_class_mapping[] = {");
+        for (uint32_t n = 0; n < sub->glyph_count; n++) {
+            fprintf(f, "%s%u,", (n % 16) ? " " : "\n    ", sub->left_map[n]);
+        }
+        fprintf(f, "\n};\n\nstatic const uint8_t kern_right_class_mapping[] = {");
+        for (uint32_t n = 0; n < sub->glyph_count; n++) {
+            fprintf(f, "%s%u,", (n % 16) ? " " : "\n    ", sub->right_map[n]);
+        }
+        fprintf(f, "\n};\n\nstatic const int8_t kern_class_values[] = {");
+        for (int i = 0; i < sub->kern.left_class_cnt * sub->kern.right_class_cnt; i++) {
+            fprintf(f, "%s%d,", (i % 16) ? " " : "\n    ", sub->kern_values[i]);
+        }
+        fprintf(f, "\n};\n\n");
+        fprintf(f, "static const lv_font_fmt_txt_kern_classes_t kern_classes = {\n");
+        fprintf(f, "    .class_pair_values = kern_class_values,\n");
+        fprintf(f, "    .left_class_mapping = kern_left_class_mapping,\n");
+        fprintf(f, "    .right_class_mapping = kern_right_class_mapping,\n");
+        fprintf(f, "    .left_class_cnt = %u,\n    .right_class_cnt = %u,\n};\n\n", sub->kern.left_class_cnt,
+                sub->kern.right_class_cnt);
+    }
+
+    fprintf(f, "static lv_font_fmt_txt_glyph_cache_t cache;\n\n");
+    fprintf(f, "static const lv_font_fmt_txt_dsc_t font_dsc = {\n");
+    fprintf(f, "    .glyph_bitmap = glyph_bitmap,\n    .glyph_dsc = glyph_dsc,\n    .cmaps = cmaps,\n");
+    fprintf(f, "    .kern_dsc = %s,\n", dsc->kern_classes ? "&kern_classes" : "NULL");
+    fprintf(f, "    .kern_scale = %u,\n    .cmap_num = %u,\n    .bpp = %u,\n    .kern_classes = %u,\n",
+            dsc->kern_scale, dsc->cmap_num, dsc->bpp, dsc->kern_classes);
+    fprintf(f, "    .bitmap_format = %u,\n    .cache = &cache\n};\n\n", dsc->bitmap_format);
+
+    fprintf(f, "const lv_font_t %s = {\n", FONT_NAME);
+    fprintf(f, "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,\n");
+    fprintf(f, "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,\n");
+    fprintf(f, "    .line_height = %d,\n    .base_line = %d,\n    .subpx = LV_FONT_SUBPX_NONE,\n",
+            sub->font.line_height, sub->font.base_line);
+    fprintf(f, "    .underline_position = %d,\n    .underline_thickness = %d,\n", sub->font.underline_position,
+            sub->font.underline_thickness);
+    fprintf(f, "    .dsc = &font_dsc\n};\n");
+
+    fclose(f);
+    return text;
+}
+
+/*---------------------------------------------------------------
+    The subset against the full font: every glyph and pair the UI
+    prints, and a miss for everything else in the full font
+---------------------------------------------------------------*/
+static bool same_glyph(const lv_font_t * a, const lv_font_t * b, uint32_t letter, uint32_t next) {
+
+    lv_font_glyph_dsc_t ga, gb;
+    memset(&ga, 0, sizeof(ga));
+    memset(&gb, 0, sizeof(gb));
+    bool fa = lv_font_get_glyph_dsc(a, &ga, letter, next);
+    bool fb = lv_font_get_glyph_dsc(b, &gb, letter, next);
+    if (fa != fb || ga.adv_w != gb.adv_w || ga.box_w != gb.box_w || ga.box_h != gb.box_h || ga.ofs_x != gb.ofs_x ||
+        ga.ofs_y != gb.ofs_y || ga.bpp != gb.bpp) {
+        return false;
+    }
+    if (!fa || ga.box_w == 0) {
+        return true;
+    }
+    const uint8_t * ba = lv_font_get_glyph_bitmap(a, letter);
+    const uint8_t * bb = lv_font_get_glyph_bitmap(b, letter);
+    return ba && bb && memcmp(ba, bb, ((uint32_t)ga.box_w * ga.box_h * ga.bpp + 7) / 8) == 0;
+}
+
+static int verify(const lv_font_t * full, const lv_font_t * sub) {
+
+    int bad = 0;
+    lv_font_glyph_dsc_t g;
+
+    for (uint32_t a = 0; a < 0x10000; a++) {
+        if (!used[a] && a != '\t') {
+            // Not in the subset: not found, whatever the full font has. LVGL draws tabs with the space glyph
+            if (lv_font_get_glyph_dsc(sub, &g, a, 0) && !g.is_placeholder) {
+                printf("U+%04lX found, not in the subset\n", (unsigned long)a);
+                bad++;
+            }
+            continue;
+        }
+        for (uint32_t b = 0; b < 0x10000; b++) {
+            if ((b == 0 || used[b]) && !same_glyph(full, sub, a, b)) {
+                printf("U+%04lX followed by U+%04lX differs\n", (unsigned long)a, (unsigned long)b);
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+// Mean ns per glyph lookup, over the characters the UI prints
+static double lookup_ns(const lv_font_t * font) {
+
+    uint32_t letters[MAX_GLYPHS];
+    int count = 0;
+    for (uint32_t a = 0; a < 0x10000 && count < MAX_GLYPHS; a++) {
+        if (used[a]) {
+            letters[count++] = a;
+        }
+    }
+
+    struct timespec t0, t1;
+    lv_font_glyph_dsc_t g;
+    volatile uint32_t sink = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < LOOKUP_ROUNDS; r++) {
+        for (int i = 0; i < count; i++) {
+            lv_font_get_glyph_dsc(font, &g, letters[i], letters[(i + r) % count]);
+            sink += g.adv_w;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / ((double)LOOKUP_ROUNDS * count);
+}
+
+int main(int argc, char ** argv) {
+
+    const char * out = FONT_NAME ".c";
+    bool check = false;
+    char * sources[64];
+    int source_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out = argv[++i];
+        }
+        else if (argv[i][0] != '-' && source_count < 64) {
+            sources[source_count++] = argv[i];
+        }
+        else {
+            source_count = 0;
+            break;
+        }
+    }
+    if (source_count == 0) {
+        printf("usage: %s [--check] [--out FILE] SOURCE...\n", argv[0]);
+        return 2;
+    }
+
+    symbols = calloc(1000, sizeof(token_t));
+    tokenize(FONT_SUBSET_SYMBOL_DEF, symbols, &symbol_count, 1000);
+    tokens = calloc(MAX_TOKENS, sizeof(token_t));
+    for (int i = 0; i < source_count; i++) {
+        tokenize(sources[i], tokens, &token_count, MAX_TOKENS);
+    }
+    scan();
+
+    static subset_t sub;
+    const lv_font_t * full = &lv_font_montserrat_14;
+    if (failures || !build(full, &sub)) {
+        printf("%d check(s) failed\n", failures ? failures : 1);
+        return 1;
+    }
+
+    uint32_t full_glyphs, sub_glyphs;
+    uint32_t full_bytes = font_bytes(full->dsc, &full_glyphs);
+    uint32_t sub_bytes = font_bytes(&sub.dsc, &sub_glyphs);
+    double full_ns = lookup_ns(full);
+    double sub_ns = lookup_ns(&sub.font);
+    printf("lv_font_montserrat_14  %4lu glyphs %6lu bytes, %lu cmaps, lookup %5.1f ns\n", (unsigned long)full_glyphs,
+           (unsigned long)full_bytes, (unsigned long)((const lv_font_fmt_txt_dsc_t *)full->dsc)->cmap_num, full_ns);
+    printf("%-22s %4lu glyphs %6lu bytes, %lu cmaps, lookup %5.1f ns\n", FONT_NAME, (unsigned long)sub_glyphs,
+           (unsigned long)sub_bytes, (unsigned long)sub.dsc.cmap_num, sub_ns);
+
+    if (check) {
+        CHECK(verify(full, &sub.font) == 0);
+        CHECK(sub_bytes < full_bytes);
+    }
+    else {
+        size_t len;
+        char * text = generate(&sub, sources, source_count, &len);
+        FILE * f = fopen(out, "wb");
+        if (f == NULL || fwrite(text, 1, len, f) != len) {
+            printf("FAIL can't write %s\n", out);
+            failures++;
+        }
+        if (f != NULL) {
+            fclose(f);
+        }
+        free(text);
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All font checks passed\n");
+    }
+    return 0;
+}
@@ -0,0 +1,554 @@
+/*
+ * @file img_pack.c
+ * @brief Image asset pipeline: converts the PNGs in assets/ to lv_img_dsc_t sources in the format that draws
+ *        best on the panel. Colours are converted once, here, to the build's lv_color_t (RGB565, byte swapped for
+ *        LV_COLOR_16_SWAP), so nothing is converted at draw time. Per image:
+ *          - no transparent pixel: LV_IMG_CF_TRUE_COLOR, LVGL copies it without blending
+ *          - otherwise app_img_rle (main/app_img_rle.h): transparent borders cropped to a stored box, opaque pixels
+ *            without alpha, alpha kept only for the partially transparent ones
+ *          - LV_IMG_CF_RGB565A8, should the runs ever come out larger
+ *        Every candidate is drawn on an LVGL display configured as on the device and a size and draw cost report
+ *        is printed. Built and run by host/CMakeLists.txt and by main/CMakeLists.txt on idf.py build.
+ *
+ *   img_pack [--check] [--out DIR] PNG...
+ *
+ *   --out DIR  where app_img_<png name>.c goes, one per PNG (default: the working directory)
+ *   --check    write nothing: fail if a chosen format does not draw exactly as RGB565A8 does, if an app_img_rle
+ *              asset does not decode back through the LVGL decoder, or if it draws slower than RGB565A8
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <png.h>
+#include "lvgl.h"
+#include "app_include/app_img_rle.h"
+
+#define BENCH_DRAWS     400
+#define BENCH_BATCHES   20
+#define BENCH_RETRIES   3
+#define STRIP_LINES     40          // APP_DISP_STRIP_LINES, the image is drawn in strips on the device
+#define MAX_SLOWDOWN    1.25        // Draw time over RGB565A8's. RLE spends most of it in the same alpha mix, so on the
+                                    // host they draw at about the same speed and this is timing noise
+#define MAX_RES         240
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef enum {
+    FMT_RGB565A8 = 0,           // The reference: what the LVGL converter produced
+    FMT_TRUE_COLOR,
+    FMT_RLE,
+    FMT_COUNT
+} fmt_t;
+
+static const char * const fmt_names[FMT_COUNT] = {"RGB565A8", "TRUE_COLOR", "app_img_rle"};
+
+typedef struct {
+    app_img_rle_t rle;
+    app_img_rle_row_t * rows;
+    uint8_t * runs;
+    uint16_t * colors;
+    size_t runs_size;           // Bytes
+    size_t colors_size;         // Colours
+    lv_img_dsc_t dsc;
+} packed_t;
+
+typedef struct {
+    char name[64];              // lv_img_dsc_t and file name
+    const char * png;
+    lv_img_dsc_t src;           // RGB565A8
+    bool opaque;
+    packed_t packed;
+    const lv_img_dsc_t * dscs[FMT_COUNT];   // NULL where the format does not apply
+    lv_img_dsc_t true_color;
+    size_t flash[FMT_COUNT];
+    double draw_us[FMT_COUNT];
+    bool same[FMT_COUNT];       // Draws exactly as RGB565A8
+    fmt_t fmt;                  // Chosen
+} asset_t;
+
+static lv_color_t fb[MAX_RES][MAX_RES];
+
+/*---------------------------------------------------------------
+    RGB565A8 source pixels
+---------------------------------------------------------------*/
+static inline uint16_t src_color(const lv_img_dsc_t * src, int x, int y) {
+    return ((const lv_color_t *)src->data)[y * src->header.w + x].full;
+}
+
+static inline uint8_t src_alpha(const lv_img_dsc_t * src, int x, int y) {
+    return src->data[(size_t)src->header.w * src->header.h * sizeof(lv_color_t) + (size_t)y * src->header.w + x];
+}
+
+static int repeat_len(const lv_img_dsc_t * src, int x, int x2, int y) {
+    int n = 1;
+    while (x + n <= x2 && n < APP_IMG_RLE_MAX_RUN && src_alpha(src, x + n, y) == LV_OPA_COVER &&
+           src_color(src, x + n, y) == src_color(src, x, y)) {
+        n++;
+    }
+    return n;
+}
+
+/*---------------------------------------------------------------
+    One row of the box into runs and colours
+---------------------------------------------------------------*/
+static void pack_row(const lv_img_dsc_t * src, int y, int x1, int x2, packed_t * packed) {
+
+    uint8_t * p = packed->runs + packed->runs_size;
+    uint16_t * c = packed->colors + packed->colors_size;
+    int x = x1;
+
+    while (x <= x2) {
+        uint8_t a = src_alpha(src, x, y);
+        int n = 1;
+
+        if (a == LV_OPA_TRANSP) {
+            while (x + n <= x2 && n < APP_IMG_RLE_MAX_RUN && src_alpha(src, x + n, y) == LV_OPA_TRANSP) {
+                n++;
+            }
+            *p++ = APP_IMG_RLE_TRANSP | (n - 1);
+        }
+        else if (a == LV_OPA_COVER && (n = repeat_len(src, x, x2, y)) >= 3) {
+            *p++ = APP_IMG_RLE_REPEAT | (n - 1);
+            *c++ = src_color(src, x, y);
+        }
+        else if (a == LV_OPA_COVER) {
+            // Literal until a repeat worth its own run or a pixel that is not opaque
+            n = 1;
+            while (x + n <= x2 && n < APP_IMG_RLE_MAX_RUN && src_alpha(src, x + n, y) == LV_OPA_COVER &&
+                   repeat_len(src, x + n, x2, y) < 3) {
+                n++;
+            }
+            *p++ = APP_IMG_RLE_OPAQUE | (n - 1);
+            for (int i = 0; i < n; i++) {
+                *c++ = src_color(src, x + i, y);
+            }
+        }
+        else {
+            while (x + n <= x2 && n < APP_IMG_RLE_MAX_RUN && src_alpha(src, x + n, y) != LV_OPA_TRANSP &&
+                   src_alpha(src, x + n, y) != LV_OPA_COVER) {
+                n++;
+            }
+            *p++ = APP_IMG_RLE_ALPHA | (n - 1);
+            for (int i = 0; i < n; i++) {
+                *c++ = src_color(src, x + i, y);
+                *p++ = src_alpha(src, x + i, y);
+            }
+        }
+        x += n;
+    }
+    packed->runs_size = p - packed->runs;
+    packed->colors_size = c - packed->colors;
+}
+
+static void pack(const lv_img_dsc_t * src, packed_t * packed) {
+
+    int w = src->header.w;
+    int h = src->header.h;
+    int x1 = w, y1 = h, x2 = -1, y2 = -1;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (src_alpha(src, x, y) != LV_OPA_TRANSP) {
+                x1 = LV_MIN(x1, x);
+                x2 = LV_MAX(x2, x);
+                y1 = LV_MIN(y1, y);
+                y2 = LV_MAX(y2, y);
+            }
+        }
+    }
+    if (x2 < 0) {
+        x1 = y1 = 1;    // Empty box
+        x2 = y2 = 0;
+    }
+
+    int rows = y2 - y1 + 1;
+    packed->rows = calloc(rows + 1, sizeof(app_img_rle_row_t));
+    packed->runs = malloc((size_t)w * h * 2);       // At most a header and an alpha byte per pixel
+    packed->colors = malloc((size_t)w * h * sizeof(uint16_t));
+    packed->runs_size = 0;
+    packed->colors_size = 0;
+    for (int r = 0; r < rows; r++) {
+        packed->rows[r] = (app_img_rle_row_t){packed->runs_size, packed->colors_size};
+        pack_row(src, y1 + r, x1, x2, packed);
+    }
+    packed->rows[rows] = (app_img_rle_row_t){packed->runs_size, packed->colors_size};
+
+    packed->rle = (app_img_rle_t){x1, y1, x2, y2, packed->rows, packed->runs, packed->colors};
+    packed->dsc = *src;
+    packed->dsc.header.cf = APP_IMG_RLE_CF;
+    packed->dsc.data_size = sizeof(app_img_rle_t);
+    packed->dsc.data = (const uint8_t *)&packed->rle;
+}
+
+static size_t packed_bytes(const packed_t * packed) {
+    return packed->runs_size + packed->colors_size * sizeof(uint16_t) +
+           (packed->rle.y2 - packed->rle.y1 + 2) * sizeof(app_img_rle_row_t) + sizeof(app_img_rle_t);
+}
+
+/*---------------------------------------------------------------
+    PNG to RGB565A8 in lv_color_t
+---------------------------------------------------------------*/
+static bool load_png(asset_t * asset) {
+
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, asset->png)) {
+        printf("FAIL %s: %s\n", asset->png, png.message);
+        return false;
+    }
+    png.format = PNG_FORMAT_RGBA;
+    uint8_t * rgba = malloc(PNG_IMAGE_SIZE(png));
+    if (!png_image_finish_read(&png, NULL, rgba, 0, NULL)) {
+        printf("FAIL %s: %s\n", asset->png, png.message);
+        free(rgba);
+        return false;
+    }
+    if (png.width > MAX_RES || png.height > MAX_RES) {
+        printf("FAIL %s: %lux%lu is larger than the display\n", asset->png, (unsigned long)png.width,
+               (unsigned long)png.height);
+        free(rgba);
+        return false;
+    }
+
+    uint32_t px = png.width * png.height;
+    uint8_t * data = malloc(px * (sizeof(lv_color_t) + 1));
+    lv_color_t * colors = (lv_color_t *)data;
+    uint8_t * alpha = data + px * sizeof(lv_color_t);
+
+    asset->opaque = true;
+    for (uint32_t i = 0; i < px; i++) {
+        colors[i] = lv_color_make(rgba[i * 4], rgba[i * 4 + 1], rgba[i * 4 + 2]);
+        alpha[i] = rgba[i * 4 + 3];
+        asset->opaque &= (alpha[i] == LV_OPA_COVER);
+    }
+    free(rgba);
+
+    asset->src = (lv_img_dsc_t){
+        .header.cf = LV_IMG_CF_RGB565A8,
+        .header.w = png.width,
+        .header.h = png.height,
+        .data_size = px * (sizeof(lv_color_t) + 1),
+        .data = data,
+    };
+    return true;
+}
+
+/*---------------------------------------------------------------
+    Source text for one asset in its chosen format
+---------------------------------------------------------------*/
+static void print_bytes(FILE * f, const uint8_t * data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02x,", (i % 16) ? " " : "\n  ", data[i]);
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+static void print_colors(FILE * f, const uint16_t * colors, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        fprintf(f, "%s0x%04x,", (i % 12) ? " " : "\n  ", colors[i]);
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+static char * generate(const asset_t * asset, size_t * len) {
+
+    char * text = NULL;
+    FILE * f = open_memstream(&text, len);
+    const char * name = asset->name;
+    const lv_img_dsc_t * src = &asset->src;
+    const char * cf = "APP_IMG_RLE_CF";
+    const char * data = NULL;
+
+    fprintf(f, "/*\n");
+    fprintf(f, " * Generated by host/img_pack from assets/%s, do not edit.\n", strrchr(asset->png, '/') ?
+            strrchr(asset->png, '/') + 1 : asset->png);
+    fprintf(f, " * %dx%d, %s, %lu bytes (RGB565A8: %lu).\n", src->header.w, src->header.h, fmt_names[asset->fmt],
+            (unsigned long)asset->flash[asset->fmt], (unsigned long)asset->flash[FMT_RGB565A8]);
+    if (asset->fmt == FMT_RLE) {
+        fprintf(f, " * Stored box (%d,%d)-(%d,%d).\n", asset->packed.rle.x1, asset->packed.rle.y1, asset->packed.rle.x2,
+                asset->packed.rle.y2);
+    }
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"app_include/app_img_rle.h\"\n\n");
+
+    if (asset->fmt == FMT_RLE) {
+        const packed_t * packed = &asset->packed;
+        const app_img_rle_t * rle = &packed->rle;
+        int rows = rle->y2 - rle->y1 + 1;
+
+        fprintf(f, "static const uint8_t %s_runs[] = {", name);
+        print_bytes(f, packed->runs, packed->runs_size);
+        fprintf(f, "static const uint16_t %s_colors[] = {", name);
+        print_colors(f, packed->colors, packed->colors_size);
+
+        fprintf(f, "static const app_img_rle_row_t %s_rows[] = {", name);
+        for (int r = 0; r <= rows; r++) {
+            fprintf(f, "%s{%lu, %lu},", (r % 6) ? " " : "\n  ", (unsigned long)packed->rows[r].runs,
+                    (unsigned long)packed->rows[r].colors);
+        }
+        fprintf(f, "\n};\n\n");
+
+        fprintf(f, "static const app_img_rle_t %s_rle = {\n", name);
+        fprintf(f, "  .x1 = %d,\n  .y1 = %d,\n  .x2 = %d,\n  .y2 = %d,\n", rle->x1, rle->y1, rle->x2, rle->y2);
+        fprintf(f, "  .rows = %s_rows,\n  .runs = %s_runs,\n  .colors = %s_colors,\n};\n\n", name, name, name);
+        data = "rle";
+    }
+    else if (asset->fmt == FMT_TRUE_COLOR) {
+        fprintf(f, "static const uint16_t %s_map[] = {", name);
+        print_colors(f, (const uint16_t *)src->data, (size_t)src->header.w * src->header.h);
+        cf = "LV_IMG_CF_TRUE_COLOR";
+        data = "map";
+    }
+    else {
+        fprintf(f, "static const uint8_t %s_map[] = {", name);
+        print_bytes(f, src->data, src->data_size);
+        cf = "LV_IMG_CF_RGB565A8";
+        data = "map";
+    }
+
+    fprintf(f, "const lv_img_dsc_t %s = {\n", name);
+    fprintf(f, "  .header.cf = %s,\n", cf);
+    fprintf(f, "  .header.always_zero = 0,\n");
+    fprintf(f, "  .header.reserved = 0,\n");
+    fprintf(f, "  .header.w = %d,\n", src->header.w);
+    fprintf(f, "  .header.h = %d,\n", src->header.h);
+    fprintf(f, "  .data_size = sizeof(%s_%s),\n", name, data);
+    fprintf(f, "  .data = (const uint8_t *)%s%s_%s,\n", asset->fmt == FMT_RLE ? "&" : "", name, data);
+    fprintf(f, "};\n");
+
+    fclose(f);
+    return text;
+}
+static int verify(const lv_img_dsc_t * src, const packed_t * packed) {
+
+    int w = src->header.w;
+    int bad = 0;
+    lv_img_decoder_dsc_t dec;
+    uint8_t line[MAX_RES * 3];
+
+    if (lv_img_decoder_open(&dec, &packed->dsc, lv_color_black(), 0) != LV_RES_OK) {
+        return -1;
+    }
+    CHECK(dec.header.cf == LV_IMG_CF_RGB565A8 && dec.header.w == w && dec.header.h == src->header.h);
+
+    const int spans[2][2] = {{0, w}, {w / 3, w / 3}};
+    for (int y = 0; y < src->header.h; y++) {
+        for (int s = 0; s < 2; s++) {
+            int x0 = spans[s][0];
+            int len = spans[s][1];
+            lv_img_decoder_read_line(&dec, x0, y, len, line);
+            for (int i = 0; i < len; i++) {
+                uint8_t a = line[len * sizeof(lv_color_t) + i];
+                uint16_t c = line[i * sizeof(lv_color_t)] | (line[i * sizeof(lv_color_t) + 1] << 8);
+                bool ok = (a == src_alpha(src, x0 + i, y)) && (a == LV_OPA_TRANSP || c == src_color(src, x0 + i, y));
+                bad += !ok;
+            }
+        }
+    }
+    lv_img_decoder_close(&dec);
+    return bad;
+}
+
+/*---------------------------------------------------------------
+    Draw time of an image on a display its size, drawn in strips
+---------------------------------------------------------------*/
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y][area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    lv_disp_flush_ready(disp_drv);
+}
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Mean time of one redraw of the image, us
+static double redraw_us(lv_obj_t * img, int draws) {
+    int64_t start = host_ns();
+    for (int i = 0; i < draws; i++) {
+        lv_obj_invalidate(img);
+        lv_refr_now(NULL);
+    }
+    return (host_ns() - start) / 1000.0 / draws;
+}
+
+/*---------------------------------------------------------------
+    Draw time of each format that applies, and whether it leaves
+    the same screen as RGB565A8. Batches take turns between the
+    formats and the best of each is kept, timing noise only adds
+---------------------------------------------------------------*/
+static void bench(asset_t * asset) {
+
+    static lv_color_t shots[FMT_COUNT][MAX_RES][MAX_RES];
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_obj_center(img);
+
+    for (int fmt = 0; fmt < FMT_COUNT; fmt++) {
+        asset->draw_us[fmt] = 1e12;
+    }
+    for (int batch = 0; batch < BENCH_BATCHES; batch++) {
+        for (int fmt = 0; fmt < FMT_COUNT; fmt++) {
+            if (asset->dscs[fmt] == NULL) {
+                continue;
+            }
+            lv_img_set_src(img, asset->dscs[fmt]);
+            lv_refr_now(NULL);
+            asset->draw_us[fmt] = LV_MIN(asset->draw_us[fmt], redraw_us(img, BENCH_DRAWS / BENCH_BATCHES));
+            memcpy(shots[fmt], fb, sizeof(fb));
+        }
+    }
+    for (int fmt = 0; fmt < FMT_COUNT; fmt++) {
+        asset->same[fmt] = memcmp(shots[fmt], shots[FMT_RGB565A8], sizeof(shots[0])) == 0;
+    }
+    lv_obj_del(img);
+}
+
+
+/*---------------------------------------------------------------
+    Every format that applies, and the one to ship
+---------------------------------------------------------------*/
+static void choose(asset_t * asset) {
+
+    lv_img_dsc_t * src = &asset->src;
+
+    asset->dscs[FMT_RGB565A8] = src;
+    asset->flash[FMT_RGB565A8] = src->data_size;
+
+    pack(src, &asset->packed);
+    asset->dscs[FMT_RLE] = &asset->packed.dsc;
+    asset->flash[FMT_RLE] = packed_bytes(&asset->packed);
+
+    if (asset->opaque) {
+        asset->true_color = *src;
+        asset->true_color.header.cf = LV_IMG_CF_TRUE_COLOR;
+        asset->true_color.data_size = (uint32_t)src->header.w * src->header.h * sizeof(lv_color_t);
+        asset->dscs[FMT_TRUE_COLOR] = &asset->true_color;
+        asset->flash[FMT_TRUE_COLOR] = asset->true_color.data_size;
+        asset->fmt = FMT_TRUE_COLOR;
+    }
+    else {
+        asset->fmt = asset->flash[FMT_RLE] < asset->flash[FMT_RGB565A8] ? FMT_RLE : FMT_RGB565A8;
+    }
+}
+
+static void report(const asset_t * asset) {
+    for (int fmt = 0; fmt < FMT_COUNT; fmt++) {
+        if (asset->dscs[fmt] == NULL) {
+            continue;
+        }
+        printf("%-32s %-12s %c %6lu bytes %6.1f us%s\n", fmt ? "" : asset->name, fmt_names[fmt],
+               fmt == (int)asset->fmt ? '*' : ' ', (unsigned long)asset->flash[fmt], asset->draw_us[fmt],
+               asset->same[fmt] ? "" : "  PIXELS DIFFER");
+    }
+}
+
+int main(int argc, char ** argv) {
+
+    const char * out_dir = ".";
+    bool check = false;
+    int asset_count = 0;
+    asset_t * assets = calloc(argc, sizeof(asset_t));
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        }
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_dir = argv[++i];
+        }
+        else if (argv[i][0] != '-') {
+            asset_t * asset = &assets[asset_count++];
+            const char * base = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+            asset->png = argv[i];
+            snprintf(asset->name, sizeof(asset->name), "app_img_%.*s", (int)strcspn(base, "."), base);
+        }
+        else {
+            asset_count = 0;
+            break;
+        }
+    }
+    if (asset_count == 0) {
+        printf("usage: %s [--check] [--out DIR] PNG...\n", argv[0]);
+        return 2;
+    }
+
+    static lv_color_t buf[MAX_RES * STRIP_LINES];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, MAX_RES * STRIP_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = MAX_RES;
+    disp_drv.ver_res = MAX_RES;
+    lv_disp_drv_register(&disp_drv);
+    app_img_rle_init();
+
+    size_t total[2] = {0, 0};   // RGB565A8, chosen
+    printf("%-32s %-14s %12s %9s\n", "image", "format", "flash", "draw");
+    for (int a = 0; a < asset_count; a++) {
+        asset_t * asset = &assets[a];
+        if (!load_png(asset)) {
+            failures++;
+            continue;
+        }
+        choose(asset);
+        bench(asset);
+        for (int retry = 0; check && retry < BENCH_RETRIES && asset->draw_us[asset->fmt] >
+             asset->draw_us[FMT_RGB565A8] * MAX_SLOWDOWN; retry++) {
+            bench(asset);   // Host load only ever makes a draw slower, measure again before failing it
+        }
+        report(asset);
+        total[0] += asset->flash[FMT_RGB565A8];
+        total[1] += asset->flash[asset->fmt];
+
+        CHECK(asset->same[asset->fmt]);
+        if (check) {
+            CHECK(verify(&asset->src, &asset->packed) == 0);
+            CHECK(asset->draw_us[asset->fmt] <= asset->draw_us[FMT_RGB565A8] * MAX_SLOWDOWN);
+            continue;
+        }
+
+        char path[512];
+        size_t len;
+        char * text = generate(asset, &len);
+        snprintf(path, sizeof(path), "%s/%s.c", out_dir, asset->name);
+        FILE * f = fopen(path, "wb");
+        if (f == NULL || fwrite(text, 1, len, f) != len) {
+            printf("FAIL can't write %s\n", path);
+            failures++;
+        }
+        if (f != NULL) {
+            fclose(f);
+        }
+        free(text);
+    }
+    printf("%-32s %-14s %6lu -> %6lu bytes of flash\n", "total", "", (unsigned long)total[0], (unsigned long)total[1]);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All image checks passed\n");
+    }
+    return 0;
+}
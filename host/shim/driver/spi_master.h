@@ -0,0 +1,21 @@
+/**
+ * @file spi_master.h
+ * @brief Host stand-in for the SPI master driver, only the host ids app_spi.h names.
+ *
+ */
+
+#ifndef HOST_SHIM_SPI_MASTER_H
+#define HOST_SHIM_SPI_MASTER_H
+
+#include "esp_err.h"
+
+typedef enum {
+    SPI1_HOST = 0,
+    SPI2_HOST,
+    SPI3_HOST,
+} spi_host_device_t;
+
+#define HSPI_HOST   SPI2_HOST
+#define VSPI_HOST   SPI3_HOST
+
+#endif  // HOST_SHIM_SPI_MASTER_H
@@ -0,0 +1,16 @@
+/**
+ * @file esp_attr.h
+ * @brief Host stand-in for the ESP-IDF placement attributes, which have no meaning off target.
+ *
+ */
+
+#ifndef HOST_SHIM_ESP_ATTR_H
+#define HOST_SHIM_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define EXT_RAM_ATTR
+#define WORD_ALIGNED_ATTR   __attribute__((aligned(4)))
+
+#endif  // HOST_SHIM_ESP_ATTR_H
@@ -0,0 +1,15 @@
+/**
+ * @file esp_cpu.h
+ * @brief Host stand-in for the CPU cycle counter. Counts nanoseconds of the host monotonic clock,
+ *        so cycle profiles recorded on the host read as nanoseconds.
+ *
+ */
+
+#ifndef HOST_SHIM_ESP_CPU_H
+#define HOST_SHIM_ESP_CPU_H
+
+#include <stdint.h>
+
+uint32_t esp_cpu_get_cycle_count(void);
+
+#endif  // HOST_SHIM_ESP_CPU_H
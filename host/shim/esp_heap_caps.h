@@ -0,0 +1,20 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Host stand-in for the capability aware heap: every capability is plain malloc.
+ *
+ */
+
+#ifndef HOST_SHIM_ESP_HEAP_CAPS_H
+#define HOST_SHIM_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA          (1 << 3)
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+
+#define heap_caps_malloc(size, caps)        malloc(size)
+#define heap_caps_calloc(n, size, caps)     calloc(n, size)
+#define heap_caps_free(ptr)                 free(ptr)
+
+#endif  // HOST_SHIM_ESP_HEAP_CAPS_H
@@ -0,0 +1,31 @@
+/**
+ * @file esp_log.h
+ * @brief Host stand-in for the ESP-IDF logging macros. Errors and warnings go to stderr, info to
+ *        stdout, debug and verbose are dropped.
+ *
+ */
+
+#ifndef HOST_SHIM_ESP_LOG_H
+#define HOST_SHIM_ESP_LOG_H
+
+#include <stdio.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+#define esp_log_level_set(tag, level)   ((void)(tag), (void)(level))
+
+#define ESP_LOGE(tag, format, ...)  fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  fprintf(stdout, "I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)  do { (void)(tag); } while (0)
+#define ESP_LOGV(tag, format, ...)  do { (void)(tag); } while (0)
+#define ESP_EARLY_LOGD(tag, format, ...)  do { (void)(tag); } while (0)
+
+#endif  // HOST_SHIM_ESP_LOG_H
@@ -0,0 +1,13 @@
+/**
+ * @file esp_system.h
+ * @brief Host stand-in for esp_system.h. Nothing the host built modules use lives here, it only satisfies
+ *        the include in app_utility.h.
+ *
+ */
+
+#ifndef HOST_SHIM_ESP_SYSTEM_H
+#define HOST_SHIM_ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+#endif  // HOST_SHIM_ESP_SYSTEM_H
@@ -0,0 +1,22 @@
+/**
+ * @file queue.h
+ * @brief Host stand-in for FreeRTOS queues: a plain ring buffer. Nothing ever blocks, a receive on an
+ *        empty queue or a send to a full one fails immediately whatever the timeout.
+ *
+ */
+
+#ifndef HOST_SHIM_QUEUE_H
+#define HOST_SHIM_QUEUE_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_queue * QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void * item, TickType_t ticks);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void * item, BaseType_t * task_woken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void * item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#endif  // HOST_SHIM_QUEUE_H
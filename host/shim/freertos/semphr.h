@@ -0,0 +1,14 @@
+/**
+ * @file semphr.h
+ * @brief Host stand-in for the FreeRTOS semaphore types. Single threaded, so there is nothing to lock.
+ *
+ */
+
+#ifndef HOST_SHIM_SEMPHR_H
+#define HOST_SHIM_SEMPHR_H
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#endif  // HOST_SHIM_SEMPHR_H
@@ -0,0 +1,14 @@
+/**
+ * @file task.h
+ * @brief Host stand-in for the FreeRTOS task API. The host builds are single threaded, only the types exist.
+ *
+ */
+
+#ifndef HOST_SHIM_TASK_H
+#define HOST_SHIM_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task * TaskHandle_t;
+
+#endif  // HOST_SHIM_TASK_H
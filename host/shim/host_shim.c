@@ -0,0 +1,326 @@
+/*
+ * @file host_shim.c
+ * @brief Host implementations behind the ESP-IDF/FreeRTOS stand-in headers.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_shim.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+
+/*---------------------------------------------------------------
+    GPIO
+---------------------------------------------------------------*/
+static uint32_t gpio_in[2];                 // Emulated GPIO_IN_REG / GPIO_IN1_REG
+static gpio_int_type_t gpio_intr[GPIO_NUM_MAX];
+static gpio_isr_t gpio_handler[GPIO_NUM_MAX];
+static void * gpio_handler_arg[GPIO_NUM_MAX];
+
+static bool gpio_valid(gpio_num_t gpio_num) {
+    return gpio_num >= 0 && gpio_num < GPIO_NUM_MAX;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags) {
+    (void)intr_alloc_flags;
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_intr[gpio_num] = GPIO_INTR_DISABLE;
+    gpio_handler[gpio_num] = NULL;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode) {
+    (void)mode;
+    return gpio_valid(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull) {
+    (void)pull;
+    return gpio_valid(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_intr[gpio_num] = intr_type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void * args) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_handler[gpio_num] = isr_handler;
+    gpio_handler_arg[gpio_num] = args;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_handler[gpio_num] = NULL;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num) {
+    if (!gpio_valid(gpio_num)) {
+        return 0;
+    }
+    return (gpio_in[gpio_num / 32] >> (gpio_num % 32)) & 1;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (level) {
+        gpio_in[gpio_num / 32] |= (1u << (gpio_num % 32));
+    }
+    else {
+        gpio_in[gpio_num / 32] &= ~(1u << (gpio_num % 32));
+    }
+    return ESP_OK;
+}
+
+void host_gpio_drive(gpio_num_t gpio_num, int level) {
+    if (!gpio_valid(gpio_num)) {
+        return;
+    }
+    int old = gpio_get_level(gpio_num);
+    gpio_set_level(gpio_num, level ? 1 : 0);
+    if (old == (level ? 1 : 0) || gpio_handler[gpio_num] == NULL) {
+        return;
+    }
+    gpio_int_type_t type = gpio_intr[gpio_num];
+    if (type == GPIO_INTR_ANYEDGE || (type == GPIO_INTR_POSEDGE && level) || (type == GPIO_INTR_NEGEDGE && !level)) {
+        gpio_handler[gpio_num](gpio_handler_arg[gpio_num]);
+    }
+}
+
+uint32_t host_reg_read(uint32_t addr) {
+    switch (addr) {
+        case GPIO_IN_REG:
+            return gpio_in[0];
+        case GPIO_IN1_REG:
+            return gpio_in[1];
+        default:
+            return 0;
+    }
+}
+
+/*---------------------------------------------------------------
+    Cycle counter (nanoseconds of the host monotonic clock)
+---------------------------------------------------------------*/
+uint32_t esp_cpu_get_cycle_count(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+/*---------------------------------------------------------------
+    esp_timer on the fake clock
+---------------------------------------------------------------*/
+struct esp_timer {
+    esp_timer_create_args_t args;
+    bool active;
+    int64_t alarm_us;
+    uint64_t period_us;     // 0 for one-shot
+    struct esp_timer * next;
+};
+
+static int64_t clock_now_us = 0;
+static struct esp_timer * timers = NULL;
+
+int64_t esp_timer_get_time(void) {
+    return clock_now_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t * args, esp_timer_handle_t * out_handle) {
+    if (args == NULL || args->callback == NULL || out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_timer * timer = calloc(1, sizeof(struct esp_timer));
+    if (timer == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    timer->args = *args;
+    timer->next = timers;
+    timers = timer;
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = true;
+    timer->alarm_us = clock_now_us + (int64_t)timeout_us;
+    timer->period_us = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = true;
+    timer->alarm_us = clock_now_us + (int64_t)period_us;
+    timer->period_us = period_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    for (struct esp_timer ** it = &timers; *it; it = &(*it)->next) {
+        if (*it == timer) {
+            *it = timer->next;
+            free(timer);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    return timer->active;
+}
+
+// Earliest active timer due at or before 'limit', or NULL
+static struct esp_timer * next_due(int64_t limit) {
+    struct esp_timer * due = NULL;
+    for (struct esp_timer * it = timers; it; it = it->next) {
+        if (it->active && it->alarm_us <= limit && (due == NULL || it->alarm_us < due->alarm_us)) {
+            due = it;
+        }
+    }
+    return due;
+}
+
+void host_clock_advance_to_us(int64_t when_us) {
+    struct esp_timer * due;
+    while ((due = next_due(when_us)) != NULL) {
+        clock_now_us = due->alarm_us;
+        if (due->period_us) {
+            due->alarm_us += (int64_t)due->period_us;
+        }
+        else {
+            due->active = false;
+        }
+        due->args.callback(due->args.arg);
+    }
+    if (when_us > clock_now_us) {
+        clock_now_us = when_us;
+    }
+}
+
+void host_clock_advance_us(int64_t delta_us) {
+    host_clock_advance_to_us(clock_now_us + delta_us);
+}
+
+void host_clock_set_us(int64_t now_us) {
+    clock_now_us = now_us;
+}
+
+/*---------------------------------------------------------------
+    Queues (ring buffer, never blocks)
+---------------------------------------------------------------*/
+struct host_queue {
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+    uint8_t * storage;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    struct host_queue * queue = calloc(1, sizeof(struct host_queue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->storage = calloc(length, item_size ? item_size : 1);
+    if (queue->storage == NULL) {
+        free(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    if (queue) {
+        free(queue->storage);
+        free(queue);
+    }
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void * item, TickType_t ticks) {
+    (void)ticks;
+    if (queue->count == queue->length) {
+        return pdFAIL;
+    }
+    UBaseType_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->storage + tail * queue->item_size, item, queue->item_size);
+    queue->count++;
+    return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void * item, BaseType_t * task_woken) {
+    if (task_woken) {
+        *task_woken = pdFALSE;
+    }
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void * item, TickType_t ticks) {
+    (void)ticks;
+    if (queue->count == 0) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->storage + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue->count;
+}
+
+/*---------------------------------------------------------------
+    Reset
+---------------------------------------------------------------*/
+void host_shim_reset(void) {
+    memset(gpio_in, 0, sizeof(gpio_in));
+    memset(gpio_intr, 0, sizeof(gpio_intr));
+    memset(gpio_handler, 0, sizeof(gpio_handler));
+    memset(gpio_handler_arg, 0, sizeof(gpio_handler_arg));
+    while (timers) {
+        struct esp_timer * next = timers->next;
+        free(timers);
+        timers = next;
+    }
+    clock_now_us = 0;
+}
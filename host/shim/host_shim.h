@@ -0,0 +1,24 @@
+/**
+ * @file host_shim.h
+ * @brief Harness side of the host shims: drive GPIO inputs and move the fake clock.
+ *
+ */
+
+#ifndef HOST_SHIM_H
+#define HOST_SHIM_H
+
+#include <stdint.h>
+#include "driver/gpio.h"
+
+// Drive an input pin from outside, running its ISR handler if the edge matches its interrupt type
+void host_gpio_drive(gpio_num_t gpio_num, int level);
+
+// Fake clock used by esp_timer_get_time(). Advancing runs every esp_timer callback due in between.
+void host_clock_set_us(int64_t now_us);
+void host_clock_advance_us(int64_t delta_us);
+void host_clock_advance_to_us(int64_t when_us);
+
+// Clear all shim state (pins, handlers, timers, clock)
+void host_shim_reset(void);
+
+#endif  // HOST_SHIM_H
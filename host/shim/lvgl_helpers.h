@@ -0,0 +1,15 @@
+/**
+ * @file lvgl_helpers.h
+ * @brief Host stand-in for the lvgl_esp32_drivers helpers. The panel, SPI bus and backlight do not exist on the
+ *        host, the simulator registers its own framebuffer display driver.
+ *
+ */
+
+#ifndef HOST_SHIM_LVGL_HELPERS_H
+#define HOST_SHIM_LVGL_HELPERS_H
+
+#include "lvgl.h"
+
+typedef void * disp_backlight_h;
+
+#endif  // HOST_SHIM_LVGL_HELPERS_H
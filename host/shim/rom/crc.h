@@ -0,0 +1,14 @@
+/**
+ * @file crc.h
+ * @brief Host stand-in for the ROM CRC routines.
+ *
+ */
+
+#ifndef HOST_SHIM_ROM_CRC_H
+#define HOST_SHIM_ROM_CRC_H
+
+#include <stdint.h>
+
+uint32_t crc32_le(uint32_t crc, const uint8_t * buf, uint32_t len);
+
+#endif  // HOST_SHIM_ROM_CRC_H
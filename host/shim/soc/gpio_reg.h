@@ -0,0 +1,13 @@
+/**
+ * @file gpio_reg.h
+ * @brief Host stand-in for the ESP32 GPIO input register addresses (same values as on target).
+ *
+ */
+
+#ifndef HOST_SHIM_GPIO_REG_H
+#define HOST_SHIM_GPIO_REG_H
+
+#define GPIO_IN_REG     0x3FF4403C  // Levels of GPIO0-31
+#define GPIO_IN1_REG    0x3FF44040  // Levels of GPIO32-39
+
+#endif  // HOST_SHIM_GPIO_REG_H
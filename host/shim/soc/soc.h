@@ -0,0 +1,16 @@
+/**
+ * @file soc.h
+ * @brief Host stand-in for the register access macros. Reads are served by the GPIO shim.
+ *
+ */
+
+#ifndef HOST_SHIM_SOC_H
+#define HOST_SHIM_SOC_H
+
+#include <stdint.h>
+
+uint32_t host_reg_read(uint32_t addr);
+
+#define REG_READ(addr)  host_reg_read((uint32_t)(addr))
+
+#endif  // HOST_SHIM_SOC_H
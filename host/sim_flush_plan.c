@@ -0,0 +1,186 @@
+/*
+ * @file sim_flush_plan.c
+ * @brief Host replay of dirty rectangle patterns from the main screen through the flush planner
+ *        (main/app_flush_plan.c), printing the per frame flush counters with and without planning. With --check,
+ *        also fuzzes the planner and verifies that it never raises the modelled cost, that every invalidated area
+ *        stays covered and that the last area LVGL draws keeps its index.
+ *
+ *   sim_flush_plan [--check]
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app_include/app_flush_plan.h"
+
+#define HOR_RES     320
+#define VER_RES     240
+#define BUF_PX      (HOR_RES * 40)      // APP_DISP_STRIP_LINES
+#define MS_PER_FRAME 30                 // LV_DISP_DEF_REFR_PERIOD
+
+static const char * TAG = "SIM";
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    const char * name;
+    int num;
+    app_flush_rect_t rects[APP_FLUSH_PLAN_MAX_AREAS];
+} scenario_t;
+
+#define R(x, y, w, h)   {(x), (y), (x) + (w) - 1, (y) + (h) - 1}
+
+// Approximate layouts of app_display_init: 50 px arcs down the right edge, value labels inside them, the
+// scrolling banner, the battery and channel labels along the top
+static const scenario_t scenarios[] = {
+    {"one arc + value", 2, {R(260, 10, 50, 50), R(275, 27, 20, 16)}},
+    {"two arcs", 4, {R(260, 10, 50, 50), R(275, 27, 20, 16), R(260, 65, 50, 50), R(275, 82, 20, 16)}},
+    {"all four arcs", 4, {R(260, 10, 50, 50), R(260, 65, 50, 50), R(260, 125, 50, 50), R(260, 180, 50, 50)}},
+    {"status labels", 2, {R(25, 5, 66, 16), R(95, 5, 70, 16)}},
+    {"banner scroll", 1, {R(40, 30, 100, 30)}},
+    {"banner + vbat + arc", 3, {R(40, 30, 100, 30), R(25, 5, 66, 16), R(260, 180, 50, 50)}},
+    {"glyph run", 8, {R(100, 200, 8, 14), R(110, 200, 8, 14), R(120, 200, 8, 14), R(130, 200, 8, 14),
+                      R(140, 200, 8, 14), R(150, 200, 8, 14), R(160, 200, 8, 14), R(170, 200, 8, 14)}},
+    {"far corners", 2, {R(0, 0, 10, 10), R(310, 230, 10, 10)}},
+};
+
+static int contains(const app_flush_rect_t * outer, const app_flush_rect_t * inner) {
+    return outer->x1 <= inner->x1 && outer->y1 <= inner->y1 && outer->x2 >= inner->x2 && outer->y2 >= inner->y2;
+}
+
+static int last_unjoined(const uint8_t * joined, int num) {
+    for (int i = num - 1; i >= 0; i--) {
+        if (!joined[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*---------------------------------------------------------------
+    Plan one frame, check the invariants and emit its flushes the
+    way LVGL would (full width strips of the draw buffer)
+---------------------------------------------------------------*/
+static void run_frame(app_flush_rect_t * rects, uint8_t * joined, int num, int plan, uint32_t * now_ms) {
+
+    app_flush_rect_t before[APP_FLUSH_PLAN_MAX_AREAS];
+    uint8_t joined_before[APP_FLUSH_PLAN_MAX_AREAS];
+    memcpy(before, rects, sizeof(before[0]) * num);
+    memcpy(joined_before, joined, num);
+    int last = last_unjoined(joined, num);
+
+    if (plan) {
+        app_flush_plan(rects, joined, num, BUF_PX);
+
+        app_flush_plan_stats_t stats;
+        app_flush_plan_get_stats(&stats);
+        CHECK(stats.cost_out <= stats.cost_in);
+        CHECK(last_unjoined(joined, num) == last);
+        for (int i = 0; i < num; i++) {
+            if (joined_before[i]) {
+                continue;
+            }
+            int covered = 0;
+            for (int j = 0; j < num && !covered; j++) {
+                covered = !joined[j] && contains(&rects[j], &before[i]);
+            }
+            CHECK(covered);
+        }
+    }
+
+    for (int i = 0; i < num; i++) {
+        if (joined[i]) {
+            continue;
+        }
+        int32_t w = rects[i].x2 - rects[i].x1 + 1;
+        int32_t h = rects[i].y2 - rects[i].y1 + 1;
+        int32_t rows = BUF_PX / w;
+        for (int32_t y = 0; y < h; y += rows) {
+            app_flush_plan_count_flush(w, (h - y) < rows ? (h - y) : rows);
+        }
+    }
+    *now_ms += MS_PER_FRAME;
+    app_flush_plan_frame_end(*now_ms);
+}
+
+static void replay_scenarios(void) {
+
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        for (int plan = 0; plan <= 1; plan++) {
+            app_flush_rect_t rects[APP_FLUSH_PLAN_MAX_AREAS];
+            uint8_t joined[APP_FLUSH_PLAN_MAX_AREAS] = {0};
+            uint32_t now_ms = 0;
+            memcpy(rects, scenarios[s].rects, sizeof(rects));
+
+            app_flush_plan_reset(now_ms);
+            run_frame(rects, joined, scenarios[s].num, plan, &now_ms);
+
+            app_flush_plan_stats_t stats;
+            app_flush_plan_get_stats(&stats);
+            printf("%-20s %-7s flushes %2u  px %6u  bytes %6u", scenarios[s].name, plan ? "planned" : "as is",
+                   stats.flushes, (unsigned)stats.px, (unsigned)stats.bytes);
+            if (plan) {
+                printf("  areas %u -> %u, cost %u -> %u, +%u px", stats.areas_in, stats.areas_out,
+                       (unsigned)stats.cost_in, (unsigned)stats.cost_out, (unsigned)stats.extra_px);
+            }
+            printf("\n");
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Random frames of small and medium areas, partly pre-joined the
+    way LVGL leaves them, one second of frames per configuration
+---------------------------------------------------------------*/
+static void fuzz(void) {
+
+    uint32_t now_ms = 0;
+    srand(4242);
+    app_flush_plan_reset(now_ms);
+
+    for (int f = 0; f < 20000; f++) {
+        app_flush_rect_t rects[APP_FLUSH_PLAN_MAX_AREAS];
+        uint8_t joined[APP_FLUSH_PLAN_MAX_AREAS] = {0};
+        int num = 1 + rand() % APP_FLUSH_PLAN_MAX_AREAS;
+        for (int i = 0; i < num; i++) {
+            int w = 1 + rand() % ((rand() % 4) ? 40 : HOR_RES);
+            int h = 1 + rand() % ((rand() % 4) ? 30 : VER_RES);
+            int x = rand() % (HOR_RES - w + 1);
+            int y = rand() % (VER_RES - h + 1);
+            rects[i] = (app_flush_rect_t)R(x, y, w, h);
+            joined[i] = (rand() % 5) == 0;
+        }
+        run_frame(rects, joined, num, 1, &now_ms);
+        if (failures) {
+            break;
+        }
+    }
+
+    app_flush_plan_log_stats(TAG);
+}
+
+int main(int argc, char ** argv) {
+
+    int check = argc > 1 && strcmp(argv[1], "--check") == 0;
+
+    replay_scenarios();
+    if (check) {
+        fuzz();
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (check) {
+        printf("All flush planner checks passed\n");
+    }
+    return 0;
+}
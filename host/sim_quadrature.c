@@ -0,0 +1,605 @@
+/*
+ * @file sim_quadrature.c
+ * @brief Quadrature signal simulator and decoder benchmark for the rotary encoder component.
+ *        Generates A/B waveforms (speed, contact bounce, glitches, direction reversals), drives them
+ *        through the real rotary_encoder.c via the GPIO shim, and scores the decoded steps against
+ *        a reference model of each state table.
+ *
+ *   sim_quadrature                  sweep of standard scenarios, full and half step
+ *   sim_quadrature --check          pass/fail checks used by ctest
+ *   sim_quadrature [options]        single run, see usage()
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rotary_encoder.h"
+#include "host_shim.h"
+
+#define SIM_PIN_A           GPIO_NUM_27     // Same pins as encoder A on the remote
+#define SIM_PIN_B           GPIO_NUM_14
+#define SIM_PIN_B_SPLIT     GPIO_NUM_33     // Other register bank, forces the gpio_get_level() fallback
+#define SIM_HOLD_LIMIT      120             // HOLD_POS_TOP/BOT for scored runs
+#define SIM_WALK_LIMIT      100             // The walk turns around here so the clamp stays out of the way
+
+typedef struct {
+    const char * name;
+    bool half_steps;
+    bool split_bank;
+    double speed;           // Full quadrature cycles (4 edges) per second
+    int bounce_us;          // Chatter window after each edge, 0 for clean edges
+    int bounce_max;         // Up to this many extra toggle pairs per edge when bouncing
+    double glitch_prob;     // Chance per edge of a short pulse on the other pin
+    int glitch_us;
+    double reversal_prob;   // Chance of reversing direction at each half cycle (00 or 11)
+    int half_cycles;        // Length of the run
+    uint32_t seed;
+} sim_config_t;
+
+typedef struct {
+    int64_t t_us;
+    uint32_t seq;           // Keeps events at the same microsecond in generation order
+    uint8_t pin;            // 0 = A, 1 = B
+    uint8_t level;
+} sim_edge_t;
+
+typedef struct {
+    int64_t t_us;
+    int8_t dir;             // +1 clockwise, -1 counter-clockwise
+} sim_step_t;
+
+typedef struct {
+    uint32_t expected;
+    uint32_t decoded;
+    uint32_t missed;
+    uint32_t extra;
+    uint32_t wrong_dir;
+    int32_t final_error;    // Decoded minus reference position at the end of the run
+    uint32_t edges;
+    double edges_per_s;
+    double isr_mean_ns;
+    int effective_bounce_us;
+} sim_result_t;
+
+typedef struct {
+    sim_edge_t * edges;
+    size_t num_edges;
+    size_t cap_edges;
+    sim_step_t * steps;
+    size_t num_steps;
+    size_t cap_steps;
+    int32_t ref_position;
+} sim_trace_t;
+
+/*---------------------------------------------------------------
+    Small deterministic PRNG so runs are reproducible everywhere
+---------------------------------------------------------------*/
+static uint32_t rng_state;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static double rng_unit(void) {
+    return (rng_next() >> 8) * (1.0 / 16777216.0);
+}
+
+/*---------------------------------------------------------------
+    Trace building
+---------------------------------------------------------------*/
+static void push_edge(sim_trace_t * trace, double t_us, int pin, int level) {
+    if (trace->num_edges == trace->cap_edges) {
+        trace->cap_edges = trace->cap_edges ? trace->cap_edges * 2 : 1024;
+        trace->edges = realloc(trace->edges, trace->cap_edges * sizeof(sim_edge_t));
+    }
+    trace->edges[trace->num_edges] = (sim_edge_t){ (int64_t)llround(t_us), (uint32_t)trace->num_edges, (uint8_t)pin, (uint8_t)level };
+    trace->num_edges++;
+}
+
+static void push_step(sim_trace_t * trace, double t_us, int dir) {
+    if (trace->num_steps == trace->cap_steps) {
+        trace->cap_steps = trace->cap_steps ? trace->cap_steps * 2 : 1024;
+        trace->steps = realloc(trace->steps, trace->cap_steps * sizeof(sim_step_t));
+    }
+    trace->steps[trace->num_steps++] = (sim_step_t){ (int64_t)llround(t_us), (int8_t)dir };
+}
+
+static int edge_cmp(const void * a, const void * b) {
+    const sim_edge_t * ea = a;
+    const sim_edge_t * eb = b;
+    if (ea->t_us != eb->t_us) {
+        return ea->t_us < eb->t_us ? -1 : 1;
+    }
+    return ea->seq < eb->seq ? -1 : (ea->seq > eb->seq);
+}
+
+// Quadrature phase q (mod 4) to BA levels, clockwise order as decoded by the tables: 11 -> 01 -> 00 -> 10
+static int phase_level(int q, int pin) {
+    static const uint8_t ba[4] = {0x3, 0x1, 0x0, 0x2};
+    return (ba[((q % 4) + 4) % 4] >> pin) & 1;
+}
+
+/*---------------------------------------------------------------
+    Generate the waveform and the reference step sequence.
+    The reference model counts a step each time the mechanical
+    phase settles on a new detent of the chosen table: every full
+    cycle (at 11) for full step, every half cycle (11 and 00) for
+    half step, with the same clamp as the driver.
+---------------------------------------------------------------*/
+static void generate(const sim_config_t * cfg, int hold_limit, int walk_limit, sim_trace_t * trace, int * effective_bounce_us) {
+
+    const double dt_us = 1e6 / (cfg->speed * 4.0);
+    const int unit = cfg->half_steps ? 2 : 4;
+    int bounce_us = cfg->bounce_us;
+
+    // Chatter must settle before the same pin can move again (one edge later if the direction reverses)
+    if (bounce_us > (int)dt_us - 1) {
+        bounce_us = (int)dt_us - 1;
+    }
+    *effective_bounce_us = bounce_us;
+
+    memset(trace, 0, sizeof(sim_trace_t));
+    rng_state = cfg->seed ? cfg->seed : 1;
+
+    int q = 0;
+    int dir = 1;
+    int last_detent = 0;
+    int32_t position = 0;
+    double t = dt_us;
+
+    // Resting phase 11, both pins high
+    push_edge(trace, 0, 0, 1);
+    push_edge(trace, 0, 1, 1);
+
+    for (int h = 0; h < cfg->half_cycles; h++) {
+
+        if (rng_unit() < cfg->reversal_prob || (dir > 0 && position >= walk_limit) || (dir < 0 && position <= -walk_limit)) {
+            dir = -dir;
+        }
+
+        for (int k = 0; k < 2; k++) {
+            int next = q + dir;
+            int pin = (phase_level(q, 0) != phase_level(next, 0)) ? 0 : 1;
+            int level = phase_level(next, pin);
+            q = next;
+
+            push_edge(trace, t, pin, level);
+            if (bounce_us > 0) {
+                int pairs = 1 + (int)(rng_next() % (uint32_t)cfg->bounce_max);
+                for (int i = 0; i < pairs; i++) {
+                    double t0 = t + rng_unit() * bounce_us;
+                    double t1 = t0 + rng_unit() * (t + bounce_us - t0);
+                    push_edge(trace, t0, pin, !level);
+                    push_edge(trace, t1 + 0.5, pin, level);
+                }
+            }
+            if (cfg->glitch_prob > 0 && rng_unit() < cfg->glitch_prob) {
+                int other = !pin;
+                int other_level = phase_level(q, other);
+                double tg = t + dt_us * 0.25 + rng_unit() * dt_us * 0.25;
+                push_edge(trace, tg, other, !other_level);
+                push_edge(trace, tg + cfg->glitch_us, other, other_level);
+            }
+
+            if ((q % unit) == 0) {
+                int detent = q / unit;
+                if (detent != last_detent) {
+                    int step = (detent > last_detent) ? 1 : -1;
+                    last_detent = detent;
+                    if ((step > 0 && position < hold_limit) || (step < 0 && position > -hold_limit)) {
+                        position += step;
+                        push_step(trace, t, step);
+                    }
+                }
+            }
+
+            t += dt_us;
+        }
+    }
+
+    trace->ref_position = position;
+    qsort(trace->edges, trace->num_edges, sizeof(sim_edge_t), edge_cmp);
+}
+
+static void trace_free(sim_trace_t * trace) {
+    free(trace->edges);
+    free(trace->steps);
+}
+
+/*---------------------------------------------------------------
+    Drive a trace through the driver and collect decoded steps
+---------------------------------------------------------------*/
+static void run_trace(const sim_config_t * cfg, const sim_trace_t * trace, int hold_limit,
+                      sim_step_t ** decoded, size_t * num_decoded, int32_t * position, sim_result_t * result) {
+
+    const gpio_num_t pins[2] = {SIM_PIN_A, cfg->split_bank ? SIM_PIN_B_SPLIT : SIM_PIN_B};
+    rotary_encoder_info_t info;
+    rotary_encoder_event_t event;
+    size_t cap = trace->num_steps + 64;
+    struct timespec start, end;
+
+    host_shim_reset();
+    memset(&info, 0, sizeof(info));
+
+    // Settle the resting levels before the ISRs are attached
+    host_gpio_drive(pins[0], 1);
+    host_gpio_drive(pins[1], 1);
+
+    rotary_encoder_init(&info, pins[0], pins[1], GPIO_NUM_NC, (int8_t)hold_limit, (int8_t)-hold_limit);
+    rotary_encoder_enable_half_steps(&info, cfg->half_steps);
+    QueueHandle_t queue = rotary_encoder_create_queue();
+    rotary_encoder_set_queue(&info, queue);
+
+    *decoded = malloc(cap * sizeof(sim_step_t));
+    *num_decoded = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < trace->num_edges; i++) {
+        const sim_edge_t * edge = &trace->edges[i];
+        host_clock_advance_to_us(edge->t_us);
+        host_gpio_drive(pins[edge->pin], edge->level);
+        while (xQueueReceive(queue, &event, 0)) {
+            if (*num_decoded == cap) {
+                cap *= 2;
+                *decoded = realloc(*decoded, cap * sizeof(sim_step_t));
+            }
+            int dir = (event.state.direction == ROTARY_ENCODER_DIRECTION_CLOCKWISE) ? 1 : -1;
+            (*decoded)[(*num_decoded)++] = (sim_step_t){ event.timestamp_us, (int8_t)dir };
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    rotary_encoder_state_t state;
+    rotary_encoder_get_state(&info, &state);
+    *position = state.position;
+
+    rotary_encoder_isr_stats_t stats;
+    rotary_encoder_get_isr_stats(&info, &stats);
+
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    result->edges = (uint32_t)trace->num_edges;
+    result->edges_per_s = seconds > 0 ? trace->num_edges / seconds : 0;
+    result->isr_mean_ns = stats.count ? (double)stats.total_cycles / stats.count : 0;
+
+    rotary_encoder_uninit(&info);
+    vQueueDelete(queue);
+}
+
+/*---------------------------------------------------------------
+    Find the unmatched reference step closest in time to 't' within
+    the window, optionally of a given direction (0 = either)
+---------------------------------------------------------------*/
+static long nearest_step(const sim_trace_t * trace, const bool * matched, int64_t t, int64_t window_us, int dir) {
+
+    size_t lo = 0;
+    size_t hi = trace->num_steps;
+    long best = -1;
+    int64_t best_dist = window_us + 1;
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (trace->steps[mid].t_us < t) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    for (long i = (long)lo - 1; i >= 0 && t - trace->steps[i].t_us <= window_us; i--) {
+        if (!matched[i] && (dir == 0 || trace->steps[i].dir == dir) && t - trace->steps[i].t_us < best_dist) {
+            best = i;
+            best_dist = t - trace->steps[i].t_us;
+        }
+    }
+    for (size_t i = lo; i < trace->num_steps && trace->steps[i].t_us - t <= window_us; i++) {
+        if (!matched[i] && (dir == 0 || trace->steps[i].dir == dir) && trace->steps[i].t_us - t < best_dist) {
+            best = (long)i;
+            best_dist = trace->steps[i].t_us - t;
+        }
+    }
+
+    return best;
+}
+
+/*---------------------------------------------------------------
+    Score decoded steps against the reference. A decoded step pairs
+    with the nearest reference step within half a detent: first in
+    the same direction, then (counted as wrong direction) in the
+    opposite one. Unpaired decoded steps are extra, unpaired
+    reference steps are missed.
+---------------------------------------------------------------*/
+static void score(const sim_config_t * cfg, const sim_trace_t * trace, const sim_step_t * decoded, size_t num_decoded,
+                  int32_t position, sim_result_t * result) {
+
+    const int64_t window_us = (int64_t)(1e6 / (cfg->speed * (cfg->half_steps ? 4.0 : 2.0)));
+    bool * matched = calloc(trace->num_steps + 1, sizeof(bool));
+    bool * paired = calloc(num_decoded + 1, sizeof(bool));
+    uint32_t hits = 0;
+
+    result->expected = (uint32_t)trace->num_steps;
+    result->decoded = (uint32_t)num_decoded;
+    result->wrong_dir = 0;
+    result->extra = 0;
+
+    for (size_t j = 0; j < num_decoded; j++) {
+        long i = nearest_step(trace, matched, decoded[j].t_us, window_us, decoded[j].dir);
+        if (i >= 0) {
+            matched[i] = true;
+            paired[j] = true;
+            hits++;
+        }
+    }
+    for (size_t j = 0; j < num_decoded; j++) {
+        if (paired[j]) {
+            continue;
+        }
+        long i = nearest_step(trace, matched, decoded[j].t_us, window_us, 0);
+        if (i >= 0) {
+            matched[i] = true;
+            result->wrong_dir++;
+            hits++;
+        }
+        else {
+            result->extra++;
+        }
+    }
+    result->missed = (uint32_t)trace->num_steps - hits;
+    result->final_error = position - trace->ref_position;
+
+    free(matched);
+    free(paired);
+}
+
+static void simulate(const sim_config_t * cfg, int hold_limit, int walk_limit, sim_result_t * result) {
+
+    sim_trace_t trace;
+    sim_step_t * decoded;
+    size_t num_decoded;
+    int32_t position;
+
+    memset(result, 0, sizeof(sim_result_t));
+    generate(cfg, hold_limit, walk_limit, &trace, &result->effective_bounce_us);
+    run_trace(cfg, &trace, hold_limit, &decoded, &num_decoded, &position, result);
+    score(cfg, &trace, decoded, num_decoded, position, result);
+
+    free(decoded);
+    trace_free(&trace);
+}
+
+/*---------------------------------------------------------------
+    Reporting
+---------------------------------------------------------------*/
+static void print_header(void) {
+    printf("%-18s %-4s %8s %8s %7s %7s %7s %7s %6s %9s %12s %8s\n",
+           "scenario", "mode", "expected", "decoded", "missed", "extra", "wrongdr", "poserr", "bnc_us", "edges", "edges/s", "isr_ns");
+}
+
+static void print_result(const sim_config_t * cfg, const sim_result_t * r) {
+    printf("%-18s %-4s %8u %8u %7u %7u %7u %7d %6d %9u %12.0f %8.1f\n",
+           cfg->name, cfg->half_steps ? "half" : "full", r->expected, r->decoded, r->missed, r->extra, r->wrong_dir,
+           r->final_error, r->effective_bounce_us, r->edges, r->edges_per_s, r->isr_mean_ns);
+}
+
+static const sim_config_t sim_defaults = {
+    .name = "custom",
+    .speed = 20.0,          // A brisk hand turn of a 24 PPR knob is roughly one revolution per second
+    .bounce_max = 3,
+    .glitch_us = 2,
+    .half_cycles = 20000,
+    .seed = 12345,
+};
+
+static void sweep(void) {
+
+    static const struct {
+        const char * name;
+        double speed;
+        int bounce_us;
+        double glitch_prob;
+        double reversal_prob;
+    } scenarios[] = {
+        {"clean slow",        5.0,    0, 0.00, 0.00},
+        {"clean fast",      400.0,    0, 0.00, 0.00},
+        {"reversals",        20.0,    0, 0.00, 0.20},
+        {"bounce 200us",     20.0,  200, 0.00, 0.05},
+        {"bounce 1ms",       20.0, 1000, 0.00, 0.05},
+        {"bounce 1ms fast",  200.0, 1000, 0.00, 0.05},
+        {"glitch 1%",        20.0,    0, 0.01, 0.05},
+        {"glitch 5%",        20.0,    0, 0.05, 0.05},
+        {"worst case",      100.0, 1000, 0.05, 0.20},
+    };
+
+    print_header();
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        for (int half = 0; half <= 1; half++) {
+            sim_config_t cfg = sim_defaults;
+            cfg.name = scenarios[i].name;
+            cfg.half_steps = half;
+            cfg.speed = scenarios[i].speed;
+            cfg.bounce_us = scenarios[i].bounce_us;
+            cfg.glitch_prob = scenarios[i].glitch_prob;
+            cfg.reversal_prob = scenarios[i].reversal_prob;
+            sim_result_t result;
+            simulate(&cfg, SIM_HOLD_LIMIT, SIM_WALK_LIMIT, &result);
+            print_result(&cfg, &result);
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Checks (ctest)
+---------------------------------------------------------------*/
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static void check_exact(const char * name, double speed, int bounce_us, double reversal_prob) {
+    for (int split = 0; split <= 1; split++) {
+        for (int half = 0; half <= 1; half++) {
+            sim_config_t cfg = sim_defaults;
+            cfg.name = name;
+            cfg.half_steps = half;
+            cfg.split_bank = split;
+            cfg.speed = speed;
+            cfg.bounce_us = bounce_us;
+            cfg.reversal_prob = reversal_prob;
+            cfg.half_cycles = 4000;
+            sim_result_t r;
+            simulate(&cfg, SIM_HOLD_LIMIT, SIM_WALK_LIMIT, &r);
+            if (r.missed || r.extra || r.wrong_dir || r.final_error) {
+                print_result(&cfg, &r);
+            }
+            CHECK(r.expected > 0);
+            CHECK(r.missed == 0 && r.extra == 0 && r.wrong_dir == 0 && r.final_error == 0);
+        }
+    }
+}
+
+// Clean waveform: 'cw' edges clockwise, then 'ccw' edges counter-clockwise, 1 ms apart
+static void build_turn(sim_trace_t * trace, int cw, int ccw) {
+    int q = 0;
+    double t = 1000;
+    memset(trace, 0, sizeof(sim_trace_t));
+    push_edge(trace, 0, 0, 1);
+    push_edge(trace, 0, 1, 1);
+    for (int i = 0; i < cw + ccw; i++, t += 1000) {
+        int next = q + ((i < cw) ? 1 : -1);
+        int pin = (phase_level(q, 0) != phase_level(next, 0)) ? 0 : 1;
+        push_edge(trace, t, pin, phase_level(next, pin));
+        q = next;
+    }
+}
+
+// Turn well past the top limit, then back one detent: the count holds at the limit and moves off it immediately
+static void check_clamp(bool half_steps) {
+
+    const int limit = 30;
+    const int detent_edges = half_steps ? 2 : 4;
+    sim_config_t cfg = sim_defaults;
+    cfg.half_steps = half_steps;
+    sim_trace_t trace;
+    sim_step_t * decoded;
+    size_t num_decoded;
+    int32_t position;
+    sim_result_t r;
+
+    build_turn(&trace, 50 * 4, 0);
+    run_trace(&cfg, &trace, limit, &decoded, &num_decoded, &position, &r);
+    CHECK(position == limit);
+    CHECK(num_decoded == (size_t)limit);
+    free(decoded);
+    trace_free(&trace);
+
+    build_turn(&trace, 50 * 4, detent_edges);
+    run_trace(&cfg, &trace, limit, &decoded, &num_decoded, &position, &r);
+    CHECK(position == limit - 1);
+    CHECK(num_decoded == (size_t)limit + 1);
+    CHECK(num_decoded > 0 && decoded[num_decoded - 1].dir == -1);
+    free(decoded);
+    trace_free(&trace);
+}
+
+/*---------------------------------------------------------------
+    Command line
+---------------------------------------------------------------*/
+static void usage(const char * argv0) {
+    printf("usage: %s [--check] [--half] [--split-bank] [--speed cycles/s] [--bounce-us N] [--bounce-max N]\n"
+           "          [--glitch prob] [--glitch-us N] [--reversal prob] [--half-cycles N] [--seed N]\n"
+           "With no options, runs the standard scenario sweep.\n", argv0);
+}
+
+int main(int argc, char ** argv) {
+
+    sim_config_t cfg = sim_defaults;
+    bool custom = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char * arg = argv[i];
+        const char * val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--check") == 0) {
+            check_exact("clean", 20.0, 0, 0.0);
+            check_exact("clean fast", 2000.0, 0, 0.0);
+            check_exact("reversals", 20.0, 0, 0.3);
+            check_exact("bounce", 20.0, 500, 0.1);
+            check_clamp(false);
+            check_clamp(true);
+            if (failures) {
+                printf("sim_quadrature: %d failure(s)\n", failures);
+                return 1;
+            }
+            printf("sim_quadrature: all passed\n");
+            return 0;
+        }
+        else if (strcmp(arg, "--half") == 0) {
+            cfg.half_steps = true;
+        }
+        else if (strcmp(arg, "--split-bank") == 0) {
+            cfg.split_bank = true;
+        }
+        else if (val && strcmp(arg, "--speed") == 0) {
+            cfg.speed = atof(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--bounce-us") == 0) {
+            cfg.bounce_us = atoi(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--bounce-max") == 0) {
+            cfg.bounce_max = atoi(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--glitch") == 0) {
+            cfg.glitch_prob = atof(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--glitch-us") == 0) {
+            cfg.glitch_us = atoi(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--reversal") == 0) {
+            cfg.reversal_prob = atof(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--half-cycles") == 0) {
+            cfg.half_cycles = atoi(val);
+            i++;
+        }
+        else if (val && strcmp(arg, "--seed") == 0) {
+            cfg.seed = (uint32_t)strtoul(val, NULL, 0);
+            i++;
+        }
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+        custom = true;
+    }
+
+    if (cfg.speed <= 0 || cfg.bounce_max < 1 || cfg.half_cycles < 1) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (!custom) {
+        sweep();
+        return 0;
+    }
+
+    sim_result_t result;
+    simulate(&cfg, SIM_HOLD_LIMIT, SIM_WALK_LIMIT, &result);
+    print_header();
+    print_result(&cfg, &result);
+    return 0;
+}
@@ -0,0 +1,605 @@
+/*
+ * @file sim_ui.c
+ * @brief Headless run of the remote's main screen (main/app_ui.c) on LVGL configured as on the device, drawing
+ *        into a 320x240 RGB565 framebuffer. Scripted scenarios move the mocked encoders, switches, pots and
+ *        battery the way the input and ADC tasks would, the display loop is paced like displayTask, and every
+ *        frame's render time (host CPU), flushed area and LVGL heap use are recorded. Screenshots taken at the end
+ *        of a scenario are compared with the references in host/ref/ (binary PPM, viewable with most tools).
+ *        Heap figures come from a 64 bit build, object sizes on the device are smaller.
+ *
+ *   sim_ui [--check] [--update] [--frames] [--no-plan] [--profile] [--ref-dir DIR]
+ *
+ *   --check    fail on any screenshot difference (actual and diff images are written to the working directory)
+ *              and on the redraw and heap invariants
+ *   --update   rewrite the reference screenshots from this run
+ *   --frames   print one line per frame
+ *   --no-plan  leave LVGL's invalidated areas as they are (the device runs the flush planner)
+ *   --profile  run the render profiler (main/app_render_prof.c) and print its per frame and per object costs,
+ *              in host nanoseconds
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "app_include/app_ui.h"
+#include "app_include/app_flush_plan.h"
+#include "app_include/app_disp_pipe.h"
+#include "app_include/app_render_prof.h"
+
+#define HOR_RES         320     // Logical, after LV_DISP_ROT_270
+#define VER_RES         240
+#define BUF_PX          (APP_DISP_HOR_RES * APP_DISP_STRIP_LINES)
+#define TICK_MS         10      // FreeRTOS tick, the paced display loop sleeps whole ticks
+#define ENC_COUNTS      30      // MAX_ENCODER_COUNTS
+#define BANNER_PX       (100 * 16)    // Scrolling banner: its text band (one line) across the 100 px box, app_banner.c
+#define HEAP_SLACK      256     // Bytes the LVGL heap may grow over the whole run before it counts as a leak
+
+static const char * TAG = "SIM";
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static struct {
+    bool check;
+    bool update;
+    bool frames;
+    bool plan;
+    bool profile;
+    const char * ref_dir;
+} opt = {false, false, false, true, false, SIM_UI_REF_DIR};
+
+// Application state behind app_ui_io_t
+static struct {
+    int enc_pos[APP_UI_NUM_ENC];
+    bool enc_pressed[APP_UI_NUM_ENC];
+    int pot_pct[APP_UI_NUM_POT];
+    int vbat_cv;
+    battery_states_t battery;
+    int backlight;
+} mock = {
+    .pot_pct = {50, 50},
+    .vbat_cv = 405,
+    .battery = BAT_FULL,
+    .backlight = -1,
+};
+
+static lv_color_t fb[VER_RES][HOR_RES];
+static uint32_t now_ms = 0;
+
+// Current frame and the running scenario's totals
+static struct {
+    int64_t start_ns;
+    uint32_t flushes;
+    uint32_t flushed_px;
+} frame;
+
+static struct {
+    uint32_t frames;
+    uint64_t render_ns;
+    uint64_t render_max_ns;
+    uint64_t handler_ns;
+    uint64_t handler_max_ns;
+    uint32_t flushes;
+    uint64_t flushed_px;
+    uint32_t flushed_px_max;
+    uint64_t inv_px;
+    uint32_t heap_used;         // LVGL heap (LV_MEM_SIZE) in use after the last frame, allocator overhead included
+    uint32_t heap_peak;
+    uint8_t frag_pct;
+    bool frame_done;
+} run;
+
+static int64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/*---------------------------------------------------------------
+    Mocked inputs (app_ui_io_t)
+---------------------------------------------------------------*/
+static int io_enc_pos(app_ui_enc_t enc) {
+    return mock.enc_pos[enc];
+}
+
+static bool io_enc_pressed(app_ui_enc_t enc) {
+    return mock.enc_pressed[enc];
+}
+
+static int io_pot_pct(app_ui_pot_t pot) {
+    return mock.pot_pct[pot];
+}
+
+static int io_vbat_cv(void) {
+    return mock.vbat_cv;
+}
+
+static battery_states_t io_battery_state(void) {
+    return mock.battery;
+}
+
+static void io_set_backlight(int pct) {
+    mock.backlight = pct;
+}
+
+static const app_ui_io_t io = {
+    .enc_pos = io_enc_pos,
+    .enc_pressed = io_enc_pressed,
+    .pot_pct = io_pot_pct,
+    .vbat_cv = io_vbat_cv,
+    .battery_state = io_battery_state,
+    .set_backlight = io_set_backlight,
+};
+
+/*---------------------------------------------------------------
+    Framebuffer display driver, as app_disp_pipe on the device:
+    two strip buffers, flush planner in render_start_cb
+---------------------------------------------------------------*/
+static void plan_areas(lv_disp_drv_t * disp_drv) {
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    app_flush_rect_t rects[APP_FLUSH_PLAN_MAX_AREAS];
+    int num = LV_MIN(disp->inv_p, APP_FLUSH_PLAN_MAX_AREAS);
+
+    for (int i = 0; i < num; i++) {
+        rects[i] = (app_flush_rect_t){disp->inv_areas[i].x1, disp->inv_areas[i].y1, disp->inv_areas[i].x2, disp->inv_areas[i].y2};
+    }
+    if (app_flush_plan(rects, disp->inv_area_joined, num, disp_drv->draw_buf->size) == 0) {
+        return;
+    }
+    for (int i = 0; i < num; i++) {
+        if (!disp->inv_area_joined[i]) {
+            lv_area_set(&disp->inv_areas[i], rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2);
+        }
+    }
+}
+
+static void render_start_cb(lv_disp_drv_t * disp_drv) {
+    if (opt.plan) {
+        plan_areas(disp_drv);
+    }
+    memset(&frame, 0, sizeof(frame));
+    frame.start_ns = host_ns();
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+
+    int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y][area->x1], color_map, w * sizeof(lv_color_t));
+        color_map += w;
+    }
+    frame.flushes++;
+    frame.flushed_px += lv_area_get_size(area);
+    app_flush_plan_count_flush(w, lv_area_get_height(area));
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+
+    uint64_t render_ns = host_ns() - frame.start_ns;
+    lv_mem_monitor_t mem;
+    lv_mem_monitor(&mem);
+
+    run.frames++;
+    run.render_ns += render_ns;
+    run.render_max_ns = LV_MAX(run.render_max_ns, render_ns);
+    run.flushes += frame.flushes;
+    run.flushed_px += frame.flushed_px;
+    run.flushed_px_max = LV_MAX(run.flushed_px_max, frame.flushed_px);
+    run.inv_px += px;
+    run.heap_used = mem.total_size - mem.free_size;
+    run.heap_peak = LV_MAX(run.heap_peak, run.heap_used);
+    run.frag_pct = mem.frag_pct;
+    run.frame_done = true;
+
+    if (opt.frames) {
+        printf("  frame %4lu @ %6lu ms  render %6.1f us  flushes %2lu  flushed px %6lu  invalidated px %6lu  heap %5lu B\n",
+               (unsigned long)run.frames, (unsigned long)now_ms, render_ns / 1000.0, (unsigned long)frame.flushes,
+               (unsigned long)frame.flushed_px, (unsigned long)px, (unsigned long)run.heap_used);
+    }
+
+    app_ui_model_monitor_cb(disp_drv, time_ms, px);
+    app_flush_plan_frame_end(now_ms);
+}
+
+static void display_init(void) {
+
+    static lv_color_t buf1[BUF_PX];
+    static lv_color_t buf2[BUF_PX];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, BUF_PX);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.render_start_cb = render_start_cb;
+    disp_drv.monitor_cb = monitor_cb;
+    disp_drv.hor_res = 240;     // Panel native, as displayTask registers it
+    disp_drv.ver_res = 320;
+    disp_drv.rotated = LV_DISP_ROT_270;
+    lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
+
+    app_flush_plan_reset(now_ms);
+    app_display_init(&io);
+
+    if (opt.profile) {
+        CHECK(app_render_prof_init(disp, 1000) == ESP_OK);    // esp_cpu_get_cycle_count() is host ns
+        app_render_prof_attach(lv_scr_act());
+    }
+
+#if DISPLAY_PACED
+    for (lv_indev_t * indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        lv_timer_pause(indev->driver->read_timer);
+    }
+#endif
+}
+
+/*---------------------------------------------------------------
+    Run the display loop for ms of virtual time, paced as in
+    displayTask. wake is handled on the first pass, as if the task
+    had been notified.
+---------------------------------------------------------------*/
+static void run_ms(uint32_t ms, uint32_t wake) {
+
+    uint32_t end_ms = now_ms + ms;
+
+    do {
+#if DISPLAY_PACED
+        if (wake & DISPLAY_WAKE_INPUT) {
+            for (lv_indev_t * indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+                lv_indev_read_timer_cb(indev->driver->read_timer);
+            }
+        }
+#endif
+        wake = 0;
+
+        run.frame_done = false;
+        int64_t start_ns = host_ns();
+        app_ui_model_sync();
+        uint32_t sleep_ms = lv_timer_handler();
+        uint64_t handler_ns = host_ns() - start_ns;
+        if (run.frame_done) {
+            run.handler_ns += handler_ns;
+            run.handler_max_ns = LV_MAX(run.handler_max_ns, handler_ns);
+        }
+
+        sleep_ms = LV_MIN(sleep_ms, DISPLAY_MAX_SLEEP_MS);
+#if DISPLAY_PACED
+        uint32_t step_ms = ((sleep_ms + TICK_MS - 1) / TICK_MS) * TICK_MS;
+#else
+        uint32_t step_ms = TICK_MS;
+#endif
+        step_ms = LV_MAX(step_ms, TICK_MS);
+        step_ms = LV_MIN(step_ms, end_ms - now_ms);
+        lv_tick_inc(step_ms);
+        now_ms += step_ms;
+    } while (now_ms < end_ms);
+}
+
+/*---------------------------------------------------------------
+    Input helpers: the input task publishes a position and wakes
+    the display, the ADC tasks update a value every 10 ms
+---------------------------------------------------------------*/
+static void enc_turn_to(app_ui_enc_t enc, int target, uint32_t step_ms) {
+    while (mock.enc_pos[enc] != target) {
+        mock.enc_pos[enc] += (target > mock.enc_pos[enc]) ? 1 : -1;
+        run_ms(step_ms, DISPLAY_WAKE_INPUT);
+    }
+}
+
+static void enc_press(app_ui_enc_t enc, uint32_t hold_ms) {
+    mock.enc_pressed[enc] = true;
+    run_ms(hold_ms, DISPLAY_WAKE_INPUT);
+    mock.enc_pressed[enc] = false;
+    run_ms(TICK_MS, DISPLAY_WAKE_INPUT);
+}
+
+static void pot_turn_to(app_ui_pot_t pot, int target) {
+    while (mock.pot_pct[pot] != target) {
+        mock.pot_pct[pot] += (target > mock.pot_pct[pot]) ? 1 : -1;
+        run_ms(10, DISPLAY_WAKE_MODEL);
+    }
+}
+
+static void vbat_set(int centivolts) {
+    // Same thresholds as vbat_assign_state in app_main.c
+    mock.vbat_cv = centivolts;
+    mock.battery = (centivolts > 390) ? BAT_FULL : (centivolts > 340) ? BAT_MED : BAT_LOW;
+    run_ms(1000, DISPLAY_WAKE_MODEL);   // vbat task period
+}
+
+/*---------------------------------------------------------------
+    Scenarios
+---------------------------------------------------------------*/
+static void scenario_boot(void) {
+    run_ms(1000, 0);
+}
+
+static void scenario_knobs(void) {
+    enc_turn_to(APP_UI_ENC_A, ENC_COUNTS, 20);
+    enc_turn_to(APP_UI_ENC_A, -ENC_COUNTS, 20);
+    enc_turn_to(APP_UI_ENC_A, 12, 20);
+    enc_turn_to(APP_UI_ENC_B, -ENC_COUNTS, 20);
+    enc_turn_to(APP_UI_ENC_B, -7, 20);
+    enc_press(APP_UI_ENC_A, 200);
+    run_ms(100, 0);
+}
+
+static void scenario_pots(void) {
+    pot_turn_to(APP_UI_POT_C, 0);
+    pot_turn_to(APP_UI_POT_C, 100);
+    pot_turn_to(APP_UI_POT_C, 75);
+    pot_turn_to(APP_UI_POT_D, 100);
+    pot_turn_to(APP_UI_POT_D, 20);
+    run_ms(100, 0);
+}
+
+static void scenario_swap(void) {
+    app_display_swap_image();
+    run_ms(300, DISPLAY_WAKE_INPUT);
+    app_display_swap_image();
+    run_ms(300, DISPLAY_WAKE_INPUT);
+    app_display_swap_image();
+    run_ms(300, DISPLAY_WAKE_INPUT);
+}
+
+static void scenario_battery(void) {
+    for (int cv = 405; cv >= 330; cv -= 5) {
+        vbat_set(cv);
+    }
+    mock.enc_pressed[APP_UI_ENC_B] = true;     // Held for the screenshot, knob B drawn pressed
+    run_ms(200, DISPLAY_WAKE_INPUT);
+}
+
+static void scenario_idle(void) {
+    run_ms(2000, 0);
+}
+
+typedef struct {
+    const char * name;
+    void (*run)(void);
+    const char * screenshot;    // Compared at the end of the scenario, NULL for none
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    {"boot",         scenario_boot,    "boot"},
+    {"knob sweep",   scenario_knobs,   "knobs"},
+    {"pot sweep",    scenario_pots,    NULL},
+    {"image swap",   scenario_swap,    "swap"},
+    {"battery",      scenario_battery, "battery"},
+    {"idle",         scenario_idle,    NULL},
+};
+
+/*---------------------------------------------------------------
+    Screenshots: binary PPM, RGB888 expanded from the RGB565
+    (byte swapped) framebuffer
+---------------------------------------------------------------*/
+static void fb_to_rgb(uint8_t * rgb) {
+    for (int y = 0; y < VER_RES; y++) {
+        for (int x = 0; x < HOR_RES; x++) {
+            lv_color32_t c;
+            c.full = lv_color_to32(fb[y][x]);
+            *rgb++ = c.ch.red;
+            *rgb++ = c.ch.green;
+            *rgb++ = c.ch.blue;
+        }
+    }
+}
+
+static bool ppm_write(const char * path, const uint8_t * rgb) {
+    FILE * f = fopen(path, "wb");
+    if (f == NULL) {
+        printf("Cannot write %s\n", path);
+        return false;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", HOR_RES, VER_RES);
+    bool ok = fwrite(rgb, 3, HOR_RES * VER_RES, f) == HOR_RES * VER_RES;
+    fclose(f);
+    return ok;
+}
+
+static bool ppm_read(const char * path, uint8_t * rgb) {
+    FILE * f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    int w = 0;
+    int h = 0;
+    int max = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF && w == HOR_RES && h == VER_RES && max == 255 &&
+              fread(rgb, 3, HOR_RES * VER_RES, f) == HOR_RES * VER_RES;
+    fclose(f);
+    return ok;
+}
+
+/*---------------------------------------------------------------
+    Compare the framebuffer with the named reference, or replace
+    the reference with it when updating
+---------------------------------------------------------------*/
+static void screenshot(const char * name) {
+
+    static uint8_t actual[VER_RES * HOR_RES * 3];
+    static uint8_t ref[VER_RES * HOR_RES * 3];
+    char path[512];
+
+    fb_to_rgb(actual);
+    snprintf(path, sizeof(path), "%s/%s.ppm", opt.ref_dir, name);
+
+    if (opt.update) {
+        if (ppm_write(path, actual)) {
+            printf("  screenshot %-8s written to %s\n", name, path);
+        }
+        return;
+    }
+    if (!ppm_read(path, ref)) {
+        printf("  screenshot %-8s no reference at %s (run with --update)\n", name, path);
+        CHECK(!opt.check);
+        return;
+    }
+
+    uint32_t diff_px = 0;
+    lv_area_t box = {HOR_RES, VER_RES, -1, -1};
+    for (int i = 0; i < HOR_RES * VER_RES; i++) {
+        uint8_t * a = &actual[i * 3];
+        uint8_t * r = &ref[i * 3];
+        if (memcmp(a, r, 3) == 0) {
+            continue;
+        }
+        int x = i % HOR_RES;
+        int y = i / HOR_RES;
+        box.x1 = LV_MIN(box.x1, x);
+        box.y1 = LV_MIN(box.y1, y);
+        box.x2 = LV_MAX(box.x2, x);
+        box.y2 = LV_MAX(box.y2, y);
+        diff_px++;
+        r[0] = 255;     // Reuse the reference as the diff image: changed pixels in red over the reference
+        r[1] = 0;
+        r[2] = 0;
+    }
+
+    if (diff_px == 0) {
+        printf("  screenshot %-8s matches\n", name);
+        return;
+    }
+    printf("  screenshot %-8s differs in %lu px within (%d,%d)-(%d,%d)", name, (unsigned long)diff_px,
+           (int)box.x1, (int)box.y1, (int)box.x2, (int)box.y2);
+    snprintf(path, sizeof(path), "%s.ppm", name);
+    ppm_write(path, actual);
+    snprintf(path, sizeof(path), "%s_diff.ppm", name);
+    ppm_write(path, ref);
+    printf(", wrote %s.ppm and %s_diff.ppm\n", name, name);
+    CHECK(!opt.check);
+}
+
+/*---------------------------------------------------------------
+    Profiled frames must add up: object draw time and blend plus
+    shape time both fit inside the frame
+---------------------------------------------------------------*/
+static void check_profile(void) {
+
+    static app_render_prof_frame_t frames[APP_RENDER_PROF_RING];
+    int n = app_render_prof_get_frames(frames, APP_RENDER_PROF_RING);
+
+    CHECK(n > 0);
+    for (int i = 0; i < n; i++) {
+        uint64_t drawn = 0;
+        for (int c = 0; c < APP_RENDER_PROF_NUM_CLASSES; c++) {
+            drawn += frames[i].class_cycles[c];
+        }
+        CHECK(frames[i].areas > 0 && frames[i].area_px > 0);
+        CHECK(frames[i].flushes > 0);
+        CHECK(drawn <= frames[i].total_cycles);
+        CHECK((uint64_t)frames[i].blend_cycles + frames[i].shape_cycles <= frames[i].total_cycles);
+    }
+}
+
+static void report(const char * name) {
+    uint32_t frames = LV_MAX(run.frames, 1);
+    printf("%-12s %4lu frames  render mean %7.1f us max %7.1f us  handler mean %7.1f us max %7.1f us\n", name,
+           (unsigned long)run.frames, run.render_ns / 1000.0 / frames, run.render_max_ns / 1000.0,
+           run.handler_ns / 1000.0 / frames, run.handler_max_ns / 1000.0);
+    printf("%-12s %4lu flushes %9llu px flushed (mean %6llu max %6lu per frame), %9llu px invalidated, heap %lu B (peak %lu B, frag %u%%)\n",
+           "", (unsigned long)run.flushes, (unsigned long long)run.flushed_px, (unsigned long long)(run.flushed_px / frames),
+           (unsigned long)run.flushed_px_max, (unsigned long long)run.inv_px, (unsigned long)run.heap_used,
+           (unsigned long)run.heap_peak, run.frag_pct);
+}
+
+// LVGL heap in use with the glyph cache emptied (it refills on the next frames), so leaks don't hide in its budget
+static uint32_t heap_without_glyphs(void) {
+    app_glyph_cache_stats_t glyphs;
+    lv_mem_monitor_t mem;
+    app_glyph_cache_get_stats(&glyphs);
+    app_glyph_cache_set_budget(0);
+    lv_mem_monitor(&mem);
+    app_glyph_cache_set_budget(glyphs.budget);
+    return mem.total_size - mem.free_size;
+}
+
+int main(int argc, char ** argv) {
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            opt.check = true;
+        }
+        else if (strcmp(argv[i], "--update") == 0) {
+            opt.update = true;
+        }
+        else if (strcmp(argv[i], "--frames") == 0) {
+            opt.frames = true;
+        }
+        else if (strcmp(argv[i], "--no-plan") == 0) {
+            opt.plan = false;
+        }
+        else if (strcmp(argv[i], "--profile") == 0) {
+            opt.profile = true;
+        }
+        else if (strcmp(argv[i], "--ref-dir") == 0 && i + 1 < argc) {
+            opt.ref_dir = argv[++i];
+        }
+        else {
+            printf("usage: %s [--check] [--update] [--frames] [--no-plan] [--profile] [--ref-dir DIR]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    display_init();
+    printf("Screen %dx%d RGB565, %d line strips, flush planner %s\n", HOR_RES, VER_RES, APP_DISP_STRIP_LINES,
+           opt.plan ? "on" : "off");
+
+    uint32_t heap_boot = 0;
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        memset(&run, 0, sizeof(run));
+        scenarios[s].run();
+        report(scenarios[s].name);
+        if (scenarios[s].screenshot != NULL) {
+            screenshot(scenarios[s].screenshot);
+        }
+
+        CHECK(run.frames > 0);
+        if (opt.profile) {
+            check_profile();
+            printf("%-12s last frames and most expensive objects so far:\n", "");
+            app_render_prof_log_stats(TAG);
+        }
+        if (s == 0) {
+            heap_boot = heap_without_glyphs();
+        }
+    }
+
+    // Last scenario is idle: only the banner may redraw, and the heap is back where boot left it
+    app_glyph_cache_stats_t glyphs;
+    app_num_label_stats_t numbers;
+    app_glyph_cache_get_stats(&glyphs);
+    app_num_label_get_stats(&numbers);
+    CHECK(run.flushed_px_max <= BANNER_PX);
+    CHECK(glyphs.bytes <= glyphs.budget);
+    CHECK(numbers.allocations == 0);
+    CHECK(mock.backlight == mock.pot_pct[APP_UI_POT_D]);
+
+    app_ui_model_log_stats(TAG);
+    app_flush_plan_log_stats(TAG);
+    app_glyph_cache_log_stats(TAG);
+    app_num_label_log_stats(TAG);
+    app_banner_log_stats(TAG);
+    CHECK(heap_without_glyphs() <= heap_boot + HEAP_SLACK);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    if (opt.check) {
+        printf("All UI checks passed\n");
+    }
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * @file test_disp_power.c
+ * @brief Host unit tests for the display power manager (main/app_disp_power.c), on a fake clock with recording
+ *        backlight and panel callbacks: inactivity timeouts, fades, instant wake, redundant backlight writes,
+ *        time per state and the current estimate.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app_include/app_disp_power.h"
+
+#define MS              1000LL
+#define S               1000000LL
+#define BRIGHTNESS      85
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+// What the hardware was last told, and the order it was told in
+static struct {
+    int backlight;
+    uint32_t fade_ms;
+    int backlight_calls;
+    bool asleep;
+    int sleep_calls;
+    int seq;
+    int backlight_seq;
+    int panel_seq;
+} hw;
+
+static void fake_backlight(int pct, uint32_t fade_ms) {
+    hw.backlight = pct;
+    hw.fade_ms = fade_ms;
+    hw.backlight_calls++;
+    hw.backlight_seq = ++hw.seq;
+}
+
+static void fake_panel_sleep(bool sleep) {
+    CHECK(sleep != hw.asleep);      // Only real transitions reach the panel
+    hw.asleep = sleep;
+    hw.sleep_calls++;
+    hw.panel_seq = ++hw.seq;
+}
+
+static const app_disp_power_io_t io = {
+    .backlight = fake_backlight,
+    .panel_sleep = fake_panel_sleep,
+};
+
+static void reset(int64_t now_us) {
+    memset(&hw, 0, sizeof(hw));
+    app_disp_power_init(&io, BRIGHTNESS, now_us);
+}
+
+static void test_timeouts(void) {
+
+    reset(0);
+    CHECK(hw.backlight == BRIGHTNESS && hw.fade_ms == 0 && hw.backlight_calls == 1);
+    CHECK(app_disp_power_rendering());
+
+    // Next deadline is the dim, nothing happens before it
+    CHECK(app_disp_power_poll(1 * S) == APP_DISP_POWER_DIM_MS - 1000);
+    CHECK(app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS - 1) == 1);
+    CHECK(hw.backlight_calls == 1);
+
+    // Dim: hardware fade down, still rendering
+    CHECK(app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS) == APP_DISP_POWER_SLEEP_MS - APP_DISP_POWER_DIM_MS);
+    CHECK(hw.backlight == APP_DISP_POWER_DIM_PCT && hw.fade_ms == APP_DISP_POWER_DIM_FADE_MS);
+    CHECK(app_disp_power_rendering());
+
+    // Sleep: backlight off before the panel goes to sleep, rendering stops
+    CHECK(app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS) == UINT32_MAX);
+    CHECK(hw.backlight == 0 && hw.fade_ms == 0);
+    CHECK(hw.asleep && hw.backlight_seq < hw.panel_seq);
+    CHECK(!app_disp_power_rendering());
+
+    // Polling asleep does nothing more
+    int calls = hw.backlight_calls;
+    CHECK(app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS * 10) == UINT32_MAX);
+    CHECK(hw.backlight_calls == calls && hw.sleep_calls == 1);
+}
+
+static void test_wake(void) {
+
+    // From sleep: panel out of sleep first, then the backlight straight to the setting
+    reset(0);
+    app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS);
+    CHECK(app_disp_power_activity(APP_DISP_POWER_SLEEP_MS * MS + 5 * S));
+    CHECK(!hw.asleep && hw.panel_seq < hw.backlight_seq);
+    CHECK(hw.backlight == BRIGHTNESS && hw.fade_ms == 0);
+    CHECK(app_disp_power_rendering());
+
+    // Timeouts restart from the wake
+    CHECK(app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS + 5 * S) == APP_DISP_POWER_DIM_MS);
+
+    // From dim: backlight back at once, the panel was never asleep, not a panel wake
+    reset(0);
+    app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS);
+    CHECK(!app_disp_power_activity(APP_DISP_POWER_DIM_MS * MS + 1 * S));
+    CHECK(hw.backlight == BRIGHTNESS && hw.fade_ms == 0 && hw.sleep_calls == 0);
+
+    // While on, input only pushes the deadline out
+    reset(0);
+    int calls = hw.backlight_calls;
+    CHECK(!app_disp_power_activity(20 * S));
+    CHECK(hw.backlight_calls == calls);
+    CHECK(app_disp_power_poll((20 + APP_DISP_POWER_DIM_MS / 1000) * S - 1) > 0);
+    CHECK(hw.backlight == BRIGHTNESS);
+
+    // A long gap between polls goes straight through dim to sleep
+    reset(0);
+    CHECK(app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS * 2) == UINT32_MAX);
+    CHECK(hw.asleep && hw.backlight == 0);
+
+    app_disp_power_stats_t s;
+    app_disp_power_get_stats(&s, APP_DISP_POWER_SLEEP_MS * MS * 2);
+    CHECK(s.dims == 1 && s.sleeps == 1 && s.wakes == 0);
+}
+
+static void test_brightness(void) {
+
+    reset(0);
+
+    // Written on change only
+    int calls = hw.backlight_calls;
+    app_disp_power_set_brightness(BRIGHTNESS, 1 * S);
+    app_disp_power_set_brightness(BRIGHTNESS, 2 * S);
+    CHECK(hw.backlight_calls == calls);
+    app_disp_power_set_brightness(40, 3 * S);
+    CHECK(hw.backlight == 40 && hw.backlight_calls == calls + 1);
+
+    // Dimmed or asleep, a new setting waits for the wake
+    app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS);
+    calls = hw.backlight_calls;
+    app_disp_power_set_brightness(60, APP_DISP_POWER_DIM_MS * MS + 1);
+    CHECK(hw.backlight_calls == calls && hw.backlight == APP_DISP_POWER_DIM_PCT);
+    app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS);
+    app_disp_power_set_brightness(70, APP_DISP_POWER_SLEEP_MS * MS + 1);
+    CHECK(hw.backlight == 0);
+    app_disp_power_activity(APP_DISP_POWER_SLEEP_MS * MS + 2);
+    CHECK(hw.backlight == 70);
+
+    // A setting under the dimmed level stays as it is when dimming
+    reset(0);
+    app_disp_power_set_brightness(APP_DISP_POWER_DIM_PCT / 2, 0);
+    calls = hw.backlight_calls;
+    app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS);
+    CHECK(hw.backlight == APP_DISP_POWER_DIM_PCT / 2 && hw.backlight_calls == calls);
+}
+
+static void test_stats(void) {
+
+    app_disp_power_stats_t s;
+    const int64_t end = APP_DISP_POWER_SLEEP_MS * MS + 60 * S;
+
+    // On until the dim, dimmed until the sleep, asleep for a minute
+    reset(0);
+    app_disp_power_poll(APP_DISP_POWER_DIM_MS * MS);
+    app_disp_power_poll(APP_DISP_POWER_SLEEP_MS * MS);
+    app_disp_power_get_stats(&s, end);
+    CHECK(s.state == APP_DISP_POWER_SLEEP);
+    CHECK(s.state_us[APP_DISP_POWER_ON] == APP_DISP_POWER_DIM_MS * MS);
+    CHECK(s.state_us[APP_DISP_POWER_DIM] == (APP_DISP_POWER_SLEEP_MS - APP_DISP_POWER_DIM_MS) * MS);
+    CHECK(s.state_us[APP_DISP_POWER_SLEEP] == 60 * S);
+    CHECK(s.dims == 1 && s.sleeps == 1 && s.wakes == 0 && s.backlight_writes == 3);
+    CHECK(s.current_ua == APP_DISP_POWER_PANEL_SLEEP_UA);
+
+    // Mean current, worked out by hand
+    uint64_t on_ua = APP_DISP_POWER_PANEL_UA + (uint64_t)APP_DISP_POWER_BL_FULL_UA * BRIGHTNESS / 100;
+    uint64_t dim_ua = APP_DISP_POWER_PANEL_UA + (uint64_t)APP_DISP_POWER_BL_FULL_UA * APP_DISP_POWER_DIM_PCT / 100;
+    uint64_t charge = on_ua * s.state_us[APP_DISP_POWER_ON] + dim_ua * s.state_us[APP_DISP_POWER_DIM] +
+                      (uint64_t)APP_DISP_POWER_PANEL_SLEEP_UA * s.state_us[APP_DISP_POWER_SLEEP];
+    CHECK(s.mean_ua == charge / end);
+    CHECK(s.mean_ua < on_ua);
+
+    // Awake again
+    app_disp_power_activity(end);
+    app_disp_power_get_stats(&s, end + 1 * S);
+    CHECK(s.state == APP_DISP_POWER_ON && s.wakes == 1);
+    CHECK(s.state_us[APP_DISP_POWER_ON] == (APP_DISP_POWER_DIM_MS * MS) + 1 * S);
+    CHECK(s.current_ua == on_ua);
+
+    printf("test_disp_power: on %lu uA, dimmed %lu uA, asleep %lu uA; %d/%d/60 s on/dim/sleep averages %lu uA\n",
+           (unsigned long)on_ua, (unsigned long)dim_ua, (unsigned long)APP_DISP_POWER_PANEL_SLEEP_UA,
+           APP_DISP_POWER_DIM_MS / 1000, (APP_DISP_POWER_SLEEP_MS - APP_DISP_POWER_DIM_MS) / 1000,
+           (unsigned long)(charge / end));
+}
+
+int main(void) {
+    test_timeouts();
+    test_wake();
+    test_brightness();
+    test_stats();
+
+    if (failures) {
+        printf("test_disp_power: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("test_disp_power: all passed\n");
+    return 0;
+}
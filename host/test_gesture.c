@@ -0,0 +1,260 @@
+/*
+ * @file test_gesture.c
+ * @brief Host unit tests for the compiled gesture matcher (main/app_gesture.c), with emphasis on
+ *        overlapping sequences where the matcher has to fall back to a shorter prefix instead of restarting.
+ *
+ */
+
+#include <stdio.h>
+#include "app_include/app_gesture.h"
+
+#define A   APP_GESTURE_SYM_TAP_A
+#define B   APP_GESTURE_SYM_TAP_B
+#define AA  APP_GESTURE_SYM_DOUBLE_A
+#define BB  APP_GESTURE_SYM_DOUBLE_B
+#define LA  APP_GESTURE_SYM_LONG_A
+#define CH  APP_GESTURE_SYM_CHORD_AB
+
+#define STEP_US 100000  // Comfortably inside APP_GESTURE_TIMEOUT_US
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static int64_t now_us = 0;
+
+/*---------------------------------------------------------------
+    Feed a symbol string, return the last non-NONE result and the
+    number of gestures reported along the way
+---------------------------------------------------------------*/
+static int feed_seq(app_gesture_matcher_t * m, const app_gesture_sym_t * seq, int len, int * count) {
+    int last = APP_GESTURE_NONE;
+    int n = 0;
+    for (int i = 0; i < len; i++) {
+        now_us += STEP_US;
+        int id = app_gesture_feed(m, seq[i], now_us);
+        if (id != APP_GESTURE_NONE) {
+            last = id;
+            n++;
+        }
+    }
+    if (count) {
+        *count = n;
+    }
+    return last;
+}
+
+#define FEED(m, count, ...) feed_seq((m), (const app_gesture_sym_t[]){__VA_ARGS__}, \
+                                     sizeof((app_gesture_sym_t[]){__VA_ARGS__}) / sizeof(app_gesture_sym_t), (count))
+
+// The two combos the remote shipped with (A A B, A B B), plus their double click spellings and the chord
+enum { G_ON_OFF = 10, G_CHANNEL = 20, G_SWAP = 30 };
+static const app_gesture_def_t remote_table[] = {
+    {G_ON_OFF,  "on off",      3, {A, A, B}},
+    {G_ON_OFF,  "on off",      2, {AA, B}},
+    {G_CHANNEL, "change chan", 3, {A, B, B}},
+    {G_CHANNEL, "change chan", 2, {A, BB}},
+    {G_SWAP,    "swap image",  1, {CH}},
+};
+#define REMOTE_TABLE_LEN (int)(sizeof(remote_table) / sizeof(remote_table[0]))
+
+static void test_basic_match(void) {
+    app_gesture_matcher_t m;
+    int n;
+    CHECK(app_gesture_compile(&m, remote_table, REMOTE_TABLE_LEN) == ESP_OK);
+    CHECK(FEED(&m, &n, A, A, B) == G_ON_OFF && n == 1);
+    CHECK(FEED(&m, &n, A, B, B) == G_CHANNEL && n == 1);
+    CHECK(FEED(&m, &n, AA, B) == G_ON_OFF && n == 1);
+    CHECK(FEED(&m, &n, A, BB) == G_CHANNEL && n == 1);
+    CHECK(FEED(&m, &n, CH) == G_SWAP && n == 1);
+    CHECK(strcmp(app_gesture_name(&m, G_CHANNEL), "change chan") == 0);
+    CHECK(strcmp(app_gesture_name(&m, 99), "?") == 0);
+}
+
+static void test_overlap_fallback(void) {
+    app_gesture_matcher_t m;
+    int n;
+    CHECK(app_gesture_compile(&m, remote_table, REMOTE_TABLE_LEN) == ESP_OK);
+
+    // A A A B: the third A must not restart the match, A A B is still a suffix
+    CHECK(FEED(&m, &n, A, A, A, B) == G_ON_OFF && n == 1);
+    // B A B B: leading noise, then A B B
+    CHECK(FEED(&m, &n, B, A, B, B) == G_CHANNEL && n == 1);
+    // A B A A B: A B fails on A, falls back to A, then A A B
+    CHECK(FEED(&m, &n, A, B, A, A, B) == G_ON_OFF && n == 1);
+    // Matcher resets after a match, so the trailing B of A A B does not start A B B
+    CHECK(FEED(&m, &n, A, A, B, B) == G_ON_OFF && n == 1);
+    CHECK(m.state == 0);
+}
+
+static void test_overlap_across_patterns(void) {
+    // The second pattern starts in the middle of the first: A B A B must report B A B
+    static const app_gesture_def_t defs[] = {
+        {1, "abl", 3, {A, B, LA}},
+        {2, "bab", 3, {B, A, B}},
+    };
+    app_gesture_matcher_t m;
+    int n;
+    CHECK(app_gesture_compile(&m, defs, 2) == ESP_OK);
+    CHECK(FEED(&m, &n, A, B, A, B) == 2 && n == 1);
+    CHECK(FEED(&m, &n, A, B, LA) == 1 && n == 1);
+    CHECK(FEED(&m, &n, B, A, B, LA) == 2 && n == 1);   // Reset after B A B, the LA is noise
+    CHECK(m.state == 0);
+}
+
+static void test_compile_rejects_conflicts(void) {
+    app_gesture_matcher_t m;
+
+    // One sequence is a prefix of another, in both orders
+    static const app_gesture_def_t prefix_first[] = { {1, "a", 2, {A, A}}, {2, "b", 3, {A, A, B}} };
+    static const app_gesture_def_t prefix_last[]  = { {1, "a", 3, {A, A, B}}, {2, "b", 2, {A, A}} };
+    CHECK(app_gesture_compile(&m, prefix_first, 2) == ESP_ERR_INVALID_ARG);
+    CHECK(app_gesture_compile(&m, prefix_last, 2) == ESP_ERR_INVALID_ARG);
+
+    // One sequence is contained in the middle of another
+    static const app_gesture_def_t infix[] = { {1, "a", 4, {B, A, B, B}}, {2, "b", 2, {A, B}} };
+    CHECK(app_gesture_compile(&m, infix, 2) == ESP_ERR_INVALID_ARG);
+
+    // Suffix containment is fine, the longer sequence wins when both complete on the same symbol
+    static const app_gesture_def_t suffix[] = { {1, "a", 3, {B, A, B}}, {2, "b", 2, {A, B}} };
+    CHECK(app_gesture_compile(&m, suffix, 2) == ESP_OK);
+    CHECK(FEED(&m, NULL, B, A, B) == 1);
+
+    // Same sequence twice: fine for the same id, ambiguous for different ids
+    static const app_gesture_def_t dup_same[] = { {1, "a", 2, {A, B}}, {1, "a", 2, {A, B}} };
+    static const app_gesture_def_t dup_diff[] = { {1, "a", 2, {A, B}}, {2, "b", 2, {A, B}} };
+    CHECK(app_gesture_compile(&m, dup_same, 2) == ESP_OK);
+    CHECK(app_gesture_compile(&m, dup_diff, 2) == ESP_ERR_INVALID_ARG);
+
+    // Bad lengths
+    static const app_gesture_def_t empty[] = { {1, "a", 0, {A}} };
+    static const app_gesture_def_t too_long[] = { {1, "a", APP_GESTURE_MAX_LENGTH + 1, {A}} };
+    CHECK(app_gesture_compile(&m, empty, 1) == ESP_ERR_INVALID_ARG);
+    CHECK(app_gesture_compile(&m, too_long, 1) == ESP_ERR_INVALID_ARG);
+}
+
+static void test_state_budget(void) {
+    // All 81 sequences of length 4 over 3 symbols need far more states than the budget
+    static app_gesture_def_t defs[81];
+    int num = 0;
+    for (int i = 0; i < 81; i++) {
+        defs[num] = (app_gesture_def_t){ i, "x", 4, {i % 3, (i / 3) % 3, (i / 9) % 3, (i / 27) % 3} };
+        num++;
+    }
+    app_gesture_matcher_t m;
+    CHECK(app_gesture_compile(&m, defs, num) == ESP_ERR_NO_MEM);
+}
+
+static void test_timeout(void) {
+    app_gesture_matcher_t m;
+    CHECK(app_gesture_compile(&m, remote_table, REMOTE_TABLE_LEN) == ESP_OK);
+
+    now_us += STEP_US;
+    CHECK(app_gesture_feed(&m, A, now_us) == APP_GESTURE_NONE);
+    now_us += STEP_US;
+    CHECK(app_gesture_feed(&m, A, now_us) == APP_GESTURE_NONE);
+    now_us += APP_GESTURE_TIMEOUT_US + 1;   // Too slow, A A is abandoned
+    CHECK(app_gesture_feed(&m, B, now_us) == APP_GESTURE_NONE);
+
+    // A slow A restarts from itself rather than from nothing
+    now_us += STEP_US;
+    CHECK(app_gesture_feed(&m, A, now_us) == APP_GESTURE_NONE);
+    now_us += APP_GESTURE_TIMEOUT_US + 1;
+    CHECK(app_gesture_feed(&m, A, now_us) == APP_GESTURE_NONE);
+    now_us += APP_GESTURE_TIMEOUT_US;       // Exactly on the limit still counts
+    CHECK(app_gesture_feed(&m, A, now_us) == APP_GESTURE_NONE);
+    now_us += STEP_US;
+    CHECK(app_gesture_feed(&m, B, now_us) == G_ON_OFF);
+}
+
+static void test_chord(void) {
+    app_gesture_matcher_t m;
+    CHECK(app_gesture_compile(&m, remote_table, REMOTE_TABLE_LEN) == ESP_OK);
+    app_gesture_reset(&m);
+
+    // A down, B down -> chord. Both taps that follow belong to the chord and are swallowed.
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_A, true, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_B, true, now_us += STEP_US) == G_SWAP);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_A, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_B, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_press(&m, APP_GESTURE_KEY_A, 1, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_press(&m, APP_GESTURE_KEY_B, 1, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(m.chord_mask == 0);
+
+    // The swallowed taps left no partial sequence behind, a lone B goes nowhere
+    CHECK(app_gesture_feed_press(&m, APP_GESTURE_KEY_B, 1, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(m.state == 0);
+
+    // Regular taps through the same entry points
+    CHECK(app_gesture_feed_press(&m, APP_GESTURE_KEY_A, 2, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_press(&m, APP_GESTURE_KEY_B, 1, false, now_us += STEP_US) == G_ON_OFF);
+
+    // Holding one key alone never makes a chord
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_A, true, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_A, false, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_B, true, now_us += STEP_US) == APP_GESTURE_NONE);
+    CHECK(app_gesture_feed_switch(&m, APP_GESTURE_KEY_B, false, now_us += STEP_US) == APP_GESTURE_NONE);
+}
+
+// Mirrors what the input task does with each switch edge and classified press
+typedef struct {
+    bool is_edge;
+    uint8_t key;
+    bool pressed;
+    bool long_press;
+    uint8_t clicks;
+    int64_t timestamp_us;
+} input_t;
+
+static void test_input_stream(void) {
+    app_gesture_matcher_t m;
+    CHECK(app_gesture_compile(&m, remote_table, REMOTE_TABLE_LEN) == ESP_OK);
+    app_gesture_reset(&m);
+
+    // Edges and classified presses interleaved as the input task sees them
+    const input_t stream[] = {
+        {true,  APP_GESTURE_KEY_A, true,  false, 0, 1000000},
+        {true,  APP_GESTURE_KEY_A, false, false, 0, 1080000},
+        {false, APP_GESTURE_KEY_A, false, false, 1, 1330000},
+        {true,  APP_GESTURE_KEY_B, true,  false, 0, 1500000},
+        {false, APP_GESTURE_KEY_B, false, true,  0, 2100000},   // Long press, not part of any combo
+        {true,  APP_GESTURE_KEY_B, false, false, 0, 2300000},
+        {false, APP_GESTURE_KEY_A, false, false, 1, 2600000},
+        {false, APP_GESTURE_KEY_B, false, false, 2, 2900000},
+    };
+    int last = APP_GESTURE_NONE;
+    int n = 0;
+    for (unsigned i = 0; i < sizeof(stream) / sizeof(stream[0]); i++) {
+        const input_t * in = &stream[i];
+        int id = in->is_edge ? app_gesture_feed_switch(&m, in->key, in->pressed, in->timestamp_us)
+                             : app_gesture_feed_press(&m, in->key, in->clicks, in->long_press, in->timestamp_us);
+        if (id != APP_GESTURE_NONE) {
+            last = id;
+            n++;
+        }
+    }
+    CHECK(last == G_CHANNEL && n == 1);
+}
+
+int main(void) {
+    test_basic_match();
+    test_overlap_fallback();
+    test_overlap_across_patterns();
+    test_compile_rejects_conflicts();
+    test_state_budget();
+    test_timeout();
+    test_chord();
+    test_input_stream();
+
+    if (failures) {
+        printf("test_gesture: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("test_gesture: all passed\n");
+    return 0;
+}
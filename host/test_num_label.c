@@ -0,0 +1,159 @@
+/*
+ * @file test_num_label.c
+ * @brief Host unit tests for the number labels (main/app_num_label.c) on host LVGL: integer and fixed point
+ *        formatting (zero, negatives under one, INT32_MIN, clamped decimals), the prefix/space/number/suffix
+ *        layout, the unchanged text skip and the lv_label_set_text() fallback for texts over the buffer.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "app_include/app_num_label.h"
+
+#define HOR_RES         320
+#define VER_RES         240
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+#define CHECK_TEXT(nl, expect) do { \
+    const char * got = lv_label_get_text((nl)->label); \
+    if (strcmp(got, (expect)) != 0) { \
+        printf("FAIL %s:%d: \"%s\", expected \"%s\"\n", __FILE__, __LINE__, got, (expect)); \
+        failures++; \
+    } \
+} while (0)
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+    lv_disp_flush_ready(disp_drv);
+}
+
+static app_num_label_t nl;
+
+static void test_format(void) {
+
+    app_num_label_set(&nl, NULL, 0, 0, NULL);
+    CHECK_TEXT(&nl, "0");
+    app_num_label_set(&nl, NULL, 0, 2, NULL);
+    CHECK_TEXT(&nl, "0.00");
+    app_num_label_set(&nl, NULL, 370, 2, NULL);
+    CHECK_TEXT(&nl, "3.70");
+    app_num_label_set(&nl, NULL, -30, 0, NULL);
+    CHECK_TEXT(&nl, "-30");
+
+    // Negative under one: sign before the leading zero
+    app_num_label_set(&nl, NULL, -5, 2, NULL);
+    CHECK_TEXT(&nl, "-0.05");
+    app_num_label_set(&nl, NULL, -5, 1, NULL);
+    CHECK_TEXT(&nl, "-0.5");
+
+    // Whole 32 bit range
+    app_num_label_set(&nl, NULL, INT32_MIN, 0, NULL);
+    CHECK_TEXT(&nl, "-2147483648");
+    app_num_label_set(&nl, NULL, INT32_MAX, 0, NULL);
+    CHECK_TEXT(&nl, "2147483647");
+    app_num_label_set(&nl, NULL, INT32_MIN, 2, NULL);
+    CHECK_TEXT(&nl, "-21474836.48");
+
+    // Decimals beyond the maximum are clamped, not overflowed
+    app_num_label_set(&nl, NULL, INT32_MIN, APP_NUM_LABEL_MAX_DECIMALS, NULL);
+    CHECK_TEXT(&nl, "-2.147483648");
+    app_num_label_set(&nl, NULL, -1, 200, NULL);
+    CHECK_TEXT(&nl, "-0.000000001");
+    app_num_label_set(&nl, NULL, 7, 255, NULL);
+    CHECK_TEXT(&nl, "0.000000007");
+}
+
+static void test_layout(void) {
+
+    // Prefix, a space, the number, the suffix straight after
+    app_num_label_set(&nl, "Az", 12, 0, "deg");
+    CHECK_TEXT(&nl, "Az 12deg");
+    app_num_label_set(&nl, LV_SYMBOL_BATTERY_EMPTY, 412, 2, "V");
+    CHECK_TEXT(&nl, LV_SYMBOL_BATTERY_EMPTY " 4.12V");
+
+    // No space for an empty or missing prefix
+    app_num_label_set(&nl, "", 5, 0, "%");
+    CHECK_TEXT(&nl, "5%");
+    app_num_label_set(&nl, NULL, 6, 0, "");
+    CHECK_TEXT(&nl, "6");
+}
+
+static void test_updates(void) {
+
+    app_num_label_stats_t s;
+
+    app_num_label_set(&nl, NULL, 1, 0, NULL);
+    app_num_label_reset_stats();
+
+    // Same text: nothing done, the label still shows its own buffer
+    app_num_label_set(&nl, NULL, 1, 0, NULL);
+    app_num_label_set(&nl, NULL, 10, 1, NULL);      // "1.0" differs from "1"
+    app_num_label_set(&nl, NULL, 10, 1, NULL);
+    app_num_label_get_stats(&s);
+    CHECK(s.updates == 3 && s.unchanged == 2 && s.invalidations == 1 && s.allocations == 0);
+    CHECK(lv_label_get_text(nl.label) == nl.text);
+
+    // The longest text the buffer holds (15 bytes) stays static
+    app_num_label_set(&nl, "Battery", 412, 2, "V!");
+    CHECK_TEXT(&nl, "Battery 4.12V!");
+    app_num_label_set(&nl, "Battery:", 412, 2, "V!");
+    CHECK_TEXT(&nl, "Battery: 4.12V!");
+    CHECK(lv_label_get_text(nl.label) == nl.text);
+    app_num_label_get_stats(&s);
+    CHECK(s.allocations == 0);
+
+    // Over 16 bytes: copied into the LVGL heap, and never taken for unchanged afterwards
+    app_num_label_set(&nl, "Battery voltage", 412, 2, "V");
+    CHECK_TEXT(&nl, "Battery voltage 4.12V");
+    CHECK(lv_label_get_text(nl.label) != nl.text);
+    app_num_label_set(&nl, "Battery voltage", 412, 2, "V");
+    CHECK_TEXT(&nl, "Battery voltage 4.12V");
+    app_num_label_get_stats(&s);
+    CHECK(s.allocations == 2 && s.unchanged == 2);
+
+    // Back to the static buffer once it fits again
+    app_num_label_set(&nl, NULL, 3, 0, NULL);
+    CHECK_TEXT(&nl, "3");
+    CHECK(lv_label_get_text(nl.label) == nl.text);
+    app_num_label_get_stats(&s);
+    CHECK(s.allocations == 2 && s.invalidations == 6);
+}
+
+int main(void) {
+
+    static lv_color_t buf[HOR_RES * 10];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * 10);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    lv_disp_drv_register(&disp_drv);
+
+    app_num_label_init(&nl, lv_label_create(lv_scr_act()));
+    CHECK_TEXT(&nl, "");
+
+    test_format();
+    test_layout();
+    test_updates();
+
+    if (failures) {
+        printf("test_num_label: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("test_num_label: all passed\n");
+    return 0;
+}
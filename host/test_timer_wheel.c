@@ -0,0 +1,294 @@
+/*
+ * @file test_timer_wheel.c
+ * @brief Host unit tests for the hierarchical timer wheel (main/app_timer_wheel.c), driven by a fake clock the same
+ *        way app_timer.c drives it from the gptimer: sleep until app_timer_wheel_next(), advance, pop, repeat.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "app_include/app_timer_wheel.h"
+
+#define NUM_TIMERS  500
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    app_timer_t timer;
+    uint64_t due;           // Expected expiry tick, mirrors timer.expires
+    uint64_t fired_at;      // Clock when it was popped
+    int fired;
+    bool armed;             // Reference model of timer.armed
+} probe_t;
+
+static app_timer_wheel_t wheel;
+static uint64_t clock_tick;
+static probe_t probes[NUM_TIMERS];
+static int wakeups;
+
+static void probe_cb(void * arg) {
+    probe_t * probe = (probe_t *)arg;
+    probe->fired++;
+    probe->fired_at = clock_tick;
+    probe->armed = false;
+}
+
+static void arm(probe_t * probe, uint64_t due, uint32_t period) {
+    probe->timer.cb = probe_cb;
+    probe->timer.arg = probe;
+    probe->timer.expires = due;
+    probe->timer.period = period;
+    probe->due = due;
+    probe->armed = true;
+    app_timer_wheel_add(&wheel, &probe->timer);
+}
+
+static void reset(uint64_t start) {
+    app_timer_wheel_init(&wheel, start);
+    clock_tick = start;
+    wakeups = 0;
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        probe_t * probe = &probes[i];
+        *probe = (probe_t){0};
+    }
+}
+
+/*---------------------------------------------------------------
+    One service pass at the current clock, as the timer task does
+---------------------------------------------------------------*/
+static void service(void) {
+    app_timer_t * timer;
+    wakeups++;
+    app_timer_wheel_advance(&wheel, clock_tick);
+    while ((timer = app_timer_wheel_pop(&wheel)) != NULL) {
+        CHECK(timer->expires <= clock_tick);
+        if (timer->period) {
+            timer->expires += timer->period;
+            ((probe_t *)timer->arg)->due = timer->expires;
+            app_timer_wheel_add(&wheel, timer);
+        }
+        timer->cb(timer->arg);
+        if (timer->period) {
+            ((probe_t *)timer->arg)->armed = true;
+        }
+    }
+}
+
+// Earliest expiry of the reference model
+static uint64_t model_next(void) {
+    uint64_t next = APP_TIMER_NEVER;
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        if (probes[i].armed && probes[i].due < next) {
+            next = probes[i].due;
+        }
+    }
+    return next;
+}
+
+/*---------------------------------------------------------------
+    Timers on every level boundary, including beyond the wheel's
+    range, fire exactly on their tick when the clock only ever
+    jumps to app_timer_wheel_next()
+---------------------------------------------------------------*/
+static void test_boundaries(void) {
+
+    static const uint64_t delays[] = {
+        0, 1, 2, 62, 63, 64, 65, 127, 128, 4095, 4096, 4097, 262143, 262144, 262145,
+        APP_TIMER_WHEEL_RANGE - 1, APP_TIMER_WHEEL_RANGE, APP_TIMER_WHEEL_RANGE * 3 + 17
+    };
+    const int count = sizeof(delays) / sizeof(delays[0]);
+
+    for (uint64_t start = 0; start < 200; start += 37) {
+        reset(start * 1000 + start);
+        for (int i = 0; i < count; i++) {
+            arm(&probes[i], clock_tick + delays[i], 0);
+        }
+        while (1) {
+            uint64_t next = app_timer_wheel_next(&wheel);
+            if (next == APP_TIMER_NEVER) {
+                break;
+            }
+            CHECK(next <= model_next());    // Never sleeps past a deadline
+            clock_tick = next;
+            service();
+        }
+        for (int i = 0; i < count; i++) {
+            CHECK(probes[i].fired == 1);
+            CHECK(probes[i].fired_at == probes[i].due);
+        }
+        CHECK(wakeups < count * 8);         // Idle stretches are skipped, not ticked through
+    }
+}
+
+/*---------------------------------------------------------------
+    Late wakeups: the clock lands anywhere, timers fire at the
+    first service at or after their tick, in expiry order
+---------------------------------------------------------------*/
+static void test_late_wakeups(void) {
+
+    reset(5);
+    for (int i = 0; i < 300; i++) {
+        arm(&probes[i], clock_tick + (uint64_t)(i * 37 % 5000), 0);
+    }
+
+    uint64_t last_fired = 0;
+    srand(7);
+    while (app_timer_wheel_next(&wheel) != APP_TIMER_NEVER) {
+        clock_tick += 1 + rand() % 300;
+        app_timer_t * timer;
+        app_timer_wheel_advance(&wheel, clock_tick);
+        while ((timer = app_timer_wheel_pop(&wheel)) != NULL) {
+            CHECK(timer->expires <= clock_tick);
+            CHECK(timer->expires >= last_fired);
+            last_fired = timer->expires;
+            timer->cb(timer->arg);
+        }
+    }
+    for (int i = 0; i < 300; i++) {
+        CHECK(probes[i].fired == 1);
+        CHECK(probes[i].fired_at >= probes[i].due && probes[i].fired_at < probes[i].due + 300);
+    }
+}
+
+/*---------------------------------------------------------------
+    Cancel and re-arm, including a timer that already expired in
+    the same batch but has not been popped yet
+---------------------------------------------------------------*/
+static void test_cancel(void) {
+
+    reset(1000);
+    arm(&probes[0], 1010, 0);
+    arm(&probes[1], 1010, 0);
+    arm(&probes[2], 1020, 0);
+    arm(&probes[3], 5000, 0);
+
+    app_timer_wheel_remove(&wheel, &probes[2].timer);
+    probes[2].armed = false;
+    app_timer_wheel_remove(&wheel, &probes[2].timer);   // Twice is harmless
+    CHECK(!probes[2].timer.armed);
+
+    clock_tick = 1010;
+    app_timer_wheel_advance(&wheel, clock_tick);
+    app_timer_t * first = app_timer_wheel_pop(&wheel);  // Order within one tick is unspecified
+    probe_t * other = (first == &probes[0].timer) ? &probes[1] : &probes[0];
+    CHECK(first == &probes[0].timer || first == &probes[1].timer);
+    CHECK(other->timer.armed);                          // Due, still cancellable
+    app_timer_wheel_remove(&wheel, &other->timer);
+    other->armed = false;
+    CHECK(app_timer_wheel_pop(&wheel) == NULL);
+    first->cb(first->arg);
+
+    // Re-arming a due timer moves it back into the wheel
+    arm(other, 1015, 0);
+    clock_tick = 1030;
+    service();
+    CHECK(probes[0].fired + probes[1].fired == 2);      // One from the batch, plus the re-armed one
+    CHECK(probes[2].fired == 0);
+
+    // Pulling a far timer in and pushing a near one out
+    arm(&probes[3], 1040, 0);
+    arm(&probes[0], 400000, 0);
+    CHECK(app_timer_wheel_next(&wheel) == 1040);
+    clock_tick = 1040;
+    service();
+    CHECK(probes[3].fired == 1);
+    CHECK(probes[0].timer.armed);
+}
+
+/*---------------------------------------------------------------
+    Periodic timers keep their phase
+---------------------------------------------------------------*/
+static void test_periodic(void) {
+
+    reset(0);
+    arm(&probes[0], 10, 10);
+    arm(&probes[1], 7, 1000);
+    while (clock_tick < 100000) {
+        clock_tick = app_timer_wheel_next(&wheel);
+        service();
+        CHECK(probes[0].fired_at % 10 == 0);
+    }
+    CHECK(probes[0].fired >= 9999 && probes[0].fired <= 10000);
+    CHECK(probes[1].fired == 100);
+}
+
+/*---------------------------------------------------------------
+    Random arm/cancel/re-arm against the reference model
+---------------------------------------------------------------*/
+static void test_random(void) {
+
+    static const uint64_t spans[] = {64, 4096, 262144, APP_TIMER_WHEEL_RANGE};
+    uint64_t end = 2000000;
+
+    reset(123456);
+    srand(12345);
+
+    while (clock_tick < end) {
+        for (int n = rand() % 8; n > 0; n--) {
+            probe_t * probe = &probes[rand() % NUM_TIMERS];
+            int op = rand() % 4;
+            if (op == 0 && probe->armed) {
+                app_timer_wheel_remove(&wheel, &probe->timer);
+                probe->armed = false;
+            }
+            else {
+                uint64_t span = spans[rand() % 4];
+                uint64_t delay = ((uint64_t)rand() * 65536u + (uint64_t)rand()) % span;
+                probe->fired = 0;
+                arm(probe, clock_tick + delay, 0);
+            }
+        }
+
+        uint64_t next = app_timer_wheel_next(&wheel);
+        uint64_t want = model_next();
+        if (want < wheel.now) {
+            want = wheel.now;   // Armed for a tick already processed, due on the next one
+        }
+        CHECK(next <= want);
+        if (next == APP_TIMER_NEVER) {
+            clock_tick += 1000;
+            continue;
+        }
+        // Mostly on time, sometimes late like a busy system
+        clock_tick = (rand() % 4) ? next : next + rand() % 50;
+        service();
+
+        for (int i = 0; i < NUM_TIMERS; i++) {
+            if (probes[i].armed) {
+                CHECK(probes[i].timer.armed);
+                CHECK(probes[i].due > clock_tick);
+            }
+            if (probes[i].fired) {
+                CHECK(probes[i].fired == 1);
+                CHECK(probes[i].fired_at >= probes[i].due);
+            }
+        }
+        if (failures) {
+            break;
+        }
+    }
+    printf("random: %d wakeups over %llu ticks\n", wakeups, (unsigned long long)(end - 123456));
+}
+
+int main(void) {
+
+    test_boundaries();
+    test_late_wakeups();
+    test_cancel();
+    test_periodic();
+    test_random();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All timer wheel tests passed\n");
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * @file test_ui_cmd.c
+ * @brief Host unit tests for the UI command queue (main/app_ui_cmd.c): collapsing to the latest value per target,
+ *        the drop on a full queue, the per drain bound, and several producer threads posting against a draining
+ *        consumer with nothing lost, duplicated or applied out of order.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "app_include/app_ui_cmd.h"
+
+#define PRODUCERS       4
+#define POSTS           20000   // Per producer
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+// What the consumer was given
+static struct {
+    int calls;
+    int32_t value[APP_UI_CMD_NUM_TYPES][APP_UI_CMD_MAX_TARGETS];
+    int count[APP_UI_CMD_NUM_TYPES][APP_UI_CMD_MAX_TARGETS];
+    int last_key;
+    bool in_order;              // Keys ascending within each drain
+} got;
+
+static void record(app_ui_cmd_type_t type, uint8_t target, int32_t value) {
+    int key = type * APP_UI_CMD_MAX_TARGETS + target;
+    got.in_order &= (key > got.last_key);
+    got.last_key = key;
+    got.calls++;
+    got.value[type][target] = value;
+    got.count[type][target]++;
+}
+
+static uint32_t drain(void) {
+    got.last_key = -1;
+    return app_ui_cmd_drain(record);
+}
+
+static void reset(void) {
+    app_ui_cmd_init();
+    memset(&got, 0, sizeof(got));
+    got.in_order = true;
+}
+
+static void test_collapse(void) {
+
+    app_ui_cmd_stats_t s;
+
+    reset();
+    CHECK(drain() == 0 && got.calls == 0);
+
+    // Three moves of one target and one of another: two applies, latest values
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 2, 10));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 0, 5));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 2, 11));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 2, 12));
+    CHECK(drain() == 4);
+    CHECK(got.calls == 2 && got.in_order);
+    CHECK(got.value[APP_UI_CMD_SET_VALUE][2] == 12 && got.count[APP_UI_CMD_SET_VALUE][2] == 1);
+    CHECK(got.value[APP_UI_CMD_SET_VALUE][0] == 5);
+
+    // Same target number, different types: separate keys
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SHOW_SCREEN, 1, 0));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_STATE, 1, 1));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 1, -7));
+    CHECK(app_ui_cmd_post(APP_UI_CMD_SHOW_SCREEN, 1, 1));
+    CHECK(drain() == 4);
+    CHECK(got.calls == 5 && got.in_order);
+    CHECK(got.value[APP_UI_CMD_SHOW_SCREEN][1] == 1 && got.value[APP_UI_CMD_SET_VALUE][1] == -7);
+
+    // Nothing left over
+    CHECK(drain() == 0 && got.calls == 5);
+
+    app_ui_cmd_get_stats(&s);
+    CHECK(s.posted == 8 && s.drained == 8 && s.applied == 5 && s.collapsed == 3);
+    CHECK(s.batches == 2 && s.max_batch == 4 && s.dropped == 0);
+
+    // Malformed commands are refused, not counted as drops
+    CHECK(!app_ui_cmd_post(APP_UI_CMD_NUM_TYPES, 0, 0));
+    CHECK(!app_ui_cmd_post(APP_UI_CMD_SET_VALUE, APP_UI_CMD_MAX_TARGETS, 0));
+    app_ui_cmd_get_stats(&s);
+    CHECK(s.posted == 8 && s.dropped == 0);
+}
+
+static void test_full(void) {
+
+    app_ui_cmd_stats_t s;
+
+    // Fills, then refuses and counts
+    reset();
+    for (int i = 0; i < APP_UI_CMD_QUEUE_LEN; i++) {
+        CHECK(app_ui_cmd_post(APP_UI_CMD_SET_VALUE, i % APP_UI_CMD_MAX_TARGETS, i));
+    }
+    CHECK(!app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 0, -1));
+    CHECK(!app_ui_cmd_post(APP_UI_CMD_SET_VALUE, 0, -2));
+    app_ui_cmd_get_stats(&s);
+    CHECK(s.posted == APP_UI_CMD_QUEUE_LEN && s.dropped == 2);
+
+    // The refused commands never arrive, the last accepted ones do
+    CHECK(drain() == APP_UI_CMD_QUEUE_LEN);
+    CHECK(got.calls == APP_UI_CMD_MAX_TARGETS);
+    CHECK(got.value[APP_UI_CMD_SET_VALUE][0] == APP_UI_CMD_QUEUE_LEN - APP_UI_CMD_MAX_TARGETS);
+    app_ui_cmd_get_stats(&s);
+    CHECK(s.high_water == APP_UI_CMD_QUEUE_LEN);
+
+    // Room again, and the ring wraps cleanly for several laps
+    for (int lap = 0; lap < 5; lap++) {
+        for (int i = 0; i < APP_UI_CMD_QUEUE_LEN - 1; i++) {
+            CHECK(app_ui_cmd_post(APP_UI_CMD_SET_STATE, 3, lap * 1000 + i));
+        }
+        CHECK(drain() == APP_UI_CMD_QUEUE_LEN - 1);
+        CHECK(got.value[APP_UI_CMD_SET_STATE][3] == lap * 1000 + APP_UI_CMD_QUEUE_LEN - 2);
+    }
+}
+
+/*---------------------------------------------------------------
+    Producers post increasing values to a target of their own,
+    retrying when the queue is full; the consumer drains as fast
+    as it can, yielding when it finds nothing. Every drain must
+    move each target forward, and end on the last value posted
+---------------------------------------------------------------*/
+static volatile int producers_done;
+
+static void * producer(void * arg) {
+    uint8_t target = (uint8_t)(uintptr_t)arg;
+    for (int32_t v = 1; v <= POSTS; v++) {
+        while (!app_ui_cmd_post(APP_UI_CMD_SET_VALUE, target, v)) {
+            sched_yield();
+        }
+    }
+    __atomic_add_fetch(&producers_done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static int32_t seen[PRODUCERS];
+static bool monotonic = true;
+
+static void check_order(app_ui_cmd_type_t type, uint8_t target, int32_t value) {
+    monotonic &= (type == APP_UI_CMD_SET_VALUE && target < PRODUCERS && value > seen[target]);
+    seen[target] = value;
+}
+
+static void test_threads(void) {
+
+    pthread_t threads[PRODUCERS];
+    app_ui_cmd_stats_t s;
+
+    reset();
+    producers_done = 0;
+    for (uintptr_t i = 0; i < PRODUCERS; i++) {
+        pthread_create(&threads[i], NULL, producer, (void *)i);
+    }
+    while (__atomic_load_n(&producers_done, __ATOMIC_ACQUIRE) < PRODUCERS) {
+        if (app_ui_cmd_drain(check_order) == 0) {
+            sched_yield();      // Let the producers run on a single CPU
+        }
+    }
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    while (app_ui_cmd_drain(check_order) != 0) {
+    }
+
+    app_ui_cmd_get_stats(&s);
+    CHECK(monotonic);
+    for (int i = 0; i < PRODUCERS; i++) {
+        CHECK(seen[i] == POSTS);
+    }
+    CHECK(s.posted == PRODUCERS * POSTS);
+    CHECK(s.drained == s.posted);
+    CHECK(s.applied + s.collapsed == s.drained);
+    CHECK(s.max_batch <= APP_UI_CMD_QUEUE_LEN && s.high_water <= APP_UI_CMD_QUEUE_LEN);
+
+    printf("test_ui_cmd: %d producers x %d posts, %lu applied in %lu batches (%lu collapsed), %lu retried full\n",
+           PRODUCERS, POSTS, (unsigned long)s.applied, (unsigned long)s.batches, (unsigned long)s.collapsed,
+           (unsigned long)s.dropped);
+}
+
+int main(void) {
+    test_collapse();
+    test_full();
+    test_threads();
+
+    if (failures) {
+        printf("test_ui_cmd: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("test_ui_cmd: all passed\n");
+    return 0;
+}
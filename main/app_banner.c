@@ -0,0 +1,223 @@
+/*
+ * @file app_banner.c
+ * @brief The scrolling title banner, see app_banner.h.
+ *
+ *        The strip is captured by redrawing the label through the display's own draw_ctx (glyph cache and all)
+ *        with the blend swapped for one that stores the coverage it is given instead of mixing colours, so the
+ *        strip holds exactly the masks LVGL would blend, with the label's opacity folded in. Drawn opaque in the
+ *        label's colour, it gives the label's pixels wherever glyph boxes don't overlap.
+ *
+ */
+
+#include <string.h>
+#include "app_include/app_banner.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+typedef struct {
+    lv_obj_t * label;
+    lv_obj_t * box;             // The label's parent, which draws the strip
+    lv_point_t ofs;             // Label position in the box at x = 0
+    lv_coord_t w;               // Strip size, the label's
+    lv_coord_t h;
+    lv_coord_t x;               // Current animation value
+    lv_color_t color;           // Label's text colour, as blended at capture
+    lv_opa_t * strip;           // A8, w * h. NULL: the label is animated instead
+} banner_t;
+
+static banner_t banner;
+static app_banner_stats_t stats;
+
+// Text area at animation value x
+static void text_area(lv_coord_t x, lv_area_t * area) {
+    area->x1 = banner.box->coords.x1 + banner.ofs.x + x;
+    area->y1 = banner.box->coords.y1 + banner.ofs.y;
+    area->x2 = area->x1 + banner.w - 1;
+    area->y2 = area->y1 + banner.h - 1;
+}
+
+/*---------------------------------------------------------------
+    Capture blend: store the coverage of what would be blended,
+    relative to the label's area (the clip area)
+---------------------------------------------------------------*/
+static void capture_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) {
+
+    lv_area_t area;
+    const lv_area_t * strip_area = draw_ctx->clip_area;
+
+    if (dsc->mask_res == LV_DRAW_MASK_RES_TRANSP || !_lv_area_intersect(&area, dsc->blend_area, strip_area)) {
+        return;
+    }
+    banner.color = dsc->color;
+    lv_coord_t mask_w = dsc->mask_buf ? lv_area_get_width(dsc->mask_area) : 0;
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        lv_opa_t * out = banner.strip + (y - strip_area->y1) * banner.w + (area.x1 - strip_area->x1);
+        const lv_opa_t * mask = dsc->mask_buf ?
+                                dsc->mask_buf + (y - dsc->mask_area->y1) * mask_w + (area.x1 - dsc->mask_area->x1) : NULL;
+        for (lv_coord_t x = area.x1; x <= area.x2; x++, out++) {
+            uint32_t m = mask ? *mask++ : LV_OPA_COVER;
+            if (dsc->opa < LV_OPA_MAX) {
+                m = (m * dsc->opa) >> 8;    // Folded in as lv_draw_sw_blend_basic scales the mask
+            }
+            if (m == 0) {
+                continue;
+            }
+            if (*out) {
+                stats.overlaps++;
+                m = *out + m - (*out * m + 127) / 255;      // Union of the two coverages
+            }
+            *out = m;
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Draw the label once into the strip. False if there is no
+    draw context to draw it with
+---------------------------------------------------------------*/
+static bool capture(void) {
+
+    lv_disp_t * disp = lv_obj_get_disp(banner.label);
+    lv_draw_ctx_t * draw_ctx = (disp != NULL) ? disp->driver->draw_ctx : NULL;
+    if (draw_ctx == NULL) {
+        return false;
+    }
+    lv_draw_sw_ctx_t * sw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+
+    // The letters are drawn as on a refresh of this display, the blend (and clip) are the capture's
+    lv_disp_t * refreshing = _lv_refr_get_disp_refreshing();
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    void (*blend)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) = sw_ctx->blend;
+    lv_area_t strip_area = banner.label->coords;
+
+    _lv_refr_set_disp_refreshing(disp);
+    draw_ctx->clip_area = &strip_area;
+    sw_ctx->blend = capture_blend;
+    lv_obj_redraw(draw_ctx, banner.label);
+    sw_ctx->blend = blend;
+    draw_ctx->clip_area = clip_area;
+    _lv_refr_set_disp_refreshing(refreshing);
+    return true;
+}
+
+/*---------------------------------------------------------------
+    Box DRAW_MAIN, after its background and border: the strip
+    where the label would be, clipped like the label's text
+---------------------------------------------------------------*/
+static void box_draw_cb(lv_event_t * e) {
+
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    lv_area_t text;
+    lv_area_t clip;
+
+    text_area(banner.x, &text);
+    if (!_lv_area_intersect(&clip, &text, &banner.box->coords) || !_lv_area_intersect(&clip, &clip, draw_ctx->clip_area)) {
+        return;
+    }
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &text;
+    blend_dsc.mask_area = &text;
+    blend_dsc.mask_buf = banner.strip;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    blend_dsc.color = banner.color;
+    blend_dsc.opa = LV_OPA_COVER;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    draw_ctx->clip_area = clip_area;
+}
+
+/*---------------------------------------------------------------
+    Animation step, pre-rendered: invalidate the text band where
+    the old and new positions cross the box
+---------------------------------------------------------------*/
+static void step_cb(void * var, int32_t v) {
+
+    lv_area_t band;
+    lv_area_t area;
+
+    stats.steps++;
+    if (v == banner.x) {
+        return;
+    }
+    text_area(banner.x, &band);
+    text_area(v, &area);
+    _lv_area_join(&band, &band, &area);
+    banner.x = v;
+    // lv_obj_invalidate_area() pads every area by 5 px for transformed objects, the box isn't one
+    if (_lv_area_intersect(&area, &band, &banner.box->coords) && lv_obj_is_visible(banner.box)) {
+        stats.invalidated_px += lv_area_get_size(&area);
+        _lv_inv_area(lv_obj_get_disp(banner.box), &area);
+    }
+}
+
+// Animation step, label path: LVGL relayouts the label and invalidates the box around it
+static void label_step_cb(void * var, int32_t v) {
+    stats.steps++;
+    lv_obj_set_x(var, v);
+}
+
+/*---------------------------------------------------------------
+    Scroll the label from x = from to x = to every period_ms,
+    forever. The label's text and style are final
+---------------------------------------------------------------*/
+void app_banner_start(lv_obj_t * label, lv_coord_t from, lv_coord_t to, uint32_t period_ms, bool prerender) {
+
+    lv_anim_t anim;
+
+    lv_obj_update_layout(label);
+    if (banner.strip != NULL) {
+        heap_caps_free(banner.strip);   // Restarted, the previous label is gone
+    }
+    memset(&banner, 0, sizeof(banner));
+    memset(&stats, 0, sizeof(stats));
+    banner.label = label;
+    banner.box = lv_obj_get_parent(label);
+    banner.w = lv_obj_get_width(label);
+    banner.h = lv_obj_get_height(label);
+
+    if (prerender && banner.box != NULL && banner.w > 0 && banner.h > 0) {
+        banner.strip = heap_caps_calloc((size_t)banner.w * banner.h, 1, MALLOC_CAP_8BIT);
+    }
+    if (banner.strip != NULL && capture()) {
+        banner.ofs.x = label->coords.x1 - banner.box->coords.x1 - lv_obj_get_style_x(label, LV_PART_MAIN);
+        banner.ofs.y = label->coords.y1 - banner.box->coords.y1;
+        banner.x = from;
+        lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(banner.box, box_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+        lv_obj_invalidate(banner.box);
+        stats.prerendered = true;
+        stats.strip_bytes = (uint32_t)banner.w * banner.h;
+    }
+    else if (banner.strip != NULL) {
+        heap_caps_free(banner.strip);
+        banner.strip = NULL;
+    }
+
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, label);
+    lv_anim_set_values(&anim, from, to);
+    lv_anim_set_time(&anim, period_ms);
+    lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_set_exec_cb(&anim, (banner.strip != NULL) ? step_cb : label_step_cb);
+    lv_anim_start(&anim);
+}
+
+void app_banner_get_stats(app_banner_stats_t * out) {
+    *out = stats;
+}
+
+// Counters only
+void app_banner_reset_stats(void) {
+    stats.steps = 0;
+    stats.invalidated_px = 0;
+}
+
+void app_banner_log_stats(const char * TAG) {
+    ESP_LOGI(TAG, "Banner: %s, %lu B strip, %lu overlaps, %lu steps, %lu px invalidated",
+             stats.prerendered ? "pre-rendered" : "label", (unsigned long)stats.strip_bytes,
+             (unsigned long)stats.overlaps, (unsigned long)stats.steps, (unsigned long)stats.invalidated_px);
+}
@@ -0,0 +1,361 @@
+/*
+ * @file app_blend_565.c
+ * @brief RGB565 (byte swapped) blend kernels on the sw draw_ctx's blend, see app_blend_565.h.
+ *
+ *        With LV_COLOR_16_SWAP a pixel's 16 bits hold, from bit 0: green 5..3, red, blue, green 2..0. Red and blue
+ *        go into the low and high half of a 32 bit word (RB()), so one multiply scales both; the greens of two
+ *        neighbouring pixels, read as one word, go the same way (G2()). lv_color_mix computes per channel
+ *        (c1 * m + c2 * (255 - m) + 128) / 255, rounded down; lanes are at most 63 * 255 + 128 = 16193, where
+ *        (s + 1 + (s >> 8)) >> 8 is that division exactly, for both lanes at once.
+ *        The entry point repeats lv_draw_sw_blend_basic's clipping and addressing, then runs the kernel for the
+ *        case, each written to give the same pixels as LVGL's fill_normal / map_normal, including their
+ *        thresholds (fill takes a mask of 255 as cover, map takes LV_OPA_MAX and up).
+ *
+ */
+
+#include <string.h>
+#include "app_include/app_blend_565.h"
+
+#if APP_BLEND_565_ENABLE
+
+// Red in the low lane, blue in the high lane
+#define RB(px)      ((((uint32_t)(px) >> 3) & 0x1F) | (((uint32_t)(px) & 0x1F00) << 8))
+#define G(px)       ((((uint32_t)(px) & 0x07) << 3) | ((uint32_t)(px) >> 13))
+// Greens of the two pixels of a word, one per lane
+#define G2(w)       ((((w) & 0x00070007) << 3) | (((w) >> 13) & 0x00070007))
+// floor(lane / 255) of both lanes, exact for the lane sums of a mix (host/bench_blend.c tries them all)
+#define DIV255_X2(s)    (((s) + 0x00010001 + (((s) >> 8) & 0x00FF00FF)) >> 8)
+#define ROUND_X2        (LV_COLOR_MIX_ROUND_OFS * 0x00010001u)
+
+static lv_draw_ctx_t * hooked_ctx = NULL;
+static void (*orig_blend)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) = lv_draw_sw_blend_basic;
+
+static inline uint16_t IRAM_ATTR pack(uint32_t rb, uint32_t g) {
+    return (uint16_t)(((rb & 0x1F) << 3) | ((rb >> 8) & 0x1F00) | (g >> 3) | ((g & 0x07) << 13));
+}
+
+// Two pixels from each's red/blue word and their green pair
+static inline uint32_t IRAM_ATTR pack2(uint32_t rb0, uint32_t rb1, uint32_t g2) {
+    uint32_t w = ((rb0 & 0x1F) << 3) | ((rb0 >> 8) & 0x1F00) | ((rb1 & 0x1F) << 19) | ((rb1 & 0x001F0000) << 8);
+    return w | ((g2 >> 3) & 0x00070007) | ((g2 & 0x00070007) << 13);
+}
+
+// lv_color_mix(fg, bg, m)
+static inline uint16_t IRAM_ATTR mix(uint32_t fg, uint32_t bg, uint32_t m) {
+    uint32_t rb = RB(fg) * m + RB(bg) * (255 - m) + ROUND_X2;
+    uint32_t g = G(fg) * m + G(bg) * (255 - m) + LV_COLOR_MIX_ROUND_OFS;
+    return pack(DIV255_X2(rb), (g + 1 + (g >> 8)) >> 8);
+}
+
+// Two pixels of a word, fg * m + round already applied to the lanes
+static inline uint32_t IRAM_ATTR mix2_premult(uint32_t rb_fg, uint32_t g2_fg, uint32_t bg2, uint32_t inv) {
+    uint32_t rb0 = DIV255_X2(rb_fg + RB(bg2 & 0xFFFF) * inv);
+    uint32_t rb1 = DIV255_X2(rb_fg + RB(bg2 >> 16) * inv);
+    uint32_t g2 = DIV255_X2(g2_fg + G2(bg2) * inv);
+    return pack2(rb0, rb1, g2);
+}
+
+// Two pixels of a word against two of another
+static inline uint32_t IRAM_ATTR mix2(uint32_t fg2, uint32_t bg2, uint32_t m) {
+    uint32_t inv = 255 - m;
+    uint32_t rb0 = DIV255_X2(RB(fg2 & 0xFFFF) * m + RB(bg2 & 0xFFFF) * inv + ROUND_X2);
+    uint32_t rb1 = DIV255_X2(RB(fg2 >> 16) * m + RB(bg2 >> 16) * inv + ROUND_X2);
+    uint32_t g2 = DIV255_X2(G2(fg2) * m + G2(bg2) * inv + ROUND_X2);
+    return pack2(rb0, rb1, g2);
+}
+
+/*---------------------------------------------------------------
+    Image row copy: up to one pixel to reach a word boundary,
+    then words
+---------------------------------------------------------------*/
+static void IRAM_ATTR copy_row(uint16_t * d, const uint16_t * s, int32_t w) {
+
+    if (((uintptr_t)d ^ (uintptr_t)s) & 2) {
+        memcpy(d, s, w * sizeof(uint16_t));     // Can't both be aligned, libc's copy shifts words
+        return;
+    }
+    if (((uintptr_t)d & 2) && w > 0) {
+        *d++ = *s++;
+        w--;
+    }
+    uint32_t * d32 = (uint32_t *)d;
+    const uint32_t * s32 = (const uint32_t *)s;
+    for (; w >= 8; w -= 8, d32 += 4, s32 += 4) {
+        uint32_t a = s32[0], b = s32[1], c = s32[2], e = s32[3];
+        d32[0] = a;
+        d32[1] = b;
+        d32[2] = c;
+        d32[3] = e;
+    }
+    for (; w >= 2; w -= 2) {
+        *d32++ = *s32++;
+    }
+    if (w) {
+        *(uint16_t *)d32 = *(const uint16_t *)s32;
+    }
+}
+
+/*---------------------------------------------------------------
+    Colour fills
+---------------------------------------------------------------*/
+static void IRAM_ATTR fill_opa(uint16_t * d, int32_t w, int32_t h, int32_t stride, uint16_t c, uint32_t opa) {
+
+    uint32_t inv = 255 - opa;
+    uint32_t rb_fg = RB(c) * opa + ROUND_X2;
+    uint32_t g_fg = G(c) * opa + LV_COLOR_MIX_ROUND_OFS;
+    uint32_t g2_fg = g_fg * 0x00010001;
+    uint32_t last_bg = ~0u;     // Backgrounds are mostly flat, remember the last pair
+    uint32_t last_res = 0;
+
+    for (int32_t y = 0; y < h; y++, d += stride) {
+        uint16_t * p = d;
+        int32_t x = w;
+        if (((uintptr_t)p & 2) && x > 0) {
+            *p = mix(c, *p, opa);
+            p++;
+            x--;
+        }
+        uint32_t * p32 = (uint32_t *)p;
+        for (; x >= 2; x -= 2, p32++) {
+            uint32_t bg = *p32;
+            if (bg != last_bg) {
+                last_bg = bg;
+                last_res = mix2_premult(rb_fg, g2_fg, bg, inv);
+            }
+            *p32 = last_res;
+        }
+        if (x) {
+            p = (uint16_t *)p32;
+            *p = mix(c, *p, opa);
+        }
+    }
+}
+
+static void IRAM_ATTR fill_mask(uint16_t * d, int32_t w, int32_t h, int32_t stride, uint16_t c,
+                                const lv_opa_t * mask, int32_t mask_stride) {
+
+    for (int32_t y = 0; y < h; y++, d += stride, mask += mask_stride) {
+        const lv_opa_t * m = mask;
+        int32_t x = 0;
+        for (; x < w && ((uintptr_t)m & 3); x++, m++) {
+            d[x] = (*m == LV_OPA_COVER) ? c : mix(c, d[x], *m);
+        }
+        for (; x + 4 <= w; x += 4, m += 4) {
+            uint32_t m32 = *(const uint32_t *)m;
+            if (m32 == 0) {
+                continue;
+            }
+            if (m32 == 0xFFFFFFFF) {
+                d[x] = c;
+                d[x + 1] = c;
+                d[x + 2] = c;
+                d[x + 3] = c;
+                continue;
+            }
+            for (int i = 0; i < 4; i++) {
+                if (m[i] == LV_OPA_COVER) {
+                    d[x + i] = c;
+                }
+                else if (m[i]) {
+                    d[x + i] = mix(c, d[x + i], m[i]);
+                }
+            }
+        }
+        for (; x < w; x++, m++) {
+            d[x] = (*m == LV_OPA_COVER) ? c : mix(c, d[x], *m);
+        }
+    }
+}
+
+static void IRAM_ATTR fill_mask_opa(uint16_t * d, int32_t w, int32_t h, int32_t stride, uint16_t c, uint32_t opa,
+                                    const lv_opa_t * mask, int32_t mask_stride) {
+
+    for (int32_t y = 0; y < h; y++, d += stride, mask += mask_stride) {
+        for (int32_t x = 0; x < w; x++) {
+            uint32_t m = mask[x];
+            if (m) {
+                d[x] = mix(c, d[x], (m == LV_OPA_COVER) ? opa : (m * opa) >> 8);
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Image copies
+---------------------------------------------------------------*/
+static void IRAM_ATTR map_opa(uint16_t * d, int32_t w, int32_t h, int32_t stride, const uint16_t * s,
+                              int32_t src_stride, uint32_t opa) {
+
+    for (int32_t y = 0; y < h; y++, d += stride, s += src_stride) {
+        int32_t x = 0;
+        if (((uintptr_t)d ^ (uintptr_t)s) & 2) {
+            for (; x < w; x++) {
+                d[x] = mix(s[x], d[x], opa);
+            }
+            continue;
+        }
+        if (((uintptr_t)d & 2) && w > 0) {
+            d[0] = mix(s[0], d[0], opa);
+            x = 1;
+        }
+        for (; x + 2 <= w; x += 2) {
+            uint32_t * d32 = (uint32_t *)&d[x];
+            *d32 = mix2(*(const uint32_t *)&s[x], *d32, opa);
+        }
+        if (x < w) {
+            d[x] = mix(s[x], d[x], opa);
+        }
+    }
+}
+
+static void IRAM_ATTR map_mask(uint16_t * d, int32_t w, int32_t h, int32_t stride, const uint16_t * s,
+                               int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride) {
+
+    for (int32_t y = 0; y < h; y++, d += stride, s += src_stride, mask += mask_stride) {
+        const lv_opa_t * m = mask;
+        int32_t x = 0;
+        for (; x < w && ((uintptr_t)m & 3); x++, m++) {
+            if (*m) {
+                d[x] = (*m == LV_OPA_COVER) ? s[x] : mix(s[x], d[x], *m);
+            }
+        }
+        for (; x + 4 <= w; x += 4, m += 4) {
+            uint32_t m32 = *(const uint32_t *)m;
+            if (m32 == 0) {
+                continue;
+            }
+            if (m32 == 0xFFFFFFFF) {
+                copy_row(&d[x], &s[x], 4);
+                continue;
+            }
+            for (int i = 0; i < 4; i++) {
+                if (m[i] == LV_OPA_COVER) {
+                    d[x + i] = s[x + i];
+                }
+                else if (m[i]) {
+                    d[x + i] = mix(s[x + i], d[x + i], m[i]);
+                }
+            }
+        }
+        for (; x < w; x++, m++) {
+            if (*m) {
+                d[x] = (*m == LV_OPA_COVER) ? s[x] : mix(s[x], d[x], *m);
+            }
+        }
+    }
+}
+
+static void IRAM_ATTR map_mask_opa(uint16_t * d, int32_t w, int32_t h, int32_t stride, const uint16_t * s,
+                                   int32_t src_stride, uint32_t opa, const lv_opa_t * mask, int32_t mask_stride) {
+
+    for (int32_t y = 0; y < h; y++, d += stride, s += src_stride, mask += mask_stride) {
+        for (int32_t x = 0; x < w; x++) {
+            uint32_t m = mask[x];
+            if (m) {
+                d[x] = mix(s[x], d[x], (m >= LV_OPA_MAX) ? opa : (opa * m) >> 8);
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    The draw_ctx's blend: lv_draw_sw_blend_basic's clipping and
+    addressing, then the kernel for the case
+---------------------------------------------------------------*/
+void IRAM_ATTR app_blend_565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) {
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    const lv_opa_t * mask = dsc->mask_buf;
+
+    if (dsc->mask_buf && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) {
+        return;
+    }
+    if (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+        mask = NULL;
+    }
+    if (disp->driver->set_px_cb || disp->driver->screen_transp || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+        (mask && !disp->driver->antialiasing)) {
+        orig_blend(draw_ctx, dsc);
+        return;
+    }
+
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+
+    int32_t w = lv_area_get_width(&area);
+    int32_t h = lv_area_get_height(&area);
+    int32_t stride = lv_area_get_width(draw_ctx->buf_area);
+    uint16_t * d = (uint16_t *)draw_ctx->buf + stride * (area.y1 - draw_ctx->buf_area->y1) +
+                   (area.x1 - draw_ctx->buf_area->x1);
+    int32_t mask_stride = 0;
+    if (mask) {
+        mask_stride = lv_area_get_width(dsc->mask_area);
+        mask += mask_stride * (area.y1 - dsc->mask_area->y1) + (area.x1 - dsc->mask_area->x1);
+    }
+    uint32_t opa = dsc->opa;
+
+    if (dsc->src_buf == NULL) {
+        uint16_t c = dsc->color.full;
+        if (mask == NULL && opa >= LV_OPA_MAX) {
+            for (int32_t y = 0; y < h; y++, d += stride) {
+                lv_color_fill((lv_color_t *)d, dsc->color, w);     // Already aligns and stores words
+            }
+        }
+        else if (mask == NULL) {
+            fill_opa(d, w, h, stride, c, opa);
+        }
+        else if (opa >= LV_OPA_MAX) {
+            fill_mask(d, w, h, stride, c, mask, mask_stride);
+        }
+        else {
+            fill_mask_opa(d, w, h, stride, c, opa, mask, mask_stride);
+        }
+        return;
+    }
+
+    int32_t src_stride = lv_area_get_width(dsc->blend_area);
+    const uint16_t * s = (const uint16_t *)dsc->src_buf + src_stride * (area.y1 - dsc->blend_area->y1) +
+                         (area.x1 - dsc->blend_area->x1);
+    if (mask == NULL && opa >= LV_OPA_MAX) {
+        for (int32_t y = 0; y < h; y++, d += stride, s += src_stride) {
+            copy_row(d, s, w);
+        }
+    }
+    else if (mask == NULL) {
+        map_opa(d, w, h, stride, s, src_stride, opa);
+    }
+    else if (opa > LV_OPA_MAX) {
+        map_mask(d, w, h, stride, s, src_stride, mask, mask_stride);
+    }
+    else {
+        map_mask_opa(d, w, h, stride, s, src_stride, opa, mask, mask_stride);
+    }
+}
+
+/*---------------------------------------------------------------
+    Install on the default display's draw_ctx, after the display
+    is registered
+---------------------------------------------------------------*/
+void app_blend_565_init(void) {
+
+    lv_disp_t * disp = lv_disp_get_default();
+    if (disp != NULL && hooked_ctx == NULL) {
+        hooked_ctx = disp->driver->draw_ctx;
+        orig_blend = ((lv_draw_sw_ctx_t *)hooked_ctx)->blend;
+        ((lv_draw_sw_ctx_t *)hooked_ctx)->blend = app_blend_565;
+    }
+}
+
+#else
+
+// Other colour formats keep LVGL's blend
+void app_blend_565_init(void) {
+}
+
+void app_blend_565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) {
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+#endif
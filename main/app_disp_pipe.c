@@ -0,0 +1,400 @@
+/*
+ * @file app_disp_pipe.c
+ * @brief Double buffered LVGL render/flush pipeline and its per frame timing, see app_disp_pipe.h.
+ *
+ *        Timeline of one strip, all from the display task except the transfer complete stamp:
+ *          render_start ... [wait_cb while the other buffer is still in flight] ... flush_cb -> DMA ... spi_ready ISR
+ *        LVGL only hands a strip to flush_cb once the previous transfer has completed, so the previous strip's
+ *        completion stamp is due by the time it is accounted here. The driver signals flush ready just before
+ *        calling the hook that stamps it, so accounting may spin for those few instructions.
+ *
+ */
+
+#include "app_include/app_disp_pipe.h"
+#include "app_include/app_flush_plan.h"
+#include "lvgl_tft/disp_spi.h"
+
+// Strip height limit from the bus: one strip is one DMA transaction
+#define MAX_TRANSFER_LINES  (SPI_BUS_MAX_TRANSFER_SZ / (APP_DISP_HOR_RES * sizeof(lv_color_t)))
+
+static const char * DISP_TAG = "DISP_PIPE";
+static const bool VERBOSE = false;
+
+static lv_color_t * bufs[2] = {NULL, NULL};
+static uint16_t buf_lines = 0;
+
+// Per frame accumulators
+typedef struct {
+    int64_t start_us;
+    int64_t input_us;                       // Earliest input this frame is the first to show, 0 if none
+    uint16_t strips;
+    uint32_t render_us;
+    uint32_t flush_us;
+    uint32_t flush_cpu_us;
+    uint32_t flush_bytes;
+    uint32_t wait_us;
+    uint32_t overlap_us;
+} frame_acc_t;
+
+static frame_acc_t cur;                     // Frame being rendered
+static frame_acc_t pend;                    // Frame whose last strip was still in flight at monitor_cb
+static bool pend_active = false;
+
+static bool hooked = false;                 // Transfer complete hook registered, strips can be timed
+static int64_t strip_start_us = 0;          // Last strip handed to the driver
+static bool strip_active = false;           // ... and not yet accounted
+static bool strip_last = false;             // ... and it was the last strip of its frame
+static volatile int64_t strip_done_us = 0;  // Set by the SPI ISR when a flush transfer completes ...
+static volatile bool strip_done = false;    // ... then this, so a 64 bit stamp is never read half written
+
+static int64_t render_start_us = 0;         // Rendering of the current strip began
+static int64_t wait_start_us = 0;           // LVGL started waiting for a buffer, 0 if it has not
+
+static int64_t input_mark_us = 0;           // Earliest input not yet picked up by a frame, under stats_mux
+
+static app_disp_pipe_stats_t stats;
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t window_start_us = 0;
+static uint32_t window_frames = 0;
+
+/*---------------------------------------------------------------
+    SPI post transaction hook (ISR), chained after flush ready
+---------------------------------------------------------------*/
+static void IRAM_ATTR flush_done_isr(spi_transaction_t * trans) {
+    if ((disp_spi_send_flag_t)trans->user & DISP_SPI_SIGNAL_FLUSH) {
+        strip_done_us = esp_timer_get_time();
+        strip_done = true;
+    }
+}
+
+/*---------------------------------------------------------------
+    Publish a completed frame
+---------------------------------------------------------------*/
+static void frame_finish(const frame_acc_t * frame, int64_t done_us) {
+
+    uint32_t frame_us = (uint32_t)(done_us - frame->start_us);
+
+    window_frames++;
+    portENTER_CRITICAL(&stats_mux);
+    stats.frames++;
+    stats.strips = frame->strips;
+    stats.render_us = frame->render_us;
+    stats.flush_us = frame->flush_us;
+    stats.flush_cpu_us = frame->flush_cpu_us;
+    stats.flush_bytes = frame->flush_bytes;
+    stats.wait_us = frame->wait_us;
+    stats.overlap_us = frame->overlap_us;
+    stats.frame_us = frame_us;
+    if (frame_us > stats.frame_max_us) {
+        stats.frame_max_us = frame_us;
+    }
+    if (frame->input_us) {
+        uint32_t latency_us = (uint32_t)(done_us - frame->input_us);
+        stats.latency_us = latency_us;
+        stats.latency_max_us = LV_MAX(stats.latency_max_us, latency_us);
+        stats.latency_count++;
+        stats.latency_total_us += latency_us;
+    }
+    if (done_us - window_start_us >= APP_DISP_STATS_WINDOW_MS * 1000) {
+        stats.fps_x10 = (uint32_t)((uint64_t)window_frames * 10000000 / (uint64_t)(done_us - window_start_us));
+        window_start_us = done_us;
+        window_frames = 0;
+    }
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+/*---------------------------------------------------------------
+    Account the strip last handed to the driver. Its transfer must
+    have completed. Rendering of the strip after it, over
+    [render_from, render_to], ran in parallel with it.
+---------------------------------------------------------------*/
+static void strip_account(int64_t render_from, int64_t render_to) {
+
+    while (!strip_done) {
+        // Flush ready is signalled a few instructions before the stamp, possibly from the other core
+    }
+    int64_t done_us = strip_done_us;
+    uint32_t flush_us = (uint32_t)(done_us - strip_start_us);
+
+    int64_t from = LV_MAX(render_from, strip_start_us);
+    int64_t to = LV_MIN(render_to, done_us);
+    if (to > from) {
+        cur.overlap_us += (uint32_t)(to - from);
+    }
+
+    if (strip_last) {
+        // Last strip of a frame that monitor_cb has already closed
+        if (pend_active) {
+            pend.flush_us += flush_us;
+            frame_finish(&pend, done_us);
+            pend_active = false;
+        }
+    }
+    else {
+        cur.flush_us += flush_us;
+    }
+    strip_active = false;
+}
+
+/*---------------------------------------------------------------
+    Run the flush planner over the areas LVGL is about to redraw.
+    Called before the first area is rendered, after LVGL's own
+    joining.
+---------------------------------------------------------------*/
+static void plan_areas(lv_disp_drv_t * disp_drv) {
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    app_flush_rect_t rects[APP_FLUSH_PLAN_MAX_AREAS];
+    int num = LV_MIN(disp->inv_p, APP_FLUSH_PLAN_MAX_AREAS);
+
+    for (int i = 0; i < num; i++) {
+        rects[i] = (app_flush_rect_t){disp->inv_areas[i].x1, disp->inv_areas[i].y1, disp->inv_areas[i].x2, disp->inv_areas[i].y2};
+    }
+    if (app_flush_plan(rects, disp->inv_area_joined, num, disp_drv->draw_buf->size) == 0) {
+        return;
+    }
+    for (int i = 0; i < num; i++) {
+        if (!disp->inv_area_joined[i]) {
+            lv_area_set(&disp->inv_areas[i], rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2);
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    lv_disp_drv_t callbacks
+---------------------------------------------------------------*/
+static void render_start_cb(lv_disp_drv_t * disp_drv) {
+
+    int64_t now = esp_timer_get_time();
+
+    plan_areas(disp_drv);
+
+    if (strip_active && !disp_drv->draw_buf->flushing) {
+        strip_account(now, now);
+    }
+    memset(&cur, 0, sizeof(cur));
+    cur.start_us = now;
+    portENTER_CRITICAL(&stats_mux);
+    cur.input_us = input_mark_us;
+    input_mark_us = 0;
+    portEXIT_CRITICAL(&stats_mux);
+    render_start_us = now;
+    wait_start_us = 0;
+}
+
+static void wait_cb(lv_disp_drv_t * disp_drv) {
+    if (wait_start_us == 0) {
+        wait_start_us = esp_timer_get_time();
+    }
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_map) {
+
+    int64_t now = esp_timer_get_time();
+    int64_t render_end = wait_start_us ? wait_start_us : now;
+
+    cur.render_us += (uint32_t)(render_end - render_start_us);
+    cur.wait_us += (uint32_t)(now - render_end);
+    if (strip_active) {
+        strip_account(render_start_us, render_end);
+    }
+
+    strip_start_us = now;
+    strip_done = false;
+    strip_last = disp_drv->draw_buf->flushing_last;
+    strip_active = hooked;
+    cur.strips++;
+    cur.flush_bytes += lv_area_get_size(area) * sizeof(lv_color_t);
+    app_flush_plan_count_flush(lv_area_get_width(area), lv_area_get_height(area));
+
+    disp_driver_flush(disp_drv, area, color_map);
+
+    render_start_us = esp_timer_get_time();
+    cur.flush_cpu_us += (uint32_t)(render_start_us - now);
+    wait_start_us = 0;
+}
+
+/*---------------------------------------------------------------
+    An input that may change the screen happened at timestamp_us
+    (any task). The next frame to start is the one that shows it.
+---------------------------------------------------------------*/
+void app_disp_pipe_mark_input(int64_t timestamp_us) {
+    portENTER_CRITICAL(&stats_mux);
+    if (input_mark_us == 0) {
+        input_mark_us = timestamp_us;
+    }
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+/*---------------------------------------------------------------
+    Frame end (lv_disp_drv_t.monitor_cb, chain from the app's own
+    monitor). The last strip may still be in flight.
+---------------------------------------------------------------*/
+void app_disp_pipe_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+    app_flush_plan_frame_end(lv_tick_get());
+    pend = cur;
+    pend_active = true;
+    if (strip_active && !disp_drv->draw_buf->flushing) {
+        strip_account(0, 0);
+    }
+}
+
+/*---------------------------------------------------------------
+    Allocate a pair of strip buffers, halving the height until the
+    DMA heap can hold both
+---------------------------------------------------------------*/
+static esp_err_t alloc_buffers(uint16_t lines) {
+
+    for (; lines >= 10; lines /= 2) {
+        size_t bytes = (size_t)APP_DISP_HOR_RES * lines * sizeof(lv_color_t);
+        bufs[0] = heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+        bufs[1] = heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+        if (bufs[0] && bufs[1]) {
+            buf_lines = lines;
+            return ESP_OK;
+        }
+        heap_caps_free(bufs[0]);
+        heap_caps_free(bufs[1]);
+        bufs[0] = NULL;
+        bufs[1] = NULL;
+    }
+
+    buf_lines = 0;
+    return ESP_ERR_NO_MEM;
+}
+
+static void wait_idle(lv_disp_draw_buf_t * draw_buf) {
+    while (draw_buf->flushing) {
+        taskYIELD();
+    }
+}
+
+static void set_lines(lv_disp_draw_buf_t * draw_buf, uint16_t lines) {
+    wait_idle(draw_buf);
+    lv_disp_draw_buf_init(draw_buf, bufs[0], bufs[1], (uint32_t)APP_DISP_HOR_RES * lines);
+    stats.strip_lines = lines;
+}
+
+/*---------------------------------------------------------------
+    Pipeline init, before lv_disp_drv_register(): buffers and the
+    flush/wait/render start callbacks
+---------------------------------------------------------------*/
+esp_err_t app_disp_pipe_init(lv_disp_drv_t * disp_drv, lv_disp_draw_buf_t * draw_buf) {
+
+    uint16_t lines = APP_DISP_STRIP_SWEEP ? APP_DISP_SWEEP_MAX_LINES : APP_DISP_STRIP_LINES;
+    esp_err_t ret = alloc_buffers(LV_MIN(lines, MAX_TRANSFER_LINES));
+    if (ret != ESP_OK) {
+        ESP_LOGE(DISP_TAG, "Couldn't allocate draw buffers!");
+        return ret;
+    }
+    set_lines(draw_buf, LV_MIN(buf_lines, APP_DISP_STRIP_LINES));
+
+    disp_drv->draw_buf = draw_buf;
+    disp_drv->flush_cb = flush_cb;
+    disp_drv->wait_cb = wait_cb;
+    disp_drv->render_start_cb = render_start_cb;
+
+    return ESP_OK;
+}
+
+/*---------------------------------------------------------------
+    Time full screen redraws of the current screen at each
+    candidate strip height, then keep the smallest one within
+    tolerance of the fastest and give the rest back to the heap
+---------------------------------------------------------------*/
+static void strip_sweep(lv_disp_t * disp) {
+
+    static const uint16_t candidates[] = {10, 20, 30, 40, 60, 80};
+    lv_disp_draw_buf_t * draw_buf = disp->driver->draw_buf;
+    uint32_t times_us[sizeof(candidates) / sizeof(candidates[0])] = {0};
+    uint32_t best_us = UINT32_MAX;
+    int num = 0;
+
+    for (int i = 0; i < sizeof(candidates) / sizeof(candidates[0]) && candidates[i] <= buf_lines; i++) {
+        set_lines(draw_buf, candidates[i]);
+        lv_obj_invalidate(lv_scr_act());    // Warm up (caches, image decode) outside the timed frames
+        lv_refr_now(disp);
+        wait_idle(draw_buf);
+
+        int64_t start = esp_timer_get_time();
+        for (int f = 0; f < APP_DISP_SWEEP_FRAMES; f++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(disp);
+        }
+        wait_idle(draw_buf);
+        times_us[i] = (uint32_t)((esp_timer_get_time() - start) / APP_DISP_SWEEP_FRAMES);
+        best_us = LV_MIN(best_us, times_us[i]);
+        num = i + 1;
+        ESP_LOGI(DISP_TAG, "Strip %3u lines: %lu us per full frame", candidates[i], times_us[i]);
+    }
+
+    uint16_t lines = LV_MIN(buf_lines, APP_DISP_STRIP_LINES);
+    for (int i = 0; i < num; i++) {
+        if ((uint64_t)times_us[i] * 100 <= (uint64_t)best_us * (100 + APP_DISP_SWEEP_TOLERANCE_PCT)) {
+            lines = candidates[i];
+            break;
+        }
+    }
+
+    // Shrink to the chosen height
+    wait_idle(draw_buf);
+    heap_caps_free(bufs[0]);
+    heap_caps_free(bufs[1]);
+    bufs[0] = NULL;
+    bufs[1] = NULL;
+    ESP_ERROR_CHECK(alloc_buffers(lines));
+    set_lines(draw_buf, buf_lines);
+    ESP_LOGI(DISP_TAG, "Using 2 x %u line strips (%u bytes each)", buf_lines, APP_DISP_HOR_RES * buf_lines * sizeof(lv_color_t));
+}
+
+/*---------------------------------------------------------------
+    Pipeline start, once the display driver is up and the screen
+    has been built: transfer complete hook, then the strip sweep
+---------------------------------------------------------------*/
+esp_err_t app_disp_pipe_start(lv_disp_t * disp) {
+
+    disp_spi_set_post_cb(flush_done_isr);
+    hooked = true;
+
+    if (APP_DISP_STRIP_SWEEP) {
+        strip_sweep(disp);
+    }
+
+    portENTER_CRITICAL(&stats_mux);
+    uint16_t lines = stats.strip_lines;
+    memset(&stats, 0, sizeof(stats));
+    stats.strip_lines = lines;
+    portEXIT_CRITICAL(&stats_mux);
+    window_start_us = esp_timer_get_time();
+    window_frames = 0;
+    app_flush_plan_reset(lv_tick_get());
+
+    if (VERBOSE) app_disp_pipe_log_stats(DISP_TAG);
+
+    return ESP_OK;
+}
+
+void app_disp_pipe_get_stats(app_disp_pipe_stats_t * out) {
+    portENTER_CRITICAL(&stats_mux);
+    *out = stats;
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+/*---------------------------------------------------------------
+    Stats dump (last frame)
+---------------------------------------------------------------*/
+void app_disp_pipe_log_stats(const char * TAG) {
+
+    app_disp_pipe_stats_t s;
+    app_disp_pipe_get_stats(&s);
+
+    ESP_LOGI(TAG, "Display: %lu.%lu fps, %u x %u line strips, frame %lu us (max %lu): render %lu, flush %lu, wait %lu, overlap %lu us",
+             s.fps_x10 / 10, s.fps_x10 % 10, s.strips, s.strip_lines, s.frame_us, s.frame_max_us,
+             s.render_us, s.flush_us, s.wait_us, s.overlap_us);
+    ESP_LOGI(TAG, "Display: flush %lu bytes, %lu KB/s on the wire, %lu us CPU in the driver (%lu us per strip)",
+             s.flush_bytes, s.flush_us ? (uint32_t)((uint64_t)s.flush_bytes * 1000 / 1024 * 1000 / s.flush_us) : 0,
+             s.flush_cpu_us, s.strips ? s.flush_cpu_us / s.strips : 0);
+    ESP_LOGI(TAG, "Display: input to photon %lu us last, %lu us mean, %lu us max over %lu inputs",
+             s.latency_us, s.latency_count ? (uint32_t)(s.latency_total_us / s.latency_count) : 0, s.latency_max_us, s.latency_count);
+    app_flush_plan_log_stats(TAG);
+}
@@ -0,0 +1,163 @@
+/*
+ * @file app_disp_power.c
+ * @brief Display power manager, see app_disp_power.h.
+ *
+ *        Current is integrated at each level change, as the level just left times the time it was held. A fade is
+ *        counted at its end level from its start, which overstates the dimmed saving by about half a fade.
+ *
+ */
+
+#include <string.h>
+#include "app_include/app_disp_power.h"
+
+static const char * const state_names[APP_DISP_POWER_NUM_STATES] = {"on", "dim", "sleep"};
+
+static struct {
+    const app_disp_power_io_t * io;
+    app_disp_power_state_t state;
+    int brightness;             // Setting, shown when on
+    int level;                  // Backlight as last written (end of the fade)
+    int64_t activity_us;        // Last input
+    int64_t state_start_us;
+    int64_t level_start_us;
+    int64_t init_us;
+    uint64_t charge_ua_us;      // Integrated current before level_start_us
+} pm;
+
+static app_disp_power_stats_t stats;
+
+static uint32_t current_ua(void) {
+    uint32_t panel = (pm.state == APP_DISP_POWER_SLEEP) ? APP_DISP_POWER_PANEL_SLEEP_UA : APP_DISP_POWER_PANEL_UA;
+    return panel + (uint32_t)APP_DISP_POWER_BL_FULL_UA * pm.level / 100;
+}
+
+// Close the current level's share of the charge (before any change of level or panel state)
+static void account(int64_t now_us) {
+    pm.charge_ua_us += (uint64_t)current_ua() * (uint64_t)(now_us - pm.level_start_us);
+    pm.level_start_us = now_us;
+}
+
+static void set_backlight(int pct, uint32_t fade_ms, int64_t now_us) {
+    if (pct == pm.level) {
+        return;
+    }
+    account(now_us);
+    pm.level = pct;
+    stats.backlight_writes++;
+    pm.io->backlight(pct, fade_ms);
+}
+
+static void enter(app_disp_power_state_t state, int64_t now_us) {
+    account(now_us);
+    stats.state_us[pm.state] += now_us - pm.state_start_us;
+    pm.state_start_us = now_us;
+    pm.state = state;
+}
+
+/*---------------------------------------------------------------
+    Start on, at this brightness, written once
+---------------------------------------------------------------*/
+void app_disp_power_init(const app_disp_power_io_t * io, int brightness_pct, int64_t now_us) {
+    memset(&pm, 0, sizeof(pm));
+    memset(&stats, 0, sizeof(stats));
+    pm.io = io;
+    pm.state = APP_DISP_POWER_ON;
+    pm.brightness = brightness_pct;
+    pm.level = brightness_pct;
+    pm.activity_us = now_us;
+    pm.state_start_us = now_us;
+    pm.level_start_us = now_us;
+    pm.init_us = now_us;
+    stats.backlight_writes++;
+    io->backlight(brightness_pct, 0);
+}
+
+/*---------------------------------------------------------------
+    Encoder step or switch edge. True if it woke the panel: the
+    caller renders this pass
+---------------------------------------------------------------*/
+bool app_disp_power_activity(int64_t now_us) {
+
+    app_disp_power_state_t was = pm.state;
+
+    pm.activity_us = now_us;
+    if (was == APP_DISP_POWER_ON) {
+        return false;
+    }
+    enter(APP_DISP_POWER_ON, now_us);
+    if (was == APP_DISP_POWER_SLEEP) {
+        pm.io->panel_sleep(false);
+    }
+    set_backlight(pm.brightness, 0, now_us);
+    stats.wakes++;
+    return was == APP_DISP_POWER_SLEEP;
+}
+
+/*---------------------------------------------------------------
+    Backlight setting (pot D). Shown when on, kept for the wake
+    otherwise. Not activity: the pot is read, not touched
+---------------------------------------------------------------*/
+void app_disp_power_set_brightness(int pct, int64_t now_us) {
+    pm.brightness = pct;
+    if (pm.state == APP_DISP_POWER_ON) {
+        set_backlight(pct, 0, now_us);
+    }
+}
+
+/*---------------------------------------------------------------
+    Move on through the inactivity states. Returns ms until the
+    next one is due, UINT32_MAX asleep
+---------------------------------------------------------------*/
+uint32_t app_disp_power_poll(int64_t now_us) {
+
+    int64_t idle_ms = (now_us - pm.activity_us) / 1000;
+
+    if (pm.state == APP_DISP_POWER_ON && idle_ms >= APP_DISP_POWER_DIM_MS) {
+        enter(APP_DISP_POWER_DIM, now_us);
+        stats.dims++;
+        set_backlight(pm.brightness < APP_DISP_POWER_DIM_PCT ? pm.brightness : APP_DISP_POWER_DIM_PCT,
+                      APP_DISP_POWER_DIM_FADE_MS, now_us);
+    }
+    if (pm.state == APP_DISP_POWER_DIM && idle_ms >= APP_DISP_POWER_SLEEP_MS) {
+        set_backlight(0, 0, now_us);
+        enter(APP_DISP_POWER_SLEEP, now_us);
+        stats.sleeps++;
+        pm.io->panel_sleep(true);
+    }
+
+    switch (pm.state) {
+        case APP_DISP_POWER_ON:  return (uint32_t)(APP_DISP_POWER_DIM_MS - idle_ms);
+        case APP_DISP_POWER_DIM: return (uint32_t)(APP_DISP_POWER_SLEEP_MS - idle_ms);
+        default:                 return UINT32_MAX;
+    }
+}
+
+// False while the panel sleeps: leave LVGL alone until the next input
+bool app_disp_power_rendering(void) {
+    return pm.state != APP_DISP_POWER_SLEEP;
+}
+
+void app_disp_power_get_stats(app_disp_power_stats_t * out, int64_t now_us) {
+
+    *out = stats;
+    out->state = pm.state;
+    out->state_us[pm.state] += now_us - pm.state_start_us;
+    out->current_ua = current_ua();
+
+    uint64_t charge = pm.charge_ua_us + (uint64_t)current_ua() * (uint64_t)(now_us - pm.level_start_us);
+    out->mean_ua = (now_us > pm.init_us) ? (uint32_t)(charge / (uint64_t)(now_us - pm.init_us)) : out->current_ua;
+}
+
+void app_disp_power_log_stats(const char * TAG, int64_t now_us) {
+
+    app_disp_power_stats_t s;
+    app_disp_power_get_stats(&s, now_us);
+    ESP_LOGI(TAG, "Display power: %s, on %llu s, dim %llu s, sleep %llu s; %lu dims, %lu sleeps, %lu wakes, "
+             "%lu backlight writes; est. %lu.%lu mA now, %lu.%lu mA mean", state_names[s.state],
+             (unsigned long long)(s.state_us[APP_DISP_POWER_ON] / 1000000),
+             (unsigned long long)(s.state_us[APP_DISP_POWER_DIM] / 1000000),
+             (unsigned long long)(s.state_us[APP_DISP_POWER_SLEEP] / 1000000), (unsigned long)s.dims, (unsigned long)s.sleeps,
+             (unsigned long)s.wakes, (unsigned long)s.backlight_writes, (unsigned long)(s.current_ua / 1000),
+             (unsigned long)(s.current_ua / 100 % 10), (unsigned long)(s.mean_ua / 1000),
+             (unsigned long)(s.mean_ua / 100 % 10));
+}
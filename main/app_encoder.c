@@ -8,7 +8,9 @@ void encoder_init(rotary_encoder_info_t * encoder, gpio_num_t cha_pin, gpio_num_
 
     esp_err_t err;
     // esp32-rotary-encoder requires that the GPIO ISR service is installed before calling rotary_encoder_register()
-    gpio_install_isr_service(0);    // This function has protection around it to ensure that it cannot be called over itself
+    // ESP_INTR_FLAG_IRAM: the quadrature and switch ISRs are IRAM_ATTR and keep running while flash is written (the
+    // service's dispatcher then needs every handler added to it in IRAM). Protected against being called twice
+    gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
 
     // Initialise the rotary encoder device with the GPIOs for A and B signals
     ESP_ERROR_CHECK(rotary_encoder_init(encoder, cha_pin, chb_pin, sw_pin,/* sw_pin_int_en,*/ MAX_ENCODER_COUNTS, MIN_ENCODER_COUNTS));
@@ -16,4 +18,25 @@ void encoder_init(rotary_encoder_info_t * encoder, gpio_num_t cha_pin, gpio_num_
     if (flip_dir) {
         ESP_ERROR_CHECK(rotary_encoder_flip_direction(encoder));
     }
+}
+
+/*---------------------------------------------------------------
+    Rotary Encoder ISR profile dump (cycle count histogram)
+---------------------------------------------------------------*/
+void encoder_log_isr_stats(const char * tag, rotary_encoder_info_t * encoder) {
+
+    rotary_encoder_isr_stats_t stats;
+
+    if (rotary_encoder_get_isr_stats(encoder, &stats) != ESP_OK || stats.count == 0) {
+        return;
+    }
+
+    ESP_LOGI(tag, "ISR cycles: n=%lu min=%lu max=%lu mean=%lu", stats.count, stats.min_cycles, stats.max_cycles, 
+             (uint32_t)(stats.total_cycles / stats.count));
+    for (int i = 0; i < ROTARY_ENCODER_ISR_HIST_BINS; i++) {
+        if (stats.hist[i]) {
+            ESP_LOGI(tag, "  %4d-%4d%s: %lu", i * ROTARY_ENCODER_ISR_HIST_BIN_CYCLES, (i + 1) * ROTARY_ENCODER_ISR_HIST_BIN_CYCLES - 1,
+                     (i == ROTARY_ENCODER_ISR_HIST_BINS - 1) ? "+" : " ", stats.hist[i]);
+        }
+    }
 }
\ No newline at end of file
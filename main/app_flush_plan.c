@@ -0,0 +1,185 @@
+/*
+ * @file app_flush_plan.c
+ * @brief Cost model driven merging of flush windows and per frame flush accounting, see app_flush_plan.h.
+ *
+ */
+
+#include "app_include/app_flush_plan.h"
+
+// Current frame, published by app_flush_plan_frame_end
+static struct {
+    uint16_t flushes;
+    uint32_t px;
+    uint32_t bytes;
+} frame;
+
+static struct {
+    uint32_t start_ms;
+    uint32_t flushes;
+    uint32_t bytes;
+} window;
+
+static app_flush_plan_stats_t stats;
+
+static inline uint32_t rect_px(const app_flush_rect_t * rect) {
+    return (uint32_t)(rect->x2 - rect->x1 + 1) * (uint32_t)(rect->y2 - rect->y1 + 1);
+}
+
+/*---------------------------------------------------------------
+    Modelled cost of flushing one window: LVGL splits it into
+    strips of as many full rows as the draw buffer holds, each one
+    a separate flush
+---------------------------------------------------------------*/
+uint32_t app_flush_plan_cost(const app_flush_rect_t * rect, uint32_t buf_px) {
+
+    uint32_t w = (uint32_t)(rect->x2 - rect->x1 + 1);
+    uint32_t h = (uint32_t)(rect->y2 - rect->y1 + 1);
+    uint32_t rows = buf_px / w;
+    if (rows == 0) {
+        rows = 1;
+    }
+    uint32_t flushes = (h + rows - 1) / rows;
+
+    return flushes * APP_FLUSH_PLAN_SETUP_COST + w * h * APP_FLUSH_PLAN_PX_BYTES;
+}
+
+/*---------------------------------------------------------------
+    Merge pairs of windows while the bounding box of a pair costs
+    less than the two separately. rects/joined are LVGL's inv_areas
+    and inv_area_joined (joined areas are skipped), buf_px the draw
+    buffer size in pixels. A pair always survives in its higher
+    index, so the last area LVGL will draw stays the last one.
+    Returns the number of merges.
+---------------------------------------------------------------*/
+int app_flush_plan(app_flush_rect_t * rects, uint8_t * joined, int num_rects, uint32_t buf_px) {
+
+    uint32_t cost[APP_FLUSH_PLAN_MAX_AREAS];
+    uint32_t cost_in = 0;
+    uint32_t px_in = 0;
+    uint16_t areas = 0;
+    int merges = 0;
+
+    if (num_rects > APP_FLUSH_PLAN_MAX_AREAS) {
+        num_rects = APP_FLUSH_PLAN_MAX_AREAS;
+    }
+
+    for (int i = 0; i < num_rects; i++) {
+        if (joined[i]) {
+            continue;
+        }
+        cost[i] = app_flush_plan_cost(&rects[i], buf_px);
+        cost_in += cost[i];
+        px_in += rect_px(&rects[i]);
+        areas++;
+    }
+    stats.areas_in = areas;
+
+    // A merge can make the grown window worth merging with one already passed over, so sweep until stable
+    bool changed = APP_FLUSH_PLAN_ENABLE;
+    while (changed) {
+        changed = false;
+        for (int j = num_rects - 1; j > 0; j--) {
+            if (joined[j]) {
+                continue;
+            }
+            for (int i = j - 1; i >= 0; i--) {
+                if (joined[i]) {
+                    continue;
+                }
+                app_flush_rect_t box = {
+                    .x1 = rects[i].x1 < rects[j].x1 ? rects[i].x1 : rects[j].x1,
+                    .y1 = rects[i].y1 < rects[j].y1 ? rects[i].y1 : rects[j].y1,
+                    .x2 = rects[i].x2 > rects[j].x2 ? rects[i].x2 : rects[j].x2,
+                    .y2 = rects[i].y2 > rects[j].y2 ? rects[i].y2 : rects[j].y2,
+                };
+                uint32_t box_cost = app_flush_plan_cost(&box, buf_px);
+                if (box_cost < cost[i] + cost[j]) {
+                    rects[j] = box;
+                    cost[j] = box_cost;
+                    joined[i] = 1;
+                    merges++;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    uint32_t cost_out = 0;
+    uint32_t px_out = 0;
+    areas = 0;
+    for (int i = 0; i < num_rects; i++) {
+        if (!joined[i]) {
+            cost_out += cost[i];
+            px_out += rect_px(&rects[i]);
+            areas++;
+        }
+    }
+
+    stats.areas_out = areas;
+    stats.cost_in = cost_in;
+    stats.cost_out = cost_out;
+    stats.extra_px = px_out > px_in ? px_out - px_in : 0;
+    stats.merges_total += merges;
+
+    return merges;
+}
+
+/*---------------------------------------------------------------
+    One flush of a width x height window went to the panel
+---------------------------------------------------------------*/
+void app_flush_plan_count_flush(int32_t width, int32_t height) {
+    uint32_t px = (uint32_t)width * (uint32_t)height;
+    frame.flushes++;
+    frame.px += px;
+    frame.bytes += px * APP_FLUSH_PLAN_PX_BYTES + APP_FLUSH_PLAN_SETUP_BYTES;
+}
+
+/*---------------------------------------------------------------
+    Close the frame's flush counters, roll the rate window
+---------------------------------------------------------------*/
+void app_flush_plan_frame_end(uint32_t now_ms) {
+
+    stats.frames++;
+    stats.flushes = frame.flushes;
+    stats.px = frame.px;
+    stats.bytes = frame.bytes;
+    stats.bytes_total += frame.bytes;
+
+    window.flushes += frame.flushes;
+    window.bytes += frame.bytes;
+    memset(&frame, 0, sizeof(frame));
+
+    uint32_t elapsed = now_ms - window.start_ms;
+    if (elapsed >= APP_FLUSH_PLAN_WINDOW_MS) {
+        stats.flushes_per_s = (uint32_t)((uint64_t)window.flushes * 1000 / elapsed);
+        stats.bytes_per_s = (uint32_t)((uint64_t)window.bytes * 1000 / elapsed);
+        window.start_ms = now_ms;
+        window.flushes = 0;
+        window.bytes = 0;
+    }
+}
+
+void app_flush_plan_reset(uint32_t now_ms) {
+    memset(&stats, 0, sizeof(stats));
+    memset(&frame, 0, sizeof(frame));
+    memset(&window, 0, sizeof(window));
+    window.start_ms = now_ms;
+}
+
+void app_flush_plan_get_stats(app_flush_plan_stats_t * out) {
+    *out = stats;
+}
+
+/*---------------------------------------------------------------
+    Stats dump
+---------------------------------------------------------------*/
+void app_flush_plan_log_stats(const char * TAG) {
+
+    ESP_LOGI(TAG, "Flush: %lu B/s, %lu flushes/s; last frame %u flushes, %lu px, %lu B",
+             (unsigned long)stats.bytes_per_s, (unsigned long)stats.flushes_per_s, stats.flushes,
+             (unsigned long)stats.px, (unsigned long)stats.bytes);
+    ESP_LOGI(TAG, "Flush: plan %u -> %u areas, cost %lu -> %lu, %lu extra px%s; %lu merges, %llu B total",
+             stats.areas_in, stats.areas_out, (unsigned long)stats.cost_in, (unsigned long)stats.cost_out,
+             (unsigned long)stats.extra_px, APP_FLUSH_PLAN_ENABLE ? "" : " (disabled)",
+             (unsigned long)stats.merges_total, (unsigned long long)stats.bytes_total);
+}
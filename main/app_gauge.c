@@ -0,0 +1,418 @@
+/*
+ * @file app_gauge.c
+ * @brief Lightweight arc gauge, see app_gauge.h.
+ *
+ *        Geometry matches the lv_arc it replaces: outer radius half the (square) size, track and indicator
+ *        drawn inward from it, knob centred on the indicator's mid line. Masks use the continuous centre of
+ *        the box; the knob sprite is centred on a pixel, as LVGL draws it.
+ *
+ */
+
+#include <math.h>
+#include "app_include/app_gauge.h"
+#include "src/draw/sw/lv_draw_sw.h"     // lv_draw_sw_blend, not exported by lvgl.h
+
+#define MY_CLASS        &app_gauge_class
+
+#define FULL_STEPS      (360 * APP_GAUGE_ANGLE_STEPS)
+#define SWEEP_STEPS     (APP_GAUGE_BG_SWEEP * APP_GAUGE_ANGLE_STEPS)
+#define KNOB_R          (APP_GAUGE_INDIC_WIDTH / 2 + APP_GAUGE_KNOB_PAD + 0.5f)    // lv_arc's knob box is 2 * (pad + width / 2) + 1 wide
+#define KNOB_HALF       (APP_GAUGE_INDIC_WIDTH / 2 + APP_GAUGE_KNOB_PAD + APP_GAUGE_KNOB_OUTLINE + APP_GAUGE_KNOB_SHADOW / 2 + 1)
+#define KNOB_PX         (2 * KNOB_HALF + 1)
+#define DEG_TO_RAD      0.01745329252f
+
+static const char * GAUGE_TAG = "GAUGE";
+
+// Masks shared by all gauges of one size
+typedef struct {
+    lv_coord_t size;
+    uint16_t * angle;       // Pixel angle from the track start, angle steps
+    lv_opa_t * track;       // Track coverage
+    lv_opa_t * ring;        // Indicator coverage over the full circle
+    uint16_t cap_steps;     // Angular reach of an indicator end cap, from the cap centre
+} gauge_cache_t;
+
+static gauge_cache_t caches[APP_GAUGE_MAX_SIZES];
+
+// Knob, drawn as the dark mask (shadow, outline) in black then the fill mask in the knob colour
+static lv_opa_t knob_dark[KNOB_PX * KNOB_PX];
+static lv_opa_t knob_fill[KNOB_PX * KNOB_PX];
+static bool knob_ready = false;
+
+static void app_gauge_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void app_gauge_event(const lv_obj_class_t * class_p, lv_event_t * e);
+
+const lv_obj_class_t app_gauge_class = {
+    .constructor_cb = app_gauge_constructor,
+    .event_cb = app_gauge_event,
+    .instance_size = sizeof(app_gauge_t),
+    .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
+    .base_class = &lv_obj_class
+};
+
+static inline float clampf01(float v) {
+    return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+// Coverage of a pixel whose centre is dist from the edge of a shape, positive inside
+static inline lv_opa_t coverage(float dist) {
+    return (lv_opa_t)(clampf01(dist + 0.5f) * LV_OPA_COVER + 0.5f);
+}
+
+static inline uint16_t steps_between(uint16_t a, uint16_t b) {
+    uint16_t d = (a > b) ? a - b : b - a;
+    return (d > FULL_STEPS / 2) ? FULL_STEPS - d : d;
+}
+
+static void point_at(float centre, float r, uint16_t steps, float * x, float * y) {
+    float theta = (APP_GAUGE_BG_START + (float)steps / APP_GAUGE_ANGLE_STEPS) * DEG_TO_RAD;
+    *x = centre + r * cosf(theta);
+    *y = centre + r * sinf(theta);
+}
+
+/*---------------------------------------------------------------
+    Render the masks for one gauge size, once
+---------------------------------------------------------------*/
+static const gauge_cache_t * cache_get(lv_coord_t size) {
+
+    gauge_cache_t * cache = NULL;
+
+    for (int i = 0; i < APP_GAUGE_MAX_SIZES; i++) {
+        if (caches[i].size == size) {
+            return &caches[i];
+        }
+        if (caches[i].size == 0 && cache == NULL) {
+            cache = &caches[i];
+        }
+    }
+    if (cache == NULL || size <= 2 * APP_GAUGE_INDIC_WIDTH) {
+        return NULL;
+    }
+
+    uint8_t * mem = heap_caps_malloc((size_t)size * size * (sizeof(uint16_t) + 2), MALLOC_CAP_8BIT);
+    if (mem == NULL) {
+        ESP_LOGE(GAUGE_TAG, "No memory for %dpx gauge masks", (int)size);
+        return NULL;
+    }
+    cache->size = size;
+    cache->angle = (uint16_t *)mem;
+    cache->track = mem + (size_t)size * size * sizeof(uint16_t);
+    cache->ring = cache->track + (size_t)size * size;
+
+    float centre = size / 2.0f;
+    float r_out = size / 2.0f;
+    float track_mid = r_out - APP_GAUGE_TRACK_WIDTH / 2.0f;
+    float cap_x[2], cap_y[2];
+    point_at(centre, track_mid, 0, &cap_x[0], &cap_y[0]);
+    point_at(centre, track_mid, SWEEP_STEPS, &cap_x[1], &cap_y[1]);
+
+    for (lv_coord_t y = 0; y < size; y++) {
+        for (lv_coord_t x = 0; x < size; x++) {
+            int i = y * size + x;
+            float dx = x + 0.5f - centre;
+            float dy = y + 0.5f - centre;
+            float d = sqrtf(dx * dx + dy * dy);
+
+            float deg = atan2f(dy, dx) / DEG_TO_RAD - APP_GAUGE_BG_START;
+            while (deg < 0.0f) {
+                deg += 360.0f;
+            }
+            uint16_t steps = (uint16_t)(deg * APP_GAUGE_ANGLE_STEPS) % FULL_STEPS;
+            cache->angle[i] = steps;
+
+            float out = r_out - d;
+            cache->ring[i] = LV_MIN(coverage(out), coverage(d - (r_out - APP_GAUGE_INDIC_WIDTH)));
+
+            lv_opa_t track = 0;
+            if (steps <= SWEEP_STEPS) {
+                track = LV_MIN(coverage(out), coverage(d - (r_out - APP_GAUGE_TRACK_WIDTH)));
+            }
+            for (int c = 0; c < 2; c++) {
+                float cx = x + 0.5f - cap_x[c];
+                float cy = y + 0.5f - cap_y[c];
+                track = LV_MAX(track, coverage(APP_GAUGE_TRACK_WIDTH / 2.0f - sqrtf(cx * cx + cy * cy)));
+            }
+            cache->track[i] = track;
+        }
+    }
+
+    // A cap reaches furthest in angle at the ring's inner edge
+    float reach = (APP_GAUGE_INDIC_WIDTH / 2.0f + 1.0f) / (r_out - APP_GAUGE_INDIC_WIDTH);
+    cache->cap_steps = (uint16_t)(asinf(LV_MIN(reach, 1.0f)) / DEG_TO_RAD * APP_GAUGE_ANGLE_STEPS) + 1;
+
+    if (!knob_ready) {
+        for (int y = 0; y < KNOB_PX; y++) {
+            for (int x = 0; x < KNOB_PX; x++) {
+                float d = sqrtf((float)((x - KNOB_HALF) * (x - KNOB_HALF) + (y - KNOB_HALF) * (y - KNOB_HALF)));
+                float t = clampf01((KNOB_R + APP_GAUGE_KNOB_SHADOW / 2.0f - d) / APP_GAUGE_KNOB_SHADOW);
+                lv_opa_t shadow = (lv_opa_t)(t * t * (3.0f - 2.0f * t) * LV_OPA_COVER);
+                knob_dark[y * KNOB_PX + x] = LV_MAX(shadow, coverage(KNOB_R + APP_GAUGE_KNOB_OUTLINE - d));
+                knob_fill[y * KNOB_PX + x] = coverage(KNOB_R - d);
+            }
+        }
+        knob_ready = true;
+    }
+
+    ESP_LOGI(GAUGE_TAG, "%dpx gauge masks, %u bytes", (int)size, (unsigned)(size * size * (sizeof(uint16_t) + 2)));
+    return cache;
+}
+
+static lv_coord_t gauge_size(const lv_obj_t * obj) {
+    return LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj));
+}
+
+static void knob_area(const lv_obj_t * obj, uint16_t knob_angle, lv_area_t * area) {
+    lv_coord_t size = gauge_size(obj);
+    float x, y;
+    point_at(size / 2.0f, size / 2.0f - APP_GAUGE_INDIC_WIDTH / 2.0f, knob_angle, &x, &y);
+    area->x1 = obj->coords.x1 + (lv_coord_t)floorf(x) - KNOB_HALF;
+    area->y1 = obj->coords.y1 + (lv_coord_t)floorf(y) - KNOB_HALF;
+    area->x2 = area->x1 + KNOB_PX - 1;
+    area->y2 = area->y1 + KNOB_PX - 1;
+}
+
+// Ring sector between two angles, end caps included
+static void invalidate_sector(lv_obj_t * obj, uint16_t from, uint16_t to) {
+
+    if (from == to) {
+        return;
+    }
+    if (from > to) {
+        uint16_t t = from;
+        from = to;
+        to = t;
+    }
+
+    lv_coord_t size = gauge_size(obj);
+    uint16_t start = (APP_GAUGE_BG_START + from / APP_GAUGE_ANGLE_STEPS) % 360;
+    uint16_t end = (APP_GAUGE_BG_START + (to + APP_GAUGE_ANGLE_STEPS - 1) / APP_GAUGE_ANGLE_STEPS) % 360;
+    lv_area_t area;
+    lv_draw_arc_get_area(obj->coords.x1 + size / 2, obj->coords.y1 + size / 2, size / 2, start, end,
+                         APP_GAUGE_INDIC_WIDTH, true, &area);
+    lv_area_increase(&area, 1, 1);
+    lv_obj_invalidate_area(obj, &area);
+}
+
+/*---------------------------------------------------------------
+    Indicator sweep and knob angle from the value
+---------------------------------------------------------------*/
+static void value_update(lv_obj_t * obj, bool invalidate) {
+
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    uint16_t old_knob = gauge->knob_angle;
+    lv_area_t old_area;
+    knob_area(obj, old_knob, &old_area);
+
+    gauge->knob_angle = (uint16_t)lv_map(gauge->value, gauge->min_value, gauge->max_value, 0, SWEEP_STEPS);
+    if (gauge->mode == APP_GAUGE_MODE_SYMMETRICAL) {
+        gauge->indic_start = LV_MIN(gauge->knob_angle, SWEEP_STEPS / 2);
+        gauge->indic_end = LV_MAX(gauge->knob_angle, SWEEP_STEPS / 2);
+    }
+    else {
+        gauge->indic_start = 0;
+        gauge->indic_end = gauge->knob_angle;
+    }
+
+    if (invalidate && gauge->knob_angle != old_knob) {
+        lv_area_t new_area;
+        knob_area(obj, gauge->knob_angle, &new_area);
+        lv_obj_invalidate_area(obj, &old_area);
+        lv_obj_invalidate_area(obj, &new_area);
+        invalidate_sector(obj, old_knob, gauge->knob_angle);
+    }
+}
+
+/*---------------------------------------------------------------
+    Draw: track from the cache, indicator as the cached ring
+    limited to the sweep, knob sprite
+---------------------------------------------------------------*/
+static void draw_gauge(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx) {
+
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    lv_coord_t size = gauge_size(obj);
+    const gauge_cache_t * cache = cache_get(size);
+
+    if (cache == NULL) {
+        return;
+    }
+
+    lv_area_t box = {obj->coords.x1, obj->coords.y1, obj->coords.x1 + size - 1, obj->coords.y1 + size - 1};
+    lv_area_t clip;
+
+    lv_draw_sw_blend_dsc_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.opa = LV_OPA_COVER;
+    blend.blend_mode = LV_BLEND_MODE_NORMAL;
+    blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    if (_lv_area_intersect(&clip, &box, draw_ctx->clip_area)) {
+        blend.blend_area = &box;
+        blend.mask_area = &box;
+        blend.mask_buf = cache->track;
+        blend.color = gauge->track_color;
+        lv_draw_sw_blend(draw_ctx, &blend);
+
+        if (gauge->indic_start < gauge->indic_end) {
+            lv_coord_t w = lv_area_get_width(&clip);
+            lv_coord_t h = lv_area_get_height(&clip);
+            lv_opa_t * mask = lv_mem_buf_get(w * h);
+            float centre = size / 2.0f;
+            float mid = size / 2.0f - APP_GAUGE_INDIC_WIDTH / 2.0f;
+            uint16_t ends[2] = {gauge->indic_start, gauge->indic_end};
+            float cap_x[2], cap_y[2];
+            point_at(centre, mid, ends[0], &cap_x[0], &cap_y[0]);
+            point_at(centre, mid, ends[1], &cap_x[1], &cap_y[1]);
+
+            lv_opa_t * m = mask;
+            for (lv_coord_t y = clip.y1 - box.y1; y <= clip.y2 - box.y1; y++) {
+                int row = y * size;
+                for (lv_coord_t x = clip.x1 - box.x1; x <= clip.x2 - box.x1; x++) {
+                    lv_opa_t cov = cache->ring[row + x];
+                    uint16_t a = cache->angle[row + x];
+                    if (cov != 0 && (a < ends[0] || a > ends[1])) {
+                        // Outside the sweep: only the rounded end caps
+                        lv_opa_t cap = 0;
+                        for (int c = 0; c < 2; c++) {
+                            if (steps_between(a, ends[c]) <= cache->cap_steps) {
+                                float cx = x + 0.5f - cap_x[c];
+                                float cy = y + 0.5f - cap_y[c];
+                                cap = LV_MAX(cap, coverage(APP_GAUGE_INDIC_WIDTH / 2.0f - sqrtf(cx * cx + cy * cy)));
+                            }
+                        }
+                        cov = cap;
+                    }
+                    *m++ = cov;
+                }
+            }
+
+            blend.blend_area = &clip;
+            blend.mask_area = &clip;
+            blend.mask_buf = mask;
+            blend.color = gauge->indic_color;
+            lv_draw_sw_blend(draw_ctx, &blend);
+            lv_mem_buf_release(mask);
+        }
+    }
+
+    lv_area_t knob;
+    knob_area(obj, gauge->knob_angle, &knob);
+    if (_lv_area_intersect(&clip, &knob, draw_ctx->clip_area)) {
+        blend.blend_area = &knob;
+        blend.mask_area = &knob;
+        blend.mask_buf = knob_dark;
+        blend.color = lv_color_black();
+        lv_draw_sw_blend(draw_ctx, &blend);
+        blend.mask_buf = knob_fill;
+        blend.color = gauge->knob_color;
+        lv_draw_sw_blend(draw_ctx, &blend);
+    }
+}
+
+static void app_gauge_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj) {
+
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+
+    gauge->min_value = 0;
+    gauge->max_value = 100;
+    gauge->value = 0;
+    gauge->mode = APP_GAUGE_MODE_NORMAL;
+    gauge->track_color = lv_palette_lighten(LV_PALETTE_GREY, 2);
+    gauge->indic_color = lv_palette_main(LV_PALETTE_BLUE);
+    gauge->knob_color = lv_color_white();
+    value_update(obj, false);
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+}
+
+static void app_gauge_event(const lv_obj_class_t * class_p, lv_event_t * e) {
+
+    lv_res_t res = lv_obj_event_base(MY_CLASS, e);
+    if (res != LV_RES_OK) {
+        return;
+    }
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw_gauge(obj, lv_event_get_draw_ctx(e));
+    }
+    else if (code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        lv_event_set_ext_draw_size(e, KNOB_HALF);     // Knob and its shadow overhang the box
+    }
+    else if (code == LV_EVENT_KEY) {
+        // Encoder in edit mode, as lv_arc
+        char c = *((char *)lv_event_get_param(e));
+        int16_t old_value = gauge->value;
+        if (c == LV_KEY_RIGHT || c == LV_KEY_UP) {
+            app_gauge_set_value(obj, gauge->value + 1);
+        }
+        else if (c == LV_KEY_LEFT || c == LV_KEY_DOWN) {
+            app_gauge_set_value(obj, gauge->value - 1);
+        }
+        if (gauge->value != old_value) {
+            lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Create a gauge, range 0..100, normal mode. Size it square.
+---------------------------------------------------------------*/
+lv_obj_t * app_gauge_create(lv_obj_t * parent) {
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void app_gauge_set_range(lv_obj_t * obj, int16_t min_value, int16_t max_value) {
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    if (min_value >= max_value) {
+        return;
+    }
+    gauge->min_value = min_value;
+    gauge->max_value = max_value;
+    gauge->value = LV_CLAMP(min_value, gauge->value, max_value);
+    value_update(obj, false);
+    lv_obj_invalidate(obj);
+}
+
+void app_gauge_set_mode(lv_obj_t * obj, app_gauge_mode_t mode) {
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    gauge->mode = mode;
+    value_update(obj, false);
+    lv_obj_invalidate(obj);
+}
+
+void app_gauge_set_value(lv_obj_t * obj, int16_t value) {
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    value = LV_CLAMP(gauge->min_value, value, gauge->max_value);
+    if (value == gauge->value) {
+        return;
+    }
+    gauge->value = value;
+    value_update(obj, true);
+}
+
+int16_t app_gauge_get_value(const lv_obj_t * obj) {
+    return ((const app_gauge_t *)obj)->value;
+}
+
+void app_gauge_set_colors(lv_obj_t * obj, lv_color_t track, lv_color_t indic) {
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    gauge->track_color = track;
+    gauge->indic_color = indic;
+    lv_obj_invalidate(obj);
+}
+
+void app_gauge_set_knob_color(lv_obj_t * obj, lv_color_t color) {
+    app_gauge_t * gauge = (app_gauge_t *)obj;
+    if (lv_color_to16(color) == lv_color_to16(gauge->knob_color)) {
+        return;
+    }
+    gauge->knob_color = color;
+    lv_area_t area;
+    knob_area(obj, gauge->knob_angle, &area);
+    lv_obj_invalidate_area(obj, &area);
+}
@@ -0,0 +1,189 @@
+/*
+ * @file app_gesture.c
+ * @brief Table-driven gesture matcher. Sequences are compiled into a DFA once at startup so that
+ *        matching costs one table lookup per input symbol, regardless of how many gestures are defined.
+ *
+ */
+
+#include "app_include/app_gesture.h"
+
+#define NO_MATCH    (-1)
+#define NO_CHILD    0       // State 0 is the root, which is never a child, so 0 doubles as "no edge" while building
+
+/*---------------------------------------------------------------
+    Compile a gesture table into the matcher's transition table.
+    Sequences are inserted into a trie, then failure links are
+    resolved breadth first so that every state has an outgoing
+    edge for every symbol (Aho-Corasick). Because the matcher
+    resets after each match, a sequence that contains another
+    sequence could never complete and is rejected here.
+---------------------------------------------------------------*/
+esp_err_t app_gesture_compile(app_gesture_matcher_t * matcher, const app_gesture_def_t * defs, int num_defs) {
+
+    uint8_t fail[APP_GESTURE_MAX_STATES] = {0};
+    uint8_t queue[APP_GESTURE_MAX_STATES];
+    bool has_child[APP_GESTURE_MAX_STATES] = {false};
+    int head = 0;
+    int tail = 0;
+
+    memset(matcher, 0, sizeof(app_gesture_matcher_t));
+    matcher->defs = defs;
+    matcher->num_defs = num_defs;
+    matcher->num_states = 1;
+    for (int s = 0; s < APP_GESTURE_MAX_STATES; s++) {
+        matcher->match[s] = NO_MATCH;
+    }
+
+    // Build the trie
+    for (int d = 0; d < num_defs; d++) {
+        if (defs[d].length == 0 || defs[d].length > APP_GESTURE_MAX_LENGTH) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        uint8_t state = 0;
+        for (int i = 0; i < defs[d].length; i++) {
+            app_gesture_sym_t sym = defs[d].seq[i];
+            if (sym >= APP_GESTURE_NUM_SYMS) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            if (matcher->match[state] != NO_MATCH) {
+                return ESP_ERR_INVALID_ARG;     // An earlier sequence is a prefix of this one
+            }
+            if (matcher->next[state][sym] == NO_CHILD) {
+                if (matcher->num_states >= APP_GESTURE_MAX_STATES) {
+                    return ESP_ERR_NO_MEM;
+                }
+                matcher->next[state][sym] = matcher->num_states++;
+            }
+            has_child[state] = true;
+            state = matcher->next[state][sym];
+        }
+        if (has_child[state]) {
+            return ESP_ERR_INVALID_ARG;         // This sequence is a prefix of an earlier one
+        }
+        if (matcher->match[state] != NO_MATCH && defs[matcher->match[state]].id != defs[d].id) {
+            return ESP_ERR_INVALID_ARG;         // Same sequence bound to two different gestures
+        }
+        matcher->match[state] = d;
+    }
+
+    // Resolve failure links breadth first, filling in the missing edges as we go
+    for (int sym = 0; sym < APP_GESTURE_NUM_SYMS; sym++) {
+        uint8_t child = matcher->next[0][sym];
+        if (child != NO_CHILD) {
+            fail[child] = 0;
+            queue[tail++] = child;
+        }
+    }
+    while (head < tail) {
+        uint8_t state = queue[head++];
+        for (int sym = 0; sym < APP_GESTURE_NUM_SYMS; sym++) {
+            uint8_t child = matcher->next[state][sym];
+            if (child != NO_CHILD) {
+                fail[child] = matcher->next[fail[state]][sym];
+                if (matcher->match[child] == NO_MATCH && matcher->match[fail[child]] != NO_MATCH) {
+                    if (has_child[child]) {
+                        return ESP_ERR_INVALID_ARG; // A shorter sequence would always fire inside this one
+                    }
+                    matcher->match[child] = matcher->match[fail[child]];
+                }
+                queue[tail++] = child;
+            }
+            else {
+                matcher->next[state][sym] = matcher->next[fail[state]][sym];
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+/*---------------------------------------------------------------
+    Abandon any partial sequence and forget held switches
+---------------------------------------------------------------*/
+void app_gesture_reset(app_gesture_matcher_t * matcher) {
+    matcher->state = 0;
+    matcher->last_us = 0;
+    matcher->held_mask = 0;
+    matcher->chord_mask = 0;
+}
+
+/*---------------------------------------------------------------
+    Advance the DFA by one symbol. Returns the gesture id if a
+    sequence completed, else APP_GESTURE_NONE.
+---------------------------------------------------------------*/
+int app_gesture_feed(app_gesture_matcher_t * matcher, app_gesture_sym_t sym, int64_t timestamp_us) {
+
+    if (matcher->last_us && (timestamp_us - matcher->last_us) > APP_GESTURE_TIMEOUT_US) {
+        matcher->state = 0;     // Too slow, start over from this symbol
+    }
+    matcher->last_us = timestamp_us;
+    matcher->state = matcher->next[matcher->state][sym];
+
+    int16_t def = matcher->match[matcher->state];
+    if (def != NO_MATCH) {
+        matcher->state = 0;
+        return matcher->defs[def].id;
+    }
+
+    return APP_GESTURE_NONE;
+}
+
+/*---------------------------------------------------------------
+    Raw (debounced) switch edge, used for chord detection only.
+    Taps and long presses arrive through app_gesture_feed_press.
+---------------------------------------------------------------*/
+int app_gesture_feed_switch(app_gesture_matcher_t * matcher, int key, bool pressed, int64_t timestamp_us) {
+
+    const uint8_t all_keys = (1 << APP_GESTURE_KEY_A) | (1 << APP_GESTURE_KEY_B);
+
+    if (pressed) {
+        matcher->held_mask |= (1 << key);
+        if (matcher->held_mask == all_keys) {
+            matcher->chord_mask = all_keys;     // The taps that make up the chord are not gestures of their own
+            return app_gesture_feed(matcher, APP_GESTURE_SYM_CHORD_AB, timestamp_us);
+        }
+    }
+    else {
+        matcher->held_mask &= ~(1 << key);
+    }
+
+    return APP_GESTURE_NONE;
+}
+
+/*---------------------------------------------------------------
+    Classified press (see app_press.h) for one switch
+---------------------------------------------------------------*/
+int app_gesture_feed_press(app_gesture_matcher_t * matcher, int key, uint8_t clicks, bool long_press, int64_t timestamp_us) {
+
+    if (matcher->chord_mask & (1 << key)) {
+        matcher->chord_mask &= ~(1 << key);
+        return APP_GESTURE_NONE;
+    }
+
+    app_gesture_sym_t sym;
+    if (long_press) {
+        sym = (key == APP_GESTURE_KEY_A) ? APP_GESTURE_SYM_LONG_A : APP_GESTURE_SYM_LONG_B;
+    }
+    else if (clicks >= 2) {
+        sym = (key == APP_GESTURE_KEY_A) ? APP_GESTURE_SYM_DOUBLE_A : APP_GESTURE_SYM_DOUBLE_B;
+    }
+    else {
+        sym = (key == APP_GESTURE_KEY_A) ? APP_GESTURE_SYM_TAP_A : APP_GESTURE_SYM_TAP_B;
+    }
+
+    return app_gesture_feed(matcher, sym, timestamp_us);
+}
+
+/*---------------------------------------------------------------
+    Gesture name lookup, for logging
+---------------------------------------------------------------*/
+const char * app_gesture_name(const app_gesture_matcher_t * matcher, int id) {
+
+    for (int d = 0; d < matcher->num_defs; d++) {
+        if (matcher->defs[d].id == id) {
+            return matcher->defs[d].name;
+        }
+    }
+
+    return "?";
+}
@@ -0,0 +1,229 @@
+/*
+ * @file app_glyph_cache.c
+ * @brief Rasterized glyph cache on the draw_ctx's draw_letter, see app_glyph_cache.h.
+ *
+ *        A hit costs the glyph descriptor lookup (a direct cmap table in app_font_ui), the lv_lru hash lookup
+ *        and one masked fill of the glyph box, which lv_draw_sw_blend clips to the strip. A miss unpacks the
+ *        bitmap once, the way lv_draw_sw_letter does, so cached and uncached letters are pixel identical.
+ *
+ */
+
+#include "app_include/app_glyph_cache.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "src/misc/lv_lru.h"
+
+// lv_draw_sw_letter.c's opacity tables, global but in no header
+extern const uint8_t _lv_bpp1_opa_table[2];
+extern const uint8_t _lv_bpp2_opa_table[4];
+extern const uint8_t _lv_bpp4_opa_table[16];
+extern const uint8_t _lv_bpp8_opa_table[256];
+
+typedef struct {
+    const lv_font_t * font;     // g.resolved_font, the font (or fallback) that has the glyph
+    uint32_t letter;
+} glyph_key_t;
+
+typedef struct {
+    uint16_t w;
+    uint16_t h;
+    lv_opa_t mask[];            // A8, w * h
+} glyph_entry_t;
+
+static lv_lru_t * cache = NULL;
+static uint32_t budget = APP_GLYPH_CACHE_BYTES;
+static bool dropping = false;   // Clearing the cache, its frees aren't evictions
+static app_glyph_cache_stats_t stats;
+static lv_draw_ctx_t * hooked_ctx = NULL;
+static void (*orig_draw_letter)(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                                uint32_t letter);
+
+static void entry_free(void * value) {
+    lv_mem_free(value);
+    stats.entries--;
+    if (!dropping) {
+        stats.evictions++;
+    }
+}
+
+static uint32_t entry_cost(uint32_t w, uint32_t h) {
+    return sizeof(glyph_entry_t) + w * h + sizeof(glyph_key_t) + APP_GLYPH_CACHE_ENTRY_OVERHEAD;
+}
+
+/*---------------------------------------------------------------
+    Unpack a glyph bitmap to A8, through the same opacity tables
+    as lv_draw_sw_letter. NULL if the bpp isn't one it draws
+---------------------------------------------------------------*/
+static glyph_entry_t * rasterize(const lv_font_glyph_dsc_t * g, const uint8_t * map_p) {
+
+    const uint8_t * table;
+    uint32_t bpp = (g->bpp == 3) ? 4 : g->bpp;     // As LVGL reads it
+
+    switch (bpp) {
+        case 1: table = _lv_bpp1_opa_table; break;
+        case 2: table = _lv_bpp2_opa_table; break;
+        case 4: table = _lv_bpp4_opa_table; break;
+        case 8: table = _lv_bpp8_opa_table; break;
+        default: return NULL;
+    }
+
+    glyph_entry_t * entry = lv_mem_alloc(sizeof(glyph_entry_t) + (uint32_t)g->box_w * g->box_h);
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->w = g->box_w;
+    entry->h = g->box_h;
+
+    // Rows are packed back to back, not byte aligned
+    uint32_t mask = (1u << bpp) - 1;
+    uint32_t bit = 0;
+    lv_opa_t * out = entry->mask;
+    for (uint32_t i = 0; i < (uint32_t)g->box_w * g->box_h; i++, bit += bpp) {
+        out[i] = table[(map_p[bit >> 3] >> (8 - bpp - (bit & 7))) & mask];
+    }
+    return entry;
+}
+
+/*---------------------------------------------------------------
+    The cached entry of a letter, rasterized on a miss. NULL to
+    leave it to LVGL
+---------------------------------------------------------------*/
+static const glyph_entry_t * lookup(const lv_font_glyph_dsc_t * g, uint32_t letter) {
+
+    glyph_key_t key;
+    lv_memset_00(&key, sizeof(key));    // Hashed and compared as bytes, padding included
+    key.font = g->resolved_font;
+    key.letter = letter;
+
+    void * value = NULL;
+    lv_lru_get(cache, &key, sizeof(key), &value);
+    if (value != NULL) {
+        stats.hits++;
+        return value;
+    }
+
+    const uint8_t * map_p = lv_font_get_glyph_bitmap(g->resolved_font, letter);
+    glyph_entry_t * entry = (map_p != NULL) ? rasterize(g, map_p) : NULL;
+    if (entry == NULL) {
+        return NULL;
+    }
+    if (lv_lru_set(cache, &key, sizeof(key), entry, entry_cost(entry->w, entry->h)) != LV_LRU_OK) {
+        lv_mem_free(entry);     // Bigger than the whole budget
+        return NULL;
+    }
+    stats.misses++;
+    stats.entries++;
+    return entry;
+}
+
+static void cache_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                              uint32_t letter) {
+
+    lv_font_glyph_dsc_t g;
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    if (cache == NULL) {
+        orig_draw_letter(draw_ctx, dsc, pos_p, letter);
+        return;
+    }
+    if (dsc->opa < LV_OPA_MAX || disp == NULL || !disp->driver->antialiasing ||
+        !lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0') || g.resolved_font == NULL || g.resolved_font->subpx) {
+        stats.bypassed++;
+        orig_draw_letter(draw_ctx, dsc, pos_p, letter);
+        return;
+    }
+    if (g.box_w == 0 || g.box_h == 0) {
+        return;     // Space
+    }
+
+    // Glyph box, placed as lv_draw_sw_letter does
+    lv_area_t box;
+    box.x1 = pos_p->x + g.ofs_x;
+    box.y1 = pos_p->y + (dsc->font->line_height - dsc->font->base_line) - g.box_h - g.ofs_y;
+    box.x2 = box.x1 + g.box_w - 1;
+    box.y2 = box.y1 + g.box_h - 1;
+    if (!_lv_area_is_on(&box, draw_ctx->clip_area)) {
+        return;
+    }
+    if (lv_draw_mask_is_any(&box)) {
+        stats.bypassed++;
+        orig_draw_letter(draw_ctx, dsc, pos_p, letter);
+        return;
+    }
+
+    const glyph_entry_t * entry = lookup(&g, letter);
+    if (entry == NULL) {
+        stats.bypassed++;
+        orig_draw_letter(draw_ctx, dsc, pos_p, letter);
+        return;
+    }
+
+    // One masked fill of the box, clipped by the blend. lv_draw_sw_blend only writes the mask without anti-aliasing
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &box;
+    blend_dsc.mask_area = &box;
+    blend_dsc.mask_buf = (lv_opa_t *)entry->mask;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+}
+
+/*---------------------------------------------------------------
+    Hook the default display's draw_ctx, after the display is
+    registered
+---------------------------------------------------------------*/
+void app_glyph_cache_init(void) {
+
+    lv_disp_t * disp = lv_disp_get_default();
+    if (disp != NULL && hooked_ctx == NULL) {
+        hooked_ctx = disp->driver->draw_ctx;
+        orig_draw_letter = hooked_ctx->draw_letter;
+        hooked_ctx->draw_letter = cache_draw_letter;
+        app_glyph_cache_set_budget(budget);
+    }
+}
+
+/*---------------------------------------------------------------
+    Drop the cache and start a new one with this budget. Less
+    than one average entry (0) turns it off
+---------------------------------------------------------------*/
+void app_glyph_cache_set_budget(uint32_t bytes) {
+
+    if (cache != NULL) {
+        dropping = true;
+        lv_lru_del(cache);
+        dropping = false;
+        cache = NULL;
+    }
+    budget = bytes;
+    if (budget >= APP_GLYPH_CACHE_AVG_ENTRY) {
+        cache = lv_lru_create(budget, APP_GLYPH_CACHE_AVG_ENTRY, entry_free, NULL);
+    }
+}
+
+void app_glyph_cache_get_stats(app_glyph_cache_stats_t * out) {
+    *out = stats;
+    out->budget = (cache != NULL) ? budget : 0;
+    out->bytes = (cache != NULL) ? cache->total_memory - cache->free_memory : 0;
+}
+
+// Counters only, the entries stay
+void app_glyph_cache_reset_stats(void) {
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+    stats.bypassed = 0;
+}
+
+void app_glyph_cache_log_stats(const char * TAG) {
+
+    app_glyph_cache_stats_t s;
+    app_glyph_cache_get_stats(&s);
+    uint32_t lookups = s.hits + s.misses;
+    ESP_LOGI(TAG, "Glyph cache: %lu hits, %lu misses (%lu.%lu%% hit), %lu evictions, %lu bypassed, %lu entries %lu/%lu bytes",
+             (unsigned long)s.hits, (unsigned long)s.misses, (unsigned long)(lookups ? s.hits * 100ULL / lookups : 0),
+             (unsigned long)(lookups ? s.hits * 1000ULL / lookups % 10 : 0), (unsigned long)s.evictions,
+             (unsigned long)s.bypassed, (unsigned long)s.entries, (unsigned long)s.bytes, (unsigned long)s.budget);
+}
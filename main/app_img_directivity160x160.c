@@ -1,357 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_APP_IMG_DIRECTIVITY160X160
-#define LV_ATTRIBUTE_IMG_APP_IMG_DIRECTIVITY160X160
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_APP_IMG_DIRECTIVITY160X160 uint8_t app_img_directivity160x160_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe7, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe8, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x3d, 0x10, 0x3d, 0xb2, 0x46, 0x34, 0x4e, 0x15, 0x66, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xed, 0x35, 0x0f, 0x35, 0xf2, 0x36, 0x34, 0x36, 0x34, 0x36, 0x35, 0x3e, 0x36, 0x5e, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0a, 0x2c, 0x6e, 0x35, 0xf3, 0x36, 0x34, 0x36, 0x34, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x16, 0x3e, 0x57, 0x86, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x0a, 0x24, 0x2d, 0x2d, 0x71, 0x36, 0x14, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x35, 0x2e, 0x16, 0x26, 0x16, 0x2e, 0x37, 0x5e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x4c, 0x23, 0xab, 0x2d, 0x10, 0x35, 0xd3, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x35, 0x2e, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x26, 0x17, 0x4e, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xab, 0x1a, 0xc9, 0x24, 0x2d, 0x2d, 0x93, 0x2e, 0x14, 0x2e, 0x35, 0x2e, 0x36, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x16, 0x17, 0x16, 0x18, 0x2e, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0x68, 0x1b, 0x0a, 0x2c, 0xf0, 0x2d, 0xd4, 0x2e, 0x15, 0x2e, 0x16, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0xf8, 0x2e, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xca, 0x12, 0x68, 0x1b, 0xed, 0x2d, 0x52, 0x2d, 0xf5, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xf8, 0x0d, 0xf9, 0x1e, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe7, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x12, 0x28, 0x13, 0x0a, 0x24, 0x90, 0x25, 0xb4, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x16, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x1d, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x89, 0x12, 0x68, 0x1b, 0x8d, 0x24, 0xf2, 0x25, 0xd5, 0x1e, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xda, 0x1d, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x12, 0x28, 0x12, 0xaa, 0x1c, 0x2f, 0x1d, 0x54, 0x1d, 0xf6, 0x15, 0xf7, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xf9, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0xba, 0x35, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xaa, 0x12, 0x28, 0x13, 0x0b, 0x14, 0x91, 0x15, 0x75, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0xba, 0x1d, 0xbb, 0x3d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6b, 0x3d, 0x72, 0x5d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x28, 0x0a, 0x28, 0x0b, 0x6d, 0x14, 0xd3, 0x15, 0xb6, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xda, 0x0d, 0xba, 0x15, 0xba, 0x15, 0x9b, 0x1d, 0x9b, 0x45, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xab, 0x2c, 0x8e, 0x35, 0x71, 0x35, 0xf2, 0x46, 0x34, 0x96, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xcc, 0x09, 0xe7, 0x0a, 0x49, 0x0b, 0xcf, 0x0d, 0x14, 0x0d, 0xb7, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0xbb, 0x15, 0x9b, 0x1d, 0x9b, 0x25, 0x9c, 0x4d, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe7, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x23, 0xac, 0x2c, 0xaf, 0x35, 0xb2, 0x35, 0xf3, 0x35, 0xd3, 0x66, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x69, 0x09, 0xe7, 0x02, 0xab, 0x0c, 0x31, 0x05, 0x56, 0x05, 0xb8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xda, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0x9b, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7c, 0x2d, 0x7c, 0x86, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe8, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xa9, 0x1a, 0xea, 0x23, 0xcc, 0x2c, 0xf0, 0x35, 0xb2, 0x35, 0xb2, 0x2d, 0x72, 0x45, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x12, 0x08, 0x02, 0x08, 0x03, 0x2d, 0x04, 0x93, 0x05, 0x77, 0x05, 0xb9, 0x05, 0xd9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0xba, 0x15, 0x9b, 0x15, 0x7a, 0x15, 0x7a, 0x1d, 0x5b, 0x25, 0x5c, 0x2d, 0x7c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa9, 0x12, 0x68, 0x1b, 0x0a, 0x23, 0xed, 0x2c, 0xaf, 0x2d, 0x10, 0x2d, 0x10, 0x24, 0xf0, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x4d, 0x09, 0xe8, 0x02, 0x49, 0x03, 0x8f, 0x04, 0xd4, 0x05, 0x78, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0xbb, 0x15, 0x59, 0x0c, 0xf6, 0x05, 0x99, 0x0d, 0x79, 0x15, 0x5a, 0x25, 0x5c, 0x35, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x2a, 0x12, 0x27, 0x12, 0x68, 0x1b, 0x2a, 0x23, 0xcc, 0x24, 0x4e, 0x24, 0x6e, 0x24, 0x8f, 0x24, 0x90, 0x34, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x8a, 0x02, 0x08, 0x02, 0x8b, 0x03, 0xd1, 0x04, 0xf6, 0x0d, 0x79, 0x0d, 0xba, 0x15, 0xba, 0x15, 0xbb, 0x14, 0xd7, 0x04, 0x94, 0x05, 0xb9, 0x0d, 0xba, 0x15, 0xba, 0x15, 0x7a, 0x25, 0x5b, 0x3d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x12, 0x07, 0x12, 0x07, 0x12, 0x88, 0x1b, 0x2b, 0x1b, 0xac, 0x23, 0xed, 0x24, 0x0e, 0x1c, 0x0e, 0x24, 0x4f, 0x55, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4a, 0x02, 0x08, 0x02, 0xcc, 0x04, 0x33, 0x0d, 0x17, 0x0d, 0x79, 0x15, 0x9a, 0x15, 0xbb, 0x14, 0xd7, 0x04, 0x33, 0x0d, 0x79, 0x0d, 0xba, 0x15, 0xbb, 0x15, 0x9b, 0x1d, 0x7b, 0x25, 0x5c, 0x4d, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x28, 0x09, 0xe7, 0x12, 0x27, 0x12, 0xa9, 0x1b, 0x2b, 0x1b, 0x8c, 0x1b, 0xad, 0x1b, 0xcd, 0x1b, 0xce, 0x1c, 0x0f, 0x75, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x02, 0x09, 0x03, 0x0e, 0x0c, 0x54, 0x0d, 0x38, 0x15, 0x7a, 0x1d, 0x9b, 0x1d, 0x19, 0x0b, 0x90, 0x0d, 0x17, 0x0d, 0x9a, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x7c, 0x2d, 0x5c, 0x87, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x69, 0x09, 0xe7, 0x09, 0xe7, 0x12, 0x28, 0x12, 0xa9, 0x13, 0x0b, 0x1b, 0x4b, 0x1b, 0x6c, 0x1b, 0xad, 0x13, 0xae, 0x24, 0x10, 0x76, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x91, 0x2d, 0xb5, 0x3e, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6e, 0x09, 0xe9, 0x0a, 0x2a, 0x0b, 0x4f, 0x14, 0x95, 0x15, 0x39, 0x1d, 0x7b, 0x1d, 0x5a, 0x0b, 0x50, 0x0c, 0x33, 0x15, 0x59, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x3b, 0x1d, 0x39, 0x1d, 0x79, 0x3d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe7, 0x08, 0x61, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10, 0x09, 0xe8, 0x09, 0xc7, 0x09, 0xe7, 0x12, 0x28, 0x12, 0xa9, 0x12, 0xea, 0x13, 0x2b, 0x13, 0x4c, 0x13, 0x6d, 0x0b, 0x8e, 0x34, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x13, 0xce, 0x1c, 0xf3, 0x1d, 0xd6, 0x1d, 0xf8, 0x1d, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x0c, 0x09, 0xe9, 0x0a, 0x4b, 0x0b, 0x91, 0x14, 0xb7, 0x1d, 0x3a, 0x1d, 0x7c, 0x13, 0xf4, 0x0b, 0x4f, 0x14, 0xf7, 0x15, 0x7a, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x7c, 0x1c, 0xb8, 0x15, 0x18, 0x15, 0x9b, 0x1d, 0x9b, 0x2d, 0x7b, 0x87, 0xff, 0x00, 0x00, 0x2d, 0xb8, 0x2e, 0x1a, 0x46, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x08, 0x61, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28, 0x09, 0xc7, 0x09, 0xc7, 0x09, 0xe7, 0x0a, 0x48, 0x12, 0xaa, 0x12, 0xca, 0x13, 0x0b, 0x13, 0x2c, 0x0b, 0x4d, 0x0b, 0x8e, 0x44, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x4c, 0x14, 0x30, 0x15, 0x54, 0x0d, 0xd7, 0x0d, 0xf8, 0x15, 0xf9, 0x2e, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2a, 0x09, 0xc9, 0x0a, 0x6b, 0x13, 0xd3, 0x1c, 0xd8, 0x1d, 0x3b, 0x1c, 0xb8, 0x0a, 0xce, 0x14, 0x13, 0x15, 0x19, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x7c, 0x1c, 0x56, 0x14, 0xb6, 0x15, 0x9a, 0x1d, 0x9b, 0x1d, 0x7c, 0x2d, 0x7c, 0x2c, 0x10, 0x0d, 0x16, 0x0d, 0xd9, 0x15, 0xba, 0x35, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x08, 0x41, 0x31, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x37, 0x1d, 0x37, 0x6e, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x69, 0x01, 0xc7, 0x09, 0xc7, 0x09, 0xc7, 0x09, 0xe7, 0x0a, 0x49, 0x0a, 0x8a, 0x0a, 0xcb, 0x0a, 0xeb, 0x0b, 0x0c, 0x03, 0x2d, 0x1b, 0xaf, 0x85, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xec, 0x0b, 0x2c, 0x0c, 0x51, 0x0d, 0x55, 0x0d, 0xd7, 0x05, 0xf8, 0x0d, 0xd9, 0x1d, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x0a, 0x09, 0xc9, 0x0a, 0x8d, 0x13, 0xf4, 0x1c, 0xd9, 0x1d, 0x3b, 0x13, 0x72, 0x0b, 0x0f, 0x14, 0x97, 0x1d, 0x3a, 0x1d, 0x5b, 0x25, 0x5c, 0x1c, 0x15, 0x13, 0xf3, 0x15, 0x59, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x5c, 0x1c, 0x56, 0x04, 0x32, 0x05, 0x98, 0x0d, 0xba, 0x1d, 0xba, 0x76, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7a, 0x2d, 0x5b, 0x35, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xa7, 0x08, 0x41, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xcf, 0x14, 0x94, 0x0d, 0x17, 0x35, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x01, 0xc7, 0x01, 0xc7, 0x09, 0xc7, 0x0a, 0x08, 0x0a, 0x49, 0x0a, 0x8a, 0x0a, 0xab, 0x02, 0xeb, 0x03, 0x0c, 0x03, 0x2d, 0x34, 0x31, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x8a, 0x0a, 0xec, 0x0c, 0x30, 0x0d, 0x55, 0x05, 0xb8, 0x05, 0xd9, 0x05, 0xd9, 0x15, 0xda, 0x2d, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x11, 0xe9, 0x09, 0xc9, 0x12, 0xae, 0x1c, 0x15, 0x1c, 0xfa, 0x1c, 0x98, 0x12, 0xad, 0x13, 0xb2, 0x1c, 0xd9, 0x1d, 0x3b, 0x25, 0x5c, 0x1c, 0x77, 0x0b, 0x30, 0x14, 0xd7, 0x1d, 0x5a, 0x1d, 0x5b, 0x25, 0x5c, 0x1c, 0x15, 0x03, 0x2e, 0x04, 0xf6, 0x0d, 0x9a, 0x15, 0x9b, 0x25, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x13, 0x1c, 0xf9, 0x25, 0x3b, 0x45, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x54, 0x12, 0xad, 0x42, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcd, 0x0c, 0x33, 0x0c, 0xf7, 0x1c, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x8b, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x02, 0x08, 0x02, 0x49, 0x02, 0x8a, 0x02, 0xab, 0x02, 0xcc, 0x02, 0xed, 0x13, 0x4e, 0x5c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x12, 0x49, 0x02, 0xab, 0x03, 0xf0, 0x05, 0x35, 0x05, 0xb8, 0x05, 0xd9, 0x05, 0xba, 0x15, 0xda, 0x25, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0c, 0x11, 0xa9, 0x09, 0xca, 0x12, 0xf0, 0x1c, 0x57, 0x24, 0xda, 0x1b, 0x72, 0x12, 0xad, 0x1c, 0x36, 0x1c, 0xfa, 0x25, 0x3b, 0x24, 0xda, 0x12, 0xce, 0x14, 0x14, 0x1d, 0x19, 0x1d, 0x3b, 0x25, 0x5c, 0x1c, 0x36, 0x02, 0x8b, 0x0c, 0x33, 0x0d, 0x38, 0x15, 0x7a, 0x1d, 0x5b, 0x35, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x30, 0x1c, 0x97, 0x1c, 0xfa, 0x2c, 0xfb, 0x87, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x53, 0x1c, 0xf8, 0x1d, 0x19, 0x34, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6b, 0x0a, 0xad, 0x0c, 0x13, 0x14, 0x96, 0x24, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0a, 0x08, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc8, 0x02, 0x08, 0x02, 0x49, 0x02, 0x6a, 0x02, 0x8b, 0x02, 0xcc, 0x02, 0xed, 0x23, 0xb0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x75, 0x12, 0x29, 0x02, 0x6a, 0x03, 0xaf, 0x05, 0x15, 0x05, 0x98, 0x05, 0xb9, 0x0d, 0xba, 0x15, 0xba, 0x25, 0xbb, 0x84, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xae, 0x11, 0xc9, 0x09, 0xea, 0x13, 0x31, 0x24, 0x78, 0x24, 0x58, 0x12, 0x4d, 0x13, 0x31, 0x1c, 0x78, 0x24, 0xfb, 0x24, 0xfc, 0x13, 0x31, 0x13, 0x30, 0x1c, 0x98, 0x1d, 0x1a, 0x25, 0x3b, 0x1c, 0x99, 0x0a, 0x2b, 0x0b, 0x2f, 0x0c, 0xb6, 0x15, 0x59, 0x1d, 0x5b, 0x25, 0x3b, 0x65, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xce, 0x1c, 0x15, 0x1c, 0xd9, 0x24, 0xba, 0x45, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x23, 0x50, 0x1c, 0x76, 0x1c, 0xd9, 0x24, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe9, 0x0a, 0xac, 0x0b, 0xf2, 0x14, 0x35, 0x24, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xe8, 0x02, 0x09, 0x02, 0x4a, 0x02, 0x6a, 0x02, 0x8b, 0x02, 0xac, 0x0b, 0x0e, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x10, 0x09, 0xe8, 0x02, 0x29, 0x03, 0x6f, 0x04, 0xd5, 0x05, 0x79, 0x0d, 0xba, 0x15, 0xbb, 0x15, 0x9b, 0x25, 0x9c, 0x4d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xec, 0x11, 0xc9, 0x12, 0x0b, 0x1b, 0x53, 0x24, 0x79, 0x1b, 0x52, 0x12, 0x2c, 0x1b, 0xb4, 0x24, 0x99, 0x24, 0xfb, 0x1b, 0xf6, 0x12, 0x8d, 0x1b, 0xf5, 0x1c, 0xd9, 0x24, 0xfb, 0x24, 0xba, 0x0a, 0x6c, 0x0a, 0x6b, 0x14, 0x13, 0x14, 0xf8, 0x1d, 0x3a, 0x25, 0x1b, 0x35, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x6c, 0x1b, 0xb3, 0x1c, 0x99, 0x24, 0x99, 0x34, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x12, 0xad, 0x14, 0x14, 0x1c, 0x98, 0x24, 0x58, 0x44, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x64, 0x10, 0x09, 0xe9, 0x0a, 0xad, 0x13, 0xb2, 0x13, 0xf4, 0x24, 0x15, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x09, 0xc9, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x29, 0x02, 0x4a, 0x02, 0x6b, 0x0a, 0x8c, 0x0a, 0xad, 0x23, 0x4f, 0xae, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xab, 0x09, 0xc8, 0x02, 0x29, 0x03, 0x4e, 0x0c, 0x95, 0x0d, 0x59, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x9b, 0x25, 0x7c, 0x4d, 0xde, 0x00, 0x00, 0x00, 0x00, 0x32, 0x8c, 0x11, 0xc9, 0x12, 0x2c, 0x1b, 0x94, 0x24, 0x39, 0x12, 0x8e, 0x12, 0x8e, 0x1c, 0x16, 0x24, 0xba, 0x24, 0x9a, 0x12, 0x6d, 0x13, 0x30, 0x1c, 0x77, 0x24, 0xda, 0x24, 0xdb, 0x13, 0x10, 0x09, 0xe9, 0x0b, 0x2f, 0x14, 0x76, 0x1c, 0xf9, 0x25, 0x1b, 0x24, 0xfb, 0x4d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x13, 0x52, 0x1c, 0x58, 0x24, 0x79, 0x2c, 0x7a, 0x6c, 0xdf, 0x31, 0xaa, 0x0a, 0x4c, 0x13, 0xd3, 0x1c, 0x57, 0x24, 0x37, 0x4c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x0a, 0x09, 0xe9, 0x0a, 0xcd, 0x13, 0x92, 0x1b, 0xd4, 0x34, 0x35, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe9, 0x09, 0xc8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe9, 0x02, 0x2a, 0x0a, 0x4a, 0x0a, 0x6b, 0x0a, 0x8c, 0x12, 0xce, 0x43, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x4d, 0x09, 0xc8, 0x02, 0x2a, 0x03, 0x0e, 0x0c, 0x54, 0x15, 0x39, 0x15, 0x7a, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x7c, 0x3d, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x32, 0x8d, 0x11, 0xca, 0x12, 0x6e, 0x1b, 0xb6, 0x1b, 0xb6, 0x12, 0x0c, 0x1b, 0x11, 0x24, 0x38, 0x24, 0xbb, 0x1b, 0x53, 0x12, 0x4c, 0x1b, 0xd4, 0x24, 0x79, 0x24, 0xdb, 0x1b, 0xb5, 0x09, 0xc9, 0x0a, 0x6c, 0x13, 0xd3, 0x1c, 0xb8, 0x1c, 0xfa, 0x24, 0xdb, 0x34, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x11, 0xc9, 0x12, 0xf0, 0x1c, 0x17, 0x24, 0x58, 0x24, 0x39, 0x44, 0xdb, 0x21, 0xc9, 0x0a, 0x2b, 0x13, 0x92, 0x1c, 0x16, 0x24, 0x17, 0x34, 0x37, 0x00, 0x00, 0x00, 0x00, 0x11, 0xc8, 0x09, 0xe9, 0x12, 0xce, 0x13, 0x92, 0x1b, 0xb3, 0x44, 0x56, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc9, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xa8, 0x09, 0xc8, 0x09, 0xe9, 0x0a, 0x0a, 0x0a, 0x4b, 0x0a, 0x6c, 0x12, 0x8d, 0x23, 0x2f, 0x9e, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6e, 0x12, 0x2a, 0x0a, 0x0a, 0x0a, 0xee, 0x14, 0x34, 0x15, 0x19, 0x1d, 0x5b, 0x1d, 0x7c, 0x25, 0x5c, 0x25, 0x5c, 0x35, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6c, 0x11, 0xea, 0x1a, 0x8f, 0x23, 0xd7, 0x1b, 0x12, 0x12, 0x0c, 0x1b, 0x74, 0x24, 0x59, 0x24, 0x18, 0x12, 0x2c, 0x12, 0xd0, 0x1c, 0x17, 0x24, 0x9a, 0x24, 0x39, 0x0a, 0x0b, 0x09, 0xe9, 0x13, 0x10, 0x1c, 0x56, 0x1c, 0xda, 0x24, 0xdb, 0x2c, 0xbb, 0x44, 0xbc, 0x00, 0x00, 0x09, 0x89, 0x12, 0xaf, 0x1b, 0xd6, 0x24, 0x18, 0x24, 0x19, 0x2c, 0x5b, 0x19, 0xc9, 0x0a, 0x2b, 0x13, 0x72, 0x1b, 0xf5, 0x23, 0xf6, 0x23, 0xf7, 0x00, 0x00, 0x43, 0x0c, 0x09, 0xa8, 0x09, 0xea, 0x12, 0xcf, 0x13, 0x72, 0x1b, 0x93, 0x4c, 0x57, 0x00, 0x00, 0x2a, 0x4b, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xc9, 0x09, 0xe9, 0x0a, 0x0a, 0x0a, 0x2b, 0x0a, 0x4c, 0x1a, 0xae, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x1a, 0x0a, 0x0a, 0x0a, 0x0a, 0xad, 0x13, 0xd3, 0x1c, 0xd8, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x2d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x32, 0x8c, 0x11, 0xcb, 0x1a, 0xb1, 0x23, 0xb7, 0x12, 0x4e, 0x12, 0x4e, 0x23, 0xb6, 0x24, 0x5a, 0x1a, 0xf2, 0x12, 0x0c, 0x1b, 0x73, 0x24, 0x58, 0x24, 0x7a, 0x12, 0xd0, 0x09, 0xa8, 0x12, 0x4c, 0x1b, 0xb3, 0x1c, 0x78, 0x24, 0xba, 0x2c, 0x9b, 0x34, 0x9c, 0x00, 0x00, 0x19, 0xe9, 0x12, 0x6e, 0x1b, 0xb5, 0x24, 0x18, 0x24, 0x19, 0x34, 0x3a, 0x11, 0xea, 0x0a, 0x0b, 0x1b, 0x32, 0x1b, 0xd5, 0x23, 0xd6, 0x2b, 0xd7, 0x00, 0x00, 0x2a, 0x4b, 0x09, 0xa9, 0x0a, 0x0a, 0x12, 0xef, 0x1b, 0x52, 0x23, 0x94, 0x85, 0x7b, 0x00, 0x00, 0x11, 0xc9, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x0a, 0x09, 0x0a, 0xac, 0x13, 0x6f, 0x13, 0x6f, 0x12, 0x8d, 0x2a, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x92, 0x1d, 0x14, 0x35, 0xd8, 0x5d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x2a, 0x09, 0xe9, 0x0a, 0x8c, 0x13, 0xb2, 0x1c, 0xb8, 0x1d, 0x1b, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x1c, 0x35, 0x1d, 0x84, 0x1f, 0x00, 0x00, 0x21, 0xcb, 0x11, 0xec, 0x1a, 0xf3, 0x23, 0x55, 0x11, 0xec, 0x1a, 0xb0, 0x23, 0xf8, 0x23, 0xf8, 0x12, 0x0c, 0x12, 0x8e, 0x23, 0xd6, 0x24, 0x5a, 0x1b, 0x95, 0x09, 0xa9, 0x09, 0xca, 0x12, 0xcf, 0x1c, 0x16, 0x24, 0x9a, 0x24, 0x9b, 0x2c, 0x7c, 0x4c, 0xbe, 0x32, 0x4a, 0x12, 0x2c, 0x1b, 0x54, 0x23, 0xf7, 0x23, 0xf9, 0x2b, 0xfa, 0x1a, 0x2c, 0x11, 0xeb, 0x1b, 0x11, 0x1b, 0xb5, 0x23, 0x96, 0x2b, 0xb7, 0x00, 0x00, 0x11, 0xa9, 0x09, 0xa9, 0x0a, 0x0b, 0x12, 0xf0, 0x1b, 0x32, 0x23, 0x74, 0x00, 0x00, 0x22, 0x0a, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x0a, 0x09, 0x0b, 0x0c, 0x14, 0x71, 0x15, 0x54, 0x15, 0x55, 0x1c, 0x73, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x13, 0xcf, 0x0c, 0xb2, 0x0d, 0x76, 0x15, 0xf8, 0x15, 0xf9, 0x36, 0x3a, 0x46, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xab, 0x11, 0xe9, 0x0a, 0x4c, 0x13, 0x51, 0x1c, 0x77, 0x24, 0xfb, 0x25, 0x1c, 0x25, 0x1d, 0x2d, 0x1d, 0x35, 0x1d, 0x5d, 0x7f, 0x00, 0x00, 0x19, 0xcb, 0x12, 0x0d, 0x22, 0xf3, 0x1a, 0xb2, 0x11, 0xeb, 0x1a, 0xf3, 0x23, 0xf9, 0x1a, 0xf3, 0x11, 0xcb, 0x1b, 0x12, 0x24, 0x18, 0x24, 0x19, 0x12, 0x2c, 0x09, 0x88, 0x12, 0x2c, 0x1b, 0x73, 0x24, 0x58, 0x24, 0x7b, 0x2c, 0x5c, 0x3c, 0x7c, 0x42, 0x08, 0x11, 0xeb, 0x1b, 0x12, 0x23, 0xb7, 0x23, 0xd9, 0x2b, 0xb9, 0x12, 0x2e, 0x11, 0xeb, 0x1b, 0x11, 0x1b, 0x95, 0x23, 0x76, 0x33, 0xb7, 0x00, 0x00, 0x11, 0xa9, 0x09, 0xa9, 0x12, 0x2c, 0x12, 0xf0, 0x1b, 0x32, 0x23, 0x74, 0x00, 0x00, 0x11, 0xa9, 0x09, 0x89, 0x09, 0x88, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xe8, 0x0a, 0x49, 0x0a, 0xeb, 0x0b, 0xce, 0x14, 0x91, 0x0c, 0xb2, 0x24, 0xf4, 0xa6, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x4d, 0x0b, 0xcf, 0x0c, 0xb3, 0x05, 0x76, 0x05, 0xb8, 0x05, 0xd9, 0x15, 0xda, 0x25, 0xba, 0x46, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0c, 0x11, 0xc9, 0x0a, 0x0b, 0x12, 0xf0, 0x1c, 0x16, 0x24, 0xdb, 0x25, 0x1c, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x4d, 0x3d, 0x00, 0x00, 0x19, 0xcb, 0x11, 0xed, 0x22, 0xf4, 0x1a, 0x4f, 0x11, 0xec, 0x23, 0x55, 0x2b, 0xd9, 0x12, 0x2e, 0x12, 0x0d, 0x23, 0x75, 0x24, 0x1a, 0x1b, 0x13, 0x09, 0x89, 0x09, 0xa9, 0x12, 0xaf, 0x23, 0xd6, 0x24, 0x5a, 0x2c, 0x5b, 0x34, 0x3c, 0x44, 0x18, 0x11, 0xcb, 0x1a, 0xd1, 0x23, 0x97, 0x23, 0xb8, 0x2b, 0x98, 0x12, 0x0d, 0x11, 0xca, 0x1a, 0xf1, 0x1b, 0x75, 0x23, 0x56, 0x33, 0x97, 0x73, 0x72, 0x09, 0x89, 0x09, 0xa9, 0x12, 0x2c, 0x1a, 0xf1, 0x1b, 0x13, 0x3b, 0xd5, 0x5a, 0xab, 0x11, 0xa9, 0x09, 0x89, 0x09, 0x89, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xe8, 0x0a, 0x49, 0x0a, 0xcb, 0x0b, 0x4d, 0x03, 0xcf, 0x1c, 0x72, 0xc7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcb, 0x03, 0x4e, 0x04, 0x52, 0x05, 0x36, 0x05, 0x98, 0x05, 0xb9, 0x0d, 0xba, 0x1d, 0xba, 0x2d, 0xbb, 0x5d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xab, 0x11, 0xc9, 0x11, 0xea, 0x12, 0x8e, 0x1b, 0xd5, 0x24, 0x9a, 0x24, 0xdc, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x44, 0xde, 0x00, 0x00, 0x19, 0xec, 0x1a, 0x2f, 0x22, 0xf4, 0x12, 0x0e, 0x1a, 0x2e, 0x23, 0x77, 0x1b, 0x34, 0x12, 0xcf, 0x1b, 0x12, 0x23, 0xb8, 0x23, 0xb8, 0x11, 0xeb, 0x09, 0x68, 0x11, 0xeb, 0x1b, 0x33, 0x24, 0x19, 0x2c, 0x3b, 0x2c, 0x1c, 0x3c, 0x3e, 0x11, 0xaa, 0x1a, 0x90, 0x23, 0x76, 0x23, 0x98, 0x23, 0x78, 0x11, 0xed, 0x11, 0xca, 0x1a, 0xd0, 0x1b, 0x54, 0x23, 0x56, 0x33, 0x98, 0x32, 0xac, 0x09, 0x89, 0x09, 0xa9, 0x12, 0x4d, 0x1a, 0xd1, 0x23, 0x13, 0x5c, 0x18, 0x19, 0xca, 0x09, 0x89, 0x09, 0x89, 0x09, 0x88, 0x01, 0xa8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x02, 0x08, 0x02, 0x49, 0x02, 0x8a, 0x03, 0x0d, 0x1b, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x8a, 0x02, 0xcc, 0x03, 0xb0, 0x04, 0xb4, 0x05, 0x57, 0x0d, 0x99, 0x0d, 0xba, 0x15, 0xbb, 0x1d, 0x9b, 0x35, 0xbb, 0x84, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x19, 0xea, 0x11, 0xa9, 0x12, 0x4d, 0x1b, 0x94, 0x24, 0x7a, 0x2c, 0xbc, 0x2c, 0xdd, 0x2c, 0xbe, 0x34, 0x9e, 0x3c, 0xbd, 0x00, 0x00, 0x19, 0xec, 0x1a, 0x30, 0x1a, 0xb3, 0x11, 0xcc, 0x1a, 0x4f, 0x12, 0xae, 0x0c, 0x75, 0x14, 0xd8, 0x24, 0x17, 0x2b, 0xd9, 0x1a, 0x91, 0x09, 0x69, 0x11, 0x89, 0x12, 0x6f, 0x23, 0xb7, 0x2c, 0x1b, 0x2c, 0x1c, 0x33, 0xfd, 0x11, 0x69, 0x1a, 0x2e, 0x23, 0x35, 0x23, 0x78, 0x23, 0x58, 0x11, 0xed, 0x11, 0xaa, 0x1a, 0xb0, 0x23, 0x34, 0x23, 0x36, 0x33, 0x77, 0x19, 0xea, 0x09, 0x69, 0x11, 0xaa, 0x12, 0x4e, 0x1a, 0xd2, 0x2b, 0x14, 0xff, 0xff, 0x11, 0x89, 0x09, 0x89, 0x09, 0x89, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x29, 0x02, 0x6a, 0x0a, 0xcc, 0x2b, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xcb, 0x0a, 0x6a, 0x02, 0xec, 0x03, 0xf1, 0x0c, 0xf6, 0x0d, 0x79, 0x15, 0x9a, 0x1d, 0x9b, 0x1d, 0x7b, 0x25, 0x7b, 0x3d, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x19, 0xea, 0x11, 0x89, 0x12, 0x0c, 0x1b, 0x33, 0x24, 0x39, 0x2c, 0x9c, 0x2c, 0x9d, 0x24, 0x19, 0x2c, 0x7c, 0x34, 0x7c, 0xff, 0xff, 0x21, 0xed, 0x1a, 0x31, 0x1a, 0x52, 0x11, 0xac, 0x09, 0xca, 0x0a, 0xad, 0x14, 0x54, 0x1c, 0xf9, 0x24, 0x7a, 0x23, 0x77, 0x11, 0xab, 0x09, 0x69, 0x11, 0xcb, 0x1b, 0x13, 0x2b, 0xfa, 0x2c, 0x1c, 0x33, 0xdc, 0x32, 0xf2, 0x19, 0xed, 0x22, 0xf4, 0x23, 0x58, 0x23, 0x38, 0x11, 0xed, 0x11, 0xaa, 0x1a, 0x90, 0x23, 0x14, 0x23, 0x36, 0x33, 0x58, 0x19, 0xca, 0x09, 0x69, 0x11, 0xaa, 0x1a, 0x4f, 0x1a, 0xd2, 0x2b, 0x14, 0x22, 0x0a, 0x11, 0x69, 0x09, 0x89, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x09, 0x02, 0x4b, 0x12, 0xcd, 0x65, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0c, 0x12, 0x49, 0x02, 0x4a, 0x03, 0x0e, 0x0c, 0x33, 0x15, 0x18, 0x15, 0x5a, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x5c, 0x2d, 0x5c, 0x45, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6c, 0x11, 0x89, 0x11, 0xcb, 0x1a, 0xf1, 0x23, 0xf9, 0x2c, 0x7c, 0x23, 0x96, 0x23, 0xf7, 0x2c, 0x9c, 0x3c, 0xbd, 0x84, 0x1f, 0x21, 0xed, 0x1a, 0x31, 0x1a, 0x30, 0x09, 0x89, 0x09, 0xa8, 0x0a, 0x6c, 0x13, 0xf4, 0x1c, 0xd9, 0x24, 0x9b, 0x1a, 0x70, 0x11, 0x69, 0x11, 0x8a, 0x1a, 0x4f, 0x23, 0x77, 0x2b, 0xfc, 0x2b, 0xdd, 0x33, 0x7a, 0x11, 0xab, 0x1a, 0xb3, 0x23, 0x38, 0x2b, 0x38, 0x19, 0xcd, 0x11, 0x8a, 0x1a, 0x70, 0x22, 0xf5, 0x23, 0x16, 0x33, 0x16, 0x11, 0x8a, 0x09, 0x69, 0x11, 0xab, 0x1a, 0x70, 0x22, 0xb3, 0x4b, 0x96, 0x11, 0x89, 0x11, 0x69, 0x09, 0x88, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x09, 0xe9, 0x0a, 0x4b, 0x23, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1a, 0x2a, 0x09, 0xe9, 0x0a, 0x4b, 0x0b, 0x50, 0x14, 0x76, 0x1d, 0x19, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x2d, 0x1c, 0x4d, 0x3e, 0x00, 0x00, 0x3a, 0x8c, 0x19, 0xa9, 0x11, 0xaa, 0x1a, 0x90, 0x23, 0xb8, 0x23, 0xd9, 0x1a, 0xd2, 0x23, 0xd8, 0x2c, 0x7c, 0x34, 0xbe, 0x85, 0x1c, 0x2a, 0x0f, 0x22, 0x31, 0x19, 0xee, 0x09, 0xa8, 0x09, 0xc9, 0x12, 0x8d, 0x13, 0xd4, 0x1c, 0xda, 0x23, 0xf7, 0x11, 0xab, 0x11, 0x49, 0x11, 0xab, 0x22, 0xd3, 0x2b, 0xba, 0x2b, 0xdd, 0x33, 0x7c, 0x19, 0xcd, 0x1a, 0x51, 0x23, 0x17, 0x2b, 0x18, 0x19, 0xcd, 0x11, 0x8a, 0x1a, 0x4f, 0x22, 0xf5, 0x22, 0xf6, 0x2a, 0xd6, 0x11, 0x69, 0x11, 0x69, 0x11, 0xcc, 0x1a, 0x71, 0x22, 0xb3, 0x43, 0x73, 0x11, 0x69, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xea, 0x1a, 0x8c, 0x5c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xac, 0x11, 0xe9, 0x0a, 0x0a, 0x0a, 0xad, 0x13, 0xb3, 0x1c, 0x98, 0x1d, 0x1a, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x1d, 0x2d, 0x1c, 0x34, 0xfc, 0x45, 0x1c, 0xff, 0xff, 0x21, 0xca, 0x11, 0xaa, 0x1a, 0x4f, 0x23, 0x56, 0x23, 0x35, 0x1a, 0x90, 0x23, 0x97, 0x2c, 0x5c, 0x34, 0x9e, 0x33, 0xd6, 0x23, 0x14, 0x22, 0x93, 0x11, 0xcc, 0x09, 0x88, 0x09, 0xea, 0x12, 0xae, 0x1b, 0xd4, 0x24, 0x99, 0x1b, 0x74, 0x11, 0x8a, 0x11, 0x69, 0x1a, 0x2f, 0x23, 0x58, 0x2b, 0xbc, 0x33, 0x7d, 0x21, 0xf0, 0x19, 0xef, 0x22, 0xf7, 0x2a, 0xf8, 0x19, 0xce, 0x11, 0x6a, 0x1a, 0x2f, 0x22, 0xd5, 0x2a, 0xd7, 0x22, 0x53, 0x11, 0x69, 0x11, 0x69, 0x11, 0xcd, 0x1a, 0x72, 0x2a, 0xb3, 0x21, 0xaa, 0x11, 0x69, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x12, 0x0a, 0x3b, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x2a, 0x6b, 0x11, 0xe9, 0x0a, 0x2b, 0x13, 0x0f, 0x1b, 0xf5, 0x1c, 0xb9, 0x24, 0xfb, 0x25, 0x1c, 0x25, 0x1d, 0x2c, 0xdd, 0x2c, 0xdd, 0x3c, 0xde, 0x00, 0x00, 0x3a, 0x8a, 0x11, 0x8a, 0x1a, 0x0e, 0x22, 0xf5, 0x22, 0xd4, 0x1a, 0x4f, 0x23, 0x77, 0x2c, 0x3d, 0x2b, 0xba, 0x1b, 0x34, 0x2b, 0xfa, 0x23, 0x57, 0x11, 0xcb, 0x09, 0x88, 0x09, 0xea, 0x12, 0x8e, 0x1b, 0xb5, 0x24, 0x7a, 0x1a, 0xf3, 0x11, 0x6a, 0x11, 0x8b, 0x22, 0xb4, 0x2b, 0x7b, 0x33, 0x7d, 0x2a, 0x75, 0x11, 0xad, 0x22, 0xb5, 0x2a, 0xf8, 0x19, 0xcf, 0x11, 0x49, 0x1a, 0x0f, 0x22, 0xb5, 0x2a, 0xd7, 0x21, 0xf1, 0x11, 0x49, 0x11, 0x6a, 0x19, 0xee, 0x1a, 0x52, 0x32, 0x93, 0x11, 0x69, 0x09, 0x69, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0x88, 0x09, 0xa9, 0x1a, 0x4c, 0x85, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x10, 0x2c, 0x72, 0x2d, 0x55, 0x35, 0x96, 0x3c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xb0, 0x22, 0x2a, 0x12, 0x0a, 0x12, 0x8d, 0x13, 0x51, 0x1c, 0x16, 0x24, 0xba, 0x24, 0xfc, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x34, 0xdd, 0x45, 0x1f, 0x80, 0x00, 0x19, 0xa9, 0x11, 0xed, 0x22, 0xb3, 0x22, 0xb3, 0x1a, 0x2f, 0x23, 0x77, 0x2c, 0x1c, 0x1a, 0xd3, 0x23, 0x14, 0x2c, 0x1b, 0x23, 0x35, 0x09, 0xa9, 0x09, 0x89, 0x11, 0xca, 0x12, 0x8f, 0x1b, 0xb6, 0x24, 0x3a, 0x1a, 0x71, 0x11, 0x6a, 0x19, 0xef, 0x2b, 0x19, 0x33, 0x7d, 0x32, 0xd9, 0x19, 0x8c, 0x22, 0x74, 0x32, 0xd9, 0x21, 0xf0, 0x11, 0x49, 0x19, 0xee, 0x22, 0x94, 0x2a, 0xb7, 0x19, 0xcf, 0x11, 0x49, 0x11, 0x6a, 0x19, 0xef, 0x22, 0x53, 0x3a, 0x91, 0x11, 0x69, 0x09, 0x89, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0xa9, 0x09, 0xc9, 0x12, 0x0b, 0x4b, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x8e, 0x0c, 0x10, 0x0c, 0xf4, 0x05, 0x57, 0x05, 0x77, 0x15, 0x99, 0x15, 0x78, 0x3d, 0xfb, 0x5d, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x22, 0x2b, 0x12, 0x0b, 0x12, 0x8e, 0x1b, 0x53, 0x24, 0x18, 0x24, 0x9b, 0x2c, 0xdd, 0x2c, 0xbd, 0x2c, 0xbe, 0x34, 0x9e, 0x3c, 0x9e, 0x87, 0xff, 0x29, 0xeb, 0x19, 0xcd, 0x1a, 0x72, 0x12, 0x4e, 0x0b, 0xb1, 0x0d, 0x38, 0x14, 0x98, 0x12, 0xaf, 0x23, 0x14, 0x2b, 0xda, 0x1a, 0x4f, 0x09, 0x68, 0x09, 0x89, 0x11, 0xaa, 0x1a, 0xb0, 0x23, 0xd7, 0x23, 0xd9, 0x1a, 0x0f, 0x11, 0x6b, 0x22, 0x74, 0x33, 0x5c, 0x3b, 0x1b, 0x19, 0x8e, 0x22, 0x12, 0x32, 0xd8, 0x22, 0x12, 0x11, 0x29, 0x19, 0xce, 0x22, 0x74, 0x2a, 0x76, 0x19, 0x8d, 0x11, 0x29, 0x11, 0x6b, 0x19, 0xf0, 0x2a, 0x74, 0x21, 0xab, 0x09, 0x69, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0xe9, 0x0a, 0x8c, 0x0b, 0x8f, 0x0c, 0x52, 0x1c, 0xb4, 0x86, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xcf, 0x0b, 0x6e, 0x04, 0x51, 0x05, 0x15, 0x05, 0x97, 0x05, 0xb9, 0x0d, 0xb9, 0x0d, 0x9a, 0x15, 0x9a, 0x25, 0x9b, 0x25, 0x5b, 0x45, 0xbb, 0x5d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xef, 0x1a, 0x0b, 0x12, 0x2c, 0x12, 0xaf, 0x1b, 0x75, 0x24, 0x39, 0x2c, 0x9c, 0x2c, 0x9d, 0x2c, 0x9e, 0x34, 0x7e, 0x34, 0x7f, 0x4c, 0xbf, 0x29, 0x65, 0x19, 0xac, 0x09, 0xea, 0x02, 0xcb, 0x04, 0x32, 0x05, 0x36, 0x0d, 0x37, 0x14, 0x56, 0x23, 0xf8, 0x23, 0x57, 0x11, 0xcc, 0x09, 0x69, 0x09, 0x69, 0x11, 0xcb, 0x1a, 0xd1, 0x23, 0xd9, 0x2b, 0x78, 0x19, 0xad, 0x19, 0xae, 0x32, 0xf9, 0x3b, 0x1c, 0x21, 0xf1, 0x21, 0xcf, 0x32, 0x98, 0x2a, 0x12, 0x11, 0x2a, 0x19, 0xad, 0x2a, 0x54, 0x2a, 0x55, 0x19, 0x6c, 0x11, 0x29, 0x11, 0x6b, 0x21, 0xf1, 0x2a, 0x11, 0x11, 0x6a, 0x09, 0x69, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0xa9, 0x09, 0xe9, 0x02, 0x29, 0x02, 0xec, 0x0c, 0x10, 0x0c, 0xd3, 0x0c, 0xf4, 0x2d, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xeb, 0x12, 0xec, 0x03, 0x6e, 0x04, 0x32, 0x04, 0xf5, 0x05, 0x78, 0x0d, 0x9a, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x7b, 0x1d, 0x7b, 0x25, 0x3b, 0x2c, 0xda, 0x44, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xad, 0x19, 0xeb, 0x12, 0x4d, 0x1a, 0xd1, 0x23, 0x96, 0x2c, 0x3b, 0x2c, 0x5d, 0x2c, 0x1b, 0x2c, 0x3c, 0x34, 0x3d, 0x3c, 0x3e, 0x86, 0x1f, 0x11, 0xe9, 0x01, 0xc8, 0x02, 0x29, 0x03, 0x0d, 0x04, 0x33, 0x0d, 0x17, 0x15, 0x39, 0x24, 0xba, 0x1b, 0x14, 0x11, 0x8a, 0x11, 0x69, 0x11, 0x69, 0x11, 0xcc, 0x1a, 0xd3, 0x2b, 0xba, 0x22, 0xd5, 0x19, 0x6c, 0x2a, 0x34, 0x3b, 0x1c, 0x32, 0x35, 0x19, 0x8e, 0x32, 0x77, 0x2a, 0x13, 0x11, 0x2a, 0x19, 0x8d, 0x2a, 0x34, 0x2a, 0x14, 0x19, 0x4b, 0x11, 0x4a, 0x19, 0x6c, 0x21, 0xd1, 0x19, 0x6d, 0x11, 0x49, 0x11, 0x69, 0x11, 0x69, 0x09, 0x89, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x29, 0x02, 0xab, 0x03, 0x2d, 0x03, 0xb0, 0x1c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x8c, 0x0a, 0x8b, 0x02, 0xed, 0x03, 0xb0, 0x0c, 0x74, 0x0d, 0x38, 0x15, 0x7a, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x5c, 0x25, 0x1b, 0x24, 0xba, 0x34, 0x59, 0x5c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x32, 0x6b, 0x19, 0xeb, 0x1a, 0x2e, 0x1a, 0xd2, 0x23, 0x98, 0x23, 0x77, 0x23, 0x76, 0x2c, 0x1a, 0x2c, 0x5d, 0x34, 0x5e, 0x54, 0x9f, 0x12, 0x09, 0x09, 0xc8, 0x01, 0xc8, 0x02, 0x6b, 0x0b, 0x70, 0x14, 0x75, 0x1d, 0x19, 0x24, 0xfb, 0x1b, 0x33, 0x11, 0x8a, 0x11, 0x49, 0x11, 0x69, 0x11, 0xed, 0x22, 0xf5, 0x2b, 0x9a, 0x22, 0x12, 0x21, 0x8e, 0x3a, 0xb9, 0x3a, 0x78, 0x19, 0x6d, 0x2a, 0x35, 0x2a, 0x14, 0x19, 0x2a, 0x19, 0x6d, 0x2a, 0x14, 0x29, 0xf3, 0x19, 0xce, 0x19, 0xef, 0x19, 0x6d, 0x21, 0xb0, 0x19, 0x4b, 0x11, 0x49, 0x11, 0x69, 0x11, 0x69, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc8, 0x02, 0x09, 0x0a, 0xac, 0x44, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0x0a, 0x2a, 0x0a, 0x8b, 0x0b, 0x4f, 0x0c, 0x13, 0x14, 0xd7, 0x1d, 0x3a, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x24, 0xfc, 0x24, 0xdc, 0x2c, 0xbb, 0x3c, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x21, 0xe9, 0x19, 0xcb, 0x1a, 0x2e, 0x22, 0xd3, 0x1a, 0xd3, 0x1a, 0xd3, 0x23, 0xb9, 0x2c, 0x3d, 0x34, 0x3e, 0x2b, 0xb7, 0x12, 0x6d, 0x09, 0xa8, 0x09, 0xc8, 0x0a, 0x2a, 0x0a, 0xce, 0x13, 0xb3, 0x1c, 0x98, 0x24, 0xda, 0x1b, 0x95, 0x11, 0xcc, 0x11, 0x49, 0x11, 0x6a, 0x1a, 0x0e, 0x23, 0x17, 0x2b, 0x19, 0x21, 0x8f, 0x2a, 0x14, 0x3a, 0xbb, 0x21, 0x8f, 0x29, 0xd2, 0x32, 0x14, 0x19, 0x0a, 0x19, 0x4c, 0x29, 0xf4, 0x29, 0xd2, 0x11, 0xad, 0x1a, 0x10, 0x21, 0x8f, 0x21, 0x8f, 0x11, 0x2a, 0x11, 0x49, 0x11, 0x69, 0x09, 0x88, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x09, 0xe9, 0x22, 0xcc, 0x9e, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0x6a, 0x12, 0x2a, 0x0a, 0x6b, 0x0a, 0xee, 0x13, 0x92, 0x1c, 0x56, 0x1c, 0xd9, 0x25, 0x1b, 0x25, 0x3c, 0x25, 0x1c, 0x25, 0x1d, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0x9c, 0x34, 0x5a, 0x33, 0x5a, 0x00, 0x00, 0x11, 0x69, 0x11, 0xac, 0x1a, 0x2f, 0x1a, 0x50, 0x1a, 0x50, 0x22, 0xf4, 0x2b, 0xdb, 0x23, 0x36, 0x1b, 0x13, 0x12, 0x4d, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xea, 0x12, 0x6c, 0x13, 0x31, 0x1c, 0x16, 0x24, 0x9a, 0x24, 0x18, 0x1a, 0x2f, 0x11, 0x49, 0x11, 0x6a, 0x1a, 0x31, 0x2b, 0x19, 0x2a, 0x76, 0x21, 0x8f, 0x3a, 0x79, 0x29, 0xd3, 0x21, 0x90, 0x32, 0x15, 0x19, 0x0b, 0x19, 0x2c, 0x29, 0xf3, 0x21, 0xb0, 0x11, 0x8c, 0x21, 0xf0, 0x21, 0x90, 0x19, 0x4d, 0x11, 0x29, 0x11, 0x49, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x12, 0x0a, 0x53, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3a, 0xab, 0x1a, 0x2a, 0x12, 0x4b, 0x12, 0xae, 0x13, 0x31, 0x1b, 0xd4, 0x1c, 0x58, 0x24, 0xba, 0x24, 0xfc, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0x9d, 0x34, 0x5d, 0x34, 0x3c, 0x4c, 0x9c, 0x00, 0x00, 0x19, 0x49, 0x19, 0xac, 0x19, 0xee, 0x19, 0xee, 0x1a, 0x50, 0x22, 0xd5, 0x1a, 0x50, 0x1a, 0x90, 0x12, 0x0c, 0x09, 0xa9, 0x09, 0x88, 0x09, 0xc9, 0x12, 0x0b, 0x12, 0xaf, 0x1b, 0x94, 0x24, 0x59, 0x24, 0x1a, 0x1a, 0x71, 0x11, 0x4a, 0x11, 0x6c, 0x22, 0x53, 0x32, 0xfa, 0x29, 0xd1, 0x31, 0xf4, 0x31, 0xf6, 0x21, 0x4e, 0x31, 0xf5, 0x19, 0x2c, 0x19, 0x2b, 0x29, 0xb2, 0x19, 0x6d, 0x11, 0x6b, 0x21, 0xd0, 0x21, 0x6f, 0x19, 0x2b, 0x11, 0x29, 0x09, 0x69, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x11, 0xc9, 0x3a, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x32, 0x4b, 0x12, 0x2b, 0x12, 0x8d, 0x12, 0xf0, 0x1b, 0x53, 0x1b, 0xd6, 0x24, 0x59, 0x24, 0x9b, 0x2c, 0xbd, 0x2c, 0xbd, 0x2c, 0x9e, 0x34, 0x7e, 0x34, 0x5e, 0x34, 0x3e, 0x4c, 0x7f, 0x54, 0x75, 0x22, 0xce, 0x12, 0x0d, 0x11, 0xcd, 0x19, 0xce, 0x1a, 0x31, 0x1a, 0x10, 0x1a, 0x0e, 0x11, 0xed, 0x09, 0x89, 0x09, 0x88, 0x09, 0x89, 0x11, 0xca, 0x12, 0x4d, 0x1b, 0x12, 0x23, 0xd8, 0x2b, 0xfb, 0x22, 0x93, 0x11, 0x4b, 0x19, 0x8d, 0x2a, 0x76, 0x32, 0x78, 0x29, 0x91, 0x3a, 0x17, 0x21, 0x4f, 0x31, 0xd4, 0x21, 0x4e, 0x19, 0x0b, 0x29, 0x91, 0x19, 0x4b, 0x19, 0x4c, 0x21, 0xb0, 0x21, 0x2d, 0x11, 0x09, 0x11, 0x49, 0x09, 0x89, 0x09, 0x89, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x09, 0x88, 0x11, 0xa9, 0x2a, 0x8d, 0xc7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf6, 0x35, 0x56, 0x3d, 0x97, 0x45, 0x36, 0x45, 0x37, 0x45, 0x18, 0x54, 0xd6, 0x85, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x4c, 0x1a, 0x4d, 0x1a, 0x8e, 0x1a, 0xd1, 0x1b, 0x54, 0x23, 0xd7, 0x24, 0x3a, 0x2c, 0x7c, 0x2c, 0x5d, 0x2c, 0x5e, 0x34, 0x5e, 0x23, 0x75, 0x1b, 0xef, 0x1d, 0x54, 0x15, 0x55, 0x14, 0xf4, 0x0c, 0x33, 0x0b, 0x72, 0x13, 0x12, 0x1a, 0x71, 0x19, 0xee, 0x11, 0xcd, 0x11, 0x8a, 0x09, 0x69, 0x09, 0x69, 0x11, 0x89, 0x11, 0xec, 0x1a, 0x91, 0x23, 0x77, 0x2b, 0xdb, 0x22, 0x74, 0x19, 0x4b, 0x21, 0xaf, 0x32, 0x78, 0x31, 0xf4, 0x31, 0xd5, 0x29, 0x92, 0x29, 0x91, 0x21, 0x4f, 0x18, 0xea, 0x21, 0x6f, 0x19, 0x2a, 0x19, 0x4c, 0x21, 0x90, 0x19, 0x0b, 0x11, 0x29, 0x11, 0x69, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x69, 0x11, 0x89, 0x32, 0x4c, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x8f, 0x0c, 0x31, 0x0d, 0x15, 0x05, 0x77, 0x0d, 0x78, 0x0d, 0x78, 0x0d, 0x79, 0x1d, 0x7a, 0x25, 0x7a, 0x2d, 0x7b, 0x25, 0x5b, 0x25, 0x1a, 0x24, 0xb9, 0x3c, 0xf9, 0x44, 0x57, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x22, 0x2b, 0x1a, 0x2d, 0x1a, 0x4e, 0x1a, 0xd2, 0x23, 0x55, 0x23, 0x35, 0x23, 0x76, 0x2c, 0x3b, 0x1b, 0x11, 0x12, 0x89, 0x13, 0xce, 0x14, 0xb2, 0x15, 0x54, 0x0d, 0xb6, 0x05, 0xd8, 0x05, 0x98, 0x0d, 0x39, 0x14, 0x56, 0x13, 0x12, 0x1a, 0x50, 0x11, 0xac, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0x8a, 0x1a, 0x2f, 0x23, 0x16, 0x2b, 0x7b, 0x2a, 0x54, 0x19, 0x4c, 0x29, 0xd2, 0x3a, 0x58, 0x31, 0xb3, 0x31, 0xd5, 0x29, 0x50, 0x29, 0x70, 0x18, 0xeb, 0x21, 0x4e, 0x19, 0x0a, 0x19, 0x4d, 0x21, 0x4f, 0x19, 0x0a, 0x11, 0x49, 0x11, 0x69, 0x11, 0x69, 0x09, 0x69, 0x09, 0x69, 0x09, 0x69, 0x11, 0x69, 0x09, 0x89, 0x11, 0xaa, 0x32, 0xee, 0x55, 0xd8, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xef, 0x0b, 0xf0, 0x04, 0x72, 0x04, 0xf5, 0x05, 0x36, 0x05, 0x78, 0x0d, 0x99, 0x0d, 0x9a, 0x15, 0x9a, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x5b, 0x25, 0x3b, 0x25, 0x1b, 0x24, 0xda, 0x24, 0x9a, 0x2c, 0x38, 0x23, 0xb7, 0x2b, 0xb7, 0x5a, 0xb0, 0x00, 0x00, 0x58, 0x00, 0x21, 0xaa, 0x1a, 0x0d, 0x1a, 0x0e, 0x12, 0x0e, 0x1a, 0xb1, 0x1a, 0xf2, 0x12, 0x2b, 0x0a, 0x08, 0x0a, 0x8a, 0x0b, 0x4d, 0x0c, 0x10, 0x04, 0xb3, 0x05, 0x36, 0x05, 0x78, 0x0d, 0x9a, 0x15, 0x7a, 0x1c, 0xd9, 0x23, 0xd7, 0x1a, 0x71, 0x11, 0x8b, 0x11, 0x49, 0x11, 0x49, 0x11, 0x6a, 0x11, 0xce, 0x22, 0xb5, 0x33, 0x3b, 0x2a, 0x34, 0x19, 0x2c, 0x31, 0xf5, 0x31, 0xd5, 0x31, 0xb4, 0x29, 0x50, 0x21, 0x4e, 0x21, 0x0c, 0x21, 0x0c, 0x18, 0xea, 0x21, 0x2d, 0x21, 0x0c, 0x11, 0x09, 0x11, 0x49, 0x11, 0x49, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x09, 0x89, 0x09, 0xea, 0x0a, 0x6b, 0x03, 0x4e, 0x0c, 0x93, 0x05, 0x76, 0x0d, 0x77, 0x56, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xaf, 0x0b, 0x2d, 0x03, 0xaf, 0x04, 0x12, 0x04, 0x74, 0x04, 0xd6, 0x0d, 0x17, 0x15, 0x38, 0x15, 0x5a, 0x1d, 0x7a, 0x1d, 0x7b, 0x1d, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x1c, 0x24, 0xfc, 0x24, 0xdc, 0x2c, 0x9b, 0x24, 0x5b, 0x2c, 0x1a, 0x23, 0xb8, 0x23, 0x77, 0x43, 0x75, 0x29, 0x65, 0x19, 0x89, 0x11, 0x6a, 0x11, 0xed, 0x12, 0x0d, 0x09, 0xc9, 0x01, 0xc7, 0x02, 0x08, 0x02, 0x6a, 0x02, 0xec, 0x03, 0x6f, 0x03, 0xf2, 0x0c, 0x95, 0x14, 0xf8, 0x1d, 0x1a, 0x25, 0x3b, 0x24, 0xdb, 0x23, 0xf8, 0x1a, 0x91, 0x11, 0x8b, 0x11, 0x29, 0x11, 0x29, 0x19, 0x8d, 0x22, 0x74, 0x32, 0xfa, 0x29, 0xf3, 0x21, 0x4e, 0x31, 0xf6, 0x31, 0x94, 0x29, 0x51, 0x19, 0x0c, 0x21, 0x2d, 0x19, 0x0c, 0x19, 0x2c, 0x21, 0x0d, 0x18, 0xeb, 0x11, 0x29, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x09, 0x89, 0x09, 0xc9, 0x01, 0xe9, 0x01, 0xe8, 0x02, 0x08, 0x02, 0x6a, 0x03, 0x2d, 0x03, 0xd0, 0x0c, 0x32, 0x4d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x4d, 0x0a, 0xaa, 0x0b, 0x0d, 0x0b, 0x6f, 0x0b, 0x90, 0x0b, 0xf2, 0x14, 0x54, 0x14, 0x96, 0x1c, 0xd8, 0x1c, 0xfa, 0x1d, 0x1b, 0x25, 0x1b, 0x25, 0x1c, 0x25, 0x1c, 0x25, 0x1d, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xbd, 0x2c, 0x9d, 0x2c, 0x5d, 0x2b, 0xfc, 0x2b, 0xfc, 0x2b, 0xba, 0x2b, 0x38, 0x32, 0xd5, 0x19, 0x8b, 0x11, 0x69, 0x09, 0x88, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x2a, 0x02, 0x6b, 0x0a, 0xcd, 0x0b, 0x70, 0x13, 0xd3, 0x1c, 0x56, 0x24, 0x99, 0x24, 0xbb, 0x2c, 0x9c, 0x2b, 0xd9, 0x22, 0x93, 0x19, 0x8d, 0x11, 0x2a, 0x19, 0x4c, 0x2a, 0x13, 0x3a, 0x99, 0x29, 0xb3, 0x29, 0x70, 0x31, 0xb5, 0x29, 0x51, 0x18, 0xeb, 0x21, 0x2e, 0x19, 0x0c, 0x21, 0x90, 0x21, 0x0d, 0x18, 0xea, 0x11, 0x29, 0x11, 0x29, 0x11, 0x49, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x09, 0x1a, 0xcc, 0x75, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xab, 0x1c, 0x13, 0x24, 0xd5, 0x25, 0x15, 0x24, 0xf5, 0x24, 0xf6, 0x14, 0xb5, 0x0c, 0x95, 0x14, 0x95, 0x14, 0x76, 0x1c, 0x76, 0x1c, 0x76, 0x1c, 0x57, 0x1c, 0x57, 0x1c, 0x76, 0x1c, 0x57, 0x1c, 0x57, 0x24, 0x37, 0x24, 0x37, 0x1c, 0x17, 0x24, 0x37, 0x24, 0x18, 0x24, 0x18, 0x2c, 0x19, 0x3c, 0x5a, 0x3b, 0xf8, 0x33, 0x94, 0x22, 0xf0, 0x12, 0xcf, 0x12, 0xae, 0x12, 0xef, 0x13, 0x51, 0x13, 0xb3, 0x1c, 0x16, 0x1c, 0x58, 0x24, 0x99, 0x24, 0xbb, 0x24, 0xbb, 0x2c, 0xbc, 0x2c, 0xbd, 0x2c, 0xbd, 0x2c, 0x9e, 0x34, 0x7e, 0x34, 0x5e, 0x34, 0x3e, 0x34, 0x1e, 0x33, 0xdd, 0x33, 0x9d, 0x3b, 0x9d, 0x3a, 0xf9, 0x32, 0x72, 0x21, 0xed, 0x11, 0xaa, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xc9, 0x0a, 0x0a, 0x0a, 0x4c, 0x12, 0xae, 0x1b, 0x31, 0x1b, 0xb5, 0x24, 0x18, 0x2c, 0x3b, 0x2c, 0x3d, 0x2b, 0x9b, 0x22, 0x54, 0x19, 0x4d, 0x19, 0x2b, 0x29, 0xd2, 0x3a, 0x58, 0x29, 0x71, 0x31, 0x73, 0x31, 0x73, 0x20, 0xec, 0x21, 0x0d, 0x18, 0xea, 0x21, 0x6e, 0x21, 0x0d, 0x18, 0xe9, 0x11, 0x0a, 0x11, 0x49, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xa8, 0x01, 0xa8, 0x09, 0xc8, 0x1a, 0x4a, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x71, 0x2c, 0xd2, 0x14, 0x71, 0x14, 0xb2, 0x14, 0xb2, 0x0c, 0xd3, 0x0c, 0xb3, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0xd5, 0x04, 0xd5, 0x0c, 0xd5, 0x0c, 0xd6, 0x0c, 0xb6, 0x14, 0xd7, 0x14, 0xb7, 0x14, 0xb7, 0x1c, 0xb8, 0x1c, 0xb8, 0x1c, 0x98, 0x1c, 0x98, 0x1c, 0x98, 0x24, 0x78, 0x24, 0x78, 0x24, 0x79, 0x24, 0x59, 0x24, 0x59, 0x24, 0x59, 0x24, 0x39, 0x24, 0x39, 0x24, 0x3a, 0x2c, 0x1a, 0x2c, 0x1a, 0x2b, 0xfa, 0x2b, 0xda, 0x23, 0x98, 0x23, 0x14, 0x1a, 0xb1, 0x12, 0x6f, 0x12, 0x4d, 0x12, 0x8f, 0x1a, 0xf0, 0x1b, 0x32, 0x1b, 0x74, 0x23, 0xd7, 0x23, 0xf8, 0x24, 0x1a, 0x2c, 0x3b, 0x2c, 0x5c, 0x2c, 0x3c, 0x2c, 0x1c, 0x2c, 0x1d, 0x34, 0x1e, 0x33, 0xff, 0x33, 0xdf, 0x3b, 0xbf, 0x3b, 0x7e, 0x3b, 0x1b, 0x32, 0x98, 0x2a, 0x35, 0x21, 0xf1, 0x19, 0xcd, 0x11, 0x8a, 0x09, 0x88, 0x09, 0x89, 0x11, 0xca, 0x12, 0x0c, 0x1a, 0x90, 0x23, 0x14, 0x23, 0x78, 0x2b, 0xbb, 0x33, 0x9d, 0x32, 0xfa, 0x29, 0xd2, 0x19, 0x2c, 0x29, 0x91, 0x31, 0xf6, 0x29, 0x51, 0x31, 0x73, 0x29, 0x0e, 0x20, 0xec, 0x18, 0xea, 0x21, 0x2e, 0x18, 0xeb, 0x18, 0xe9, 0x11, 0x29, 0x11, 0x69, 0x09, 0x89, 0x09, 0x89, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa9, 0x22, 0x4b, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0d, 0x3c, 0xb1, 0x24, 0xb0, 0x24, 0xb0, 0x1c, 0xb1, 0x1c, 0xd1, 0x14, 0xd2, 0x14, 0xf3, 0x0c, 0xf3, 0x0c, 0xf4, 0x04, 0xf4, 0x04, 0xf5, 0x04, 0xf5, 0x04, 0xf5, 0x04, 0xf6, 0x0c, 0xf6, 0x0c, 0xf7, 0x0c, 0xf7, 0x14, 0xf7, 0x14, 0xf8, 0x14, 0xd8, 0x1c, 0xd8, 0x1c, 0xd9, 0x1c, 0xd9, 0x1c, 0xb9, 0x1c, 0xb9, 0x24, 0x99, 0x24, 0x99, 0x24, 0x99, 0x24, 0x7a, 0x24, 0x7a, 0x24, 0x7a, 0x24, 0x5a, 0x24, 0x5a, 0x2c, 0x3b, 0x2c, 0x3b, 0x2c, 0x1b, 0x2c, 0x1b, 0x2b, 0xfb, 0x2b, 0xfb, 0x2b, 0xdc, 0x2b, 0xbb, 0x2b, 0x9a, 0x2b, 0x59, 0x22, 0xf6, 0x22, 0xb4, 0x1a, 0x72, 0x1a, 0x51, 0x1a, 0x70, 0x1a, 0x4f, 0x1a, 0x70, 0x1b, 0x13, 0x24, 0x18, 0x24, 0x3a, 0x24, 0x3a, 0x2c, 0x5c, 0x2c, 0x3c, 0x2c, 0x3c, 0x2c, 0x3d, 0x2c, 0x1d, 0x33, 0xdd, 0x33, 0x9d, 0x3b, 0x5d, 0x3b, 0x1d, 0x42, 0xfd, 0x3a, 0xbb, 0x32, 0x57, 0x2a, 0x12, 0x19, 0xad, 0x11, 0x8a, 0x11, 0x69, 0x11, 0x69, 0x11, 0xab, 0x1a, 0x0e, 0x1a, 0x72, 0x2a, 0xf7, 0x33, 0x1b, 0x3b, 0x1c, 0x3a, 0x58, 0x29, 0x70, 0x29, 0x70, 0x31, 0x95, 0x31, 0x52, 0x29, 0x10, 0x20, 0xcc, 0x18, 0xea, 0x21, 0x0d, 0x18, 0xca, 0x11, 0x09, 0x11, 0x49, 0x11, 0x69, 0x09, 0x69, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x09, 0x69, 0x11, 0x69, 0x2a, 0x0c, 0x74, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x2b, 0x8b, 0x24, 0x2e, 0x24, 0x6f, 0x24, 0xb0, 0x24, 0xd1, 0x24, 0xd1, 0x1c, 0xf2, 0x1c, 0xf2, 0x1d, 0x13, 0x15, 0x14, 0x0d, 0x14, 0x0d, 0x34, 0x05, 0x35, 0x05, 0x35, 0x05, 0x36, 0x05, 0x16, 0x05, 0x16, 0x0d, 0x17, 0x0d, 0x17, 0x0d, 0x18, 0x15, 0x18, 0x15, 0x18, 0x1c, 0xf9, 0x1c, 0xf9, 0x1c, 0xf9, 0x1c, 0xd9, 0x1c, 0xda, 0x1c, 0xda, 0x24, 0xba, 0x24, 0xba, 0x24, 0xba, 0x24, 0x9a, 0x24, 0x7a, 0x24, 0x59, 0x24, 0x59, 0x1c, 0x79, 0x1c, 0x99, 0x1c, 0x78, 0x24, 0x58, 0x24, 0x38, 0x23, 0xf8, 0x23, 0xf8, 0x23, 0xd8, 0x23, 0xb7, 0x23, 0x97, 0x23, 0x77, 0x23, 0x78, 0x23, 0x58, 0x2b, 0x58, 0x2b, 0x38, 0x2b, 0x18, 0x2a, 0xd6, 0x2a, 0xd6, 0x22, 0xb5, 0x22, 0xd4, 0x1b, 0x51, 0x24, 0x53, 0x24, 0xd5, 0x25, 0x15, 0x1d, 0x35, 0x15, 0x56, 0x15, 0x57, 0x15, 0x17, 0x14, 0xd8, 0x14, 0x58, 0x1c, 0x18, 0x23, 0x98, 0x2b, 0x58, 0x33, 0x19, 0x32, 0xd9, 0x32, 0x77, 0x2a, 0x35, 0x22, 0x11, 0x1a, 0x0f, 0x11, 0xad, 0x11, 0x8c, 0x11, 0x6b, 0x19, 0x8d, 0x21, 0xf1, 0x32, 0x55, 0x3a, 0x9a, 0x3a, 0x5a, 0x31, 0xb4, 0x29, 0x52, 0x31, 0x74, 0x31, 0x31, 0x20, 0xcc, 0x18, 0xca, 0x20, 0xec, 0x18, 0xc9, 0x11, 0x2a, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x19, 0x6a, 0x21, 0xab, 0x3a, 0x2d, 0x82, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2b, 0x6b, 0x23, 0xac, 0x24, 0x0d, 0x24, 0x6e, 0x24, 0xb0, 0x24, 0xd0, 0x24, 0xf1, 0x25, 0x12, 0x1d, 0x12, 0x1d, 0x13, 0x1d, 0x33, 0x15, 0x34, 0x0d, 0x34, 0x0d, 0x35, 0x05, 0x35, 0x05, 0x36, 0x05, 0x36, 0x05, 0x37, 0x05, 0x37, 0x0d, 0x37, 0x0d, 0x38, 0x0d, 0x38, 0x15, 0x38, 0x15, 0x19, 0x1d, 0x19, 0x1d, 0x19, 0x1d, 0x1a, 0x1c, 0xfa, 0x1c, 0xfa, 0x24, 0xfa, 0x24, 0xdb, 0x24, 0xda, 0x1c, 0x36, 0x14, 0x14, 0x0c, 0x34, 0x0c, 0x95, 0x0c, 0xf7, 0x0d, 0x58, 0x0d, 0x79, 0x15, 0x59, 0x15, 0x59, 0x1d, 0x3a, 0x1d, 0x3a, 0x1d, 0x1a, 0x1c, 0xfa, 0x24, 0xfa, 0x24, 0xda, 0x24, 0xba, 0x24, 0xbb, 0x24, 0x9b, 0x24, 0x7b, 0x2c, 0x7c, 0x2c, 0x5c, 0x2c, 0x3c, 0x2c, 0x3d, 0x2b, 0xfb, 0x23, 0x10, 0x23, 0xcc, 0x2d, 0x51, 0x35, 0xf3, 0x36, 0x14, 0x2e, 0x15, 0x2e, 0x15, 0x26, 0x16, 0x15, 0xf7, 0x0d, 0xd7, 0x05, 0xd8, 0x05, 0x98, 0x0d, 0x79, 0x15, 0x5a, 0x1d, 0x1a, 0x24, 0xb9, 0x24, 0x59, 0x2c, 0x1a, 0x2b, 0xb9, 0x2b, 0x79, 0x2b, 0x18, 0x2a, 0xf8, 0x2a, 0x96, 0x29, 0xf2, 0x21, 0x8f, 0x21, 0x6e, 0x21, 0x90, 0x31, 0xd4, 0x39, 0xf8, 0x39, 0xb6, 0x31, 0x53, 0x31, 0x32, 0x20, 0xcc, 0x18, 0xcb, 0x18, 0xcb, 0x18, 0xe9, 0x11, 0x09, 0x11, 0x09, 0x11, 0x2a, 0x11, 0x4b, 0x19, 0x6b, 0x19, 0x6b, 0x29, 0x8b, 0x42, 0xf1, 0x4c, 0xda, 0x2d, 0x7b, 0x2d, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x22, 0xa9, 0x23, 0x6a, 0x23, 0xec, 0x24, 0x2d, 0x24, 0x6e, 0x24, 0xaf, 0x24, 0xd0, 0x24, 0xf1, 0x25, 0x12, 0x1d, 0x12, 0x1d, 0x13, 0x1d, 0x33, 0x15, 0x34, 0x0d, 0x34, 0x0d, 0x35, 0x05, 0x35, 0x05, 0x36, 0x05, 0x36, 0x05, 0x36, 0x05, 0x37, 0x0d, 0x37, 0x0d, 0x38, 0x0d, 0x38, 0x15, 0x18, 0x15, 0x19, 0x1d, 0x19, 0x1d, 0x19, 0x1d, 0x1a, 0x1c, 0xfa, 0x1c, 0xfa, 0x24, 0xfa, 0x24, 0xda, 0x24, 0xba, 0x13, 0xb1, 0x04, 0x51, 0x05, 0x35, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0xbb, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7c, 0x1d, 0x7c, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x1d, 0x25, 0x1d, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0xbe, 0x2c, 0x9e, 0x2c, 0x5d, 0x1a, 0xee, 0x23, 0x49, 0x2c, 0xef, 0x35, 0x91, 0x35, 0xd3, 0x35, 0xf4, 0x2d, 0xf4, 0x25, 0xf5, 0x1d, 0xf6, 0x15, 0xd6, 0x0d, 0xd7, 0x05, 0xb8, 0x05, 0xb9, 0x0d, 0x9a, 0x15, 0x7a, 0x1d, 0x5b, 0x25, 0x3c, 0x25, 0x1c, 0x2c, 0xdc, 0x2c, 0x9d, 0x2c, 0x5d, 0x34, 0x1e, 0x33, 0xbe, 0x33, 0x5c, 0x3a, 0xfc, 0x3a, 0x9a, 0x32, 0x16, 0x31, 0xb4, 0x31, 0x93, 0x31, 0x73, 0x31, 0x74, 0x31, 0x32, 0x20, 0xcd, 0x18, 0xca, 0x18, 0xa9, 0x18, 0xc9, 0x19, 0x0a, 0x19, 0x2a, 0x19, 0x8c, 0x22, 0x2f, 0x1a, 0x6e, 0x1a, 0xef, 0x1b, 0x50, 0x13, 0xb2, 0x0b, 0xf3, 0x0c, 0x74, 0x0c, 0xf6, 0x0d, 0x58, 0x2d, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x1a, 0x67, 0x1a, 0xe9, 0x23, 0x6b, 0x23, 0xec, 0x24, 0x2e, 0x24, 0x6f, 0x24, 0x8f, 0x24, 0xb0, 0x24, 0xb1, 0x1c, 0xd1, 0x1c, 0xd2, 0x14, 0xf2, 0x14, 0xf3, 0x0c, 0xf3, 0x0c, 0xf4, 0x04, 0xf4, 0x05, 0x15, 0x05, 0x15, 0x05, 0x16, 0x04, 0xf6, 0x04, 0xf6, 0x0c, 0xf7, 0x0c, 0xf7, 0x14, 0xf7, 0x14, 0xd7, 0x14, 0xd8, 0x1c, 0xd8, 0x1c, 0xd8, 0x1c, 0xb9, 0x1c, 0xb9, 0x1c, 0xb9, 0x24, 0x99, 0x24, 0x99, 0x13, 0xb3, 0x0b, 0x4f, 0x0b, 0xb0, 0x04, 0x11, 0x04, 0x52, 0x04, 0xb4, 0x04, 0xd6, 0x0d, 0x17, 0x0d, 0x38, 0x15, 0x39, 0x15, 0x39, 0x1d, 0x3a, 0x1d, 0x3b, 0x1d, 0x3b, 0x25, 0x3b, 0x25, 0x1c, 0x25, 0x1c, 0x24, 0xfc, 0x2c, 0xfc, 0x2c, 0xdd, 0x2c, 0xbd, 0x2c, 0x9d, 0x2c, 0x9d, 0x2c, 0x7d, 0x23, 0xb7, 0x1a, 0x8c, 0x1a, 0xa9, 0x1b, 0x2a, 0x1b, 0x6b, 0x23, 0xed, 0x24, 0x2e, 0x1c, 0x70, 0x1c, 0x91, 0x14, 0xb2, 0x0c, 0xd3, 0x04, 0xd4, 0x04, 0xf5, 0x0c, 0xd6, 0x14, 0xd7, 0x1c, 0xb8, 0x1c, 0x98, 0x24, 0x99, 0x24, 0x79, 0x24, 0x3a, 0x2c, 0x1b, 0x2b, 0xfb, 0x2b, 0xbc, 0x33, 0x9d, 0x3b, 0x3d, 0x3a, 0xfc, 0x42, 0x9b, 0x42, 0x5b, 0x3a, 0x19, 0x39, 0xd8, 0x39, 0xb6, 0x31, 0x54, 0x20, 0xab, 0x08, 0x44, 0x10, 0x87, 0x18, 0xea, 0x11, 0x4b, 0x11, 0x6a, 0x11, 0xaa, 0x09, 0xca, 0x09, 0xea, 0x0a, 0x2b, 0x0a, 0x6b, 0x02, 0xac, 0x02, 0xed, 0x03, 0xd0, 0x04, 0xd4, 0x05, 0x56, 0x1d, 0x17, 0x7d, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x22, 0x47, 0x12, 0x47, 0x1a, 0x67, 0x1a, 0xc9, 0x1b, 0x4b, 0x1b, 0xac, 0x1b, 0xed, 0x1c, 0x0e, 0x1c, 0x2f, 0x1c, 0x50, 0x1c, 0x70, 0x14, 0x71, 0x14, 0x71, 0x0c, 0x92, 0x0c, 0x92, 0x04, 0x93, 0x04, 0x93, 0x04, 0x93, 0x04, 0x94, 0x04, 0x94, 0x04, 0x94, 0x0c, 0x95, 0x0c, 0x95, 0x14, 0x75, 0x14, 0x75, 0x14, 0x76, 0x14, 0x56, 0x1c, 0x56, 0x1c, 0x56, 0x1c, 0x36, 0x1c, 0x36, 0x1c, 0x36, 0x1c, 0x37, 0x1c, 0x17, 0x1b, 0xf6, 0x1b, 0xb5, 0x1b, 0x73, 0x13, 0x51, 0x0b, 0x30, 0x0b, 0x0f, 0x0b, 0x0f, 0x0b, 0x50, 0x0b, 0x71, 0x13, 0x92, 0x13, 0x92, 0x13, 0xb3, 0x13, 0xd4, 0x1b, 0xf4, 0x1b, 0xf5, 0x1b, 0xf6, 0x1b, 0xf6, 0x23, 0xf7, 0x23, 0xf8, 0x24, 0x19, 0x24, 0x19, 0x2c, 0x5b, 0x2c, 0x5b, 0x2c, 0x7c, 0x24, 0x19, 0x23, 0xb6, 0x23, 0x52, 0x1a, 0x8c, 0x12, 0x29, 0x12, 0x49, 0x0a, 0x49, 0x0a, 0x69, 0x0a, 0xaa, 0x02, 0xcb, 0x02, 0xec, 0x03, 0x0d, 0x0b, 0x0e, 0x0b, 0x2f, 0x13, 0x30, 0x13, 0x10, 0x1b, 0x11, 0x1b, 0x12, 0x1a, 0xf2, 0x22, 0xd3, 0x22, 0xd4, 0x22, 0xb5, 0x22, 0x75, 0x2a, 0x54, 0x2a, 0x14, 0x31, 0xf5, 0x31, 0xf6, 0x31, 0xf6, 0x39, 0xf7, 0x39, 0xb6, 0x39, 0x96, 0x28, 0xee, 0x08, 0x23, 0x10, 0x87, 0x19, 0x0a, 0x11, 0x49, 0x11, 0x69, 0x09, 0x89, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x6a, 0x03, 0x8f, 0x0b, 0xf1, 0x34, 0x55, 0x7c, 0xba, 0x6b, 0x5a, 0x84, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x12, 0x06, 0x12, 0x06, 0x12, 0x47, 0x12, 0x89, 0x1a, 0xea, 0x1b, 0x0b, 0x13, 0x4c, 0x13, 0x6c, 0x13, 0x8d, 0x13, 0xae, 0x0b, 0xce, 0x0b, 0xcf, 0x0b, 0xef, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf1, 0x03, 0xf1, 0x03, 0xf1, 0x03, 0xf2, 0x0b, 0xf2, 0x0b, 0xf2, 0x0b, 0xf2, 0x13, 0xf3, 0x13, 0xf3, 0x13, 0xf3, 0x14, 0x14, 0x1c, 0x15, 0x1c, 0x36, 0x1c, 0x57, 0x1c, 0x77, 0x1c, 0x78, 0x24, 0x79, 0x24, 0x79, 0x24, 0x79, 0x24, 0x7a, 0x24, 0x7a, 0x24, 0x5a, 0x24, 0x39, 0x23, 0xf8, 0x23, 0xb6, 0x23, 0x96, 0x23, 0x75, 0x1b, 0x55, 0x1b, 0x55, 0x1b, 0x34, 0x1b, 0x34, 0x23, 0x35, 0x23, 0x14, 0x23, 0x14, 0x22, 0xf4, 0x1a, 0xf2, 0x1b, 0xb5, 0x24, 0x79, 0x24, 0xba, 0x24, 0xbb, 0x24, 0xbc, 0x2c, 0x9c, 0x2c, 0x7c, 0x2c, 0x5c, 0x2c, 0x1a, 0x23, 0x76, 0x1b, 0x33, 0x1b, 0x12, 0x1b, 0x33, 0x1b, 0x33, 0x1b, 0x12, 0x1a, 0xf2, 0x1a, 0xb1, 0x12, 0x6f, 0x12, 0x4f, 0x12, 0x2e, 0x12, 0x0e, 0x1a, 0x2f, 0x1a, 0x71, 0x22, 0xb4, 0x2a, 0xd6, 0x2a, 0xd8, 0x32, 0xd9, 0x3a, 0xba, 0x3a, 0xbb, 0x42, 0xbb, 0x42, 0x9c, 0x42, 0x7c, 0x42, 0x3b, 0x41, 0xf9, 0x41, 0xf9, 0x41, 0xb8, 0x39, 0x75, 0x29, 0x10, 0x20, 0xec, 0x21, 0x2e, 0x19, 0x4c, 0x11, 0x6b, 0x11, 0x8a, 0x11, 0xaa, 0x11, 0xaa, 0x09, 0xa9, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xc9, 0x09, 0xca, 0x11, 0xab, 0x19, 0xad, 0x29, 0xb0, 0x29, 0xd2, 0x32, 0x13, 0x3a, 0x75, 0x3a, 0x56, 0x32, 0x16, 0x3a, 0x77, 0x4a, 0xd8, 0x52, 0xf8, 0x4a, 0x57, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x0a, 0x2a, 0x68, 0x22, 0x48, 0x12, 0x07, 0x12, 0x27, 0x12, 0x28, 0x12, 0x48, 0x12, 0x69, 0x0a, 0x89, 0x0a, 0xaa, 0x0a, 0xcb, 0x0a, 0xeb, 0x02, 0xeb, 0x02, 0xec, 0x03, 0x0c, 0x03, 0x2d, 0x03, 0x6e, 0x03, 0xb0, 0x03, 0xf1, 0x04, 0x12, 0x0c, 0x33, 0x0c, 0x54, 0x0c, 0x95, 0x14, 0xb6, 0x14, 0xd7, 0x14, 0xf8, 0x1c, 0xf9, 0x1c, 0xf9, 0x1d, 0x1a, 0x1d, 0x1a, 0x25, 0x1b, 0x24, 0xfb, 0x24, 0xfb, 0x24, 0xfc, 0x24, 0xfc, 0x24, 0xdc, 0x2c, 0xdc, 0x2c, 0xdd, 0x2c, 0xbd, 0x2c, 0xbd, 0x2c, 0x9d, 0x2c, 0x7d, 0x2c, 0x5d, 0x2c, 0x3c, 0x2b, 0xfa, 0x23, 0xb8, 0x23, 0x97, 0x23, 0x56, 0x23, 0x35, 0x22, 0xf4, 0x1a, 0xd1, 0x1b, 0x33, 0x1b, 0x95, 0x1b, 0x74, 0x1b, 0x74, 0x1b, 0x74, 0x1b, 0xf6, 0x24, 0x59, 0x24, 0x9a, 0x24, 0xdc, 0x24, 0xbb, 0x24, 0x9b, 0x24, 0x7b, 0x24, 0x7a, 0x24, 0x19, 0x23, 0xd7, 0x1b, 0x75, 0x1b, 0x74, 0x1b, 0x95, 0x23, 0xb6, 0x23, 0xd7, 0x23, 0xf9, 0x2c, 0x1b, 0x2c, 0x1c, 0x2c, 0x1d, 0x33, 0xfe, 0x33, 0xfe, 0x33, 0xdf, 0x3b, 0x9f, 0x43, 0x7f, 0x43, 0x1e, 0x42, 0xbc, 0x3a, 0x9a, 0x42, 0xbc, 0x42, 0x9c, 0x42, 0x1a, 0x41, 0xd9, 0x39, 0x97, 0x39, 0x75, 0x20, 0xec, 0x21, 0x4e, 0x29, 0xf2, 0x22, 0x12, 0x22, 0x32, 0x22, 0x54, 0x22, 0x94, 0x22, 0x94, 0x1a, 0x10, 0x19, 0x8d, 0x19, 0xae, 0x21, 0xf2, 0x2a, 0x13, 0x21, 0xf2, 0x21, 0xb0, 0x21, 0x90, 0x29, 0xb1, 0x32, 0x14, 0x32, 0x57, 0x3a, 0x58, 0x3a, 0x79, 0x3a, 0x99, 0x3a, 0x99, 0x3a, 0xb9, 0x3a, 0xd9, 0x3a, 0xfa, 0x3b, 0x1a, 0x4b, 0xda, 0x4b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x32, 0xab, 0x22, 0x48, 0x1a, 0x28, 0x1a, 0x28, 0x11, 0xe7, 0x09, 0xe7, 0x09, 0xe7, 0x09, 0xe7, 0x0a, 0x28, 0x0a, 0x6a, 0x0a, 0xec, 0x03, 0x8e, 0x04, 0x11, 0x04, 0xb3, 0x04, 0xf5, 0x05, 0x16, 0x05, 0x37, 0x05, 0x57, 0x0d, 0x58, 0x0d, 0x59, 0x15, 0x59, 0x15, 0x5a, 0x1d, 0x5a, 0x1d, 0x5a, 0x1d, 0x5b, 0x1d, 0x3b, 0x25, 0x3b, 0x25, 0x3b, 0x25, 0x1c, 0x25, 0x1c, 0x24, 0xfc, 0x24, 0xfc, 0x24, 0xdc, 0x24, 0xbb, 0x24, 0x9b, 0x24, 0x9a, 0x24, 0x9a, 0x24, 0x79, 0x1c, 0x58, 0x1c, 0x37, 0x1c, 0x16, 0x1b, 0xf6, 0x1b, 0xf6, 0x1b, 0xf6, 0x23, 0xf7, 0x23, 0xf8, 0x24, 0x18, 0x24, 0x19, 0x2c, 0x1a, 0x2c, 0x3b, 0x2c, 0x1b, 0x1b, 0xb6, 0x1c, 0x36, 0x1c, 0xd9, 0x1c, 0xd9, 0x1c, 0x98, 0x1c, 0x77, 0x14, 0x76, 0x14, 0x75, 0x0c, 0x75, 0x0c, 0xb6, 0x14, 0xd7, 0x14, 0xd7, 0x1c, 0xd8, 0x1c, 0xd9, 0x1c, 0xfa, 0x24, 0xfb, 0x24, 0xfb, 0x24, 0xdc, 0x2c, 0xdd, 0x2c, 0xbd, 0x2c, 0x9e, 0x34, 0x7e, 0x34, 0x3f, 0x33, 0xfe, 0x33, 0x7d, 0x32, 0xb8, 0x2a, 0x76, 0x33, 0x1b, 0x3b, 0x5e, 0x3a, 0xdc, 0x3a, 0x59, 0x42, 0x3b, 0x39, 0xd8, 0x41, 0xf9, 0x39, 0x96, 0x29, 0x2f, 0x19, 0x0a, 0x19, 0xae, 0x22, 0x52, 0x22, 0xb4, 0x22, 0xf5, 0x23, 0x36, 0x23, 0x78, 0x23, 0x78, 0x23, 0x16, 0x22, 0x52, 0x19, 0xad, 0x19, 0x8d, 0x1a, 0x11, 0x22, 0x94, 0x22, 0x74, 0x21, 0x90, 0x29, 0x90, 0x29, 0xb1, 0x29, 0xf3, 0x32, 0x15, 0x32, 0x56, 0x32, 0x77, 0x32, 0xb8, 0x32, 0xd9, 0x32, 0xf9, 0x33, 0x1a, 0x33, 0x3a, 0x33, 0x3a, 0x33, 0x7a, 0x33, 0x59, 0x3b, 0xb9, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x19, 0xa6, 0x11, 0xa6, 0x2a, 0xea, 0x13, 0x8d, 0x14, 0x0f, 0x14, 0x91, 0x14, 0xf3, 0x0d, 0x35, 0x0d, 0x56, 0x05, 0x76, 0x05, 0x77, 0x05, 0x77, 0x05, 0x78, 0x05, 0x78, 0x0d, 0x79, 0x0d, 0x79, 0x15, 0x79, 0x15, 0x7a, 0x15, 0x5a, 0x1d, 0x3a, 0x1d, 0x3a, 0x1d, 0x1a, 0x1d, 0x1a, 0x24, 0xfb, 0x24, 0xda, 0x1c, 0x99, 0x1c, 0x78, 0x1c, 0x36, 0x14, 0x56, 0x14, 0x76, 0x14, 0xb7, 0x15, 0x18, 0x15, 0x19, 0x1d, 0x19, 0x1d, 0x1a, 0x1d, 0x1a, 0x1d, 0x1b, 0x25, 0x1b, 0x25, 0x1c, 0x24, 0xfc, 0x24, 0xfc, 0x2c, 0xfd, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0xbe, 0x2c, 0x5c, 0x1b, 0xb3, 0x13, 0xf2, 0x1c, 0x32, 0x14, 0x51, 0x14, 0x92, 0x14, 0xd3, 0x0d, 0x14, 0x0d, 0x55, 0x05, 0x56, 0x05, 0x77, 0x05, 0x78, 0x0d, 0x79, 0x0d, 0x79, 0x15, 0x7a, 0x1d, 0x7b, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x1c, 0x2c, 0xdd, 0x2c, 0x9d, 0x2c, 0x3c, 0x2b, 0xba, 0x23, 0x17, 0x22, 0x54, 0x22, 0x74, 0x2b, 0x7a, 0x33, 0x9c, 0x2a, 0x97, 0x32, 0x15, 0x42, 0x7b, 0x42, 0x3a, 0x39, 0xf7, 0x42, 0x3a, 0x39, 0xb7, 0x31, 0x73, 0x19, 0x2b, 0x11, 0x4a, 0x11, 0xcd, 0x1a, 0x70, 0x1a, 0xf2, 0x1b, 0x54, 0x1b, 0x95, 0x23, 0xd6, 0x24, 0x17, 0x24, 0x38, 0x23, 0xd7, 0x1a, 0x4f, 0x19, 0x6c, 0x19, 0xcf, 0x22, 0x53, 0x32, 0x55, 0x2a, 0x15, 0x29, 0xf3, 0x29, 0xb1, 0x21, 0xb0, 0x21, 0x8f, 0x21, 0xaf, 0x21, 0xd0, 0x21, 0xf1, 0x22, 0x32, 0x22, 0x74, 0x22, 0xb5, 0x22, 0xf7, 0x2b, 0x38, 0x2b, 0x79, 0x2b, 0x9a, 0x22, 0xf4, 0x10, 0x40, 0x20, 0xe2, 0x20, 0x82, 0x31, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8f, 0x24, 0xd1, 0x25, 0x12, 0x1d, 0x33, 0x1d, 0x54, 0x1d, 0x74, 0x15, 0x75, 0x0d, 0x76, 0x0d, 0x76, 0x05, 0x76, 0x05, 0x77, 0x05, 0x77, 0x05, 0x77, 0x05, 0x78, 0x0d, 0x58, 0x0d, 0x38, 0x0d, 0x38, 0x15, 0x18, 0x15, 0x18, 0x1c, 0xf8, 0x1c, 0xd9, 0x1c, 0xd8, 0x1c, 0x98, 0x1c, 0x76, 0x14, 0x34, 0x0c, 0x33, 0x04, 0xb5, 0x05, 0x16, 0x05, 0x58, 0x0d, 0x99, 0x0d, 0x99, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x9b, 0x1d, 0x7c, 0x25, 0x7c, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x1c, 0x24, 0xfc, 0x2c, 0xdc, 0x2c, 0xbc, 0x2c, 0x9c, 0x2c, 0x5a, 0x2c, 0x35, 0x2c, 0x91, 0x2c, 0xcf, 0x2d, 0x31, 0x2d, 0x72, 0x2d, 0x93, 0x2d, 0xb4, 0x25, 0xd5, 0x25, 0xd6, 0x1d, 0xf6, 0x15, 0xf7, 0x0d, 0xd8, 0x05, 0xd8, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0xba, 0x1d, 0x9b, 0x1d, 0x7c, 0x25, 0x3b, 0x24, 0xdb, 0x24, 0x9a, 0x24, 0x19, 0x23, 0x77, 0x22, 0xd4, 0x22, 0x74, 0x2a, 0x97, 0x2a, 0xf7, 0x22, 0xd6, 0x22, 0x32, 0x2a, 0x14, 0x42, 0xbc, 0x42, 0xbd, 0x39, 0xf7, 0x3a, 0x7a, 0x42, 0x5b, 0x39, 0xd7, 0x39, 0xd6, 0x21, 0x4d, 0x11, 0x4a, 0x11, 0x69, 0x11, 0xeb, 0x12, 0x6e, 0x12, 0xf0, 0x13, 0x72, 0x1b, 0xd4, 0x1c, 0x35, 0x1c, 0x76, 0x1c, 0xb8, 0x1c, 0x98, 0x1a, 0x70, 0x19, 0x4d, 0x21, 0xb0, 0x2a, 0x34, 0x32, 0x97, 0x32, 0xd9, 0x32, 0xd9, 0x32, 0xd9, 0x32, 0xb9, 0x32, 0x77, 0x2a, 0x55, 0x2a, 0x34, 0x22, 0x12, 0x22, 0x12, 0x22, 0x11, 0x1a, 0x31, 0x1a, 0x52, 0x22, 0x94, 0x2b, 0x17, 0x22, 0x93, 0x11, 0x2a, 0x08, 0xa4, 0x00, 0x42, 0x00, 0x20, 0x08, 0x20, 0x00, 0x00, 0x08, 0x21, 0x18, 0xa3, 0x21, 0x04, 0x18, 0xc3, 0x5a, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0e, 0x24, 0x8f, 0x24, 0xd0, 0x24, 0xf1, 0x25, 0x32, 0x25, 0x33, 0x1d, 0x54, 0x1d, 0x54, 0x15, 0x54, 0x15, 0x55, 0x0d, 0x55, 0x05, 0x35, 0x05, 0x36, 0x05, 0x36, 0x05, 0x16, 0x04, 0xf6, 0x04, 0xf6, 0x0c, 0xd6, 0x0c, 0xd6, 0x14, 0xb6, 0x14, 0x96, 0x14, 0x76, 0x14, 0x55, 0x14, 0x35, 0x13, 0xd2, 0x0c, 0x72, 0x0d, 0x35, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xb9, 0x0d, 0xb9, 0x0d, 0x9a, 0x15, 0x9a, 0x15, 0x7a, 0x1d, 0x5a, 0x1d, 0x5a, 0x1d, 0x3a, 0x1d, 0x1a, 0x24, 0xda, 0x24, 0xba, 0x24, 0x79, 0x24, 0x58, 0x24, 0x38, 0x24, 0x18, 0x23, 0xd4, 0x2b, 0xef, 0x34, 0xce, 0x3d, 0x6f, 0x3d, 0xb0, 0x3d, 0xf1, 0x3e, 0x12, 0x36, 0x13, 0x36, 0x34, 0x36, 0x34, 0x2e, 0x35, 0x2e, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0x7a, 0x1d, 0x19, 0x1c, 0x98, 0x1c, 0x17, 0x1b, 0x94, 0x1a, 0xf3, 0x22, 0xd4, 0x2b, 0x18, 0x33, 0x7d, 0x3b, 0x7e, 0x32, 0xda, 0x2a, 0x13, 0x2a, 0x55, 0x3b, 0x3d, 0x43, 0x3e, 0x3a, 0x59, 0x32, 0x37, 0x42, 0xfc, 0x42, 0x9c, 0x39, 0xf8, 0x3a, 0x18, 0x21, 0x70, 0x19, 0x6d, 0x11, 0x8b, 0x09, 0x89, 0x09, 0xc9, 0x0a, 0x2b, 0x0a, 0xad, 0x0b, 0x30, 0x0b, 0xd2, 0x0c, 0x95, 0x0c, 0xf7, 0x0d, 0x38, 0x14, 0xd8, 0x22, 0x72, 0x21, 0x6e, 0x19, 0x6c, 0x19, 0x8e, 0x22, 0x11, 0x22, 0x94, 0x22, 0xf7, 0x2b, 0x39, 0x33, 0x5b, 0x33, 0x3b, 0x3b, 0x1b, 0x33, 0x1b, 0x33, 0x1b, 0x33, 0x1a, 0x2b, 0x3a, 0x2b, 0x3a, 0x2b, 0x5a, 0x2b, 0x7a, 0x2b, 0x7b, 0x2b, 0x59, 0x23, 0x17, 0x1a, 0x93, 0x19, 0xee, 0x11, 0x49, 0x10, 0xc5, 0x10, 0xa3, 0x10, 0xa2, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x18, 0xc3, 0x39, 0xa7, 0x31, 0x86, 0x39, 0xc7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x88, 0x1b, 0xac, 0x24, 0x4e, 0x24, 0xb0, 0x24, 0xd1, 0x24, 0xf1, 0x1c, 0xf2, 0x1c, 0xf2, 0x1c, 0xf2, 0x14, 0xf3, 0x0c, 0xd3, 0x0c, 0xd3, 0x04, 0xd3, 0x04, 0xb3, 0x04, 0xb4, 0x04, 0x94, 0x04, 0x74, 0x04, 0x74, 0x0c, 0x74, 0x0c, 0x74, 0x0c, 0x95, 0x0c, 0xb6, 0x0c, 0xd6, 0x15, 0x18, 0x14, 0x33, 0x0b, 0x8e, 0x0c, 0x30, 0x0c, 0xd3, 0x0d, 0x14, 0x05, 0x15, 0x05, 0x15, 0x05, 0x16, 0x05, 0x16, 0x04, 0xf6, 0x0c, 0xd6, 0x0c, 0xb6, 0x14, 0x95, 0x14, 0x55, 0x14, 0x15, 0x1c, 0x15, 0x1b, 0xd4, 0x1b, 0x93, 0x13, 0x52, 0x1b, 0xb4, 0x1c, 0x36, 0x1c, 0x99, 0x24, 0x34, 0x33, 0xca, 0x44, 0xec, 0x4d, 0xce, 0x4e, 0x10, 0x4e, 0x30, 0x46, 0x51, 0x46, 0x52, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x54, 0x36, 0x34, 0x2e, 0x15, 0x26, 0x15, 0x1d, 0xf6, 0x15, 0xb6, 0x0d, 0x96, 0x05, 0x36, 0x04, 0xd6, 0x14, 0x75, 0x13, 0xb3, 0x13, 0x31, 0x1a, 0xf1, 0x23, 0x14, 0x2b, 0x99, 0x2b, 0xfd, 0x34, 0x1f, 0x33, 0xde, 0x2a, 0xf9, 0x22, 0x74, 0x2a, 0xd7, 0x33, 0x9d, 0x3b, 0xbf, 0x32, 0xb9, 0x3a, 0x59, 0x32, 0x98, 0x3b, 0x3d, 0x42, 0x9b, 0x3a, 0x17, 0x3a, 0x59, 0x29, 0xd3, 0x19, 0x8d, 0x19, 0xcf, 0x11, 0xac, 0x09, 0xa9, 0x09, 0xa8, 0x09, 0xc9, 0x02, 0x2a, 0x02, 0xcc, 0x03, 0xf1, 0x04, 0xf5, 0x05, 0x77, 0x0d, 0x58, 0x23, 0xb9, 0x33, 0x3a, 0x2a, 0x97, 0x21, 0xf2, 0x19, 0xae, 0x11, 0x8d, 0x11, 0xad, 0x1a, 0x30, 0x22, 0xd4, 0x23, 0x37, 0x2b, 0x59, 0x33, 0x3a, 0x33, 0x3b, 0x2b, 0x5b, 0x2b, 0x7b, 0x2b, 0x7b, 0x2b, 0x9b, 0x2b, 0x9b, 0x2b, 0x9b, 0x2b, 0xba, 0x2b, 0xba, 0x2b, 0xdb, 0x2b, 0xdb, 0x2b, 0xd9, 0x2b, 0xb8, 0x3b, 0xd6, 0x4b, 0xb4, 0x53, 0x70, 0x4a, 0xab, 0x29, 0x24, 0x18, 0xc3, 0x08, 0x20, 0x08, 0x41, 0x08, 0x61, 0x00, 0x00, 0x00, 0x20, 0x10, 0x62, 0x08, 0x41, 0x08, 0x61, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x63, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x48, 0x1a, 0xc9, 0x1b, 0x8c, 0x1b, 0xed, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x2f, 0x1c, 0x2f, 0x14, 0x30, 0x14, 0x30, 0x0c, 0x30, 0x0c, 0x30, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x32, 0x04, 0x73, 0x04, 0xb4, 0x05, 0x15, 0x05, 0x37, 0x05, 0x78, 0x0d, 0x99, 0x0d, 0x99, 0x15, 0x9a, 0x15, 0x59, 0x14, 0xf7, 0x14, 0x74, 0x14, 0x33, 0x0b, 0xd0, 0x0b, 0xaf, 0x03, 0x90, 0x03, 0x90, 0x0b, 0x90, 0x0b, 0x70, 0x0b, 0x30, 0x13, 0x30, 0x13, 0x30, 0x13, 0x72, 0x1b, 0xb4, 0x1b, 0x94, 0x1b, 0x53, 0x13, 0x72, 0x14, 0x55, 0x1d, 0x19, 0x1d, 0x3a, 0x1d, 0x1a, 0x23, 0x6d, 0x3b, 0xe9, 0x55, 0x4c, 0x5d, 0xee, 0x56, 0x2f, 0x56, 0x2f, 0x4e, 0x30, 0x46, 0x10, 0x3e, 0x11, 0x3d, 0xf1, 0x35, 0xd2, 0x35, 0xb2, 0x2d, 0x93, 0x25, 0x53, 0x1c, 0xf2, 0x14, 0x92, 0x04, 0x31, 0x03, 0xb0, 0x0b, 0x50, 0x13, 0x30, 0x1b, 0x52, 0x23, 0xd7, 0x2c, 0x5b, 0x2c, 0x7d, 0x2c, 0x7e, 0x34, 0x7e, 0x2b, 0xfc, 0x22, 0xf7, 0x22, 0x94, 0x23, 0x58, 0x2b, 0xfd, 0x34, 0x1f, 0x33, 0x5b, 0x3a, 0x99, 0x32, 0x78, 0x2b, 0x19, 0x3b, 0x3c, 0x42, 0xbc, 0x3a, 0x17, 0x3a, 0x58, 0x3a, 0x58, 0x19, 0x8d, 0x1a, 0x0f, 0x1a, 0x50, 0x1a, 0x2f, 0x11, 0xec, 0x09, 0xea, 0x01, 0xe9, 0x02, 0x09, 0x02, 0x8b, 0x03, 0x6f, 0x03, 0xd0, 0x0b, 0x4f, 0x1a, 0xd3, 0x23, 0x58, 0x2b, 0xbb, 0x33, 0x5b, 0x32, 0xfa, 0x2a, 0xb7, 0x22, 0x32, 0x11, 0x8c, 0x11, 0x8b, 0x11, 0xcd, 0x22, 0xb3, 0x2b, 0x17, 0x2b, 0x39, 0x2b, 0x5a, 0x2b, 0x7a, 0x2b, 0x9a, 0x2b, 0x9a, 0x2b, 0xba, 0x2b, 0xba, 0x2b, 0xda, 0x2b, 0xda, 0x2b, 0xda, 0x2b, 0xfa, 0x2b, 0xfa, 0x24, 0x1a, 0x24, 0x1a, 0x2c, 0x3a, 0x34, 0x7a, 0x3c, 0xba, 0x3c, 0xda, 0x44, 0x77, 0x42, 0xad, 0x52, 0x6a, 0x41, 0xe7, 0x20, 0xe3, 0x20, 0xe4, 0x20, 0xe4, 0x08, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x21, 0x08, 0x21, 0x10, 0x62, 0x10, 0xa2, 0x08, 0x41, 0x18, 0xe3, 0x39, 0xe7, 0x42, 0x28, 0x4a, 0x69, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x68, 0x12, 0x27, 0x12, 0x68, 0x12, 0xc9, 0x12, 0xea, 0x13, 0x0b, 0x13, 0x0b, 0x13, 0x2c, 0x13, 0x4c, 0x0b, 0x4c, 0x0b, 0x2c, 0x0b, 0x4d, 0x0b, 0xaf, 0x0c, 0x31, 0x0c, 0xb2, 0x0d, 0x14, 0x0d, 0x76, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xb9, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0x9a, 0x15, 0x9a, 0x15, 0x7a, 0x1d, 0x5a, 0x1d, 0x19, 0x1c, 0xd8, 0x1c, 0x98, 0x1c, 0x77, 0x1c, 0x56, 0x1c, 0x36, 0x1c, 0x16, 0x1c, 0x36, 0x1c, 0x37, 0x1c, 0x78, 0x1c, 0x58, 0x1c, 0x17, 0x1b, 0xb5, 0x13, 0x71, 0x0c, 0x13, 0x14, 0x96, 0x14, 0xb7, 0x14, 0x76, 0x1c, 0x14, 0x1a, 0xaa, 0x33, 0x07, 0x44, 0x09, 0x4c, 0xcb, 0x4d, 0x2c, 0x4d, 0x2c, 0x45, 0x2d, 0x3d, 0x2e, 0x35, 0x0e, 0x34, 0xce, 0x2c, 0xae, 0x24, 0x4e, 0x1b, 0xed, 0x1b, 0x8d, 0x13, 0x4d, 0x0b, 0x6f, 0x13, 0xb2, 0x14, 0x15, 0x1c, 0x78, 0x24, 0xba, 0x24, 0xdb, 0x24, 0xfc, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0x9d, 0x2b, 0xfb, 0x22, 0xf5, 0x22, 0xb3, 0x23, 0xb8, 0x2c, 0x5d, 0x34, 0x5e, 0x2b, 0xdc, 0x32, 0xfa, 0x43, 0x1e, 0x2a, 0x76, 0x2b, 0x7a, 0x33, 0x1a, 0x42, 0xfd, 0x3a, 0x37, 0x32, 0x57, 0x42, 0xdc, 0x21, 0xd1, 0x11, 0xac, 0x1a, 0x70, 0x1a, 0xb2, 0x1a, 0xb2, 0x1a, 0xf2, 0x1b, 0x33, 0x1b, 0x33, 0x1b, 0x33, 0x23, 0x35, 0x22, 0x72, 0x11, 0xac, 0x11, 0x8b, 0x1a, 0x4f, 0x23, 0x35, 0x2b, 0xd9, 0x2b, 0x9b, 0x33, 0x3b, 0x33, 0x5b, 0x2b, 0x19, 0x22, 0x73, 0x19, 0xce, 0x19, 0xad, 0x1a, 0x10, 0x22, 0x94, 0x22, 0xf6, 0x23, 0x37, 0x23, 0x78, 0x2b, 0x99, 0x2b, 0xb9, 0x2b, 0xd9, 0x2b, 0xd9, 0x2b, 0xf9, 0x23, 0xf9, 0x24, 0x19, 0x24, 0x19, 0x24, 0x39, 0x24, 0x39, 0x24, 0x39, 0x24, 0x59, 0x24, 0x59, 0x24, 0x79, 0x24, 0x79, 0x24, 0x99, 0x2c, 0xda, 0x3d, 0x5b, 0x8f, 0x5f, 0xff, 0xff, 0xbc, 0xb2, 0x41, 0xc7, 0x4a, 0x69, 0x52, 0x8a, 0x31, 0x66, 0x21, 0x04, 0x21, 0x24, 0x18, 0xc3, 0x08, 0x41, 0x10, 0x62, 0x10, 0x82, 0x08, 0x21, 0x08, 0x41, 0x18, 0xa3, 0x10, 0xa2, 0x10, 0xa2, 0x39, 0xc7, 0x52, 0x8a, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x8a, 0x22, 0x48, 0x22, 0x68, 0x1a, 0x48, 0x12, 0x07, 0x0a, 0x28, 0x12, 0x48, 0x0a, 0x48, 0x0a, 0x69, 0x13, 0x2c, 0x14, 0x2f, 0x1d, 0x13, 0x1d, 0x75, 0x15, 0xb6, 0x0d, 0xb7, 0x0d, 0xd7, 0x05, 0xd8, 0x05, 0xd8, 0x05, 0xb8, 0x05, 0x98, 0x05, 0x98, 0x0d, 0x78, 0x0d, 0x59, 0x15, 0x39, 0x15, 0x18, 0x14, 0xf8, 0x1c, 0xd8, 0x1c, 0xb8, 0x1c, 0xb8, 0x1c, 0xf9, 0x1c, 0xf9, 0x1c, 0xf9, 0x1c, 0xd9, 0x1c, 0xb8, 0x1c, 0x77, 0x1c, 0x56, 0x1c, 0x56, 0x1c, 0x77, 0x1c, 0x98, 0x1c, 0x77, 0x14, 0x15, 0x13, 0xb3, 0x1b, 0xd4, 0x1b, 0xd5, 0x1b, 0xf5, 0x13, 0x91, 0x14, 0x11, 0x23, 0xcd, 0x2b, 0x69, 0x33, 0xa9, 0x33, 0xaa, 0x2b, 0x8a, 0x23, 0x8a, 0x23, 0x4a, 0x1a, 0xea, 0x12, 0xca, 0x12, 0xaa, 0x0a, 0xab, 0x0b, 0x6f, 0x14, 0x34, 0x14, 0xd7, 0x1d, 0x3a, 0x1d, 0x3b, 0x1d, 0x3b, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x1c, 0x25, 0x1c, 0x2c, 0xdc, 0x23, 0xf9, 0x22, 0xf4, 0x1a, 0xb2, 0x23, 0xb6, 0x2c, 0x9c, 0x2c, 0xbd, 0x2c, 0x5c, 0x2b, 0x7a, 0x3b, 0x5d, 0x3b, 0x3d, 0x22, 0x33, 0x22, 0xf7, 0x33, 0x1a, 0x3b, 0x3e, 0x32, 0x57, 0x32, 0x56, 0x43, 0x3d, 0x32, 0x77, 0x11, 0x8c, 0x12, 0x0d, 0x1a, 0xd1, 0x1b, 0x33, 0x1b, 0x53, 0x1b, 0xb5, 0x24, 0x39, 0x24, 0x9a, 0x24, 0x7b, 0x2b, 0x9a, 0x2a, 0xd7, 0x1a, 0x30, 0x11, 0xac, 0x11, 0xec, 0x1a, 0xb1, 0x23, 0x76, 0x2b, 0x58, 0x2b, 0x5a, 0x2b, 0x9a, 0x2b, 0x9b, 0x2b, 0x59, 0x22, 0xb3, 0x19, 0xee, 0x11, 0xcd, 0x1a, 0x0f, 0x1a, 0x72, 0x22, 0xd4, 0x23, 0x36, 0x23, 0x77, 0x23, 0xb8, 0x23, 0xd8, 0x23, 0xf9, 0x24, 0x19, 0x24, 0x19, 0x24, 0x39, 0x24, 0x39, 0x24, 0x59, 0x24, 0x59, 0x24, 0x79, 0x24, 0x79, 0x24, 0x99, 0x24, 0x99, 0x1c, 0xb9, 0x1c, 0xb9, 0x1c, 0xd9, 0x24, 0xd9, 0x24, 0xf9, 0x2d, 0x3a, 0x46, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xce, 0x59, 0x6b, 0x6d, 0x5a, 0xcb, 0x63, 0x2c, 0x52, 0x6a, 0x31, 0x66, 0x31, 0x66, 0x21, 0x04, 0x10, 0x82, 0x08, 0x61, 0x10, 0x82, 0x08, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x0c, 0x12, 0x08, 0x2a, 0x49, 0x32, 0xaa, 0x23, 0x4c, 0x1c, 0x4f, 0x25, 0x32, 0x25, 0x94, 0x1d, 0xb5, 0x1d, 0xb5, 0x15, 0xb6, 0x15, 0xb6, 0x0d, 0xb7, 0x05, 0x97, 0x05, 0x77, 0x05, 0x77, 0x05, 0x57, 0x05, 0x37, 0x0d, 0x17, 0x0c, 0xf7, 0x0c, 0xd6, 0x14, 0x96, 0x0c, 0x95, 0x14, 0xb6, 0x14, 0xd7, 0x14, 0xf7, 0x14, 0xd7, 0x14, 0xd7, 0x0c, 0xd7, 0x14, 0xf7, 0x14, 0xf7, 0x15, 0x18, 0x1d, 0x19, 0x1d, 0x3a, 0x1d, 0x5b, 0x1d, 0x5c, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x1c, 0x25, 0x1c, 0x1c, 0xd9, 0x0d, 0x17, 0x05, 0x78, 0x05, 0xb9, 0x0d, 0x79, 0x0c, 0xf6, 0x14, 0x53, 0x13, 0x6f, 0x0a, 0xec, 0x0a, 0xec, 0x02, 0xec, 0x02, 0xcc, 0x02, 0xec, 0x03, 0x8f, 0x04, 0x73, 0x05, 0x17, 0x0d, 0x78, 0x0d, 0x79, 0x15, 0x7a, 0x15, 0x7a, 0x1d, 0x7b, 0x1d, 0x7b, 0x1d, 0x5c, 0x25, 0x3c, 0x24, 0xfb, 0x24, 0x18, 0x1b, 0x34, 0x1a, 0xb1, 0x1b, 0x74, 0x24, 0xba, 0x2c, 0xfc, 0x2c, 0x9b, 0x2b, 0xb9, 0x33, 0x9c, 0x3b, 0xbf, 0x33, 0x1a, 0x22, 0x74, 0x2a, 0xd7, 0x33, 0x7c, 0x3b, 0x5d, 0x32, 0x56, 0x2a, 0x54, 0x3b, 0x7e, 0x3b, 0x1b, 0x19, 0xce, 0x11, 0xaa, 0x12, 0x4d, 0x1b, 0x31, 0x1b, 0x94, 0x1b, 0xd5, 0x1c, 0x37, 0x1c, 0x98, 0x24, 0xda, 0x24, 0x9a, 0x2b, 0xba, 0x2b, 0x7a, 0x23, 0x38, 0x1a, 0x71, 0x11, 0xab, 0x12, 0x0d, 0x1a, 0xb2, 0x23, 0x16, 0x23, 0x78, 0x2b, 0x99, 0x2b, 0xba, 0x2b, 0xda, 0x23, 0x98, 0x22, 0xf4, 0x1a, 0x2f, 0x11, 0xac, 0x12, 0x0e, 0x1a, 0x70, 0x1a, 0xd2, 0x1b, 0x34, 0x23, 0x75, 0x23, 0xb6, 0x23, 0xd7, 0x24, 0x18, 0x24, 0x38, 0x24, 0x38, 0x24, 0x58, 0x24, 0x78, 0x24, 0x79, 0x24, 0x99, 0x1c, 0x99, 0x1c, 0xb9, 0x1c, 0xb9, 0x1c, 0xd9, 0x1c, 0xd9, 0x1c, 0xd9, 0x1c, 0xf9, 0x1c, 0xf9, 0x1d, 0x19, 0x1d, 0x59, 0x35, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe7, 0x3c, 0x9c, 0xd3, 0x7b, 0xaf, 0x73, 0x8e, 0x63, 0x2c, 0x39, 0xe7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x24, 0xf0, 0x2d, 0x32, 0x2d, 0x73, 0x25, 0x94, 0x25, 0x94, 0x25, 0x94, 0x1d, 0x95, 0x15, 0x75, 0x15, 0x75, 0x0d, 0x55, 0x0d, 0x35, 0x05, 0x15, 0x04, 0xf5, 0x04, 0xd5, 0x04, 0xb5, 0x04, 0xb5, 0x04, 0xd5, 0x04, 0xd5, 0x04, 0xf6, 0x0c, 0xd5, 0x0c, 0xb5, 0x0c, 0x94, 0x04, 0xb4, 0x05, 0x16, 0x05, 0x37, 0x0d, 0x78, 0x0d, 0x79, 0x0d, 0x9a, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x5c, 0x25, 0x3c, 0x24, 0xfb, 0x1c, 0x77, 0x0c, 0xd4, 0x05, 0x76, 0x05, 0x77, 0x05, 0x57, 0x04, 0xf6, 0x0c, 0x94, 0x13, 0xf0, 0x0b, 0x8e, 0x0b, 0x6d, 0x0b, 0x6d, 0x0b, 0x6d, 0x0b, 0xcf, 0x0c, 0x92, 0x0d, 0x35, 0x05, 0x77, 0x05, 0xb7, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0x9b, 0x1d, 0x7b, 0x1d, 0x1a, 0x1c, 0x37, 0x1b, 0x54, 0x1b, 0x13, 0x1b, 0x53, 0x1c, 0x99, 0x25, 0x1c, 0x24, 0xdb, 0x23, 0xd8, 0x2b, 0x9a, 0x33, 0xfe, 0x33, 0xdf, 0x22, 0xb6, 0x22, 0xf6, 0x2b, 0x5a, 0x33, 0xdd, 0x33, 0x7c, 0x2a, 0x56, 0x22, 0x53, 0x33, 0xbd, 0x3b, 0x9e, 0x2a, 0x74, 0x11, 0xab, 0x09, 0xca, 0x12, 0x6d, 0x13, 0x51, 0x13, 0xf4, 0x1c, 0x56, 0x1c, 0x97, 0x1c, 0xf8, 0x1d, 0x1a, 0x24, 0x9a, 0x2b, 0x99, 0x2b, 0xba, 0x2b, 0xba, 0x22, 0xf5, 0x11, 0xad, 0x11, 0x6b, 0x1a, 0x0e, 0x1a, 0xb3, 0x23, 0x56, 0x23, 0x98, 0x23, 0xd9, 0x23, 0xf9, 0x24, 0x1a, 0x23, 0xf9, 0x1b, 0x13, 0x12, 0x0e, 0x11, 0xcb, 0x11, 0xed, 0x12, 0x6f, 0x1a, 0xd1, 0x1b, 0x13, 0x1b, 0x74, 0x1b, 0xb5, 0x1b, 0xf6, 0x1c, 0x17, 0x1c, 0x37, 0x1c, 0x58, 0x1c, 0x78, 0x1c, 0x98, 0x1c, 0xb8, 0x1c, 0xb8, 0x1c, 0xd8, 0x1c, 0xd8, 0x14, 0xf8, 0x14, 0xf8, 0x15, 0x18, 0x15, 0x18, 0x15, 0x18, 0x15, 0x38, 0x0d, 0x58, 0x15, 0x58, 0x25, 0x78, 0x5d, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4b, 0x24, 0x4e, 0x24, 0xd0, 0x2d, 0x11, 0x25, 0x32, 0x25, 0x32, 0x25, 0x32, 0x1d, 0x33, 0x1d, 0x13, 0x14, 0xf3, 0x14, 0xd3, 0x0c, 0xd3, 0x04, 0xb3, 0x04, 0x93, 0x04, 0x73, 0x04, 0x93, 0x04, 0xf4, 0x05, 0x36, 0x05, 0x15, 0x0c, 0x93, 0x0c, 0x72, 0x0c, 0x92, 0x0d, 0x14, 0x05, 0x56, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xba, 0x0d, 0xba, 0x15, 0xba, 0x15, 0x9b, 0x1d, 0x9b, 0x1d, 0x7b, 0x1d, 0x5b, 0x1d, 0x1a, 0x1c, 0xb8, 0x1c, 0x97, 0x14, 0x53, 0x0c, 0x72, 0x04, 0x52, 0x04, 0x11, 0x0b, 0xd0, 0x13, 0xef, 0x1b, 0xee, 0x1b, 0xed, 0x1b, 0xee, 0x1b, 0xee, 0x1c, 0x2f, 0x1c, 0xb1, 0x1d, 0x33, 0x1d, 0x95, 0x1d, 0xd6, 0x15, 0xd6, 0x15, 0xf7, 0x0d, 0xf7, 0x0d, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0x7a, 0x1d, 0x19, 0x1c, 0x77, 0x1b, 0x94, 0x23, 0x96, 0x23, 0x75, 0x1c, 0x15, 0x1d, 0x3b, 0x1c, 0xfa, 0x1b, 0xd6, 0x23, 0x98, 0x2c, 0x3d, 0x34, 0x5f, 0x2b, 0xbc, 0x22, 0x93, 0x23, 0x58, 0x2b, 0xbb, 0x2c, 0x1e, 0x33, 0x9c, 0x2a, 0x55, 0x22, 0x52, 0x2b, 0xbc, 0x34, 0x1f, 0x2b, 0x3a, 0x19, 0xee, 0x11, 0xcb, 0x09, 0xc9, 0x0a, 0x8d, 0x13, 0x71, 0x14, 0x34, 0x14, 0xb6, 0x15, 0x18, 0x15, 0x59, 0x15, 0x3a, 0x23, 0xb7, 0x23, 0x98, 0x2b, 0xd9, 0x2c, 0x1a, 0x23, 0x77, 0x1a, 0x0e, 0x11, 0x6a, 0x11, 0xcc, 0x1a, 0x70, 0x1b, 0x13, 0x23, 0x96, 0x23, 0xd8, 0x24, 0x18, 0x24, 0x39, 0x24, 0x5a, 0x24, 0x18, 0x1b, 0x33, 0x12, 0x2d, 0x11, 0xcb, 0x11, 0xec, 0x12, 0x4e, 0x12, 0xb0, 0x1b, 0x11, 0x1b, 0x73, 0x1b, 0xb4, 0x1b, 0xf5, 0x1c, 0x36, 0x1c, 0x57, 0x1c, 0x77, 0x1c, 0x97, 0x1c, 0xb7, 0x14, 0xd7, 0x14, 0xd7, 0x14, 0xf7, 0x15, 0x17, 0x0d, 0x18, 0x0d, 0x18, 0x0d, 0x38, 0x0d, 0x38, 0x05, 0x58, 0x05, 0x57, 0x05, 0x77, 0x0d, 0x98, 0x25, 0xd8, 0x4d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xc9, 0x23, 0xcc, 0x24, 0x4e, 0x24, 0x4f, 0x24, 0x6f, 0x24, 0x90, 0x1c, 0x90, 0x1c, 0x70, 0x14, 0x50, 0x14, 0x30, 0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x72, 0x15, 0x14, 0x15, 0x75, 0x15, 0x54, 0x14, 0xd2, 0x1c, 0xb2, 0x1d, 0x13, 0x1d, 0x74, 0x15, 0xb6, 0x15, 0xd7, 0x0d, 0xd7, 0x0d, 0xd8, 0x05, 0xd8, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0x9a, 0x15, 0x59, 0x14, 0xd7, 0x14, 0x96, 0x14, 0xd7, 0x15, 0x18, 0x15, 0x59, 0x1d, 0x5a, 0x14, 0xd8, 0x14, 0x55, 0x1c, 0x11, 0x24, 0x0d, 0x2c, 0x6d, 0x2c, 0x6e, 0x2c, 0x6e, 0x2c, 0x8f, 0x2c, 0xf0, 0x2d, 0x51, 0x2d, 0xb3, 0x2d, 0xf4, 0x2d, 0xf4, 0x2e, 0x15, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xd8, 0x05, 0x78, 0x0d, 0x18, 0x14, 0x76, 0x1b, 0xd4, 0x24, 0x18, 0x2c, 0x5b, 0x1b, 0x94, 0x14, 0x75, 0x1c, 0xb8, 0x1b, 0x94, 0x23, 0x75, 0x2c, 0x3b, 0x2c, 0x9e, 0x34, 0x5e, 0x23, 0x37, 0x22, 0xd3, 0x2b, 0xb9, 0x2c, 0x1b, 0x2c, 0x5e, 0x2b, 0xbb, 0x2a, 0x34, 0x1a, 0x50, 0x2b, 0xdb, 0x34, 0x5f, 0x33, 0xde, 0x1a, 0x51, 0x1a, 0x4f, 0x11, 0xeb, 0x09, 0xe9, 0x0a, 0xac, 0x0b, 0xb1, 0x04, 0x74, 0x05, 0x17, 0x05, 0x78, 0x0d, 0x99, 0x13, 0xd4, 0x23, 0x14, 0x23, 0xb7, 0x24, 0x19, 0x24, 0x3a, 0x23, 0xf8, 0x1a, 0x90, 0x11, 0x8a, 0x11, 0xaa, 0x12, 0x2d, 0x1a, 0xd1, 0x1b, 0x54, 0x1b, 0xd6, 0x24, 0x17, 0x24, 0x58, 0x24, 0x79, 0x24, 0x9a, 0x24, 0x58, 0x1a, 0xf1, 0x11, 0xca, 0x11, 0xaa, 0x12, 0x0b, 0x12, 0x4d, 0x12, 0xaf, 0x13, 0x11, 0x13, 0x72, 0x13, 0xb4, 0x14, 0x15, 0x14, 0x35, 0x14, 0x76, 0x14, 0x96, 0x14, 0xb7, 0x14, 0xd7, 0x0c, 0xf7, 0x0d, 0x17, 0x0d, 0x17, 0x05, 0x37, 0x05, 0x37, 0x05, 0x57, 0x05, 0x57, 0x05, 0x77, 0x05, 0x77, 0x05, 0x97, 0x0d, 0x97, 0x15, 0xb7, 0x2d, 0xf8, 0xaf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x67, 0x1a, 0xa9, 0x1a, 0xe9, 0x1b, 0x0a, 0x1b, 0x2b, 0x1b, 0x4c, 0x13, 0x6c, 0x13, 0x4c, 0x13, 0x2c, 0x0b, 0x2c, 0x13, 0x8d, 0x14, 0x50, 0x1d, 0x13, 0x1d, 0x74, 0x1d, 0x53, 0x25, 0x12, 0x25, 0x12, 0x25, 0x73, 0x25, 0xb4, 0x25, 0xf5, 0x25, 0xf6, 0x1e, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0xf8, 0x05, 0xd8, 0x05, 0xd9, 0x05, 0xb9, 0x05, 0x99, 0x0d, 0x37, 0x0c, 0x95, 0x0c, 0x94, 0x04, 0xd5, 0x05, 0x57, 0x0d, 0x99, 0x0d, 0x9a, 0x15, 0xba, 0x15, 0x9b, 0x1d, 0x17, 0x24, 0x50, 0x34, 0x6c, 0x3c, 0xed, 0x3d, 0x0d, 0x3d, 0x0e, 0x3d, 0x4f, 0x3d, 0x90, 0x3d, 0xd1, 0x3d, 0xf2, 0x3e, 0x12, 0x36, 0x33, 0x36, 0x34, 0x36, 0x34, 0x2e, 0x35, 0x2e, 0x36, 0x26, 0x16, 0x1d, 0xf7, 0x0d, 0xd7, 0x05, 0x77, 0x04, 0xf5, 0x0c, 0x33, 0x13, 0xd4, 0x24, 0x59, 0x24, 0xbb, 0x2c, 0xbc, 0x1b, 0xd6, 0x13, 0x10, 0x1b, 0x52, 0x1b, 0x74, 0x24, 0x3a, 0x2c, 0xbd, 0x2c, 0xbe, 0x2c, 0x5d, 0x1a, 0xd3, 0x23, 0x55, 0x24, 0x19, 0x2c, 0x7b, 0x2c, 0x9d, 0x2b, 0xdb, 0x2a, 0x55, 0x1a, 0x2f, 0x23, 0xd9, 0x2c, 0x7e, 0x34, 0x5f, 0x22, 0xf6, 0x12, 0x4e, 0x1a, 0xd1, 0x0a, 0x2b, 0x02, 0x09, 0x02, 0xcc, 0x03, 0xd0, 0x04, 0xb4, 0x05, 0x77, 0x05, 0x98, 0x0b, 0xd2, 0x12, 0x4e, 0x1b, 0x33, 0x23, 0xd7, 0x24, 0x38, 0x24, 0x7a, 0x24, 0x7a, 0x1a, 0xf2, 0x11, 0x8a, 0x11, 0x89, 0x11, 0xeb, 0x12, 0x6e, 0x1b, 0x11, 0x1b, 0x94, 0x1c, 0x16, 0x1c, 0x57, 0x1c, 0x98, 0x1c, 0xb9, 0x1c, 0xb9, 0x1b, 0xf5, 0x12, 0x8e, 0x09, 0xa9, 0x09, 0xa9, 0x12, 0x0b, 0x12, 0x4c, 0x12, 0xae, 0x13, 0x10, 0x13, 0x71, 0x13, 0xd2, 0x14, 0x14, 0x14, 0x54, 0x0c, 0x75, 0x0c, 0xb5, 0x0c, 0xd6, 0x04, 0xf6, 0x05, 0x16, 0x05, 0x36, 0x05, 0x36, 0x05, 0x56, 0x05, 0x76, 0x05, 0x76, 0x0d, 0x96, 0x0d, 0x96, 0x0d, 0xb6, 0x0d, 0xb6, 0x15, 0xd6, 0x25, 0xf7, 0x66, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10, 0x32, 0x89, 0x22, 0x68, 0x22, 0x69, 0x22, 0x69, 0x22, 0x89, 0x1a, 0x89, 0x1a, 0x69, 0x12, 0x69, 0x1b, 0xcd, 0x25, 0x32, 0x25, 0x94, 0x25, 0x53, 0x24, 0xf0, 0x2d, 0x31, 0x2d, 0x92, 0x35, 0xf3, 0x2e, 0x14, 0x2e, 0x15, 0x2e, 0x36, 0x26, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf7, 0x0d, 0xd7, 0x05, 0xb8, 0x05, 0x97, 0x05, 0x57, 0x0c, 0xb4, 0x0c, 0x93, 0x05, 0x15, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xd9, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0x79, 0x1c, 0x72, 0x34, 0x0b, 0x44, 0xab, 0x4d, 0x2c, 0x4d, 0x6d, 0x4d, 0x8d, 0x4d, 0xce, 0x4d, 0xef, 0x4e, 0x0f, 0x4e, 0x30, 0x46, 0x51, 0x46, 0x52, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x54, 0x36, 0x34, 0x2e, 0x35, 0x2e, 0x15, 0x1d, 0xb5, 0x0d, 0x55, 0x04, 0x93, 0x0b, 0xd1, 0x14, 0x15, 0x24, 0xb9, 0x24, 0xfb, 0x24, 0xfc, 0x24, 0xbc, 0x23, 0xf8, 0x1b, 0x53, 0x1b, 0x94, 0x24, 0x38, 0x24, 0xdc, 0x2c, 0xfd, 0x2c, 0xdd, 0x2b, 0xfa, 0x1a, 0x90, 0x23, 0xb6, 0x24, 0x5a, 0x24, 0x9b, 0x2c, 0xbd, 0x2b, 0xda, 0x2a, 0x56, 0x1a, 0x0e, 0x23, 0xd7, 0x2c, 0x9d, 0x2c, 0x9e, 0x2b, 0xdb, 0x12, 0x2e, 0x1a, 0xd0, 0x1b, 0x53, 0x12, 0xae, 0x02, 0x4a, 0x02, 0x8a, 0x03, 0x6e, 0x04, 0x92, 0x04, 0xf4, 0x0b, 0x0e, 0x11, 0x8a, 0x12, 0x4d, 0x1b, 0x32, 0x1b, 0xf6, 0x24, 0x58, 0x24, 0x99, 0x24, 0xba, 0x1b, 0x53, 0x11, 0xaa, 0x09, 0x89, 0x11, 0xca, 0x12, 0x4d, 0x12, 0xd0, 0x13, 0x72, 0x1b, 0xf5, 0x1c, 0x56, 0x1c, 0x97, 0x1c, 0xb8, 0x1c, 0xf9, 0x1c, 0xd8, 0x13, 0x92, 0x0a, 0x0b, 0x09, 0x89, 0x09, 0xc9, 0x0a, 0x0a, 0x0a, 0x4c, 0x0a, 0xad, 0x0b, 0x0f, 0x0b, 0x70, 0x0b, 0xd2, 0x0c, 0x13, 0x0c, 0x53, 0x04, 0x94, 0x04, 0xb5, 0x04, 0xf5, 0x05, 0x15, 0x05, 0x35, 0x05, 0x55, 0x0d, 0x56, 0x0d, 0x76, 0x15, 0x96, 0x15, 0x96, 0x1d, 0xb6, 0x1d, 0xb6, 0x1d, 0xd6, 0x1d, 0xf6, 0x2e, 0x16, 0x4e, 0x37, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x64, 0x10, 0x73, 0x8e, 0x43, 0x0c, 0x34, 0x6f, 0x2d, 0x11, 0x2d, 0xb3, 0x2d, 0x52, 0x2c, 0xaf, 0x2c, 0xef, 0x35, 0x91, 0x35, 0xf2, 0x36, 0x33, 0x36, 0x34, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x35, 0x2e, 0x16, 0x26, 0x16, 0x1d, 0xf6, 0x1d, 0xd6, 0x15, 0xb6, 0x0d, 0x96, 0x0d, 0x35, 0x0c, 0xf4, 0x14, 0xf3, 0x15, 0x54, 0x15, 0xb6, 0x0d, 0xd7, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0x98, 0x24, 0x2f, 0x43, 0xe8, 0x54, 0xa9, 0x5d, 0x4b, 0x65, 0x8b, 0x65, 0xcc, 0x65, 0xed, 0x5e, 0x0d, 0x5e, 0x2e, 0x5e, 0x4f, 0x56, 0x4f, 0x56, 0x50, 0x4e, 0x71, 0x46, 0x72, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x13, 0x2d, 0xf4, 0x25, 0x94, 0x1c, 0xf2, 0x0c, 0x10, 0x0b, 0xd1, 0x14, 0x97, 0x1d, 0x1a, 0x1d, 0x3b, 0x25, 0x3b, 0x24, 0xfb, 0x24, 0x79, 0x1b, 0x94, 0x1b, 0xd4, 0x1c, 0x57, 0x24, 0xfb, 0x25, 0x3c, 0x25, 0x1d, 0x2c, 0xdd, 0x23, 0x76, 0x12, 0xb0, 0x1c, 0x17, 0x24, 0x9a, 0x24, 0xdc, 0x24, 0xfc, 0x2b, 0xda, 0x32, 0x56, 0x1a, 0x2e, 0x23, 0xb6, 0x2c, 0xbc, 0x2c, 0xdd, 0x2c, 0x7d, 0x1a, 0xb3, 0x12, 0x4d, 0x1b, 0x73, 0x1b, 0xd5, 0x1b, 0xb4, 0x13, 0x51, 0x13, 0x70, 0x14, 0x34, 0x1c, 0x76, 0x12, 0x2c, 0x09, 0x69, 0x09, 0xa9, 0x12, 0x4d, 0x1b, 0x52, 0x1c, 0x15, 0x1c, 0x78, 0x1c, 0xd9, 0x1c, 0xfa, 0x1b, 0x72, 0x09, 0xa9, 0x09, 0x89, 0x09, 0xa9, 0x12, 0x0b, 0x12, 0xae, 0x13, 0x31, 0x13, 0xd3, 0x14, 0x35, 0x14, 0x96, 0x14, 0xd7, 0x15, 0x18, 0x15, 0x39, 0x14, 0x75, 0x0a, 0xce, 0x09, 0xa9, 0x09, 0xa8, 0x09, 0xc9, 0x0a, 0x0a, 0x0a, 0x4b, 0x0a, 0xac, 0x0b, 0x0e, 0x03, 0x6f, 0x03, 0xd1, 0x04, 0x12, 0x04, 0x53, 0x04, 0x93, 0x04, 0xd4, 0x0c, 0xf4, 0x0d, 0x34, 0x15, 0x55, 0x15, 0x75, 0x1d, 0x95, 0x1d, 0x95, 0x1d, 0xb5, 0x25, 0xd5, 0x25, 0xd5, 0x25, 0xf5, 0x26, 0x15, 0x2e, 0x15, 0x46, 0x36, 0x7e, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xcf, 0x35, 0x50, 0x35, 0xb2, 0x35, 0xd3, 0x35, 0x30, 0x34, 0xee, 0x3d, 0x6f, 0x3d, 0xf1, 0x3e, 0x32, 0x3e, 0x53, 0x3e, 0x53, 0x36, 0x34, 0x36, 0x34, 0x36, 0x14, 0x2e, 0x15, 0x2d, 0xf5, 0x25, 0xd5, 0x1d, 0xb5, 0x15, 0x75, 0x15, 0x54, 0x15, 0x13, 0x25, 0x32, 0x25, 0x94, 0x25, 0xd5, 0x1e, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xd9, 0x05, 0x98, 0x24, 0x90, 0x4c, 0x08, 0x64, 0xc8, 0x6d, 0x29, 0x75, 0x8a, 0x75, 0xcb, 0x76, 0x0b, 0x76, 0x2c, 0x6e, 0x4c, 0x6e, 0x4d, 0x66, 0x6e, 0x66, 0x6f, 0x5e, 0x6f, 0x56, 0x70, 0x4e, 0x51, 0x46, 0x31, 0x3e, 0x12, 0x35, 0xd2, 0x2d, 0x51, 0x1c, 0x90, 0x14, 0x10, 0x0c, 0x53, 0x15, 0x18, 0x15, 0x5a, 0x1d, 0x5a, 0x1d, 0x7b, 0x1d, 0x3b, 0x24, 0xda, 0x1b, 0xd5, 0x13, 0xd4, 0x1c, 0x76, 0x1c, 0xf9, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x1c, 0x24, 0xbc, 0x1a, 0xf2, 0x13, 0x11, 0x1c, 0x78, 0x24, 0xda, 0x25, 0x1c, 0x25, 0x1c, 0x2b, 0xd9, 0x32, 0x55, 0x12, 0x0d, 0x1b, 0xb4, 0x24, 0xdb, 0x2c, 0xfd, 0x2c, 0xbd, 0x23, 0xb9, 0x12, 0x2d, 0x12, 0xcf, 0x1b, 0xd4, 0x1c, 0x36, 0x1c, 0x77, 0x1c, 0xb8, 0x1c, 0xf9, 0x1d, 0x1b, 0x1b, 0x72, 0x09, 0x89, 0x09, 0x89, 0x09, 0xc9, 0x12, 0x6d, 0x13, 0x51, 0x1c, 0x15, 0x1c, 0x97, 0x1c, 0xf9, 0x1d, 0x19, 0x13, 0x92, 0x09, 0xca, 0x09, 0x88, 0x09, 0xa9, 0x09, 0xea, 0x0a, 0x6c, 0x13, 0x0f, 0x13, 0x91, 0x14, 0x14, 0x0c, 0x95, 0x0c, 0xd6, 0x0d, 0x17, 0x0d, 0x58, 0x0d, 0x38, 0x0b, 0xb1, 0x09, 0xea, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xc9, 0x09, 0xe9, 0x02, 0x4a, 0x02, 0xac, 0x03, 0x0d, 0x03, 0x4e, 0x03, 0xb0, 0x04, 0x11, 0x04, 0x72, 0x0c, 0xb2, 0x0c, 0xf3, 0x15, 0x13, 0x1d, 0x54, 0x1d, 0x74, 0x25, 0x94, 0x25, 0xb4, 0x25, 0xd5, 0x2d, 0xf5, 0x2e, 0x15, 0x2e, 0x15, 0x2e, 0x35, 0x36, 0x35, 0x46, 0x56, 0x87, 0x1a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xae, 0x35, 0x50, 0x35, 0xd2, 0x35, 0xd2, 0x34, 0xee, 0x3c, 0xed, 0x45, 0xaf, 0x46, 0x11, 0x46, 0x51, 0x3e, 0x52, 0x3e, 0x32, 0x3e, 0x33, 0x36, 0x13, 0x35, 0xf3, 0x2d, 0xd3, 0x2d, 0xb4, 0x25, 0x94, 0x25, 0x74, 0x1d, 0x33, 0x1c, 0xf2, 0x25, 0x32, 0x2d, 0x93, 0x2d, 0xf4, 0x2e, 0x15, 0x2e, 0x16, 0x26, 0x16, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0xb7, 0x0d, 0x35, 0x24, 0x0e, 0x53, 0xc6, 0x6c, 0xa7, 0x7d, 0x28, 0x85, 0xa9, 0x85, 0xe9, 0x8e, 0x2a, 0x86, 0x4b, 0x86, 0x4b, 0x7e, 0x6c, 0x76, 0x6c, 0x76, 0x6d, 0x6e, 0x6e, 0x5e, 0x4e, 0x56, 0x4f, 0x4e, 0x30, 0x45, 0xf0, 0x35, 0x4f, 0x2c, 0x8e, 0x1b, 0xee, 0x0c, 0x51, 0x05, 0x16, 0x05, 0x78, 0x0d, 0x79, 0x0d, 0x99, 0x15, 0x9a, 0x1d, 0x7a, 0x1d, 0x1a, 0x1c, 0x36, 0x13, 0xd3, 0x14, 0x96, 0x15, 0x18, 0x1d, 0x7a, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x3c, 0x24, 0x7a, 0x12, 0x8e, 0x13, 0x92, 0x1c, 0xb8, 0x1d, 0x1a, 0x1d, 0x5c, 0x25, 0x3c, 0x2b, 0xd9, 0x32, 0x56, 0x12, 0x0d, 0x1b, 0x73, 0x24, 0xda, 0x25, 0x3c, 0x2c, 0xfd, 0x2c, 0x7b, 0x1a, 0xd1, 0x0a, 0x2b, 0x13, 0x51, 0x14, 0x35, 0x14, 0x96, 0x14, 0xd7, 0x15, 0x18, 0x15, 0x39, 0x1c, 0xf9, 0x12, 0x6d, 0x09, 0x88, 0x09, 0x88, 0x09, 0xc9, 0x0a, 0x8d, 0x13, 0x71, 0x14, 0x34, 0x14, 0xb6, 0x15, 0x18, 0x15, 0x39, 0x13, 0x92, 0x09, 0xa9, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xc9, 0x0a, 0x2b, 0x0a, 0xcd, 0x0b, 0x70, 0x0b, 0xf2, 0x04, 0x74, 0x04, 0xd5, 0x05, 0x16, 0x05, 0x57, 0x05, 0x98, 0x04, 0x53, 0x0a, 0x2a, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xc8, 0x02, 0x09, 0x02, 0x4a, 0x02, 0x8b, 0x02, 0xec, 0x03, 0x4d, 0x0b, 0xaf, 0x0c, 0x10, 0x14, 0x51, 0x14, 0xb2, 0x1c, 0xf2, 0x1d, 0x33, 0x25, 0x73, 0x25, 0x94, 0x2d, 0xd4, 0x2d, 0xf4, 0x2e, 0x14, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x56, 0x76, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x6c, 0x34, 0xee, 0x35, 0x70, 0x35, 0xd1, 0x34, 0xad, 0x3c, 0x6b, 0x45, 0x6e, 0x4d, 0xef, 0x46, 0x10, 0x46, 0x11, 0x3e, 0x11, 0x3e, 0x12, 0x35, 0xf2, 0x35, 0xd2, 0x35, 0x92, 0x2d, 0x72, 0x2d, 0x52, 0x25, 0x11, 0x24, 0xd1, 0x2c, 0xf0, 0x35, 0x71, 0x35, 0xf3, 0x36, 0x34, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x36, 0x26, 0x16, 0x1e, 0x16, 0x1d, 0xd6, 0x15, 0x55, 0x1c, 0xf2, 0x24, 0x4e, 0x43, 0x26, 0x63, 0xe5, 0x84, 0xe6, 0x8d, 0x87, 0x95, 0xe8, 0x9e, 0x28, 0x9e, 0x49, 0x96, 0x4a, 0x8e, 0x4a, 0x86, 0x4b, 0x7e, 0x4b, 0x76, 0x4c, 0x6e, 0x4d, 0x66, 0x2d, 0x55, 0xee, 0x45, 0x4d, 0x34, 0xad, 0x24, 0x2d, 0x14, 0x50, 0x0d, 0x14, 0x05, 0x76, 0x05, 0x97, 0x05, 0xb8, 0x05, 0xb9, 0x05, 0xb9, 0x0d, 0x9a, 0x15, 0x5a, 0x1c, 0x98, 0x0b, 0xb2, 0x0c, 0x94, 0x0d, 0x37, 0x0d, 0x79, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x7b, 0x25, 0x1c, 0x1b, 0xf6, 0x12, 0x8d, 0x14, 0x14, 0x14, 0xf8, 0x1d, 0x5a, 0x1d, 0x7b, 0x1d, 0x5b, 0x23, 0xb8, 0x32, 0x77, 0x12, 0x0d, 0x13, 0x72, 0x1c, 0xd9, 0x25, 0x5c, 0x25, 0x3c, 0x24, 0xdc, 0x23, 0x97, 0x12, 0x2c, 0x0a, 0xad, 0x0b, 0xd2, 0x0c, 0x75, 0x0c, 0xd6, 0x0d, 0x17, 0x0d, 0x58, 0x0d, 0x7a, 0x14, 0x13, 0x09, 0xa9, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xe9, 0x0a, 0xad, 0x0b, 0x90, 0x0c, 0x54, 0x0c, 0xd6, 0x0d, 0x38, 0x0d, 0x38, 0x0b, 0x2f, 0x09, 0xa9, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xc8, 0x0a, 0x0a, 0x02, 0x8c, 0x03, 0x2e, 0x03, 0xd0, 0x04, 0x52, 0x04, 0xb4, 0x05, 0x15, 0x05, 0x76, 0x0d, 0xb7, 0x0c, 0xd4, 0x0a, 0x8b, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x02, 0x08, 0x02, 0x29, 0x02, 0x6a, 0x0a, 0xcb, 0x0b, 0x4d, 0x13, 0xae, 0x14, 0x0f, 0x1c, 0x50, 0x1c, 0xb1, 0x25, 0x11, 0x25, 0x52, 0x2d, 0x93, 0x2d, 0xd3, 0x35, 0xf4, 0x36, 0x14, 0x36, 0x34, 0x36, 0x54, 0x36, 0x54, 0x46, 0x54, 0x76, 0x76, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xaa, 0x34, 0x4c, 0x34, 0xed, 0x35, 0x4f, 0x35, 0x70, 0x33, 0xea, 0x44, 0x8b, 0x4d, 0x8e, 0x4d, 0xcf, 0x45, 0xcf, 0x3d, 0xb0, 0x3d, 0x90, 0x35, 0x70, 0x35, 0x50, 0x2d, 0x30, 0x2c, 0xf0, 0x24, 0xb0, 0x24, 0x6f, 0x2c, 0x8e, 0x35, 0x2f, 0x3d, 0xd1, 0x3e, 0x33, 0x36, 0x53, 0x36, 0x34, 0x36, 0x34, 0x2e, 0x35, 0x2e, 0x15, 0x26, 0x15, 0x1d, 0x94, 0x1c, 0xd1, 0x24, 0xd0, 0x2d, 0x72, 0x33, 0xca, 0x4a, 0x83, 0x6b, 0xa4, 0x84, 0xc5, 0x95, 0x66, 0x9d, 0xc7, 0xa6, 0x08, 0x9e, 0x28, 0x9e, 0x29, 0x96, 0x29, 0x8e, 0x2a, 0x86, 0x2b, 0x75, 0xeb, 0x65, 0xab, 0x54, 0xeb, 0x3c, 0x6b, 0x2c, 0x2c, 0x24, 0xb0, 0x1d, 0x33, 0x15, 0x95, 0x15, 0xb6, 0x15, 0xb6, 0x0d, 0xd7, 0x0d, 0xd8, 0x05, 0xf8, 0x05, 0xb9, 0x0d, 0x79, 0x15, 0x18, 0x0b, 0xb1, 0x04, 0x32, 0x05, 0x16, 0x05, 0x77, 0x05, 0xb9, 0x0d, 0xba, 0x0d, 0xba, 0x1d, 0x7b, 0x24, 0xfa, 0x1b, 0x31, 0x0a, 0xad, 0x0c, 0x74, 0x0d, 0x38, 0x15, 0x9a, 0x15, 0x9b, 0x1d, 0x5a, 0x23, 0x97, 0x32, 0x99, 0x12, 0x0d, 0x13, 0x50, 0x1c, 0xd8, 0x1d, 0x7b, 0x1d, 0x7c, 0x25, 0x1b, 0x24, 0x3a, 0x1a, 0xb1, 0x0a, 0x09, 0x03, 0x2e, 0x04, 0x33, 0x04, 0xb5, 0x05, 0x16, 0x05, 0x57, 0x05, 0x98, 0x05, 0x58, 0x0a, 0xad, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xa8, 0x09, 0xe9, 0x02, 0xac, 0x03, 0xb0, 0x04, 0x73, 0x04, 0xf5, 0x05, 0x77, 0x05, 0x57, 0x0b, 0x0e, 0x09, 0x88, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xc8, 0x01, 0xe9, 0x02, 0x6a, 0x03, 0x0d, 0x03, 0xaf, 0x04, 0x31, 0x0c, 0xb3, 0x0d, 0x14, 0x15, 0x75, 0x15, 0xd6, 0x15, 0x35, 0x1b, 0x4e, 0x09, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x08, 0x0a, 0x69, 0x0a, 0xca, 0x13, 0x2b, 0x13, 0x8d, 0x1b, 0xee, 0x24, 0x4f, 0x24, 0xb0, 0x2d, 0x11, 0x2d, 0x72, 0x35, 0xb2, 0x35, 0xf3, 0x36, 0x33, 0x3e, 0x53, 0x3e, 0x53, 0x3e, 0x12, 0x4d, 0xd2, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x8b, 0x34, 0x2b, 0x34, 0xac, 0x34, 0xee, 0x34, 0xce, 0x2b, 0x48, 0x33, 0xc9, 0x3c, 0x8b, 0x3c, 0xac, 0x3c, 0xac, 0x34, 0xad, 0x34, 0xcd, 0x2c, 0xae, 0x2c, 0x8d, 0x24, 0x4d, 0x23, 0xed, 0x23, 0xec, 0x34, 0xad, 0x3d, 0x8f, 0x46, 0x11, 0x3e, 0x52, 0x3e, 0x53, 0x3e, 0x53, 0x36, 0x34, 0x36, 0x34, 0x36, 0x14, 0x2d, 0xd4, 0x25, 0x11, 0x2c, 0xcf, 0x35, 0x30, 0x35, 0xd2, 0x36, 0x13, 0x34, 0x8d, 0x42, 0x63, 0x6b, 0x84, 0x84, 0x85, 0x9d, 0x46, 0xa5, 0xc6, 0xa5, 0xe7, 0x9d, 0xe7, 0x95, 0xe8, 0x8d, 0xc8, 0x7d, 0x68, 0x6c, 0xe8, 0x54, 0x68, 0x3b, 0xe9, 0x34, 0x0b, 0x2c, 0xaf, 0x25, 0x52, 0x25, 0xb4, 0x25, 0xb4, 0x25, 0xd5, 0x25, 0xd5, 0x1d, 0xf6, 0x1d, 0xf7, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0xb8, 0x0d, 0x58, 0x0c, 0x34, 0x03, 0xcf, 0x0c, 0xf4, 0x0d, 0x76, 0x05, 0xb7, 0x05, 0xd8, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0x7a, 0x1c, 0x77, 0x0a, 0x4c, 0x03, 0x0e, 0x04, 0xb4, 0x05, 0x78, 0x05, 0xb9, 0x0d, 0xba, 0x15, 0x5a, 0x23, 0x97, 0x3a, 0xdb, 0x1a, 0x0e, 0x0b, 0x0e, 0x14, 0xb6, 0x15, 0x7a, 0x1d, 0x9b, 0x1d, 0x5b, 0x24, 0x9a, 0x23, 0x77, 0x0a, 0x0b, 0x02, 0x6b, 0x03, 0xb0, 0x04, 0x93, 0x04, 0xf5, 0x05, 0x56, 0x05, 0x97, 0x05, 0xd8, 0x04, 0x73, 0x09, 0xc9, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xc8, 0x02, 0x09, 0x02, 0xcc, 0x03, 0xd0, 0x04, 0x93, 0x05, 0x35, 0x05, 0x97, 0x05, 0x36, 0x0a, 0x8c, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc8, 0x02, 0x29, 0x02, 0xcb, 0x03, 0x6e, 0x0c, 0x10, 0x14, 0xb2, 0x15, 0x34, 0x1d, 0x95, 0x1d, 0xd6, 0x26, 0x16, 0x45, 0x75, 0x1a, 0x09, 0x12, 0x09, 0x09, 0xe8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x09, 0xe7, 0x0a, 0x07, 0x0a, 0x28, 0x12, 0x69, 0x12, 0xca, 0x1b, 0x4b, 0x1b, 0xac, 0x24, 0x2e, 0x2c, 0xaf, 0x2d, 0x10, 0x35, 0x71, 0x35, 0xd2, 0x3d, 0xf2, 0x3d, 0xf2, 0x35, 0xb1, 0x5d, 0xd3, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa5, 0x2b, 0x28, 0x2b, 0x48, 0x2b, 0x48, 0x23, 0x28, 0x23, 0x49, 0x23, 0x49, 0x23, 0x6a, 0x23, 0x4a, 0x23, 0x2a, 0x23, 0x6a, 0x3c, 0xcc, 0x4d, 0xcf, 0x4e, 0x50, 0x46, 0x51, 0x46, 0x52, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x33, 0x36, 0x13, 0x2d, 0x72, 0x2c, 0x8e, 0x34, 0xcd, 0x3d, 0xb0, 0x3e, 0x11, 0x3e, 0x32, 0x3e, 0x53, 0x3e, 0x12, 0x3b, 0x88, 0x52, 0xc3, 0x73, 0xc4, 0x84, 0x64, 0x8c, 0xc5, 0x84, 0xc5, 0x7c, 0x85, 0x6c, 0x46, 0x5b, 0xe6, 0x43, 0x87, 0x3b, 0x88, 0x2b, 0xeb, 0x2c, 0xae, 0x2d, 0x51, 0x2d, 0x92, 0x2d, 0xb3, 0x2d, 0xd3, 0x2d, 0xf4, 0x2e, 0x14, 0x2e, 0x15, 0x2e, 0x15, 0x26, 0x16, 0x1e, 0x17, 0x0d, 0xd7, 0x05, 0x98, 0x0c, 0xd6, 0x0b, 0x8f, 0x14, 0x91, 0x15, 0x75, 0x15, 0xd6, 0x15, 0xd7, 0x0d, 0xf8, 0x05, 0xf8, 0x05, 0xb9, 0x15, 0x39, 0x13, 0x72, 0x0a, 0x0a, 0x03, 0x8f, 0x04, 0xf4, 0x05, 0x97, 0x05, 0xd9, 0x05, 0xd9, 0x15, 0x59, 0x23, 0x97, 0x3b, 0x1c, 0x1a, 0x2e, 0x0a, 0xed, 0x0c, 0x95, 0x0d, 0x79, 0x0d, 0xba, 0x15, 0x9b, 0x1c, 0xd9, 0x24, 0x3a, 0x1a, 0xb2, 0x02, 0x08, 0x02, 0xec, 0x0c, 0x10, 0x0c, 0xd3, 0x0d, 0x55, 0x0d, 0x96, 0x0d, 0xd7, 0x0d, 0xb7, 0x13, 0x0e, 0x09, 0xa8, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x02, 0x29, 0x02, 0xec, 0x03, 0xd0, 0x0c, 0xb3, 0x0d, 0x55, 0x15, 0xd7, 0x0c, 0xd3, 0x12, 0x2a, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x02, 0x08, 0x0a, 0x8a, 0x0b, 0x2c, 0x13, 0xef, 0x1c, 0x91, 0x1d, 0x33, 0x25, 0x94, 0x25, 0xf5, 0x2e, 0x36, 0x5e, 0x78, 0x00, 0x00, 0x4b, 0x4f, 0x33, 0x0c, 0x1a, 0x69, 0x12, 0x49, 0x09, 0xe8, 0x09, 0xe7, 0x09, 0xc7, 0x09, 0xc7, 0x09, 0xe7, 0x11, 0xe7, 0x12, 0x27, 0x12, 0x68, 0x1a, 0xc9, 0x1b, 0x2a, 0x23, 0xab, 0x24, 0x2d, 0x2c, 0x8d, 0x2c, 0xce, 0x34, 0xee, 0x4d, 0x51, 0x8e, 0x76, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x08, 0x2a, 0x87, 0x2a, 0xa8, 0x2a, 0xc8, 0x2a, 0xa8, 0x32, 0xc9, 0x43, 0x4c, 0x43, 0xeb, 0x4d, 0x0c, 0x56, 0x0f, 0x56, 0x50, 0x4e, 0x70, 0x4e, 0x51, 0x46, 0x51, 0x3e, 0x32, 0x3e, 0x12, 0x35, 0xd2, 0x2c, 0xef, 0x34, 0x4c, 0x45, 0x2d, 0x4e, 0x0f, 0x4e, 0x30, 0x46, 0x51, 0x46, 0x52, 0x3e, 0x52, 0x3e, 0x53, 0x35, 0xd2, 0x33, 0xca, 0x43, 0x05, 0x4b, 0x05, 0x4b, 0x45, 0x43, 0x66, 0x3b, 0x67, 0x3b, 0x88, 0x33, 0xc9, 0x2c, 0x2b, 0x34, 0x8d, 0x35, 0x0e, 0x35, 0x90, 0x3d, 0xd1, 0x35, 0xf2, 0x35, 0xf2, 0x36, 0x13, 0x36, 0x33, 0x36, 0x34, 0x36, 0x34, 0x2e, 0x35, 0x2e, 0x16, 0x1d, 0xf6, 0x0d, 0xb7, 0x05, 0x57, 0x0b, 0xf1, 0x1b, 0xee, 0x1d, 0x32, 0x25, 0xb5, 0x25, 0xf6, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0xf8, 0x05, 0x99, 0x14, 0xb6, 0x12, 0x8d, 0x02, 0x29, 0x0b, 0xcf, 0x0d, 0x34, 0x0d, 0xb7, 0x0d, 0xf8, 0x05, 0xd9, 0x0d, 0x58, 0x23, 0xb8, 0x3b, 0x3d, 0x1a, 0x2f, 0x02, 0xcc, 0x04, 0x73, 0x05, 0x78, 0x05, 0xd9, 0x0d, 0xba, 0x15, 0x5a, 0x24, 0xba, 0x2b, 0x99, 0x0a, 0x0b, 0x02, 0x49, 0x0b, 0x8d, 0x14, 0x71, 0x1d, 0x13, 0x1d, 0x95, 0x1d, 0xd6, 0x1e, 0x17, 0x2d, 0xf7, 0x22, 0x4b, 0x09, 0xa8, 0x01, 0xa8, 0x01, 0xc8, 0x01, 0xe8, 0x02, 0x29, 0x0b, 0x0c, 0x0c, 0x10, 0x14, 0xd2, 0x1d, 0x95, 0x1d, 0xf6, 0x35, 0x55, 0x1a, 0x2a, 0x09, 0xc8, 0x01, 0xc8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x09, 0xe7, 0x0a, 0x49, 0x12, 0xeb, 0x13, 0xad, 0x1c, 0x70, 0x25, 0x32, 0x2d, 0xb4, 0x2e, 0x15, 0x36, 0x35, 0xa7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x14, 0x4b, 0x6e, 0x3b, 0x0c, 0x22, 0x89, 0x2a, 0x8a, 0x1a, 0x28, 0x12, 0x07, 0x1a, 0x07, 0x1a, 0x07, 0x1a, 0x27, 0x1a, 0x68, 0x22, 0xa8, 0x23, 0x09, 0x23, 0x4a, 0x2b, 0x8b, 0x4c, 0x6f, 0x8d, 0xb4, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x0b, 0x55, 0x6c, 0x5e, 0x0e, 0x5e, 0x4f, 0x56, 0x4f, 0x4e, 0x30, 0x46, 0x30, 0x45, 0xf0, 0x3d, 0xd1, 0x35, 0x70, 0x2c, 0x6d, 0x3c, 0x6b, 0x55, 0x8d, 0x56, 0x2f, 0x56, 0x4f, 0x56, 0x70, 0x4e, 0x71, 0x46, 0x51, 0x3e, 0x52, 0x3e, 0x32, 0x35, 0x4f, 0x3c, 0x8b, 0x44, 0x4a, 0x44, 0x4a, 0x3c, 0x4a, 0x3c, 0x4a, 0x3c, 0x6b, 0x3c, 0x6b, 0x3c, 0xac, 0x3c, 0xed, 0x45, 0x4e, 0x45, 0xaf, 0x45, 0xd0, 0x46, 0x10, 0x46, 0x11, 0x46, 0x31, 0x3e, 0x52, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x54, 0x36, 0x34, 0x2e, 0x15, 0x1d, 0xd5, 0x0d, 0x96, 0x04, 0x93, 0x13, 0x6d, 0x24, 0xb0, 0x2d, 0x93, 0x2d, 0xf5, 0x2e, 0x15, 0x26, 0x16, 0x1e, 0x17, 0x0d, 0xd7, 0x05, 0x77, 0x0b, 0xd2, 0x12, 0x4c, 0x0a, 0x8a, 0x14, 0x30, 0x1d, 0x74, 0x15, 0xd6, 0x15, 0xf7, 0x0d, 0xf8, 0x0d, 0x57, 0x23, 0xd9, 0x3b, 0x5e, 0x1a, 0x4f, 0x02, 0xab, 0x04, 0x52, 0x05, 0x77, 0x05, 0xd8, 0x05, 0xd9, 0x0d, 0x9a, 0x1c, 0xfa, 0x2c, 0x3c, 0x22, 0xb3, 0x09, 0xe7, 0x0a, 0xaa, 0x1b, 0xee, 0x24, 0xd1, 0x25, 0x73, 0x25, 0xd5, 0x26, 0x16, 0x26, 0x16, 0x55, 0xf7, 0x1a, 0x2a, 0x09, 0xc8, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xe8, 0x0a, 0x49, 0x13, 0x2c, 0x1c, 0x50, 0x1d, 0x33, 0x25, 0xd5, 0x2e, 0x16, 0x5e, 0x78, 0x22, 0x2a, 0x12, 0x09, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x09, 0xc7, 0x09, 0xe7, 0x0a, 0x28, 0x12, 0xaa, 0x1b, 0x6c, 0x24, 0x6f, 0x2d, 0x32, 0x2d, 0xd3, 0x36, 0x35, 0x56, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x64, 0x51, 0x6c, 0x30, 0x64, 0x0f, 0x5b, 0xcf, 0x4b, 0x6c, 0x53, 0xad, 0x63, 0xee, 0x74, 0x91, 0x7c, 0xd2, 0x8d, 0x13, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x69, 0x55, 0x0a, 0x5d, 0xac, 0x5e, 0x2e, 0x5e, 0x0e, 0x55, 0xee, 0x4d, 0xef, 0x45, 0xaf, 0x3d, 0x8f, 0x35, 0x2e, 0x34, 0x4b, 0x4c, 0xaa, 0x65, 0xcc, 0x66, 0x2e, 0x66, 0x4e, 0x5e, 0x6f, 0x56, 0x70, 0x4e, 0x50, 0x46, 0x51, 0x3d, 0xf1, 0x3c, 0xed, 0x4c, 0x69, 0x54, 0x89, 0x54, 0xa9, 0x4c, 0xa9, 0x4c, 0xaa, 0x4c, 0xaa, 0x4c, 0xaa, 0x4c, 0xeb, 0x4d, 0x2c, 0x55, 0x8d, 0x55, 0xce, 0x55, 0xee, 0x56, 0x0f, 0x56, 0x2f, 0x56, 0x50, 0x4e, 0x70, 0x4e, 0x71, 0x46, 0x72, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x34, 0x2d, 0xf4, 0x1d, 0xb5, 0x0d, 0x14, 0x0b, 0x6d, 0x24, 0x0d, 0x2d, 0x51, 0x35, 0xf3, 0x36, 0x34, 0x36, 0x35, 0x2e, 0x35, 0x26, 0x16, 0x15, 0xd7, 0x04, 0xf5, 0x0b, 0x0f, 0x12, 0xef, 0x12, 0xeb, 0x1c, 0x90, 0x25, 0x94, 0x25, 0xf6, 0x1e, 0x17, 0x15, 0xf7, 0x0d, 0x57, 0x23, 0xfa, 0x3b, 0x9e, 0x1a, 0x50, 0x02, 0x6a, 0x0c, 0x10, 0x0d, 0x75, 0x0d, 0xd7, 0x05, 0xf8, 0x05, 0xb9, 0x15, 0x59, 0x24, 0x9b, 0x33, 0x5b, 0x12, 0x0d, 0x0a, 0x07, 0x13, 0x0b, 0x24, 0x4f, 0x2d, 0x32, 0x2d, 0xb3, 0x2e, 0x15, 0x2e, 0x35, 0x3e, 0x36, 0xc4, 0x18, 0x1a, 0x4a, 0x01, 0xc8, 0x01, 0xc7, 0x01, 0xc7, 0x09, 0xe7, 0x0a, 0x69, 0x13, 0x6c, 0x24, 0x90, 0x25, 0x93, 0x2e, 0x15, 0x36, 0x15, 0x00, 0x00, 0x44, 0x10, 0x2a, 0x8b, 0x12, 0x08, 0x09, 0xe7, 0x09, 0xc7, 0x09, 0xc7, 0x09, 0xc7, 0x0a, 0x07, 0x12, 0x89, 0x1b, 0x4b, 0x24, 0x4e, 0x2d, 0x31, 0x35, 0xd3, 0x46, 0x14, 0xb6, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x08, 0x54, 0xea, 0x65, 0xac, 0x5d, 0xcd, 0x55, 0xad, 0x4d, 0x8d, 0x45, 0x6d, 0x3d, 0x2e, 0x3c, 0xcd, 0x44, 0x6a, 0x5d, 0x0a, 0x6d, 0xeb, 0x6e, 0x4c, 0x6e, 0x6d, 0x66, 0x6e, 0x5e, 0x6f, 0x56, 0x4f, 0x4e, 0x30, 0x45, 0xcf, 0x4c, 0x8a, 0x5c, 0x68, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc9, 0x5c, 0xc9, 0x5c, 0xe9, 0x5d, 0x2a, 0x65, 0x4a, 0x65, 0xab, 0x65, 0xec, 0x66, 0x0d, 0x66, 0x2d, 0x66, 0x4e, 0x66, 0x6e, 0x5e, 0x6f, 0x5e, 0x6f, 0x56, 0x70, 0x4e, 0x71, 0x46, 0x52, 0x3e, 0x52, 0x36, 0x13, 0x2d, 0xd4, 0x1d, 0x74, 0x0c, 0x30, 0x1b, 0x4b, 0x2c, 0xef, 0x35, 0xd1, 0x3e, 0x33, 0x36, 0x54, 0x36, 0x34, 0x2e, 0x35, 0x26, 0x15, 0x15, 0x96, 0x04, 0x11, 0x13, 0x10, 0x1b, 0x51, 0x13, 0x0b, 0x24, 0xd0, 0x2d, 0xd4, 0x2e, 0x15, 0x26, 0x16, 0x1d, 0xf6, 0x0d, 0x36, 0x24, 0x1b, 0x3b, 0x9e, 0x1a, 0x71, 0x02, 0x28, 0x13, 0xcf, 0x15, 0x54, 0x1d, 0xf6, 0x15, 0xf7, 0x05, 0xd8, 0x05, 0x98, 0x1c, 0xb9, 0x33, 0xde, 0x32, 0xd8, 0x11, 0xe8, 0x12, 0x48, 0x1b, 0x8c, 0x2c, 0xcf, 0x2d, 0xb2, 0x36, 0x13, 0x36, 0x34, 0x3e, 0x35, 0x9e, 0x7a, 0x84, 0x18, 0x1a, 0x4a, 0x01, 0xc8, 0x01, 0xc7, 0x09, 0xc7, 0x09, 0xe7, 0x12, 0x89, 0x1b, 0x8c, 0x24, 0xd0, 0x2d, 0xd4, 0x36, 0x14, 0x66, 0x37, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x75, 0x3b, 0x2d, 0x12, 0x29, 0x09, 0xe7, 0x09, 0xe7, 0x09, 0xc6, 0x11, 0xe7, 0x12, 0x47, 0x1a, 0xc9, 0x23, 0xac, 0x2c, 0xaf, 0x45, 0x52, 0x9e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x66, 0x3b, 0x47, 0x4c, 0x69, 0x55, 0x0a, 0x4c, 0xeb, 0x44, 0xcb, 0x44, 0xab, 0x3c, 0x8b, 0x34, 0x4b, 0x4c, 0x29, 0x6d, 0x49, 0x7e, 0x0a, 0x7e, 0x4b, 0x7e, 0x6c, 0x76, 0x6d, 0x6e, 0x6d, 0x66, 0x4e, 0x56, 0x2f, 0x4d, 0x4d, 0x54, 0x28, 0x6c, 0x66, 0x74, 0xe7, 0x74, 0xe7, 0x74, 0xe7, 0x74, 0xe8, 0x75, 0x08, 0x75, 0x28, 0x75, 0x49, 0x75, 0x89, 0x7d, 0xca, 0x7d, 0xea, 0x7e, 0x0b, 0x7e, 0x2b, 0x76, 0x4c, 0x76, 0x6c, 0x6e, 0x6d, 0x66, 0x6e, 0x66, 0x6f, 0x5e, 0x6f, 0x56, 0x70, 0x46, 0x51, 0x3e, 0x32, 0x35, 0xf3, 0x2d, 0x93, 0x1c, 0xb1, 0x13, 0x4b, 0x2c, 0x0c, 0x3d, 0x6f, 0x3e, 0x11, 0x3e, 0x52, 0x3e, 0x53, 0x36, 0x54, 0x36, 0x34, 0x2d, 0xf5, 0x15, 0x14, 0x03, 0x6f, 0x1b, 0xd4, 0x1b, 0x50, 0x1b, 0x6b, 0x2d, 0x11, 0x35, 0xf3, 0x36, 0x34, 0x2e, 0x35, 0x25, 0xf6, 0x0d, 0x16, 0x2c, 0x3c, 0x33, 0xbf, 0x22, 0x92, 0x0a, 0x08, 0x13, 0x8d, 0x25, 0x33, 0x25, 0xf5, 0x1e, 0x16, 0x15, 0xf7, 0x05, 0xb8, 0x14, 0xf8, 0x2c, 0x3c, 0x3b, 0x7d, 0x22, 0x92, 0x11, 0xe6, 0x1a, 0xa8, 0x24, 0x0c, 0x35, 0x50, 0x35, 0xf2, 0x36, 0x33, 0x36, 0x34, 0x46, 0x14, 0x00, 0x00, 0xff, 0xff, 0x1a, 0x4a, 0x09, 0xc7, 0x09, 0xc7, 0x09, 0xc7, 0x12, 0x07, 0x12, 0xa9, 0x23, 0xcd, 0x2d, 0x51, 0x36, 0x14, 0x4e, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x2d, 0x22, 0x69, 0x22, 0x69, 0x11, 0xe7, 0x11, 0xe7, 0x1a, 0x27, 0x1a, 0x88, 0x2b, 0x6b, 0x65, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x66, 0x32, 0xc6, 0x3b, 0x46, 0x3b, 0xa8, 0x3b, 0x88, 0x33, 0x68, 0x2b, 0x48, 0x2b, 0x48, 0x4b, 0xc7, 0x75, 0x28, 0x8e, 0x0a, 0x86, 0x4a, 0x86, 0x6b, 0x7e, 0x6c, 0x76, 0x4c, 0x6e, 0x4d, 0x5e, 0x2e, 0x54, 0xea, 0x5b, 0xc6, 0x74, 0x65, 0x84, 0xc6, 0x8d, 0x06, 0x8d, 0x06, 0x8d, 0x26, 0x85, 0x27, 0x8d, 0x47, 0x8d, 0x67, 0x8d, 0xa8, 0x8d, 0xc8, 0x8d, 0xe9, 0x8e, 0x09, 0x8e, 0x2a, 0x8e, 0x4a, 0x86, 0x6b, 0x7e, 0x6c, 0x7e, 0x6c, 0x76, 0x6d, 0x6e, 0x6e, 0x5e, 0x6f, 0x56, 0x70, 0x4e, 0x50, 0x3e, 0x11, 0x35, 0xb2, 0x25, 0x11, 0x1b, 0xee, 0x23, 0x4a, 0x3c, 0xed, 0x45, 0xcf, 0x4e, 0x51, 0x46, 0x71, 0x46, 0x52, 0x3e, 0x53, 0x36, 0x13, 0x2d, 0xb4, 0x14, 0x71, 0x0b, 0x2f, 0x1c, 0x98, 0x1b, 0x2e, 0x23, 0xab, 0x2d, 0x50, 0x36, 0x13, 0x36, 0x34, 0x36, 0x35, 0x25, 0xd5, 0x14, 0xd6, 0x2c, 0x1c, 0x33, 0xdf, 0x22, 0xb3, 0x09, 0xe7, 0x1b, 0x2b, 0x24, 0xf1, 0x2d, 0xd4, 0x2e, 0x16, 0x26, 0x16, 0x15, 0xf7, 0x0d, 0x17, 0x24, 0x7c, 0x33, 0xbe, 0x3b, 0x3c, 0x1a, 0x4d, 0x12, 0x06, 0x1b, 0x29, 0x2c, 0x8e, 0x3d, 0xd1, 0x3e, 0x32, 0x3e, 0x53, 0x6e, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xeb, 0x12, 0x28, 0x09, 0xe7, 0x09, 0xe6, 0x12, 0x07, 0x1a, 0xc9, 0x24, 0x2d, 0x35, 0xb2, 0x3d, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbb, 0x53, 0x8e, 0x5b, 0xce, 0x5b, 0xce, 0x5b, 0xad, 0x74, 0x91, 0xae, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x69, 0x3a, 0xa6, 0x3b, 0x07, 0x3b, 0x28, 0x3b, 0x08, 0x32, 0xc8, 0x43, 0x26, 0x7d, 0x07, 0x96, 0x09, 0x96, 0x29, 0x8e, 0x4a, 0x86, 0x6b, 0x7e, 0x4b, 0x76, 0x2c, 0x66, 0x0c, 0x5c, 0xe9, 0x63, 0xa5, 0x84, 0x44, 0x8c, 0xc5, 0x9d, 0x05, 0x9d, 0x25, 0x9d, 0x45, 0x9d, 0x46, 0x9d, 0x66, 0x9d, 0x86, 0x9d, 0xa6, 0xa5, 0xc7, 0xa5, 0xe7, 0x9e, 0x08, 0x9e, 0x28, 0x9e, 0x49, 0x96, 0x49, 0x8e, 0x6a, 0x8e, 0x6b, 0x86, 0x6b, 0x7e, 0x6c, 0x6e, 0x6d, 0x66, 0x6e, 0x5e, 0x4f, 0x4e, 0x30, 0x3d, 0xd1, 0x2d, 0x51, 0x24, 0x6f, 0x1b, 0x4a, 0x33, 0xea, 0x4d, 0x6d, 0x56, 0x0f, 0x56, 0x70, 0x4e, 0x71, 0x46, 0x51, 0x3e, 0x32, 0x35, 0xf3, 0x25, 0x52, 0x0b, 0xce, 0x0b, 0x91, 0x1c, 0xd9, 0x1b, 0x0c, 0x23, 0xeb, 0x35, 0x90, 0x3e, 0x32, 0x3e, 0x53, 0x36, 0x34, 0x2d, 0xb4, 0x1c, 0x97, 0x2c, 0x1c, 0x33, 0xde, 0x22, 0xb3, 0x09, 0xe7, 0x1a, 0xea, 0x24, 0xd0, 0x2d, 0xd3, 0x2e, 0x35, 0x2e, 0x35, 0x26, 0x16, 0x0d, 0x97, 0x24, 0xbb, 0x2b, 0xbc, 0x3b, 0x9f, 0x33, 0x1a, 0x1a, 0x09, 0x12, 0x26, 0x23, 0x8a, 0x35, 0x2e, 0x3e, 0x11, 0x46, 0x52, 0x76, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb2, 0x2a, 0x8a, 0x12, 0x08, 0x11, 0xe7, 0x12, 0x07, 0x1a, 0xa8, 0x24, 0x0d, 0x4d, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7c, 0x87, 0x8d, 0x27, 0x9d, 0xe8, 0x9e, 0x28, 0x96, 0x49, 0x96, 0x4a, 0x86, 0x4a, 0x7e, 0x2b, 0x75, 0xeb, 0x64, 0xc8, 0x6b, 0xa4, 0x8c, 0x24, 0x9c, 0xa4, 0xa4, 0xe4, 0xa5, 0x04, 0xad, 0x45, 0xad, 0x65, 0xad, 0x65, 0xb5, 0x85, 0xb5, 0xa5, 0xb5, 0xc6, 0xb5, 0xe6, 0xae, 0x06, 0xae, 0x07, 0xae, 0x27, 0xa6, 0x48, 0xa6, 0x48, 0x9e, 0x49, 0x96, 0x6a, 0x8e, 0x6a, 0x86, 0x6b, 0x76, 0x6c, 0x6e, 0x4d, 0x5e, 0x2e, 0x4d, 0xef, 0x3d, 0x90, 0x2c, 0xcf, 0x1b, 0xcd, 0x2b, 0x29, 0x4c, 0xaa, 0x5d, 0xcd, 0x5e, 0x4e, 0x5e, 0x6f, 0x56, 0x70, 0x4e, 0x51, 0x46, 0x31, 0x35, 0xd2, 0x24, 0xd0, 0x0b, 0x6e, 0x14, 0x97, 0x1c, 0x77, 0x1a, 0xca, 0x2c, 0x2c, 0x3d, 0xd0, 0x46, 0x52, 0x3e, 0x52, 0x3e, 0x33, 0x2d, 0x93, 0x24, 0x57, 0x2c, 0x1c, 0x33, 0xde, 0x23, 0x16, 0x11, 0xe8, 0x12, 0xa9, 0x24, 0x8e, 0x35, 0xb2, 0x36, 0x34, 0x36, 0x35, 0x2e, 0x35, 0x1d, 0xd6, 0x24, 0xfb, 0x2c, 0x1c, 0x33, 0xbf, 0x3b, 0x9f, 0x32, 0xf7, 0x1a, 0x2a, 0x1a, 0x87, 0x2c, 0x2b, 0x3d, 0x8f, 0x45, 0xf1, 0x6e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x51, 0x32, 0xeb, 0x22, 0x68, 0x2a, 0x89, 0x3b, 0x4b, 0x85, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x45, 0x84, 0xa5, 0x9d, 0xa7, 0xa6, 0x07, 0x9e, 0x28, 0x9e, 0x29, 0x96, 0x29, 0x86, 0x0a, 0x75, 0xca, 0x6c, 0x67, 0x73, 0x83, 0x94, 0x03, 0xa4, 0x84, 0xac, 0xc4, 0xb5, 0x04, 0xb5, 0x24, 0xbd, 0x44, 0xbd, 0x64, 0xbd, 0x85, 0xbd, 0xa5, 0xbd, 0xc5, 0xbd, 0xc5, 0xbd, 0xe5, 0xbe, 0x06, 0xbe, 0x26, 0xb6, 0x27, 0xae, 0x27, 0xae, 0x48, 0xa6, 0x48, 0x9e, 0x49, 0x96, 0x6a, 0x86, 0x6b, 0x7e, 0x4c, 0x6e, 0x2d, 0x5e, 0x0e, 0x45, 0xaf, 0x35, 0x0e, 0x24, 0x4e, 0x23, 0x6b, 0x3b, 0xa8, 0x5d, 0x4b, 0x66, 0x0c, 0x6e, 0x6d, 0x66, 0x6e, 0x5e, 0x6f, 0x4e, 0x50, 0x46, 0x11, 0x35, 0x91, 0x1c, 0x2e, 0x13, 0xd0, 0x1d, 0x19, 0x1b, 0xf4, 0x1a, 0xc9, 0x34, 0x4b, 0x45, 0xef, 0x4e, 0x71, 0x46, 0x52, 0x3e, 0x32, 0x2d, 0x52, 0x24, 0x79, 0x2c, 0x3c, 0x33, 0xfe, 0x33, 0x7b, 0x12, 0x2a, 0x12, 0x67, 0x24, 0x2d, 0x35, 0x91, 0x3e, 0x33, 0x36, 0x54, 0x36, 0x35, 0x25, 0xf6, 0x25, 0x3a, 0x2c, 0x7c, 0x33, 0xde, 0x3b, 0xdf, 0x3b, 0x9f, 0x33, 0x5a, 0x22, 0x6d, 0x22, 0xc8, 0x2c, 0x0b, 0x44, 0xce, 0x7d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x95, 0x05, 0xa5, 0xa6, 0xa5, 0xe7, 0x9e, 0x08, 0x9e, 0x08, 0x8d, 0xe9, 0x7d, 0xa9, 0x6c, 0x46, 0x7b, 0x63, 0x94, 0x03, 0xa4, 0x64, 0xb4, 0xa4, 0xbc, 0xe4, 0xbd, 0x04, 0xc5, 0x24, 0xc5, 0x44, 0xcd, 0x65, 0xcd, 0x85, 0xcd, 0xa5, 0xcd, 0xc5, 0xcd, 0xe5, 0xcd, 0xe5, 0xc6, 0x05, 0xc6, 0x06, 0xbe, 0x26, 0xbe, 0x26, 0xb6, 0x47, 0xae, 0x47, 0xa6, 0x48, 0x96, 0x49, 0x8e, 0x4a, 0x7e, 0x2b, 0x6e, 0x0c, 0x55, 0xcd, 0x45, 0x4d, 0x2c, 0x8d, 0x24, 0x0d, 0x2b, 0x48, 0x54, 0x48, 0x6d, 0xaa, 0x76, 0x2c, 0x76, 0x6d, 0x6e, 0x6d, 0x66, 0x6e, 0x56, 0x2f, 0x45, 0xf0, 0x35, 0x0f, 0x1b, 0xee, 0x14, 0xb5, 0x14, 0xf8, 0x1b, 0xd3, 0x22, 0xe8, 0x3c, 0x8b, 0x4e, 0x0f, 0x56, 0x70, 0x4e, 0x51, 0x3e, 0x11, 0x2d, 0x33, 0x24, 0x79, 0x2c, 0x3c, 0x34, 0x1e, 0x33, 0xbd, 0x1a, 0x6e, 0x12, 0x47, 0x23, 0xcb, 0x35, 0x70, 0x3e, 0x32, 0x3e, 0x53, 0x36, 0x54, 0x2e, 0x15, 0x1d, 0x59, 0x2c, 0xbc, 0x2c, 0x1d, 0x33, 0xff, 0x3b, 0xbf, 0x3b, 0xbf, 0x33, 0x9d, 0x33, 0x13, 0x33, 0x29, 0x54, 0x4d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x25, 0x84, 0x64, 0x9d, 0x25, 0x9d, 0x66, 0x9d, 0xa6, 0x9d, 0xc7, 0x8d, 0xa8, 0x7d, 0x68, 0x6c, 0x26, 0x7b, 0x43, 0x9b, 0xe4, 0xac, 0x44, 0xbc, 0x85, 0xc4, 0xc5, 0xc5, 0x05, 0xcd, 0x25, 0xd5, 0x45, 0xd5, 0x65, 0xd5, 0x85, 0xd5, 0xa5, 0xdd, 0xc5, 0xd5, 0xc5, 0xd5, 0xe5, 0xd5, 0xe5, 0xd6, 0x05, 0xce, 0x05, 0xce, 0x25, 0xc6, 0x26, 0xbe, 0x26, 0xb6, 0x47, 0xa6, 0x48, 0x9e, 0x49, 0x8e, 0x2a, 0x7e, 0x0a, 0x6d, 0xec, 0x55, 0x6c, 0x3c, 0xcc, 0x2c, 0x4c, 0x23, 0xcb, 0x3b, 0x67, 0x64, 0xe8, 0x7d, 0xca, 0x7e, 0x4b, 0x7e, 0x6c, 0x76, 0x6d, 0x66, 0x4e, 0x56, 0x0e, 0x45, 0xaf, 0x2c, 0xae, 0x14, 0x50, 0x0d, 0x38, 0x1c, 0xb8, 0x23, 0xd3, 0x22, 0xc7, 0x44, 0x8b, 0x56, 0x2f, 0x56, 0x70, 0x4e, 0x50, 0x3d, 0xd0, 0x24, 0xb3, 0x24, 0x5a, 0x2c, 0x3c, 0x34, 0x3e, 0x33, 0xff, 0x22, 0xf4, 0x12, 0x27, 0x23, 0x6a, 0x35, 0x0e, 0x46, 0x31, 0x46, 0x52, 0x3e, 0x53, 0x35, 0xf3, 0x1d, 0x38, 0x24, 0xdc, 0x2c, 0x5d, 0x34, 0x1f, 0x33, 0xff, 0x33, 0xdf, 0x3b, 0xdf, 0x44, 0x1f, 0x8d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x82, 0x7b, 0xe4, 0x8c, 0xa5, 0x94, 0xe5, 0x95, 0x26, 0x8d, 0x26, 0x7d, 0x07, 0x6c, 0x26, 0x7b, 0x24, 0xa3, 0xc4, 0xb4, 0x45, 0xbc, 0x85, 0xcc, 0xc6, 0xcc, 0xe6, 0xd5, 0x26, 0xdd, 0x46, 0xdd, 0x66, 0xe5, 0x86, 0xe5, 0xa6, 0xe5, 0xc5, 0xe5, 0xc5, 0xe5, 0xc5, 0xdd, 0xe5, 0xdd, 0xe5, 0xde, 0x05, 0xd6, 0x05, 0xce, 0x05, 0xce, 0x25, 0xbe, 0x26, 0xb6, 0x26, 0xae, 0x27, 0x9e, 0x08, 0x8e, 0x09, 0x7d, 0xea, 0x65, 0x8b, 0x4d, 0x0c, 0x3c, 0x8c, 0x2c, 0x2c, 0x2b, 0x69, 0x53, 0xc6, 0x7d, 0x48, 0x86, 0x0a, 0x8e, 0x6b, 0x86, 0x6b, 0x76, 0x6c, 0x6e, 0x4d, 0x55, 0xee, 0x45, 0x6e, 0x2c, 0x8e, 0x0c, 0xf5, 0x0c, 0xd6, 0x1c, 0xd9, 0x1b, 0xd2, 0x2a, 0xa6, 0x4c, 0xaa, 0x66, 0x4e, 0x5e, 0x6f, 0x56, 0x4f, 0x3d, 0x8f, 0x24, 0x53, 0x24, 0x39, 0x2c, 0x7d, 0x2c, 0x3e, 0x34, 0x1f, 0x2b, 0x7a, 0x1a, 0x28, 0x22, 0xe8, 0x3c, 0xac, 0x46, 0x10, 0x4e, 0x71, 0x46, 0x72, 0x35, 0xb2, 0x15, 0x38, 0x24, 0xda, 0x2c, 0x7c, 0x2c, 0x1d, 0x34, 0x1f, 0x33, 0xff, 0x33, 0xdf, 0x3b, 0xff, 0x54, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x43, 0x5a, 0xe3, 0x6b, 0x63, 0x73, 0xc4, 0x74, 0x25, 0x7c, 0x65, 0x6b, 0xe5, 0x73, 0x04, 0x9b, 0xa5, 0xb4, 0x45, 0xc4, 0x86, 0xcc, 0xc6, 0xd4, 0xe6, 0xdd, 0x27, 0xe5, 0x47, 0xe5, 0x67, 0xed, 0x87, 0xed, 0xa7, 0xed, 0xa7, 0xed, 0xc6, 0xed, 0xc6, 0xed, 0xc6, 0xed, 0xe6, 0xe5, 0xe5, 0xdd, 0xe5, 0xde, 0x05, 0xd6, 0x05, 0xce, 0x05, 0xc6, 0x25, 0xbe, 0x06, 0xae, 0x07, 0x9e, 0x08, 0x8d, 0xe9, 0x7d, 0xaa, 0x65, 0x4a, 0x4c, 0xcb, 0x34, 0x6b, 0x2c, 0x0c, 0x33, 0x27, 0x6c, 0x46, 0x85, 0x88, 0x96, 0x29, 0x96, 0x6a, 0x8e, 0x6b, 0x7e, 0x6c, 0x6e, 0x0c, 0x55, 0x8d, 0x3d, 0x0d, 0x1c, 0xd1, 0x05, 0x36, 0x14, 0x76, 0x1d, 0x1b, 0x1b, 0x90, 0x2a, 0x86, 0x4c, 0xaa, 0x66, 0x4d, 0x66, 0x6e, 0x56, 0x0e, 0x34, 0xef, 0x1b, 0x72, 0x24, 0x39, 0x2c, 0x5c, 0x2c, 0x5e, 0x34, 0x3f, 0x33, 0xde, 0x1a, 0x8d, 0x1a, 0x46, 0x34, 0x2b, 0x4d, 0xcf, 0x4e, 0x70, 0x46, 0x51, 0x2d, 0xb2, 0x15, 0x79, 0x1c, 0xfa, 0x24, 0x9b, 0x2c, 0x5e, 0x34, 0x1f, 0x34, 0x1f, 0x33, 0xff, 0x33, 0xff, 0x3c, 0x3f, 0x6d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x6b, 0x4a, 0x63, 0x4a, 0x62, 0x4a, 0xa3, 0x53, 0x03, 0x5b, 0x04, 0x6a, 0xc4, 0x93, 0x64, 0xb4, 0x25, 0xc4, 0x86, 0xcc, 0xc6, 0xdd, 0x06, 0xe5, 0x27, 0xe5, 0x67, 0xed, 0x67, 0xf5, 0x87, 0xf5, 0xa7, 0xf5, 0xc8, 0xfd, 0xc7, 0xf5, 0xc7, 0xf5, 0xc7, 0xf5, 0xc7, 0xed, 0xe6, 0xed, 0xe6, 0xe5, 0xe5, 0xdd, 0xe5, 0xde, 0x05, 0xd6, 0x05, 0xc6, 0x05, 0xbe, 0x06, 0xad, 0xe6, 0x9d, 0xc7, 0x8d, 0xa8, 0x75, 0x69, 0x5d, 0x0a, 0x44, 0xab, 0x34, 0x4b, 0x2b, 0xaa, 0x43, 0x25, 0x7c, 0xa6, 0x95, 0xa7, 0x9e, 0x28, 0x96, 0x69, 0x8e, 0x6a, 0x7e, 0x2b, 0x65, 0xcc, 0x4d, 0x2c, 0x2c, 0x8d, 0x0d, 0x15, 0x0c, 0x74, 0x1c, 0x97, 0x1c, 0xd9, 0x1b, 0x30, 0x2a, 0x86, 0x54, 0x89, 0x6e, 0x0c, 0x66, 0x2d, 0x4d, 0x8d, 0x34, 0x34, 0x23, 0x35, 0x23, 0xd6, 0x2c, 0x3b, 0x2c, 0x5d, 0x34, 0x3e, 0x34, 0x1f, 0x23, 0x14, 0x1a, 0x05, 0x2b, 0x68, 0x4d, 0x8e, 0x56, 0x50, 0x4e, 0x10, 0x25, 0x52, 0x15, 0x79, 0x1d, 0x3b, 0x24, 0xbb, 0x2c, 0x7d, 0x34, 0x5e, 0x34, 0x3f, 0x34, 0x1f, 0x34, 0x1f, 0x34, 0x1f, 0x5c, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xe6, 0x42, 0x43, 0x4a, 0xa4, 0x4a, 0xa5, 0x5a, 0x83, 0x8b, 0x24, 0xac, 0x05, 0xbc, 0x85, 0xcc, 0xc6, 0xd5, 0x26, 0xdd, 0x46, 0xe5, 0x86, 0xed, 0xa7, 0xf5, 0xc7, 0xfd, 0xc7, 0xfd, 0xe7, 0xfd, 0xe8, 0xfd, 0xe8, 0xfd, 0xe8, 0xfd, 0xe8, 0xf5, 0xc7, 0xf5, 0xc7, 0xed, 0xe6, 0xed, 0xe6, 0xe5, 0xe5, 0xdd, 0xe5, 0xd6, 0x05, 0xce, 0x05, 0xbd, 0xe5, 0xad, 0xc6, 0x9d, 0xa7, 0x85, 0x88, 0x6d, 0x29, 0x5c, 0xc9, 0x44, 0x8a, 0x34, 0x2b, 0x2b, 0xcb, 0x53, 0x65, 0x84, 0xe6, 0x9d, 0xc7, 0xa6, 0x48, 0x9e, 0x49, 0x96, 0x49, 0x7d, 0xea, 0x5d, 0x6b, 0x3c, 0x6a, 0x14, 0x2f, 0x0c, 0xd6, 0x13, 0xd4, 0x1c, 0x76, 0x1b, 0x93, 0x1b, 0x94, 0x22, 0xa9, 0x4c, 0x28, 0x65, 0xab, 0x5d, 0x8b, 0x44, 0x8d, 0x2b, 0xb9, 0x23, 0x79, 0x1b, 0x54, 0x2c, 0x1a, 0x2c, 0x3c, 0x2c, 0x3e, 0x34, 0x1e, 0x2b, 0x99, 0x12, 0x09, 0x22, 0x66, 0x44, 0x8b, 0x55, 0xee, 0x45, 0x4e, 0x14, 0xf3, 0x15, 0x9a, 0x1d, 0x5b, 0x24, 0xba, 0x2c, 0xbd, 0x2c, 0x5e, 0x34, 0x3f, 0x34, 0x3f, 0x34, 0x1f, 0x34, 0x3f, 0x44, 0x7f, 0xd6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x67, 0x8b, 0x44, 0xa3, 0xc4, 0xb4, 0x65, 0xc4, 0xc5, 0xd5, 0x25, 0xdd, 0x66, 0xe5, 0xa6, 0xed, 0xc6, 0xf5, 0xe6, 0xfd, 0xe7, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x08, 0xfd, 0xe8, 0xfd, 0xe8, 0xfd, 0xe8, 0xf5, 0xc7, 0xf5, 0xc7, 0xed, 0xe6, 0xed, 0xe5, 0xe5, 0xe5, 0xd5, 0xe5, 0xcd, 0xe5, 0xbd, 0xc5, 0xad, 0xa6, 0x95, 0x87, 0x85, 0x48, 0x6d, 0x08, 0x54, 0xa9, 0x44, 0x6a, 0x2c, 0xce, 0x34, 0x4d, 0x6b, 0xa4, 0x95, 0x06, 0xa5, 0xe7, 0xae, 0x27, 0x9e, 0x28, 0x8d, 0xe9, 0x75, 0x69, 0x54, 0xaa, 0x23, 0xac, 0x14, 0x13, 0x24, 0xdb, 0x24, 0x59, 0x1b, 0xd5, 0x23, 0x75, 0x1b, 0xb5, 0x22, 0xed, 0x32, 0xa5, 0x4c, 0x08, 0x44, 0x09, 0x33, 0xb3, 0x2b, 0xdc, 0x2b, 0xfd, 0x22, 0xf5, 0x23, 0xd8, 0x2c, 0x1b, 0x2c, 0x5d, 0x2c, 0x1d, 0x2b, 0xdc, 0x12, 0x4c, 0x12, 0x27, 0x22, 0xa6, 0x33, 0xea, 0x24, 0xaf, 0x0d, 0x76, 0x15, 0x9a, 0x1d, 0x3a, 0x24, 0xb9, 0x2c, 0xdc, 0x2c, 0x7d, 0x34, 0x5f, 0x34, 0x3e, 0x34, 0x1e, 0x34, 0x3f, 0x34, 0x5f, 0x5c, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa0, 0x7b, 0x23, 0x93, 0xa4, 0xac, 0x44, 0xbc, 0xc5, 0xcd, 0x25, 0xdd, 0x65, 0xe5, 0xa5, 0xed, 0xe6, 0xf6, 0x06, 0xfe, 0x26, 0xfe, 0x26, 0xfe, 0x27, 0xfe, 0x27, 0xfe, 0x27, 0xfe, 0x07, 0xfe, 0x07, 0xfd, 0xe8, 0xfd, 0xe8, 0xfd, 0xe8, 0xf5, 0xc7, 0xf5, 0xe6, 0xed, 0xe6, 0xe5, 0xe5, 0xd5, 0xc5, 0xc5, 0xa5, 0xb5, 0x85, 0xa5, 0x86, 0x95, 0x66, 0x7d, 0x27, 0x6c, 0xe8, 0x54, 0x89, 0x3c, 0x8c, 0x35, 0xd3, 0x3b, 0xeb, 0x6b, 0xa4, 0x9d, 0x25, 0xad, 0xe6, 0xa6, 0x07, 0x95, 0xc7, 0x85, 0x88, 0x64, 0xc8, 0x3c, 0x0c, 0x24, 0x97, 0x24, 0x79, 0x2c, 0xdd, 0x24, 0x5a, 0x2c, 0x3b, 0x23, 0xd8, 0x1b, 0x75, 0x23, 0x54, 0x22, 0x8a, 0x2a, 0x88, 0x2b, 0x93, 0x2b, 0x98, 0x2b, 0xfc, 0x2c, 0x1d, 0x23, 0x16, 0x1b, 0x13, 0x23, 0xd9, 0x2c, 0x5d, 0x2c, 0x1d, 0x2c, 0x1d, 0x12, 0x4d, 0x0a, 0x6b, 0x0a, 0x6a, 0x13, 0x6c, 0x15, 0x14, 0x15, 0x98, 0x15, 0xbb, 0x15, 0x39, 0x1c, 0xb9, 0x24, 0xfc, 0x2c, 0xbd, 0x2c, 0x7e, 0x34, 0x5e, 0x2c, 0x3e, 0x34, 0x5f, 0x34, 0x5f, 0x44, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 0x00, 0x00, 0x10, 0x82, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xa3, 0x8b, 0x63, 0xa4, 0x24, 0xb4, 0xc4, 0xc5, 0x25, 0xd5, 0x85, 0xdd, 0xc5, 0xe5, 0xe5, 0xf6, 0x26, 0xf6, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x27, 0xfe, 0x27, 0xfe, 0x07, 0xfd, 0xe8, 0xfd, 0xe8, 0xfd, 0xc7, 0xf5, 0xc7, 0xed, 0xc6, 0xe5, 0xc5, 0xd5, 0xa5, 0xc5, 0x84, 0xb5, 0x65, 0xa5, 0x45, 0x8d, 0x26, 0x7d, 0x07, 0x64, 0xa8, 0x44, 0x6b, 0x35, 0xb2, 0x36, 0x34, 0x3b, 0xa9, 0x6b, 0x43, 0x94, 0xe5, 0xad, 0xa6, 0xa5, 0xa6, 0x8d, 0x67, 0x74, 0xc7, 0x4c, 0x09, 0x24, 0x95, 0x1c, 0xb9, 0x24, 0xbb, 0x2c, 0xdc, 0x24, 0x3a, 0x2c, 0x9d, 0x2c, 0x1a, 0x2b, 0xfa, 0x23, 0x97, 0x1b, 0x33, 0x22, 0xf3, 0x2b, 0xd9, 0x23, 0x56, 0x2b, 0xfc, 0x2b, 0xfc, 0x2b, 0x9a, 0x1a, 0xb2, 0x23, 0x76, 0x2c, 0x5c, 0x2c, 0x1d, 0x34, 0x3e, 0x1a, 0x90, 0x0a, 0x4b, 0x0b, 0x6f, 0x0c, 0x32, 0x0d, 0x57, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0x38, 0x1c, 0xfa, 0x25, 0x1c, 0x2c, 0xbc, 0x2c, 0x9d, 0x34, 0x7e, 0x2c, 0x5e, 0x34, 0x5e, 0x34, 0x5f, 0x3c, 0x9e, 0x85, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x08, 0x21, 0x29, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x73, 0x03, 0x93, 0xe3, 0xac, 0xa4, 0xbd, 0x24, 0xcd, 0x84, 0xdd, 0xc5, 0xe6, 0x05, 0xee, 0x45, 0xf6, 0x65, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x27, 0xfe, 0x07, 0xfe, 0x07, 0xfd, 0xe8, 0xfd, 0xc8, 0xf5, 0xc7, 0xed, 0xa6, 0xdd, 0x85, 0xcd, 0x65, 0xbd, 0x44, 0xad, 0x25, 0x9d, 0x05, 0x84, 0xe6, 0x74, 0xa7, 0x4c, 0x49, 0x3d, 0x90, 0x3e, 0x53, 0x36, 0x54, 0x3c, 0x0b, 0x5a, 0xe3, 0x84, 0x44, 0x9d, 0x25, 0x8d, 0x06, 0x74, 0x45, 0x4c, 0x2a, 0x24, 0xf6, 0x1d, 0x1a, 0x24, 0x99, 0x25, 0x1c, 0x24, 0xdb, 0x24, 0x5a, 0x2c, 0xbd, 0x2b, 0xfa, 0x2c, 0x3d, 0x2b, 0xfb, 0x23, 0x56, 0x23, 0x14, 0x23, 0x97, 0x22, 0xf4, 0x2c, 0x1c, 0x2b, 0xdb, 0x2b, 0xdc, 0x2b, 0xba, 0x23, 0x34, 0x2c, 0x3b, 0x2c, 0x1c, 0x34, 0x5e, 0x23, 0x15, 0x0a, 0x0a, 0x03, 0x2e, 0x04, 0x74, 0x05, 0x58, 0x05, 0xb9, 0x05, 0xda, 0x0d, 0x17, 0x1d, 0x1a, 0x25, 0x1b, 0x24, 0xdc, 0x2c, 0xbd, 0x2c, 0x7d, 0x2c, 0x7e, 0x2c, 0x5e, 0x34, 0x7e, 0x34, 0x7e, 0x5d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa3, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xa2, 0x7b, 0x43, 0x9c, 0x43, 0xb4, 0xe4, 0xc5, 0x64, 0xd5, 0xc4, 0xde, 0x25, 0xe6, 0x65, 0xf6, 0x85, 0xf6, 0xa5, 0xfe, 0xa5, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x27, 0xfe, 0x07, 0xfd, 0xe8, 0xfd, 0xc8, 0xf5, 0xa7, 0xe5, 0x86, 0xd5, 0x65, 0xc5, 0x44, 0xb5, 0x24, 0xa5, 0x04, 0x8c, 0xc5, 0x7c, 0x86, 0x54, 0x07, 0x3d, 0x4e, 0x3e, 0x72, 0x3e, 0x53, 0x36, 0x13, 0x34, 0x8d, 0x4a, 0xa3, 0x63, 0x23, 0x73, 0xe4, 0x63, 0xa4, 0x43, 0xaa, 0x25, 0x17, 0x1d, 0x7b, 0x1c, 0xb8, 0x24, 0xdb, 0x25, 0x1c, 0x24, 0x9a, 0x2c, 0x9c, 0x2c, 0x9c, 0x23, 0xf9, 0x2c, 0x7e, 0x2c, 0x3c, 0x2b, 0xdb, 0x23, 0x15, 0x23, 0x55, 0x22, 0xf3, 0x2c, 0x3c, 0x2b, 0xba, 0x2b, 0xfc, 0x2c, 0x1d, 0x23, 0x35, 0x23, 0xb8, 0x2c, 0x1b, 0x34, 0x7e, 0x2b, 0xb9, 0x0a, 0x0b, 0x02, 0x6b, 0x03, 0xd0, 0x05, 0x36, 0x05, 0xb8, 0x05, 0xd9, 0x0c, 0xd6, 0x1d, 0x3a, 0x1d, 0x3b, 0x24, 0xfc, 0x2c, 0xdc, 0x2c, 0x9d, 0x2c, 0x9e, 0x2c, 0x7d, 0x34, 0x7e, 0x34, 0x9e, 0x44, 0xde, 0xde, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x22, 0x6a, 0xe2, 0x83, 0xc3, 0xa4, 0xa3, 0xbd, 0x44, 0xcd, 0xc4, 0xde, 0x24, 0xe6, 0x65, 0xee, 0xa5, 0xf6, 0xc5, 0xfe, 0xe5, 0xfe, 0xc5, 0xfe, 0xc5, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x27, 0xfe, 0x07, 0xfd, 0xe7, 0xf5, 0xa7, 0xed, 0x87, 0xdd, 0x66, 0xcd, 0x25, 0xbd, 0x04, 0xac, 0xe4, 0x9c, 0xa4, 0x84, 0x45, 0x5b, 0xe6, 0x45, 0x2d, 0x46, 0x71, 0x46, 0x72, 0x3e, 0x32, 0x35, 0x70, 0x24, 0xd1, 0x2b, 0xec, 0x42, 0xc5, 0x43, 0x47, 0x2b, 0x8b, 0x15, 0x17, 0x15, 0xbb, 0x15, 0x39, 0x1c, 0x98, 0x25, 0x3c, 0x25, 0x1b, 0x24, 0x9a, 0x2c, 0xfd, 0x24, 0x7b, 0x2c, 0x1a, 0x2c, 0x9e, 0x2b, 0xfa, 0x2b, 0xfb, 0x2b, 0xda, 0x23, 0x98, 0x23, 0x14, 0x2c, 0x1b, 0x23, 0x77, 0x2c, 0x1c, 0x34, 0x5e, 0x23, 0x77, 0x1a, 0xf2, 0x2b, 0xd9, 0x2c, 0x7e, 0x2c, 0x1b, 0x12, 0xb0, 0x02, 0x29, 0x03, 0x2d, 0x04, 0xd4, 0x05, 0xb8, 0x05, 0x97, 0x0c, 0xd6, 0x1d, 0x7b, 0x1d, 0x3a, 0x25, 0x1c, 0x24, 0xdc, 0x2c, 0xbd, 0x2c, 0xbe, 0x2c, 0x7d, 0x2c, 0x7e, 0x2c, 0x9e, 0x34, 0xbe, 0x75, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x04, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa2, 0x73, 0x42, 0x94, 0x23, 0xac, 0xe3, 0xc5, 0x84, 0xd6, 0x04, 0xde, 0x64, 0xee, 0xa4, 0xf6, 0xe5, 0xf7, 0x05, 0xf6, 0xe5, 0xfe, 0xe5, 0xfe, 0xe5, 0xfe, 0xc5, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x26, 0xfe, 0x07, 0xfd, 0xc7, 0xf5, 0x87, 0xe5, 0x67, 0xd5, 0x26, 0xc4, 0xe5, 0xb4, 0xc4, 0x9c, 0x84, 0x84, 0x44, 0x63, 0xa5, 0x4c, 0xcb, 0x56, 0x70, 0x4e, 0x71, 0x46, 0x31, 0x3d, 0x90, 0x2c, 0xf0, 0x1d, 0xd5, 0x1d, 0xf6, 0x1d, 0x74, 0x15, 0x14, 0x0d, 0x16, 0x0d, 0xba, 0x15, 0x9a, 0x14, 0xb7, 0x1c, 0xfa, 0x25, 0x5c, 0x24, 0xda, 0x24, 0xdb, 0x2c, 0xfd, 0x24, 0x39, 0x2c, 0x7c, 0x2c, 0x9d, 0x23, 0xd9, 0x2c, 0x1c, 0x2c, 0x5e, 0x2b, 0xfb, 0x23, 0x35, 0x2b, 0xf9, 0x23, 0x36, 0x2c, 0x3c, 0x34, 0x7e, 0x2c, 0x3d, 0x22, 0xf3, 0x23, 0xb8, 0x2c, 0x7d, 0x2c, 0x1c, 0x1b, 0x34, 0x0a, 0x4b, 0x02, 0xcb, 0x04, 0x31, 0x05, 0x56, 0x04, 0xb4, 0x0c, 0xf7, 0x15, 0x9b, 0x1d, 0x3a, 0x25, 0x3c, 0x24, 0xfc, 0x2c, 0xfd, 0x2c, 0xdd, 0x2c, 0x9c, 0x2c, 0x7d, 0x2c, 0xbe, 0x2c, 0xbe, 0x4d, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x62, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa0, 0x5a, 0xc2, 0x7b, 0x82, 0x9c, 0x83, 0xb5, 0x23, 0xc5, 0xc4, 0xd6, 0x44, 0xe6, 0xa4, 0xee, 0xe4, 0xf7, 0x05, 0xf7, 0x25, 0xf7, 0x05, 0xff, 0x05, 0xff, 0x05, 0xfe, 0xe5, 0xfe, 0xc5, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x26, 0xfe, 0x07, 0xf5, 0xa7, 0xed, 0x67, 0xdd, 0x27, 0xcc, 0xe6, 0xbc, 0xa4, 0xa4, 0x64, 0x8c, 0x03, 0x6b, 0xc4, 0x54, 0xea, 0x5e, 0x4f, 0x5e, 0x70, 0x56, 0x50, 0x45, 0x8f, 0x2c, 0xcf, 0x25, 0x94, 0x26, 0x16, 0x26, 0x16, 0x1d, 0xb5, 0x0d, 0x15, 0x05, 0x99, 0x0d, 0xba, 0x0d, 0x58, 0x14, 0x96, 0x1d, 0x5c, 0x25, 0x3b, 0x24, 0xb9, 0x24, 0xfc, 0x24, 0xdb, 0x24, 0x18, 0x2c, 0xbd, 0x2c, 0x7c, 0x23, 0xd9, 0x2c, 0x5c, 0x2c, 0x7d, 0x2b, 0xfa, 0x23, 0x34, 0x23, 0x55, 0x23, 0x35, 0x2c, 0x3c, 0x34, 0x9e, 0x2c, 0x7e, 0x23, 0x56, 0x23, 0xb7, 0x2c, 0x7c, 0x2c, 0x1a, 0x23, 0xb7, 0x0a, 0x8d, 0x0b, 0x0e, 0x03, 0x2d, 0x03, 0xd0, 0x0c, 0x73, 0x0d, 0x9a, 0x15, 0x9a, 0x15, 0x39, 0x25, 0x3c, 0x25, 0x1b, 0x24, 0xfc, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0x9c, 0x2c, 0xbe, 0x2c, 0xbe, 0x34, 0xdd, 0x86, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x10, 0x82, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x39, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x62, 0xc2, 0x83, 0xc2, 0xa4, 0xc3, 0xbd, 0x83, 0xce, 0x03, 0xde, 0x84, 0xe6, 0xe4, 0xf7, 0x24, 0xf7, 0x45, 0xf7, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x05, 0xfe, 0xe5, 0xfe, 0xc5, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x26, 0xf5, 0xc6, 0xed, 0x67, 0xdd, 0x27, 0xd4, 0xe6, 0xc4, 0xa5, 0xac, 0x44, 0x93, 0xe3, 0x73, 0xc4, 0x65, 0x4a, 0x66, 0x6e, 0x66, 0x6e, 0x5e, 0x4f, 0x4d, 0xae, 0x34, 0xcd, 0x2d, 0x93, 0x2e, 0x35, 0x2e, 0x15, 0x25, 0xd5, 0x15, 0x34, 0x05, 0x77, 0x05, 0xd9, 0x05, 0xb9, 0x0c, 0xb5, 0x1c, 0xf9, 0x1d, 0x7c, 0x1c, 0xfa, 0x24, 0xb9, 0x25, 0x1d, 0x24, 0x9a, 0x24, 0x39, 0x2c, 0xdd, 0x24, 0x3a, 0x23, 0xf9, 0x2c, 0x7c, 0x2c, 0x7d, 0x2b, 0xfa, 0x23, 0x13, 0x22, 0xd1, 0x23, 0x34, 0x2c, 0x5c, 0x2c, 0x9e, 0x2c, 0x7d, 0x23, 0x97, 0x23, 0x75, 0x24, 0x5a, 0x23, 0xf9, 0x2c, 0x5b, 0x12, 0xae, 0x0b, 0x70, 0x0c, 0x53, 0x0c, 0xd6, 0x0d, 0x99, 0x0d, 0xba, 0x0d, 0x99, 0x15, 0x39, 0x1d, 0x5b, 0x25, 0x1b, 0x25, 0x1c, 0x24, 0xdc, 0x2c, 0xdd, 0x2c, 0x9c, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0xdd, 0x55, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0x5a, 0xcb, 0x29, 0x25, 0x00, 0x20, 0x10, 0x82, 0x29, 0x25, 0x10, 0xa2, 0x29, 0x45, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x62, 0x62, 0xe2, 0x83, 0xe2, 0xa4, 0xe3, 0xbd, 0xa3, 0xd6, 0x43, 0xe6, 0xc4, 0xef, 0x04, 0xf7, 0x64, 0xff, 0x64, 0xff, 0x44, 0xff, 0x45, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xfe, 0xe5, 0xfe, 0xc5, 0xfe, 0xa6, 0xfe, 0x86, 0xf6, 0x26, 0xed, 0xe6, 0xe5, 0x86, 0xdd, 0x26, 0xd4, 0xc6, 0xc4, 0x86, 0xb4, 0x45, 0x93, 0xc3, 0x7b, 0xe5, 0x75, 0x8a, 0x76, 0x6d, 0x6e, 0x6d, 0x66, 0x4d, 0x5d, 0xcd, 0x3c, 0xac, 0x2d, 0x30, 0x36, 0x35, 0x2e, 0x35, 0x2e, 0x15, 0x25, 0x73, 0x0d, 0x55, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0x57, 0x14, 0xd6, 0x1d, 0x7b, 0x1d, 0x7b, 0x1c, 0xb9, 0x24, 0xfb, 0x25, 0x1c, 0x24, 0x38, 0x24, 0x9b, 0x2c, 0xdc, 0x23, 0xf8, 0x24, 0x19, 0x2c, 0x9d, 0x2c, 0x7c, 0x2c, 0x3b, 0x33, 0xd7, 0x2a, 0x8e, 0x1b, 0x34, 0x2c, 0x5c, 0x2c, 0xbe, 0x2c, 0x9d, 0x2b, 0xfa, 0x1b, 0x13, 0x23, 0xf8, 0x23, 0xf9, 0x2c, 0x9d, 0x1b, 0x12, 0x02, 0xed, 0x04, 0x74, 0x05, 0x37, 0x05, 0xb9, 0x05, 0xd9, 0x05, 0x78, 0x0d, 0x59, 0x1d, 0x7b, 0x1d, 0x3b, 0x25, 0x1c, 0x25, 0x1c, 0x2c, 0xfd, 0x2c, 0xbc, 0x2c, 0xdd, 0x2c, 0xdd, 0x2c, 0xdd, 0x3c, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x73, 0xae, 0x73, 0x8e, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x62, 0x62, 0xe2, 0x83, 0xe2, 0xa5, 0x02, 0xbd, 0xc3, 0xd6, 0x63, 0xe6, 0xe3, 0xef, 0x24, 0xf7, 0x64, 0xff, 0x64, 0xff, 0x64, 0xff, 0x44, 0xff, 0x45, 0xff, 0x25, 0xff, 0x25, 0xfe, 0xe5, 0xf6, 0xc5, 0xf6, 0x85, 0xee, 0x45, 0xe5, 0xe5, 0xdd, 0x85, 0xd5, 0x26, 0xcc, 0xc6, 0xbc, 0x66, 0xac, 0x05, 0x93, 0x84, 0x7c, 0x05, 0x7d, 0xaa, 0x7e, 0x6c, 0x7e, 0x6c, 0x76, 0x2c, 0x65, 0xac, 0x44, 0xcb, 0x35, 0x0f, 0x36, 0x34, 0x36, 0x34, 0x36, 0x14, 0x2d, 0x93, 0x15, 0x13, 0x05, 0xb7, 0x05, 0xf8, 0x05, 0xb8, 0x0c, 0xf6, 0x15, 0x5a, 0x1d, 0x9b, 0x1d, 0x3a, 0x1c, 0xd9, 0x25, 0x3c, 0x24, 0xfb, 0x24, 0x38, 0x24, 0xdc, 0x24, 0xbb, 0x23, 0xd7, 0x24, 0x3a, 0x2c, 0x9c, 0x2c, 0x7c, 0x2c, 0x3a, 0x34, 0x39, 0x22, 0x2c, 0x1b, 0x54, 0x2c, 0x7c, 0x2c, 0xbd, 0x2c, 0x9d, 0x2c, 0x3a, 0x23, 0x34, 0x1b, 0x54, 0x23, 0xd7, 0x2c, 0xbd, 0x23, 0xd7, 0x02, 0x6b, 0x03, 0xb0, 0x05, 0x16, 0x05, 0x98, 0x05, 0xb8, 0x05, 0x57, 0x15, 0x59, 0x1d, 0x9b, 0x1d, 0x3a, 0x25, 0x3c, 0x25, 0x1c, 0x25, 0x1d, 0x24, 0xfc, 0x2c, 0xdc, 0x2c, 0xfd, 0x2c, 0xfd, 0x35, 0x1d, 0x7d, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x52, 0x61, 0x63, 0x01, 0x83, 0xe2, 0xa5, 0x02, 0xbd, 0xc3, 0xd6, 0x63, 0xe6, 0xe3, 0xef, 0x44, 0xf7, 0x64, 0xff, 0x64, 0xff, 0x64, 0xff, 0x64, 0xff, 0x45, 0xf7, 0x25, 0xf7, 0x05, 0xf6, 0xc5, 0xee, 0x85, 0xe6, 0x25, 0xe5, 0xe5, 0xdd, 0x85, 0xd5, 0x25, 0xc4, 0xa5, 0xb4, 0x45, 0xa3, 0xc5, 0x83, 0x44, 0x7c, 0x05, 0x85, 0xe9, 0x8e, 0x6b, 0x86, 0x6b, 0x7e, 0x2b, 0x6d, 0x8b, 0x4c, 0xaa, 0x3d, 0x2f, 0x3e, 0x33, 0x36, 0x53, 0x36, 0x33, 0x35, 0xd3, 0x25, 0x12, 0x0d, 0x96, 0x0d, 0xf8, 0x0d, 0xd8, 0x05, 0x36, 0x0d, 0x17, 0x15, 0x9a, 0x15, 0x9b, 0x14, 0xf8, 0x1d, 0x1a, 0x25, 0x3c, 0x1c, 0x99, 0x24, 0x79, 0x24, 0xfc, 0x24, 0x7a, 0x23, 0xd7, 0x24, 0x7b, 0x2c, 0xbc, 0x2c, 0x7b, 0x2c, 0x3a, 0x3c, 0x59, 0x1a, 0x0c, 0x1b, 0x54, 0x2c, 0x7b, 0x2c, 0xdd, 0x2c, 0x9c, 0x2c, 0x7b, 0x4c, 0x57, 0x1a, 0x8f, 0x23, 0x95, 0x2c, 0xbc, 0x24, 0x7b, 0x0a, 0x4c, 0x02, 0xcc, 0x04, 0x31, 0x05, 0x15, 0x05, 0x56, 0x05, 0x16, 0x15, 0x79, 0x15, 0x9b, 0x1d, 0x3a, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x1d, 0x24, 0xfc, 0x24, 0xbb, 0x2c, 0xfd, 0x2c, 0xfd, 0x2d, 0x1d, 0x5d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa5, 0x4a, 0x61, 0x62, 0xe1, 0x7b, 0xe2, 0xa5, 0x02, 0xbd, 0xe2, 0xd6, 0x63, 0xe6, 0xe3, 0xef, 0x43, 0xf7, 0x64, 0xf7, 0x64, 0xf7, 0x64, 0xf7, 0x44, 0xf7, 0x24, 0xee, 0xe4, 0xee, 0xa5, 0xe6, 0x65, 0xde, 0x25, 0xd5, 0xc5, 0xcd, 0x85, 0xc5, 0x05, 0xbc, 0xa5, 0xac, 0x25, 0x9b, 0x84, 0x83, 0x44, 0x84, 0x86, 0x96, 0x09, 0x96, 0x6a, 0x8e, 0x4a, 0x85, 0xea, 0x6d, 0x49, 0x4c, 0xaa, 0x3d, 0x4e, 0x3e, 0x32, 0x3e, 0x53, 0x3e, 0x33, 0x35, 0xf2, 0x2d, 0x11, 0x1d, 0x54, 0x15, 0xf7, 0x15, 0xf7, 0x0d, 0x96, 0x0c, 0xd4, 0x0d, 0x79, 0x0d, 0xba, 0x15, 0x59, 0x1c, 0xf9, 0x1d, 0x5b, 0x1d, 0x3b, 0x1c, 0x57, 0x24, 0xba, 0x24, 0xfc, 0x24, 0x38, 0x23, 0xf7, 0x24, 0x9b, 0x2c, 0xbc, 0x24, 0x7b, 0x2c, 0x39, 0x54, 0xb9, 0x12, 0x0c, 0x1b, 0x75, 0x24, 0x9b, 0x2c, 0xdd, 0x2c, 0xbc, 0x2c, 0x7a, 0x65, 0x1a, 0x1a, 0x0c, 0x1b, 0x54, 0x24, 0x9b, 0x2c, 0xbc, 0x12, 0xcf, 0x02, 0x4a, 0x02, 0xec, 0x04, 0x11, 0x04, 0xb3, 0x0d, 0x16, 0x15, 0x9a, 0x15, 0xba, 0x15, 0x39, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x1c, 0x25, 0x1c, 0x24, 0xdb, 0x24, 0xfc, 0x25, 0x1d, 0x25, 0x1d, 0x3d, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x62, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x61, 0x5a, 0xa1, 0x73, 0x81, 0x94, 0xa2, 0xb5, 0xa2, 0xce, 0x42, 0xde, 0xc3, 0xe7, 0x03, 0xef, 0x23, 0xef, 0x24, 0xef, 0x04, 0xe6, 0xe4, 0xe6, 0xc4, 0xde, 0x84, 0xde, 0x44, 0xd6, 0x04, 0xcd, 0xa4, 0xc5, 0x44, 0xbc, 0xe4, 0xb4, 0x84, 0xa3, 0xe4, 0x8b, 0x44, 0x7b, 0x64, 0x8d, 0x06, 0x9e, 0x28, 0x9e, 0x28, 0x96, 0x08, 0x85, 0xa8, 0x75, 0x08, 0x54, 0x69, 0x3d, 0x4e, 0x46, 0x31, 0x46, 0x52, 0x3e, 0x32, 0x3e, 0x12, 0x2d, 0x30, 0x25, 0x12, 0x1d, 0xd6, 0x1d, 0xf7, 0x15, 0xd6, 0x0c, 0xd4, 0x05, 0x37, 0x0d, 0xba, 0x0d, 0xba, 0x0c, 0xf7, 0x1d, 0x1a, 0x1d, 0x7b, 0x1c, 0xd9, 0x1c, 0x57, 0x24, 0xfb, 0x24, 0xfb, 0x1b, 0xf6, 0x24, 0x18, 0x24, 0xbb, 0x24, 0xbc, 0x24, 0x7a, 0x2c, 0x39, 0x75, 0x5a, 0x12, 0x0d, 0x1b, 0x95, 0x24, 0x9b, 0x2c, 0xdd, 0x2c, 0xbc, 0x2c, 0x7a, 0x65, 0x1b, 0x1a, 0x0b, 0x1b, 0x33, 0x24, 0x9a, 0x2c, 0xfd, 0x1b, 0xb5, 0x0a, 0x4b, 0x02, 0xab, 0x03, 0x2d, 0x04, 0x31, 0x0d, 0x58, 0x0d, 0xba, 0x0d, 0xba, 0x15, 0x38, 0x1d, 0x5b, 0x1d, 0x5b, 0x25, 0x3c, 0x25, 0x3c, 0x24, 0xfb, 0x25, 0x1c, 0x25, 0x1d, 0x25, 0x1d, 0x2d, 0x3c, 0x6d, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x62, 0x52, 0x81, 0x63, 0x01, 0x7b, 0xe1, 0x9c, 0xe2, 0xb5, 0xa2, 0xce, 0x22, 0xd6, 0x83, 0xd6, 0x83, 0xde, 0xa3, 0xde, 0x83, 0xd6, 0x63, 0xd6, 0x24, 0xce, 0x04, 0xc5, 0xa4, 0xbd, 0x44, 0xb4, 0xe4, 0xac, 0x84, 0x9c, 0x04, 0x8b, 0x83, 0x7b, 0x03, 0x7b, 0xa4, 0x95, 0x46, 0xa5, 0xe7, 0x9d, 0xc7, 0x95, 0xa7, 0x85, 0x47, 0x6c, 0x87, 0x4c, 0x69, 0x45, 0x4e, 0x45, 0xf0, 0x46, 0x30, 0x46, 0x31, 0x46, 0x11, 0x35, 0x2f, 0x25, 0x11, 0x25, 0xd5, 0x25, 0xf6, 0x1d, 0xf6, 0x15, 0x54, 0x0c, 0xf5, 0x05, 0x98, 0x05, 0xb9, 0x05, 0x58, 0x14, 0xf7, 0x1d, 0x5a, 0x1d, 0x5b, 0x1c, 0x56, 0x1c, 0x78, 0x25, 0x1b, 0x24, 0x99, 0x1b, 0xd5, 0x24, 0x58, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0x7a, 0x34, 0x58, 0x7d, 0x99, 0x12, 0x2d, 0x1b, 0x95, 0x24, 0xbb, 0x2c, 0xfd, 0x24, 0xbc, 0x2c, 0x7a, 0x65, 0x7a, 0x2a, 0x4c, 0x1b, 0x11, 0x24, 0x79, 0x2c, 0xfd, 0x24, 0xbb, 0x0a, 0xad, 0x03, 0x2e, 0x04, 0x32, 0x0d, 0x17, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xb9, 0x0d, 0x18, 0x1d, 0x7b, 0x1d, 0x7b, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x1b, 0x24, 0xfb, 0x25, 0x3c, 0x25, 0x3c, 0x2d, 0x3c, 0x55, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x62, 0x52, 0x61, 0x4a, 0x61, 0x4a, 0x41, 0x83, 0xe1, 0x9c, 0xe2, 0xb5, 0x82, 0xbd, 0xc2, 0xc5, 0xe3, 0xc6, 0x03, 0xc5, 0xe3, 0xbd, 0xa3, 0xbd, 0x63, 0xb5, 0x23, 0xac, 0xe3, 0xa4, 0x83, 0x94, 0x03, 0x83, 0x63, 0x72, 0xc3, 0x5a, 0x83, 0x6b, 0x64, 0x84, 0x65, 0x95, 0x05, 0x95, 0x26, 0x8d, 0x06, 0x7c, 0x86, 0x53, 0xc6, 0x3b, 0xc9, 0x44, 0xec, 0x45, 0x8e, 0x4d, 0xef, 0x4e, 0x10, 0x46, 0x10, 0x3d, 0x2e, 0x24, 0x8f, 0x25, 0xb4, 0x2d, 0xf5, 0x26, 0x16, 0x25, 0x74, 0x0d, 0x14, 0x05, 0x77, 0x05, 0xb8, 0x05, 0xb8, 0x0c, 0xf6, 0x15, 0x18, 0x1d, 0x7a, 0x14, 0xf8, 0x1c, 0x36, 0x1c, 0xd9, 0x25, 0x1b, 0x1b, 0xf5, 0x1b, 0xb5, 0x24, 0x79, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0x79, 0x34, 0x78, 0xff, 0xff, 0x12, 0x2c, 0x1b, 0x95, 0x24, 0xbb, 0x24, 0xfc, 0x24, 0xdb, 0x24, 0x7a, 0x54, 0xfb, 0x21, 0xe9, 0x12, 0xcf, 0x24, 0x58, 0x25, 0x1c, 0x25, 0x1d, 0x13, 0x73, 0x02, 0xcd, 0x04, 0x33, 0x05, 0x37, 0x05, 0xb9, 0x05, 0xd9, 0x05, 0xb9, 0x0d, 0x17, 0x15, 0x7b, 0x1d, 0x7b, 0x1d, 0x5b, 0x25, 0x5c, 0x25, 0x3c, 0x25, 0x1b, 0x25, 0x3c, 0x25, 0x3c, 0x25, 0x3c, 0x3d, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x87, 0x42, 0x21, 0x18, 0xc0, 0x10, 0x80, 0x52, 0x61, 0x7b, 0xe1, 0x94, 0x82, 0x9c, 0xc2, 0x9c, 0xe2, 0xa4, 0xe2, 0xa4, 0xe2, 0x9c, 0xa3, 0x94, 0x63, 0x8c, 0x23, 0x83, 0xc3, 0x7b, 0x42, 0x62, 0xc3, 0x4a, 0xa5, 0x2a, 0x67, 0x3a, 0x23, 0x5b, 0x03, 0x6b, 0xa4, 0x74, 0x04, 0x6c, 0x26, 0x54, 0x09, 0x33, 0x07, 0x2a, 0xc6, 0x33, 0xc9, 0x44, 0xcc, 0x4d, 0x6d, 0x4d, 0xee, 0x4d, 0xcf, 0x3c, 0xcd, 0x2c, 0x4d, 0x2d, 0x52, 0x2d, 0xf4, 0x2e, 0x15, 0x25, 0x94, 0x14, 0xf3, 0x05, 0x35, 0x05, 0xb7, 0x05, 0xd8, 0x05, 0x36, 0x0c, 0xd6, 0x15, 0x59, 0x15, 0x7a, 0x14, 0x96, 0x1c, 0x56, 0x1c, 0xfa, 0x1c, 0xda, 0x1b, 0x73, 0x1b, 0xd5, 0x24, 0x99, 0x24, 0xfb, 0x24, 0xbb, 0x24, 0x79, 0x2c, 0x58, 0x00, 0x00, 0x12, 0x2c, 0x1b, 0x94, 0x24, 0xdb, 0x25, 0x1c, 0x24, 0xdb, 0x2c, 0x99, 0x55, 0x3a, 0x00, 0x00, 0x12, 0xaf, 0x1c, 0x37, 0x25, 0x1c, 0x25, 0x3d, 0x24, 0x78, 0x02, 0xac, 0x03, 0xd0, 0x04, 0xf5, 0x05, 0xb8, 0x05, 0xd9, 0x05, 0x77, 0x0d, 0x17, 0x15, 0x9b, 0x15, 0x9a, 0x1d, 0x7b, 0x1d, 0x7c, 0x1d, 0x5b, 0x1d, 0x1a, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x5c, 0x35, 0x5c, 0x85, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x29, 0x41, 0x4a, 0x61, 0x5a, 0xa1, 0x63, 0x21, 0x73, 0x61, 0x73, 0x82, 0x73, 0x82, 0x7b, 0xa2, 0x73, 0x62, 0x6b, 0x02, 0x62, 0xc2, 0x52, 0xa3, 0x3a, 0xa6, 0x1a, 0xea, 0x13, 0x0d, 0x0a, 0x4a, 0x09, 0xc7, 0x22, 0x26, 0x32, 0xa7, 0x2b, 0x09, 0x1b, 0x4d, 0x0b, 0x90, 0x12, 0xeb, 0x22, 0x86, 0x3b, 0xa8, 0x44, 0xcb, 0x4d, 0x4c, 0x4d, 0x4c, 0x34, 0x2b, 0x23, 0xec, 0x2d, 0x11, 0x2d, 0xb3, 0x2d, 0xf4, 0x2d, 0x93, 0x1c, 0xd1, 0x0c, 0xd3, 0x0d, 0x76, 0x0d, 0xd7, 0x05, 0x77, 0x04, 0x94, 0x0c, 0xf7, 0x0d, 0x79, 0x14, 0xf7, 0x13, 0xd3, 0x1c, 0x77, 0x1d, 0x1a, 0x1c, 0x35, 0x13, 0x10, 0x1c, 0x16, 0x24, 0xba, 0x24, 0xfb, 0x24, 0xba, 0x24, 0x78, 0x54, 0xf9, 0x00, 0x00, 0x1a, 0x6c, 0x1b, 0x94, 0x24, 0xda, 0x25, 0x1c, 0x24, 0xdb, 0x34, 0xd9, 0x85, 0x79, 0x00, 0x00, 0x1a, 0xaf, 0x1c, 0x16, 0x24, 0xfc, 0x25, 0x3d, 0x24, 0xfb, 0x0a, 0xef, 0x03, 0x0d, 0x04, 0x93, 0x05, 0x97, 0x05, 0xb8, 0x05, 0x15, 0x0d, 0x17, 0x15, 0xba, 0x15, 0x9a, 0x15, 0x7b, 0x1d, 0x7c, 0x1d, 0x7b, 0x1d, 0x1a, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x5c, 0x25, 0x5b, 0x66, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x00, 0x00, 0x10, 0xa2, 0x52, 0x69, 0x63, 0x05, 0x5a, 0xa3, 0x52, 0x62, 0x52, 0x82, 0x52, 0x82, 0x52, 0x82, 0x5a, 0xa2, 0x5a, 0xa2, 0x4a, 0x63, 0x32, 0x44, 0x22, 0x66, 0x12, 0xca, 0x03, 0x0c, 0x0b, 0x2d, 0x33, 0x6e, 0x01, 0xe8, 0x01, 0xc8, 0x02, 0x09, 0x02, 0x8c, 0x03, 0x0e, 0x03, 0x70, 0x0b, 0x90, 0x0b, 0x4f, 0x1a, 0xa8, 0x33, 0x68, 0x4c, 0x6a, 0x4c, 0x6b, 0x3b, 0xaa, 0x1b, 0x09, 0x24, 0x6e, 0x2d, 0x51, 0x35, 0xb2, 0x2d, 0x72, 0x24, 0xb0, 0x14, 0x30, 0x0c, 0xf3, 0x0d, 0x96, 0x0d, 0xb6, 0x04, 0xb3, 0x04, 0x74, 0x0d, 0x37, 0x0d, 0x58, 0x0b, 0xf2, 0x13, 0x92, 0x1c, 0xb8, 0x1c, 0xf9, 0x13, 0x10, 0x12, 0xf0, 0x1c, 0x36, 0x24, 0xda, 0x24, 0xfb, 0x24, 0xba, 0x2c, 0x58, 0x75, 0x38, 0x00, 0x00, 0x22, 0x4c, 0x1b, 0x73, 0x24, 0xda, 0x25, 0x1c, 0x24, 0xda, 0x3c, 0xd9, 0xce, 0x5c, 0x00, 0x00, 0x1a, 0x8d, 0x1b, 0xd4, 0x24, 0xfb, 0x25, 0x3c, 0x25, 0x3c, 0x13, 0xb4, 0x02, 0x4a, 0x03, 0xaf, 0x04, 0xd4, 0x05, 0x15, 0x04, 0x93, 0x0d, 0x58, 0x0d, 0xba, 0x0d, 0x9a, 0x15, 0x7a, 0x1d, 0x9b, 0x1d, 0x9b, 0x1d, 0x3a, 0x1d, 0x5b, 0x1d, 0x7c, 0x1d, 0x7c, 0x25, 0x7c, 0x45, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa3, 0x00, 0x00, 0x10, 0x82, 0x5a, 0xcb, 0xff, 0xff, 0x00, 0x00, 0x9c, 0xad, 0x83, 0xea, 0x7b, 0xc9, 0x7b, 0xc9, 0x7b, 0xc9, 0x83, 0xeb, 0x94, 0x4c, 0x1a, 0x07, 0x09, 0xe8, 0x02, 0x6a, 0x0a, 0xab, 0x23, 0x2d, 0x5c, 0x51, 0x0a, 0x08, 0x01, 0xc7, 0x01, 0xe8, 0x02, 0x6a, 0x02, 0xed, 0x03, 0x4f, 0x03, 0x90, 0x03, 0x70, 0x03, 0x4f, 0x0a, 0xed, 0x2b, 0x4c, 0x6c, 0x8e, 0x8c, 0xd1, 0x2a, 0x69, 0x1a, 0xc9, 0x23, 0xec, 0x2c, 0xcf, 0x2c, 0xf0, 0x2c, 0x8f, 0x13, 0x4c, 0x14, 0x30, 0x15, 0x34, 0x15, 0x96, 0x0c, 0xb2, 0x03, 0xd0, 0x04, 0xb5, 0x05, 0x37, 0x0c, 0xf6, 0x13, 0x0f, 0x13, 0xb2, 0x14, 0xd8, 0x14, 0x76, 0x12, 0x8d, 0x13, 0x10, 0x1c, 0x57, 0x1c, 0xfa, 0x1c, 0xfa, 0x1c, 0xb9, 0x34, 0xb8, 0xae, 0x1b, 0x00, 0x00, 0x22, 0x8c, 0x13, 0x72, 0x1c, 0xda, 0x25, 0x1b, 0x24, 0xda, 0x34, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x12, 0x2b, 0x13, 0x72, 0x1c, 0xfa, 0x25, 0x5c, 0x25, 0x5c, 0x1c, 0x98, 0x0a, 0x6b, 0x02, 0xab, 0x03, 0x2d, 0x03, 0xaf, 0x04, 0xb4, 0x05, 0xb9, 0x05, 0xda, 0x0d, 0x99, 0x15, 0x9a, 0x1d, 0x9b, 0x1d, 0x9b, 0x1d, 0x3a, 0x1d, 0x5b, 0x1d, 0x7c, 0x1d, 0x7c, 0x1d, 0x7b, 0x3d, 0x9b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x00, 0x20, 0x10, 0x82, 0x62, 0xec, 0xe7, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa6, 0x0a, 0x08, 0x0a, 0x08, 0x12, 0x6a, 0x33, 0x2d, 0x84, 0xf4, 0x11, 0xe8, 0x01, 0xc7, 0x01, 0xe8, 0x02, 0x29, 0x02, 0xab, 0x03, 0x2e, 0x03, 0x6f, 0x03, 0x6f, 0x03, 0x4f, 0x03, 0x0e, 0x13, 0x2e, 0x5c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2a, 0x12, 0x68, 0x1b, 0x09, 0x2b, 0xec, 0x3c, 0x8f, 0x4c, 0x2f, 0x13, 0x2c, 0x14, 0x50, 0x1d, 0x33, 0x14, 0x92, 0x0b, 0x0c, 0x03, 0x8f, 0x04, 0xb4, 0x0c, 0xd5, 0x35, 0x36, 0x1a, 0xee, 0x13, 0xd2, 0x14, 0x96, 0x1b, 0xf4, 0x12, 0x8d, 0x13, 0x51, 0x1c, 0x77, 0x1c, 0xfa, 0x1c, 0xfa, 0x1c, 0x98, 0x3c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6b, 0x13, 0x51, 0x1c, 0xda, 0x25, 0x1b, 0x24, 0xd9, 0x34, 0x77, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x4b, 0x13, 0x51, 0x1c, 0xd9, 0x25, 0x5c, 0x25, 0x5c, 0x1d, 0x1b, 0x13, 0x51, 0x02, 0xcc, 0x03, 0x2d, 0x04, 0x11, 0x05, 0x78, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0x99, 0x0d, 0x99, 0x15, 0x9b, 0x15, 0x9b, 0x15, 0x59, 0x1d, 0x5a, 0x1d, 0x7b, 0x1d, 0x7b, 0x1d, 0x9b, 0x25, 0x9b, 0x5e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x00, 0x20, 0x20, 0xe4, 0x63, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x2a, 0xcb, 0x43, 0x2d, 0x6c, 0x51, 0xae, 0x59, 0x00, 0x00, 0x01, 0xc7, 0x01, 0xc7, 0x02, 0x08, 0x02, 0x8a, 0x03, 0x0d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x4e, 0x03, 0x0d, 0x13, 0x2e, 0x4c, 0x11, 0xff, 0xff, 0x00, 0x00, 0x01, 0xc7, 0x0a, 0x4b, 0x0a, 0x6b, 0x33, 0x2c, 0x64, 0x90, 0x85, 0x75, 0x01, 0xa6, 0x13, 0x0b, 0x13, 0xad, 0x1b, 0xef, 0x23, 0x8e, 0x1a, 0xab, 0x03, 0x0d, 0x04, 0x11, 0x24, 0xd4, 0x96, 0x7a, 0x0a, 0x8c, 0x0b, 0x70, 0x13, 0xf3, 0x33, 0xf3, 0x22, 0xcd, 0x13, 0x72, 0x1c, 0x98, 0x1d, 0x1a, 0x1c, 0xf9, 0x24, 0x98, 0x4c, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x13, 0x51, 0x1c, 0xd9, 0x1d, 0x1b, 0x24, 0xd9, 0x4c, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x12, 0xef, 0x1c, 0x98, 0x1d, 0x5b, 0x1d, 0x5c, 0x1d, 0x3b, 0x2c, 0x97, 0x0a, 0xcc, 0x03, 0xf1, 0x04, 0xf5, 0x05, 0x98, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0x98, 0x0d, 0x99, 0x15, 0xba, 0x15, 0xba, 0x15, 0x9a, 0x15, 0x5a, 0x1d, 0x9b, 0x1d, 0x9b, 0x1d, 0x9b, 0x1d, 0x9b, 0x55, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x00, 0x20, 0x29, 0x25, 0x84, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x09, 0xc7, 0x01, 0xe7, 0x02, 0x49, 0x02, 0xcb, 0x03, 0x4d, 0x03, 0x6e, 0x03, 0x4e, 0x03, 0x2d, 0x0b, 0x0d, 0x44, 0x11, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x19, 0xea, 0x0a, 0x2a, 0x22, 0xed, 0x74, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0b, 0x2b, 0x2c, 0x4b, 0xcf, 0x7c, 0xb3, 0x22, 0xab, 0x0a, 0xab, 0x23, 0xd0, 0x75, 0xd7, 0x00, 0x00, 0x12, 0x4b, 0x1b, 0x0e, 0x33, 0xf2, 0x74, 0xf5, 0x12, 0x8c, 0x13, 0xb2, 0x1c, 0xb8, 0x1d, 0x1a, 0x1c, 0xd9, 0x24, 0xb7, 0x7d, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x19, 0x68, 0x13, 0x51, 0x1c, 0xd8, 0x1d, 0x1a, 0x24, 0xd9, 0x6d, 0x99, 0x00, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x12, 0xad, 0x1c, 0x56, 0x1d, 0x5b, 0x1d, 0x7b, 0x1d, 0x3a, 0x2c, 0xf9, 0x12, 0x8b, 0x03, 0x6e, 0x04, 0xb4, 0x05, 0x77, 0x05, 0xd8, 0x05, 0xb8, 0x05, 0x77, 0x0d, 0x99, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0x99, 0x15, 0x59, 0x15, 0x9b, 0x15, 0x9b, 0x15, 0x9b, 0x15, 0x9b, 0x3d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x08, 0x21, 0x29, 0x45, 0x84, 0x30, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe7, 0x09, 0xc7, 0x0a, 0x08, 0x0a, 0x8a, 0x03, 0x0c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x2d, 0x03, 0x0c, 0x2b, 0x8f, 0xae, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x5b, 0xf0, 0x8d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x5c, 0x30, 0x85, 0x55, 0x00, 0x00, 0x00, 0x00, 0x64, 0x10, 0x74, 0xb2, 0x9d, 0xb6, 0x00, 0x00, 0x12, 0xad, 0x13, 0xd3, 0x14, 0xd8, 0x1d, 0x19, 0x1c, 0xd8, 0x34, 0xd7, 0xce, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x50, 0x1c, 0xb7, 0x1d, 0x19, 0x24, 0xd8, 0x85, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x8c, 0x14, 0x14, 0x1d, 0x5a, 0x1d, 0x7b, 0x1d, 0x3a, 0x2c, 0xf8, 0x53, 0x2a, 0x02, 0xec, 0x03, 0xf0, 0x04, 0xf4, 0x05, 0x76, 0x05, 0x56, 0x05, 0x56, 0x0d, 0xb9, 0x0d, 0xda, 0x0d, 0xba, 0x0d, 0x99, 0x0d, 0x59, 0x15, 0xbb, 0x15, 0xbb, 0x15, 0xba, 0x0d, 0x9a, 0x2d, 0xba, 0xde, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x08, 0x21, 0x31, 0xa6, 0x94, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x08, 0x09, 0xe7, 0x09, 0xe7, 0x0a, 0x49, 0x0a, 0xcb, 0x0b, 0x2c, 0x0b, 0x4d, 0x03, 0x2d, 0x02, 0xec, 0x23, 0x6e, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcd, 0x13, 0xf3, 0x14, 0xf8, 0x15, 0x18, 0x1c, 0xb7, 0x4c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x14, 0x76, 0x14, 0xf8, 0x34, 0xf8, 0xae, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2b, 0x13, 0xb2, 0x15, 0x39, 0x1d, 0x7b, 0x1d, 0x3a, 0x24, 0xd7, 0x00, 0x00, 0x12, 0xab, 0x02, 0xec, 0x03, 0xd0, 0x04, 0x92, 0x0c, 0xf4, 0x05, 0x36, 0x05, 0xb9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0x99, 0x0d, 0x58, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xba, 0x1d, 0xba, 0x5e, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x08, 0x21, 0x39, 0xc7, 0x9c, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe7, 0x09, 0xe7, 0x0a, 0x08, 0x0a, 0x8a, 0x0a, 0xeb, 0x0b, 0x2c, 0x0b, 0x2c, 0x0a, 0xec, 0x1b, 0x2c, 0x64, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x12, 0xcd, 0x0c, 0x13, 0x14, 0xf7, 0x14, 0xf8, 0x1c, 0x96, 0x75, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcd, 0x14, 0x55, 0x14, 0xb7, 0x3c, 0xd6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x4a, 0x0b, 0x4f, 0x14, 0xf8, 0x15, 0x7a, 0x15, 0x39, 0x2c, 0xf8, 0x00, 0x00, 0x5a, 0xab, 0x0a, 0x49, 0x02, 0xab, 0x0b, 0x6d, 0x0c, 0x51, 0x05, 0x56, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0x98, 0x0d, 0x58, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xba, 0x0d, 0xb9, 0x4e, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x62, 0x08, 0x21, 0x39, 0xc7, 0xad, 0x55, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x08, 0x09, 0xc7, 0x09, 0xe7, 0x0a, 0x28, 0x0a, 0xca, 0x13, 0x0b, 0x0b, 0x0c, 0x0a, 0xeb, 0x23, 0x2c, 0x6c, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcd, 0x0c, 0x13, 0x0c, 0xf7, 0x14, 0xd7, 0x34, 0xd6, 0xc6, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xcd, 0x0b, 0xd2, 0x1c, 0x75, 0x54, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 0x0b, 0x0e, 0x14, 0x95, 0x15, 0x79, 0x15, 0x39, 0x35, 0x37, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4a, 0x02, 0x6a, 0x03, 0x0c, 0x04, 0x72, 0x05, 0x97, 0x05, 0xd9, 0x05, 0xf9, 0x05, 0xd9, 0x05, 0x97, 0x05, 0x57, 0x05, 0xda, 0x05, 0xda, 0x05, 0xd9, 0x05, 0xd9, 0x0d, 0xb9, 0x35, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x82, 0x08, 0x21, 0x31, 0x86, 0xad, 0x55, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe7, 0x09, 0xe6, 0x09, 0xe7, 0x12, 0x69, 0x12, 0xca, 0x12, 0xeb, 0x0a, 0xca, 0x1a, 0xeb, 0x64, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xed, 0x0b, 0xf2, 0x0c, 0xd6, 0x14, 0x95, 0x4c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x90, 0x1b, 0x4f, 0x34, 0x33, 0xa6, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xac, 0x0c, 0x13, 0x0d, 0x38, 0x15, 0x38, 0x45, 0x37, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x2c, 0x0a, 0x8b, 0x03, 0x8f, 0x04, 0xb4, 0x05, 0x76, 0x05, 0xd8, 0x05, 0xf8, 0x05, 0xd8, 0x05, 0x97, 0x05, 0x57, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xb9, 0x1d, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x10, 0x82, 0x08, 0x61, 0x39, 0xe7, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe7, 0x11, 0xe6, 0x12, 0x07, 0x12, 0x89, 0x12, 0xaa, 0x12, 0xaa, 0x1a, 0xca, 0x53, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x8c, 0x03, 0xd1, 0x04, 0x94, 0x24, 0x94, 0x95, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x52, 0x7d, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xed, 0x0b, 0x90, 0x0c, 0xd6, 0x14, 0xf6, 0x5d, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x8b, 0x03, 0x0d, 0x04, 0x52, 0x05, 0x35, 0x0d, 0xb7, 0x0d, 0xf8, 0x0d, 0xd7, 0x0d, 0x76, 0x05, 0x77, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x05, 0xd9, 0x25, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x41, 0x08, 0x61, 0x4a, 0x29, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x11, 0xc6, 0x11, 0xe6, 0x12, 0x27, 0x12, 0x68, 0x12, 0x89, 0x2a, 0xeb, 0x53, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6a, 0x03, 0x6f, 0x0c, 0x32, 0x54, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x13, 0x2e, 0x04, 0x12, 0x1c, 0x74, 0x75, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xaf, 0x0a, 0xcb, 0x0b, 0xaf, 0x0c, 0xf4, 0x0d, 0x96, 0x0d, 0xd7, 0x0d, 0x96, 0x0d, 0x55, 0x05, 0x97, 0x05, 0xf9, 0x05, 0xf9, 0x05, 0xf9, 0x05, 0xf8, 0x05, 0xd8, 0x1d, 0xb8, 0x7e, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x08, 0x41, 0x10, 0x62, 0x4a, 0x49, 0xbd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x08, 0x11, 0xe6, 0x11, 0xe6, 0x12, 0x07, 0x12, 0x48, 0x33, 0x0b, 0x7c, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xab, 0x13, 0x0d, 0x3c, 0x11, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2d, 0x0b, 0x4e, 0x2c, 0x32, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xeb, 0x0b, 0x0c, 0x0c, 0x10, 0x0c, 0xf3, 0x15, 0x34, 0x15, 0x34, 0x0d, 0x35, 0x05, 0xd8, 0x05, 0xf8, 0x05, 0xf8, 0x05, 0xf8, 0x05, 0xf8, 0x05, 0xf8, 0x0d, 0xb7, 0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x63, 0x2c, 0x00, 0x00, 0x29, 0x65, 0x00, 0x00, 0x10, 0xa2, 0x52, 0x8a, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x47, 0x11, 0xe6, 0x11, 0xe6, 0x1a, 0x27, 0x3b, 0x0b, 0x84, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xb3, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x10, 0x84, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xeb, 0x0b, 0x0b, 0x0b, 0xae, 0x14, 0x50, 0x14, 0xb2, 0x0d, 0x76, 0x0d, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x15, 0xb7, 0x66, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x62, 0xec, 0x00, 0x00, 0x00, 0x20, 0x10, 0xa2, 0x52, 0xaa, 0xc5, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x46, 0x2a, 0x68, 0x32, 0xca, 0x63, 0xee, 0xad, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x10, 0x0a, 0x49, 0x0a, 0x89, 0x13, 0x4c, 0x14, 0x92, 0x0d, 0x96, 0x0d, 0xf7, 0x0d, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x15, 0xf7, 0x15, 0xf7, 0x1d, 0xd7, 0x56, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x52, 0x6a, 0x00, 0x00, 0x00, 0x20, 0x42, 0x08, 0xef, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xc7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x49, 0x0a, 0x69, 0x0b, 0x8e, 0x0c, 0xf3, 0x15, 0x96, 0x15, 0xd7, 0x15, 0xf7, 0x15, 0xf7, 0x15, 0xf7, 0x16, 0x17, 0x15, 0xf7, 0x1d, 0xf7, 0x4d, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x18, 0xa3, 0x29, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x2c, 0x0a, 0x69, 0x0b, 0x6d, 0x14, 0x92, 0x15, 0x54, 0x15, 0xb6, 0x1d, 0xf7, 0x1e, 0x17, 0x1e, 0x17, 0x1e, 0x17, 0x1e, 0x17, 0x1d, 0xd6, 0x2d, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x63, 0x0c, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x69, 0x0a, 0xcb, 0x14, 0x30, 0x1d, 0x13, 0x1d, 0x95, 0x1d, 0xf6, 0x1e, 0x16, 0x1e, 0x16, 0x26, 0x16, 0x26, 0x16, 0x25, 0xd6, 0x25, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x62, 0x08, 0x41, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x4a, 0x69, 0x63, 0x2c, 0x08, 0x61, 0x39, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xec, 0x12, 0x69, 0x13, 0x8d, 0x1c, 0xd2, 0x1d, 0x74, 0x25, 0xd5, 0x26, 0x16, 0x26, 0x16, 0x26, 0x16, 0x26, 0x16, 0x25, 0xd5, 0x2d, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 0x00, 0x20, 0x18, 0xc3, 0x31, 0x66, 0x29, 0x25, 0x18, 0xc3, 0x08, 0x41, 0x08, 0x41, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x10, 0x82, 0x00, 0x00, 0x00, 0x20, 0x18, 0xa3, 0x08, 0x41, 0x00, 0x00, 0x20, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x69, 0x12, 0xea, 0x1c, 0x4f, 0x25, 0x33, 0x25, 0xb4, 0x25, 0xf5, 0x26, 0x16, 0x2e, 0x16, 0x2e, 0x16, 0x2d, 0xd5, 0x2d, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x08, 0x41, 0x29, 0x45, 0x7b, 0xaf, 0xff, 0xff, 0xd6, 0x7a, 0x8c, 0x51, 0x62, 0xec, 0x5a, 0xeb, 0x4a, 0x29, 0x29, 0x65, 0x29, 0x45, 0x18, 0xc3, 0x08, 0x41, 0x08, 0x21, 0x08, 0x41, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0x20, 0xe4, 0x4a, 0x49, 0x21, 0x24, 0x10, 0xa2, 0x73, 0x6e, 0xbd, 0xb7, 0xff, 0xff, 0xff, 0xbf, 0x94, 0x92, 0x6b, 0x6d, 0xad, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x2b, 0x12, 0x69, 0x1b, 0x6c, 0x24, 0xb0, 0x25, 0x73, 0x2d, 0xd4, 0x2d, 0xf5, 0x2e, 0x15, 0x2e, 0x15, 0x2d, 0xd4, 0x3d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x08, 0x21, 0x31, 0xa6, 0x8c, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0xaa, 0x31, 0x66, 0x20, 0xe4, 0x21, 0x04, 0x10, 0x82, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x29, 0x45, 0x31, 0x86, 0x29, 0x25, 0x83, 0xf0, 0x39, 0xc7, 0x31, 0x86, 0x63, 0x0c, 0xbd, 0xf7, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x89, 0x12, 0x89, 0x1b, 0xcd, 0x24, 0xf1, 0x2d, 0x93, 0x2d, 0xd4, 0x2e, 0x14, 0x2e, 0x14, 0x2d, 0xb3, 0x4d, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x42, 0x08, 0x9c, 0xd3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x7a, 0x6b, 0x6d, 0x52, 0x8a, 0x52, 0x8a, 0x41, 0xe8, 0x21, 0x24, 0x21, 0x04, 0x18, 0xc3, 0x00, 0x20, 0x00, 0x00, 0x08, 0x21, 0x00, 0x20, 0x08, 0x41, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x29, 0x45, 0x5a, 0xcb, 0x7b, 0xef, 0x73, 0x6e, 0x7b, 0xaf, 0x62, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xcf, 0x1a, 0x48, 0x1a, 0xea, 0x24, 0x2e, 0x2d, 0x31, 0x2d, 0xb3, 0x2d, 0xf4, 0x2d, 0xf4, 0x35, 0x93, 0x6d, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd6, 0x7a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xde, 0xbb, 0x63, 0x2c, 0x08, 0x41, 0x00, 0x00, 0x5a, 0xab, 0x4a, 0x69, 0x18, 0xe3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x21, 0x08, 0x41, 0x10, 0xa2, 0x21, 0x04, 0x6b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x2c, 0x1a, 0x68, 0x1b, 0x6b, 0x24, 0xaf, 0x2d, 0x72, 0x2d, 0xb3, 0x2d, 0x92, 0x35, 0x52, 0x86, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x73, 0x8e, 0x52, 0x6a, 0x5a, 0xeb, 0x62, 0xec, 0x62, 0xec, 0x63, 0x0c, 0x4a, 0x69, 0x21, 0x04, 0x42, 0x08, 0x31, 0xa6, 0x20, 0xe4, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xca, 0x1a, 0xc9, 0x23, 0xcc, 0x2c, 0xaf, 0x2d, 0x10, 0x2d, 0x10, 0x45, 0x11, 0xbe, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xad, 0x75, 0x8c, 0x51, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x0a, 0x23, 0x0a, 0x1b, 0x4a, 0x24, 0x0c, 0x2c, 0x4e, 0x64, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xad, 0x33, 0x2a, 0x3b, 0x8c, 0x5c, 0x70, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x9d, 0x75, 0xc6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  /*alpha channel*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xac, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xb1, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xb0, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x7a, 0x6d, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb3, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xb9, 0xfc, 0xf7, 0xe0, 0xa5, 0x4f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb4, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xee, 0xff, 0xfe, 0xff, 0xfd, 0xe5, 0x99, 0x37, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb5, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xeb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xd0, 0x62, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xb9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xe7, 0x81, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa5, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf2, 0x9e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb7, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0xf0, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xb5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xc9, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfb, 0xbb, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xb5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf7, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xbf, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb8, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xcb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xbc, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xbb, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb0, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xad, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xbc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xde, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf7, 0x97, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x35, 0x83, 0xa5, 0x73, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8e, 0xf7, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf2, 0x81, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xb7, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x6f, 0xd4, 0xfc, 0xff, 0xe5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xc3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xea, 0x69, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xb5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x91, 0xf1, 0xff, 0xfe, 0xff, 0xfa, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x57, 0xe2, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xde, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xb0, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x98, 0xf5, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x7c, 0xf1, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xca, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xb1, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x88, 0xf4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9d, 0xf9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xae, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xb0, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0xe8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xed, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xbd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xf6, 0x83, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xaf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xd5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xdc, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xe6, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xb2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xb1, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xcf, 0x69, 0x33, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xb1, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0xf4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfb, 0x83, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x86, 0xd3, 0xa0, 0x5d, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x95, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf2, 0xdb, 0xa0, 0x37, 0x02, 0x00, 0x18, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xb4, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xd4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xee, 0xff, 0xf0, 0xb5, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb5, 0xfc, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xce, 0x4d, 0x0c, 0x87, 0xcd, 0x6a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xb6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xa1, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa7, 0xfb, 0xff, 0xfd, 0xde, 0x80, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xd2, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xd3, 0x71, 0xcd, 0xff, 0xea, 0x75, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x76, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xb6, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x87, 0xdc, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xea, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x72, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc5, 0xfd, 0xfe, 0xff, 0xf6, 0xb9, 0x49, 0x06, 0x00, 0x00, 0x00, 0x03, 0x5b, 0xe1, 0xff, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfc, 0xec, 0xf6, 0xfe, 0xff, 0xe3, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe4, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x46, 0xc8, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xe7, 0xfa, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xb3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4a, 0xcf, 0xfd, 0xfe, 0xfe, 0xfe, 0xde, 0x81, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe3, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xc0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xf4, 0xf6, 0x70, 0x02, 0x00, 0x00, 0x0f, 0xa1, 0xed, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x14, 0xab, 0xff, 0xf8, 0x69, 0x00, 0x00, 0x00, 0x02, 0x67, 0xed, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x51, 0xd9, 0xfe, 0xfe, 0xfe, 0xff, 0xf7, 0xb5, 0x3c, 0x02, 0x00, 0x00, 0x09, 0x6d, 0xe5, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xf8, 0x8e, 0x0b, 0x00, 0x00, 0x00, 0x6e, 0xf9, 0xff, 0xc6, 0x20, 0x00, 0x00, 0x36, 0xdd, 0xfd, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x43, 0xe0, 0xff, 0xf6, 0x64, 0x00, 0x00, 0x00, 0x24, 0xbf, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd1, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0xe1, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xd2, 0x58, 0x07, 0x00, 0x00, 0x0b, 0x74, 0xea, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xe4, 0x49, 0x00, 0x00, 0x00, 0x6e, 0xf9, 0xff, 0xf1, 0x56, 0x00, 0x00, 0x6b, 0xf4, 0xff, 0xb6, 0x11, 0x00, 0x00, 0x08, 0x87, 0xf8, 0xff, 0xf2, 0x57, 0x00, 0x00, 0x04, 0x75, 0xf2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x85, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0xe4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xe3, 0x73, 0x0e, 0x00, 0x00, 0x10, 0x85, 0xf0, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xaf, 0x16, 0x00, 0x00, 0x5f, 0xf4, 0xff, 0xfd, 0x8f, 0x05, 0x0a, 0x9e, 0xfc, 0xff, 0xd3, 0x21, 0x00, 0x00, 0x25, 0xca, 0xff, 0xff, 0xea, 0x43, 0x00, 0x00, 0x22, 0xc3, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x66, 0xdb, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xee, 0x8d, 0x1a, 0x00, 0x00, 0x17, 0x8e, 0xf2, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xf0, 0x5c, 0x00, 0x00, 0x4c, 0xec, 0xff, 0xff, 0xc6, 0x1b, 0x12, 0xb4, 0xfe, 0xff, 0xe2, 0x34, 0x00, 0x00, 0x55, 0xed, 0xff, 0xff, 0xd9, 0x2a, 0x00, 0x00, 0x5d, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x51, 0xcc, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xf7, 0xa4, 0x24, 0x00, 0x00, 0x18, 0x8d, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xb5, 0x18, 0x00, 0x3a, 0xdf, 0xff, 0xff, 0xe8, 0x42, 0x21, 0xc9, 0xff, 0xff, 0xed, 0x47, 0x00, 0x08, 0x90, 0xfb, 0xfe, 0xff, 0xbb, 0x15, 0x00, 0x15, 0xab, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc8, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3b, 0xb8, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xb2, 0x2f, 0x00, 0x00, 0x16, 0x8e, 0xf0, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xed, 0x5a, 0x00, 0x26, 0xcb, 0xff, 0xfe, 0xf8, 0x73, 0x39, 0xdc, 0xff, 0xfe, 0xf3, 0x58, 0x00, 0x1c, 0xc0, 0xff, 0xfe, 0xfb, 0x8b, 0x06, 0x00, 0x4a, 0xe2, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa0, 0xf2, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xc2, 0x41, 0x02, 0x00, 0x1b, 0x97, 0xf4, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xa7, 0x0e, 0x16, 0xb8, 0xfe, 0xfe, 0xfe, 0xaf, 0x64, 0xea, 0xff, 0xff, 0xf6, 0x65, 0x00, 0x3e, 0xe1, 0xff, 0xfe, 0xf4, 0x60, 0x00, 0x10, 0xa0, 0xfa, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6c, 0xdb, 0xbd, 0x81, 0x46, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x89, 0xea, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xd5, 0x5a, 0x06, 0x00, 0x21, 0x9d, 0xf3, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe6, 0x4a, 0x08, 0x97, 0xfa, 0xfe, 0xff, 0xe3, 0xb0, 0xf5, 0xff, 0xff, 0xf7, 0x6b, 0x00, 0x62, 0xf1, 0xfe, 0xff, 0xe8, 0x41, 0x00, 0x3b, 0xdb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xc0, 0xfe, 0xfa, 0xe7, 0xc1, 0x7e, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x72, 0xe2, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xe2, 0x6c, 0x0b, 0x00, 0x21, 0x9e, 0xf5, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0x90, 0x08, 0x6f, 0xf1, 0xfe, 0xfe, 0xfb, 0xf3, 0xfc, 0xfe, 0xff, 0xf7, 0x6f, 0x07, 0x87, 0xf9, 0xfe, 0xff, 0xd1, 0x24, 0x03, 0x7e, 0xf6, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xbf, 0xf9, 0xff, 0xff, 0xf8, 0xd1, 0x7b, 0x26, 0x03, 0x00, 0x00, 0x00, 0x09, 0x59, 0xd3, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xea, 0x81, 0x14, 0x00, 0x26, 0xb2, 0xfc, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xcd, 0x29, 0x44, 0xdf, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf8, 0x73, 0x15, 0xad, 0xfd, 0xfe, 0xfe, 0xa6, 0x0c, 0x20, 0xbc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0xa1, 0xee, 0xfe, 0xfe, 0xff, 0xf7, 0xcb, 0x75, 0x21, 0x02, 0x00, 0x00, 0x04, 0x44, 0xc1, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0x92, 0x1a, 0x00, 0x39, 0xc4, 0xfc, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf2, 0x68, 0x2a, 0xc6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xf8, 0x71, 0x30, 0xd0, 0xfe, 0xfe, 0xf6, 0x71, 0x01, 0x5b, 0xe8, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x74, 0xda, 0xfd, 0xfe, 0xfe, 0xff, 0xf6, 0xc4, 0x6b, 0x1a, 0x00, 0x00, 0x01, 0x32, 0xa9, 0xf3, 0xff, 0xfe, 0xfe, 0xff, 0xf5, 0xa1, 0x25, 0x01, 0x40, 0xc3, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xaf, 0x2d, 0xaa, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xf8, 0x72, 0x49, 0xe3, 0xff, 0xff, 0xe5, 0x44, 0x10, 0xa0, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4d, 0xbc, 0xf6, 0xfe, 0xfe, 0xfe, 0xff, 0xf3, 0xb7, 0x5a, 0x14, 0x00, 0x00, 0x1f, 0x8c, 0xe6, 0xfd, 0xfe, 0xfe, 0xfe, 0xf9, 0xb6, 0x3b, 0x02, 0x42, 0xcb, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xe7, 0x60, 0x94, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xf8, 0x72, 0x72, 0xf4, 0xfe, 0xff, 0xcc, 0x25, 0x44, 0xda, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xeb, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x94, 0xea, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xed, 0xb0, 0x4f, 0x0e, 0x00, 0x0d, 0x56, 0xbf, 0xf6, 0xfe, 0xfe, 0xfe, 0xfd, 0xcd, 0x50, 0x08, 0x4b, 0xdc, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xbc, 0x9e, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xf9, 0x88, 0xa5, 0xfd, 0xfe, 0xfd, 0xa1, 0x13, 0x82, 0xf4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xab, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x60, 0xc0, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xe8, 0x9d, 0x3f, 0x08, 0x01, 0x2a, 0x8e, 0xe4, 0xfe, 0xfe, 0xfe, 0xfe, 0xde, 0x6b, 0x3c, 0xca, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xec, 0xd1, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xd9, 0xe1, 0xfe, 0xfe, 0xf4, 0x69, 0x22, 0xbe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdb, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x7c, 0xce, 0xf6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xdd, 0x80, 0x1e, 0x00, 0x0d, 0x5c, 0xc7, 0xf9, 0xfe, 0xfe, 0xfe, 0xec, 0xcb, 0xed, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfa, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xdf, 0x3f, 0x62, 0xed, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x14, 0x1a, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2e, 0x7d, 0xd0, 0xf8, 0xff, 0xfe, 0xfe, 0xff, 0xf6, 0xb8, 0x4b, 0x08, 0x02, 0x33, 0x9f, 0xef, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xbb, 0x2e, 0xa8, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xba, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa9, 0xcd, 0xc4, 0x9e, 0x64, 0x37, 0x1a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x8d, 0xdd, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xe2, 0x8c, 0x2c, 0x02, 0x15, 0x75, 0xdb, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0x95, 0x52, 0xde, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xa3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7e, 0xe8, 0xfe, 0xfe, 0xf4, 0xe1, 0xc2, 0x9d, 0x6d, 0x3d, 0x18, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x99, 0xdf, 0xfb, 0xff, 0xfe, 0xff, 0xf9, 0xcd, 0x66, 0x0e, 0x06, 0x47, 0xb8, 0xf9, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfb, 0x9a, 0xac, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xa9, 0xe5, 0xfd, 0xff, 0xff, 0xfe, 0xf7, 0xe4, 0xbf, 0x80, 0x3c, 0x11, 0x01, 0x00, 0x00, 0x0f, 0x49, 0xa1, 0xe2, 0xfb, 0xfe, 0xfe, 0xff, 0xed, 0x96, 0x30, 0x04, 0x2c, 0xbd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xe8, 0xf2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x4f, 0xaa, 0xea, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xe2, 0xaf, 0x69, 0x27, 0x06, 0x00, 0x00, 0x11, 0x4c, 0xa2, 0xe6, 0xfd, 0xfe, 0xfe, 0xfa, 0xd4, 0x76, 0x1b, 0x45, 0xd6, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xca, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5c, 0xb8, 0xf0, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf5, 0xcf, 0x90, 0x46, 0x13, 0x00, 0x00, 0x11, 0x54, 0xb5, 0xf0, 0xfe, 0xff, 0xff, 0xf5, 0xb3, 0x50, 0x96, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf2, 0x74, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x65, 0xaa, 0xde, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xe8, 0xb4, 0x67, 0x26, 0x05, 0x00, 0x1d, 0x69, 0xbd, 0xf2, 0xfe, 0xfe, 0xfc, 0xe4, 0xe4, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xad, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x3e, 0x81, 0xb6, 0xdf, 0xf7, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf4, 0xce, 0x8c, 0x42, 0x12, 0x01, 0x1f, 0x75, 0xd3, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x3e, 0x79, 0xb6, 0xe6, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xe6, 0xb6, 0x6a, 0x25, 0x14, 0x59, 0xd5, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xde, 0x57, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x23, 0x2c, 0x25, 0x19, 0x10, 0x0a, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x47, 0x81, 0xb5, 0xe5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xcc, 0xad, 0xc4, 0xed, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xe1, 0x63, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xa1, 0xd5, 0xdc, 0xd5, 0xc6, 0xb5, 0xa7, 0x99, 0x81, 0x66, 0x4e, 0x35, 0x21, 0x11, 0x04, 0x00, 0x00, 0x03, 0x17, 0x4a, 0x88, 0xbe, 0xe4, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf5, 0x89, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x8b, 0xe8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xf8, 0xf0, 0xe3, 0xd1, 0xb6, 0x8b, 0x56, 0x30, 0x18, 0x06, 0x00, 0x03, 0x19, 0x45, 0x7f, 0xba, 0xe3, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf9, 0xd4, 0xba, 0x6f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x4f, 0x93, 0xc9, 0xec, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xdd, 0xbe, 0x90, 0x63, 0x3b, 0x1d, 0x0c, 0x06, 0x16, 0x44, 0x7d, 0xb6, 0xe8, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xdf, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x4e, 0x80, 0xaa, 0xd0, 0xef, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xe4, 0xcb, 0xab, 0x82, 0x55, 0x2e, 0x1a, 0x20, 0x51, 0x90, 0xcb, 0xf6, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xa2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x11, 0x18, 0x21, 0x29, 0x34, 0x3e, 0x42, 0x47, 0x4c, 0x4d, 0x4e, 0x4f, 0x51, 0x50, 0x4e, 0x4b, 0x46, 0x41, 0x3b, 0x38, 0x34, 0x2e, 0x24, 0x1f, 0x24, 0x40, 0x84, 0xd9, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf1, 0xdc, 0xbc, 0x91, 0x5d, 0x45, 0x65, 0xc8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xa3, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x1b, 0x2c, 0x3f, 0x55, 0x6f, 0x89, 0xa4, 0xba, 0xc7, 0xd1, 0xd8, 0xe0, 0xe8, 0xea, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0xee, 0xeb, 0xe8, 0xe5, 0xe2, 0xde, 0xd5, 0xca, 0xc0, 0xb5, 0xc4, 0xe9, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf3, 0xe6, 0xdf, 0xed, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xec, 0x89, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x3d, 0x70, 0xa4, 0xc4, 0xda, 0xe9, 0xf2, 0xf9, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf8, 0xd5, 0x76, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0x22, 0x5a, 0x9e, 0xca, 0xe5, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf8, 0xe2, 0xb1, 0x78, 0x32, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0e, 0x64, 0xc7, 0xf1, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf2, 0xbb, 0x98, 0x77, 0x45, 0x1c, 0x0f, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0f, 0x7e, 0xec, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xff, 0xe3, 0x78, 0x51, 0x50, 0x68, 0x94, 0xb0, 0xb3, 0x98, 0x5b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x43, 0xe6, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfb, 0xef, 0xea, 0xed, 0xf6, 0xfc, 0xfe, 0xff, 0xfe, 0xf4, 0x98, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x23, 0xbe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0x93, 0x15, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x42, 0xb1, 0xe7, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xc2, 0xa2, 0x95, 0x85, 0x6c, 0x52, 0x3e, 0x2b, 0x19, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x13, 0x49, 0x8b, 0xbc, 0xe6, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfa, 0xf3, 0xe9, 0xdb, 0xc6, 0xa7, 0x7e, 0x54, 0x37, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x44, 0x74, 0x94, 0xb1, 0xc1, 0xcd, 0xe2, 0xf5, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xcc, 0x9c, 0x6a, 0x39, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0f, 0x22, 0x7a, 0xdb, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xe7, 0xbc, 0x53, 0x28, 0x1e, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x4a, 0x8c, 0xdc, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xe7, 0xda, 0xcb, 0xae, 0x8f, 0x6f, 0x52, 0x39, 0x26, 0x18, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x68, 0xc5, 0xef, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xf9, 0xf1, 0xe2, 0xd0, 0xc6, 0xad, 0x89, 0x6a, 0x4f, 0x38, 0x27, 0x16, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x92, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xce, 0x9c, 0xa6, 0xbe, 0xc6, 0xc9, 0xbf, 0xa0, 0x7f, 0x66, 0x4b, 0x2f, 0x1e, 0x12, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xef, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xcf, 0x6d, 0x39, 0x28, 0x32, 0x58, 0x82, 0x93, 0xa3, 0xba, 0xcb, 0xcb, 0xcb, 0xbf, 0xa0, 0x80, 0x5f, 0x45, 0x34, 0x22, 0x11, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa3, 0xdf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xf5, 0xd8, 0xa1, 0x5c, 0x2b, 0x0b, 0x01, 0x07, 0x13, 0x29, 0x4c, 0x74, 0x91, 0xa7, 0xbf, 0xd2, 0xdc, 0xe2, 0xd9, 0xbc, 0x9c, 0x81, 0x63, 0x4c, 0x37, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x38, 0x7a, 0xa5, 0xbd, 0xc9, 0xd1, 0xd6, 0xe6, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf4, 0xdb, 0xa0, 0x57, 0x24, 0x04, 0x00, 0x00, 0x00, 0x02, 0x09, 0x13, 0x26, 0x48, 0x72, 0x96, 0xab, 0xc3, 0xd6, 0xe4, 0xea, 0xe9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x10, 0x15, 0x1c, 0x4c, 0xb0, 0xf9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf2, 0xcd, 0x80, 0x3c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x14, 0x25, 0x40, 0x68, 0x88, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0xbe, 0xf6, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfa, 0xe4, 0xae, 0x63, 0x2a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6b, 0xd9, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf4, 0xd3, 0x88, 0x36, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xf2, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xda, 0x89, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xc8, 0xf2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xd1, 0x6c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x5c, 0x8b, 0xa2, 0xab, 0xb3, 0xbe, 0xd7, 0xf9, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf2, 0xa6, 0x3b, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x09, 0x10, 0x44, 0xb4, 0xf9, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xda, 0x6d, 0x0d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x6e, 0xd3, 0xfa, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xed, 0x81, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x95, 0xf3, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xee, 0x67, 0x02, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xa8, 0xf8, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xca, 0x28, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa4, 0xf2, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf3, 0xbb, 0xb0, 0xdb, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0x75, 0x03, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x39, 0x4d, 0x65, 0x82, 0xb2, 0xe9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xc2, 0x39, 0x34, 0x71, 0xad, 0xdf, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x92, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3b, 0x9b, 0xe9, 0xfa, 0xfc, 0xfc, 0xfb, 0xf5, 0xe9, 0xf3, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0xca, 0xe1, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf3, 0xd5, 0xf0, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0x9b, 0x14, 0x00, 0x11, 0x3b, 0x70, 0x9d, 0xcb, 0xe9, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x3f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3f, 0x6a, 0x74, 0x77, 0x72, 0x5c, 0x6f, 0xdd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0x88, 0x5c, 0xd7, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf1, 0x85, 0x6b, 0xbf, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf1, 0x78, 0x08, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x42, 0x73, 0x96, 0xbe, 0xde, 0xed, 0xf4, 0xf8, 0xfa, 0xf8, 0xf3, 0xf0, 0xe4, 0xb0, 0x46, 0x03, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xad, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb4, 0x1a, 0x58, 0xda, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xbe, 0x24, 0x22, 0x79, 0xcd, 0xf6, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xe1, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x2f, 0x49, 0x5b, 0x67, 0x6c, 0x66, 0x58, 0x4b, 0x36, 0x12, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0xf9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xea, 0x52, 0x04, 0x58, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xf3, 0x67, 0x00, 0x04, 0x2a, 0x72, 0xbd, 0xee, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0x9c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0x05, 0x04, 0x4a, 0xc9, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xbe, 0x19, 0x00, 0x00, 0x03, 0x1c, 0x61, 0xb8, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xa3, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xba, 0x10, 0x00, 0x01, 0x39, 0xb6, 0xf6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x53, 0x8d, 0xc3, 0xe0, 0xeb, 0xf1, 0xd9, 0x5f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x96, 0xf7, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd5, 0x23, 0x00, 0x00, 0x00, 0x1f, 0x7b, 0xdb, 0xfc, 0xff, 0xfe, 0xff, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x2f, 0x41, 0x4c, 0x32, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x66, 0x82, 0x85, 0x86, 0x82, 0xb0, 0xf8, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xea, 0x44, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x9e, 0xe2, 0xf9, 0xfe, 0xe8, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0xad, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xf0, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3d, 0x6f, 0x8a, 0x5f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7e, 0xf6, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfa, 0xfa, 0xbb, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xbb, 0x71, 0x39, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa1, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xbe, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xda, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xef, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xcf, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xa5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x61, 0xe8, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x51, 0x7d, 0x8a, 0xb5, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xa2, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xcd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x79, 0x6d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6a, 0xf0, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf5, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0xdc, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xd3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xd5, 0xf1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xa6, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7b, 0xf6, 0xfc, 0x9c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xc8, 0xff, 0xff, 0xde, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0xfe, 0xfe, 0xf9, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xe7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xb2, 0xff, 0xfe, 0xfe, 0xff, 0xc1, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xa3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xd4, 0xef, 0xfa, 0xfe, 0xff, 0xf0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xed, 0xc6, 0xf1, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x35, 0x4d, 0xbb, 0xf5, 0xc7, 0xd1, 0x9a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xa8, 0x4f, 0xdb, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf8, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8f, 0xe0, 0x3b, 0x1f, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfb, 0x72, 0x2e, 0xd8, 0xff, 0xfe, 0xfe, 0xfc, 0xeb, 0xf3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xb6, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 0xdd, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf6, 0x5b, 0x30, 0xde, 0xff, 0xfe, 0xff, 0xf1, 0x71, 0x97, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8e, 0xe0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x97, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xee, 0x42, 0x31, 0xe1, 0xff, 0xff, 0xff, 0xe9, 0x38, 0x4c, 0xee, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 0xe2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0x29, 0x30, 0xe2, 0xff, 0xff, 0xff, 0xe5, 0x30, 0x30, 0xde, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x96, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xf4, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc4, 0x13, 0x32, 0xe3, 0xff, 0xff, 0xff, 0xe1, 0x27, 0x20, 0xcf, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x99, 0xe5, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xde, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0x90, 0x02, 0x34, 0xe3, 0xff, 0xff, 0xff, 0xdb, 0x1f, 0x11, 0xba, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf9, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x99, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0xf5, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfa, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5f, 0x00, 0x35, 0xe4, 0xff, 0xff, 0xff, 0xd1, 0x19, 0x07, 0x9b, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xa6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x98, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0xea, 0xf4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xda, 0xc2, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0x00, 0x34, 0xe4, 0xff, 0xff, 0xff, 0xbf, 0x12, 0x00, 0x78, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xda, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9a, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6d, 0xce, 0x7b, 0x5b, 0xb0, 0xe5, 0xf0, 0xf1, 0xed, 0xe4, 0xdd, 0xe6, 0xfc, 0xfe, 0xfe, 0xfe, 0xd1, 0x5b, 0xa3, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf2, 0xd8, 0xbd, 0xf0, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xd2, 0x22, 0x00, 0x31, 0xe2, 0xff, 0xff, 0xff, 0xa2, 0x09, 0x00, 0x5b, 0xf3, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9c, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xd9, 0x74, 0x09, 0x00, 0x13, 0x37, 0x4b, 0x50, 0x47, 0x35, 0x2a, 0x85, 0xfa, 0xff, 0xfa, 0xbb, 0x39, 0x44, 0xe0, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xbd, 0x5a, 0x28, 0x4e, 0xea, 0xff, 0xff, 0xfb, 0xe3, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xff, 0xe2, 0xcc, 0xfc, 0xfe, 0xfd, 0xfa, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xab, 0x0c, 0x00, 0x2d, 0xdf, 0xff, 0xff, 0xfe, 0x83, 0x01, 0x00, 0x43, 0xea, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9e, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x85, 0xdb, 0x72, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x91, 0xf5, 0xdd, 0x90, 0x24, 0x15, 0xac, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xd4, 0x3c, 0x00, 0x00, 0x73, 0xfa, 0xfd, 0xe6, 0x96, 0x44, 0xb7, 0xff, 0xff, 0xfb, 0xf0, 0xfb, 0xfe, 0xf6, 0x7b, 0x86, 0xfc, 0xff, 0xee, 0xc5, 0xf7, 0xfe, 0xff, 0xff, 0xfc, 0x79, 0x00, 0x00, 0x25, 0xd7, 0xff, 0xff, 0xfa, 0x6c, 0x00, 0x00, 0x27, 0xd8, 0xff, 0xff, 0xfe, 0xfc, 0xde, 0xef, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xa0, 0xe5, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x96, 0xda, 0x6c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3b, 0x58, 0x31, 0x09, 0x00, 0x58, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xe1, 0x53, 0x01, 0x00, 0x09, 0xa5, 0xff, 0xbf, 0x48, 0x0c, 0x05, 0x96, 0xfe, 0xee, 0xa9, 0x7c, 0xec, 0xfd, 0xa4, 0x14, 0x6f, 0xfb, 0xfc, 0x9d, 0x74, 0xf3, 0xff, 0xff, 0xff, 0xef, 0x4e, 0x00, 0x00, 0x1a, 0xca, 0xff, 0xff, 0xf5, 0x59, 0x00, 0x00, 0x13, 0xbd, 0xff, 0xff, 0xfe, 0xfa, 0x8f, 0xac, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9f, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa5, 0xdb, 0x5f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xee, 0x6d, 0x06, 0x00, 0x00, 0x0d, 0xa8, 0xb9, 0x33, 0x00, 0x00, 0x00, 0x40, 0x93, 0x52, 0x13, 0x24, 0xbb, 0xa8, 0x27, 0x00, 0x43, 0xc6, 0x97, 0x21, 0x74, 0xf9, 0xff, 0xff, 0xff, 0xd7, 0x29, 0x00, 0x00, 0x0c, 0xad, 0xff, 0xff, 0xeb, 0x43, 0x00, 0x00, 0x05, 0x8f, 0xfe, 0xff, 0xfe, 0xfa, 0x70, 0x4c, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9f, 0xe4, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xab, 0xe2, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xec, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xf8, 0x91, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x21, 0x14, 0x00, 0x00, 0x08, 0x1c, 0x0a, 0x01, 0x83, 0xfc, 0xff, 0xfe, 0xff, 0xab, 0x0d, 0x00, 0x00, 0x03, 0x8e, 0xff, 0xff, 0xdd, 0x2c, 0x00, 0x00, 0x00, 0x5a, 0xf2, 0xff, 0xff, 0xfa, 0x6f, 0x0d, 0x97, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xa0, 0xe5, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb1, 0xe2, 0x68, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x9f, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xa9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xfc, 0xff, 0xff, 0xf6, 0x68, 0x00, 0x00, 0x00, 0x00, 0x76, 0xfb, 0xff, 0xc1, 0x17, 0x00, 0x00, 0x00, 0x34, 0xe1, 0xff, 0xff, 0xfb, 0x73, 0x00, 0x36, 0xdb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb9, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9f, 0xe5, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc0, 0xd8, 0x5d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xe5, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xbb, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7c, 0xfb, 0xff, 0xff, 0xd8, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xf5, 0xff, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x1c, 0xca, 0xff, 0xff, 0xfc, 0x73, 0x00, 0x06, 0x8a, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9f, 0xe5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xc7, 0xce, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xc2, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xfa, 0xff, 0xff, 0xaa, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x37, 0xe8, 0xf2, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xfd, 0xff, 0xfa, 0x6d, 0x00, 0x00, 0x39, 0xdf, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9d, 0xe5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0xc8, 0xc4, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xd9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xf8, 0xff, 0xf2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xb0, 0xbe, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xf0, 0xff, 0xf7, 0x60, 0x00, 0x00, 0x0d, 0x9e, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9b, 0xe5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51, 0xd0, 0xb6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xdd, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xf2, 0xff, 0xbe, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xd1, 0xff, 0xed, 0x41, 0x00, 0x00, 0x00, 0x43, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9c, 0xe5, 0x2f, 0x00, 0x00, 0x00, 0x04, 0x58, 0xd7, 0xa9, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x93, 0xff, 0xfe, 0xfe, 0xfd, 0xcf, 0x4f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xe0, 0xf1, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0xfc, 0xcb, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x8a, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbb, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9e, 0xe5, 0x2f, 0x00, 0x00, 0x04, 0x57, 0xd6, 0x9f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xab, 0xff, 0xff, 0xfb, 0xc0, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x87, 0x7b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xae, 0x67, 0x02, 0x00, 0x00, 0x00, 0x00, 0x22, 0xb9, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa1, 0xe3, 0x2c, 0x00, 0x06, 0x5e, 0xd7, 0x9b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xb8, 0xff, 0xe9, 0x9e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xd7, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa0, 0xe2, 0x29, 0x07, 0x6a, 0xd2, 0x8a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x9a, 0x4e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x8d, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9c, 0xe0, 0x35, 0x6c, 0x9e, 0x57, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xe5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9b, 0xed, 0xac, 0xc5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xab, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9e, 0xff, 0xff, 0xec, 0x4e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xf2, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xbd, 0xff, 0xff, 0xff, 0xf2, 0xaf, 0x7f, 0x7f, 0x7f, 0x81, 0x4d, 0x1a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xbf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x9a, 0xce, 0x9c, 0xa9, 0xc3, 0xd9, 0xe7, 0xf6, 0xfe, 0xff, 0xff, 0xf2, 0xe5, 0xb3, 0x7f, 0x81, 0x54, 0x1c, 0x1a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xa3, 0xd2, 0x4b, 0x05, 0x0a, 0x15, 0x24, 0x38, 0x56, 0x80, 0x9a, 0xaf, 0xc4, 0xd9, 0xef, 0xfd, 0xff, 0xf5, 0xe6, 0xe3, 0xa9, 0x80, 0x7f, 0x80, 0x6c, 0x24, 0x1b, 0x1c, 0x11, 0x03, 0x1a, 0x22, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb5, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xbe, 0xd8, 0x54, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0d, 0x17, 0x29, 0x47, 0x6c, 0x94, 0xaa, 0xc0, 0xd5, 0xea, 0xfa, 0xfe, 0xff, 0xfc, 0xe7, 0xe4, 0xe5, 0xc2, 0x8d, 0xd7, 0xe6, 0xd8, 0x8b, 0x74, 0x28, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xe6, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xa0, 0x4c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x13, 0x20, 0x39, 0x59, 0x85, 0xa1, 0xc8, 0xe6, 0xe4, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0xda, 0x94, 0x4d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x96, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xec, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x12, 0x1c, 0x18, 0x5b, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xbf, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xd7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x71, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x84, 0xc5, 0xe7, 0xe4, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xcb, 0xfd, 0xfe, 0xfe, 0xff, 0xb0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x24, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0xb7, 0xf9, 0xff, 0xeb, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x8d, 0xaf, 0x71, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-};
-
-const lv_img_dsc_t app_img_directivity160x160 = {
-  .header.cf = LV_IMG_CF_RGB565A8,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 160,
-  .header.h = 160,
-  .data_size = 76800,
-  .data = app_img_directivity160x160_map,
-};
@@ -0,0 +1,237 @@
+/*
+ * @file app_img_rle.c
+ * @brief LVGL image decoder for app_img_rle_t assets, see app_img_rle.h.
+ *
+ *        Plain draws (no transform, recolour, opacity or mask) skip the decoder: the draw_ctx's draw_img hook
+ *        walks the runs of the clipped rows straight into the draw buffer, copying and filling the opaque runs
+ *        and mixing only the partially transparent pixels, where LVGL would blend every pixel of the box
+ *        through an alpha mask. Anything else goes through the decoder.
+ *
+ *        LVGL asks the decoder for lines as it renders each strip (no image cache, LV_IMG_CACHE_DEF_SIZE 0),
+ *        usually the same clipped span of consecutive rows. The last expanded row is kept, so a row is decoded
+ *        once per strip however the span is split.
+ *
+ */
+
+#include "app_include/app_img_rle.h"
+
+typedef struct {
+    const app_img_rle_t * rle;
+    int32_t row;                // Image row held in scratch, -1 for none
+    lv_color_t * colors;        // One full width row, RGB565A8 planes
+    lv_opa_t * alpha;
+} rle_scratch_t;
+
+static lv_img_decoder_t * decoder = NULL;
+static lv_draw_ctx_t * hooked_ctx = NULL;
+static lv_res_t (*orig_draw_img)(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                                 const void * src);
+
+static bool is_rle(const void * src) {
+    return lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE && ((const lv_img_dsc_t *)src)->header.cf == APP_IMG_RLE_CF;
+}
+
+static lv_res_t rle_info(lv_img_decoder_t * dec, const void * src, lv_img_header_t * header) {
+
+    if (!is_rle(src)) {
+        return LV_RES_INV;
+    }
+    *header = ((const lv_img_dsc_t *)src)->header;
+    header->cf = LV_IMG_CF_RGB565A8;    // What read_line produces
+    return LV_RES_OK;
+}
+
+static lv_res_t rle_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc) {
+
+    const lv_img_dsc_t * img = dsc->src;
+    uint32_t w = img->header.w;
+    rle_scratch_t * scratch = lv_mem_alloc(sizeof(rle_scratch_t) + w * (sizeof(lv_color_t) + 1));
+
+    if (scratch == NULL) {
+        return LV_RES_INV;
+    }
+    scratch->rle = (const app_img_rle_t *)img->data;
+    scratch->row = -1;
+    scratch->colors = (lv_color_t *)(scratch + 1);
+    scratch->alpha = (lv_opa_t *)(scratch->colors + w);
+    lv_memset_00(scratch->colors, w * (sizeof(lv_color_t) + 1));     // Columns outside the box stay transparent
+
+    dsc->user_data = scratch;
+    dsc->img_data = NULL;   // Line by line
+    return LV_RES_OK;
+}
+
+/*---------------------------------------------------------------
+    Expand one stored row into the scratch planes
+---------------------------------------------------------------*/
+static void rle_expand(const app_img_rle_t * rle, uint16_t row, lv_color_t * colors, lv_opa_t * alpha) {
+
+    const app_img_rle_row_t * r = &rle->rows[row - rle->y1];
+    const uint8_t * p = rle->runs + r[0].runs;
+    const uint8_t * end = rle->runs + r[1].runs;
+    const lv_color_t * c = (const lv_color_t *)rle->colors + r[0].colors;
+    uint16_t x = rle->x1;
+
+    while (p < end) {
+        uint8_t kind = *p & APP_IMG_RLE_KIND_MASK;
+        uint16_t len = (*p++ & ~APP_IMG_RLE_KIND_MASK) + 1;
+
+        switch (kind) {
+            case APP_IMG_RLE_TRANSP:
+                lv_memset_00(&alpha[x], len);
+                break;
+            case APP_IMG_RLE_OPAQUE:
+                lv_memcpy(&colors[x], c, len * sizeof(lv_color_t));
+                lv_memset_ff(&alpha[x], len);
+                c += len;
+                break;
+            case APP_IMG_RLE_REPEAT:
+                lv_color_fill(&colors[x], *c++, len);
+                lv_memset_ff(&alpha[x], len);
+                break;
+            default:
+                lv_memcpy(&colors[x], c, len * sizeof(lv_color_t));
+                lv_memcpy(&alpha[x], p, len);
+                c += len;
+                p += len;
+                break;
+        }
+        x += len;
+    }
+}
+
+static lv_res_t rle_read_line(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                              lv_coord_t len, uint8_t * buf) {
+
+    rle_scratch_t * scratch = dsc->user_data;
+    const app_img_rle_t * rle = scratch->rle;
+
+    if (scratch->row != y) {
+        if (y >= rle->y1 && y <= rle->y2 && rle->x1 <= rle->x2) {
+            rle_expand(rle, y, scratch->colors, scratch->alpha);
+        }
+        else if (scratch->row >= rle->y1 && scratch->row <= rle->y2) {
+            lv_memset_00(scratch->alpha, dsc->header.w);    // Leaving the box
+        }
+        scratch->row = y;
+    }
+
+    // RGB565A8 line: the colour plane, then the alpha plane
+    lv_memcpy(buf, &scratch->colors[x], len * sizeof(lv_color_t));
+    lv_memcpy(buf + len * sizeof(lv_color_t), &scratch->alpha[x], len);
+    return LV_RES_OK;
+}
+
+static void rle_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc) {
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+/*---------------------------------------------------------------
+    Runs of one stored row, clipped to image columns x1..x2,
+    into the draw buffer row at dest (image column 0)
+---------------------------------------------------------------*/
+static void rle_blit_row(const app_img_rle_t * rle, uint16_t row, int32_t x1, int32_t x2, lv_color_t * dest) {
+
+    const app_img_rle_row_t * r = &rle->rows[row - rle->y1];
+    const uint8_t * p = rle->runs + r[0].runs;
+    const uint8_t * end = rle->runs + r[1].runs;
+    const lv_color_t * c = (const lv_color_t *)rle->colors + r[0].colors;
+    int32_t x = rle->x1;
+
+    while (p < end && x <= x2) {
+        uint8_t kind = *p & APP_IMG_RLE_KIND_MASK;
+        int32_t len = (*p++ & ~APP_IMG_RLE_KIND_MASK) + 1;
+        int32_t from = LV_MAX(x, x1);
+        int32_t to = LV_MIN(x + len - 1, x2);     // from > to when the run is left of the clip
+
+        switch (kind) {
+            case APP_IMG_RLE_TRANSP:
+                break;
+            case APP_IMG_RLE_OPAQUE:
+                if (from <= to) {
+                    lv_memcpy(&dest[from], &c[from - x], (to - from + 1) * sizeof(lv_color_t));
+                }
+                c += len;
+                break;
+            case APP_IMG_RLE_REPEAT:
+                if (from <= to) {
+                    lv_color_fill(&dest[from], *c, to - from + 1);
+                }
+                c++;
+                break;
+            default: {
+                const lv_color_t * src = &c[from - x];
+                const lv_opa_t * opa = &p[from - x];
+                for (lv_color_t * d = &dest[from]; d <= &dest[to]; d++) {
+                    *d = lv_color_mix(*src++, *d, *opa++);   // As lv_draw_sw_blend with a mask
+                }
+                c += len;
+                p += len;
+                break;
+            }
+        }
+        x += len;
+    }
+}
+
+static lv_res_t rle_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                             const void * src) {
+
+    if (!is_rle(src)) {
+        return orig_draw_img ? orig_draw_img(draw_ctx, dsc, coords, src) : LV_RES_INV;
+    }
+
+    const lv_img_dsc_t * img = src;
+    const app_img_rle_t * rle = (const app_img_rle_t *)img->data;
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    // Only the plain case, LV_RES_INV leaves the rest to the decoder
+    if (dsc->angle != 0 || dsc->zoom != LV_IMG_ZOOM_NONE || dsc->opa < LV_OPA_MAX || dsc->recolor_opa > LV_OPA_MIN ||
+        dsc->blend_mode != LV_BLEND_MODE_NORMAL || disp == NULL || disp->driver->screen_transp ||
+        disp->driver->set_px_cb != NULL || lv_area_get_width(coords) != img->header.w ||
+        lv_area_get_height(coords) != img->header.h || lv_draw_mask_is_any(draw_ctx->clip_area)) {
+        return LV_RES_INV;
+    }
+
+    lv_area_t box = {coords->x1 + rle->x1, coords->y1 + rle->y1, coords->x1 + rle->x2, coords->y1 + rle->y2};
+    lv_area_t clip;
+    if (rle->x1 > rle->x2 || !_lv_area_intersect(&clip, &box, draw_ctx->clip_area)) {
+        return LV_RES_OK;
+    }
+    if (draw_ctx->wait_for_finish) {
+        draw_ctx->wait_for_finish(draw_ctx);
+    }
+
+    int32_t buf_w = lv_area_get_width(draw_ctx->buf_area);
+    lv_color_t * dest = (lv_color_t *)draw_ctx->buf + (clip.y1 - draw_ctx->buf_area->y1) * buf_w +
+                        (coords->x1 - draw_ctx->buf_area->x1);
+    for (int32_t y = clip.y1; y <= clip.y2; y++) {
+        rle_blit_row(rle, y - coords->y1, clip.x1 - coords->x1, clip.x2 - coords->x1, dest);
+        dest += buf_w;
+    }
+    return LV_RES_OK;
+}
+
+/*---------------------------------------------------------------
+    Register the decoder and hook the default display's draw_ctx,
+    after the display is registered and before the first
+    lv_img_set_src() of an asset
+---------------------------------------------------------------*/
+void app_img_rle_init(void) {
+
+    if (decoder == NULL) {
+        decoder = lv_img_decoder_create();
+        lv_img_decoder_set_info_cb(decoder, rle_info);
+        lv_img_decoder_set_open_cb(decoder, rle_open);
+        lv_img_decoder_set_read_line_cb(decoder, rle_read_line);
+        lv_img_decoder_set_close_cb(decoder, rle_close);
+    }
+
+    lv_disp_t * disp = lv_disp_get_default();
+    if (disp != NULL && hooked_ctx == NULL) {
+        hooked_ctx = disp->driver->draw_ctx;
+        orig_draw_img = hooked_ctx->draw_img;
+        hooked_ctx->draw_img = rle_draw_img;
+    }
+}
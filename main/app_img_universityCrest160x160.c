@@ -1,357 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_APP_IMG_UNIVERSITYCREST160X160
-#define LV_ATTRIBUTE_IMG_APP_IMG_UNIVERSITYCREST160X160
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_APP_IMG_UNIVERSITYCREST160X160 uint8_t app_img_universityCrest160x160_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0xa5, 0xd8, 0x95, 0x36, 0x6c, 0x94, 0x4b, 0xd2, 0x4b, 0xb2, 0x43, 0xb2, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x72, 0x33, 0x51, 0x2b, 0x10, 0x22, 0xf1, 0x22, 0xd0, 0x22, 0xd0, 0x22, 0xf1, 0x2b, 0x10, 0x33, 0x51, 0x3b, 0x72, 0x33, 0x71, 0x43, 0x92, 0x4b, 0xd3, 0x43, 0x91, 0x4b, 0xd2, 0x64, 0x54, 0x95, 0x36, 0xa5, 0xd8, 0xb6, 0x39, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0x74, 0x94, 0x54, 0x13, 0x4b, 0xd2, 0x2b, 0x31, 0x2a, 0xf1, 0x22, 0xd0, 0x1a, 0x90, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0x90, 0x22, 0xd0, 0x22, 0xf0, 0x2b, 0x31, 0x4b, 0xb2, 0x5c, 0x34, 0x74, 0x94, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x74, 0xb5, 0x53, 0xf3, 0x3b, 0x51, 0x22, 0xf0, 0x1a, 0x90, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0xb0, 0x22, 0xd0, 0x2b, 0x10, 0x3b, 0x92, 0x43, 0x92, 0x4b, 0xb2, 0x53, 0xf3, 0x5c, 0x33, 0x4b, 0xd2, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x33, 0x30, 0x5c, 0x33, 0x53, 0xf3, 0x53, 0xf3, 0x43, 0x92, 0x33, 0x71, 0x22, 0xd0, 0x22, 0xf1, 0x1a, 0xb0, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x1a, 0x90, 0x22, 0xef, 0x3b, 0x71, 0x53, 0xf3, 0x64, 0x33, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0xfb, 0x85, 0x16, 0x64, 0x33, 0x3b, 0x71, 0x2a, 0xf1, 0x1a, 0x90, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0xb0, 0x2b, 0x11, 0x43, 0x92, 0x53, 0xf3, 0x6c, 0x74, 0x8c, 0xf6, 0xad, 0xd8, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x39, 0xad, 0xd8, 0x85, 0x16, 0x6c, 0x94, 0x53, 0xd2, 0x43, 0xb2, 0x33, 0x31, 0x1a, 0xaf, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x1a, 0x90, 0x2a, 0xf1, 0x3b, 0x71, 0x53, 0xf3, 0x74, 0xb5, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x53, 0xf3, 0x2b, 0x31, 0x22, 0xd0, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x22, 0xd0, 0x33, 0x10, 0x4b, 0xd2, 0x6c, 0x74, 0x95, 0x36, 0xb6, 0x39, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x85, 0x16, 0x6c, 0x94, 0x4b, 0xb2, 0x2b, 0x31, 0x22, 0xd0, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x22, 0xcf, 0x2b, 0x31, 0x54, 0x13, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x64, 0x33, 0x3b, 0x71, 0x22, 0xd0, 0x12, 0x6f, 0x0a, 0x4f, 0x1a, 0x90, 0x2b, 0x10, 0x43, 0x92, 0x5c, 0x34, 0x95, 0x36, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0x8d, 0x76, 0x5c, 0x34, 0x43, 0x92, 0x2a, 0xf1, 0x12, 0x8f, 0x0a, 0x4f, 0x12, 0x6f, 0x22, 0xcf, 0x33, 0x51, 0x64, 0x33, 0x9d, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x53, 0xf3, 0x33, 0x31, 0x12, 0x6f, 0x0a, 0x2e, 0x12, 0x6f, 0x2b, 0x11, 0x4b, 0xb2, 0x74, 0xb5, 0xb5, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x85, 0x16, 0x8d, 0x76, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x6c, 0x94, 0x4b, 0xd2, 0x33, 0x31, 0x12, 0x8f, 0x0a, 0x2e, 0x12, 0x6f, 0x2b, 0x10, 0x53, 0xf3, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x4b, 0xb2, 0x2a, 0xf1, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xd0, 0x3b, 0x71, 0x6c, 0x94, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0x94, 0x3b, 0x51, 0x22, 0xef, 0x22, 0xcf, 0x2a, 0xf0, 0x33, 0x10, 0x54, 0x13, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x91, 0x3b, 0x51, 0x43, 0x92, 0x53, 0xf3, 0x53, 0xf3, 0x64, 0x74, 0x85, 0x16, 0xb5, 0xd9, 0xbe, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0x6c, 0x94, 0x43, 0xb2, 0x22, 0xd0, 0x0a, 0x4f, 0x12, 0x6f, 0x22, 0xf0, 0x43, 0x91, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x43, 0x91, 0x22, 0xd0, 0x0a, 0x4f, 0x0a, 0x4f, 0x22, 0xf0, 0x53, 0xf3, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x74, 0x2a, 0xf0, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x8e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x4e, 0x12, 0x4e, 0x1a, 0x8f, 0x22, 0xcf, 0x33, 0x31, 0x2b, 0x31, 0x6c, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x53, 0xf3, 0x2a, 0xf1, 0x12, 0x6f, 0x0a, 0x4f, 0x2a, 0xf0, 0x4b, 0xd3, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x4b, 0xd2, 0x22, 0xd0, 0x0a, 0x4f, 0x12, 0x6f, 0x2b, 0x10, 0x54, 0x13, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0x8f, 0x33, 0x10, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x1a, 0x8f, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x1a, 0xaf, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2e, 0x5c, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x5c, 0x34, 0x33, 0x31, 0x12, 0x6f, 0x0a, 0x2e, 0x22, 0xd0, 0x4b, 0xb2, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x22, 0xd0, 0x0a, 0x4f, 0x12, 0x6f, 0x2b, 0x10, 0x64, 0x33, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x7c, 0xb5, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x0a, 0x4e, 0x01, 0xed, 0x1a, 0x8f, 0x64, 0x33, 0xde, 0xdb, 0x85, 0x16, 0x2a, 0xf0, 0x02, 0x0d, 0x02, 0x0d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x8e, 0x01, 0xed, 0x12, 0x6e, 0x43, 0x92, 0x43, 0x92, 0x3b, 0x71, 0x2b, 0x10, 0x1a, 0xaf, 0x2a, 0xf0, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x5c, 0x34, 0x2b, 0x32, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xd0, 0x53, 0xf3, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x33, 0x33, 0x31, 0x0a, 0x4f, 0x0a, 0x4f, 0x2b, 0x10, 0x54, 0x13, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x43, 0x92, 0x22, 0xcf, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x0a, 0x2e, 0x01, 0xed, 0x1a, 0xaf, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x4e, 0x01, 0xed, 0x2a, 0xf0, 0x9d, 0x57, 0xff, 0xff, 0xef, 0x5d, 0xb5, 0xd9, 0x7c, 0xb5, 0x7c, 0xf5, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd8, 0x5c, 0x34, 0x33, 0x31, 0x0a, 0x4f, 0x0a, 0x4f, 0x2b, 0x11, 0x5c, 0x34, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x3b, 0x71, 0x12, 0x8f, 0x0a, 0x4f, 0x22, 0xcf, 0x53, 0xf3, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6e, 0x0a, 0x2d, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x2b, 0x10, 0x02, 0x0d, 0x0a, 0x2d, 0x43, 0xb2, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x8e, 0x01, 0xed, 0x12, 0x6e, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x0a, 0x2d, 0x02, 0x0d, 0x22, 0xef, 0x7c, 0xf5, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x53, 0xf3, 0x22, 0xd0, 0x0a, 0x4f, 0x12, 0x8f, 0x43, 0x92, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x33, 0x22, 0xf0, 0x0a, 0x2e, 0x1a, 0x90, 0x43, 0x92, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x64, 0x74, 0x5c, 0x34, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x4e, 0x0a, 0x4e, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2b, 0x10, 0x02, 0x0d, 0x0a, 0x2d, 0x4b, 0xd3, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x12, 0x6e, 0x01, 0xed, 0x12, 0x4e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x4e, 0x2a, 0xf0, 0x2b, 0x10, 0x3b, 0x51, 0x43, 0x92, 0x7c, 0xd6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x2a, 0xf0, 0x4b, 0xd3, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x43, 0x92, 0x12, 0x8f, 0x0a, 0x2e, 0x22, 0xf1, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x43, 0xb2, 0x12, 0x6f, 0x0a, 0x4f, 0x33, 0x31, 0x6c, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x33, 0x10, 0x1a, 0x8f, 0x12, 0x6e, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x4b, 0xd2, 0x0a, 0x4e, 0x12, 0x6e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x33, 0x31, 0x02, 0x0d, 0x02, 0x0d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x12, 0x6e, 0x01, 0xed, 0x12, 0x4e, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0xde, 0xdb, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x1a, 0x8f, 0x01, 0xed, 0x0a, 0x4e, 0x33, 0x71, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x74, 0x33, 0x31, 0x0a, 0x4f, 0x12, 0x6f, 0x3b, 0x71, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x2b, 0x11, 0x0a, 0x4f, 0x12, 0x8f, 0x4b, 0xb2, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x22, 0xcf, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x33, 0x10, 0x7c, 0xf5, 0x53, 0xf3, 0x0a, 0x2d, 0x1a, 0x8f, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x02, 0x0d, 0x02, 0x0d, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x12, 0x8e, 0x01, 0xed, 0x12, 0x6e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x22, 0xd0, 0x01, 0xed, 0x0a, 0x2d, 0x2b, 0x10, 0x33, 0x31, 0x2a, 0xf0, 0x1a, 0x8f, 0x1a, 0x8f, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x51, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0xa5, 0xd7, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x4b, 0xb2, 0x12, 0x8f, 0x0a, 0x2e, 0x2a, 0xf1, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x53, 0xf3, 0x1a, 0xb0, 0x0a, 0x2e, 0x22, 0xf0, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x2b, 0x10, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x2d, 0x22, 0xcf, 0x3b, 0x92, 0x0a, 0x2d, 0x22, 0xaf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6e, 0x01, 0xed, 0x12, 0x6e, 0x53, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x01, 0xed, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x1a, 0xaf, 0x01, 0xed, 0x12, 0x4e, 0x5c, 0x34, 0xbe, 0x59, 0x9d, 0x57, 0x7c, 0xb5, 0x7c, 0xb5, 0x8d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x1a, 0x8f, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x95, 0x77, 0x00, 0x00, 0xbe, 0x59, 0x43, 0x92, 0x43, 0x71, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x22, 0xf0, 0x0a, 0x2e, 0x1a, 0xb0, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x43, 0x92, 0x12, 0x6f, 0x0a, 0x4f, 0x3b, 0x71, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x3b, 0x51, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x3b, 0x71, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x02, 0x0d, 0x2a, 0xf0, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x43, 0x91, 0x3b, 0x51, 0x1a, 0x8f, 0x02, 0x0d, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x8e, 0x01, 0xed, 0x12, 0x8e, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x01, 0xed, 0x22, 0xaf, 0x8d, 0x16, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6e, 0x0a, 0x4e, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x3b, 0x51, 0x12, 0x6f, 0x12, 0x6f, 0x43, 0x92, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x33, 0x31, 0x0a, 0x4f, 0x1a, 0x90, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x3b, 0x51, 0x0a, 0x4e, 0x02, 0x0d, 0x33, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x91, 0x12, 0x8e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x1a, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x2d, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x12, 0x4e, 0x01, 0xed, 0x22, 0xaf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x1a, 0x8f, 0x02, 0x0d, 0x33, 0x31, 0x1a, 0xaf, 0x01, 0xed, 0x1a, 0x8f, 0x7c, 0xf5, 0xbd, 0xfa, 0x33, 0x10, 0x02, 0x0d, 0x12, 0x8e, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x53, 0xf3, 0x1a, 0x90, 0x0a, 0x4f, 0x33, 0x10, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xef, 0x0a, 0x2e, 0x22, 0xd0, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x1a, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x4e, 0x3b, 0x71, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x54, 0x13, 0x1a, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x2b, 0x10, 0x12, 0x6e, 0x0a, 0x4e, 0x0a, 0x4e, 0x22, 0xaf, 0x3b, 0x51, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x1a, 0x8f, 0x0a, 0x2e, 0x33, 0x31, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x6e, 0x5c, 0x34, 0x22, 0xcf, 0x01, 0xed, 0x12, 0x8e, 0x64, 0x33, 0x53, 0xf3, 0x12, 0x6e, 0x02, 0x0d, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x22, 0xd0, 0x0a, 0x2e, 0x22, 0xf0, 0x5c, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x1a, 0xb0, 0x0a, 0x2e, 0x2b, 0x11, 0x7c, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x3b, 0x51, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xaf, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x12, 0x8e, 0x01, 0xed, 0x0a, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x74, 0x94, 0x5c, 0x34, 0x64, 0x33, 0x8c, 0xf6, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x64, 0x74, 0x64, 0x34, 0x6c, 0x94, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x8e, 0x02, 0x0d, 0x33, 0x10, 0x95, 0x77, 0x2a, 0xf0, 0x01, 0xed, 0x12, 0x6e, 0x6c, 0x74, 0x33, 0x10, 0x02, 0x0d, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x33, 0x10, 0x0a, 0x4f, 0x1a, 0x8f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xd2, 0x1a, 0x8f, 0x0a, 0x4f, 0x3b, 0x51, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x1a, 0xaf, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xcf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x6e, 0x64, 0x33, 0xa5, 0xd8, 0x2b, 0x10, 0x01, 0xed, 0x12, 0x6e, 0x4b, 0xd3, 0x12, 0x6e, 0x02, 0x0d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x2a, 0xf0, 0x22, 0xef, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x92, 0x0a, 0x4f, 0x1a, 0x90, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x54, 0x13, 0x12, 0x8f, 0x0a, 0x4f, 0x3b, 0x71, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x2a, 0xf0, 0x01, 0xed, 0x0a, 0x2d, 0x1a, 0xaf, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x51, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xd2, 0x0a, 0x4e, 0x01, 0xed, 0x12, 0x6e, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x8e, 0x02, 0x0d, 0x33, 0x10, 0xbd, 0xfa, 0xbe, 0x59, 0x33, 0x10, 0x02, 0x0d, 0x0a, 0x2e, 0x22, 0xf0, 0x02, 0x0d, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2b, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0xaf, 0x53, 0xf3, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x43, 0x92, 0x0a, 0x4f, 0x12, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x33, 0x12, 0x6f, 0x12, 0x6f, 0x43, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x4b, 0xb2, 0x22, 0xaf, 0x3b, 0x51, 0x8c, 0xf6, 0x3b, 0x71, 0x0a, 0x2d, 0x01, 0xed, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x01, 0xed, 0x0a, 0x2d, 0x43, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x6e, 0x5c, 0x34, 0x00, 0x00, 0xb6, 0x39, 0x33, 0x31, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x3b, 0x51, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x12, 0x6e, 0x43, 0x92, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x12, 0x6f, 0x12, 0x6f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x1a, 0x90, 0x12, 0x6f, 0x43, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x6c, 0x94, 0x8d, 0x75, 0x00, 0x00, 0x85, 0x16, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0xaf, 0x3b, 0x71, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0xa5, 0xd7, 0x85, 0x16, 0x6c, 0x94, 0x53, 0xf3, 0x43, 0x71, 0x54, 0x13, 0x4b, 0xd2, 0x4b, 0xd2, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x43, 0x91, 0x4b, 0xd2, 0x54, 0x13, 0x5c, 0x33, 0x33, 0x30, 0x53, 0xf3, 0x74, 0xb5, 0x9d, 0x57, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x4b, 0xd3, 0x22, 0xaf, 0x2b, 0x31, 0xbd, 0xfa, 0x00, 0x00, 0xb6, 0x39, 0x33, 0x31, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x4b, 0xb2, 0x0a, 0x4e, 0x01, 0xed, 0x0a, 0x2d, 0x2a, 0xf0, 0x12, 0x4e, 0x01, 0xed, 0x0a, 0x2e, 0x2b, 0x31, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x12, 0x6f, 0x12, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x1a, 0x8f, 0x0a, 0x4f, 0x43, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0xf6, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x8e, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x51, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x85, 0x16, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x74, 0xb5, 0x53, 0xf3, 0x43, 0x92, 0x33, 0x10, 0x22, 0xef, 0x22, 0xcf, 0x22, 0xcf, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xaf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x22, 0xef, 0x22, 0xd0, 0x22, 0xaf, 0x22, 0xaf, 0x1a, 0x8f, 0x22, 0xcf, 0x22, 0xaf, 0x2a, 0xf0, 0x2b, 0x10, 0x3b, 0x71, 0x4b, 0xb2, 0x64, 0x54, 0xa5, 0xd8, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0x7c, 0xf5, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x8e, 0x01, 0xed, 0x02, 0x0d, 0x2b, 0x10, 0x9d, 0x97, 0x53, 0xf3, 0x1a, 0x8f, 0x02, 0x0d, 0x0a, 0x2d, 0x22, 0xef, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x0a, 0x4f, 0x12, 0x8f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x22, 0xd0, 0x0a, 0x4f, 0x3b, 0x71, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x4b, 0xd2, 0x2a, 0xf0, 0x43, 0xb2, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x0a, 0x2d, 0x01, 0xed, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x64, 0x33, 0x43, 0x92, 0x2b, 0x10, 0x22, 0xaf, 0x22, 0xaf, 0x1a, 0xaf, 0x22, 0xef, 0x33, 0x10, 0x3b, 0x71, 0x53, 0xf3, 0x54, 0x13, 0x5c, 0x13, 0x6c, 0x94, 0x74, 0xb5, 0x85, 0x16, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x57, 0x9d, 0x57, 0x8c, 0xf6, 0x7c, 0xd6, 0x64, 0x54, 0x53, 0xf3, 0x53, 0xf3, 0x43, 0x91, 0x3b, 0x51, 0x22, 0xd0, 0x22, 0xcf, 0x22, 0xaf, 0x22, 0xaf, 0x2a, 0xf0, 0x33, 0x31, 0x4b, 0xb2, 0x6c, 0x54, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x43, 0xb2, 0x0a, 0x2d, 0x01, 0xed, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0xff, 0xff, 0x64, 0x33, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x3b, 0x51, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x0a, 0x4f, 0x22, 0xcf, 0x5c, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x54, 0x22, 0xcf, 0x0a, 0x2e, 0x3b, 0x51, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x1a, 0x6e, 0x02, 0x0d, 0x0a, 0x4e, 0x43, 0x71, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xcf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x54, 0x13, 0x3b, 0x51, 0x22, 0xcf, 0x1a, 0x8f, 0x22, 0xaf, 0x2b, 0x10, 0x3b, 0x71, 0x54, 0x13, 0x7c, 0xd5, 0xb5, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x39, 0x95, 0x36, 0x6c, 0x94, 0x4b, 0xb2, 0x3b, 0x51, 0x22, 0xcf, 0x22, 0xaf, 0x1a, 0xaf, 0x2b, 0x10, 0x43, 0x91, 0x64, 0x74, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x22, 0xaf, 0x0a, 0x4e, 0x43, 0xb2, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2b, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x8e, 0x4b, 0xb2, 0xa5, 0xd7, 0x00, 0x00, 0x7c, 0xb5, 0x33, 0x10, 0x22, 0xcf, 0x6c, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x3b, 0x92, 0x0a, 0x4f, 0x2a, 0xf0, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2b, 0x11, 0x0a, 0x4f, 0x33, 0x31, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd6, 0x22, 0xcf, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x6e, 0x4b, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x51, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x6c, 0x94, 0x3b, 0x71, 0x22, 0xcf, 0x22, 0xaf, 0x2a, 0xf0, 0x3b, 0x51, 0x53, 0xf3, 0x74, 0xb5, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0x9d, 0x57, 0x64, 0x33, 0x43, 0x92, 0x2b, 0x10, 0x22, 0xaf, 0x22, 0xaf, 0x2b, 0x10, 0x53, 0xd2, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x54, 0x4b, 0xb2, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x3b, 0x51, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x4e, 0x2b, 0x10, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x4e, 0x33, 0x31, 0x74, 0xb5, 0xff, 0xff, 0x9d, 0x57, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x33, 0x10, 0x0a, 0x2e, 0x33, 0x31, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x31, 0x0a, 0x2e, 0x2a, 0xf1, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x1a, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x8e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x0a, 0x2d, 0x0a, 0x2d, 0x33, 0x10, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x5c, 0x34, 0x3b, 0x51, 0x22, 0xaf, 0x22, 0xaf, 0x33, 0x10, 0x54, 0x13, 0x95, 0x36, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x6c, 0x94, 0x43, 0x91, 0x2a, 0xf0, 0x1a, 0x8f, 0x2a, 0xf0, 0x43, 0x91, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xbe, 0xfb, 0x4b, 0xb2, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x71, 0xad, 0xd8, 0x53, 0xf3, 0x1a, 0x8f, 0x02, 0x0d, 0x0a, 0x4e, 0x4b, 0xd3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x43, 0xb2, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0x22, 0xf0, 0x0a, 0x2e, 0x33, 0x71, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x92, 0x0a, 0x4f, 0x1a, 0xb0, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x22, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x3b, 0x51, 0x3b, 0x71, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x64, 0x33, 0x33, 0x10, 0x1a, 0x8f, 0x2a, 0xf0, 0x3b, 0x71, 0x64, 0x74, 0xde, 0xdb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xd2, 0x2b, 0x10, 0x22, 0xaf, 0x2a, 0xf0, 0x43, 0x92, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x01, 0xed, 0x01, 0xed, 0x12, 0x8e, 0x7c, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x74, 0x22, 0xef, 0x22, 0xcf, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x1a, 0x6e, 0x12, 0x6e, 0x43, 0x91, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xcf, 0x0a, 0x4f, 0x43, 0x92, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6f, 0x12, 0x6f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x12, 0x8e, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0xaf, 0x5c, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x33, 0x10, 0x22, 0xaf, 0x22, 0xcf, 0x43, 0x91, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x64, 0x33, 0x33, 0x10, 0x1a, 0x8f, 0x2a, 0xf0, 0x43, 0x91, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x22, 0xaf, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xcf, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x74, 0xb5, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x2a, 0xf0, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x8f, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x22, 0xcf, 0x0a, 0x4f, 0x43, 0x92, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x8e, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xaf, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf5, 0x3b, 0x51, 0x22, 0xaf, 0x22, 0xaf, 0x43, 0x71, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x64, 0x33, 0x33, 0x10, 0x1a, 0x8f, 0x2a, 0xf0, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x2a, 0xf0, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0x8f, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x3b, 0x51, 0x0a, 0x2d, 0x01, 0xed, 0x12, 0x6e, 0x53, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6f, 0x22, 0xcf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2b, 0x11, 0x0a, 0x2e, 0x33, 0x71, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x64, 0x33, 0x43, 0x92, 0x4b, 0xb2, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x12, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x2a, 0xf0, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x4b, 0xb2, 0x22, 0xaf, 0x22, 0xaf, 0x33, 0x51, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x54, 0x13, 0x2a, 0xf0, 0x1a, 0x8f, 0x33, 0x31, 0x6c, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x3b, 0x51, 0x0a, 0x2e, 0x01, 0xed, 0x12, 0x4e, 0x3b, 0x71, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x0a, 0x4e, 0x01, 0xed, 0x0a, 0x4e, 0x4b, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x51, 0x0a, 0x4f, 0x2b, 0x11, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x2a, 0xf0, 0x8c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0x3b, 0x51, 0x0a, 0x4e, 0x0a, 0x2d, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x43, 0xb2, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xd0, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x53, 0x2b, 0x31, 0x1a, 0x8f, 0x2b, 0x10, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x43, 0x91, 0x1a, 0x8f, 0x22, 0xaf, 0x53, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x43, 0x92, 0x12, 0x6e, 0x01, 0xed, 0x12, 0x6e, 0x64, 0x95, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x12, 0x8e, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x51, 0xbe, 0x59, 0x00, 0x00, 0xbe, 0xfb, 0x64, 0x74, 0x64, 0x74, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xf0, 0x0a, 0x4f, 0x43, 0xb2, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x8f, 0x12, 0x8f, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0xef, 0x5d, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x71, 0x0a, 0x4e, 0x02, 0x0d, 0x22, 0xaf, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x5c, 0x34, 0x22, 0xcf, 0x22, 0xaf, 0x43, 0x92, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x22, 0xd0, 0x1a, 0x8f, 0x3b, 0x71, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x53, 0xd2, 0x22, 0xcf, 0x3b, 0x51, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x2b, 0x10, 0x95, 0x36, 0xbe, 0x59, 0x6c, 0x94, 0x33, 0x51, 0x1a, 0x8f, 0x12, 0x8e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x1a, 0x90, 0x12, 0x6f, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf1, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x2d, 0x0a, 0x2d, 0x2b, 0x10, 0x53, 0xf3, 0x7c, 0xb5, 0xad, 0xd8, 0x53, 0xd2, 0x3b, 0x71, 0x3b, 0x92, 0x4b, 0xb2, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x51, 0x2a, 0xf0, 0x6c, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x43, 0x92, 0x1a, 0x8f, 0x2a, 0xf0, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x43, 0xb2, 0x1a, 0x8f, 0x2b, 0x10, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x7c, 0xb5, 0x64, 0x33, 0x33, 0x10, 0x1a, 0x8f, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x22, 0xd0, 0x8d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x22, 0xd0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x0a, 0x4f, 0x2a, 0xf1, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd2, 0x22, 0xaf, 0x02, 0x0d, 0x2a, 0xf0, 0x7c, 0xf5, 0xff, 0xff, 0x6c, 0x94, 0x33, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x95, 0x77, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x10, 0x1a, 0x8f, 0x3b, 0x71, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x5c, 0x34, 0x22, 0xcf, 0x22, 0xcf, 0x53, 0xd2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x3b, 0x71, 0x0a, 0x4e, 0x01, 0xed, 0x1a, 0x8f, 0x4b, 0xf3, 0x2b, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x10, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2b, 0x11, 0x0a, 0x4f, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0x90, 0x12, 0x8f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x12, 0x6e, 0x02, 0x0d, 0x3b, 0x51, 0xad, 0xd8, 0x64, 0x74, 0x22, 0xcf, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x2b, 0x10, 0x1a, 0x8f, 0x4b, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0xbe, 0x59, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x2b, 0x10, 0x1a, 0x8f, 0x4b, 0xd2, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xd2, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x4e, 0x12, 0x4e, 0x02, 0x0d, 0x0a, 0x4e, 0x2b, 0x10, 0x2b, 0x11, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x1a, 0x90, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2b, 0x11, 0x0a, 0x4f, 0x43, 0x92, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x53, 0x1a, 0x6e, 0x01, 0xed, 0x12, 0x6e, 0x2b, 0x10, 0x12, 0x8e, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x22, 0xaf, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x74, 0x22, 0xcf, 0x22, 0xcf, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x75, 0x4b, 0xb2, 0x33, 0x10, 0x33, 0x10, 0x33, 0x31, 0x4b, 0xb2, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x3b, 0x51, 0x1a, 0x8f, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x6e, 0x2a, 0xf0, 0x5c, 0x34, 0x54, 0x13, 0x12, 0x4e, 0x01, 0xed, 0x12, 0x8e, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x2b, 0x11, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x0a, 0x4f, 0x22, 0xd0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x75, 0x33, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2e, 0x3b, 0x51, 0x74, 0xb5, 0x8c, 0xf6, 0x22, 0xaf, 0x01, 0xed, 0x22, 0xcf, 0x9d, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x22, 0xd0, 0x22, 0xcf, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x5c, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x71, 0x22, 0xcf, 0x2b, 0x10, 0x3b, 0x51, 0x2b, 0x10, 0x1a, 0x8f, 0x2b, 0x31, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x3b, 0x71, 0x1a, 0x6e, 0x3b, 0x51, 0x8d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x8e, 0x02, 0x0d, 0x12, 0x6e, 0x33, 0x10, 0x64, 0x33, 0xbe, 0x59, 0x64, 0x74, 0x1a, 0x6e, 0x01, 0xed, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0xef, 0x5d, 0x74, 0xb5, 0x3b, 0x71, 0x2b, 0x10, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xd0, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xd0, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x22, 0xcf, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x6e, 0x3b, 0x71, 0x9d, 0x57, 0x00, 0x00, 0x8c, 0xf6, 0x22, 0xcf, 0x01, 0xed, 0x22, 0xd0, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xcf, 0x2a, 0xf0, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x75, 0xef, 0x5d, 0xbd, 0xfa, 0x4b, 0xd2, 0x2a, 0xf0, 0x2a, 0xf0, 0x4b, 0xb2, 0x6c, 0x54, 0x6c, 0x54, 0x6c, 0x74, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x22, 0xcf, 0x4b, 0xb2, 0xbe, 0x59, 0xff, 0xff, 0xb5, 0xd9, 0x43, 0x91, 0x12, 0x8e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x33, 0x51, 0x1a, 0x6e, 0x33, 0x30, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x53, 0xf3, 0x3b, 0x71, 0x64, 0x54, 0xbd, 0xfa, 0x00, 0x00, 0x7c, 0xf5, 0x22, 0xcf, 0x02, 0x0d, 0x0a, 0x2d, 0x3b, 0x71, 0xad, 0xd8, 0x64, 0x33, 0x33, 0x51, 0x22, 0xaf, 0x0a, 0x2d, 0x02, 0x0d, 0x2a, 0xf0, 0x8d, 0x16, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6f, 0x22, 0xcf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x2b, 0x11, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x43, 0x92, 0x3b, 0x51, 0x3b, 0x51, 0x64, 0x33, 0xb5, 0xd9, 0xb6, 0x39, 0x85, 0x16, 0x3b, 0x51, 0x0a, 0x2d, 0x0a, 0x2d, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x2a, 0xf0, 0x22, 0xcf, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x3b, 0x71, 0x33, 0x31, 0x4b, 0xd3, 0x3b, 0x92, 0x4b, 0xb2, 0x4b, 0xd2, 0x2b, 0x10, 0x2a, 0xf0, 0x1a, 0xaf, 0x22, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x22, 0xef, 0x2b, 0x31, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x51, 0x1a, 0x8f, 0x3b, 0x51, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x3b, 0x51, 0x0a, 0x2d, 0x02, 0x0d, 0x2b, 0x10, 0x6c, 0x95, 0x3b, 0x71, 0x1a, 0x8f, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x4e, 0x22, 0xcf, 0x4b, 0xd2, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x33, 0x10, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x1a, 0xb0, 0x12, 0x6f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0xff, 0xff, 0xef, 0x5d, 0x4b, 0xb2, 0x33, 0x10, 0x22, 0xcf, 0x0a, 0x2d, 0x02, 0x0d, 0x2a, 0xf0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xef, 0x22, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x2b, 0x10, 0x12, 0x4e, 0x4b, 0xb2, 0x85, 0x16, 0xff, 0xff, 0xff, 0xff, 0x85, 0x16, 0x64, 0x74, 0x3b, 0x51, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x33, 0x30, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x3b, 0x51, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x1a, 0x8f, 0x4b, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x3b, 0x71, 0x0a, 0x2e, 0x01, 0xed, 0x0a, 0x4e, 0x33, 0x31, 0x12, 0x8e, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x6e, 0x2b, 0x10, 0x54, 0x13, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x1a, 0xb0, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x2b, 0x31, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x9d, 0x57, 0x95, 0x77, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x22, 0xaf, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xcf, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x10, 0x22, 0xcf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x4e, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x33, 0x10, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x51, 0x22, 0xaf, 0x53, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x1a, 0x8f, 0x3b, 0x51, 0x64, 0x33, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x1a, 0xb0, 0x12, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x4b, 0xd2, 0x2a, 0xf0, 0x22, 0xd0, 0x33, 0x31, 0x54, 0x13, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x33, 0x10, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x31, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x1a, 0xaf, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x33, 0x51, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x16, 0x6c, 0x74, 0x2a, 0xf0, 0x1a, 0x8f, 0x64, 0x33, 0xde, 0xdb, 0xb6, 0x39, 0xbd, 0xfa, 0x64, 0x33, 0x1a, 0xaf, 0x3b, 0x51, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2b, 0x10, 0x22, 0xaf, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x1a, 0xaf, 0x3b, 0x71, 0x6c, 0x94, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x8f, 0x1a, 0xb0, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x2e, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x0a, 0x4e, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x8e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x64, 0x74, 0x5c, 0x34, 0x6c, 0x94, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x1a, 0x8f, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x2a, 0xf0, 0x1a, 0xaf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x3b, 0x51, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x53, 0xf3, 0x22, 0xd0, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0x8f, 0x33, 0x10, 0x3b, 0x92, 0x2b, 0x10, 0x12, 0x8e, 0x02, 0x0d, 0x0a, 0x4e, 0x2a, 0xf0, 0x4b, 0xb2, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x7c, 0xd6, 0x7c, 0xd6, 0x7c, 0xd6, 0x7c, 0xd6, 0x7c, 0xd6, 0x7c, 0xd6, 0x6c, 0x94, 0x64, 0x54, 0x64, 0x54, 0x64, 0x54, 0x64, 0x54, 0x5c, 0x13, 0x64, 0x33, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x2a, 0xf0, 0x22, 0xcf, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x12, 0x6e, 0x22, 0xcf, 0x4b, 0xb2, 0x7c, 0xd5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x2b, 0x31, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xd0, 0x12, 0x6f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x2d, 0x0a, 0x2e, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0xaf, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x22, 0xaf, 0x33, 0x31, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x12, 0x6e, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x3b, 0x92, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x54, 0x13, 0x3b, 0x51, 0x2b, 0x10, 0x2a, 0xf0, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x2b, 0x10, 0x53, 0xf3, 0x9d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x2a, 0xf0, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x12, 0x8e, 0x12, 0x8e, 0x12, 0x8e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x3b, 0x71, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x22, 0xaf, 0x33, 0x10, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x64, 0x74, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x22, 0xd0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6f, 0x2a, 0xf1, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x2b, 0x10, 0x02, 0x0d, 0x12, 0x6e, 0x43, 0x92, 0x4b, 0xb2, 0x1a, 0x8f, 0x01, 0xed, 0x12, 0x6e, 0x54, 0x13, 0x85, 0x16, 0x85, 0x16, 0x9d, 0x57, 0xad, 0xd8, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xcf, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x22, 0xaf, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x4b, 0xf3, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x43, 0x92, 0x22, 0xd0, 0x3b, 0x51, 0x85, 0x16, 0xad, 0xd8, 0x33, 0x31, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x22, 0xcf, 0x3b, 0x71, 0x33, 0x51, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x2b, 0x10, 0x4b, 0xd2, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x8c, 0xf6, 0x22, 0xcf, 0x12, 0x6e, 0x22, 0xaf, 0x22, 0xcf, 0x22, 0xcf, 0x2a, 0xf0, 0x22, 0xd0, 0x22, 0xd0, 0x22, 0xd0, 0x22, 0xd0, 0x33, 0x10, 0x33, 0x10, 0x33, 0x10, 0x1a, 0xaf, 0x02, 0x0d, 0x2a, 0xf0, 0x95, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0x8f, 0x3b, 0x51, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2b, 0x11, 0x0a, 0x4f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x10, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xef, 0x5d, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x2d, 0x02, 0x0d, 0x12, 0x6e, 0x12, 0x6e, 0x1a, 0xaf, 0x22, 0xaf, 0x22, 0xf1, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x10, 0x22, 0xaf, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0x8f, 0x5c, 0x33, 0x85, 0x16, 0x5c, 0x13, 0x53, 0xf3, 0x43, 0xb2, 0x3b, 0x92, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x33, 0x10, 0x2a, 0xf0, 0x4b, 0xb2, 0xbd, 0xfa, 0x00, 0x00, 0x7c, 0xf5, 0x22, 0xcf, 0x01, 0xed, 0x02, 0x0d, 0x33, 0x31, 0x95, 0x77, 0xff, 0xff, 0xff, 0xff, 0x95, 0x77, 0x4b, 0xb2, 0x1a, 0x8f, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x6e, 0x22, 0xef, 0x43, 0x92, 0x53, 0xf3, 0x33, 0x10, 0x12, 0x6e, 0x4b, 0xd2, 0x8c, 0xf6, 0x8d, 0x16, 0x64, 0x95, 0x54, 0x13, 0x5c, 0x34, 0x8c, 0xf6, 0xb5, 0xd9, 0xbe, 0x59, 0xbe, 0x59, 0xbe, 0x59, 0xbe, 0x59, 0x6c, 0x74, 0x12, 0x6e, 0x1a, 0xaf, 0x8c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x31, 0x22, 0xaf, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x0a, 0x4f, 0x2b, 0x11, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0x90, 0x1a, 0xb0, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x02, 0x0d, 0x1a, 0x8f, 0x7c, 0xb5, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x51, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x12, 0x6e, 0x12, 0x8e, 0x1a, 0xaf, 0x12, 0x8e, 0x12, 0x4e, 0x12, 0x6e, 0x12, 0x6e, 0x33, 0x31, 0x43, 0x91, 0x53, 0xf3, 0x95, 0x36, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0xf6, 0x43, 0x92, 0x2a, 0xf0, 0x33, 0x10, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x8d, 0x76, 0x33, 0x10, 0x0a, 0x2d, 0x01, 0xed, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x33, 0x31, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x4e, 0x33, 0x51, 0xbd, 0xfa, 0x6c, 0x54, 0x3b, 0x51, 0x1a, 0xaf, 0x0a, 0x4e, 0x0a, 0x4e, 0x22, 0xcf, 0x53, 0xf3, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x12, 0x8e, 0x22, 0xef, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x2a, 0xf0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x12, 0x6f, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x12, 0x6e, 0x01, 0xed, 0x22, 0xaf, 0x53, 0xd2, 0xa5, 0xd7, 0x74, 0xb5, 0x1a, 0x8f, 0x02, 0x0d, 0x1a, 0x8f, 0x22, 0xaf, 0x12, 0x8e, 0x12, 0x6e, 0x0a, 0x4e, 0x12, 0x8e, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0xaf, 0x33, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x02, 0x0d, 0x0a, 0x2e, 0x12, 0x6e, 0x22, 0xaf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xaf, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xcf, 0x22, 0xd0, 0x3b, 0x51, 0x43, 0x71, 0x43, 0x71, 0x3b, 0x71, 0x22, 0xcf, 0x22, 0xaf, 0x43, 0x92, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x33, 0x10, 0x0a, 0x2d, 0x01, 0xed, 0x02, 0x0d, 0x33, 0x31, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2b, 0x31, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2e, 0x33, 0x71, 0x8d, 0x76, 0x6c, 0x94, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6e, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x1a, 0x8f, 0x3b, 0x71, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xf0, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x71, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x33, 0x31, 0x33, 0x31, 0x0a, 0x2d, 0x12, 0x8e, 0x64, 0x95, 0x7c, 0xd5, 0x64, 0x33, 0x6c, 0x94, 0x54, 0x13, 0x5c, 0x34, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x22, 0xaf, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xef, 0x1a, 0x8f, 0x33, 0x10, 0x53, 0xd2, 0x64, 0x33, 0x7c, 0xd5, 0x9d, 0x97, 0x9d, 0x97, 0x7c, 0xf5, 0x64, 0x33, 0x43, 0x91, 0x33, 0x10, 0x22, 0xcf, 0x12, 0x6e, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x12, 0x6e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0xbd, 0xfa, 0x64, 0x33, 0x22, 0xef, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x12, 0x6e, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x10, 0xa5, 0xd8, 0xb5, 0xd9, 0x33, 0x10, 0x02, 0x0d, 0x0a, 0x2d, 0x2b, 0x10, 0x43, 0x92, 0x1a, 0x8f, 0x01, 0xed, 0x12, 0x6e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x2b, 0x10, 0x12, 0x8e, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x22, 0xaf, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x22, 0xf0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x34, 0x2a, 0xf0, 0x12, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x2b, 0x10, 0xad, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x1a, 0x8f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2b, 0x10, 0x33, 0x10, 0x7c, 0xf6, 0x8c, 0xf6, 0x74, 0x94, 0x74, 0x94, 0x85, 0x16, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xde, 0xdb, 0x85, 0x16, 0x53, 0xf3, 0x43, 0x92, 0x22, 0xd0, 0x12, 0x8e, 0x22, 0xaf, 0x5c, 0x34, 0x74, 0x94, 0x53, 0xd2, 0x33, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xef, 0x9d, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xbd, 0xfa, 0x8d, 0x75, 0x95, 0x36, 0x4b, 0xd3, 0x0a, 0x2e, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xd0, 0xbe, 0x59, 0x5c, 0x34, 0x12, 0x4e, 0x02, 0x0d, 0x22, 0xef, 0x85, 0x16, 0x95, 0x77, 0x2a, 0xf0, 0x02, 0x0d, 0x1a, 0xaf, 0x8c, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6e, 0x33, 0x51, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x22, 0xcf, 0x33, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xf0, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x43, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x2b, 0x10, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x33, 0x10, 0x54, 0x13, 0x9d, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x2a, 0xf0, 0x22, 0xef, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x12, 0x6e, 0x3b, 0x71, 0x3b, 0x71, 0x2b, 0x10, 0x33, 0x51, 0x43, 0x92, 0x3b, 0x92, 0x3b, 0x92, 0x4b, 0xd3, 0x54, 0x13, 0x74, 0xb5, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x64, 0x54, 0x4b, 0xd3, 0x43, 0x92, 0x2a, 0xf0, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x51, 0x54, 0x13, 0x54, 0x13, 0x4b, 0xb2, 0x4b, 0xb2, 0x43, 0x92, 0x3b, 0x71, 0x3b, 0x51, 0x2b, 0x10, 0x1a, 0x8f, 0x22, 0xcf, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0xaf, 0x7c, 0xf6, 0x2b, 0x10, 0x02, 0x0d, 0x0a, 0x4e, 0x53, 0xf3, 0x85, 0x16, 0x3b, 0x51, 0x0a, 0x2d, 0x02, 0x0d, 0x3b, 0x51, 0xde, 0xdb, 0x85, 0x16, 0x43, 0x91, 0x1a, 0x6e, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x4b, 0xd2, 0x22, 0xd0, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x22, 0xd0, 0x4b, 0xd2, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1a, 0xcf, 0x22, 0xcf, 0x3b, 0x92, 0x53, 0xf3, 0x54, 0x13, 0x64, 0x74, 0x7c, 0xd5, 0x64, 0x33, 0x53, 0xf3, 0x43, 0x92, 0x2a, 0xf0, 0x22, 0xcf, 0x3b, 0x51, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x4b, 0xb2, 0x22, 0xcf, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xf0, 0x53, 0xd2, 0x0a, 0x2e, 0x01, 0xed, 0x1a, 0x8f, 0x5c, 0x14, 0x2a, 0xf0, 0x0a, 0x2d, 0x01, 0xed, 0x1a, 0x8f, 0x5c, 0x34, 0x43, 0x92, 0x2b, 0x10, 0x22, 0xd0, 0x3b, 0x51, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xd0, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x85, 0x16, 0x53, 0xf3, 0x3b, 0x71, 0x2b, 0x10, 0x43, 0x92, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x6f, 0x22, 0xd0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xd2, 0x22, 0xd0, 0x12, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2a, 0xf0, 0x2b, 0x10, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x8d, 0x16, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x43, 0x92, 0x22, 0xcf, 0x1a, 0xaf, 0x33, 0x30, 0x6c, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x33, 0x51, 0x12, 0x4e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x12, 0x6e, 0x1a, 0x6e, 0x1a, 0xaf, 0x22, 0xd0, 0x2b, 0x10, 0x2a, 0xf0, 0x2b, 0x10, 0x22, 0xaf, 0x0a, 0x2d, 0x0a, 0x2e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x4e, 0x0a, 0x4e, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x0a, 0x4e, 0x01, 0xed, 0x0a, 0x2d, 0x1a, 0x8f, 0x2b, 0x11, 0x3b, 0x51, 0x4b, 0xd3, 0x4b, 0xb2, 0x64, 0x74, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xd2, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x6c, 0x54, 0x4b, 0xd2, 0x33, 0x31, 0x22, 0xcf, 0x12, 0x6e, 0x0a, 0x2d, 0x01, 0xed, 0x1a, 0xaf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x22, 0xf0, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x54, 0x13, 0x2b, 0x10, 0x12, 0x4e, 0x12, 0x6e, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x43, 0x92, 0x22, 0xaf, 0x1a, 0xaf, 0x4b, 0xb2, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf5, 0x53, 0xf3, 0x95, 0x77, 0x43, 0x71, 0x12, 0x6e, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x6e, 0x4b, 0xd2, 0x6c, 0x74, 0x7c, 0xf5, 0x8d, 0x76, 0xad, 0xd8, 0xad, 0xd8, 0xbd, 0xfa, 0xa5, 0xd7, 0x7c, 0xf6, 0x53, 0xf3, 0x4b, 0xd2, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x4e, 0x33, 0x51, 0x8c, 0xf6, 0x9d, 0x57, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x22, 0xd0, 0x2b, 0x10, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0x6c, 0x94, 0x4b, 0xb2, 0x33, 0x10, 0x22, 0xaf, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xaf, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2b, 0x10, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x92, 0x33, 0x10, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x54, 0x13, 0x4b, 0xd3, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x10, 0x22, 0xef, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x2b, 0x10, 0x12, 0x6e, 0x2b, 0x10, 0x64, 0x33, 0xef, 0x5d, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x2a, 0xf0, 0x8d, 0x16, 0x33, 0x31, 0x02, 0x0d, 0x12, 0x4e, 0x3b, 0x92, 0x43, 0xb2, 0x53, 0xf3, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x51, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x12, 0x6e, 0x2a, 0xf0, 0x0a, 0x2d, 0x01, 0xed, 0x2a, 0xf0, 0xad, 0xd8, 0xff, 0xff, 0xbe, 0x59, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x22, 0xaf, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x53, 0xf3, 0x2a, 0xf0, 0x12, 0x8e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x8e, 0x2a, 0xf0, 0x3b, 0x51, 0x64, 0x74, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x6f, 0x2a, 0xf1, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x1a, 0x90, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6e, 0x0a, 0x2d, 0x43, 0xb2, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x4b, 0xb2, 0x22, 0xaf, 0x22, 0xaf, 0x3b, 0x51, 0x95, 0x36, 0x7c, 0xb5, 0x2a, 0xf0, 0x12, 0x4e, 0x22, 0xcf, 0x3b, 0x51, 0x0a, 0x2d, 0x1a, 0x8f, 0x95, 0x77, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xef, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2e, 0x12, 0x6e, 0x12, 0x6e, 0x5c, 0x14, 0x33, 0x10, 0x0a, 0x4e, 0x12, 0x8e, 0x2a, 0xf0, 0x22, 0xf0, 0x33, 0x31, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2e, 0x0a, 0x2d, 0x01, 0xed, 0x2a, 0xf0, 0x7c, 0xf6, 0xb5, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xd0, 0x12, 0x8f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x0a, 0x4f, 0x2b, 0x31, 0xef, 0x5d, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x2d, 0x0a, 0x2e, 0x53, 0xf3, 0xff, 0xff, 0x8c, 0xf6, 0x5c, 0x34, 0x6c, 0x54, 0xa5, 0xd7, 0x00, 0x00, 0x9d, 0x16, 0x64, 0x74, 0x64, 0x74, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x22, 0xcf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x3b, 0x51, 0x1a, 0x8f, 0x33, 0x10, 0x74, 0xb5, 0x95, 0x77, 0x43, 0x92, 0x1a, 0x6e, 0x0a, 0x2d, 0x02, 0x0d, 0x12, 0x4e, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x43, 0x92, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x71, 0x64, 0x34, 0x12, 0x8e, 0x1a, 0xaf, 0x5c, 0x34, 0x53, 0xf3, 0x3b, 0x71, 0x2b, 0x11, 0x0a, 0x2d, 0x12, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x51, 0x22, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x12, 0x4e, 0x22, 0xcf, 0x3b, 0x71, 0x53, 0xf3, 0x22, 0xcf, 0x01, 0xed, 0x22, 0xcf, 0x8c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x33, 0x31, 0x0a, 0x4f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0xb6, 0x39, 0x33, 0x10, 0x02, 0x0d, 0x12, 0x8e, 0x6c, 0x94, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6e, 0x2b, 0x10, 0x74, 0xb5, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x1a, 0x8f, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xaf, 0x33, 0x31, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x54, 0x13, 0x2b, 0x10, 0x22, 0xcf, 0x3b, 0x51, 0x64, 0x34, 0x6c, 0x95, 0x33, 0x51, 0x0a, 0x2d, 0x02, 0x0d, 0x2b, 0x10, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x92, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2e, 0x2b, 0x31, 0x95, 0x36, 0xde, 0xdb, 0x43, 0x92, 0x12, 0x4e, 0x1a, 0x8f, 0x2b, 0x31, 0x33, 0x10, 0x12, 0x8e, 0x02, 0x0d, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x54, 0x13, 0x53, 0xf3, 0x95, 0x36, 0xef, 0x5d, 0xff, 0xff, 0x3b, 0x71, 0x02, 0x0d, 0x0a, 0x4e, 0x54, 0x13, 0x00, 0x00, 0xbe, 0xfb, 0x85, 0x16, 0x64, 0x33, 0x7c, 0xd6, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0xa5, 0xd7, 0x2a, 0xf1, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xaf, 0x01, 0xed, 0x2a, 0xf0, 0xa5, 0xd7, 0xbe, 0x59, 0x33, 0x10, 0x01, 0xed, 0x1a, 0xaf, 0x85, 0x16, 0xff, 0xff, 0x53, 0xf3, 0x0a, 0x2e, 0x0a, 0x2d, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x1a, 0x8f, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x3b, 0x71, 0x22, 0xaf, 0x12, 0x6e, 0x1a, 0x6e, 0x1a, 0x8f, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x33, 0x31, 0x6c, 0x94, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0x6c, 0x94, 0x33, 0x10, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x1a, 0x8f, 0x4b, 0xb2, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x53, 0xf3, 0x2b, 0x10, 0x1a, 0xaf, 0x1a, 0xaf, 0x2a, 0xf0, 0x3b, 0x51, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x2b, 0x10, 0x2a, 0xf0, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x0a, 0x4e, 0x02, 0x0d, 0x3b, 0x51, 0x53, 0xf3, 0x3b, 0x51, 0x22, 0xcf, 0x12, 0x4e, 0x33, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x22, 0xf0, 0xa5, 0xd8, 0x00, 0x00, 
-  0x00, 0x00, 0x7c, 0xd5, 0x1a, 0x8f, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x4e, 0x0a, 0x2d, 0x3b, 0x71, 0xff, 0xff, 0x85, 0x16, 0x1a, 0xaf, 0x02, 0x0d, 0x33, 0x10, 0xbe, 0x59, 0xff, 0xff, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x8e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x2b, 0x31, 0x2a, 0xf0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x43, 0x92, 0x22, 0xcf, 0x12, 0x4e, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x1a, 0x8f, 0x3b, 0x71, 0x64, 0x33, 0xef, 0x5d, 0x74, 0xb5, 0x4b, 0xb2, 0x33, 0x30, 0x2b, 0x10, 0x1a, 0x8f, 0x02, 0x0d, 0x0a, 0x2d, 0x22, 0xcf, 0x43, 0x92, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x85, 0x16, 0x85, 0x16, 0x9d, 0x57, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x22, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x16, 0x64, 0x95, 0x1a, 0x8f, 0x01, 0xed, 0x0a, 0x2d, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x12, 0x8e, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x1a, 0x90, 0x7c, 0xf5, 0x00, 0x00, 
-  0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x2b, 0x11, 0xbe, 0x59, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x2d, 0x0a, 0x2d, 0x43, 0xb2, 0x7c, 0xd5, 0x5c, 0x34, 0x12, 0x4e, 0x0a, 0x2d, 0x4b, 0xd2, 0xff, 0xff, 0xa5, 0xd8, 0x22, 0xcf, 0x01, 0xed, 0x2a, 0xf0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xaf, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x64, 0x74, 0x3b, 0x51, 0x0a, 0x4e, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x51, 0x95, 0x77, 0x4b, 0xd3, 0x22, 0xcf, 0x1a, 0x6e, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xaf, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x64, 0x33, 0x3b, 0x51, 0x2b, 0x10, 0x12, 0x8e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x8e, 0x2b, 0x10, 0x7c, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 
-  0xff, 0xff, 0x4b, 0xd2, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x22, 0xaf, 0x22, 0xaf, 0x02, 0x0d, 0x0a, 0x4e, 0x5c, 0x33, 0xbe, 0x59, 0x74, 0xb5, 0x12, 0x8e, 0x02, 0x0d, 0x3b, 0x51, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x22, 0xaf, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x2b, 0x11, 0x4b, 0xf2, 0x64, 0x34, 0x54, 0x13, 0x6c, 0x95, 0x7c, 0xb5, 0x4b, 0xd3, 0x0a, 0x2d, 0x01, 0xed, 0x22, 0xef, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x22, 0xd0, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x71, 0x12, 0x6e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x1a, 0x8f, 0x33, 0x31, 0x4b, 0xb2, 0x6c, 0x94, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 
-  0xef, 0x5d, 0x3b, 0x51, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x95, 0x36, 0x2a, 0xf0, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x8e, 0x2b, 0x10, 0x2a, 0xf0, 0x0a, 0x2d, 0x0a, 0x2d, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x51, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xad, 0xd8, 0x33, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x22, 0xd0, 0x7c, 0xf6, 0x33, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x64, 0x33, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x22, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x22, 0xaf, 0x3b, 0x51, 0x53, 0xf3, 0x7c, 0xb5, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6f, 0x3b, 0x51, 0xde, 0xdb, 
-  0xa5, 0xd8, 0x2a, 0xf1, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x6c, 0x94, 0x43, 0x91, 0x33, 0x10, 0x1a, 0xaf, 0x12, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x6e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xcf, 0x33, 0x31, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x3b, 0x51, 0x3b, 0x92, 0x3b, 0x92, 0x3b, 0x92, 0x33, 0x71, 0x12, 0x8e, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xcf, 0x43, 0xb2, 0x43, 0xb2, 0x4b, 0xd3, 0x4b, 0xd3, 0x5c, 0x14, 0x7c, 0xd6, 0x54, 0x13, 0x0a, 0x4e, 0x01, 0xed, 0x0a, 0x2e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x22, 0xd0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x22, 0xaf, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x22, 0xcf, 0x22, 0xef, 0x3b, 0x71, 0x54, 0x13, 0x85, 0x16, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x6f, 0x2a, 0xf1, 0x9d, 0x57, 
-  0x85, 0x16, 0x22, 0xcf, 0x1a, 0x90, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xde, 0xdb, 0x85, 0x16, 0x6c, 0x94, 0x43, 0x92, 0x33, 0x10, 0x22, 0xaf, 0x12, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x43, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x7c, 0xb5, 0x7c, 0xb5, 0x7c, 0xb5, 0x7c, 0xb5, 0x7c, 0xb5, 0x7c, 0xb5, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x85, 0x16, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x95, 0x77, 0x9d, 0x57, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x7c, 0xb5, 0x2b, 0x10, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x2a, 0xf0, 0x22, 0xcf, 0x22, 0xaf, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x4e, 0x64, 0x34, 0xbd, 0xfa, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0x9d, 0x16, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xcf, 0x3b, 0x51, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x85, 0x16, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x8f, 0x1a, 0xb0, 0x7c, 0xd5, 
-  0x7c, 0xd6, 0x1a, 0x90, 0x22, 0xf0, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x7c, 0xb5, 0x64, 0x33, 0x43, 0x92, 0x2b, 0x10, 0x1a, 0x8f, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x43, 0x91, 0x22, 0xaf, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x2a, 0xf0, 0x12, 0x8e, 0x1a, 0x6e, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xcf, 0x0a, 0x2e, 0x01, 0xed, 0x1a, 0xaf, 0x33, 0x30, 0x3b, 0x51, 0x3b, 0x51, 0x3b, 0x51, 0x3b, 0x51, 0x3b, 0x51, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xd2, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x3b, 0x51, 0x0a, 0x4e, 0x02, 0x0d, 0x22, 0xcf, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x33, 0x10, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x33, 0x31, 0x2a, 0xf0, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2a, 0xf0, 0x12, 0x8f, 0x6c, 0x94, 
-  0x5c, 0x34, 0x12, 0x6f, 0x2b, 0x11, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x7c, 0xb5, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x2d, 0x0a, 0x2e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2e, 0x2b, 0x11, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x1a, 0xcf, 0x4b, 0xf2, 0x43, 0xb2, 0x33, 0x31, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0x8f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x22, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x6c, 0x94, 0x43, 0x91, 0x5c, 0x34, 0x74, 0xb5, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x33, 0x10, 0x12, 0x6f, 0x5c, 0x34, 
-  0x4b, 0xd2, 0x0a, 0x4f, 0x33, 0x31, 0xef, 0x5d, 0x00, 0x00, 0xbe, 0xfb, 0x95, 0x36, 0x9d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x2a, 0xf0, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x1a, 0x8f, 0x01, 0xed, 0x22, 0xcf, 0x54, 0x13, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x4b, 0xb2, 0x43, 0x71, 0x4b, 0xb2, 0x43, 0x71, 0x43, 0x91, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x3b, 0x51, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x33, 0x31, 0x02, 0x0d, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x22, 0xaf, 0x54, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x0a, 0x2e, 0x12, 0x4e, 0x1a, 0x8f, 0x2b, 0x10, 0x3b, 0x71, 0x53, 0xd2, 0x7c, 0xd5, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x92, 0x12, 0x6f, 0x53, 0xf3, 
-  0x3b, 0x51, 0x0a, 0x4f, 0x33, 0x30, 0xff, 0xff, 0x00, 0x00, 0x95, 0x36, 0x33, 0x10, 0x2b, 0x10, 0x43, 0x91, 0x7c, 0xd5, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xff, 0xff, 0x8c, 0xf6, 0x2a, 0xf0, 0x02, 0x0d, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xcf, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd2, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x0a, 0x4e, 0x1a, 0x8f, 0x2a, 0xf0, 0x33, 0x51, 0x53, 0xf3, 0x64, 0x54, 0x95, 0x36, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x43, 0xb2, 
-  0x3b, 0x71, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x74, 0xb5, 0x12, 0x6e, 0x01, 0xed, 0x0a, 0x2d, 0x22, 0xaf, 0x3b, 0x51, 0x4b, 0xd2, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x10, 0x02, 0x0d, 0x1a, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x51, 0x02, 0x0d, 0x12, 0x8e, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2a, 0xf0, 0x33, 0x31, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x5c, 0x34, 0x3b, 0x71, 0x1a, 0xaf, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x12, 0x8e, 0x22, 0xcf, 0x54, 0x13, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x43, 0x71, 0x0a, 0x4f, 0x33, 0x31, 
-  0x3b, 0x92, 0x0a, 0x4f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x71, 0x1a, 0xaf, 0x0a, 0x2e, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x4e, 0x22, 0xaf, 0x3b, 0x51, 0x64, 0x33, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x22, 0xcf, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x1a, 0x8f, 0x02, 0x0d, 0x2b, 0x31, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x5c, 0x13, 0x2b, 0x10, 0x43, 0x92, 0x43, 0xb2, 0x0a, 0x6e, 0x0a, 0x6e, 0x0a, 0x6e, 0x0a, 0x6e, 0x0a, 0x6e, 0x0a, 0x6e, 0x33, 0x51, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x3b, 0x71, 0x43, 0xb2, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x43, 0xb2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x33, 0x51, 0x0a, 0x6e, 0x2b, 0x10, 0x64, 0x33, 0xbd, 0xfa, 0xff, 0xff, 0x43, 0x71, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x2b, 0x10, 0x2b, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x71, 0x02, 0x0d, 0x12, 0x8e, 0x4b, 0xf2, 0x33, 0x31, 0x2a, 0xf0, 0x22, 0xaf, 0x0a, 0x2d, 0x01, 0xed, 0x02, 0x0d, 0x2a, 0xf0, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x0a, 0x4f, 0x22, 0xf0, 
-  0x3b, 0x92, 0x12, 0x6f, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xde, 0xdb, 0x7c, 0xb5, 0x4b, 0xb2, 0x33, 0x10, 0x1a, 0x8f, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x6e, 0x22, 0xcf, 0x43, 0x92, 0x6c, 0x94, 0x9d, 0x16, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x22, 0xcf, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x2e, 0x12, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x22, 0xcf, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0x2d, 0x22, 0xcf, 0x64, 0x34, 0xef, 0x5d, 0x85, 0x16, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x33, 0x31, 0x2b, 0x10, 0xad, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0xb2, 0x0a, 0x2d, 0x1a, 0x8f, 0x7c, 0xf6, 0xb5, 0xd9, 0x6c, 0x94, 0x43, 0x92, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6f, 0x2b, 0x32, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x74, 0xb5, 0x4b, 0xb2, 0x2b, 0x10, 0x1a, 0x6e, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x6e, 0x43, 0xb2, 0xbd, 0xfa, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2b, 0x10, 0x02, 0x0d, 0x22, 0xaf, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x33, 0x31, 0x02, 0x0d, 0x12, 0x6e, 0x43, 0xb2, 0x4b, 0xd3, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xf2, 0x4b, 0xd3, 0x4b, 0xb2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x54, 0x13, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x4b, 0xd2, 0x54, 0x13, 0x4b, 0xf2, 0x12, 0x4e, 0x0a, 0x2d, 0x2a, 0xf0, 0x64, 0x74, 0xff, 0xff, 0xde, 0xdb, 0x3b, 0x71, 0x0a, 0x2d, 0x12, 0x6e, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x71, 0x0a, 0x2d, 0x12, 0x6e, 0x3b, 0x92, 0x2b, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x2b, 0x11, 0x95, 0x77, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x2b, 0x52, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x7c, 0xd6, 0x5c, 0x14, 0x2b, 0x11, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x33, 0x10, 0xde, 0xdb, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x51, 0x2a, 0xf0, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x8e, 0x0a, 0x2d, 0x3b, 0x71, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x33, 0x10, 0x0a, 0x2d, 0x1a, 0xaf, 0x54, 0x13, 0xbe, 0x59, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xfa, 0xbd, 0xfa, 0xb6, 0x39, 0xb6, 0x39, 0xb6, 0x39, 0xb6, 0x39, 0xa5, 0xd8, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x8c, 0xf6, 0x7c, 0xd5, 0x7c, 0xd5, 0x7c, 0xd5, 0x7c, 0xd5, 0x7c, 0xd5, 0x95, 0x36, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x34, 0x22, 0xaf, 0x0a, 0x2e, 0x33, 0x10, 0x85, 0x16, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xd2, 0x22, 0xcf, 0x8d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x43, 0x92, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x1a, 0x8f, 0x3b, 0x71, 0x64, 0x74, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x85, 0x16, 0x53, 0xf3, 0x43, 0x91, 0x3b, 0x51, 0x22, 0xcf, 0x22, 0xaf, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x22, 0xd0, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x43, 0x92, 0x0a, 0x2d, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x71, 0x12, 0x6e, 0x12, 0x6e, 0x3b, 0x51, 0x9d, 0x16, 0xa5, 0xd7, 0x43, 0x92, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xf1, 0x6c, 0x95, 0xde, 0xdb, 0x64, 0x54, 0x1a, 0xaf, 0x0a, 0x4e, 0x3b, 0x71, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x33, 0x22, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x4b, 0xb2, 0x22, 0xef, 0x12, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x22, 0xef, 0x4b, 0xb2, 0x7c, 0xd5, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf6, 0x33, 0x10, 0x22, 0xcf, 0x12, 0x6e, 0x0a, 0x2e, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x4e, 0x22, 0xcf, 0x5c, 0x33, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xef, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x53, 0xd2, 0x12, 0x8e, 0x1a, 0x6e, 0x5c, 0x53, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x8e, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x1a, 0xaf, 0x4b, 0xb2, 0xa5, 0xd7, 0xff, 0xff, 0x54, 0x13, 0x12, 0x4e, 0x3b, 0x51, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x0a, 0x2d, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd2, 0x22, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x22, 0xd0, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x1a, 0x8f, 0x33, 0x31, 0x64, 0x33, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x0a, 0x4e, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x6e, 0x22, 0xcf, 0x2b, 0x10, 0x4b, 0xb2, 0x64, 0x74, 0x95, 0x77, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x22, 0xd0, 0x1a, 0x8f, 0x2a, 0xf0, 0x22, 0xd0, 0x2b, 0x10, 0x33, 0x51, 0x33, 0x51, 0x33, 0x51, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x2a, 0xf0, 0x2a, 0xf0, 0x2a, 0xf0, 0x22, 0xcf, 0x22, 0xcf, 0x2a, 0xf0, 0x43, 0xb2, 0x8c, 0xf6, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x1a, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x33, 0x31, 0x02, 0x0d, 0x12, 0x6e, 0x22, 0xef, 0x43, 0x91, 0x7c, 0xd5, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xd2, 0x0a, 0x4e, 0x0a, 0x2d, 0x12, 0x6e, 0x22, 0xcf, 0x2b, 0x31, 0x4b, 0xb2, 0x64, 0x33, 0x8d, 0x76, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x33, 0x51, 0x0a, 0x2d, 0x12, 0x8e, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0x95, 0x77, 0x9d, 0x97, 0x8d, 0x16, 0x7c, 0xf6, 0x9d, 0x97, 0x9d, 0x97, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xd8, 0xbe, 0x59, 0x7c, 0xb5, 0x64, 0x74, 0x5c, 0x34, 0x54, 0x13, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x4b, 0xb2, 0x5c, 0x34, 0x7c, 0xf6, 0x9d, 0x97, 0x95, 0x77, 0xad, 0xd8, 0x95, 0x36, 0xad, 0xd8, 0xad, 0xd8, 0x95, 0x36, 0xad, 0xd8, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x1a, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x3b, 0x51, 0x5c, 0x34, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0xff, 0xff, 0x64, 0x95, 0x3b, 0x92, 0x4b, 0xb2, 0x6c, 0x94, 0x8d, 0x76, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xaf, 0x02, 0x0d, 0x2b, 0x10, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0xbd, 0xfa, 0x85, 0x16, 0x95, 0x36, 0xa5, 0xd8, 0xb5, 0xd9, 0xb5, 0xd9, 0xa5, 0xd8, 0x95, 0x36, 0x7c, 0xb5, 0x5c, 0x13, 0x53, 0xf3, 0x53, 0xf3, 0x43, 0xb2, 0x33, 0x71, 0x33, 0x31, 0x2b, 0x11, 0x2b, 0x11, 0x33, 0x71, 0x4b, 0xb2, 0x64, 0x33, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x64, 0x33, 0x43, 0xb2, 0x33, 0x31, 0x2b, 0x11, 0x2b, 0x11, 0x22, 0xf0, 0x2b, 0x32, 0x2b, 0x32, 0x2b, 0x32, 0x22, 0xf1, 0x2b, 0x11, 0x2b, 0x11, 0x33, 0x31, 0x43, 0x92, 0x53, 0xf3, 0x5c, 0x33, 0x33, 0x30, 0x22, 0xef, 0x54, 0x13, 0x5c, 0x33, 0x5c, 0x34, 0x8d, 0x75, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0xbd, 0xfa, 0x3b, 0x71, 0x0a, 0x2d, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x1a, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8f, 0x2b, 0x11, 
-  0x33, 0x31, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x33, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x0a, 0x2e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0xbd, 0xfa, 0x4b, 0xb2, 0x3b, 0x51, 0x6c, 0x94, 0x2b, 0x32, 0x22, 0xd0, 0x2b, 0x52, 0x2b, 0x52, 0x2b, 0x52, 0x2b, 0x52, 0x2a, 0xf1, 0x2b, 0x10, 0x2b, 0x11, 0x22, 0xf1, 0x2b, 0x52, 0x2b, 0x11, 0x3b, 0x71, 0x43, 0x71, 0x4b, 0xb2, 0x43, 0x92, 0x33, 0x71, 0x2b, 0x11, 0x2b, 0x11, 0x33, 0x31, 0x53, 0xd2, 0x95, 0x36, 0x64, 0x33, 0x22, 0xf1, 0x2a, 0xf1, 0x43, 0xb2, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x6c, 0x95, 0x5c, 0x34, 0x5c, 0x34, 0x7c, 0xb5, 0x64, 0x33, 0x53, 0xf3, 0x3b, 0x71, 0x2b, 0x32, 0x2b, 0x52, 0x2b, 0x52, 0x2a, 0xf1, 0x2a, 0xf1, 0x22, 0xf0, 0x22, 0xf1, 0x22, 0xcf, 0x6c, 0x94, 0x6c, 0x94, 0x95, 0x36, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x1a, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0xa5, 0xd8, 0x64, 0x33, 0x64, 0x33, 0x54, 0x13, 0x8d, 0x16, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x2b, 0x52, 
-  0x3b, 0x92, 0x12, 0x6f, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x22, 0xcf, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x2b, 0x31, 0x02, 0x0d, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x7c, 0xf5, 0x43, 0x92, 0x12, 0x4e, 0x12, 0x6e, 0x5c, 0x33, 0x2b, 0x11, 0x4b, 0xf3, 0x54, 0x13, 0x4b, 0xb2, 0x4b, 0xb2, 0x54, 0x13, 0x53, 0xf3, 0x4b, 0xd2, 0x64, 0x74, 0x8d, 0x16, 0x95, 0x77, 0x7c, 0xf5, 0x74, 0x94, 0x7c, 0xf6, 0x6c, 0x94, 0x7c, 0xb5, 0x95, 0x77, 0x95, 0x77, 0x54, 0x13, 0x33, 0x10, 0x22, 0xcf, 0x43, 0x92, 0x43, 0x92, 0x33, 0x31, 0x64, 0x34, 0x43, 0xb2, 0x2b, 0x10, 0x2b, 0x11, 0x22, 0xf1, 0x2b, 0x31, 0x2b, 0x11, 0x22, 0xf1, 0x2b, 0x10, 0x33, 0x31, 0x3b, 0x71, 0x53, 0xf3, 0x7c, 0xf6, 0x8d, 0x16, 0x95, 0x77, 0x95, 0x36, 0x8d, 0x76, 0x85, 0x16, 0x6c, 0x94, 0x22, 0xf1, 0x5c, 0x14, 0x2a, 0xf0, 0x2b, 0x10, 0x7c, 0xf5, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0x85, 0x16, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xcf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd2, 0x22, 0xaf, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd7, 0x85, 0x16, 0x6c, 0x94, 0x54, 0x13, 0x43, 0x91, 0x2b, 0x31, 0x22, 0xef, 0x1a, 0x8f, 0x12, 0x6e, 0x12, 0x8e, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x0a, 0x4f, 0x2b, 0x32, 
-  0x3b, 0x92, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x2a, 0xf0, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x1a, 0xaf, 0x02, 0x0d, 0x33, 0x10, 0xa5, 0xd8, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x7c, 0xd6, 0x22, 0xcf, 0x01, 0xed, 0x12, 0x6e, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x54, 0x13, 0x43, 0x92, 0x54, 0x13, 0x53, 0xf3, 0x6c, 0x74, 0xff, 0xff, 0x8d, 0x76, 0x43, 0xb2, 0x2b, 0x11, 0x2b, 0x31, 0x2b, 0x10, 0x2b, 0x11, 0x2b, 0x31, 0x2b, 0x11, 0x2b, 0x11, 0x3b, 0x71, 0x54, 0x13, 0x9d, 0x97, 0x3b, 0x92, 0x33, 0x71, 0x4b, 0xd2, 0x1a, 0x8f, 0x2b, 0x11, 0x2b, 0x10, 0x43, 0x92, 0x54, 0x13, 0x64, 0x33, 0x7c, 0xb5, 0x7c, 0xd5, 0x64, 0x33, 0x4b, 0xb2, 0x43, 0xb2, 0x33, 0x31, 0x22, 0xf1, 0x22, 0xf1, 0x2a, 0xf1, 0x33, 0x10, 0x43, 0x92, 0x4b, 0xb2, 0x7c, 0xb5, 0x95, 0x77, 0x33, 0x51, 0x4b, 0xd3, 0x22, 0xaf, 0x02, 0x0d, 0x43, 0xb2, 0x5c, 0x14, 0x12, 0x6e, 0x4b, 0xb2, 0x3b, 0x51, 0x0a, 0x2d, 0x12, 0x6e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x22, 0xcf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x74, 0xb5, 0x53, 0xf3, 0x3b, 0x71, 0x2b, 0x10, 0x22, 0xcf, 0x12, 0x8e, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x12, 0x8e, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x0a, 0x4f, 0x22, 0xf0, 
-  0x3b, 0x71, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xbe, 0x59, 0xa5, 0xd8, 0x7c, 0xb5, 0x33, 0x30, 0x5c, 0x13, 0x5c, 0x34, 0x64, 0x74, 0xa5, 0xd7, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x2a, 0xf0, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x2e, 0x43, 0x71, 0x85, 0x16, 0x2a, 0xf0, 0x1a, 0x6e, 0x64, 0x74, 0x1a, 0xaf, 0x01, 0xed, 0x12, 0x6e, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x54, 0x13, 0x2b, 0x11, 0x22, 0xf1, 0x2b, 0x11, 0x43, 0xb2, 0xbd, 0xfa, 0x7c, 0xd6, 0x3b, 0x51, 0x33, 0x51, 0x4b, 0xb2, 0x5c, 0x34, 0x64, 0x54, 0x5c, 0x13, 0x54, 0x13, 0x43, 0x92, 0x33, 0x31, 0x22, 0xf1, 0x3b, 0x51, 0x43, 0x92, 0x2b, 0x31, 0x43, 0x92, 0x12, 0x8f, 0x43, 0x91, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x7c, 0xd5, 0x54, 0x13, 0x43, 0x92, 0x3b, 0x92, 0x33, 0x31, 0x2b, 0x52, 0x6c, 0x95, 0xad, 0xd8, 0x33, 0x31, 0x4b, 0xb2, 0x1a, 0x8f, 0x02, 0x0d, 0x33, 0x31, 0x5c, 0x14, 0x12, 0x6e, 0x3b, 0x92, 0x12, 0x8e, 0x0a, 0x2d, 0x3b, 0x71, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xd2, 0x22, 0xcf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x0a, 0x2e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x4e, 0x1a, 0x6e, 0x33, 0x31, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x43, 0x71, 0x0a, 0x4f, 0x3b, 0x71, 
-  0x43, 0x92, 0x0a, 0x4f, 0x33, 0x30, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x54, 0x64, 0x74, 0x54, 0x13, 0x4b, 0xd2, 0x3b, 0x71, 0x2b, 0x31, 0x3b, 0x51, 0x22, 0xf0, 0x22, 0xcf, 0x12, 0x8f, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xf0, 0x95, 0x36, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x22, 0xcf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x33, 0x10, 0x02, 0x0d, 0x1a, 0xaf, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x64, 0x34, 0x1a, 0x8f, 0x01, 0xed, 0x12, 0x8e, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0xff, 0xff, 0xa5, 0xd8, 0x7c, 0xf5, 0x8d, 0x16, 0x95, 0x36, 0x95, 0x36, 0x6c, 0x94, 0x7c, 0xd6, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x64, 0x34, 0x5c, 0x34, 0x8c, 0xf6, 0x64, 0x74, 0x4b, 0xd2, 0x4b, 0xd3, 0x2b, 0x31, 0x43, 0x92, 0x2b, 0x11, 0xad, 0xd8, 0x00, 0x00, 0x74, 0xb5, 0x53, 0xf3, 0x4b, 0xb2, 0x64, 0x74, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x6c, 0x94, 0x5c, 0x33, 0x64, 0x33, 0xbe, 0x59, 0xef, 0x5d, 0xbd, 0xfa, 0xa5, 0xd8, 0xbd, 0xfa, 0xbd, 0xfa, 0x2b, 0x31, 0x4b, 0xd3, 0x2a, 0xf0, 0x01, 0xed, 0x2b, 0x10, 0x5c, 0x34, 0x0a, 0x2e, 0x0a, 0x2d, 0x02, 0x0d, 0x22, 0xcf, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x8e, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x6e, 0x1a, 0x8f, 0x22, 0xaf, 0x33, 0x10, 0x3b, 0x71, 0x4b, 0xb2, 0x5c, 0x34, 0x7c, 0xd5, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x43, 0xb2, 
-  0x54, 0x13, 0x0a, 0x4f, 0x2b, 0x31, 0xef, 0x5d, 0x00, 0x00, 0x95, 0x36, 0x2a, 0xf1, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x2e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x1a, 0x8f, 0x7c, 0xf5, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x1a, 0x8f, 0x02, 0x0d, 0x3b, 0x51, 0x33, 0x31, 0x1a, 0x6e, 0x53, 0xf3, 0x12, 0x8e, 0x02, 0x0d, 0x12, 0x8e, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x97, 0x4b, 0xd3, 0x22, 0xaf, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x33, 0x51, 0x54, 0x13, 0x3b, 0x51, 0x33, 0x10, 0x7c, 0xb5, 0xff, 0xff, 0x43, 0x91, 0x2b, 0x31, 0x43, 0x92, 0x2b, 0x11, 0x95, 0x36, 0x7c, 0xf5, 0x5c, 0x34, 0x3b, 0x92, 0x22, 0xcf, 0x1a, 0xaf, 0x53, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xb2, 0x2b, 0x10, 0x43, 0x92, 0x33, 0x51, 0x4b, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x71, 0x4b, 0xd3, 0x3b, 0x51, 0x22, 0xf0, 0x2a, 0xf0, 0x5c, 0x34, 0x0a, 0x2d, 0x01, 0xed, 0x12, 0x6e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x2b, 0x10, 0xad, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x12, 0x4e, 0x43, 0x92, 0x64, 0x95, 0x95, 0x77, 0xbd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x92, 0x12, 0x6f, 0x53, 0xf3, 
-  0x5c, 0x34, 0x12, 0x6f, 0x33, 0x31, 0xbe, 0x59, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xd0, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x1a, 0x8f, 0x22, 0xcf, 0x3b, 0x92, 0x8c, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x22, 0xcf, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x0a, 0x4e, 0x0a, 0x4e, 0x12, 0x6e, 0x12, 0x6e, 0x5c, 0x14, 0x12, 0x6e, 0x4b, 0xd2, 0x22, 0xaf, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x64, 0x34, 0x12, 0x6e, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xb5, 0x22, 0xef, 0x33, 0x10, 0xde, 0xdb, 0x64, 0x74, 0x1a, 0x8f, 0x3b, 0x71, 0xff, 0xff, 0x2b, 0x10, 0x33, 0x10, 0x4b, 0xb2, 0x2b, 0x11, 0x95, 0x77, 0x7c, 0xb5, 0x7c, 0xf6, 0xde, 0xdb, 0x5c, 0x34, 0x12, 0x6e, 0x33, 0x10, 0xef, 0x5d, 0x74, 0xb5, 0x2a, 0xf0, 0x33, 0x10, 0xbe, 0x59, 0x3b, 0x71, 0x1a, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x71, 0x4b, 0xd3, 0x3b, 0x51, 0x4b, 0xd2, 0x33, 0x31, 0x4b, 0xf3, 0x0a, 0x2d, 0x02, 0x0d, 0x3b, 0x71, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x10, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x33, 0x31, 0x1a, 0x8f, 0x0a, 0x2d, 0x02, 0x0d, 0x0a, 0x2e, 0x1a, 0xaf, 0x3b, 0x51, 0x64, 0x33, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x33, 0x10, 0x12, 0x6f, 0x5c, 0x34, 
-  0x7c, 0xd6, 0x1a, 0x90, 0x22, 0xf0, 0x9d, 0x57, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x71, 0x1a, 0x8f, 0x22, 0xf1, 0x2b, 0x11, 0x3b, 0x92, 0x3b, 0x71, 0x43, 0x92, 0x53, 0xf3, 0x5c, 0x34, 0x7c, 0xf6, 0x74, 0xb5, 0x9d, 0x57, 0x9d, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x1a, 0xaf, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x2b, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x6e, 0x4b, 0xf2, 0x12, 0x6e, 0x4b, 0xd2, 0x1a, 0x8f, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x22, 0xaf, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x5c, 0x53, 0x1a, 0x8f, 0x33, 0x10, 0xde, 0xdb, 0x7c, 0xf5, 0x22, 0xaf, 0x2b, 0x10, 0xbe, 0x59, 0x2b, 0x10, 0x3b, 0x72, 0x4b, 0xf2, 0x2b, 0x11, 0x95, 0x36, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xf6, 0x1a, 0x8f, 0x3b, 0x51, 0xef, 0x5d, 0x53, 0xf3, 0x12, 0x8e, 0x4b, 0xd3, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x71, 0x4b, 0xd3, 0x33, 0x31, 0x2b, 0x11, 0x4b, 0xf3, 0x5c, 0x34, 0x0a, 0x4e, 0x22, 0xaf, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2a, 0xf0, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x6c, 0x94, 0x43, 0x92, 0x22, 0xcf, 0x0a, 0x4e, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x6e, 0x2b, 0x10, 0x53, 0xf3, 0x7c, 0xd5, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2a, 0xf0, 0x12, 0x8f, 0x6c, 0x94, 
-  0x85, 0x16, 0x22, 0xcf, 0x1a, 0x90, 0x7c, 0xd5, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x85, 0x16, 0x8d, 0x76, 0xbe, 0x59, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x2a, 0xf0, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x8e, 0x01, 0xed, 0x12, 0x6e, 0x5c, 0x33, 0x22, 0xcf, 0x22, 0xf0, 0x12, 0x8e, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x22, 0xaf, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x9d, 0x57, 0x2b, 0x10, 0x1a, 0x8f, 0x54, 0x13, 0x8d, 0x16, 0x1a, 0xaf, 0x22, 0xd0, 0xbe, 0x59, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x22, 0xcf, 0x53, 0xf3, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x43, 0x71, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6e, 0x43, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x71, 0x3b, 0x92, 0x3b, 0x92, 0x5c, 0x33, 0xad, 0xd8, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x22, 0xcf, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x33, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x1a, 0xaf, 0x3b, 0x71, 0x7c, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x8f, 0x1a, 0xb0, 0x7c, 0xd5, 
-  0xa5, 0xd8, 0x2b, 0x10, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x0a, 0x2d, 0x1a, 0x6e, 0x74, 0xb5, 0x7c, 0xb5, 0x53, 0xf3, 0x1a, 0xaf, 0x53, 0xf3, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x22, 0xaf, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x3b, 0x92, 0x4b, 0xd3, 0x6c, 0x95, 0x1a, 0x8f, 0x3b, 0x51, 0xde, 0xdb, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x3b, 0x92, 0x43, 0x92, 0xa5, 0xd7, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6e, 0x43, 0x71, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6e, 0x43, 0xb2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x71, 0x3b, 0x92, 0x4b, 0xf3, 0x6c, 0x94, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xd2, 0x22, 0xaf, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x64, 0x54, 0x3b, 0x71, 0x1a, 0xaf, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x6f, 0x2a, 0xf1, 0xa5, 0xd8, 
-  0xef, 0x5d, 0x3b, 0x71, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x64, 0x33, 0x74, 0x94, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x33, 0x30, 0x22, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x1a, 0xaf, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x8d, 0x76, 0x33, 0x51, 0x5c, 0x14, 0x2b, 0x11, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd6, 0x22, 0xaf, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xde, 0xdb, 0xb5, 0xd9, 0x43, 0x92, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x95, 0x36, 0x00, 0x00, 0xa5, 0xd7, 0x54, 0x13, 0x5c, 0x34, 0xa5, 0xd8, 0xde, 0xdb, 0xde, 0xdb, 0x5c, 0x34, 0x1a, 0x8f, 0x4b, 0xd3, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x92, 0x3b, 0x92, 0x43, 0x92, 0x6c, 0x94, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x22, 0xaf, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x7c, 0xd5, 0x4b, 0xb2, 0x22, 0xef, 0x22, 0xcf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6f, 0x3b, 0x71, 0xde, 0xdb, 
-  0xff, 0xff, 0x4b, 0xd2, 0x0a, 0x4f, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x74, 0xb5, 0x54, 0x13, 0x3b, 0x71, 0x22, 0xef, 0x12, 0x6e, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x22, 0xaf, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xad, 0xd8, 0x3b, 0x72, 0x4b, 0xf2, 0x2b, 0x11, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd6, 0x22, 0xaf, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xcf, 0x33, 0x31, 0xbe, 0x59, 0x00, 0x00, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x95, 0x36, 0xa5, 0xd7, 0x43, 0x92, 0x43, 0x92, 0x6c, 0x94, 0x6c, 0x94, 0x5c, 0x14, 0x7c, 0xf6, 0x85, 0x16, 0x22, 0xcf, 0x33, 0x31, 0xde, 0xdb, 0x3b, 0x71, 0x22, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x4b, 0xf3, 0x3b, 0x72, 0x3b, 0x72, 0x64, 0x33, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x33, 0x10, 0x2b, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x7c, 0xb5, 0x95, 0x77, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 
-  0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x2b, 0x11, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x6c, 0x94, 0x43, 0x71, 0x2b, 0x31, 0x1a, 0xaf, 0x12, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x01, 0xed, 0x12, 0x6e, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x22, 0xaf, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xa5, 0xd8, 0x3b, 0x51, 0x43, 0xb2, 0x33, 0x51, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x43, 0x92, 0x1a, 0x8f, 0x33, 0x10, 0x7c, 0xb5, 0xbe, 0xfb, 0xff, 0xff, 0x8d, 0x75, 0x64, 0x74, 0x3b, 0x51, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x95, 0x77, 0x53, 0xf3, 0x1a, 0xb0, 0x1a, 0xb0, 0x2b, 0x11, 0x22, 0xf1, 0x2b, 0x52, 0x7c, 0xd5, 0xff, 0xff, 0x4b, 0xb2, 0x2b, 0x10, 0x4b, 0xd3, 0x33, 0x51, 0x43, 0x92, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x3b, 0x72, 0x33, 0x51, 0x5c, 0x53, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x4b, 0xd2, 0x64, 0x54, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x31, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 
-  0x00, 0x00, 0x7c, 0xb5, 0x1a, 0x8f, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x53, 0xf3, 0x3b, 0x71, 0x2b, 0x10, 0x12, 0x8e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xcf, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2a, 0xf0, 0x2b, 0x31, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x10, 0x53, 0xd2, 0x33, 0x31, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x6c, 0x74, 0x53, 0xf3, 0x64, 0x33, 0x8d, 0x16, 0xff, 0xff, 0xbe, 0x59, 0x6c, 0x95, 0x5c, 0x34, 0x5c, 0x34, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x9d, 0x97, 0x7c, 0xf6, 0x5c, 0x34, 0x5c, 0x33, 0x5c, 0x14, 0x5c, 0x33, 0x7c, 0xf6, 0xde, 0xdb, 0x00, 0x00, 0xa5, 0xd7, 0x53, 0xf3, 0x4b, 0xb2, 0x5c, 0x34, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xcf, 0x3b, 0x72, 0x43, 0x92, 0x5c, 0x53, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xcf, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x51, 0x0a, 0x4e, 0x12, 0x8e, 0x2a, 0xf0, 0x43, 0x92, 0x64, 0x74, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x1a, 0x90, 0x7c, 0xf5, 0x00, 0x00, 
-  0x00, 0x00, 0xa5, 0xd7, 0x2a, 0xf1, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0xde, 0xdb, 0x4b, 0xf2, 0x12, 0x6e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x4e, 0x22, 0xaf, 0x33, 0x31, 0x0a, 0x2d, 0x01, 0xed, 0x02, 0x0d, 0x1a, 0xaf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x22, 0xaf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x3b, 0x72, 0x33, 0x31, 0x64, 0x95, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x16, 0x5c, 0x53, 0x6c, 0x74, 0x64, 0x34, 0x5c, 0x34, 0x64, 0x33, 0x7c, 0xd6, 0x7c, 0xb5, 0xbe, 0xfb, 0x00, 0x00, 0x43, 0x91, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x31, 0x4b, 0xf2, 0x33, 0x31, 0x2a, 0xf0, 0x22, 0xcf, 0x22, 0xf1, 0x22, 0xcf, 0x2b, 0x10, 0x3b, 0x51, 0x53, 0xf3, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x1a, 0xcf, 0x3b, 0x51, 0x3b, 0x51, 0x5c, 0x53, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x1a, 0xaf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xaf, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x2d, 0x12, 0x6e, 0x22, 0xcf, 0x3b, 0x71, 0x54, 0x13, 0x85, 0x16, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x12, 0x6f, 0x22, 0xf0, 0xa5, 0xd8, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x4b, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x43, 0x71, 0x0a, 0x4e, 0x12, 0x6e, 0x22, 0xef, 0x3b, 0x71, 0x5c, 0x34, 0x64, 0x95, 0x2a, 0xf0, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0xaf, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xaf, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x3b, 0x72, 0x33, 0x31, 0x64, 0x95, 0xb5, 0xd9, 0x4b, 0xb2, 0x4b, 0xb2, 0x64, 0x33, 0x7c, 0xd5, 0x64, 0x33, 0x43, 0x71, 0x3b, 0x51, 0x33, 0x31, 0x22, 0xf1, 0x2b, 0x31, 0x2b, 0x31, 0x2b, 0x11, 0x2b, 0x31, 0x2b, 0x11, 0x22, 0xf0, 0x3b, 0x71, 0x64, 0x54, 0x4b, 0xb2, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x4b, 0xf3, 0x33, 0x30, 0x53, 0xf3, 0x5c, 0x13, 0x64, 0x33, 0x53, 0xf3, 0x43, 0x92, 0x2b, 0x10, 0x22, 0xd0, 0x2b, 0x10, 0x33, 0x51, 0x54, 0x13, 0x64, 0x33, 0x64, 0x33, 0x43, 0x71, 0x33, 0x71, 0x5c, 0x14, 0xbd, 0xfa, 0x00, 0x00, 0x1a, 0xcf, 0x33, 0x71, 0x4b, 0xf2, 0x5c, 0x53, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2b, 0x10, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x12, 0x6e, 0x02, 0x0d, 0x0a, 0x2e, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x6e, 0x22, 0xcf, 0x33, 0x31, 0x53, 0xd2, 0x7c, 0xb5, 0xbe, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x0a, 0x4f, 0x33, 0x10, 0xb6, 0x39, 0x00, 0x00, 0x7c, 0xd5, 0x5c, 0x33, 0x64, 0x74, 0xa5, 0xd8, 0xff, 0xff, 0x64, 0x74, 0x22, 0xcf, 0x02, 0x0d, 0x02, 0x0d, 0x1a, 0xaf, 0x5c, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x77, 0x2a, 0xf0, 0x3b, 0x51, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x53, 0xd2, 0x33, 0x31, 0x64, 0x95, 0xbe, 0x59, 0x4b, 0xd3, 0x2b, 0x31, 0x2b, 0x31, 0x2b, 0x31, 0x22, 0xf1, 0x22, 0xf1, 0x33, 0x31, 0x43, 0x92, 0x54, 0x13, 0x6c, 0x94, 0x7c, 0xd6, 0x6c, 0x54, 0x6c, 0x94, 0x53, 0xf3, 0x4b, 0xb2, 0x33, 0x31, 0x22, 0xf1, 0x2a, 0xf0, 0x33, 0x31, 0x5c, 0x34, 0x2b, 0x11, 0x8c, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb5, 0xd9, 0x64, 0x33, 0x3b, 0x51, 0x2b, 0x10, 0x2a, 0xf0, 0x22, 0xf0, 0x22, 0xf1, 0x2b, 0x31, 0x33, 0x71, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x1a, 0xcf, 0x33, 0x71, 0x95, 0x77, 0xa5, 0xd7, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x22, 0xaf, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x51, 0x02, 0x0d, 0x0a, 0x4e, 0x4b, 0xd3, 0x43, 0xb2, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x33, 0x31, 0x8d, 0x76, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x71, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x90, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xcf, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x8c, 0xf6, 0xbe, 0xfb, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xbd, 0xfa, 0x4b, 0xd3, 0x4b, 0xf2, 0x33, 0x51, 0x64, 0x95, 0x00, 0x00, 0xef, 0x5d, 0x7c, 0xf5, 0x6c, 0x94, 0x54, 0x13, 0x64, 0x74, 0x7c, 0xd5, 0xb5, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x54, 0x13, 0x22, 0xf1, 0x2b, 0x11, 0x5c, 0x34, 0x2b, 0x11, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x6c, 0x54, 0x6c, 0x54, 0x6c, 0x54, 0x85, 0x16, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xcf, 0x3b, 0x72, 0xad, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x22, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x02, 0x0d, 0x22, 0xcf, 0x95, 0x36, 0xff, 0xff, 0x53, 0xf3, 0x0a, 0x2e, 0x0a, 0x2d, 0x2a, 0xf0, 0x1a, 0x6e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x95, 0x36, 0x22, 0xd0, 0x12, 0x8f, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x2b, 0x10, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xcf, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xaf, 0x64, 0x34, 0xbe, 0x59, 0x7c, 0xd5, 0x53, 0xf3, 0x3b, 0x51, 0x22, 0xcf, 0x2b, 0x10, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xbe, 0xfb, 0x54, 0x13, 0x5c, 0x14, 0x2b, 0x11, 0x64, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x75, 0x8d, 0x75, 0x8d, 0x75, 0x8d, 0x75, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x11, 0x85, 0x16, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0xb6, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1a, 0xcf, 0x3b, 0x72, 0xad, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2a, 0xf0, 0x2b, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6e, 0x02, 0x0d, 0x33, 0x31, 0xef, 0x5d, 0xef, 0x5d, 0x33, 0x31, 0x02, 0x0d, 0x1a, 0x8f, 0x7c, 0xf6, 0x7c, 0xf5, 0x33, 0x10, 0x02, 0x0d, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x2a, 0xf1, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x2a, 0xf0, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x5c, 0x34, 0x4b, 0xd2, 0x2b, 0x10, 0x1a, 0xaf, 0x0a, 0x4e, 0x02, 0x0d, 0x01, 0xed, 0x1a, 0x8f, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x33, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf6, 0x64, 0x95, 0x2b, 0x31, 0x64, 0x95, 0xef, 0x5d, 0x95, 0x36, 0x8d, 0x75, 0xef, 0x5d, 0xef, 0x5d, 0x9d, 0x16, 0x8d, 0x75, 0xff, 0xff, 0x85, 0x16, 0x43, 0x92, 0x33, 0x31, 0x2a, 0xf1, 0x22, 0xd0, 0x2a, 0xf1, 0x3b, 0x51, 0x3b, 0x71, 0x53, 0xf3, 0xa5, 0xd7, 0x43, 0x91, 0x33, 0x51, 0x5c, 0x34, 0x2b, 0x10, 0x6c, 0x94, 0x53, 0xf3, 0x3b, 0x71, 0x3b, 0x51, 0x3b, 0x51, 0x3b, 0x71, 0x43, 0x91, 0x5c, 0x13, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0xbe, 0xfb, 0x1a, 0xcf, 0x3b, 0x72, 0xad, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xaf, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x2d, 0x0a, 0x4e, 0x54, 0x13, 0x00, 0x00, 0x85, 0x16, 0x1a, 0xaf, 0x02, 0x0d, 0x2b, 0x10, 0xbd, 0xfa, 0xbe, 0x59, 0x33, 0x10, 0x01, 0xed, 0x22, 0xaf, 0x7c, 0xf5, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0xb5, 0xd9, 0x33, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x6e, 0x12, 0x8e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x1a, 0x8f, 0x33, 0x10, 0x4b, 0xd2, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x22, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x6c, 0x74, 0x2b, 0x32, 0x33, 0x10, 0x3b, 0x71, 0x3b, 0x92, 0x2a, 0xf1, 0x43, 0xb2, 0xef, 0x5d, 0x74, 0xb5, 0x3b, 0x51, 0x3b, 0x71, 0x4b, 0xd3, 0x53, 0xf3, 0x4b, 0xd3, 0x3b, 0x51, 0x2b, 0x11, 0x22, 0xd0, 0x33, 0x31, 0x3b, 0x51, 0x33, 0x31, 0x5c, 0x14, 0x33, 0x31, 0x43, 0x92, 0x2a, 0xf0, 0x33, 0x10, 0x3b, 0x51, 0x33, 0x31, 0x33, 0x10, 0x2a, 0xf0, 0x22, 0xd0, 0x2b, 0x10, 0x3b, 0x71, 0x64, 0x33, 0x85, 0x16, 0xa5, 0xd7, 0xff, 0xff, 0xbe, 0xfb, 0x9d, 0x16, 0x43, 0x91, 0x3b, 0x92, 0x7c, 0xf5, 0x43, 0x92, 0x33, 0x51, 0xad, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x51, 0x22, 0xcf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2b, 0x10, 0x02, 0x0d, 0x22, 0xaf, 0x7c, 0xf5, 0x00, 0x00, 0x54, 0x13, 0x0a, 0x4e, 0x0a, 0x2d, 0x4b, 0xb2, 0xff, 0xff, 0x74, 0x94, 0x1a, 0x8f, 0x02, 0x0d, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0xa5, 0xd8, 0x22, 0xf0, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x12, 0x6f, 0x64, 0x74, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x10, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x12, 0x6e, 0x2a, 0xf0, 0x33, 0x31, 0x53, 0xf3, 0x6c, 0x54, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x22, 0xaf, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x9d, 0x57, 0x4b, 0xb2, 0x3b, 0x92, 0x22, 0xf0, 0x22, 0xf0, 0x3b, 0x71, 0x5c, 0x34, 0xbe, 0xfb, 0xff, 0xff, 0xb6, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd7, 0x64, 0x33, 0x3b, 0x71, 0x1a, 0x90, 0x2b, 0x11, 0x5c, 0x33, 0x2b, 0x52, 0x5c, 0x33, 0x74, 0x94, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xfa, 0x8d, 0x76, 0x5c, 0x34, 0x43, 0x92, 0x2b, 0x10, 0x22, 0xd0, 0x2a, 0xf0, 0x33, 0x10, 0x3b, 0x71, 0x3b, 0x51, 0x22, 0xd0, 0x22, 0xcf, 0x3b, 0x71, 0xb5, 0xd9, 0x33, 0x51, 0x33, 0x51, 0xad, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xcf, 0x3b, 0x51, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x54, 0x13, 0x33, 0x10, 0x43, 0x92, 0xbd, 0xfa, 0xff, 0xff, 0x64, 0x33, 0x2a, 0xf0, 0x22, 0xd0, 0x6c, 0x74, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x2e, 0x0a, 0x2d, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x6c, 0x74, 0x12, 0x6f, 0x22, 0xcf, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x2e, 0x1a, 0x8f, 0x2b, 0x10, 0x43, 0x92, 0x64, 0x33, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x10, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x33, 0x31, 0x5c, 0x33, 0x2b, 0x11, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x64, 0x33, 0x43, 0x91, 0x33, 0x71, 0x33, 0x31, 0x3b, 0x92, 0x3b, 0x71, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x33, 0x51, 0x33, 0x51, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x22, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xde, 0xdb, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0xbe, 0xfb, 0x85, 0x16, 0x74, 0xb5, 0xb6, 0x39, 0xbd, 0xfa, 0x33, 0x10, 0x02, 0x0d, 0x12, 0x8e, 0x64, 0x54, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0x74, 0xb5, 0x43, 0xb2, 0x53, 0xf3, 0x7c, 0xd5, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0xbe, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x1a, 0x8f, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0xa5, 0xd8, 0x95, 0x36, 0x85, 0x16, 0x7c, 0xd5, 0x9d, 0x57, 0xa5, 0xd8, 0xb6, 0x39, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x43, 0x91, 0x33, 0x51, 0x5c, 0x33, 0x2b, 0x11, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0xfb, 0x8d, 0x75, 0xa5, 0xd8, 0xbd, 0xfa, 0xbe, 0xfb, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x51, 0x33, 0x51, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x33, 0x10, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x7c, 0xf6, 0x8d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x1a, 0xaf, 0x02, 0x0d, 0x2b, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xf0, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xf0, 0x12, 0x6f, 0x64, 0x33, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x53, 0xf3, 0x33, 0x51, 0x33, 0x31, 0x53, 0xf3, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x33, 0x31, 0x22, 0xef, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x8d, 0x76, 0x4b, 0xb2, 0x4b, 0xb2, 0x5c, 0x34, 0x5c, 0x34, 0x53, 0xf3, 0x43, 0x92, 0x33, 0x10, 0x2b, 0x52, 0x22, 0xf0, 0x22, 0xf0, 0x22, 0xd0, 0x22, 0xf0, 0x2b, 0x52, 0x33, 0x10, 0x43, 0x92, 0x53, 0xf3, 0x8d, 0x75, 0x2b, 0x10, 0x33, 0x51, 0x5c, 0x33, 0x2b, 0x11, 0x74, 0xb5, 0xff, 0xff, 0x7c, 0xb5, 0x4b, 0xb2, 0x33, 0x31, 0x33, 0x10, 0x33, 0x51, 0x33, 0x31, 0x3b, 0x51, 0x7c, 0xd6, 0x64, 0x54, 0x53, 0xd2, 0x5c, 0x13, 0x7c, 0xb5, 0x9d, 0x16, 0x8d, 0x75, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x33, 0x51, 0x33, 0x51, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x1a, 0x8f, 0x54, 0x13, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x1a, 0x8f, 0x33, 0x31, 0x64, 0x33, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x4b, 0xb2, 0x2b, 0x10, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x3b, 0x51, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x53, 0xf3, 0x22, 0xcf, 0x0a, 0x2e, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x4e, 0x33, 0x10, 0x85, 0x16, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x9d, 0x57, 0x43, 0xb2, 0x2b, 0x31, 0x2b, 0x31, 0x22, 0xf1, 0x2b, 0x31, 0x33, 0x31, 0x3b, 0x71, 0x4b, 0xd2, 0x53, 0xf3, 0x33, 0x30, 0x33, 0x30, 0x53, 0xf3, 0x4b, 0xd2, 0x3b, 0x71, 0x2a, 0xf1, 0x2b, 0x11, 0x43, 0x92, 0x1a, 0xcf, 0x2b, 0x52, 0x64, 0x34, 0x2b, 0x31, 0x6c, 0x94, 0x43, 0x92, 0x22, 0xf1, 0x22, 0xf1, 0x33, 0x71, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x4b, 0xf2, 0x8d, 0x16, 0x54, 0x13, 0x2b, 0x31, 0x2b, 0x11, 0x22, 0xf1, 0x2a, 0xf1, 0x2a, 0xf1, 0x43, 0x92, 0xb6, 0x39, 0x00, 0x00, 0x43, 0x92, 0x33, 0x51, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x95, 0x77, 0x2b, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x3b, 0x71, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd7, 0xb6, 0x39, 0x00, 0x00, 0xff, 0xff, 0x3b, 0x71, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x90, 0x1a, 0x8f, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x53, 0xf3, 0x2b, 0x10, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x0a, 0x4e, 0x02, 0x0d, 0x0a, 0x2d, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x10, 0x22, 0xaf, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x31, 0x64, 0x95, 0x00, 0x00, 0xb6, 0x39, 0x95, 0x77, 0x7c, 0xd5, 0x7c, 0xd5, 0x85, 0x16, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x95, 0x36, 0x5c, 0x34, 0x6c, 0x94, 0x1a, 0xcf, 0x33, 0x10, 0x64, 0x33, 0x2b, 0x31, 0x4b, 0xf3, 0x22, 0xd0, 0x43, 0xb2, 0x7c, 0xd5, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xfa, 0x85, 0x16, 0x6c, 0x94, 0x4b, 0xd2, 0x43, 0x92, 0x4b, 0xb2, 0x5c, 0x13, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xb2, 0x33, 0x51, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x22, 0xaf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x6c, 0x94, 0x33, 0x10, 0x12, 0x6e, 0x02, 0x0d, 0x0a, 0x2d, 0x22, 0xaf, 0x4b, 0xb2, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x12, 0x8f, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x10, 0x0a, 0x4f, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x5c, 0x34, 0x33, 0x10, 0x12, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x33, 0x10, 0x54, 0x13, 0x5c, 0x34, 0x2a, 0xf0, 0x02, 0x0d, 0x12, 0x6e, 0x54, 0x13, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x22, 0xaf, 0x33, 0x51, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x2b, 0x11, 0x5c, 0x33, 0xbd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xbe, 0x59, 0xbe, 0x59, 0x74, 0xb5, 0x33, 0x30, 0x64, 0x33, 0x85, 0x16, 0xbd, 0xfa, 0xbe, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x10, 0x2b, 0x31, 0x64, 0x33, 0x2b, 0x31, 0x5c, 0x14, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0xbd, 0xfa, 0x6c, 0x54, 0x5c, 0x34, 0x53, 0xf3, 0x4b, 0xb2, 0x4b, 0xb2, 0x53, 0xf3, 0x5c, 0x34, 0x85, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x7c, 0xd5, 0x4b, 0xb2, 0x22, 0xd0, 0x3b, 0x51, 0x9d, 0x57, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x22, 0xaf, 0x33, 0x31, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x64, 0x33, 0x2b, 0x10, 0x0a, 0x2e, 0x01, 0xed, 0x0a, 0x2e, 0x22, 0xef, 0x4b, 0xb2, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x33, 0x31, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6f, 0x2a, 0xf1, 0x9d, 0x57, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x54, 0x3b, 0x51, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x0a, 0x4e, 0x2b, 0x10, 0x54, 0x13, 0xbe, 0x59, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x02, 0x0d, 0x2b, 0x31, 0xb6, 0x39, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x1a, 0x8f, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x7c, 0xd6, 0x33, 0x71, 0x2b, 0x11, 0x33, 0x31, 0x33, 0x31, 0x33, 0x51, 0x43, 0x92, 0x33, 0x51, 0x33, 0x51, 0x33, 0x71, 0x3b, 0x51, 0x2b, 0x11, 0x2b, 0x11, 0x2b, 0x11, 0x2b, 0x11, 0x22, 0xf0, 0x33, 0x31, 0x2b, 0x31, 0x3b, 0x71, 0x4b, 0xb2, 0x64, 0x74, 0x33, 0x30, 0x2b, 0x31, 0x6c, 0x94, 0x2b, 0x11, 0x6c, 0x74, 0xef, 0x5d, 0x85, 0x16, 0x53, 0xf3, 0x33, 0x10, 0x2b, 0x11, 0x2b, 0x11, 0x2b, 0x11, 0x22, 0xd0, 0x22, 0xd0, 0x2b, 0x52, 0x2b, 0x11, 0x2b, 0x11, 0x33, 0x71, 0x33, 0x51, 0x33, 0x31, 0x33, 0x31, 0x22, 0xf1, 0x2b, 0x11, 0x3b, 0x51, 0x7c, 0xf5, 0x6c, 0x94, 0x7c, 0xd5, 0xff, 0xff, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x2b, 0x31, 0x1a, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x53, 0xf3, 0x22, 0xcf, 0x0a, 0x2e, 0x02, 0x0d, 0x12, 0x6e, 0x33, 0x10, 0x5c, 0x34, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x2a, 0xf1, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xf0, 0x12, 0x6f, 0x5c, 0x34, 0x00, 0x00, 0xff, 0xff, 0x43, 0xb2, 0x0a, 0x2d, 0x01, 0xed, 0x0a, 0x2d, 0x2a, 0xf0, 0x53, 0xf3, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x8f, 0x01, 0xed, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xcf, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x92, 0x33, 0x71, 0x9d, 0x97, 0x64, 0x34, 0x43, 0x92, 0x3b, 0x92, 0x2b, 0x32, 0x2b, 0x10, 0x2b, 0x32, 0x33, 0x71, 0x3b, 0x71, 0x43, 0x92, 0x4b, 0xb2, 0x53, 0xf3, 0x64, 0x95, 0x43, 0x71, 0x43, 0x71, 0x43, 0xb2, 0x3b, 0x71, 0x2b, 0x32, 0x22, 0xd0, 0x2b, 0x11, 0x22, 0xcf, 0x33, 0x10, 0x7c, 0xb5, 0x22, 0xcf, 0x3b, 0x51, 0x3b, 0x71, 0x2a, 0xf0, 0x22, 0xcf, 0x2b, 0x10, 0x4b, 0xb2, 0x74, 0xb5, 0x8d, 0x16, 0x7c, 0xd5, 0x6c, 0x54, 0x7c, 0xd6, 0x5c, 0x34, 0x4b, 0xd3, 0x3b, 0x71, 0x43, 0x92, 0x33, 0x71, 0x43, 0x92, 0x53, 0xf3, 0x7c, 0xf6, 0x95, 0x77, 0x9d, 0x57, 0x33, 0x31, 0x4b, 0xb2, 0xde, 0xdb, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x7c, 0xd6, 0x7c, 0xd6, 0x7c, 0xd6, 0x6c, 0x94, 0x64, 0x54, 0x64, 0x54, 0x64, 0x54, 0x64, 0x95, 0x43, 0x92, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x6e, 0x3b, 0x92, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x6f, 0x22, 0xd0, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x64, 0x74, 0x1a, 0xaf, 0x1a, 0xaf, 0x4b, 0xb2, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x71, 0x12, 0x4e, 0x01, 0xed, 0x12, 0x8e, 0x6c, 0x54, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x1a, 0x8f, 0x3b, 0x71, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0xbe, 0x59, 0x64, 0x34, 0x1a, 0x90, 0x12, 0x8f, 0x3b, 0x71, 0x33, 0x31, 0x43, 0x92, 0x5c, 0x33, 0x6c, 0x95, 0x5c, 0x33, 0x54, 0x13, 0x43, 0xb2, 0x22, 0xf0, 0x22, 0xf0, 0x22, 0xf0, 0x43, 0xb2, 0x6c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xbe, 0x59, 0x85, 0x16, 0x64, 0x74, 0x54, 0x13, 0x5c, 0x13, 0x8d, 0x76, 0x2b, 0x31, 0x2a, 0xf1, 0x3b, 0x71, 0x4b, 0xb2, 0x64, 0x54, 0x9d, 0x16, 0x00, 0x00, 0xb5, 0xd9, 0x43, 0xb2, 0x2a, 0xf0, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xcf, 0x2b, 0x10, 0x2a, 0xf0, 0x3b, 0x92, 0x43, 0xb2, 0x33, 0x31, 0x2a, 0xf0, 0x2a, 0xf0, 0x22, 0xcf, 0x2b, 0x10, 0x0a, 0x4e, 0x12, 0x8e, 0x53, 0xf3, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x22, 0xaf, 0x33, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x31, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x4e, 0x12, 0x6e, 0x12, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0xbd, 0xfa, 0x2b, 0x31, 0x0a, 0x4f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x1a, 0xb0, 0x12, 0x8f, 0x64, 0x33, 0x00, 0x00, 0xbe, 0xfb, 0x6c, 0x74, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x74, 0x33, 0x31, 0x12, 0x6e, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x33, 0x51, 0x1a, 0x8f, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0x8d, 0x16, 0x2b, 0x11, 0x02, 0x0e, 0x02, 0x0e, 0x0a, 0x2e, 0x02, 0x0e, 0x0a, 0x2e, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x4f, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x0a, 0x4f, 0x4b, 0xd3, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x16, 0xa5, 0xd7, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x1a, 0x8f, 0x12, 0x6e, 0x12, 0x4e, 0x0a, 0x2e, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x3b, 0x71, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x2b, 0x10, 0x1a, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x91, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x12, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x1a, 0xb0, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x2b, 0x31, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf5, 0x3b, 0x71, 0x1a, 0x8f, 0x02, 0x0d, 0x01, 0xed, 0x01, 0xed, 0x12, 0x4e, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x2b, 0x10, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x1a, 0x6e, 0x5c, 0x53, 0xbe, 0x59, 0x33, 0x10, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6e, 0x12, 0x8f, 0x1a, 0x90, 0x22, 0xcf, 0x22, 0xcf, 0x22, 0xef, 0x22, 0xf0, 0x43, 0x92, 0x95, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xde, 0xdb, 0x6c, 0x94, 0x54, 0x13, 0x43, 0x71, 0x43, 0x71, 0x43, 0x91, 0x5c, 0x14, 0x4b, 0xd3, 0x43, 0x92, 0x3b, 0x71, 0x33, 0x30, 0x33, 0x31, 0x33, 0x51, 0x33, 0x51, 0x3b, 0x51, 0x3b, 0x51, 0x7c, 0xb5, 0x5c, 0x14, 0x12, 0x6e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x22, 0xaf, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x22, 0xaf, 0x22, 0xef, 0x22, 0xcf, 0x22, 0xcf, 0x2a, 0xf0, 0x2b, 0x10, 0x2b, 0x10, 0x2b, 0x10, 0x43, 0xb2, 0x9d, 0x57, 0x00, 0x00, 0xbd, 0xfa, 0x2b, 0x31, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x1a, 0xb0, 0x12, 0x6f, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x43, 0x91, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x8e, 0x43, 0x92, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x1a, 0xaf, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2a, 0xf0, 0x12, 0x4e, 0x3b, 0x51, 0x43, 0x91, 0x4b, 0xd3, 0x4b, 0xf3, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x53, 0xd2, 0x53, 0xd2, 0x53, 0xd2, 0x53, 0xd2, 0x53, 0xd2, 0x53, 0xd2, 0x4b, 0xf3, 0x4b, 0xd3, 0x4b, 0xd3, 0x43, 0xb2, 0x43, 0xb2, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x51, 0x64, 0x34, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x64, 0x34, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x4b, 0xb2, 0x43, 0x91, 0x43, 0x91, 0x43, 0x71, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x43, 0xb2, 0x43, 0xb2, 0x2b, 0x10, 0x0a, 0x4e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xd2, 0x1a, 0x8f, 0x3b, 0x71, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x74, 0xb5, 0x3b, 0x51, 0x12, 0x8e, 0x02, 0x0d, 0x02, 0x0d, 0x22, 0xaf, 0x43, 0xb2, 0x7c, 0xd6, 0xa5, 0xd8, 0xa5, 0xd7, 0xb5, 0xd9, 0xb5, 0xd9, 0xb5, 0xd9, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6f, 0x1a, 0xb0, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xd3, 0x0a, 0x4f, 0x33, 0x31, 0xa5, 0xd8, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x53, 0xf3, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x12, 0x4e, 0x33, 0x10, 0x64, 0x74, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x1a, 0x8f, 0x3b, 0x51, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xb5, 0x2b, 0x10, 0x0a, 0x2d, 0x12, 0x4e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x4e, 0x12, 0x6e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x2e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x12, 0x6e, 0x0a, 0x2d, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0xff, 0xff, 0x53, 0xf3, 0x1a, 0xaf, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x0a, 0x4e, 0x12, 0x6e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x22, 0xcf, 0x33, 0x10, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x74, 0x33, 0x10, 0x12, 0x4e, 0x02, 0x0d, 0x0a, 0x2d, 0x22, 0xcf, 0x43, 0x91, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x33, 0x31, 0x0a, 0x4f, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xd0, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x94, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x02, 0x0d, 0x0a, 0x4e, 0x2a, 0xf0, 0x53, 0xf3, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x1a, 0x8f, 0x43, 0x92, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x75, 0x6c, 0x95, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x4b, 0xd3, 0x5c, 0x14, 0x5c, 0x14, 0x5c, 0x14, 0x4b, 0xd2, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x43, 0x71, 0x53, 0xd2, 0x33, 0x10, 0x0a, 0x2d, 0x0a, 0x4e, 0x4b, 0xd3, 0x54, 0x13, 0x53, 0xd2, 0x53, 0xd2, 0x54, 0x13, 0x3b, 0x51, 0x12, 0x6e, 0x12, 0x6e, 0x4b, 0xd2, 0x64, 0x33, 0x22, 0xaf, 0x0a, 0x4e, 0x2a, 0xf0, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x51, 0x22, 0xcf, 0x02, 0x0d, 0x0a, 0x4e, 0x33, 0x10, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x3b, 0x71, 0x43, 0xb2, 0x43, 0xb2, 0x4b, 0xd3, 0x4b, 0xd3, 0x54, 0x13, 0x4b, 0xb2, 0x43, 0x71, 0x43, 0x71, 0x53, 0xd2, 0x53, 0xd2, 0x53, 0xd2, 0x5c, 0x34, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xcf, 0x22, 0xcf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x54, 0x13, 0x2b, 0x10, 0x0a, 0x4e, 0x01, 0xed, 0x0a, 0x4e, 0x22, 0xef, 0x54, 0x13, 0x9d, 0x16, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6f, 0x22, 0xd0, 0x8c, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6f, 0x22, 0xd0, 0x74, 0xb5, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xef, 0x02, 0x0d, 0x0a, 0x2d, 0x22, 0xcf, 0x53, 0xf3, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x3b, 0x51, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x02, 0x0d, 0x2b, 0x10, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x12, 0x8e, 0x1a, 0x8f, 0x12, 0x4e, 0x43, 0xb2, 0xb5, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x94, 0x1a, 0xaf, 0x02, 0x0d, 0x33, 0x10, 0xb5, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x2b, 0x10, 0x22, 0xaf, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x4b, 0xb2, 0x22, 0xcf, 0x0a, 0x2d, 0x01, 0xed, 0x12, 0x6e, 0x5c, 0x33, 0xff, 0xff, 0x00, 0x00, 0x85, 0x16, 0x22, 0xd0, 0x0a, 0x4f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x31, 0x0a, 0x4f, 0x3b, 0x71, 0xa5, 0xd7, 0x00, 0x00, 0x53, 0xd2, 0x2a, 0xf0, 0x43, 0x92, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x33, 0x10, 0x22, 0xaf, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x0a, 0x2d, 0x33, 0x30, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x54, 0x13, 0x12, 0x6e, 0x12, 0x4e, 0x3b, 0x51, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x10, 0x02, 0x0d, 0x1a, 0x8f, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x33, 0x10, 0x1a, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x43, 0x92, 0x1a, 0x8f, 0x1a, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x2b, 0x11, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0x90, 0x12, 0x8f, 0x5c, 0x34, 0x00, 0x00, 0xbd, 0xfa, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0x2b, 0x10, 0x22, 0xaf, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x71, 0x02, 0x0d, 0x12, 0x8e, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x64, 0x33, 0x54, 0x13, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x0a, 0x4e, 0x0a, 0x2e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x33, 0x31, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x6c, 0x94, 0xbe, 0xfb, 0x00, 0x00, 0x6c, 0x74, 0x1a, 0x90, 0x12, 0x8f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x22, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf5, 0x2a, 0xf0, 0x22, 0xaf, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xaf, 0x02, 0x0d, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0x8f, 0x02, 0x0d, 0x2b, 0x10, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x33, 0x31, 0x1a, 0x8f, 0x4b, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x9d, 0x57, 0x33, 0x31, 0x0a, 0x4f, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x2a, 0xf1, 0x0a, 0x4f, 0x3b, 0x71, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x85, 0x16, 0x74, 0xb5, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x2a, 0xf0, 0x22, 0xaf, 0x53, 0xd2, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x0a, 0x2d, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2a, 0xf0, 0x02, 0x0d, 0x1a, 0x8f, 0x64, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x10, 0x1a, 0x8f, 0x4b, 0xd2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x0a, 0x4f, 0x22, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x1a, 0x90, 0x12, 0x6f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x4b, 0xd2, 0x22, 0xcf, 0x1a, 0x8f, 0x2b, 0x31, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0x2b, 0x10, 0x1a, 0x8f, 0x4b, 0xb2, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x8e, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0x94, 0x22, 0xef, 0x1a, 0x8f, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x85, 0x16, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x8f, 0x12, 0x8f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x0a, 0x4f, 0x22, 0xf1, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x8e, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x3b, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x3b, 0x51, 0x1a, 0x8f, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xaf, 0x02, 0x0d, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0xaf, 0x02, 0x0d, 0x2b, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x4b, 0xd2, 0x22, 0xcf, 0x1a, 0xaf, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x91, 0x22, 0xcf, 0x1a, 0xaf, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xf0, 0x0a, 0x4f, 0x43, 0x92, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x10, 0x0a, 0x2e, 0x3b, 0x51, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb2, 0x0a, 0x4e, 0x01, 0xed, 0x02, 0x0d, 0x02, 0x0d, 0x33, 0x31, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x92, 0x1a, 0x8f, 0x2b, 0x10, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x33, 0x10, 0x02, 0x0d, 0x1a, 0xaf, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x43, 0x91, 0x12, 0x8e, 0x2a, 0xf0, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x1a, 0x8f, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x2b, 0x31, 0x0a, 0x4f, 0x33, 0x31, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xd0, 0x0a, 0x4f, 0x43, 0x92, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x74, 0x1a, 0x8f, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x54, 0x13, 0x22, 0xcf, 0x1a, 0xaf, 0x43, 0x91, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x33, 0x31, 0x0a, 0x2d, 0x1a, 0x6e, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x33, 0x10, 0x1a, 0x8f, 0x3b, 0x51, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xd2, 0x12, 0x4e, 0x02, 0x0d, 0x02, 0x0d, 0x01, 0xed, 0x22, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4f, 0x22, 0xd0, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x12, 0x8f, 0x12, 0x6f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x53, 0xf3, 0x22, 0xef, 0x2a, 0xf0, 0x3b, 0x71, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x33, 0x10, 0x1a, 0x8f, 0x3b, 0x51, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x54, 0x22, 0xaf, 0x02, 0x0d, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x1a, 0x8f, 0x02, 0x0d, 0x33, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x53, 0xd2, 0x22, 0xaf, 0x22, 0xaf, 0x4b, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x1a, 0x8f, 0x01, 0xed, 0x01, 0xed, 0x0a, 0x2d, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x6f, 0x12, 0x6f, 0x54, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x4b, 0xd2, 0x12, 0x6f, 0x1a, 0x8f, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x9d, 0x57, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x43, 0x91, 0x22, 0xaf, 0x22, 0xaf, 0x4b, 0xb2, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x0a, 0x2d, 0x3b, 0x71, 0xef, 0x5d, 0xa5, 0xd8, 0x33, 0x10, 0x02, 0x0d, 0x1a, 0xaf, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x3b, 0x51, 0x1a, 0x8f, 0x2b, 0x10, 0x64, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x53, 0xf3, 0x2a, 0xf0, 0x2a, 0xf0, 0x3b, 0x71, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x54, 0x1a, 0xb0, 0x0a, 0x4f, 0x4b, 0xb2, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x3b, 0x51, 0x0a, 0x2e, 0x22, 0xd0, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x2b, 0x10, 0x1a, 0x8f, 0x2b, 0x10, 0x5c, 0x13, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x3b, 0x51, 0x02, 0x0d, 0x12, 0x6e, 0x5c, 0x34, 0x4b, 0xb2, 0x0a, 0x4e, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x43, 0x92, 0x1a, 0xaf, 0x22, 0xaf, 0x43, 0x92, 0x8d, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x54, 0x13, 0x3b, 0x71, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xad, 0xd8, 0x95, 0x77, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x22, 0xf0, 0x0a, 0x4f, 0x3b, 0x92, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x33, 0x31, 0x0a, 0x2e, 0x33, 0x31, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x64, 0x74, 0x85, 0x16, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x4b, 0xb2, 0x2a, 0xf0, 0x1a, 0x8f, 0x33, 0x31, 0x64, 0x54, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0x2a, 0xf0, 0x02, 0x0d, 0x22, 0xaf, 0x12, 0x8e, 0x02, 0x0d, 0x2a, 0xf0, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x43, 0x91, 0x2a, 0xf0, 0x1a, 0x8f, 0x3b, 0x51, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x71, 0x12, 0x6e, 0x22, 0xcf, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x33, 0x10, 0x0a, 0x2e, 0x2b, 0x11, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x22, 0xf0, 0x0a, 0x2e, 0x33, 0x31, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x43, 0x92, 0x22, 0xaf, 0x1a, 0x8f, 0x1a, 0xaf, 0x33, 0x51, 0x7c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0xf6, 0x3b, 0x71, 0x22, 0xcf, 0x22, 0xaf, 0x33, 0x31, 0x53, 0xf3, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x12, 0x6e, 0x01, 0xed, 0x01, 0xed, 0x1a, 0x8f, 0x64, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x4b, 0xb2, 0x22, 0xef, 0x1a, 0x8f, 0x33, 0x31, 0x5c, 0x34, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xd0, 0x0a, 0x2e, 0x1a, 0xaf, 0x64, 0x33, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x3b, 0x92, 0x0a, 0x4f, 0x22, 0xd0, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x22, 0xd0, 0x0a, 0x4f, 0x33, 0x51, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x3b, 0x92, 0x0a, 0x4e, 0x12, 0x8e, 0x2b, 0x10, 0x22, 0xef, 0x12, 0x6e, 0x3b, 0x51, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x43, 0x92, 0x22, 0xcf, 0x22, 0xaf, 0x33, 0x31, 0x54, 0x13, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x0a, 0x2e, 0x0a, 0x2e, 0x43, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x33, 0x3b, 0x51, 0x22, 0xcf, 0x1a, 0x8f, 0x33, 0x10, 0x5c, 0x34, 0xb5, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x53, 0xf3, 0x1a, 0x8f, 0x12, 0x6e, 0x0a, 0x2d, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x3b, 0x71, 0x0a, 0x4f, 0x22, 0xcf, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x1a, 0x8f, 0x0a, 0x4f, 0x43, 0x92, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x22, 0xaf, 0x64, 0x33, 0xde, 0xdb, 0x8d, 0x76, 0x2b, 0x10, 0x12, 0x8e, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x4b, 0xb2, 0x22, 0xcf, 0x1a, 0x8f, 0x22, 0xef, 0x3b, 0x71, 0x5c, 0x13, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x43, 0x91, 0x43, 0x92, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0x7c, 0xb5, 0x53, 0xf3, 0x33, 0x10, 0x22, 0xaf, 0x22, 0xaf, 0x2b, 0x31, 0x53, 0xf3, 0xb5, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x6c, 0x54, 0xad, 0xd8, 0x3b, 0x71, 0x22, 0xcf, 0x53, 0xf3, 0x3b, 0x51, 0x0a, 0x2e, 0x33, 0x31, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x0a, 0x4f, 0x1a, 0x90, 0x64, 0x95, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x1a, 0x8f, 0x0a, 0x4f, 0x43, 0xb2, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xcf, 0x12, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x43, 0xb2, 0x12, 0x4e, 0x53, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x2b, 0x10, 0x22, 0xaf, 0x22, 0xaf, 0x2a, 0xf0, 0x3b, 0x71, 0x53, 0xf3, 0x7c, 0xb5, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x95, 0x36, 0x64, 0x74, 0x4b, 0xb2, 0x33, 0x10, 0x22, 0xcf, 0x1a, 0x8f, 0x22, 0xcf, 0x3b, 0x71, 0x6c, 0x94, 0xde, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x94, 0x2a, 0xf0, 0x53, 0xf3, 0x95, 0x36, 0x85, 0x16, 0xff, 0xff, 0x7c, 0xb5, 0x2a, 0xf0, 0x12, 0x4e, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x12, 0x6f, 0x12, 0x8f, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x12, 0x6f, 0x12, 0x6f, 0x43, 0x92, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x13, 0x12, 0x6e, 0x33, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0xb2, 0x22, 0xcf, 0x64, 0x33, 0x00, 0x00, 0x9d, 0x16, 0x5c, 0x34, 0x54, 0x13, 0x5c, 0x34, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x6c, 0x94, 0x4b, 0xb2, 0x33, 0x10, 0x22, 0xcf, 0x1a, 0x8f, 0x22, 0xcf, 0x33, 0x10, 0x43, 0x92, 0x54, 0x13, 0x74, 0x94, 0x9d, 0x57, 0xb6, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd7, 0x74, 0xb5, 0x64, 0x54, 0x4b, 0xb2, 0x33, 0x31, 0x22, 0xcf, 0x22, 0xaf, 0x22, 0xaf, 0x2a, 0xf0, 0x3b, 0x71, 0x53, 0xf3, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xd5, 0x1a, 0xaf, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x12, 0x6e, 0x1a, 0xaf, 0x74, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x43, 0x92, 0x12, 0x6f, 0x12, 0x8f, 0x53, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x5c, 0x34, 0x12, 0x6e, 0x0a, 0x4f, 0x3b, 0x71, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x10, 0x0a, 0x4e, 0x43, 0x71, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x6c, 0x74, 0xbd, 0xfa, 0x8c, 0xf6, 0x3b, 0x51, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x2b, 0x10, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x85, 0x16, 0x54, 0x13, 0x3b, 0x71, 0x22, 0xef, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xcf, 0x2a, 0xf0, 0x2b, 0x10, 0x3b, 0x71, 0x43, 0x71, 0x53, 0xf3, 0x64, 0x34, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x22, 0xef, 0x54, 0x13, 0x64, 0x34, 0x43, 0x91, 0x3b, 0x71, 0x2b, 0x31, 0x2b, 0x10, 0x2a, 0xf0, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xcf, 0x2b, 0x31, 0x43, 0x71, 0x6c, 0x94, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x54, 0x13, 0x43, 0xb2, 0x95, 0x36, 0x00, 0x00, 0xff, 0xff, 0x43, 0x92, 0x12, 0x6e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x71, 0x0a, 0x2e, 0x33, 0x10, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x3b, 0x71, 0x0a, 0x4f, 0x12, 0x8f, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x1a, 0x8f, 0x0a, 0x4f, 0x2b, 0x31, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xd2, 0x0a, 0x4e, 0x33, 0x31, 0xb5, 0xd9, 0xff, 0xff, 0x74, 0xb5, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x95, 0x36, 0x33, 0x10, 0x0a, 0x4e, 0x22, 0xef, 0x4b, 0xb2, 0x3b, 0x71, 0x12, 0x6e, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x7c, 0xf5, 0x54, 0x13, 0x4b, 0xb2, 0x3b, 0x71, 0x2b, 0x10, 0x2a, 0xf0, 0x22, 0xcf, 0x22, 0xaf, 0x22, 0xf0, 0x22, 0xaf, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xcf, 0x2a, 0xf0, 0x22, 0xef, 0x33, 0x10, 0x3b, 0x71, 0x53, 0xf3, 0x64, 0x54, 0x95, 0x36, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd9, 0x33, 0x10, 0x0a, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x85, 0x16, 0x2a, 0xf0, 0x22, 0xaf, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x22, 0xd0, 0x12, 0x4e, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x71, 0x0a, 0x4f, 0x1a, 0x90, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x74, 0x22, 0xd0, 0x0a, 0x2e, 0x2b, 0x11, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x95, 0x36, 0x2b, 0x10, 0x12, 0x6e, 0x2a, 0xf0, 0x22, 0xcf, 0x1a, 0xaf, 0x33, 0x31, 0x8d, 0x76, 0xff, 0xff, 0x4b, 0xb2, 0x0a, 0x4e, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x71, 0x12, 0x6e, 0x54, 0x13, 0xff, 0xff, 0xa5, 0xd7, 0x64, 0x74, 0x64, 0x74, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xef, 0x5d, 0xbd, 0xfa, 0x9d, 0x57, 0x85, 0x16, 0x6c, 0x94, 0x6c, 0x94, 0x5c, 0x34, 0x54, 0x13, 0x53, 0xd2, 0x43, 0x71, 0x43, 0x71, 0x53, 0xd2, 0x54, 0x13, 0x64, 0x95, 0x6c, 0x94, 0x74, 0x94, 0x95, 0x36, 0xa5, 0xd7, 0xde, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x4b, 0xb2, 0x43, 0x92, 0x5c, 0x34, 0xa5, 0xd7, 0x00, 0x00, 0x53, 0xf3, 0x12, 0x6e, 0x22, 0xef, 0x8d, 0x76, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x4e, 0x43, 0x92, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2a, 0xf0, 0x43, 0xb2, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x2b, 0x10, 0x0a, 0x4f, 0x22, 0xd0, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd6, 0x2a, 0xf1, 0x0a, 0x2e, 0x22, 0xcf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xf5, 0x33, 0x10, 0x1a, 0x8f, 0x12, 0x6e, 0x22, 0xaf, 0x53, 0xf3, 0xb6, 0x39, 0x9d, 0x57, 0x2a, 0xf0, 0x12, 0x6e, 0x64, 0x33, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x43, 0xb2, 0x12, 0x6e, 0x53, 0xf3, 0x00, 0x00, 0x74, 0xb5, 0x22, 0xaf, 0x22, 0xaf, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x54, 0x13, 0x22, 0xaf, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x6e, 0x33, 0x31, 0x95, 0x36, 0xbe, 0x59, 0x33, 0x10, 0x12, 0x4e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x9d, 0x57, 0x22, 0xef, 0x22, 0xaf, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x95, 0x77, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0x34, 0x22, 0xd0, 0x0a, 0x2e, 0x22, 0xf0, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x16, 0x33, 0x71, 0x0a, 0x4f, 0x12, 0x8f, 0x4b, 0xd2, 0xa5, 0xd7, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x6c, 0x94, 0x6c, 0x74, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x74, 0xb5, 0x12, 0x6e, 0x22, 0xcf, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x31, 0x12, 0x6e, 0x5c, 0x34, 0x00, 0x00, 0x53, 0xd2, 0x0a, 0x4e, 0x0a, 0x2d, 0x43, 0xb2, 0xff, 0xff, 0xff, 0xff, 0x53, 0xf3, 0x53, 0xf3, 0xa5, 0xd7, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0xfb, 0x7c, 0xd5, 0x74, 0xb5, 0xbe, 0xfb, 0x00, 0x00, 0x6c, 0x94, 0x22, 0xaf, 0x1a, 0x6e, 0x43, 0x71, 0x54, 0x13, 0x2a, 0xf0, 0x1a, 0x8f, 0x5c, 0x34, 0xff, 0xff, 0x6c, 0x74, 0x12, 0x8e, 0x1a, 0xaf, 0x7c, 0xb5, 0x00, 0x00, 0xff, 0xff, 0x43, 0x71, 0x12, 0x4e, 0x4b, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x4b, 0xb2, 0x1a, 0x90, 0x0a, 0x4f, 0x33, 0x10, 0x7c, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x43, 0xb2, 0x12, 0x6f, 0x0a, 0x4f, 0x3b, 0x51, 0x74, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x54, 0x12, 0x6e, 0x33, 0x10, 0xbe, 0x59, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x8e, 0x22, 0xaf, 0x74, 0xb5, 0xef, 0x5d, 0x33, 0x31, 0x0a, 0x4e, 0x0a, 0x2e, 0x33, 0x10, 0xde, 0xdb, 0xa5, 0xd7, 0x22, 0xef, 0x2a, 0xf0, 0x95, 0x77, 0xa5, 0xd7, 0x53, 0xf3, 0x4b, 0xb2, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x39, 0x7c, 0xb5, 0x74, 0x94, 0x53, 0xf3, 0x5c, 0x34, 0x9d, 0x97, 0x2b, 0x10, 0x2a, 0xf0, 0x85, 0x16, 0x00, 0x00, 0x43, 0x91, 0x12, 0x4e, 0x3b, 0x51, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xd5, 0x5c, 0x34, 0x95, 0x36, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x0a, 0x2e, 0x3b, 0x71, 0xbd, 0xfa, 0xde, 0xdb, 0x3b, 0x71, 0x12, 0x4e, 0x4b, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x33, 0x31, 0x12, 0x6f, 0x12, 0x6f, 0x3b, 0x71, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x5c, 0x34, 0x22, 0xcf, 0x0a, 0x2e, 0x22, 0xd0, 0x54, 0x13, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x1a, 0x8f, 0x22, 0xcf, 0x7c, 0xf5, 0xff, 0xff, 0x7c, 0xd6, 0x22, 0xcf, 0x12, 0x4e, 0x4b, 0xd2, 0xff, 0xff, 0x74, 0xb5, 0x1a, 0xaf, 0x2b, 0x10, 0x2a, 0xf0, 0x22, 0xcf, 0x8d, 0x76, 0x5c, 0x13, 0x12, 0x8e, 0x33, 0x31, 0xef, 0x5d, 0x74, 0xb5, 0x22, 0xaf, 0x12, 0x6e, 0x53, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x94, 0x53, 0xf3, 0x95, 0x36, 0xff, 0xff, 0x8d, 0x76, 0x7c, 0xf5, 0x95, 0x77, 0x95, 0x36, 0x95, 0x36, 0xa5, 0xd8, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x7c, 0xd5, 0x7c, 0xb5, 0x9d, 0x16, 0x00, 0x00, 0xb6, 0x39, 0x54, 0x13, 0x33, 0x51, 0x2a, 0xf0, 0x22, 0xcf, 0x12, 0x8e, 0x12, 0x6e, 0x2b, 0x10, 0x95, 0x77, 0x2b, 0x10, 0x12, 0x6e, 0x64, 0x74, 0xff, 0xff, 0x2b, 0x10, 0x12, 0x6e, 0x4b, 0xb2, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x6c, 0x94, 0x22, 0xaf, 0x12, 0x4e, 0x3b, 0x51, 0x2b, 0x10, 0x12, 0x4e, 0x2b, 0x10, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x33, 0x22, 0xd0, 0x0a, 0x2e, 0x22, 0xcf, 0x53, 0xf3, 0xb6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0xb5, 0x33, 0x31, 0x0a, 0x4f, 0x12, 0x6f, 0x43, 0x92, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x43, 0x92, 0x12, 0x6e, 0x22, 0xcf, 0x22, 0xcf, 0x1a, 0xaf, 0x12, 0x4e, 0x33, 0x71, 0x9d, 0x57, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x4b, 0xd2, 0x3b, 0x51, 0x12, 0x8e, 0x6c, 0x94, 0x43, 0x92, 0x12, 0x6e, 0x54, 0x13, 0x00, 0x00, 0x54, 0x13, 0x0a, 0x4e, 0x02, 0x0d, 0x33, 0x10, 0xbd, 0xfa, 0xef, 0x5d, 0x33, 0x31, 0x22, 0xcf, 0x7c, 0xf5, 0xef, 0x5d, 0x43, 0xb2, 0x22, 0xaf, 0x22, 0xaf, 0x22, 0xef, 0x2b, 0x10, 0x2b, 0x10, 0x53, 0xf3, 0xff, 0xff, 0xef, 0x5d, 0x64, 0x33, 0x2b, 0x10, 0x22, 0xaf, 0x22, 0xaf, 0x3b, 0x51, 0x7c, 0xd5, 0xa5, 0xd8, 0x3b, 0x51, 0x12, 0x6e, 0x12, 0x6e, 0x02, 0x0d, 0x1a, 0xaf, 0x43, 0x92, 0x64, 0x74, 0xef, 0x5d, 0x43, 0x91, 0x0a, 0x4e, 0x43, 0x92, 0xff, 0xff, 0x43, 0x91, 0x12, 0x6e, 0x33, 0x31, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x57, 0x4b, 0xb2, 0x53, 0xd2, 0xbe, 0xfb, 0xff, 0xff, 0x54, 0x13, 0x22, 0xaf, 0x12, 0x6e, 0x12, 0x6e, 0x2a, 0xf0, 0x74, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x43, 0x92, 0x12, 0x8f, 0x0a, 0x4f, 0x33, 0x31, 0x6c, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x16, 0x4b, 0xb2, 0x12, 0x8f, 0x0a, 0x4f, 0x2a, 0xf1, 0x64, 0x74, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x4b, 0xb2, 0x22, 0xcf, 0x1a, 0x8f, 0x22, 0xd0, 0x43, 0x92, 0x9d, 0x57, 0x00, 0x00, 0xbe, 0x59, 0x33, 0x10, 0x1a, 0x8f, 0x74, 0xb5, 0x43, 0x71, 0x12, 0x6e, 0x64, 0x34, 0x1a, 0x8f, 0x22, 0xcf, 0x85, 0x16, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6e, 0x1a, 0x8f, 0x1a, 0x8f, 0x74, 0x94, 0xb5, 0xd9, 0x2a, 0xf0, 0x22, 0xcf, 0x95, 0x36, 0xef, 0x5d, 0x2a, 0xf0, 0x0a, 0x2d, 0x2b, 0x10, 0x2b, 0x10, 0x22, 0xef, 0x22, 0xcf, 0x54, 0x13, 0xff, 0xff, 0x64, 0x74, 0x22, 0xaf, 0x12, 0x6e, 0x2a, 0xf0, 0x2a, 0xf0, 0x12, 0x6e, 0x2b, 0x10, 0x85, 0x16, 0x74, 0xb5, 0x6c, 0x94, 0x5c, 0x34, 0x12, 0x6e, 0x2b, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6e, 0x33, 0x10, 0xb5, 0xd9, 0x6c, 0x94, 0x12, 0x8e, 0x1a, 0x8f, 0x74, 0x94, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb5, 0x1a, 0x8f, 0x33, 0x31, 0xbe, 0x59, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x6c, 0x94, 0x6c, 0x94, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x5c, 0x34, 0x2b, 0x10, 0x0a, 0x2e, 0x12, 0x8f, 0x43, 0x92, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x64, 0x74, 0x2a, 0xf1, 0x0a, 0x4f, 0x12, 0x8f, 0x3b, 0x71, 0x6c, 0x54, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x7c, 0xf5, 0x95, 0x77, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x22, 0xaf, 0x2b, 0x10, 0xbe, 0x59, 0x64, 0x33, 0x12, 0x8e, 0x43, 0x92, 0x1a, 0x8f, 0x33, 0x51, 0xff, 0xff, 0xef, 0x5d, 0x33, 0x31, 0x22, 0xaf, 0x4b, 0xf2, 0x12, 0x6e, 0x43, 0x91, 0x8c, 0xf6, 0x22, 0xaf, 0x33, 0x10, 0xef, 0x5d, 0xa5, 0xd7, 0x2a, 0xf0, 0x12, 0x6e, 0x7c, 0xf5, 0xb5, 0xd9, 0xa5, 0xd7, 0x85, 0x16, 0xa5, 0xd8, 0xbd, 0xfa, 0x33, 0x10, 0x12, 0x4e, 0x4b, 0xb2, 0xbe, 0x59, 0x9d, 0x57, 0x33, 0x10, 0x12, 0x6e, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x00, 0x95, 0x36, 0x22, 0xaf, 0x22, 0xcf, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x22, 0xcf, 0x22, 0xaf, 0x7c, 0xd5, 0xbe, 0x59, 0x33, 0x10, 0x0a, 0x4e, 0x3b, 0x51, 0xad, 0xd8, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x4e, 0x33, 0x30, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd5, 0x3b, 0x71, 0x12, 0x8f, 0x0a, 0x4f, 0x2a, 0xf1, 0x64, 0x33, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x76, 0x43, 0x92, 0x12, 0x8f, 0x0a, 0x2e, 0x22, 0xd0, 0x4b, 0xb2, 0x8d, 0x76, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6e, 0x4b, 0xb2, 0xff, 0xff, 0x7c, 0xd5, 0x1a, 0xaf, 0x0a, 0x4e, 0x12, 0x6e, 0x53, 0xf3, 0x00, 0x00, 0xa5, 0xd7, 0x22, 0xef, 0x22, 0xcf, 0x7c, 0xf6, 0x1a, 0x8f, 0x2b, 0x10, 0x64, 0x95, 0x12, 0x6e, 0x43, 0x92, 0xff, 0xff, 0x85, 0x16, 0x22, 0xd0, 0x12, 0x8e, 0x53, 0xf3, 0x6c, 0x74, 0x5c, 0x53, 0x9d, 0x16, 0x00, 0x00, 0x95, 0x36, 0x22, 0xcf, 0x12, 0x8e, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x74, 0x94, 0x53, 0xf3, 0x8c, 0xf6, 0xff, 0xff, 0x00, 0x00, 0xbe, 0x59, 0x22, 0xd0, 0x1a, 0x8f, 0x6c, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0x31, 0x0a, 0x4e, 0x54, 0x13, 0x00, 0x00, 0x74, 0xb5, 0x2a, 0xf0, 0x0a, 0x2e, 0x22, 0xef, 0x22, 0xf0, 0x1a, 0x6e, 0x22, 0xaf, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd8, 0x4b, 0xb2, 0x22, 0xcf, 0x0a, 0x2e, 0x12, 0x8f, 0x43, 0x92, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x6c, 0x94, 0x33, 0x10, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xf0, 0x53, 0xd2, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x64, 0x34, 0x3b, 0x51, 0x74, 0xb5, 0x00, 0x00, 0x95, 0x36, 0x22, 0xef, 0x02, 0x0d, 0x22, 0xcf, 0x85, 0x16, 0x00, 0x00, 0x7c, 0xd5, 0x1a, 0xaf, 0x33, 0x10, 0xb5, 0xd9, 0x2b, 0x31, 0x1a, 0x8f, 0x4b, 0xd3, 0x12, 0x6e, 0x4b, 0xb2, 0x00, 0x00, 0x5c, 0x53, 0x1a, 0xaf, 0x0a, 0x2d, 0x1a, 0x8f, 0x1a, 0x8f, 0x1a, 0x8f, 0x5c, 0x33, 0xff, 0xff, 0x8c, 0xf6, 0x22, 0xcf, 0x22, 0xcf, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x33, 0x31, 0x12, 0x6e, 0x53, 0xd2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x33, 0x51, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x94, 0x33, 0x10, 0x1a, 0x8f, 0x1a, 0x8f, 0x2b, 0x10, 0x64, 0x33, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x64, 0x34, 0x2b, 0x10, 0x12, 0x6f, 0x12, 0x6f, 0x33, 0x10, 0x6c, 0x74, 0xef, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd7, 0x54, 0x13, 0x22, 0xf0, 0x0a, 0x4f, 0x0a, 0x4f, 0x2b, 0x11, 0x54, 0x13, 0xa5, 0xd7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x9d, 0x57, 0xbe, 0xfb, 0x00, 0x00, 0xef, 0x5d, 0x3b, 0x51, 0x0a, 0x4e, 0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0x5c, 0x34, 0x12, 0x8e, 0x43, 0xb2, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x22, 0xf0, 0x1a, 0x8f, 0x64, 0x54, 0x00, 0x00, 0x5c, 0x53, 0x1a, 0x8f, 0x22, 0xaf, 0x4b, 0xd2, 0x43, 0x92, 0x43, 0xb2, 0x7c, 0xb5, 0xff, 0xff, 0x95, 0x36, 0x22, 0xcf, 0x1a, 0x8f, 0x7c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x7c, 0xb5, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x53, 0xf3, 0x12, 0x6e, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x94, 0x12, 0x8e, 0x22, 0xcf, 0x9d, 0x57, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x7c, 0xd5, 0x7c, 0xd5, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x64, 0x34, 0x33, 0x51, 0x0a, 0x4f, 0x0a, 0x4f, 0x22, 0xf0, 0x53, 0xf3, 0xb5, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x22, 0xd0, 0x0a, 0x4f, 0x12, 0x6f, 0x2b, 0x10, 0x53, 0xf3, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xd6, 0x43, 0x92, 0x6c, 0x94, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xb2, 0x12, 0x6e, 0x54, 0x13, 0x00, 0x00, 0x7c, 0xb5, 0x1a, 0xaf, 0x01, 0xed, 0x22, 0xcf, 0x8d, 0x76, 0x00, 0x00, 0x6c, 0x54, 0x1a, 0x6e, 0x33, 0x10, 0xbe, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xbd, 0xfa, 0x2b, 0x10, 0x0a, 0x4e, 0x53, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x64, 0x33, 0x22, 0xcf, 0x43, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x12, 0x6e, 0x3b, 0x51, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x33, 0x10, 0x2b, 0x10, 0x95, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7c, 0xb5, 0x53, 0xf3, 0x2b, 0x10, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xf1, 0x53, 0xf3, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x2a, 0xf0, 0x0a, 0x4f, 0x0a, 0x4f, 0x22, 0xd0, 0x43, 0x71, 0x7c, 0xd5, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xbe, 0xfb, 0x5c, 0x33, 0x3b, 0x51, 0x74, 0xb5, 0x00, 0x00, 0xde, 0xdb, 0x3b, 0x51, 0x02, 0x0d, 0x33, 0x10, 0xbd, 0xfa, 0x00, 0x00, 0x7c, 0xb5, 0x1a, 0x8f, 0x2b, 0x10, 0x7c, 0xb5, 0x7c, 0xd6, 0x7c, 0xb5, 0x95, 0x36, 0xa5, 0xd7, 0xff, 0xff, 0x53, 0xd2, 0x12, 0x4e, 0x22, 0xcf, 0x64, 0x74, 0x6c, 0x94, 0x2b, 0x10, 0x12, 0x6e, 0x53, 0xd2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf5, 0x22, 0xaf, 0x22, 0xef, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0xf6, 0x7c, 0xb5, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xfb, 0x7c, 0xb5, 0x4b, 0xb2, 0x2a, 0xf1, 0x12, 0x6f, 0x0a, 0x4f, 0x22, 0xd0, 0x54, 0x13, 0x95, 0x77, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8d, 0x76, 0x53, 0xf3, 0x2b, 0x10, 0x12, 0x6f, 0x0a, 0x4f, 0x1a, 0xb0, 0x3b, 0x71, 0x64, 0x74, 0xa5, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0xb5, 0xd9, 0xbe, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x64, 0x33, 0x2b, 0x10, 0x53, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x7c, 0xb5, 0x1a, 0x8f, 0x0a, 0x4e, 0x1a, 0x8f, 0x1a, 0x8f, 0x12, 0x6e, 0x2a, 0xf0, 0x7c, 0xb5, 0x00, 0x00, 0xbe, 0x59, 0x3b, 0x51, 0x12, 0x6e, 0x12, 0x6e, 0x12, 0x8e, 0x12, 0x6e, 0x3b, 0x51, 0xa5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x59, 0x5c, 0x33, 0x5c, 0x34, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x6c, 0x74, 0x43, 0x92, 0x22, 0xcf, 0x0a, 0x4f, 0x12, 0x6f, 0x2a, 0xf1, 0x53, 0xf3, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x54, 0x13, 0x33, 0x31, 0x12, 0x6f, 0x0a, 0x2e, 0x12, 0x6f, 0x33, 0x31, 0x33, 0x51, 0x5c, 0x13, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xad, 0xd8, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x95, 0x77, 0x53, 0xf3, 0x3b, 0x51, 0x3b, 0x51, 0x3b, 0x51, 0x2b, 0x10, 0x33, 0x10, 0x7c, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xd8, 0x53, 0xf3, 0x3b, 0x51, 0x3b, 0x51, 0x4b, 0xb2, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x95, 0x36, 0x6c, 0x94, 0x4b, 0xb2, 0x2a, 0xf1, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x33, 0x10, 0x5c, 0x34, 0x9d, 0x57, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbe, 0x59, 0x6c, 0x94, 0x43, 0x92, 0x22, 0xd0, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x8f, 0x22, 0xd0, 0x43, 0x92, 0x54, 0x13, 0x74, 0xb5, 0x8d, 0x75, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa5, 0xd7, 0x7c, 0xb5, 0x54, 0x13, 0x43, 0x92, 0x22, 0xf0, 0x12, 0x6f, 0x0a, 0x2e, 0x12, 0x6f, 0x22, 0xd0, 0x43, 0x92, 0x6c, 0x94, 0xbd, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x85, 0x16, 0x5c, 0x34, 0x3b, 0x71, 0x22, 0xd0, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0xb0, 0x2b, 0x10, 0x43, 0x92, 0x5c, 0x34, 0x7c, 0xb5, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x7c, 0xd5, 0x53, 0xf3, 0x43, 0x92, 0x2a, 0xf0, 0x1a, 0xb0, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x22, 0xd0, 0x3b, 0x51, 0x5c, 0x34, 0x85, 0x16, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9d, 0x57, 0x64, 0x74, 0x43, 0x92, 0x2b, 0x11, 0x1a, 0x8f, 0x0a, 0x4f, 0x0a, 0x2e, 0x12, 0x6f, 0x1a, 0xb0, 0x33, 0x31, 0x43, 0x92, 0x53, 0xf3, 0x64, 0x74, 0x7c, 0xd5, 0x95, 0x36, 0x8d, 0x75, 0xa5, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xd7, 0x8d, 0x75, 0x95, 0x36, 0x74, 0x94, 0x5c, 0x34, 0x4b, 0xb2, 0x43, 0x92, 0x2b, 0x11, 0x1a, 0xb0, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x1a, 0x8f, 0x2b, 0x10, 0x43, 0x92, 0x64, 0x33, 0x95, 0x36, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x7c, 0xf5, 0x5c, 0x34, 0x43, 0x92, 0x2b, 0x11, 0x1a, 0xb0, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0x8f, 0x22, 0xd0, 0x22, 0xef, 0x33, 0x10, 0x3b, 0x51, 0x43, 0x92, 0x4b, 0xd2, 0x54, 0x13, 0x53, 0xf3, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x53, 0xf3, 0x54, 0x13, 0x4b, 0xd2, 0x43, 0x92, 0x3b, 0x71, 0x33, 0x31, 0x1a, 0x8f, 0x22, 0xd0, 0x1a, 0x90, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0x8f, 0x2b, 0x11, 0x3b, 0x71, 0x54, 0x13, 0x7c, 0xd5, 0xbe, 0x59, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbd, 0xfa, 0x85, 0x16, 0x5c, 0x34, 0x4b, 0xb2, 0x3b, 0x71, 0x33, 0x31, 0x22, 0xf1, 0x1a, 0x90, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x4f, 0x12, 0x6f, 0x1a, 0x8f, 0x22, 0xd0, 0x2b, 0x11, 0x3b, 0x51, 0x4b, 0xd2, 0x64, 0x33, 0x8c, 0xf6, 0xbd, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xd9, 0x8d, 0x76, 0x8d, 0x16, 0x53, 0xf3, 0x53, 0xd2, 0x54, 0x13, 0x4b, 0xb2, 0x3b, 0x71, 0x43, 0x92, 0x43, 0x92, 0x33, 0x51, 0x33, 0x51, 0x22, 0xf0, 0x22, 0xf0, 0x33, 0x51, 0x33, 0x51, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x4b, 0xb2, 0x54, 0x13, 0x53, 0xf3, 0x64, 0x33, 0x7c, 0xf5, 0x9d, 0x57, 0xbe, 0x59, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  /*alpha channel*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x19, 0x25, 0x42, 0x54, 0x72, 0x89, 0x86, 0x9a, 0xc9, 0xcd, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xcb, 0xcd, 0xc9, 0xa4, 0x8d, 0x85, 0x68, 0x54, 0x3e, 0x25, 0x19, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x16, 0x33, 0x53, 0x78, 0x9f, 0xba, 0xcd, 0xe1, 0xf1, 0xf8, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0xf6, 0xf5, 0xf6, 0xf6, 0xf1, 0xe1, 0xcd, 0xc0, 0x9f, 0x7d, 0x56, 0x33, 0x15, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x38, 0x63, 0x94, 0xc0, 0xe1, 0xf5, 0xf8, 0xf8, 0xed, 0xd6, 0xc5, 0xad, 0xa0, 0x78, 0x72, 0x6f, 0x6e, 0x54, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x4b, 0x6e, 0x6f, 0x6f, 0x7d, 0xa4, 0xb1, 0xcd, 0xd6, 0xed, 0xf8, 0xf8, 0xf6, 0xe1, 0xbe, 0x93, 0x68, 0x35, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x20, 0x52, 0x86, 0xba, 0xe1, 0xf8, 0xfa, 0xf1, 0xd6, 0xb2, 0x8d, 0x63, 0x47, 0x2f, 0x21, 0x0b, 0x07, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x04, 0x07, 0x0d, 0x21, 0x2a, 0x42, 0x5b, 0x89, 0xaf, 0xcf, 0xed, 0xf8, 0xf6, 0xe1, 0xba, 0x86, 0x4c, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x5f, 0x9f, 0xcd, 0xf5, 0xfa, 0xf1, 0xcd, 0xa5, 0x78, 0x47, 0x25, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x20, 0x42, 0x6d, 0x9f, 0xcd, 0xf1, 0xfa, 0xf5, 0xd3, 0x9f, 0x59, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x47, 0x93, 0xcd, 0xf5, 0xf8, 0xe1, 0xbd, 0x82, 0x4d, 0x25, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x21, 0x4d, 0x7d, 0xba, 0xe4, 0xf8, 0xf5, 0xd3, 0x8e, 0x47, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x5f, 0xb7, 0xed, 0xfc, 0xe8, 0xb2, 0x6d, 0x38, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x25, 0x21, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x3c, 0x78, 0xb7, 0xe4, 0xfc, 0xed, 0xad, 0x63, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x26, 0x72, 0xba, 0xf1, 0xf6, 0xcd, 0x86, 0x42, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x94, 0xbe, 0xcd, 0xc9, 0xb2, 0x53, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x77, 0x9e, 0x82, 0x68, 0x4c, 0x39, 0x20, 0x16, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x42, 0x89, 0xcd, 0xf8, 0xf5, 0xc0, 0x68, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x26, 0x77, 0xcd, 0xfa, 0xf6, 0xc0, 0x68, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x6f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x19, 0xc7, 0xff, 0xfb, 0xf8, 0xef, 0xe9, 0xc7, 0xb7, 0x9f, 0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x6f, 0xba, 0xf5, 0xf8, 0xd2, 0x85, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x78, 0xcd, 0xfa, 0xed, 0xad, 0x59, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xbe, 0xff, 0xff, 0xd9, 0xaa, 0xcd, 0xfb, 0xff, 0xe0, 0x47, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd6, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x19, 0x5d, 0xb7, 0xf1, 0xfc, 0xd7, 0x7d, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5f, 0xc5, 0xfa, 0xf1, 0xad, 0x52, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2b, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xf0, 0xff, 0xe0, 0x47, 0x0d, 0x2a, 0xb9, 0xff, 0xff, 0x9a, 0x0d, 0x00, 0x00, 0x00, 0x42, 0xe3, 0xff, 0xe5, 0x7d, 0x82, 0x9a, 0xbd, 0xcf, 0xd2, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x5d, 0xba, 0xf1, 0xf8, 0xc5, 0x68, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x47, 0xaf, 0xf1, 0xf6, 0xbd, 0x53, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x8d, 0xd3, 0x7d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x97, 0xff, 0xff, 0xa5, 0x12, 0x00, 0x00, 0x68, 0xf7, 0xff, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x5f, 0xf8, 0xff, 0xc9, 0x1d, 0x04, 0x0a, 0x16, 0x1c, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x19, 0x5d, 0xb7, 0xf1, 0xf6, 0xb2, 0x4d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x86, 0xe4, 0xfa, 0xc7, 0x68, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x52, 0xf0, 0xfb, 0x6f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xb6, 0xff, 0xfe, 0x96, 0x0d, 0x00, 0x00, 0x3c, 0xe3, 0xff, 0xf0, 0x55, 0x01, 0x00, 0x01, 0x6e, 0xfb, 0xff, 0xbe, 0x33, 0x15, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x5f, 0xc5, 0xfa, 0xe4, 0x8d, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x52, 0xc0, 0xfc, 0xe1, 0x82, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x39, 0x5d, 0x19, 0x00, 0x00, 0x52, 0xef, 0xf0, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc3, 0xff, 0xfe, 0x9e, 0x0d, 0x00, 0x00, 0x26, 0xd7, 0xff, 0xef, 0x59, 0x01, 0x00, 0x0a, 0x93, 0xfe, 0xff, 0xf0, 0xd2, 0xbd, 0x9e, 0x82, 0x3e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x86, 0xd2, 0x85, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x25, 0x82, 0xe4, 0xfc, 0xcd, 0x4d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x89, 0xe8, 0xf8, 0xb7, 0x47, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0xa5, 0xe0, 0xf0, 0x9e, 0x20, 0x00, 0x54, 0xf0, 0xea, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xb7, 0xff, 0xfe, 0x9a, 0x0d, 0x00, 0x00, 0x26, 0xd7, 0xff, 0xef, 0x56, 0x01, 0x00, 0x0d, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd9, 0xff, 0xfc, 0xa4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x47, 0xb7, 0xfa, 0xe8, 0x86, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3e, 0xb2, 0xfa, 0xe4, 0x7d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0xdb, 0xff, 0xff, 0xfb, 0xb2, 0x33, 0x6f, 0xfb, 0xe0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8e, 0xfe, 0xff, 0xb6, 0x15, 0x00, 0x00, 0x38, 0xe3, 0xff, 0xea, 0x47, 0x00, 0x00, 0x15, 0xc5, 0xff, 0xf9, 0xbd, 0xaf, 0xc4, 0xe0, 0xd9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x94, 0xfb, 0xff, 0xff, 0xb8, 0x15, 0x00, 0x01, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7d, 0xe4, 0xfc, 0xba, 0x3e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x63, 0xd6, 0xfc, 0xc0, 0x4d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x04, 0x00, 0x00, 0x05, 0x39, 0xbd, 0xfb, 0xff, 0xfe, 0xc3, 0xaf, 0xfe, 0xce, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xeb, 0xff, 0xe5, 0x4c, 0x01, 0x05, 0x72, 0xf4, 0xff, 0xc3, 0x21, 0x00, 0x00, 0x20, 0xcf, 0xff, 0xef, 0x56, 0x12, 0x1d, 0x2b, 0x2b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe5, 0xff, 0xff, 0xff, 0xd3, 0x2a, 0x00, 0x12, 0x82, 0x6e, 0x1c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0xc0, 0xfc, 0xd6, 0x68, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x8d, 0xf1, 0xf1, 0x9a, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6f, 0xb7, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0xf4, 0xff, 0xff, 0xf9, 0xff, 0xcd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xad, 0xff, 0xff, 0xce, 0x77, 0x7e, 0xd9, 0xff, 0xfb, 0x7d, 0x05, 0x00, 0x00, 0x42, 0xe3, 0xff, 0xe3, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x9e, 0xff, 0xf9, 0xf9, 0xff, 0xe5, 0x39, 0x00, 0x4d, 0xea, 0xf4, 0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x25, 0x94, 0xf1, 0xf1, 0x8d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xaf, 0xf8, 0xe1, 0x6f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38, 0xaa, 0xf4, 0xff, 0xaa, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x77, 0xe6, 0xff, 0xff, 0xff, 0xad, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0xd6, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfe, 0xad, 0x25, 0x00, 0x00, 0x00, 0x53, 0xef, 0xff, 0xce, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe5, 0xff, 0xb7, 0xd6, 0xff, 0xe5, 0x33, 0x0f, 0xaa, 0xff, 0xe3, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x68, 0xe1, 0xfa, 0xaa, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0xbe, 0xfc, 0xcd, 0x4d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6f, 0xd6, 0xff, 0xff, 0xef, 0x93, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x59, 0xd6, 0xff, 0xff, 0xc3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0xb6, 0xe5, 0xf0, 0xf0, 0xde, 0x94, 0x26, 0x00, 0x00, 0x00, 0x01, 0x64, 0xe5, 0xf7, 0xb7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9e, 0xff, 0xe5, 0x5d, 0xc7, 0xff, 0xe3, 0x35, 0x4c, 0xeb, 0xff, 0x9a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4c, 0xc5, 0xfc, 0xc0, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x4d, 0xd6, 0xfc, 0xb2, 0x33, 0x01, 0x00, 0x00, 0x00, 0x04, 0x3c, 0xaa, 0xf4, 0xff, 0xff, 0xdb, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x52, 0xe6, 0xff, 0xf4, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x56, 0x52, 0x2f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x64, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe6, 0xff, 0xa5, 0x2a, 0xcd, 0xff, 0xe5, 0x47, 0xa5, 0xff, 0xe5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3c, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xaa, 0xfa, 0xda, 0x5d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x54, 0xda, 0xf6, 0x9e, 0x25, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6f, 0xd6, 0xfe, 0xff, 0xff, 0xff, 0xcd, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xaa, 0xff, 0xff, 0xad, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x9e, 0xff, 0xe5, 0x47, 0x19, 0xcb, 0xff, 0xe5, 0x85, 0xe5, 0xff, 0x9a, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x3e, 0xd2, 0xbe, 0x42, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xa0, 0xf6, 0xe1, 0x63, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0xe4, 0xf6, 0x86, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd2, 0xff, 0xfe, 0xd6, 0xeb, 0xff, 0xfb, 0x94, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0xf0, 0xff, 0xe5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe3, 0xff, 0xa5, 0x0f, 0x12, 0xaa, 0xff, 0xf7, 0xf2, 0xff, 0xe5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x25, 0xbd, 0xff, 0xff, 0xd6, 0x5f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x19, 0x82, 0xf1, 0xe4, 0x5f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6e, 0xed, 0xf1, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0xde, 0x94, 0x2f, 0x86, 0xf9, 0xff, 0xeb, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc7, 0xff, 0xfb, 0x89, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9e, 0xff, 0xea, 0x4d, 0x00, 0x0d, 0x97, 0xfe, 0xff, 0xff, 0xfe, 0x9a, 0x0d, 0x00, 0x00, 0x00, 0x16, 0x9e, 0xfb, 0xff, 0xff, 0xff, 0xea, 0x7d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0xed, 0xe8, 0x62, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x53, 0xe1, 0xf5, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x42, 0x0f, 0x00, 0x25, 0xbe, 0xff, 0xff, 0xc3, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7d, 0xd6, 0x9a, 0x42, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x15, 0x20, 0x3c, 0x4c, 0x5a, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77, 0x78, 0x77, 0x6e, 0x4b, 0x44, 0x26, 0x1d, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xde, 0x9f, 0x0f, 0x00, 0x0d, 0x97, 0xfe, 0xff, 0xff, 0xe0, 0x42, 0x00, 0x00, 0x00, 0x0a, 0x7d, 0xf4, 0xff, 0xf9, 0xd2, 0xef, 0xff, 0xf7, 0x9f, 0x25, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x78, 0xf1, 0xe4, 0x5f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x4d, 0xda, 0xf6, 0x89, 0x12, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4d, 0xe3, 0xff, 0xfb, 0x94, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x26, 0x4c, 0x7d, 0xa5, 0xbe, 0xcd, 0xe0, 0xe0, 0xe0, 0xe5, 0xe0, 0xc3, 0xbe, 0xbe, 0xbe, 0xbe, 0xd7, 0xe5, 0xe5, 0xe0, 0xe0, 0xce, 0xcd, 0xb6, 0x8c, 0x62, 0x3e, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x33, 0x25, 0x01, 0x00, 0x0d, 0x9a, 0xfe, 0xff, 0xfe, 0x9a, 0x0d, 0x00, 0x00, 0x03, 0x59, 0xe6, 0xff, 0xfe, 0xb6, 0x30, 0x68, 0xd9, 0xff, 0xfb, 0xbe, 0x3e, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x78, 0xf1, 0xe4, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd7, 0xf8, 0x8c, 0x12, 0x00, 0x00, 0x00, 0x07, 0x54, 0xcd, 0x89, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x8c, 0xf9, 0xff, 0xea, 0x53, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x47, 0x7d, 0xad, 0xce, 0xde, 0xd6, 0xbe, 0xaa, 0x86, 0x6f, 0x53, 0x40, 0x3c, 0x38, 0x20, 0x1d, 0x1d, 0x1d, 0x1d, 0x2f, 0x3e, 0x3e, 0x44, 0x63, 0x77, 0x9e, 0xb1, 0xcd, 0xe5, 0xdb, 0xc4, 0x97, 0x62, 0x2f, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x96, 0xfe, 0xff, 0xe5, 0x42, 0x00, 0x00, 0x00, 0x39, 0xcf, 0xff, 0xff, 0xf4, 0x7d, 0x07, 0x03, 0x47, 0xc3, 0xfe, 0xff, 0x94, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x86, 0xf8, 0xd3, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0xc3, 0xfc, 0x94, 0x12, 0x00, 0x00, 0x00, 0x01, 0x55, 0xde, 0xff, 0xf0, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbe, 0xff, 0xff, 0xc7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x59, 0x94, 0xc7, 0xe5, 0xdb, 0xb6, 0x86, 0x53, 0x2f, 0x16, 0x07, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0d, 0x25, 0x42, 0x6d, 0x9e, 0xc3, 0xe5, 0xd6, 0xb6, 0x77, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0xde, 0xfc, 0x96, 0x0d, 0x00, 0x00, 0x21, 0xb6, 0xfe, 0xff, 0xff, 0xff, 0xe6, 0x7d, 0x15, 0x00, 0x2b, 0xaa, 0xcd, 0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xa0, 0xfa, 0xc9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb2, 0xfa, 0xaf, 0x25, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0xc7, 0xff, 0xff, 0xe5, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4c, 0xe5, 0xff, 0xfb, 0x94, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x3c, 0x8c, 0xc7, 0xe5, 0xd2, 0x9e, 0x63, 0x38, 0x12, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x1d, 0x47, 0x7d, 0xb6, 0xdb, 0xdb, 0xad, 0x5b, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x3e, 0x7d, 0x33, 0x00, 0x00, 0x15, 0x94, 0xfb, 0xff, 0xf0, 0xbd, 0xeb, 0xff, 0xf4, 0x97, 0x26, 0x01, 0x1d, 0x2f, 0x04, 0x00, 0x00, 0x0a, 0x0f, 0x01, 0x00, 0x00, 0x1d, 0xa5, 0xfc, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x97, 0xfc, 0xba, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xcf, 0xff, 0xff, 0xe6, 0x68, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x8c, 0xfb, 0xfb, 0xb2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x9e, 0xde, 0xde, 0xa5, 0x59, 0x25, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x3c, 0x77, 0xc4, 0xe9, 0xc4, 0x68, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x07, 0x72, 0xf2, 0xff, 0xfb, 0x9a, 0x21, 0x5f, 0xd9, 0xff, 0xfc, 0x85, 0x07, 0x00, 0x00, 0x00, 0x00, 0x05, 0x68, 0x89, 0x15, 0x00, 0x00, 0x00, 0x2f, 0xc0, 0xfc, 0xa4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x82, 0xf6, 0xd6, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0xe5, 0xff, 0xff, 0xe5, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xaa, 0x8c, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0x52, 0xaa, 0xe0, 0xd2, 0x86, 0x39, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x5b, 0xad, 0xe5, 0xd2, 0x82, 0x2f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xcd, 0xff, 0xff, 0xe3, 0x4d, 0x01, 0x03, 0x47, 0xbe, 0xc7, 0x39, 0x01, 0x00, 0x00, 0x00, 0x00, 0x47, 0xde, 0xf5, 0x77, 0x07, 0x00, 0x00, 0x02, 0x3c, 0xd3, 0xf8, 0x82, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xe8, 0xe8, 0x5d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0xe3, 0xff, 0xff, 0xcf, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x47, 0xaa, 0xe5, 0xc7, 0x77, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x52, 0xb2, 0xe9, 0xd2, 0x68, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x68, 0xdb, 0xff, 0xfe, 0xc7, 0x4c, 0x05, 0x00, 0x26, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xbe, 0xff, 0xff, 0xc4, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x5d, 0xe4, 0xed, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0xd3, 0xf8, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0xe3, 0xff, 0xff, 0xce, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x94, 0xde, 0xce, 0x6e, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x52, 0xb2, 0xe5, 0xc4, 0x63, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 0xc4, 0xfe, 0xff, 0xe0, 0x68, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9e, 0xfb, 0xff, 0xe5, 0x5b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0xf5, 0xd3, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xb2, 0xfc, 0xa4, 0x19, 0x00, 0x00, 0x00, 0x15, 0x52, 0x7d, 0x7d, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x68, 0xef, 0xff, 0xff, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0xce, 0xde, 0x8e, 0x2f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x59, 0xb9, 0xe9, 0x97, 0x2f, 0x03, 0x00, 0x00, 0x00, 0x01, 0x2b, 0xaa, 0xf7, 0xff, 0xef, 0x8c, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x07, 0x77, 0xf4, 0xff, 0xf4, 0x7d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9e, 0xfa, 0xb2, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0xfa, 0xc9, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0xaa, 0xf0, 0xfb, 0xf0, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x89, 0xf4, 0xff, 0xfe, 0xb1, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x9f, 0xe9, 0xb6, 0x3e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x77, 0xd9, 0xce, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x19, 0x7d, 0xe5, 0xff, 0xf0, 0x5a, 0x02, 0x00, 0x00, 0x02, 0x52, 0xe3, 0xff, 0xfb, 0x9e, 0x12, 0x00, 0x07, 0x39, 0x4c, 0x0d, 0x00, 0x00, 0x00, 0x25, 0xc0, 0xfa, 0x89, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4d, 0xe4, 0xe4, 0x52, 0x02, 0x00, 0x00, 0x20, 0xb2, 0xff, 0xff, 0xf7, 0xcd, 0x2a, 0x00, 0x0a, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x12, 0x86, 0xf4, 0xff, 0xce, 0x33, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x56, 0xc3, 0xde, 0x7d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3e, 0xb1, 0xe5, 0x93, 0x25, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x5b, 0xd3, 0x9e, 0x19, 0x00, 0x00, 0x00, 0x2f, 0xc7, 0xff, 0xff, 0xb6, 0x25, 0x12, 0x42, 0x8e, 0xd9, 0xe6, 0x62, 0x05, 0x00, 0x00, 0x00, 0x4d, 0xe1, 0xe8, 0x53, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xba, 0xfa, 0x82, 0x07, 0x00, 0x00, 0x07, 0x7d, 0xf9, 0xfe, 0xbd, 0x63, 0x4d, 0x21, 0x5b, 0x9a, 0xa0, 0x72, 0x25, 0x00, 0x00, 0x00, 0x12, 0x8e, 0xc4, 0x47, 0x03, 0x00, 0x00, 0x00, 0x19, 0x82, 0xe5, 0xc4, 0x47, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x89, 0xe5, 0xbd, 0x39, 0x03, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x1d, 0x00, 0x00, 0x00, 0x19, 0xa5, 0xfe, 0xff, 0xce, 0x4d, 0x47, 0xa5, 0xe9, 0xfe, 0xff, 0xff, 0xd7, 0x39, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xf6, 0xc5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x82, 0xf8, 0xba, 0x21, 0x00, 0x00, 0x00, 0x22, 0xce, 0xff, 0xc9, 0x33, 0x01, 0x3c, 0xaa, 0xf2, 0xff, 0xff, 0xf7, 0xa6, 0x20, 0x00, 0x00, 0x00, 0x15, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x2a, 0xa5, 0xe9, 0x9a, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0xd3, 0xd3, 0x5b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x86, 0xf4, 0xff, 0xf1, 0xac, 0xad, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xb2, 0xfa, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xe1, 0xe4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe5, 0xff, 0xaa, 0x21, 0x4c, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xbd, 0xe0, 0x72, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x12, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x38, 0xbd, 0xe0, 0x78, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5b, 0xeb, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xf4, 0xcb, 0xe5, 0xff, 0xff, 0xce, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe1, 0xe8, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb2, 0xfa, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x29, 0xde, 0xff, 0xeb, 0xbd, 0xe3, 0xff, 0xff, 0xfe, 0xde, 0xcd, 0xf9, 0xff, 0xc7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x47, 0xc3, 0xdb, 0x5d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0xaa, 0xb2, 0xaf, 0x72, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9e, 0xe9, 0x86, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x12, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xa6, 0x5d, 0x7e, 0xef, 0xff, 0xe3, 0x56, 0x03, 0x00, 0x07, 0x19, 0x07, 0x00, 0x00, 0x07, 0x78, 0xf8, 0xb2, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6f, 0xf6, 0xc5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xaa, 0x38, 0x2f, 0xce, 0xff, 0xdb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0x52, 0xd7, 0xc7, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x47, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x86, 0xdb, 0xad, 0x94, 0xbd, 0xe9, 0x9f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x8c, 0xde, 0x7e, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x53, 0xe3, 0xfe, 0xe5, 0xaa, 0x52, 0x12, 0x4c, 0xde, 0xff, 0xf0, 0x72, 0x07, 0x0a, 0x38, 0x86, 0xbd, 0x59, 0x04, 0x00, 0x00, 0x21, 0xc5, 0xf6, 0x6d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcd, 0xf1, 0x5f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xc3, 0xfe, 0xff, 0xff, 0xea, 0x86, 0x1d, 0x00, 0x2f, 0xd3, 0xff, 0xb1, 0x16, 0x00, 0x00, 0x00, 0x04, 0x55, 0xdb, 0xc9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x0a, 0x0f, 0x54, 0xcd, 0xd2, 0x6d, 0x2f, 0x2f, 0x47, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xdb, 0x6d, 0x12, 0x07, 0x16, 0x77, 0xe3, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0xde, 0x85, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x93, 0x3e, 0x0f, 0x00, 0x33, 0xc3, 0xff, 0xfb, 0x9a, 0x21, 0x35, 0x8e, 0xde, 0xfe, 0xff, 0xcd, 0x39, 0x00, 0x00, 0x02, 0x5f, 0xf1, 0xd3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0xfa, 0xb2, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0x7d, 0xaa, 0x94, 0x52, 0x16, 0x0d, 0x20, 0x9e, 0xfb, 0xf9, 0x77, 0x03, 0x00, 0x00, 0x00, 0x39, 0xd2, 0xc7, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x93, 0x97, 0x9e, 0xaf, 0x6d, 0x78, 0xc3, 0xc4, 0xd6, 0xdb, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8c, 0xb6, 0x15, 0x00, 0x00, 0x00, 0x19, 0xbe, 0x9f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x74, 0xe0, 0x7e, 0x0f, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x19, 0xaa, 0xfe, 0xff, 0xc3, 0x6f, 0x9a, 0xd9, 0xfe, 0xff, 0xf0, 0xc3, 0x78, 0x1d, 0x00, 0x00, 0x00, 0x16, 0xaa, 0xfa, 0x86, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd6, 0xe8, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x07, 0x0a, 0x72, 0xa5, 0xc3, 0xf9, 0xff, 0xb9, 0x21, 0x00, 0x00, 0x00, 0x2f, 0xbe, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xb6, 0xf8, 0x7d, 0x20, 0x03, 0x07, 0x20, 0x39, 0xaa, 0xc3, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0x85, 0x05, 0x00, 0x00, 0x00, 0x07, 0x8d, 0xb7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8d, 0xf1, 0x7d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x86, 0xf7, 0xff, 0xfc, 0xd6, 0xe6, 0xff, 0xff, 0xeb, 0xb6, 0x59, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe8, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x86, 0xf8, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2a, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xde, 0xff, 0xff, 0xff, 0xcd, 0x42, 0x01, 0x00, 0x00, 0x20, 0xb2, 0xe0, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xef, 0x78, 0x02, 0x00, 0x00, 0x00, 0x0f, 0xaa, 0x7d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x97, 0xa5, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x8d, 0x9a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x9e, 0xde, 0x5b, 0x05, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0x9e, 0x47, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9e, 0xf8, 0x86, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd6, 0xe4, 0x42, 0x00, 0x00, 0x00, 0x13, 0x78, 0xc4, 0xd7, 0xb7, 0x59, 0x07, 0x00, 0x00, 0x00, 0x03, 0x77, 0xea, 0xf5, 0xea, 0xaa, 0x38, 0x03, 0x00, 0x00, 0x15, 0x97, 0xe0, 0x63, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd6, 0xad, 0x12, 0x00, 0x00, 0x00, 0x2b, 0xc1, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x47, 0xc4, 0xe0, 0x52, 0x0d, 0x0d, 0x0f, 0x47, 0xcf, 0xaa, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xad, 0xde, 0x44, 0x00, 0x00, 0x00, 0x02, 0x5d, 0xea, 0xff, 0xff, 0xf9, 0xd6, 0x86, 0x3c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe4, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0xfc, 0xa5, 0x0f, 0x00, 0x00, 0x0d, 0x86, 0xf4, 0xff, 0xff, 0xff, 0xe3, 0x62, 0x05, 0x00, 0x00, 0x01, 0x20, 0x4c, 0x5d, 0x42, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x7d, 0xe9, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa6, 0xd6, 0x2b, 0x00, 0x00, 0x00, 0x47, 0xb7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x63, 0xb1, 0xe5, 0xfe, 0xff, 0xe0, 0xa5, 0xa0, 0xad, 0xe3, 0xfe, 0xf4, 0xc4, 0x6d, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x47, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xc9, 0xc3, 0x2f, 0x00, 0x00, 0x00, 0x0a, 0x7d, 0xea, 0xc3, 0x72, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x9f, 0xfa, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc5, 0xf1, 0x5d, 0x01, 0x00, 0x02, 0x59, 0xeb, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xcf, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0xe5, 0x97, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0xd7, 0x2f, 0x00, 0x00, 0x00, 0x68, 0xaf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x53, 0xb7, 0xbd, 0xb9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc3, 0x5f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x05, 0x52, 0xc4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xeb, 0x9a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4c, 0xde, 0xa5, 0x19, 0x00, 0x00, 0x00, 0x19, 0x4c, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xed, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xf1, 0xba, 0x19, 0x00, 0x00, 0x12, 0xad, 0xff, 0xe5, 0x7d, 0x6d, 0xd9, 0xff, 0xf5, 0x7e, 0x20, 0x20, 0x1d, 0x21, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xc7, 0xbd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0xe5, 0x52, 0x00, 0x00, 0x00, 0x63, 0xac, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x8d, 0xd7, 0x94, 0x25, 0x21, 0xb7, 0xff, 0xff, 0xfb, 0xc3, 0x86, 0x8e, 0xcd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xad, 0x54, 0x19, 0x02, 0x00, 0x2f, 0xd3, 0xf5, 0xe5, 0xe0, 0xe0, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xcf, 0xfe, 0xd2, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0xe9, 0x7e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb2, 0xf6, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa5, 0xf6, 0x72, 0x04, 0x00, 0x00, 0x4d, 0xea, 0xfb, 0x86, 0x0a, 0x03, 0x7d, 0xf9, 0xff, 0xf0, 0xd7, 0xcf, 0xce, 0xcd, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x15, 0xa5, 0xdb, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0xe9, 0x6e, 0x25, 0x40, 0x44, 0x89, 0xaf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x39, 0xaa, 0xd2, 0x62, 0x0f, 0x00, 0x33, 0xcd, 0xff, 0xfe, 0xaf, 0x2a, 0x03, 0x07, 0x2a, 0x7d, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xbe, 0x78, 0x5f, 0xaa, 0xea, 0x78, 0x2f, 0x39, 0x5a, 0x77, 0x5d, 0x2f, 0x16, 0x12, 0x12, 0x12, 0x12, 0x47, 0xe5, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xde, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x68, 0xf6, 0xb2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe1, 0xd6, 0x2b, 0x00, 0x00, 0x12, 0xa5, 0xff, 0xd9, 0x2b, 0x00, 0x07, 0x94, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x15, 0x00, 0x00, 0x04, 0x6e, 0xe9, 0x72, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0xf2, 0xe3, 0xd6, 0xe6, 0xef, 0xf2, 0xeb, 0x97, 0x68, 0x44, 0x25, 0x0f, 0x03, 0x00, 0x00, 0x07, 0x2f, 0x82, 0xd2, 0xa5, 0x35, 0x04, 0x00, 0x21, 0xaa, 0xfe, 0xff, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3c, 0xb7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfc, 0x8e, 0x0f, 0x2f, 0x94, 0xd6, 0xf4, 0xf0, 0xcd, 0x5f, 0x07, 0x00, 0x00, 0x00, 0x3e, 0xe3, 0xbe, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc9, 0xb9, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd3, 0xe8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xfa, 0x9a, 0x0a, 0x00, 0x00, 0x53, 0xea, 0xff, 0xdb, 0x5b, 0x15, 0x38, 0xd9, 0xff, 0xe9, 0xde, 0xe3, 0xf2, 0xf4, 0xe3, 0x4d, 0x00, 0x00, 0x00, 0x38, 0xd6, 0xaa, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xf8, 0xff, 0xf7, 0xe5, 0xde, 0xe0, 0xdb, 0xde, 0xe9, 0xe5, 0xd3, 0xb1, 0x7e, 0x5a, 0x5a, 0x8c, 0xd3, 0xe5, 0x7d, 0x19, 0x00, 0x00, 0x26, 0xa5, 0xfb, 0xff, 0xfe, 0x97, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x9f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa4, 0x21, 0x3c, 0xc7, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xd3, 0x2f, 0x00, 0x00, 0x00, 0x5f, 0xf2, 0x8e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0xe0, 0x86, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8e, 0xf8, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1d, 0xc0, 0xf1, 0x52, 0x00, 0x00, 0x0f, 0xa4, 0xff, 0xff, 0xff, 0xef, 0xaf, 0xaf, 0xfb, 0xe3, 0x5a, 0x2f, 0x35, 0x55, 0x59, 0x4d, 0x0d, 0x00, 0x00, 0x0f, 0x9e, 0xdb, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xbe, 0xe0, 0xa5, 0x5b, 0x35, 0x2f, 0x30, 0x30, 0x33, 0x47, 0x77, 0xaa, 0xd3, 0xf0, 0xf4, 0xf9, 0xff, 0xeb, 0x63, 0x07, 0x00, 0x0f, 0x52, 0xbe, 0xfb, 0xff, 0xff, 0xeb, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xbe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0x19, 0x16, 0xb2, 0xff, 0xfe, 0xbd, 0x82, 0xd9, 0xff, 0xea, 0x47, 0x00, 0x00, 0x16, 0xad, 0xe6, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x94, 0xe5, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe8, 0xc5, 0x21, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4d, 0xed, 0xc0, 0x21, 0x00, 0x00, 0x0a, 0x64, 0xc4, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xe5, 0x7d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xb6, 0xb2, 0x47, 0x2f, 0x33, 0x33, 0x20, 0x0b, 0x04, 0x00, 0x00, 0x02, 0x0d, 0x25, 0x4c, 0x82, 0xb1, 0xe3, 0xde, 0x5d, 0x33, 0x5b, 0xb2, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x1d, 0x04, 0x05, 0x05, 0x05, 0x07, 0x0d, 0x0f, 0x0f, 0x25, 0x85, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x12, 0x5d, 0xef, 0xff, 0xbe, 0x25, 0x2a, 0xc9, 0xff, 0xd6, 0x2f, 0x00, 0x05, 0x72, 0xf0, 0x8e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0xcd, 0xb2, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xc0, 0xed, 0x52, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x07, 0x86, 0xfa, 0x89, 0x07, 0x00, 0x00, 0x00, 0x03, 0x21, 0x6f, 0xc3, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xb2, 0x59, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb9, 0xbe, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0xf2, 0x93, 0x93, 0xc3, 0xc1, 0xbd, 0xaf, 0xa0, 0x85, 0x59, 0x26, 0x07, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3e, 0x85, 0xbd, 0xd2, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x93, 0xb7, 0xb6, 0xb8, 0xd3, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x47, 0xb6, 0xff, 0xf0, 0x63, 0x2a, 0xaa, 0xf9, 0xfe, 0x94, 0x0d, 0x20, 0x77, 0xde, 0xbd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0xe9, 0x63, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x19, 0x03, 0x00, 0x05, 0x82, 0xfa, 0x8e, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x19, 0xc7, 0xed, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x54, 0xb1, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xb1, 0x54, 0x07, 0x00, 0x00, 0x04, 0x6f, 0xe9, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0xe0, 0xaf, 0x68, 0x53, 0x39, 0x2f, 0x35, 0x4c, 0x8d, 0xc4, 0xcd, 0x9e, 0x3e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x72, 0xcd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xc8, 0xf7, 0xff, 0xe0, 0x86, 0xc9, 0xfe, 0xff, 0xf1, 0x95, 0x82, 0xbd, 0xd7, 0x94, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xb1, 0xbe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x4c, 0x86, 0xc3, 0x8d, 0x0f, 0x00, 0x00, 0x42, 0xe8, 0xcd, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x47, 0xed, 0xc5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5b, 0xb1, 0xef, 0xff, 0xff, 0xff, 0xa5, 0x0f, 0x00, 0x00, 0x21, 0xc4, 0xbd, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2b, 0x7d, 0xcd, 0xd6, 0x85, 0x2f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x8e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xde, 0xcf, 0xcd, 0xcb, 0xb9, 0xad, 0xde, 0xf9, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xfb, 0xd9, 0xc7, 0xaa, 0x9e, 0x72, 0x39, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xe5, 0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x2f, 0x54, 0x97, 0xc7, 0xeb, 0xfe, 0xff, 0xcf, 0x2b, 0x00, 0x00, 0x19, 0xc0, 0xed, 0x4d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0x86, 0xfa, 0x8d, 0x07, 0x00, 0x04, 0x16, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x53, 0xad, 0xef, 0xeb, 0x54, 0x01, 0x00, 0x00, 0x62, 0xe5, 0x63, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x26, 0x7d, 0xdb, 0xd6, 0x72, 0x19, 0x00, 0x00, 0x01, 0x33, 0x5f, 0x2a, 0x6e, 0xeb, 0xff, 0xff, 0xfe, 0xfe, 0xea, 0x78, 0x47, 0x33, 0x21, 0x21, 0x21, 0x0f, 0x0b, 0x47, 0x63, 0x54, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x8e, 0x2f, 0x1d, 0x0b, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb1, 0xbd, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x3c, 0x6d, 0xaa, 0xdb, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe5, 0x47, 0x00, 0x00, 0x05, 0x86, 0xfa, 0x86, 0x04, 0x00, 0x00, 
-  0x00, 0x00, 0x19, 0xb6, 0xed, 0x52, 0x00, 0x00, 0x1d, 0xa0, 0xa5, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x59, 0x85, 0x19, 0x00, 0x00, 0x15, 0xb6, 0xbe, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0xad, 0xea, 0xb6, 0x52, 0x0a, 0x03, 0x77, 0xf0, 0xa6, 0x39, 0x97, 0xfe, 0xef, 0xa0, 0x89, 0x5f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x07, 0x94, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xcd, 0xfe, 0xff, 0xb9, 0x21, 0x04, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xe5, 0x59, 0x01, 0x00, 0x00, 0x07, 0x68, 0xb9, 0xe3, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe3, 0xb9, 0x7e, 0x4c, 0x15, 0x00, 0x00, 0x00, 0x4c, 0xed, 0xba, 0x19, 0x00, 0x00, 
-  0x00, 0x00, 0x3c, 0xe1, 0xd3, 0x2a, 0x00, 0x00, 0x47, 0xeb, 0xfe, 0x96, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x4c, 0xe5, 0x77, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6d, 0xce, 0xe5, 0x7e, 0x19, 0x1c, 0xa6, 0xf8, 0xc7, 0xaa, 0xf9, 0xd9, 0x2a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xbe, 0xff, 0xff, 0xff, 0xf7, 0xea, 0xeb, 0x86, 0xaa, 0xf4, 0xe3, 0xa6, 0x9c, 0xaf, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc7, 0xa5, 0x0f, 0x00, 0x00, 0x0d, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xc9, 0x47, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcd, 0xe4, 0x39, 0x00, 0x00, 
-  0x00, 0x00, 0x68, 0xf8, 0x9f, 0x0a, 0x00, 0x03, 0x72, 0xf9, 0xf7, 0x63, 0x01, 0x2f, 0x56, 0x2f, 0x0b, 0x00, 0x13, 0x4c, 0x39, 0x19, 0x01, 0x00, 0x00, 0x0d, 0x94, 0xd3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x94, 0xe0, 0xa5, 0x38, 0x2a, 0x82, 0xde, 0xf9, 0xff, 0xef, 0x5d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x82, 0xf4, 0xff, 0xff, 0xf9, 0x9a, 0x64, 0xe6, 0xcf, 0x56, 0x63, 0x9a, 0xe5, 0xfe, 0xf8, 0x63, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7e, 0xdb, 0x38, 0x00, 0x00, 0x01, 0x63, 0xf5, 0xef, 0xcd, 0x9a, 0x63, 0xc7, 0xff, 0xd3, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x97, 0xf6, 0x68, 0x02, 0x00, 
-  0x00, 0x07, 0x93, 0xfa, 0x78, 0x03, 0x00, 0x0d, 0xa5, 0xff, 0xe3, 0x3c, 0x03, 0x7d, 0xf0, 0xcb, 0x38, 0x00, 0x39, 0xde, 0xe5, 0x77, 0x07, 0x00, 0x00, 0x2a, 0xce, 0x97, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x59, 0xcb, 0xdb, 0x9e, 0x64, 0x6f, 0xc1, 0xfb, 0xff, 0xbd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x7d, 0xf0, 0xff, 0xff, 0xf7, 0x9f, 0x19, 0x0d, 0x7d, 0xef, 0xd9, 0x9f, 0xa5, 0xe6, 0xff, 0xbe, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xdb, 0x77, 0x03, 0x00, 0x00, 0x2a, 0x77, 0x4c, 0x25, 0x0a, 0x04, 0x8c, 0xfe, 0xf0, 0x59, 0x00, 0x07, 0x25, 0x47, 0x3e, 0x04, 0x00, 0x01, 0x6d, 0xf8, 0x94, 0x07, 0x00, 
-  0x00, 0x15, 0xba, 0xed, 0x47, 0x00, 0x00, 0x25, 0xce, 0xff, 0xb9, 0x15, 0x12, 0xb2, 0xff, 0xd6, 0x2a, 0x01, 0x68, 0xf7, 0xfb, 0x78, 0x03, 0x00, 0x00, 0x62, 0xe0, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0x8c, 0xdb, 0xf2, 0xde, 0xe0, 0xfe, 0xff, 0xfb, 0xaf, 0x3c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x42, 0xa5, 0xf4, 0xff, 0xfe, 0xe0, 0x7d, 0x19, 0x00, 0x00, 0x0f, 0x63, 0xb6, 0xcf, 0xcf, 0xc9, 0x9e, 0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xad, 0xb9, 0x19, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf0, 0xfe, 0xaa, 0x5f, 0x94, 0xcd, 0xef, 0xb2, 0x15, 0x00, 0x00, 0x47, 0xed, 0xc0, 0x19, 0x00, 
-  0x00, 0x2f, 0xda, 0xd3, 0x26, 0x00, 0x00, 0x4c, 0xef, 0xfe, 0x86, 0x03, 0x2a, 0xd6, 0xff, 0xaa, 0x12, 0x07, 0x94, 0xff, 0xe6, 0x47, 0x00, 0x00, 0x0a, 0x9f, 0xc9, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x7d, 0xc7, 0xef, 0xfe, 0xff, 0xff, 0xfe, 0xd9, 0x9a, 0x35, 0x0a, 0x38, 0x62, 0x85, 0xb6, 0xe5, 0xfe, 0xfe, 0xcd, 0x8d, 0x3c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x20, 0x20, 0x1d, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0xe5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x5a, 0xe5, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xff, 0xe3, 0x3c, 0x00, 0x00, 0x25, 0xd3, 0xe1, 0x33, 0x00, 
-  0x00, 0x56, 0xf1, 0xb2, 0x12, 0x00, 0x05, 0x7d, 0xfb, 0xfb, 0x96, 0x2f, 0x5d, 0xef, 0xfb, 0x78, 0x03, 0x19, 0xc3, 0xff, 0xc9, 0x21, 0x00, 0x00, 0x26, 0xce, 0x93, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x4c, 0x94, 0xf0, 0xff, 0xff, 0xff, 0xfb, 0x9e, 0x2a, 0x9e, 0xd3, 0xde, 0xeb, 0xff, 0xff, 0xe0, 0x42, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xdb, 0x7e, 0x03, 0x00, 0x00, 0x04, 0x1d, 0x47, 0x7e, 0xb6, 0xe6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe3, 0xbd, 0x3e, 0x00, 0x00, 0x12, 0xaf, 0xf1, 0x56, 0x00, 
-  0x04, 0x78, 0xf8, 0x8c, 0x05, 0x00, 0x12, 0xaa, 0xff, 0xff, 0xf7, 0xde, 0xdb, 0xfe, 0xf4, 0x6e, 0x12, 0x38, 0xe3, 0xff, 0x9e, 0x0d, 0x00, 0x00, 0x5f, 0xdb, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x25, 0xc7, 0xff, 0xff, 0xfe, 0xe5, 0x93, 0x64, 0x7e, 0x6f, 0x4d, 0x9e, 0xf9, 0xff, 0xbe, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xb2, 0xb1, 0x15, 0x00, 0x00, 0x12, 0x93, 0xeb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd9, 0xaf, 0x72, 0x3c, 0x19, 0x04, 0x00, 0x00, 0x05, 0x86, 0xfa, 0x7d, 0x05, 
-  0x0a, 0x94, 0xf1, 0x63, 0x02, 0x00, 0x25, 0xc4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe3, 0xb6, 0xa6, 0xf9, 0xfb, 0x6f, 0x01, 0x00, 0x0a, 0x94, 0xc3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x0a, 0x0a, 0x21, 0xb2, 0xff, 0xff, 0xff, 0xf7, 0xf0, 0xf4, 0xf0, 0xd7, 0x47, 0xaa, 0xff, 0xff, 0xc3, 0x35, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0xde, 0x3c, 0x00, 0x00, 0x07, 0x86, 0xfe, 0xff, 0xff, 0xef, 0xce, 0x9e, 0x5f, 0x2b, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xf5, 0x9e, 0x0d, 
-  0x19, 0xba, 0xed, 0x4c, 0x00, 0x00, 0x0d, 0x42, 0x77, 0xa5, 0xd6, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x47, 0x00, 0x00, 0x1d, 0xc3, 0x97, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3c, 0x7e, 0xa0, 0xa0, 0xa0, 0xa4, 0xe3, 0xff, 0xff, 0xc7, 0x96, 0x96, 0x9e, 0x9e, 0x86, 0x3e, 0x7e, 0xf4, 0xff, 0xf7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xb1, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xdb, 0x68, 0x02, 0x00, 0x00, 0x4d, 0xd3, 0xbe, 0x86, 0x53, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe8, 0xba, 0x1d, 
-  0x2a, 0xd3, 0xe1, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x2a, 0x55, 0x82, 0xb2, 0xdb, 0xef, 0xfe, 0xff, 0xff, 0xc7, 0x1d, 0x00, 0x00, 0x39, 0xde, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x1d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x2b, 0xbd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xde, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xcd, 0xe5, 0xfc, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xff, 0xff, 0xf8, 0x64, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xc3, 0x9e, 0x0a, 0x00, 0x00, 0x0d, 0x2a, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xda, 0xd6, 0x2f, 
-  0x3e, 0xe1, 0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x2b, 0x52, 0x82, 0xad, 0xd9, 0x8c, 0x0a, 0x00, 0x00, 0x68, 0xdb, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0xd2, 0xe3, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xcd, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc7, 0xf7, 0xff, 0xcf, 0x85, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7e, 0x7e, 0x77, 0x7e, 0x7e, 0x7e, 0x9e, 0xf4, 0xfe, 0xd3, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb2, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x97, 0xc4, 0x1d, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xc9, 0xe4, 0x42, 
-  0x4d, 0xe8, 0xb2, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x2b, 0x20, 0x01, 0x00, 0x04, 0x8e, 0xcd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa5, 0xff, 0xff, 0xfe, 0xf7, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xfc, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf7, 0xb2, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x93, 0x96, 0xb7, 0xf0, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0xde, 0x39, 0x00, 0x00, 0x07, 0x55, 0x77, 0x4d, 0x26, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa5, 0xed, 0x56, 
-  0x78, 0xf6, 0x97, 0x0a, 0x00, 0x07, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xb2, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0xd9, 0xff, 0xdb, 0x7e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x6e, 0x77, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6e, 0x6e, 0x6e, 0x6e, 0x7e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xd6, 0xff, 0xfb, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xe5, 0x59, 0x00, 0x00, 0x02, 0x6e, 0xf7, 0xef, 0xd9, 0xad, 0x86, 0x5b, 0x2f, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0xf1, 0x6f, 
-  0x7e, 0xfa, 0x85, 0x01, 0x00, 0x19, 0xb2, 0xad, 0x68, 0x2f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd2, 0x86, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0xf4, 0xf0, 0x6d, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x2f, 0xcd, 0xff, 0xc4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd3, 0x77, 0x03, 0x00, 0x00, 0x54, 0xea, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xd9, 0xb9, 0x8e, 0x68, 0x3e, 0x19, 0x0b, 0x01, 0x00, 0x05, 0x82, 0xfa, 0x96, 
-  0x93, 0xfa, 0x86, 0x01, 0x00, 0x26, 0xd7, 0xff, 0xf9, 0xde, 0x9e, 0x54, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xdb, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xad, 0xff, 0xd6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x8e, 0xfe, 0xe6, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc9, 0x97, 0x05, 0x00, 0x00, 0x1d, 0x5d, 0x86, 0xd6, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xe6, 0xc7, 0x7e, 0x0f, 0x00, 0x00, 0x6e, 0xfa, 0x97, 
-  0xaf, 0xf6, 0x6f, 0x01, 0x00, 0x1d, 0x93, 0xd6, 0xf7, 0xff, 0xff, 0xf0, 0xce, 0x94, 0x52, 0x1c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5d, 0xe0, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe0, 0xff, 0x9f, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x40, 0x67, 0x7d, 0x89, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x74, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x74, 0x62, 0x67, 0x52, 0x0f, 0x01, 0x5a, 0xeb, 0xfb, 0x8c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xb6, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x07, 0x93, 0xff, 0xe6, 0x93, 0x97, 0xb9, 0xe5, 0xfe, 0xff, 0xff, 0xb9, 0x19, 0x00, 0x00, 0x6d, 0xf8, 0x9c, 
-  0xaf, 0xed, 0x4c, 0x00, 0x00, 0x01, 0x0d, 0x2b, 0x62, 0xaa, 0xe5, 0xf9, 0xff, 0xff, 0xeb, 0xc3, 0x82, 0x3c, 0x13, 0x01, 0x00, 0x01, 0x62, 0xd3, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xf7, 0xef, 0x63, 0x03, 0x00, 0x00, 0x3e, 0xdb, 0xfb, 0xfb, 0xf4, 0xf9, 0xfc, 0xfc, 0xfc, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xfc, 0xfe, 0xfb, 0xd3, 0x64, 0x0a, 0x25, 0xc7, 0xff, 0xc3, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x97, 0xc3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x04, 0x89, 0xfe, 0xe5, 0x47, 0x16, 0x55, 0xbd, 0xfc, 0xff, 0xff, 0xc7, 0x20, 0x00, 0x00, 0x68, 0xf5, 0xba, 
-  0xaf, 0xed, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x38, 0x72, 0xad, 0xde, 0xfb, 0xff, 0xfb, 0xe5, 0x96, 0x0f, 0x00, 0x04, 0x82, 0xdb, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xb6, 0xff, 0xce, 0x33, 0x00, 0x00, 0x25, 0xb7, 0xff, 0xf5, 0x96, 0x85, 0x93, 0x93, 0x93, 0x85, 0x62, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x59, 0x93, 0xef, 0xfe, 0xb9, 0x39, 0x03, 0x0d, 0x8c, 0xfe, 0xea, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0xc3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xf9, 0xf2, 0xa0, 0xb6, 0xe5, 0xfe, 0xff, 0xff, 0xff, 0xd4, 0x2a, 0x00, 0x00, 0x4d, 0xe8, 0xc2, 
-  0xaf, 0xed, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x3e, 0x86, 0xe5, 0xff, 0xff, 0xff, 0xa5, 0x0d, 0x00, 0x05, 0x94, 0xcd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xe6, 0xfe, 0x9a, 0x0f, 0x00, 0x00, 0x2f, 0xb2, 0xf9, 0xcf, 0x59, 0x12, 0x04, 0x05, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x19, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x25, 0x05, 0x03, 0x4d, 0xce, 0xf7, 0xaa, 0x2a, 0x00, 0x01, 0x53, 0xea, 0xfb, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x78, 0xe0, 0x39, 0x00, 0x00, 0x00, 0x05, 0x19, 0x7d, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xd9, 0x9a, 0x4c, 0x0b, 0x00, 0x00, 0x35, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4d, 0x00, 0x00, 0x04, 0x0b, 0x20, 0x44, 0x68, 0x94, 0xc3, 0xde, 0xf0, 0xfe, 0xff, 0xff, 0xff, 0x8e, 0x07, 0x00, 0x05, 0x97, 0xb1, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8d, 0xfb, 0xe5, 0x53, 0x02, 0x00, 0x00, 0x1d, 0x8c, 0xeb, 0xeb, 0x94, 0x13, 0x0b, 0x82, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc7, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xcd, 0x6f, 0x0d, 0x3e, 0xd6, 0xf4, 0x8c, 0x1d, 0x00, 0x00, 0x25, 0xc3, 0xff, 0xbe, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6e, 0xe5, 0x42, 0x00, 0x00, 0x07, 0x62, 0xbe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbe, 0x72, 0x2f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4c, 0x00, 0x01, 0x47, 0xa5, 0xc7, 0xea, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd3, 0x6e, 0x07, 0x00, 0x05, 0x93, 0xb6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc3, 0xff, 0xbe, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x5b, 0xe6, 0xde, 0x29, 0x02, 0x56, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd6, 0x6d, 0x15, 0x05, 0x7e, 0xf8, 0x9e, 0x16, 0x00, 0x00, 0x0d, 0x8c, 0xfb, 0xe5, 0x53, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xdb, 0x40, 0x00, 0x00, 0x0b, 0xb1, 0xff, 0xff, 0xff, 0xf9, 0xd9, 0x97, 0x52, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4c, 0x00, 0x03, 0x77, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xc7, 0xad, 0x7d, 0x4c, 0x2a, 0x0d, 0x01, 0x00, 0x05, 0x93, 0xb2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0xe5, 0xfb, 0x8c, 0x0a, 0x00, 0x00, 0x00, 0x19, 0xcd, 0xde, 0x29, 0x00, 0x07, 0x6f, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xb1, 0xb8, 0xa6, 0xb1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc3, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc9, 0x89, 0x2f, 0x04, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x02, 0x56, 0xea, 0xfb, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xd6, 0x40, 0x00, 0x00, 0x0a, 0xaf, 0xff, 0xf2, 0xbe, 0x77, 0x2f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4d, 0x00, 0x03, 0x78, 0xfc, 0xfb, 0xea, 0xc7, 0x9f, 0x6d, 0x47, 0x21, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xb2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8e, 0xfe, 0xe6, 0x52, 0x03, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x0a, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x30, 0x39, 0x47, 0x30, 0x30, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x12, 0x1c, 0x39, 0x56, 0x77, 0x95, 0x95, 0x95, 0x72, 0x5d, 0x47, 0x30, 0x2a, 0x21, 0x25, 0x21, 0x21, 0x25, 0x21, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x2a, 0xc3, 0xff, 0xbe, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd6, 0x40, 0x00, 0x00, 0x07, 0x7e, 0xaa, 0x56, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4d, 0x00, 0x02, 0x5a, 0xa0, 0x6d, 0x42, 0x21, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xb2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xce, 0xff, 0xbd, 0x21, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x02, 0x0a, 0x0f, 0x2a, 0x19, 0x19, 0x16, 0x16, 0x19, 0x19, 0x2b, 0x40, 0x4c, 0x6f, 0x89, 0xa4, 0xb7, 0xc7, 0xb2, 0xa4, 0x72, 0x35, 0x0f, 0x00, 0x00, 0x07, 0x35, 0x89, 0xb7, 0xc7, 0xd4, 0xc0, 0xba, 0xba, 0xba, 0xcd, 0xd4, 0xc7, 0xaf, 0x82, 0x6f, 0x6e, 0x4b, 0x3e, 0x59, 0x6e, 0x5d, 0x0f, 0x00, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x0f, 0x93, 0xfb, 0xeb, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd6, 0x40, 0x00, 0x00, 0x01, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x39, 0xe4, 0xc7, 
-  0xaf, 0xed, 0x4d, 0x00, 0x00, 0x0a, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xb2, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0xef, 0xf7, 0x77, 0x07, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x0f, 0x62, 0x9e, 0x55, 0xba, 0xc5, 0xc2, 0xc2, 0xc2, 0xc2, 0xba, 0xcb, 0xd4, 0xcd, 0xc2, 0xb2, 0x9a, 0x6e, 0x62, 0x78, 0xa4, 0xc7, 0xd4, 0xaf, 0x5b, 0x19, 0x52, 0xcd, 0xba, 0x89, 0x68, 0x68, 0x5f, 0x6f, 0x5d, 0x4d, 0x4d, 0x52, 0x68, 0x9a, 0xba, 0xc2, 0xc2, 0xba, 0xba, 0xc0, 0xcd, 0xdb, 0x55, 0x3c, 0x19, 0x05, 0x86, 0xf2, 0x68, 0x03, 0x59, 0xea, 0xfe, 0x9a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xd6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x19, 0x35, 0x52, 0x77, 0x39, 0x00, 0x00, 0x4d, 0xed, 0xc2, 
-  0xaf, 0xed, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xb6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9f, 0xfe, 0xd9, 0x42, 0x00, 0x1c, 0xcd, 0xde, 0x33, 0x82, 0xef, 0xeb, 0x6e, 0xd4, 0xac, 0x7e, 0x7d, 0x7d, 0x7e, 0x6f, 0x54, 0x4c, 0x39, 0x2a, 0x33, 0x33, 0x47, 0x42, 0x2b, 0x2a, 0x2a, 0x59, 0xaa, 0xe0, 0x82, 0x78, 0xd6, 0x64, 0x89, 0xc3, 0xd4, 0xcd, 0xcf, 0xc7, 0xcd, 0xcb, 0xaf, 0x93, 0x63, 0x47, 0x39, 0x2a, 0x25, 0x21, 0x20, 0x42, 0xcd, 0x86, 0xc9, 0xb6, 0x33, 0x86, 0xf2, 0x68, 0x2a, 0xc3, 0xff, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xdb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0b, 0x20, 0x3c, 0x53, 0x77, 0x9f, 0xbe, 0xe0, 0xf5, 0xe6, 0x4c, 0x00, 0x00, 0x68, 0xf6, 0xba, 
-  0xaf, 0xf6, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0xb9, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xcf, 0xff, 0xb2, 0x19, 0x1c, 0xcd, 0xde, 0x3e, 0xc3, 0xff, 0xe5, 0x63, 0xcf, 0x5a, 0x77, 0x82, 0x53, 0x4c, 0x47, 0x05, 0x21, 0x89, 0xb2, 0xcf, 0xcb, 0xd4, 0xcf, 0xc7, 0xc7, 0x9a, 0x53, 0x30, 0xa0, 0xa4, 0x78, 0xf1, 0xe5, 0xbd, 0x7d, 0x53, 0x35, 0x2b, 0x2f, 0x47, 0x62, 0x89, 0xaf, 0xcd, 0xcd, 0xba, 0xaa, 0x8d, 0x6d, 0x2b, 0x2a, 0xcd, 0x85, 0xce, 0xff, 0x89, 0x86, 0xf2, 0x6d, 0x94, 0xfb, 0xeb, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0xe0, 0x42, 0x00, 0x00, 0x0b, 0x38, 0x5f, 0x86, 0xad, 0xcd, 0xe6, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x2f, 0x00, 0x00, 0x6d, 0xf8, 0x9c, 
-  0x93, 0xfa, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x0a, 0x12, 0x19, 0x2b, 0x34, 0x40, 0x5d, 0x4c, 0x0b, 0x00, 0x05, 0x93, 0xd2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0xf4, 0xf7, 0x6e, 0x20, 0xcd, 0xde, 0x4c, 0xcf, 0xff, 0xe5, 0x68, 0xcf, 0x5a, 0x7e, 0xc7, 0xcd, 0xd4, 0x96, 0x0f, 0x3e, 0xb7, 0x8e, 0x6d, 0x56, 0x3e, 0x40, 0x53, 0x78, 0xaf, 0xcd, 0xb7, 0xbd, 0x9f, 0x78, 0xe4, 0x77, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x2f, 0x53, 0x78, 0xa0, 0xaf, 0xc2, 0x6f, 0x21, 0xaf, 0x7d, 0xb8, 0xff, 0x97, 0x86, 0xf2, 0xaf, 0xe6, 0xfe, 0x9a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x78, 0xdb, 0x33, 0x00, 0x00, 0x2a, 0xc4, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xef, 0xde, 0xaf, 0x25, 0x00, 0x00, 0x6e, 0xfa, 0x9a, 
-  0x7d, 0xfa, 0x85, 0x01, 0x00, 0x04, 0x2f, 0x4c, 0x53, 0x78, 0x8c, 0x9f, 0xb7, 0xc0, 0xdb, 0xe4, 0xed, 0xf6, 0xc0, 0x19, 0x00, 0x04, 0x82, 0xdb, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb2, 0xff, 0xcf, 0x4d, 0xc9, 0xde, 0x64, 0xe0, 0xff, 0xe3, 0x63, 0xcf, 0x5a, 0x07, 0x19, 0x33, 0x39, 0x19, 0x19, 0x3c, 0x3e, 0x0a, 0x00, 0x00, 0x07, 0x38, 0x64, 0x5d, 0x2f, 0x39, 0x78, 0x9e, 0x9f, 0x78, 0xc7, 0x21, 0x00, 0x26, 0x5f, 0x6d, 0x39, 0x07, 0x00, 0x00, 0x07, 0x42, 0x6e, 0x47, 0x12, 0x0a, 0x0f, 0x19, 0x0f, 0x0f, 0x9f, 0x85, 0xb9, 0xff, 0xb6, 0x95, 0xf7, 0xf9, 0xff, 0xcd, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0xc3, 0x21, 0x00, 0x00, 0x42, 0xe6, 0xff, 0xff, 0xfe, 0xf2, 0xe0, 0xce, 0xb2, 0x86, 0x6d, 0x4d, 0x2f, 0x15, 0x04, 0x00, 0x05, 0x86, 0xfa, 0x96, 
-  0x77, 0xf6, 0x9f, 0x0a, 0x00, 0x19, 0xba, 0xf1, 0xf1, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x33, 0x00, 0x01, 0x62, 0xd6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xd9, 0xfe, 0xb7, 0xd6, 0xde, 0x63, 0xe3, 0xff, 0xe3, 0x63, 0xcf, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x30, 0x9e, 0xdb, 0x72, 0x04, 0x00, 0x03, 0x59, 0xc1, 0x7e, 0xaa, 0xb2, 0x2b, 0x02, 0x68, 0x9f, 0x78, 0xc7, 0x25, 0x33, 0x95, 0xa0, 0xd3, 0xd6, 0x4c, 0x02, 0x05, 0x62, 0xc3, 0x82, 0xc1, 0x7d, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0xa4, 0x9e, 0xb7, 0xf2, 0xcd, 0x95, 0xfb, 0xff, 0xeb, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x9e, 0xc3, 0x21, 0x00, 0x00, 0x56, 0xf5, 0xff, 0xff, 0xf8, 0xbd, 0x5a, 0x2a, 0x0f, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0xf1, 0x6f, 
-  0x4d, 0xe8, 0xaf, 0x12, 0x00, 0x21, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xed, 0xe8, 0xda, 0xd3, 0xaf, 0x2f, 0x00, 0x01, 0x56, 0xe0, 0x5d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0xf4, 0xfc, 0xf4, 0xd7, 0x86, 0xf0, 0xff, 0xe5, 0x63, 0xcf, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x64, 0xea, 0x74, 0x03, 0x00, 0x1c, 0xbe, 0xa5, 0x0d, 0x4c, 0xe9, 0x86, 0x07, 0x67, 0xa5, 0x7d, 0xc7, 0x2a, 0x4d, 0x47, 0x0d, 0x5d, 0xf2, 0xa5, 0x0a, 0x26, 0xcd, 0xa5, 0x12, 0x86, 0xd6, 0x38, 0x00, 0x00, 0x00, 0x0f, 0xa4, 0x9e, 0xb7, 0xff, 0xd6, 0xac, 0xfb, 0xfe, 0x9a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb6, 0xad, 0x12, 0x00, 0x00, 0x26, 0x97, 0xe5, 0xfb, 0xff, 0xf7, 0xd6, 0x94, 0x47, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa5, 0xed, 0x56, 
-  0x3e, 0xe1, 0xc0, 0x1d, 0x00, 0x15, 0xa4, 0xda, 0xcd, 0xb2, 0xaf, 0x8c, 0x78, 0x68, 0x4d, 0x47, 0x26, 0x1d, 0x13, 0x04, 0x00, 0x00, 0x33, 0xd6, 0x72, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb6, 0xff, 0xff, 0xd7, 0x93, 0xf5, 0xff, 0xe5, 0x63, 0xcf, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe5, 0x74, 0x03, 0x00, 0x29, 0xd9, 0xaa, 0x0d, 0x33, 0xde, 0xad, 0x12, 0x67, 0xc9, 0x93, 0xc7, 0x25, 0x07, 0x02, 0x00, 0x47, 0xe9, 0x9e, 0x0a, 0x4c, 0xe6, 0x85, 0x05, 0x53, 0xeb, 0x6d, 0x01, 0x00, 0x00, 0x12, 0xa4, 0x9e, 0xb7, 0xe5, 0xac, 0x95, 0xfc, 0xce, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xcd, 0x94, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x3c, 0x7d, 0xc7, 0xf4, 0xff, 0xff, 0xeb, 0xbd, 0x6f, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x1d, 0xc9, 0xe4, 0x42, 
-  0x2a, 0xd3, 0xe1, 0x2f, 0x00, 0x02, 0x19, 0x2a, 0x21, 0x12, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc9, 0x8c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xe3, 0xff, 0xd7, 0x6e, 0xe0, 0xf2, 0xe3, 0x63, 0xcf, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe5, 0x74, 0x03, 0x00, 0x1d, 0xb6, 0xe0, 0x59, 0x39, 0xcf, 0xb1, 0x12, 0x67, 0xcd, 0x95, 0xc7, 0x25, 0x00, 0x00, 0x00, 0x5f, 0xdb, 0x4c, 0x01, 0x5f, 0xeb, 0x5a, 0x00, 0x4d, 0xf0, 0x96, 0x0a, 0x00, 0x00, 0x12, 0xa4, 0xa0, 0xaf, 0x6e, 0x21, 0x86, 0xf5, 0x7d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd3, 0x6d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x63, 0xb2, 0xe5, 0xfe, 0xff, 0xf7, 0xd6, 0x8c, 0x33, 0x01, 0x00, 0x26, 0xda, 0xd6, 0x2f, 
-  0x19, 0xbd, 0xed, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xaa, 0xb2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x82, 0xfb, 0xde, 0x38, 0x4d, 0x68, 0xcf, 0x68, 0xcf, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe5, 0x74, 0x03, 0x00, 0x02, 0x3c, 0xa0, 0x9e, 0x6f, 0xe0, 0xaa, 0x0d, 0x67, 0xcd, 0x95, 0xc7, 0x25, 0x00, 0x00, 0x1c, 0xaf, 0x7d, 0x0b, 0x00, 0x63, 0xeb, 0x5a, 0x00, 0x4d, 0xf0, 0x96, 0x0a, 0x00, 0x00, 0x12, 0xa4, 0xa0, 0xac, 0x55, 0x03, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xe5, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x3e, 0x8c, 0xd6, 0xf9, 0xff, 0xf4, 0x63, 0x01, 0x00, 0x47, 0xe8, 0xba, 0x19, 
-  0x0a, 0x93, 0xf5, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x35, 0x33, 0x04, 0x00, 0x03, 0x85, 0xce, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd6, 0xde, 0x29, 0x00, 0x21, 0xc1, 0x86, 0xc7, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0xe5, 0x74, 0x03, 0x00, 0x00, 0x01, 0x0d, 0x16, 0x82, 0xe9, 0x5f, 0x01, 0x67, 0xcd, 0x95, 0xc7, 0x25, 0x00, 0x0b, 0x77, 0x95, 0x19, 0x0d, 0x0d, 0x56, 0xf1, 0x85, 0x07, 0x53, 0xeb, 0x68, 0x01, 0x00, 0x00, 0x12, 0xa0, 0xaf, 0xbd, 0x55, 0x04, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7d, 0xdb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2f, 0x72, 0xbe, 0xe0, 0x52, 0x01, 0x00, 0x63, 0xf5, 0x9a, 0x0d, 
-  0x03, 0x78, 0xf8, 0x8e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x53, 0x86, 0xbe, 0xe5, 0xbe, 0x20, 0x00, 0x00, 0x5f, 0xdb, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xcd, 0xde, 0x29, 0x00, 0x21, 0xc9, 0x93, 0xc7, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe5, 0x74, 0x03, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe0, 0x97, 0x12, 0x00, 0x67, 0xcd, 0x95, 0xc7, 0x25, 0x0b, 0x78, 0xbd, 0x55, 0x42, 0x86, 0x47, 0x25, 0xcd, 0x97, 0x0d, 0x86, 0xdb, 0x38, 0x00, 0x00, 0x00, 0x12, 0xac, 0xc9, 0xc9, 0x35, 0x04, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa5, 0xb6, 0x19, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x4d, 0x2a, 0x01, 0x05, 0x86, 0xfa, 0x7d, 0x04, 
-  0x00, 0x56, 0xf1, 0xb2, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x3c, 0x6e, 0x9f, 0xcf, 0xef, 0xfe, 0xff, 0xff, 0xeb, 0x47, 0x00, 0x00, 0x33, 0xdb, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x19, 0xb7, 0x96, 0xcd, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x19, 0x7d, 0xe0, 0xaa, 0x4d, 0x07, 0x01, 0x0f, 0x4c, 0xb7, 0xaa, 0x2a, 0x00, 0x00, 0x67, 0xcd, 0x95, 0xc7, 0x2a, 0x63, 0xd6, 0xd6, 0xc7, 0xcd, 0xc2, 0x2f, 0x04, 0x72, 0xc3, 0x85, 0xc1, 0x82, 0x0d, 0x00, 0x00, 0x00, 0x0a, 0x93, 0xc9, 0xc1, 0x29, 0x03, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcd, 0x94, 0x07, 0x00, 0x02, 0x42, 0x78, 0x3e, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0xaf, 0xf1, 0x52, 0x00, 
-  0x00, 0x2b, 0xda, 0xd3, 0x26, 0x00, 0x03, 0x1d, 0x4c, 0x86, 0xbd, 0xe3, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x33, 0x00, 0x00, 0x19, 0xb9, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0f, 0xaa, 0xc8, 0xd6, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x15, 0x47, 0x44, 0x47, 0x39, 0x04, 0x12, 0x6f, 0x95, 0x5d, 0x15, 0x00, 0x00, 0x00, 0x67, 0xcd, 0x95, 0xc7, 0x30, 0x47, 0x5d, 0x6e, 0x86, 0x6e, 0x47, 0x0d, 0x00, 0x0b, 0x44, 0x7d, 0x56, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xc9, 0xbd, 0x29, 0x03, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xe0, 0x5f, 0x01, 0x00, 0x0a, 0x9e, 0xfc, 0xe6, 0xb9, 0x7d, 0x4c, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xd3, 0xe1, 0x33, 0x00, 
-  0x00, 0x15, 0xba, 0xed, 0x47, 0x00, 0x0d, 0x93, 0xeb, 0xfe, 0xff, 0xfe, 0xef, 0xce, 0xd6, 0xfe, 0xff, 0xff, 0xcf, 0x47, 0x03, 0x00, 0x00, 0x07, 0x8c, 0xce, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0a, 0x9a, 0xc9, 0xd6, 0x5a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x29, 0x47, 0x64, 0x56, 0x47, 0x3e, 0x1c, 0x07, 0x00, 0x68, 0xcd, 0x95, 0xcf, 0x93, 0xb7, 0xc4, 0xc3, 0xcd, 0xc3, 0xbd, 0x94, 0x4c, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0f, 0x01, 0x00, 0x73, 0xb7, 0xb7, 0x29, 0x03, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x82, 0xd6, 0x33, 0x00, 0x00, 0x26, 0xce, 0xff, 0xff, 0xff, 0xfe, 0xeb, 0xc3, 0x8c, 0x59, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xed, 0xc0, 0x19, 0x00, 
-  0x00, 0x07, 0x93, 0xfa, 0x78, 0x03, 0x02, 0x6e, 0xf4, 0xe5, 0xbe, 0x86, 0x56, 0x5a, 0xd2, 0xff, 0xff, 0xcf, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0xde, 0x5f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0a, 0x93, 0xc9, 0xd6, 0x5a, 0x16, 0x72, 0x62, 0x35, 0x2f, 0x35, 0x5a, 0x7e, 0xb7, 0xcd, 0xcf, 0xcf, 0xc7, 0xcf, 0xd4, 0xc0, 0x86, 0x3e, 0x6d, 0xcd, 0x95, 0xe5, 0xac, 0x85, 0x63, 0x40, 0x35, 0x4c, 0x7d, 0xb6, 0xd7, 0xad, 0x74, 0x59, 0x35, 0x47, 0x6e, 0xa4, 0x86, 0x0f, 0x00, 0x73, 0xa4, 0x93, 0x29, 0x03, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xbd, 0xad, 0x12, 0x00, 0x00, 0x59, 0xf2, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd3, 0x97, 0x5b, 0x2b, 0x07, 0x00, 0x01, 0x6d, 0xf8, 0x94, 0x07, 0x00, 
-  0x00, 0x00, 0x63, 0xf6, 0xa5, 0x0d, 0x00, 0x2f, 0x6e, 0x39, 0x19, 0x05, 0x39, 0xc7, 0xff, 0xff, 0xcf, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd2, 0x9e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0f, 0xaa, 0xc8, 0xd6, 0x5a, 0x12, 0x85, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xb7, 0x8d, 0x59, 0x42, 0x3e, 0x2f, 0x42, 0x44, 0x6d, 0xb7, 0xcd, 0xd2, 0xd6, 0x95, 0xc7, 0x2f, 0x04, 0x01, 0x00, 0x00, 0x00, 0x03, 0x16, 0x52, 0x94, 0xbd, 0xd2, 0xc0, 0xcd, 0xcf, 0xa4, 0x56, 0x07, 0x00, 0x73, 0xa4, 0x2a, 0x0b, 0x04, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xe5, 0x7d, 0x04, 0x00, 0x07, 0x94, 0xfe, 0xf0, 0x85, 0x89, 0xc3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xb7, 0x21, 0x00, 0x12, 0xa4, 0xf5, 0x63, 0x01, 0x00, 
-  0x00, 0x00, 0x38, 0xe1, 0xd3, 0x2a, 0x00, 0x01, 0x01, 0x00, 0x00, 0x39, 0xc7, 0xff, 0xff, 0xd9, 0x44, 0x00, 0x00, 0x07, 0x1d, 0x2f, 0x07, 0x00, 0x0d, 0x9e, 0xd3, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0f, 0x9e, 0x93, 0xcd, 0x5a, 0x00, 0x0a, 0x33, 0x55, 0x59, 0x4c, 0x2f, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x59, 0xcd, 0xd4, 0x95, 0xc7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2f, 0x2f, 0x2f, 0x2a, 0x0d, 0x01, 0x00, 0x00, 0x73, 0xc9, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7d, 0xde, 0x42, 0x00, 0x00, 0x19, 0xc3, 0xff, 0xcd, 0x25, 0x03, 0x68, 0xf7, 0xfb, 0xd2, 0xde, 0xf9, 0xff, 0xff, 0xa5, 0x0f, 0x00, 0x25, 0xcd, 0xe4, 0x38, 0x00, 0x00, 
-  0x00, 0x00, 0x16, 0xb6, 0xed, 0x52, 0x00, 0x00, 0x00, 0x01, 0x3c, 0xc7, 0xff, 0xff, 0xe5, 0x64, 0x12, 0x2f, 0x5f, 0x94, 0xcd, 0xbd, 0x25, 0x00, 0x00, 0x53, 0xe0, 0x5f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x07, 0x7e, 0x86, 0xc7, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x05, 0x00, 0x00, 0x6d, 0xcd, 0x95, 0xc7, 0x25, 0x00, 0x05, 0x0f, 0x0d, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0xc9, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb9, 0xad, 0x12, 0x00, 0x00, 0x47, 0xe5, 0xff, 0x97, 0x0a, 0x0a, 0x97, 0xff, 0xe0, 0x47, 0x33, 0xaa, 0xff, 0xf4, 0x62, 0x01, 0x00, 0x4d, 0xed, 0xba, 0x19, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0x82, 0xfa, 0x93, 0x07, 0x00, 0x02, 0x3e, 0xc9, 0xff, 0xff, 0xf1, 0x95, 0x78, 0xad, 0xd6, 0xf4, 0xff, 0xff, 0xe9, 0x4d, 0x00, 0x00, 0x20, 0xc9, 0xa5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x01, 0x47, 0x5a, 0xcf, 0x5a, 0x0a, 0x19, 0x0f, 0x0a, 0x0a, 0x13, 0x0f, 0x01, 0x20, 0x7d, 0xb7, 0xba, 0xb1, 0xba, 0xb7, 0x86, 0x4c, 0x15, 0x68, 0xcd, 0x95, 0xc3, 0x3c, 0x5f, 0x8c, 0xb7, 0xaa, 0x86, 0x77, 0x40, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x07, 0x73, 0xc9, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xde, 0x6d, 0x02, 0x00, 0x07, 0x82, 0xfb, 0xf4, 0x59, 0x00, 0x2a, 0xcf, 0xff, 0xad, 0x0f, 0x12, 0xb2, 0xff, 0xde, 0x33, 0x00, 0x05, 0x86, 0xfa, 0x86, 0x04, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x47, 0xe8, 0xc5, 0x21, 0x00, 0x16, 0xb2, 0xff, 0xff, 0xff, 0xf4, 0xe6, 0xfb, 0xff, 0xff, 0xf7, 0xd9, 0xb2, 0x78, 0x25, 0x00, 0x00, 0x07, 0x86, 0xdb, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x03, 0x35, 0xcf, 0x5a, 0x47, 0xba, 0xb2, 0x9a, 0xa0, 0xba, 0x89, 0x0a, 0x38, 0x9e, 0x9a, 0x85, 0x5f, 0x85, 0x94, 0xb2, 0xd7, 0xb7, 0xb7, 0xd6, 0x86, 0xd6, 0xbd, 0xc9, 0xa5, 0x94, 0x97, 0xaa, 0xc4, 0xd7, 0xc3, 0x86, 0x47, 0x20, 0x0b, 0x07, 0x07, 0x13, 0x68, 0xaf, 0x33, 0x78, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8e, 0xd3, 0x2b, 0x00, 0x00, 0x19, 0xbd, 0xff, 0xde, 0x33, 0x00, 0x59, 0xf4, 0xfe, 0x7d, 0x03, 0x33, 0xd9, 0xff, 0xb2, 0x16, 0x00, 0x19, 0xc0, 0xed, 0x4c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x19, 0xc3, 0xed, 0x4c, 0x00, 0x0f, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xc9, 0x97, 0x5f, 0x2f, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xde, 0x86, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x1d, 0x72, 0xa0, 0x9c, 0x9c, 0x93, 0x4d, 0x07, 0x04, 0x0d, 0x07, 0x04, 0x00, 0x03, 0x04, 0x15, 0x47, 0x9a, 0xe1, 0xd4, 0x6e, 0xc2, 0x6e, 0x33, 0x0a, 0x05, 0x05, 0x0f, 0x21, 0x4d, 0x82, 0xbd, 0xd7, 0xc4, 0xa5, 0x9a, 0x9e, 0xb1, 0xcd, 0x86, 0x16, 0x74, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd3, 0x94, 0x0a, 0x00, 0x00, 0x0d, 0x59, 0xa5, 0x8d, 0x0f, 0x02, 0x52, 0xc4, 0xd7, 0x47, 0x01, 0x6d, 0xf7, 0xfb, 0x77, 0x03, 0x00, 0x47, 0xe8, 0xc7, 0x1d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x86, 0xfa, 0x8d, 0x07, 0x02, 0x72, 0xfc, 0xf7, 0xe0, 0xb6, 0x7d, 0x47, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa5, 0xcd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x00, 0x02, 0x05, 0x05, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x7d, 0xd6, 0x6e, 0xb2, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x47, 0x77, 0xa4, 0xaf, 0xaf, 0x86, 0x39, 0x07, 0x00, 0x74, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0xe5, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0d, 0x12, 0x01, 0x00, 0x07, 0x20, 0x38, 0x0d, 0x0f, 0xaa, 0xff, 0xe3, 0x3e, 0x00, 0x05, 0x82, 0xfa, 0x8c, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4d, 0xe8, 0xc5, 0x21, 0x00, 0x38, 0x96, 0x5f, 0x2f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x02, 0x00, 0x00, 0x00, 0x59, 0xe5, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x19, 0x19, 0x20, 0x2f, 0x1d, 0x19, 0x0d, 0x03, 0x00, 0x00, 0x68, 0xcd, 0x6e, 0xb2, 0x26, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x19, 0x0f, 0x07, 0x02, 0x00, 0x01, 0x07, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x74, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc3, 0xaa, 0x16, 0x00, 0x00, 0x25, 0x47, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd6, 0xff, 0xc3, 0x19, 0x00, 0x1d, 0xc0, 0xed, 0x4d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1d, 0xc0, 0xf1, 0x52, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x5f, 0x8e, 0x97, 0x63, 0x19, 0x00, 0x00, 0x19, 0xb7, 0xbe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x21, 0x7d, 0x6d, 0x56, 0x56, 0x5f, 0x82, 0xaa, 0xc2, 0xc0, 0xc0, 0xc5, 0xc0, 0xc2, 0xaa, 0x78, 0x44, 0x0f, 0x67, 0xcd, 0x6e, 0xc7, 0x38, 0x04, 0x2b, 0x6d, 0x97, 0xaa, 0xc1, 0xaf, 0x94, 0x3e, 0x3e, 0x5b, 0x40, 0x2b, 0x13, 0x0f, 0x0b, 0x01, 0x00, 0x74, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6e, 0xe5, 0x53, 0x00, 0x00, 0x0d, 0x8c, 0xe5, 0x97, 0x35, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7d, 0xbd, 0x6f, 0x07, 0x00, 0x52, 0xed, 0xc5, 0x21, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0xfa, 0x9e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x68, 0xc7, 0xf7, 0xff, 0xff, 0xf4, 0xa5, 0x20, 0x00, 0x01, 0x59, 0xe9, 0x7d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x1d, 0x96, 0xcf, 0xcf, 0xcd, 0xcf, 0xb7, 0x93, 0x78, 0x6f, 0x4b, 0x4b, 0x63, 0x78, 0x93, 0xba, 0xd4, 0x82, 0x73, 0xc2, 0x64, 0xcf, 0x55, 0x78, 0xcd, 0xcd, 0xa4, 0x7d, 0x78, 0x7d, 0x93, 0x39, 0x7e, 0xcf, 0xd4, 0xcd, 0xba, 0xba, 0x78, 0x0d, 0x00, 0x78, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc7, 0xad, 0x15, 0x00, 0x00, 0x2a, 0xcb, 0xff, 0xfe, 0xde, 0x86, 0x26, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x15, 0x0d, 0x00, 0x07, 0x9a, 0xfa, 0x7d, 0x05, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe1, 0xda, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5f, 0xbd, 0xf4, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xfb, 0x93, 0x0d, 0x00, 0x15, 0xaa, 0xce, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x35, 0xcf, 0x5a, 0x00, 0x0d, 0x2a, 0x2f, 0x2f, 0x2a, 0x15, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x19, 0x4d, 0x55, 0x73, 0xa5, 0x52, 0xcf, 0xac, 0xd7, 0x89, 0x2f, 0x0a, 0x02, 0x02, 0x03, 0x07, 0x03, 0x0f, 0x2a, 0x42, 0x54, 0x78, 0x7d, 0x40, 0x04, 0x02, 0x7d, 0xcd, 0x21, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xe5, 0x52, 0x01, 0x00, 0x00, 0x0b, 0x42, 0xaa, 0xeb, 0xff, 0xfb, 0xce, 0x72, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xd3, 0xe4, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa5, 0xf8, 0x78, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0xaa, 0xef, 0xff, 0xff, 0xef, 0xa5, 0x53, 0x5d, 0xd2, 0xff, 0xeb, 0x53, 0x00, 0x00, 0x47, 0xde, 0x8e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x00, 0x00, 0x33, 0xd4, 0x6e, 0x0f, 0x04, 0x03, 0x03, 0x03, 0x03, 0x0a, 0x12, 0x12, 0x26, 0x34, 0x35, 0x20, 0x0f, 0x07, 0x02, 0x00, 0x00, 0x67, 0x9f, 0x52, 0xcf, 0x86, 0x55, 0x07, 0x00, 0x0f, 0x2f, 0x56, 0x63, 0x6d, 0x6d, 0x5f, 0x4d, 0x20, 0x07, 0x05, 0x07, 0x0d, 0x2f, 0x72, 0xcd, 0xb7, 0x1d, 0x00, 0x05, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xde, 0x97, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x52, 0xb6, 0xf7, 0xff, 0xf7, 0xbe, 0x62, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6d, 0xf6, 0xaf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xf1, 0xba, 0x1d, 0x00, 0x02, 0x2f, 0x9e, 0xea, 0xff, 0xff, 0xf0, 0xb6, 0x59, 0x12, 0x00, 0x01, 0x53, 0xeb, 0xff, 0x9f, 0x0d, 0x00, 0x0a, 0x8c, 0xe5, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x02, 0x2b, 0x3e, 0xa4, 0xd4, 0xaf, 0x97, 0x8e, 0x8d, 0x8e, 0x8e, 0xa4, 0xb7, 0xb2, 0xc7, 0xd4, 0xd4, 0xc0, 0xaf, 0x9f, 0x86, 0x62, 0x4c, 0x85, 0x9f, 0x55, 0xd4, 0x47, 0x0a, 0x2a, 0x5f, 0xaa, 0xd4, 0xd4, 0xc7, 0xb1, 0xb1, 0xc2, 0xd4, 0xc7, 0xa4, 0x8e, 0x97, 0xaf, 0xcd, 0xc7, 0x7e, 0x33, 0x55, 0x2f, 0x04, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9f, 0xd6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x6f, 0xc3, 0xf7, 0xff, 0xf2, 0xb2, 0x4d, 0x0f, 0x02, 0x00, 0x00, 0x19, 0xba, 0xf5, 0x63, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc0, 0xf1, 0x5d, 0x00, 0x07, 0x89, 0xfb, 0xff, 0xf9, 0xc9, 0x68, 0x15, 0x00, 0x00, 0x00, 0x00, 0x26, 0xd9, 0xff, 0xd3, 0x25, 0x00, 0x00, 0x26, 0xc3, 0xb9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x00, 0x0d, 0xa0, 0xa4, 0x30, 0x64, 0x8d, 0xaf, 0xba, 0xbd, 0xba, 0xa4, 0x8c, 0x8d, 0x7d, 0x5f, 0x5a, 0x5a, 0x6e, 0x89, 0x9a, 0xba, 0xc5, 0xd4, 0xe0, 0xa5, 0x4d, 0xdb, 0x9e, 0x9a, 0xcd, 0xdb, 0xad, 0x62, 0x38, 0x39, 0x2f, 0x2f, 0x3e, 0x56, 0x85, 0x9a, 0xbd, 0xa4, 0x8d, 0x6f, 0x47, 0x2a, 0x1d, 0xb7, 0x7d, 0x0d, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x62, 0xe0, 0x6d, 0x05, 0x00, 0x02, 0x21, 0x3e, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x3e, 0x5a, 0xbd, 0xfc, 0xff, 0xff, 0xea, 0xa0, 0x25, 0x00, 0x00, 0x4d, 0xed, 0xc5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6d, 0xfa, 0xaa, 0x0f, 0x00, 0x39, 0xd6, 0xcf, 0x72, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6e, 0xef, 0xff, 0xe3, 0x2f, 0x00, 0x00, 0x01, 0x53, 0xe0, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x12, 0x64, 0xe1, 0xe4, 0x93, 0xaf, 0x8d, 0x6e, 0x6f, 0x6e, 0x77, 0x96, 0x9c, 0x9c, 0x9c, 0x96, 0x55, 0x05, 0x01, 0x07, 0x0a, 0x12, 0x20, 0x39, 0x53, 0x40, 0x21, 0x9f, 0xba, 0x9a, 0x6d, 0x3e, 0x13, 0x00, 0x16, 0x96, 0xc9, 0xc7, 0xc7, 0xc3, 0xbd, 0xa6, 0xa0, 0x96, 0x97, 0xa6, 0xc9, 0xcd, 0xad, 0xf0, 0xe6, 0x5f, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0xa5, 0x15, 0x00, 0x00, 0x25, 0xb7, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xef, 0xeb, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xc9, 0x25, 0x00, 0x0f, 0x9f, 0xfa, 0x7d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd6, 0xe4, 0x47, 0x00, 0x07, 0x47, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x39, 0x97, 0xeb, 0xff, 0xff, 0xd3, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x8e, 0xe5, 0x53, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x39, 0xd4, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xf6, 0xf5, 0xf5, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x85, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x15, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x7d, 0xe9, 0xf5, 0xf8, 0xf7, 0xfb, 0xfe, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xad, 0xd6, 0x39, 0x00, 0x00, 0x04, 0x77, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x72, 0x04, 0x00, 0x47, 0xe8, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0xf8, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x93, 0xe0, 0xfe, 0xff, 0xff, 0xf8, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x25, 0xbd, 0xcd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xde, 0x29, 0x12, 0xa5, 0xf1, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xea, 0xe4, 0xe1, 0xe0, 0xc7, 0xbe, 0xc0, 0x8d, 0x2a, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x0d, 0x42, 0x59, 0x5a, 0x5a, 0x68, 0x86, 0x85, 0x82, 0x86, 0x85, 0xaf, 0xc1, 0xc1, 0xb7, 0x94, 0x4d, 0x86, 0xf2, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x86, 0xe9, 0x68, 0x04, 0x00, 0x00, 0x07, 0x68, 0xde, 0xfe, 0xff, 0xff, 0xfe, 0xe5, 0xbe, 0xc3, 0xc3, 0xc4, 0xc3, 0xc3, 0xc3, 0x96, 0x1d, 0x00, 0x0f, 0x9f, 0xf8, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xd6, 0xe8, 0x52, 0x02, 0x00, 0x00, 0x00, 0x04, 0x25, 0x77, 0xd3, 0xfe, 0xff, 0xff, 0xff, 0xe6, 0x82, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xd6, 0xb6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcd, 0xef, 0x7e, 0x68, 0x85, 0xac, 0xbd, 0xbd, 0xbd, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xac, 0x9e, 0x9e, 0x96, 0x96, 0x93, 0x9a, 0x9a, 0x9a, 0x94, 0x64, 0x0d, 0x00, 0x00, 0x04, 0x38, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x62, 0x68, 0x68, 0x6e, 0x85, 0x9e, 0x9e, 0x96, 0x96, 0xcb, 0xf4, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5b, 0xe5, 0x9a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x38, 0x94, 0xe6, 0xff, 0xff, 0xde, 0x89, 0x3e, 0x19, 0x15, 0x16, 0x16, 0x16, 0x0d, 0x01, 0x00, 0x47, 0xe8, 0xd6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x85, 0xfa, 0xb7, 0x19, 0x00, 0x01, 0x15, 0x6f, 0xcd, 0xf9, 0xff, 0xff, 0xff, 0xef, 0xaa, 0x4c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0xe9, 0x94, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xcb, 0xfe, 0xf8, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xeb, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xff, 0xff, 0xf7, 0xf4, 0xf4, 0xf4, 0xf5, 0xfb, 0xf1, 0x62, 0x03, 0x01, 0x44, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0xdb, 0xb2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0xaa, 0xef, 0xff, 0xfb, 0xcd, 0x68, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xaf, 0xfa, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc5, 0xf1, 0x5f, 0x02, 0x01, 0x55, 0xea, 0xff, 0xff, 0xff, 0xf4, 0xc4, 0x5f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7d, 0xe9, 0x7d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6f, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x78, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0xa5, 0xfb, 0xfc, 0x9e, 0x59, 0x5b, 0x5b, 0x59, 0x7e, 0xe5, 0xd7, 0x54, 0x47, 0xce, 0xf4, 0xa6, 0x85, 0x85, 0x85, 0x8e, 0xd3, 0xff, 0xf4, 0xaa, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x85, 0x85, 0x7e, 0x62, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x56, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xc3, 0xcd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x59, 0xbd, 0xf4, 0xff, 0xf4, 0xbe, 0x59, 0x13, 0x01, 0x00, 0x02, 0x63, 0xf1, 0xcd, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x68, 0xf5, 0xc5, 0x26, 0x00, 0x21, 0xbe, 0xff, 0xf9, 0xc7, 0x68, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x9e, 0xe5, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xcd, 0xff, 0xbd, 0x25, 0x00, 0x00, 0x00, 0x07, 0x77, 0xf0, 0xe3, 0xd9, 0xf8, 0x96, 0x16, 0x02, 0x03, 0x02, 0x3c, 0xd6, 0xff, 0xaa, 0x16, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xbd, 0xde, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x6d, 0xcd, 0xfb, 0xff, 0xea, 0x6e, 0x04, 0x00, 0x25, 0xc5, 0xf6, 0x68, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xaf, 0xfa, 0x86, 0x0b, 0x00, 0x5b, 0xc9, 0x7d, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xa5, 0xdb, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xef, 0xf9, 0x85, 0x0a, 0x00, 0x00, 0x00, 0x12, 0x7e, 0xea, 0xef, 0x94, 0x19, 0x00, 0x00, 0x00, 0x15, 0xad, 0xff, 0xd9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xa5, 0xe0, 0x5f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x7d, 0xd9, 0xd6, 0x3c, 0x00, 0x07, 0x7d, 0xf8, 0xb2, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xe1, 0xe4, 0x4d, 0x00, 0x0f, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xc3, 0xdb, 0x53, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9a, 0xfe, 0xe3, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x52, 0x53, 0x12, 0x00, 0x00, 0x00, 0x04, 0x6e, 0xf4, 0xf7, 0x72, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x97, 0xd9, 0x62, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3c, 0x55, 0x07, 0x00, 0x47, 0xe1, 0xe4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xf8, 0xc0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0xc4, 0xde, 0x53, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xce, 0xff, 0xb9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xd9, 0xff, 0xad, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x97, 0xe9, 0x78, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1d, 0xb7, 0xfa, 0x86, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xba, 0xfa, 0x86, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x26, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc4, 0xdb, 0x5b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x63, 0xef, 0xfb, 0x7e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa6, 0xff, 0xd9, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa5, 0xd9, 0x78, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x82, 0xf6, 0xc0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe1, 0xe8, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0xd3, 0xd9, 0x9f, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xad, 0xe5, 0x7d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9e, 0xfe, 0xe3, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0xf4, 0xf4, 0x72, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0xbe, 0xe0, 0x62, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xe4, 0xe4, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0xf6, 0xcd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe3, 0xff, 0xff, 0xfb, 0x86, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x9e, 0xe9, 0x94, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xce, 0xff, 0xb6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xd6, 0xff, 0xad, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x54, 0xcd, 0xd6, 0x5d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x68, 0xc7, 0xd6, 0x94, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc0, 0xf8, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xaa, 0xfc, 0xaa, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xf4, 0xff, 0xff, 0xff, 0xb7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x7d, 0xe5, 0xb6, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0xef, 0xf9, 0x7d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa5, 0xff, 0xd6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x77, 0xe3, 0xc4, 0x3e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0xff, 0xff, 0xfb, 0x7d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9f, 0xfa, 0xaf, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xcd, 0xf8, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xd9, 0xff, 0xff, 0xf9, 0x7d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x59, 0xd3, 0xd6, 0x68, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xfe, 0xde, 0x4d, 0x02, 0x00, 0x00, 0x05, 0x72, 0xf4, 0xf4, 0x6d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38, 0xa5, 0xe5, 0x9e, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0xef, 0xff, 0xff, 0xff, 0x9c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0xf6, 0xcd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0xe4, 0xe8, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x68, 0xbe, 0xc9, 0x93, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x38, 0xb2, 0xe9, 0x94, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xce, 0xff, 0xc4, 0x2a, 0x00, 0x00, 0x3c, 0xd9, 0xfe, 0xaa, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5b, 0xce, 0xde, 0x72, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xe0, 0xff, 0xff, 0xfb, 0x7d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d, 0xe8, 0xe8, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x78, 0xf5, 0xda, 0x4c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x77, 0xdb, 0xce, 0x62, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0xeb, 0xfe, 0x93, 0x0a, 0x19, 0xaa, 0xff, 0xd6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x38, 0x9e, 0xe5, 0xb6, 0x3e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0xc9, 0xd2, 0x9a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3e, 0xd6, 0xf6, 0x7d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0xfc, 0xc5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x47, 0xb6, 0xe5, 0xad, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x94, 0xfe, 0xea, 0x56, 0x72, 0xf4, 0xf4, 0x72, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x7d, 0xd6, 0xdb, 0x82, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x53, 0x8c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xc0, 0xfa, 0xa0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xaf, 0xfc, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x39, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6d, 0xd2, 0xe0, 0x97, 0x3e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xc9, 0xff, 0xdb, 0xe3, 0xff, 0xa6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x19, 0x68, 0xcd, 0xe5, 0x9e, 0x3c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x86, 0xea, 0xe0, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xaa, 0xfc, 0xb2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0xc0, 0xfc, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7d, 0xce, 0xe0, 0xd6, 0x8e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x86, 0xd3, 0xdb, 0x97, 0x44, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0xe5, 0xff, 0xff, 0xd9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2a, 0x72, 0xbe, 0xe5, 0xb7, 0x56, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0xb1, 0xf7, 0xcf, 0x52, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xa0, 0xfa, 0xc5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0xd7, 0xfa, 0x8e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa0, 0xfc, 0xe3, 0xad, 0xbe, 0xf2, 0x94, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2f, 0x82, 0xd3, 0xe5, 0xaf, 0x59, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x86, 0xf7, 0xf7, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x35, 0x7e, 0xcd, 0xe5, 0xb2, 0x5d, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0xe0, 0xf5, 0xf9, 0xc9, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x86, 0xfa, 0xd3, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x4c, 0xda, 0xf6, 0x8d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0xf4, 0xdb, 0x52, 0x0d, 0x21, 0xb6, 0xe6, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2f, 0x7d, 0xc3, 0xe0, 0xbe, 0x86, 0x40, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x77, 0x7d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x2b, 0x5f, 0xa5, 0xdb, 0xde, 0x9f, 0x4c, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2f, 0x21, 0x9a, 0xcd, 0x63, 0x9e, 0xf7, 0x97, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7d, 0xf1, 0xe1, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0xda, 0xf6, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xc7, 0xef, 0x63, 0x04, 0x00, 0x04, 0x89, 0xf8, 0x68, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x63, 0xad, 0xde, 0xde, 0xb9, 0x86, 0x4c, 0x2b, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x19, 0x39, 0x6d, 0xa5, 0xd3, 0xe5, 0xc7, 0x8c, 0x42, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0xcd, 0x6f, 0x25, 0x2a, 0x01, 0x2b, 0xcd, 0xef, 0x63, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0xf1, 0xe4, 0x5d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0xe8, 0xf5, 0x8d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf2, 0xb2, 0x12, 0x00, 0x00, 0x0a, 0x89, 0xe0, 0x47, 0x00, 0x13, 0x4d, 0x77, 0x5d, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x3c, 0x72, 0xb2, 0xd3, 0xe0, 0xd3, 0xb2, 0x82, 0x53, 0x33, 0x1d, 0x0d, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x07, 0x15, 0x26, 0x3e, 0x62, 0x97, 0xc3, 0xde, 0xde, 0xc4, 0x8c, 0x4c, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x01, 0x00, 0x2f, 0xcf, 0xcd, 0x25, 0x00, 0x00, 0x02, 0x56, 0xe5, 0xd6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7d, 0xf1, 0xe4, 0x5b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0xd7, 0xf8, 0x8c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xf4, 0x6e, 0x02, 0x00, 0x00, 0x01, 0x25, 0x47, 0x0f, 0x2f, 0xaa, 0xeb, 0xf5, 0xf0, 0xb6, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x2a, 0x59, 0x93, 0xbe, 0xdb, 0xe5, 0xdb, 0xc4, 0xad, 0x9a, 0x6e, 0x63, 0x64, 0x4b, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3e, 0x53, 0x64, 0x68, 0x8c, 0x9f, 0xb6, 0xcd, 0xde, 0xde, 0xc7, 0x9f, 0x6e, 0x42, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x96, 0x19, 0x00, 0x05, 0x7d, 0xf2, 0x72, 0x03, 0x00, 0x00, 0x0a, 0x8c, 0xf7, 0xaa, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86, 0xf1, 0xe4, 0x5f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0xda, 0xf8, 0x9f, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xf4, 0x97, 0x16, 0x04, 0x38, 0x38, 0x03, 0x00, 0x19, 0xaa, 0xfc, 0xbe, 0x6d, 0x93, 0xea, 0xb9, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x33, 0x53, 0x72, 0x9a, 0xb6, 0xc9, 0xcd, 0xdb, 0xf2, 0xe5, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe5, 0xe5, 0xd3, 0xd2, 0xbe, 0xaa, 0x86, 0x68, 0x3e, 0x19, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x16, 0xaa, 0xf4, 0x62, 0x01, 0x00, 0x2a, 0xd2, 0xce, 0x2a, 0x00, 0x00, 0x00, 0x20, 0xb1, 0xf8, 0x82, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa4, 0xfa, 0xe1, 0x5d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0xd7, 0xfc, 0xb2, 0x38, 0x02, 0x00, 0x00, 0x25, 0xbd, 0xf2, 0xa6, 0x93, 0xd6, 0xb7, 0x21, 0x04, 0x72, 0xf4, 0xb9, 0x2a, 0x00, 0x0d, 0x9a, 0xf0, 0x59, 0x01, 0x0b, 0x4c, 0x39, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x0f, 0x1d, 0x2a, 0x42, 0x55, 0x56, 0x59, 0x5b, 0x5a, 0x5a, 0x5b, 0x59, 0x5a, 0x55, 0x33, 0x25, 0x15, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x6d, 0x7d, 0x5d, 0x15, 0x00, 0x4c, 0xea, 0xbe, 0x21, 0x00, 0x05, 0x72, 0xef, 0x8d, 0x0a, 0x00, 0x00, 0x00, 0x47, 0xcd, 0x89, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x38, 0xad, 0xfa, 0xcd, 0x52, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3e, 0xba, 0xfc, 0xd3, 0x52, 0x07, 0x00, 0x01, 0x33, 0xb2, 0xe5, 0xea, 0xce, 0x68, 0x0d, 0x1d, 0xc4, 0xeb, 0x52, 0x00, 0x00, 0x03, 0x89, 0xf2, 0x5f, 0x00, 0x26, 0xce, 0xde, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x59, 0xce, 0xf2, 0xf0, 0xf0, 0x97, 0x19, 0x12, 0xa5, 0xf8, 0x7d, 0x05, 0x00, 0x1d, 0xbe, 0xde, 0x33, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x12, 0x01, 0x00, 0x00, 0x07, 0x4d, 0xcd, 0xfc, 0xc0, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa4, 0xf6, 0xe4, 0x78, 0x15, 0x00, 0x01, 0x15, 0x3c, 0x47, 0x25, 0x04, 0x00, 0x38, 0xea, 0xc3, 0x19, 0x00, 0x00, 0x12, 0xaf, 0xf0, 0x56, 0x00, 0x5b, 0xf4, 0xfe, 0x89, 0x07, 0x04, 0x4c, 0x6f, 0x15, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x2f, 0x38, 0x07, 0x00, 0x3c, 0xdb, 0xde, 0x6e, 0x59, 0xb9, 0xe5, 0x5d, 0x01, 0x47, 0xe6, 0xcf, 0x2b, 0x00, 0x01, 0x6e, 0xef, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6d, 0xe1, 0xf8, 0xa5, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x89, 0xed, 0xf6, 0x9e, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xeb, 0xb2, 0x12, 0x00, 0x00, 0x47, 0xe6, 0xce, 0x26, 0x0a, 0x97, 0xf4, 0xf7, 0xaa, 0x0d, 0x15, 0xbe, 0xd2, 0x2a, 0x15, 0x6f, 0x6d, 0x19, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0d, 0x1c, 0x33, 0x4c, 0x5d, 0x30, 0xbd, 0xc4, 0x25, 0x00, 0x68, 0xef, 0x7e, 0x04, 0x00, 0x2f, 0x5d, 0x19, 0x00, 0x0d, 0x94, 0xf7, 0x86, 0x0f, 0x0d, 0x8c, 0xef, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x97, 0xf1, 0xed, 0x86, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0xd3, 0xfc, 0xc5, 0x53, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd9, 0xd3, 0x33, 0x05, 0x3e, 0xc3, 0xf8, 0x78, 0x07, 0x26, 0xcf, 0xbd, 0xd2, 0xcd, 0x21, 0x40, 0xe6, 0x97, 0x0a, 0x38, 0xde, 0xf4, 0x68, 0x02, 0x03, 0x55, 0x6f, 0x19, 0x03, 0x21, 0x33, 0x2a, 0x19, 0x19, 0x19, 0x0d, 0x00, 0x00, 0x02, 0x19, 0x2f, 0x2b, 0x13, 0x00, 0x0d, 0x59, 0x8e, 0xa6, 0xcd, 0xe3, 0xf2, 0xbd, 0x2a, 0xad, 0xeb, 0x4c, 0x01, 0x67, 0xf2, 0x7d, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x42, 0xde, 0xef, 0xaa, 0xad, 0xef, 0xbd, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x52, 0xc5, 0xfc, 0xd3, 0x5f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38, 0xaf, 0xf8, 0xe8, 0x82, 0x20, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x78, 0xeb, 0xc7, 0x93, 0xd6, 0xf8, 0xa4, 0x1d, 0x01, 0x63, 0xea, 0x78, 0x9e, 0xe6, 0x3c, 0x7d, 0xea, 0x53, 0x00, 0x59, 0xf4, 0xff, 0xaa, 0x0f, 0x0a, 0x97, 0xdb, 0x33, 0x0a, 0x96, 0xe5, 0xdb, 0xbe, 0xbd, 0xbd, 0x68, 0x02, 0x0a, 0x52, 0xb6, 0xe5, 0xde, 0x9e, 0x2f, 0x19, 0xb7, 0xea, 0xe5, 0xff, 0xd6, 0x7d, 0x4c, 0x0a, 0x77, 0xf4, 0x78, 0x03, 0x68, 0xf5, 0x97, 0x0a, 0x00, 0x00, 0x1d, 0x7d, 0x5b, 0x07, 0x07, 0x59, 0xce, 0xf2, 0xea, 0xa6, 0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x82, 0xe4, 0xfa, 0xb7, 0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x7d, 0xe4, 0xfa, 0xba, 0x4c, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x6d, 0xcd, 0xe5, 0xd7, 0x7d, 0x1d, 0x00, 0x12, 0xaa, 0xe0, 0x38, 0x6e, 0xf0, 0x64, 0xb8, 0xc7, 0x20, 0x03, 0x7d, 0xf0, 0xe5, 0xd9, 0x33, 0x16, 0xb9, 0xc7, 0x19, 0x0a, 0xa6, 0xf9, 0xcb, 0xbd, 0xbe, 0xcd, 0x7e, 0x02, 0x4c, 0xe5, 0xf0, 0xa6, 0xb9, 0xf5, 0xb6, 0x20, 0x38, 0x42, 0x56, 0xea, 0xb6, 0x0f, 0x00, 0x00, 0x47, 0xea, 0xb2, 0x16, 0x3c, 0xe6, 0xd9, 0x33, 0x00, 0x00, 0x38, 0xe5, 0xaf, 0x12, 0x00, 0x04, 0x2a, 0x55, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x4d, 0xbd, 0xfc, 0xe4, 0x82, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0xba, 0xfa, 0xe4, 0x86, 0x2f, 0x03, 0x00, 0x00, 0x05, 0x21, 0x33, 0x2a, 0x0a, 0x00, 0x00, 0x33, 0xde, 0xad, 0x12, 0x52, 0xe6, 0xbd, 0xe0, 0x8e, 0x07, 0x0a, 0x97, 0xdb, 0x93, 0xeb, 0x68, 0x2f, 0xdb, 0xa5, 0x0a, 0x15, 0xb9, 0xd7, 0x33, 0x16, 0x15, 0x20, 0x19, 0x0f, 0xa5, 0xf8, 0x7d, 0x12, 0x1d, 0xaa, 0xf0, 0x5d, 0x01, 0x00, 0x25, 0xce, 0xcd, 0x25, 0x00, 0x00, 0x21, 0xc7, 0xde, 0x2f, 0x12, 0xa5, 0xfc, 0x9e, 0x21, 0x07, 0x63, 0xef, 0x85, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x86, 0xe4, 0xf8, 0xba, 0x47, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x82, 0xe4, 0xfc, 0xcd, 0x6d, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xf2, 0x72, 0x01, 0x2f, 0xd6, 0xfc, 0xeb, 0x4c, 0x00, 0x15, 0xbe, 0xc3, 0x47, 0xd9, 0xb6, 0x5a, 0xea, 0x82, 0x04, 0x2a, 0xd7, 0xe3, 0x68, 0x47, 0x29, 0x13, 0x00, 0x25, 0xd3, 0xe3, 0x33, 0x00, 0x00, 0x33, 0x6f, 0x2f, 0x01, 0x00, 0x12, 0xb1, 0xe9, 0x42, 0x00, 0x00, 0x07, 0x97, 0xf0, 0x59, 0x00, 0x38, 0xc9, 0xf7, 0xbe, 0x9c, 0xde, 0xde, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x6d, 0xd3, 0xfc, 0xe4, 0x82, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42, 0xa5, 0xf1, 0xf6, 0xc0, 0x5b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0xb7, 0x38, 0x00, 0x19, 0xbe, 0xff, 0xc7, 0x20, 0x00, 0x2f, 0xd6, 0xa5, 0x16, 0x9f, 0xe0, 0x9e, 0xea, 0x62, 0x00, 0x29, 0xd6, 0xfb, 0xe9, 0xe9, 0xd9, 0x6e, 0x01, 0x2f, 0xe0, 0xc7, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x97, 0xf5, 0x5b, 0x00, 0x00, 0x01, 0x68, 0xf5, 0x8e, 0x07, 0x03, 0x3c, 0xaa, 0xe0, 0xe5, 0xbd, 0x52, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x64, 0xbd, 0xf5, 0xf1, 0xaa, 0x47, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x59, 0xc0, 0xfa, 0xf1, 0xb2, 0x53, 0x15, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x1d, 0x07, 0x00, 0x0a, 0x94, 0xfc, 0x8e, 0x07, 0x00, 0x4d, 0xe6, 0x89, 0x07, 0x5f, 0xf2, 0xf2, 0xe0, 0x3e, 0x00, 0x29, 0xd9, 0xe5, 0x78, 0x7d, 0x96, 0x4d, 0x01, 0x25, 0xd3, 0xe0, 0x2f, 0x00, 0x00, 0x19, 0x4d, 0x20, 0x01, 0x00, 0x02, 0x6f, 0xf2, 0x82, 0x07, 0x00, 0x00, 0x3c, 0xe6, 0xc3, 0x1d, 0x00, 0x00, 0x12, 0x2f, 0x2f, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x64, 0xc1, 0xf6, 0xf6, 0xc0, 0x63, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x6f, 0xc5, 0xf8, 0xf1, 0xb6, 0x6f, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x8d, 0x42, 0x01, 0x03, 0x72, 0xf0, 0x59, 0x00, 0x2b, 0xd6, 0xff, 0xcd, 0x21, 0x00, 0x2f, 0xde, 0xb2, 0x12, 0x01, 0x04, 0x02, 0x00, 0x0f, 0xad, 0xf0, 0x5b, 0x01, 0x00, 0x52, 0xe0, 0x82, 0x05, 0x00, 0x00, 0x47, 0xeb, 0xaa, 0x0f, 0x00, 0x00, 0x19, 0xb2, 0xc3, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x68, 0xbd, 0xf5, 0xfa, 0xcd, 0x68, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x6f, 0xc9, 0xf8, 0xf6, 0xc5, 0x6e, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x03, 0x00, 0x07, 0x6e, 0xaa, 0x38, 0x00, 0x0d, 0x9e, 0xff, 0xb2, 0x0f, 0x00, 0x4d, 0xe9, 0xb6, 0x4d, 0x3e, 0x1c, 0x19, 0x0b, 0x01, 0x5b, 0xef, 0xcd, 0x4c, 0x3c, 0xad, 0xf2, 0x5b, 0x02, 0x00, 0x00, 0x33, 0xde, 0xbe, 0x19, 0x00, 0x00, 0x04, 0x2f, 0x2b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2b, 0x72, 0xba, 0xf5, 0xf6, 0xc5, 0x7e, 0x2a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x68, 0xb6, 0xf1, 0xfa, 0xd6, 0x8c, 0x4c, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x16, 0x07, 0x00, 0x00, 0x47, 0xbd, 0x68, 0x05, 0x00, 0x4d, 0xe9, 0xf4, 0xe9, 0xe9, 0xd7, 0xc9, 0x4d, 0x00, 0x12, 0x94, 0xf2, 0xea, 0xe6, 0xf2, 0x9e, 0x15, 0x00, 0x00, 0x00, 0x12, 0x6e, 0x5d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x47, 0x8d, 0xd3, 0xfa, 0xf5, 0xba, 0x5f, 0x1d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x59, 0xaf, 0xe8, 0xfc, 0xe8, 0xb7, 0x74, 0x40, 0x19, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x0f, 0x00, 0x00, 0x2a, 0x6f, 0x7e, 0x94, 0xaa, 0xad, 0xa5, 0x3e, 0x00, 0x00, 0x19, 0x63, 0x9e, 0x9e, 0x62, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x42, 0x7d, 0xba, 0xe8, 0xfa, 0xe8, 0xa5, 0x5d, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x42, 0x8d, 0xc5, 0xf1, 0xfa, 0xe4, 0xc5, 0x8d, 0x59, 0x26, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x2b, 0x53, 0x82, 0xc0, 0xe8, 0xfc, 0xf5, 0xcd, 0x8d, 0x42, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x4d, 0x8c, 0xc5, 0xed, 0xfa, 0xf5, 0xd6, 0xad, 0x7d, 0x4d, 0x2b, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x2f, 0x4c, 0x78, 0xa6, 0xd6, 0xf1, 0xf8, 0xf1, 0xcd, 0x94, 0x56, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1d, 0x4c, 0x82, 0xb2, 0xda, 0xf8, 0xfc, 0xf1, 0xd6, 0xb7, 0x8d, 0x68, 0x4c, 0x2f, 0x25, 0x0f, 0x0b, 0x04, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x04, 0x0b, 0x0f, 0x25, 0x33, 0x4d, 0x62, 0x8d, 0xb2, 0xd6, 0xf1, 0xfa, 0xf6, 0xda, 0xb6, 0x82, 0x47, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x33, 0x5d, 0x8d, 0xb2, 0xd6, 0xf1, 0xf8, 0xfa, 0xf1, 0xda, 0xcd, 0xbe, 0xaa, 0x7e, 0x78, 0x78, 0x77, 0x63, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x5f, 0x77, 0x78, 0x78, 0x86, 0xaf, 0xb8, 0xcd, 0xe1, 0xf5, 0xfa, 0xf8, 0xf1, 0xda, 0xb2, 0x86, 0x53, 0x2f, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x2a, 0x4d, 0x72, 0x9a, 0xb7, 0xcd, 0xe1, 0xf1, 0xf1, 0xf5, 0xf5, 0xf5, 0xf8, 0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0xf8, 0xf6, 0xf5, 0xf5, 0xf6, 0xf1, 0xda, 0xc5, 0xb2, 0x9e, 0x78, 0x52, 0x2f, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x16, 0x21, 0x39, 0x4c, 0x5b, 0x7e, 0x7d, 0x86, 0xbd, 0xbd, 0xc1, 0xc1, 0xc0, 0xc0, 0xc1, 0xc1, 0xbd, 0xbd, 0x8d, 0x7d, 0x7e, 0x5f, 0x47, 0x33, 0x1d, 0x12, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  
-};
-
-const lv_img_dsc_t app_img_universityCrest160x160 = {
-  .header.cf = LV_IMG_CF_RGB565A8,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 160,
-  .header.h = 160,
-  .data_size = 76800,
-  .data = app_img_universityCrest160x160_map,
-};
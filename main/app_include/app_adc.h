@@ -61,6 +61,7 @@ typedef struct {
     int * vraw;
     int * vcal;
     int * vfilt;
+    void (*on_sample)(int vfilt);   // Each filtered sample, called from the ADC task. NULL for none
 } adcOneshotParams_t;
 
 //info
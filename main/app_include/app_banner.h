@@ -0,0 +1,52 @@
+/**
+ * @file app_banner.h
+ * @brief The scrolling title banner. Moving the label with lv_obj_set_x() every animation step relayouts it and
+ *        invalidates the whole box around it (110 x 34 px with the draw margin), so every frame redraws and sends
+ *        the box, and re-rasterizes every visible letter.
+ *        Pre-rendered, the label's text is drawn once through LVGL into an A8 coverage strip (heap, w x h bytes)
+ *        and the label is hidden. The box draws the strip in its own DRAW_MAIN, as one masked fill in the text
+ *        colour, and each step invalidates only the text's row band inside the box, where the old and new
+ *        positions overlap it. Steps with the text wholly outside the box invalidate nothing.
+ *        The ILI9341's vertical scroll (VSCRDEF/VSCRSADD) can't do this: in the rotated frame it scrolls whole
+ *        columns across the full panel height, and the banner's columns also hold the image below it.
+ *        Call from the LVGL owning task only, except app_banner_get_stats().
+ *
+ */
+
+#ifndef APP_BANNER_H
+#define APP_BANNER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "lvgl.h"
+
+// Settings
+#define APP_BANNER_PRERENDER    1       // 1 = text drawn once into a coverage strip, 0 = the label moved by LVGL (A/B)
+
+// Typedefs
+typedef struct {
+    bool prerendered;           // Running from the strip (false: disabled, or no heap for the strip)
+    uint32_t strip_bytes;       // Heap held by the strip
+    uint32_t overlaps;          // Strip pixels covered by two glyphs at capture, where a level off LVGL's mix is possible
+    uint32_t steps;             // Animation steps
+    uint32_t invalidated_px;    // Area invalidated by those steps
+} app_banner_stats_t;
+
+// User functions
+void app_banner_start(lv_obj_t * label, lv_coord_t from, lv_coord_t to, uint32_t period_ms, bool prerender);
+void app_banner_get_stats(app_banner_stats_t * stats);
+void app_banner_reset_stats(void);
+void app_banner_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_BANNER_H
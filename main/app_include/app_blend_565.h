@@ -0,0 +1,38 @@
+/**
+ * @file app_blend_565.h
+ * @brief Blend kernels for this build's colour format (LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP, rounded mixing),
+ *        installed as the software draw context's blend in place of lv_draw_sw_blend_basic. Normal blending of
+ *        a colour or an image, with or without opacity and mask, works on the byte swapped RGB565 words directly:
+ *        red and blue are mixed as two 16 bit lanes of one 32 bit multiply, the greens of two neighbouring pixels
+ *        likewise, and the /255 of lv_color_mix is a shift-add per lane, bit exact with LVGL. Opaque image rows
+ *        are copied as aligned 32 bit words, two pixels at a time. The kernels run from IRAM.
+ *        Anything else (other blend modes, set_px_cb, transparent screens, masks without anti-aliasing) and
+ *        other colour formats go to LVGL's own blend.
+ *
+ */
+
+#ifndef APP_BLEND_565_H
+#define APP_BLEND_565_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdint.h>
+#include "esp_attr.h"
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+// Settings
+#define APP_BLEND_565_ENABLE    (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1 && LV_COLOR_MIX_ROUND_OFS != 0)
+
+// User functions
+void app_blend_565_init(void);
+void app_blend_565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_BLEND_565_H
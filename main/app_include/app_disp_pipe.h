@@ -0,0 +1,64 @@
+/**
+ * @file app_disp_pipe.h
+ * @brief LVGL draw buffer pipeline for the ILI9341: two DMA capable strip buffers so LVGL renders strip N+1 while
+ *        strip N is still being transferred, with the strip height picked by a timed sweep at boot. Wraps the
+ *        display driver's flush and records per frame render, transfer, wait and render/transfer overlap times.
+ *
+ */
+
+#ifndef APP_DISP_PIPE_H
+#define APP_DISP_PIPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "lvgl_helpers.h"
+#include "app_utility.h"
+
+// Settings
+#define APP_DISP_HOR_RES                320     // Widest side of the panel, strips span the full logical width
+#define APP_DISP_STRIP_LINES            40      // Strip height when the sweep is disabled
+#define APP_DISP_STRIP_SWEEP            1       // Time full screen redraws at each candidate height at boot, keep the best
+#define APP_DISP_SWEEP_MAX_LINES        80      // Largest candidate, 2 x 50 KB during the sweep, also capped by the SPI bus max transfer
+#define APP_DISP_SWEEP_FRAMES           4       // Redraws timed per candidate
+#define APP_DISP_SWEEP_TOLERANCE_PCT    5       // Smallest strip within this of the fastest wins, to save DMA RAM
+#define APP_DISP_STATS_WINDOW_MS        1000    // FPS window
+
+// Typedefs
+typedef struct {
+    uint32_t frames;
+    uint16_t strip_lines;       // Current strip height
+    uint16_t strips;            // Strips in the last frame
+    uint32_t render_us;         // Last frame: CPU time spent rendering strips
+    uint32_t flush_us;          // Last frame: flush_cb to transfer complete, summed over strips
+    uint32_t flush_cpu_us;      // Last frame: time spent inside the driver's flush, summed over strips
+    uint32_t flush_bytes;       // Last frame: pixel bytes sent
+    uint32_t wait_us;           // Last frame: time LVGL was blocked waiting for a buffer
+    uint32_t overlap_us;        // Last frame: rendering done while a transfer was in flight
+    uint32_t frame_us;          // Last frame: render start to last transfer complete
+    uint32_t frame_max_us;
+    uint32_t fps_x10;           // Over the last full window
+    uint32_t latency_us;        // Input to photon: input timestamp to the end of the first frame started after it
+    uint32_t latency_max_us;
+    uint32_t latency_count;
+    uint64_t latency_total_us;
+} app_disp_pipe_stats_t;
+
+// User functions
+esp_err_t app_disp_pipe_init(lv_disp_drv_t * disp_drv, lv_disp_draw_buf_t * draw_buf);
+esp_err_t app_disp_pipe_start(lv_disp_t * disp);
+void app_disp_pipe_mark_input(int64_t timestamp_us);
+void app_disp_pipe_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px);
+void app_disp_pipe_get_stats(app_disp_pipe_stats_t * stats);
+void app_disp_pipe_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_DISP_PIPE_H
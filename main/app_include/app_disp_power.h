@@ -0,0 +1,74 @@
+/**
+ * @file app_disp_power.h
+ * @brief Display power manager: an inactivity state machine over the backlight and the panel. Full brightness
+ *        (the pot D setting) until APP_DISP_POWER_DIM_MS without input, then a hardware fade down to the dimmed
+ *        level, then at APP_DISP_POWER_SLEEP_MS backlight off and the panel in sleep (ILI9341 SLPIN), with LVGL
+ *        not run at all. Any encoder step or switch edge wakes it at once: panel out of sleep, backlight straight
+ *        back to the setting (the fade is cut short), and the frame rendered on the same pass of the display loop.
+ *        The panel keeps its RAM asleep, so it shows the last frame until then.
+ *        The backlight is written only when its level changes. Time in each state and an estimate of the display's
+ *        battery current (backlight by duty, panel awake or asleep; the MCU is not counted) are kept in the stats.
+ *        Pure logic over the caller's clock: the hardware is driven through an app_disp_power_io_t.
+ *        Call from the display task only, except app_disp_power_get_stats().
+ *
+ */
+
+#ifndef APP_DISP_POWER_H
+#define APP_DISP_POWER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+// Settings
+#define APP_DISP_POWER_DIM_MS           30000   // No input this long -> dim
+#define APP_DISP_POWER_SLEEP_MS         90000   // No input this long -> backlight off and panel asleep
+#define APP_DISP_POWER_DIM_PCT          10      // Dimmed backlight, or the setting if that is lower
+#define APP_DISP_POWER_DIM_FADE_MS      1500    // LEDC hardware fade down to the dimmed level
+#define APP_DISP_POWER_BL_FULL_UA       60000   // Battery current estimates: backlight LEDs at 100 % duty,
+#define APP_DISP_POWER_PANEL_UA         6000    // ILI9341 awake (scanning its RAM),
+#define APP_DISP_POWER_PANEL_SLEEP_UA   20      // ILI9341 in sleep in
+
+// Typedefs
+typedef enum {
+    APP_DISP_POWER_ON = 0,      // Backlight at the setting, rendering
+    APP_DISP_POWER_DIM,         // Backlight dimmed, still rendering
+    APP_DISP_POWER_SLEEP,       // Backlight off, panel asleep, LVGL paused
+    APP_DISP_POWER_NUM_STATES
+} app_disp_power_state_t;
+
+typedef struct {
+    void (*backlight)(int pct, uint32_t fade_ms);   // Set the backlight, at once when fade_ms is 0
+    void (*panel_sleep)(bool sleep);                // Panel into or out of sleep, ready for commands on return
+} app_disp_power_io_t;
+
+typedef struct {
+    app_disp_power_state_t state;
+    uint64_t state_us[APP_DISP_POWER_NUM_STATES];   // Time spent in each state
+    uint32_t dims;              // Transitions into each of the low power states
+    uint32_t sleeps;
+    uint32_t wakes;             // Input that brought the display back from dim or sleep
+    uint32_t backlight_writes;
+    uint32_t current_ua;        // Estimated display current now
+    uint32_t mean_ua;           // ... averaged since init
+} app_disp_power_stats_t;
+
+// User functions
+void app_disp_power_init(const app_disp_power_io_t * io, int brightness_pct, int64_t now_us);
+bool app_disp_power_activity(int64_t now_us);
+void app_disp_power_set_brightness(int pct, int64_t now_us);
+uint32_t app_disp_power_poll(int64_t now_us);
+bool app_disp_power_rendering(void);
+void app_disp_power_get_stats(app_disp_power_stats_t * stats, int64_t now_us);
+void app_disp_power_log_stats(const char * TAG, int64_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_DISP_POWER_H
@@ -16,7 +16,8 @@ extern "C" {
 // --------------- Includes --------------- //
 #include "rotary_encoder.h"
 #include "app_include/app_gpio.h"
-#include "app_include/app_timer.h"
+#include "app_include/app_press.h"
+#include "app_include/app_gesture.h"
 
 // ENCODER/SWITCH INPUTS -- ENCA is for menu navigation in addition to steering
 #define ENCA_CHA_PIN            GPIO_NUM_27 
@@ -29,26 +30,19 @@ extern "C" {
 // Settings
 #define MAX_ENCODER_COUNTS      (int8_t)(30)          // 24PPR encoders. 0-23 WOULDA BEEN NICE but we NEEED angles here baby (excuse to utilize all BRAMs on the FPGA tehe)
 #define MIN_ENCODER_COUNTS      -MAX_ENCODER_COUNTS   // 24PPR encoders. 0-23.
-#define ENC_QUEUE_DELAY         10
+#define NUM_ENCODERS            2                     // Both encoders (and their switches) are serviced by the one input task
+#define INPUT_UI_RETRY_MS       10                    // Input task retry of a UI post refused by the full UI command queue
 
-// Define a structure to hold both encoder object and queue handle
+// Define a structure to hold an encoder object and where its state is published
 typedef struct {
     char * TAG;
     rotary_encoder_info_t * encoder;
-    rotary_encoder_event_t * event;
-    rotary_encoder_state_t * state;
-    gptimer_handle_t * timer_handle;
-    void (*timer_cb)(int);
-    uint32_t timer_top;
-    volatile bool * timerFlag;
+    app_press_tracker_t * press;
     gpio_num_t pinA;
     gpio_num_t pinB;
     gpio_num_t pinSW;
-    circularBuffer * comboBuff;
-    int id;
+    int id;                         // Key id reported to the gesture matcher, see app_gesture.h
     int * pos;
-    int delay_ms;
-    QueueHandle_t queue;
 } encParams_t;
 
 // Static functions
@@ -56,6 +50,7 @@ typedef struct {
 // User functions
 void encoder_init(rotary_encoder_info_t * encoder, gpio_num_t cha_pin, gpio_num_t chb_pin, 
                   gpio_num_t sw_pin, /*bool sw_pin_int_en,*/ bool en_half_steps, bool flip_dir);
+void encoder_log_isr_stats(const char * tag, rotary_encoder_info_t * encoder);
 
 #ifdef __cplusplus
 }
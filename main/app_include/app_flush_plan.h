@@ -0,0 +1,72 @@
+/**
+ * @file app_flush_plan.h
+ * @brief Flush planner: merges LVGL's invalidated areas for a frame when one larger flush window is cheaper
+ *        than several small ones, and accounts what actually goes to the panel. The cost of a window is its
+ *        pixel bytes plus a fixed byte-equivalent per flush (address window setup, queued transactions, the
+ *        flush ready round trip), with windows taller than the draw buffer counted as one flush per strip.
+ *        Hardware independent (plain rectangles), so it also runs on the host.
+ *
+ */
+
+#ifndef APP_FLUSH_PLAN_H
+#define APP_FLUSH_PLAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_log.h"
+
+// Settings
+#define APP_FLUSH_PLAN_ENABLE           1       // 0 = account only, leave LVGL's areas as they are
+#define APP_FLUSH_PLAN_MAX_AREAS        32      // LV_INV_BUF_SIZE
+#define APP_FLUSH_PLAN_SETUP_BYTES      11      // CASET + 4, PASET + 4, RAMWR on the wire per flush
+#define APP_FLUSH_PLAN_SETUP_COST       128     // Byte equivalent of one flush: setup bytes, 6 queued transactions, flush ready
+#define APP_FLUSH_PLAN_PX_BYTES         2       // RGB565
+#define APP_FLUSH_PLAN_WINDOW_MS        1000    // Rate window
+
+// Typedefs
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;                 // Inclusive, as lv_area_t
+    int32_t y2;
+} app_flush_rect_t;
+
+typedef struct {
+    uint32_t frames;
+    // Planner, last frame
+    uint16_t areas_in;          // Areas LVGL left after its own joining
+    uint16_t areas_out;         // Areas after planning
+    uint32_t extra_px;          // Pixels rendered and sent only because of merging
+    uint32_t cost_in;           // Modelled cost before and after, byte equivalents
+    uint32_t cost_out;
+    // Flushes, last frame
+    uint16_t flushes;
+    uint32_t px;
+    uint32_t bytes;             // Pixel bytes plus setup bytes
+    // Rates over the last full window
+    uint32_t flushes_per_s;
+    uint32_t bytes_per_s;
+    uint64_t bytes_total;
+    uint32_t merges_total;
+} app_flush_plan_stats_t;
+
+// User functions
+uint32_t app_flush_plan_cost(const app_flush_rect_t * rect, uint32_t buf_px);
+int app_flush_plan(app_flush_rect_t * rects, uint8_t * joined, int num_rects, uint32_t buf_px);
+void app_flush_plan_count_flush(int32_t width, int32_t height);
+void app_flush_plan_frame_end(uint32_t now_ms);
+void app_flush_plan_reset(uint32_t now_ms);
+void app_flush_plan_get_stats(app_flush_plan_stats_t * stats);
+void app_flush_plan_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_FLUSH_PLAN_H
@@ -0,0 +1,73 @@
+/**
+ * @file app_gauge.h
+ * @brief Lightweight arc gauge, a drop-in for the styled lv_arc on the main screen (same geometry and look:
+ *        270 degree track, rounded indicator, knob with outline and shadow). The track, the full indicator ring,
+ *        a per pixel angle table and the knob sprite are rendered once into A8 masks shared by all gauges of one
+ *        size; drawing is then a few masked fills straight into the draw buffer, the indicator being the ring
+ *        limited to the current sweep. A value change invalidates only the angular sector between the old and
+ *        new value plus the two knob positions. Not styled, colours are set through the functions below.
+ *        Needs the software renderer (draws with lv_draw_sw_blend). Call from the LVGL owning task only.
+ *
+ */
+
+#ifndef APP_GAUGE_H
+#define APP_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lvgl.h"
+
+// Settings
+#define APP_GAUGE_BG_START          135     // Track start, degrees clockwise from 3 o'clock (lv_arc's default)
+#define APP_GAUGE_BG_SWEEP          270     // Track length, degrees
+#define APP_GAUGE_TRACK_WIDTH       6
+#define APP_GAUGE_INDIC_WIDTH       8
+#define APP_GAUGE_KNOB_PAD          2       // Knob extends this far past the indicator on each side
+#define APP_GAUGE_KNOB_OUTLINE      1
+#define APP_GAUGE_KNOB_SHADOW       10      // Shadow blur width, as lv_obj's shadow_width
+#define APP_GAUGE_ANGLE_STEPS       16      // Angle resolution, steps per degree
+#define APP_GAUGE_MAX_SIZES         2       // Distinct gauge sizes with cached masks (each size * size * 4 bytes)
+
+// Typedefs
+typedef enum {
+    APP_GAUGE_MODE_NORMAL = 0,      // Indicator from the track start to the value
+    APP_GAUGE_MODE_SYMMETRICAL      // Indicator from the middle of the track to the value
+} app_gauge_mode_t;
+
+typedef struct {
+    lv_obj_t obj;
+    int16_t min_value;
+    int16_t max_value;
+    int16_t value;
+    app_gauge_mode_t mode;
+    uint16_t indic_start;           // Indicator sweep, angle steps from the track start
+    uint16_t indic_end;
+    uint16_t knob_angle;
+    lv_color_t track_color;
+    lv_color_t indic_color;
+    lv_color_t knob_color;
+} app_gauge_t;
+
+extern const lv_obj_class_t app_gauge_class;
+
+// User functions
+lv_obj_t * app_gauge_create(lv_obj_t * parent);
+void app_gauge_set_range(lv_obj_t * obj, int16_t min_value, int16_t max_value);
+void app_gauge_set_mode(lv_obj_t * obj, app_gauge_mode_t mode);
+void app_gauge_set_value(lv_obj_t * obj, int16_t value);
+int16_t app_gauge_get_value(const lv_obj_t * obj);
+void app_gauge_set_colors(lv_obj_t * obj, lv_color_t track, lv_color_t indic);
+void app_gauge_set_knob_color(lv_obj_t * obj, lv_color_t color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_GAUGE_H
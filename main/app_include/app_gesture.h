@@ -0,0 +1,73 @@
+/**
+ * @file app_gesture.h
+ * @brief Gesture matcher for the two encoder switches. A table of input sequences (taps, double clicks,
+ *        long presses, chords) is compiled once into a DFA (Aho-Corasick automaton over the input symbols),
+ *        which is then advanced in O(1) per input symbol. The matcher has a single owner and takes no locks.
+ *
+ */
+
+#ifndef APP_GESTURE_H
+#define APP_GESTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_err.h"
+
+// Settings
+#define APP_GESTURE_MAX_LENGTH      4           // Longest sequence a gesture may be made of
+#define APP_GESTURE_MAX_STATES      32          // DFA state budget (1 + total unique prefixes across the table)
+#define APP_GESTURE_TIMEOUT_US      1500000     // Gap between symbols after which a partial sequence is abandoned
+#define APP_GESTURE_NONE            (-1)        // Returned by the feed functions when no gesture completed
+#define APP_GESTURE_KEY_A           0
+#define APP_GESTURE_KEY_B           1
+
+// Typedefs
+typedef enum {
+    APP_GESTURE_SYM_TAP_A = 0,
+    APP_GESTURE_SYM_TAP_B,
+    APP_GESTURE_SYM_DOUBLE_A,
+    APP_GESTURE_SYM_DOUBLE_B,
+    APP_GESTURE_SYM_LONG_A,
+    APP_GESTURE_SYM_LONG_B,
+    APP_GESTURE_SYM_CHORD_AB,   // Both switches held at the same time
+    APP_GESTURE_NUM_SYMS
+} app_gesture_sym_t;
+
+typedef struct {
+    int id;                                     // Reported when the sequence completes, may repeat across entries
+    const char * name;
+    uint8_t length;
+    app_gesture_sym_t seq[APP_GESTURE_MAX_LENGTH];
+} app_gesture_def_t;
+
+typedef struct {
+    uint8_t next[APP_GESTURE_MAX_STATES][APP_GESTURE_NUM_SYMS];    // Full transition table, no fallback walk at run time
+    int16_t match[APP_GESTURE_MAX_STATES];                          // Index into the def table, or -1
+    uint8_t num_states;
+    uint8_t state;
+    int64_t last_us;
+    uint8_t held_mask;          // Switches currently held, for chord detection
+    uint8_t chord_mask;         // Switches whose next tap/long report belongs to a chord and is swallowed
+    const app_gesture_def_t * defs;
+    int num_defs;
+} app_gesture_matcher_t;
+
+// User functions
+esp_err_t app_gesture_compile(app_gesture_matcher_t * matcher, const app_gesture_def_t * defs, int num_defs);
+void app_gesture_reset(app_gesture_matcher_t * matcher);
+int app_gesture_feed(app_gesture_matcher_t * matcher, app_gesture_sym_t sym, int64_t timestamp_us);
+int app_gesture_feed_switch(app_gesture_matcher_t * matcher, int key, bool pressed, int64_t timestamp_us);
+int app_gesture_feed_press(app_gesture_matcher_t * matcher, int key, uint8_t clicks, bool long_press, int64_t timestamp_us);
+const char * app_gesture_name(const app_gesture_matcher_t * matcher, int id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_GESTURE_H
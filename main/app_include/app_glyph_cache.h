@@ -0,0 +1,55 @@
+/**
+ * @file app_glyph_cache.h
+ * @brief Cache of rasterized glyphs for the labels redrawn every frame (dial values, battery voltage, the
+ *        scrolling banner). LVGL's software renderer unpacks a glyph's 4 bpp bitmap through the opacity table
+ *        into a mask buffer, pixel by pixel, every time it draws the letter, and blends it a strip at a time.
+ *        Hooked on the display's draw_ctx->draw_letter, the cache keeps the unpacked A8 mask of each glyph
+ *        (keyed by font and letter: the mask doesn't depend on the colour, which is applied by the blend) in an
+ *        lv_lru with a byte budget, and blends it in one call straight from the cache.
+ *        Letters it can't draw exactly as LVGL would (opacity, clip masks, sub-pixel fonts, no anti-aliasing)
+ *        are left to LVGL. Entries live in the LVGL heap, so the budget comes out of LV_MEM_SIZE.
+ *        Call from the LVGL owning task only, except app_glyph_cache_get_stats().
+ *
+ */
+
+#ifndef APP_GLYPH_CACHE_H
+#define APP_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdint.h>
+#include "esp_log.h"
+#include "lvgl.h"
+
+// Settings
+#define APP_GLYPH_CACHE_BYTES           6144    // Budget, 0 = off. The UI's ~40 glyphs (banner, digits, battery) take ~5 KB
+#define APP_GLYPH_CACHE_AVG_ENTRY       128     // Expected entry size, sizes lv_lru's hash table (budget / average)
+#define APP_GLYPH_CACHE_ENTRY_OVERHEAD  (10 * sizeof(void *) + 8)   // lv_lru's item, and the heap's block header and
+                                                                    // alignment on each of the entry's allocations
+
+// Typedefs
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;            // Rasterized and inserted
+    uint32_t evictions;
+    uint32_t bypassed;          // Drawn by LVGL: not cacheable, or no heap for the entry
+    uint32_t entries;
+    uint32_t bytes;             // Charged against the budget
+    uint32_t budget;
+} app_glyph_cache_stats_t;
+
+// User functions
+void app_glyph_cache_init(void);
+void app_glyph_cache_set_budget(uint32_t bytes);
+void app_glyph_cache_get_stats(app_glyph_cache_stats_t * stats);
+void app_glyph_cache_reset_stats(void);
+void app_glyph_cache_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_GLYPH_CACHE_H
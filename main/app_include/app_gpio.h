@@ -28,34 +28,15 @@ extern "C" {
 
 #define HEARTBEAT_BLINK_PERIOD_MS 100
 
-#define KEYPRESS_COMBO_LENGTH   3
-#define NUM_COMBOS              8
-#define COMBO_CHECK_DELAY       10
-
 // Typedefs
 typedef enum {
     LOW,
     HIGH
 } gpio_status_t;
 
-typedef struct {
-    int buffer[KEYPRESS_COMBO_LENGTH];  // Buffer to store keypresses
-    int head;  // Index of the first element in the buffer
-    int tail;  // Index of the next empty slot in the buffer
-    SemaphoreHandle_t mutex;  // Mutex to protect buffer access
-    int size;  // Size of the circular buffer
-} circularBuffer;
-
 extern const char * gpio_status_names[2];
-extern int keypress_combos[NUM_COMBOS][KEYPRESS_COMBO_LENGTH];
-extern const char * keypress_combo_names[NUM_COMBOS];
 
 void app_gpio_init(void);
-void init_buffer(circularBuffer *cb);
-void clear_buffer(circularBuffer *cb);
-void push_key(circularBuffer *cb, int key);
-int pop_key(circularBuffer *cb);
-bool check_combo(circularBuffer *cb, int * target);
 
 
 #ifdef __cplusplus
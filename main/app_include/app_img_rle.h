@@ -0,0 +1,60 @@
+/**
+ * @file app_img_rle.h
+ * @brief Run length compressed image assets with an LVGL image decoder that expands them one line at a time.
+ *        Only the bounding box of the non transparent pixels is stored. Each of its rows is a list of runs over
+ *        the combined colour and alpha planes: transparent (no data), opaque literal colours, opaque repeated
+ *        colour, and partially transparent literal colours with their alpha. Colours are kept apart from the run
+ *        headers and alpha bytes, aligned, so runs copy and mix them as lv_color_t. A row table gives random
+ *        access, so the decoder needs a single row of scratch (width * 3 bytes) and hands LVGL RGB565A8 lines.
+ *        Plain draws bypass it: a draw_img hook on the display's draw_ctx copies the runs straight into the draw
+ *        buffer.
+ *        Assets are generated from the PNGs in assets/ by host/img_pack.
+ *
+ */
+
+#ifndef APP_IMG_RLE_H
+#define APP_IMG_RLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdint.h>
+#include "lvgl.h"
+
+// Settings
+#define APP_IMG_RLE_CF              LV_IMG_CF_USER_ENCODED_0    // lv_img_dsc_t.header.cf of an app_img_rle_t asset
+#define APP_IMG_RLE_MAX_RUN         64
+
+// Run header: kind in the top two bits, run length - 1 in the rest
+#define APP_IMG_RLE_TRANSP          0x00    // No data
+#define APP_IMG_RLE_OPAQUE          0x40    // length colours
+#define APP_IMG_RLE_REPEAT          0x80    // One colour, opaque, repeated
+#define APP_IMG_RLE_ALPHA           0xC0    // length colours, length alpha bytes after the header
+#define APP_IMG_RLE_KIND_MASK       0xC0
+
+// Typedefs
+typedef struct {
+    uint32_t runs;              // Offset of the row's first run header in runs
+    uint32_t colors;            // Index of the row's first colour in colors
+} app_img_rle_row_t;
+
+typedef struct {
+    uint16_t x1;                // Stored box, image coordinates, inclusive. x1 > x2 for a fully transparent image
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    const app_img_rle_row_t * rows;     // One per stored row, plus the end
+    const uint8_t * runs;
+    const uint16_t * colors;    // lv_color_t.full
+} app_img_rle_t;
+
+// User functions
+void app_img_rle_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_IMG_RLE_H
@@ -0,0 +1,56 @@
+/**
+ * @file app_num_label.h
+ * @brief Labels that show a number: the dial values and the battery voltage, set from their event callbacks and
+ *        model renders every time they run. lv_label_set_text_fmt() formats through lv_printf, reallocates the
+ *        label's text in the LVGL heap and relayouts and invalidates the label, even when the text comes out the
+ *        same. Here the number is formatted as integer or fixed point (centivolts with 2 decimals print as volts)
+ *        without printf, compared with what the label shows, and only a changed text is set, with
+ *        lv_label_set_text_static() on the label's own fixed-capacity buffer.
+ *        Text reads: prefix, a space if there is a prefix, the number, suffix. Prefix and suffix may be NULL.
+ *        host/font_subset reads the prefix and suffix of app_num_label_set() calls for the UI font.
+ *        Call from the LVGL owning task only, except app_num_label_get_stats().
+ *
+ */
+
+#ifndef APP_NUM_LABEL_H
+#define APP_NUM_LABEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdint.h>
+#include "esp_log.h"
+#include "lvgl.h"
+
+// Settings
+#define APP_NUM_LABEL_CAP       16      // Text bytes per label, terminator included. Longer texts are copied to the
+                                        // LVGL heap by lv_label_set_text() (counted as allocations)
+#define APP_NUM_LABEL_MAX_DECIMALS 9     // Fixed point places, more are clamped to this
+
+// Typedefs
+typedef struct {
+    lv_obj_t * label;
+    char text[APP_NUM_LABEL_CAP];       // What the label shows, when it fits
+} app_num_label_t;
+
+typedef struct {
+    uint32_t updates;           // app_num_label_set() calls
+    uint32_t unchanged;         // Same text, nothing done
+    uint32_t invalidations;     // Text set: label relayout and redraw
+    uint32_t allocations;       // Text too long for the buffer, set through the LVGL heap
+} app_num_label_stats_t;
+
+// User functions
+void app_num_label_init(app_num_label_t * nl, lv_obj_t * label);
+void app_num_label_set(app_num_label_t * nl, const char * prefix, int32_t value, uint8_t decimals, const char * suffix);
+void app_num_label_get_stats(app_num_label_stats_t * stats);
+void app_num_label_reset_stats(void);
+void app_num_label_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_NUM_LABEL_H
@@ -0,0 +1,65 @@
+/**
+ * @file app_press.h
+ * @brief Timestamp-based press duration, long-press and multi-click classification for the encoder switches.
+ *        Durations are computed from the debounced edge timestamps published by the rotary encoder driver.
+ *        Deadlines (long-press threshold, end of the multi-click window) are software timers on the app_timer
+ *        wheel, armed only while a deadline is pending.
+ *
+ */
+
+#ifndef APP_PRESS_H
+#define APP_PRESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include "app_utility.h"
+#include "app_timer.h"
+
+// Settings
+#define APP_PRESS_LONG_US           600000  // Held at least this long -> long press (fires while still held)
+#define APP_PRESS_MULTICLICK_US     250000  // A following press within this window of a release extends the click count
+#define APP_PRESS_MAX_CLICKS        2       // Click count at which a sequence is reported without waiting out the window
+
+// Typedefs
+typedef enum {
+    APP_PRESS_NONE = 0,
+    APP_PRESS_CLICK,        // Click sequence finished, see .clicks (1 = tap, 2 = double click)
+    APP_PRESS_LONG,         // Held past APP_PRESS_LONG_US, reported while still held
+    APP_PRESS_LONG_RELEASE  // Released after a long press, see .duration_us
+} app_press_kind_t;
+
+typedef struct {
+    app_press_kind_t kind;
+    int id;                 // Key id of the tracker that produced this result
+    uint8_t clicks;         // Number of clicks in the sequence (APP_PRESS_CLICK)
+    uint32_t duration_us;   // Duration of the last press
+    int64_t timestamp_us;   // Edge or deadline time this result was produced at
+} app_press_result_t;
+
+typedef struct {
+    int id;                 // Key id, reported in every result
+    bool pressed;
+    bool long_fired;
+    uint8_t clicks;
+    int64_t press_us;       // Timestamp of the current/last press edge
+    int64_t release_us;     // Timestamp of the last release edge
+    int64_t deadline_us;    // Next pending deadline, 0 if none
+    SemaphoreHandle_t wake; // Given by the deadline timer when deadline_us has passed
+    app_timer_t deadline_timer;
+} app_press_tracker_t;
+
+// User functions
+void app_press_tracker_init(app_press_tracker_t * tracker, int id);
+bool app_press_on_edge(app_press_tracker_t * tracker, bool pressed, int64_t timestamp_us, app_press_result_t * result);
+bool app_press_on_deadline(app_press_tracker_t * tracker, int64_t now_us, app_press_result_t * result);
+
+esp_err_t app_press_register(app_press_tracker_t * tracker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_PRESS_H
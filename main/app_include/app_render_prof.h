@@ -0,0 +1,94 @@
+/**
+ * @file app_render_prof.h
+ * @brief Per frame render profiler. Hooks LVGL's refresh through its own extension points (object draw events,
+ *        the software draw context's primitives and blend, the display driver's render start, flush and monitor
+ *        callbacks) so lvgl itself stays unmodified, and records for every frame the invalidated areas, the draw
+ *        time of each object class excluding its children, the time spent blending and in the rest of the draw
+ *        primitives (mask evaluation, glyph and image fetch), and the time spent in flush. Frames go to a ring
+ *        buffer for dumping to the log; cumulative per object totals name the most expensive widget.
+ *        Times are CPU cycles (esp_cpu_get_cycle_count), so the display task must not change core mid frame.
+ *        Hardware independent, also runs in the host build.
+ *
+ */
+
+#ifndef APP_RENDER_PROF_H
+#define APP_RENDER_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_cpu.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "lvgl.h"
+#include "app_gauge.h"
+
+// Settings
+#define APP_RENDER_PROF_ENABLE          0       // app_main: instrument the display (display task pinned) and dump with the heartbeat
+#define APP_RENDER_PROF_RING            32      // Frames kept
+#define APP_RENDER_PROF_MAX_AREAS       8       // Invalidated areas recorded per frame, the rest are only counted
+#define APP_RENDER_PROF_MAX_OBJS        48      // Objects with cumulative totals
+#define APP_RENDER_PROF_DUMP_FRAMES     8       // Most recent frames printed by app_render_prof_log_stats
+#define APP_RENDER_PROF_TOP_OBJS        8       // Most expensive objects printed
+
+// Typedefs
+typedef enum {
+    APP_RENDER_PROF_OBJ = 0,    // Plain lv_obj (screen, containers)
+    APP_RENDER_PROF_LABEL,
+    APP_RENDER_PROF_ARC,
+    APP_RENDER_PROF_IMG,
+    APP_RENDER_PROF_GAUGE,      // app_gauge
+    APP_RENDER_PROF_OTHER,
+    APP_RENDER_PROF_NUM_CLASSES
+} app_render_prof_class_t;
+
+typedef struct {
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} app_render_prof_area_t;
+
+typedef struct {
+    uint32_t seq;
+    uint32_t tick_ms;                                       // lv_tick_get() at render start
+    uint8_t areas;                                          // Areas drawn, after LVGL's joining and the flush planner
+    uint32_t area_px;
+    app_render_prof_area_t area[APP_RENDER_PROF_MAX_AREAS];
+    uint32_t class_cycles[APP_RENDER_PROF_NUM_CLASSES];     // Draw time excluding children
+    uint16_t class_draws[APP_RENDER_PROF_NUM_CLASSES];      // Object draws, once per strip an object touches
+    uint32_t blend_cycles;                                  // Inside the blend function
+    uint32_t shape_cycles;                                  // Inside draw primitives but outside blend
+    uint32_t flush_cycles;                                  // Inside the driver's flush_cb
+    uint32_t flushes;
+    uint32_t total_cycles;                                  // Render start to monitor
+} app_render_prof_frame_t;
+
+typedef struct {
+    const lv_obj_t * obj;
+    app_render_prof_class_t cls;
+    lv_area_t coords;           // When last drawn
+    uint32_t draws;
+    uint64_t cycles;
+} app_render_prof_obj_t;
+
+// User functions
+esp_err_t app_render_prof_init(lv_disp_t * disp, uint32_t cycles_per_us);
+void app_render_prof_attach(lv_obj_t * root);
+void app_render_prof_reset(void);
+int app_render_prof_get_frames(app_render_prof_frame_t * frames, int max_frames);
+int app_render_prof_get_objs(app_render_prof_obj_t * objs, int max_objs);
+void app_render_prof_log_frame(const char * TAG, const app_render_prof_frame_t * frame);
+void app_render_prof_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_RENDER_PROF_H
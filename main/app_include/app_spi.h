@@ -19,8 +19,15 @@ extern "C" {
 #include "lvgl.h"
 #include "lvgl_helpers.h"
 #include "esp_timer.h"
-
-// Image files. These are linked in by CMake (see CMAKELists.txt src list)
+#include "app_gauge.h"
+#include "app_img_rle.h"
+#include "app_glyph_cache.h"
+#include "app_blend_565.h"
+#include "app_num_label.h"
+#include "app_banner.h"
+
+// Image files. These are generated from assets/*.png by host/img_pack on every build and linked in by CMake
+// (see CMakeLists.txt), as app_img_<png name>
 //#include "app_img_universityCrest160x160.c"
 //#include "app_img_directivity160x160.c"
 
@@ -36,9 +43,13 @@ extern "C" {
 
 // Settings
 #define LCD_HOST                VSPI_HOST
-#define LV_TICK_PERIOD_MS       1
 #define ANIM_PERIOD_MS          5000
 #define APP_ARC_SIZE            50
+#define DISPLAY_PACED           1       // Sleep until LVGL's next timer or a wake notification. 0 = poll every tick (A/B)
+#define DISPLAY_MAX_SLEEP_MS    1000    // Upper bound on a paced sleep, LVGL reports no timer due at all
+#define DISPLAY_SLPOUT_US       5000    // ILI9341: wait after Sleep Out before the next command
+#define DISPLAY_WAKE_INPUT      (1 << 0)    // Display task notification bits
+#define DISPLAY_WAKE_MODEL      (1 << 1)
 
 typedef enum lv_color_t {
     APP_COLOR_RED           = 0xB11C1C,
@@ -92,6 +103,9 @@ extern const char app_icons[][4]; // Declare as extern
 lv_obj_t * app_arc_create(lv_obj_t * comp_parent, app_arc_t arc_t, lv_coord_t r, 
                           lv_align_t align, lv_coord_t x_offs, lv_coord_t y_offs,
                           bool symmetric_mode);
+lv_obj_t * app_arc_gauge_create(lv_obj_t * comp_parent, lv_coord_t r,
+                                lv_align_t align, lv_coord_t x_offs, lv_coord_t y_offs,
+                                bool symmetric_mode);
 
 
 #ifdef __cplusplus
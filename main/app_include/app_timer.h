@@ -1,9 +1,11 @@
 /**
- * @file app_adc.h
- * @brief application specific definitions for UART2 operation on remote PCB for sound steering project.
- *        This UART port is intended for use only in development and is to be replaced with a wireless BT link.
- *        (courtesy of PRO_CPU :P)
- * 
+ * @file app_timer.h
+ * @brief Software timers for the application, multiplexed onto a single gptimer. Timers are kept in a
+ *        hierarchical timer wheel (app_timer_wheel.h) and the gptimer is run as a one-shot alarm for the next tick
+ *        the wheel needs serviced. The alarm ISR only queues work; wheel upkeep and every timer callback run
+ *        in the timer task, which also serves as a general deferred-work queue (app_work_submit*).
+ *        Deadlines use the esp_timer_get_time() time base so they can be compared with driver event timestamps.
+ *
  */
 
 #ifndef APP_TIMER_H
@@ -15,25 +17,39 @@ extern "C" {
 
 // --------------- Includes --------------- //
 #include "driver/gptimer.h"
+#include "esp_timer.h"
 #include "app_utility.h"
+#include "app_timer_wheel.h"
 
-#define GPTIMER_BASE_TICK_FREQ_HZ (uint32_t)(1 * 1000 * 1000) // Set 1MHz base resolution
-#define GPTIMER_MS_TO_TICKS(X)    (uint32_t)((X / 1000.0) * GPTIMER_BASE_TICK_FREQ_HZ)
-#define GPTIMER_TICKS_TO_MS(X)    (uint32_t)((X * 1000.0) / GPTIMER_BASE_TICK_FREQ_HZ)
+// Settings
+#define APP_TIMER_RESOLUTION_HZ     (uint32_t)(1 * 1000 * 1000)  // gptimer counts microseconds
+#define APP_TIMER_TICK_US           1000                        // Wheel tick, timers fire up to one tick late, never early
+#define APP_TIMER_MIN_ALARM_US      20                          // Closest an alarm is programmed ahead of the counter
+#define APP_TIMER_WORK_QUEUE_LENGTH 16
+#define APP_TIMER_TASK_STACK        (1024 * 3)
+#define APP_TIMER_TASK_PRIORITY     (configMAX_PRIORITIES - 1)
 
-//typedef void (*gptimer_callback_t) (void *);
+// Typedefs
+typedef void (*app_work_fn_t)(void * arg);
 
 typedef struct {
-    gptimer_handle_t * timerHandle;
-    bool running;
-} gptimer_state_t;
+    app_work_fn_t fn;
+    void * arg;
+} app_work_item_t;
 
-esp_err_t app_initTimer(gptimer_handle_t * timerHandle, void (*cb)(int), uint16_t time_ms, bool oneShot);
-esp_err_t app_toggleTimerRun(gptimer_handle_t * timerHandle, gptimer_state_t * state);
-esp_err_t app_reconfigTimerAlarm(gptimer_handle_t * timerHandle, gptimer_state_t * state, uint16_t time_ms, bool oneShot);
+// User functions
+esp_err_t app_timer_init(void);
+void app_timer_setup(app_timer_t * timer, app_timer_cb_t cb, void * arg);
+esp_err_t app_timer_arm(app_timer_t * timer, uint32_t delay_us, uint32_t period_us);
+esp_err_t app_timer_arm_at(app_timer_t * timer, int64_t deadline_us);
+void app_timer_cancel(app_timer_t * timer);
+bool app_timer_is_armed(app_timer_t * timer);
+
+esp_err_t app_work_submit(app_work_fn_t fn, void * arg);
+bool app_work_submit_from_isr(app_work_fn_t fn, void * arg);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif  // APP_TIMER_H
\ No newline at end of file
+#endif  // APP_TIMER_H
@@ -0,0 +1,67 @@
+/**
+ * @file app_timer_wheel.h
+ * @brief Hierarchical timer wheel (hardware independent core of app_timer). Timers live on intrusive lists
+ *        in APP_TIMER_WHEEL_LEVELS levels of APP_TIMER_WHEEL_SLOTS slots each; a timer due within 64 ticks sits
+ *        in level 0, within 64^2 ticks in level 1 and so on, and is cascaded one level down when its slot
+ *        comes round. Arm, cancel and expire are O(1); finding the next tick that needs attention is
+ *        O(levels) via per-level occupancy bitmaps, so idle stretches are skipped rather than ticked through.
+ *        Due timers are parked on an expired list until the owner pops them, so a callback may cancel or re-arm
+ *        any timer, including one that expired in the same batch. No locking here, the owner serializes access.
+ *
+ */
+
+#ifndef APP_TIMER_WHEEL_H
+#define APP_TIMER_WHEEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Settings
+#define APP_TIMER_WHEEL_BITS        6
+#define APP_TIMER_WHEEL_SLOTS       (1 << APP_TIMER_WHEEL_BITS)
+#define APP_TIMER_WHEEL_LEVELS      4                                           // 64^4 ticks = ~4.6 h at 1 ms per tick
+#define APP_TIMER_WHEEL_RANGE       (1ull << (APP_TIMER_WHEEL_BITS * APP_TIMER_WHEEL_LEVELS))
+#define APP_TIMER_NEVER             UINT64_MAX
+
+// Typedefs
+typedef void (*app_timer_cb_t)(void * arg);
+
+typedef struct app_timer {
+    struct app_timer * next;    // Slot or expired list links while armed
+    struct app_timer * prev;
+    uint64_t expires;           // Absolute tick
+    uint32_t period;            // Ticks, 0 for one-shot
+    app_timer_cb_t cb;
+    void * arg;
+    uint8_t level;
+    uint8_t slot;
+    bool armed;
+} app_timer_t;
+
+typedef struct {
+    app_timer_t * slots[APP_TIMER_WHEEL_LEVELS][APP_TIMER_WHEEL_SLOTS];
+    uint64_t occupied[APP_TIMER_WHEEL_LEVELS];  // Bit n set while slot n is non-empty
+    app_timer_t * expired;                      // Due, waiting to be popped
+    app_timer_t * expired_tail;
+    uint64_t now;                               // Next tick to be processed
+} app_timer_wheel_t;
+
+// User functions
+void app_timer_wheel_init(app_timer_wheel_t * wheel, uint64_t now_tick);
+void app_timer_wheel_add(app_timer_wheel_t * wheel, app_timer_t * timer);
+void app_timer_wheel_remove(app_timer_wheel_t * wheel, app_timer_t * timer);
+uint64_t app_timer_wheel_next(const app_timer_wheel_t * wheel);
+void app_timer_wheel_advance(app_timer_wheel_t * wheel, uint64_t now_tick);
+app_timer_t * app_timer_wheel_pop(app_timer_wheel_t * wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_TIMER_WHEEL_H
@@ -0,0 +1,54 @@
+/**
+ * @file app_ui.h
+ * @brief The remote's main screen: images, scrolling banner, encoder and pot arcs, battery and channel readouts,
+ *        the two encoder input devices and the value to widget bindings (app_ui_model). Application state is read
+ *        through an app_ui_io_t, so the same screen builds on the device and in the host simulator (host/sim_ui.c).
+ *        Call from the LVGL owning task only.
+ *
+ */
+
+#ifndef APP_UI_H
+#define APP_UI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include "lvgl.h"
+#include "app_spi.h"
+#include "app_ui_model.h"
+
+// Typedefs
+typedef enum {
+    APP_UI_ENC_A = 0,           // Azimuth
+    APP_UI_ENC_B,               // Elevation
+    APP_UI_NUM_ENC
+} app_ui_enc_t;
+
+typedef enum {
+    APP_UI_POT_C = 0,           // Volume
+    APP_UI_POT_D,               // Distance, also sets the backlight
+    APP_UI_NUM_POT
+} app_ui_pot_t;
+
+// Readers return the quantity as displayed and must be cheap, they are sampled on every UI sync
+typedef struct {
+    int (*enc_pos)(app_ui_enc_t enc);           // Encoder position, MIN_ENCODER_COUNTS..MAX_ENCODER_COUNTS
+    bool (*enc_pressed)(app_ui_enc_t enc);      // Debounced switch state, true while held
+    int (*pot_pct)(app_ui_pot_t pot);           // Pot position, percent
+    int (*vbat_cv)(void);                       // Battery voltage, centivolts
+    battery_states_t (*battery_state)(void);
+    void (*set_backlight)(int pct);             // NULL when there is no backlight to drive
+} app_ui_io_t;
+
+// User functions
+void app_display_init(const app_ui_io_t * io);
+void app_display_show_image(int index);
+void app_display_swap_image(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_UI_H
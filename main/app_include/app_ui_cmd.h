@@ -0,0 +1,74 @@
+/**
+ * @file app_ui_cmd.h
+ * @brief UI command queue: the only way other tasks change what the display shows. Producers (input, ADC, app_main)
+ *        post small commands - set a value, set a state, show a screen - and never touch LVGL or anything the LVGL
+ *        callbacks read. The display task drains the queue once per frame before rendering, so LVGL has a single
+ *        owner and needs no mutex.
+ *        Bounded and lock-free: a ring of APP_UI_CMD_QUEUE_LEN cells with a sequence number each, producers claim a
+ *        cell with a compare-and-swap on the enqueue position and publish it with a release store; the single
+ *        consumer needs no atomic read-modify-write at all. A full queue drops the command and returns false, so a
+ *        producer that only posts on change keeps its last value unposted and retries on its next sample.
+ *        Commands carry absolute values (a position, not a step; an image index, not "swap"), so the drain keeps
+ *        only the latest per type and target and applies each once: several updates to one widget within a frame
+ *        collapse into one. Targets of different keys are independent and applied in key order.
+ *        app_ui_cmd_post() from any task (not from an ISR); everything else from the consumer task only, except
+ *        app_ui_cmd_get_stats().
+ *
+ */
+
+#ifndef APP_UI_CMD_H
+#define APP_UI_CMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+// Settings
+#define APP_UI_CMD_QUEUE_LEN        32      // Cells, power of two
+#define APP_UI_CMD_MAX_TARGETS      8       // Targets per command type
+
+// Typedefs
+typedef enum {
+    APP_UI_CMD_SET_VALUE = 0,   // A displayed number (position, percent, centivolts)
+    APP_UI_CMD_SET_STATE,       // A discrete state (switch held, battery level)
+    APP_UI_CMD_SHOW_SCREEN,     // Which image/screen is shown
+    APP_UI_CMD_NUM_TYPES
+} app_ui_cmd_type_t;
+
+typedef struct {
+    uint8_t type;               // app_ui_cmd_type_t
+    uint8_t target;             // Meaning is the application's, < APP_UI_CMD_MAX_TARGETS
+    int32_t value;
+} app_ui_cmd_t;
+
+// Called by app_ui_cmd_drain() once per changed type and target, with the latest value posted
+typedef void (*app_ui_cmd_apply_t)(app_ui_cmd_type_t type, uint8_t target, int32_t value);
+
+typedef struct {
+    uint32_t posted;            // Commands accepted
+    uint32_t dropped;           // ... refused, queue full
+    uint32_t drained;           // Commands taken off the queue
+    uint32_t applied;           // Apply calls after collapsing
+    uint32_t collapsed;         // Commands overtaken by a later one for the same target in the same batch
+    uint32_t batches;           // Drains that found anything
+    uint32_t max_batch;         // Most commands in one drain
+    uint32_t high_water;        // Deepest the queue has been seen at a drain
+} app_ui_cmd_stats_t;
+
+// User functions
+void app_ui_cmd_init(void);
+bool app_ui_cmd_post(app_ui_cmd_type_t type, uint8_t target, int32_t value);
+uint32_t app_ui_cmd_drain(app_ui_cmd_apply_t apply);
+void app_ui_cmd_get_stats(app_ui_cmd_stats_t * stats);
+void app_ui_cmd_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_UI_CMD_H
@@ -0,0 +1,60 @@
+/**
+ * @file app_ui_model.h
+ * @brief Change-driven binding between application values and the widgets that show them. Each binding samples
+ *        its value (already quantized to what is displayed) and only calls its render function when that value
+ *        differs from the last one rendered, so unchanged widgets are never touched and never invalidated.
+ *        Also accumulates LVGL's invalidated pixel count (disp_drv.monitor_cb) into per second figures.
+ *        Sync from the LVGL owning task only.
+ *
+ */
+
+#ifndef APP_UI_MODEL_H
+#define APP_UI_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------- Includes --------------- //
+#include "lvgl.h"
+#include "app_utility.h"
+
+// Settings
+#define APP_UI_MODEL_ALWAYS_RENDER  0       // 1 = render every binding on every sync (old per-tick behaviour), for A/B of px/s
+#define APP_UI_MODEL_WINDOW_MS      1000    // Stats window
+
+// Typedefs
+typedef int32_t (*app_ui_read_t)(void * ctx);
+typedef void (*app_ui_render_t)(void * ctx, int32_t value);
+
+typedef struct {
+    const char * name;
+    app_ui_read_t read;         // Returns the displayed quantity, cheap, no LVGL calls
+    app_ui_render_t render;     // Pushes a new value into the widget(s)
+    void * ctx;                 // Widget or other target, passed to read and render
+    int32_t last;               // Last rendered value
+    bool valid;                 // False until rendered once
+    uint32_t renders;
+} app_ui_binding_t;
+
+typedef struct {
+    uint32_t px_per_s;          // Invalidated (re-rendered) pixels, last full window
+    uint32_t refr_per_s;        // Display refreshes that rendered anything, last full window
+    uint32_t renders_per_s;     // Binding renders, last full window
+    uint32_t syncs_per_s;       // Sync calls, last full window
+    uint64_t px_total;
+} app_ui_stats_t;
+
+// User functions
+void app_ui_model_init(app_ui_binding_t * bindings, int num_bindings);
+int app_ui_model_sync(void);
+void app_ui_model_invalidate(void);
+void app_ui_model_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px);
+void app_ui_model_get_stats(app_ui_stats_t * stats);
+void app_ui_model_log_stats(const char * TAG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // APP_UI_MODEL_H
@@ -24,37 +24,33 @@
 #include "app_include/app_uart2.h"      /* UART2 driver application specific code */
 #include "app_include/app_gpio.h"       /* GPIO driver application specific code */
 #include "app_include/app_spi.h"        /* SPI driver application specific code and LVGL/display related */
+#include "app_include/app_ui_model.h"   /* Change-driven value to widget bindings, invalidated pixel stats */
+#include "app_include/app_ui.h"         /* Main screen, encoder input devices and widget bindings (also built on the host) */
+#include "app_include/app_ui_cmd.h"     /* Lock-free UI command queue, the only way other tasks change the screen */
+#include "app_include/app_disp_pipe.h"  /* Double buffered DMA draw buffers, strip height sweep, frame timing */
+#include "app_include/app_disp_power.h" /* Inactivity dimming and panel sleep, time per state and current estimate */
+#include "app_include/app_render_prof.h" /* Per frame render profiler: areas, per class draw time, blend, flush */
+#include "app_include/app_glyph_cache.h" /* A8 glyph cache under LVGL's draw_letter, hit and eviction counters */
+#include "app_include/app_num_label.h"  /* Number labels on static text, unchanged text skipped, invalidation counters */
+#include "app_include/app_banner.h"     /* Scrolling banner from a pre-rendered text strip, invalidated band counters */
 #include "app_include/app_encoder.h"    /* Rotary encoder driver application specific code */
-#include "app_include/app_timer.h"      /* Provide hardware timer units for measuring button actuation durations. Expand possibilities of user input with dedicated keys (2x encoder switches) */
+#include "app_include/app_timer.h"      /* Software timer wheel on one gptimer, callbacks run in a deferred-work task */
+#include "app_include/app_press.h"      /* Press durations, long presses and multi-clicks from switch edge timestamps. Expand possibilities of user input with dedicated keys (2x encoder switches) */
+#include "app_include/app_gesture.h"    /* Compiled key combo (gesture) matcher fed by both encoder switches */
 #include "app_include/app_bluetooth.h"  /* Bluetooth peripheral application specific code. Nothing implemented yet. A bit nervous for the impending overhead. */
+#include "esp_rom_sys.h"                /* esp_rom_delay_us(), for the panel's command timings */
 
 /*========================== CONSTANTS, MACROS, AND VARIABLE DECLARATIONS ==========================*/
 
 /* Global Vars */
 static battery_states_t batteryState = BAT_LOW;
 
-/* Creates a semaphore to handle concurrent call to lvgl stuff
- * If you wish to call *any* lvgl function from other threads/tasks
- * you should lock on the very same semaphore! */
-SemaphoreHandle_t xGuiSemaphore;
-lv_obj_t * arc0;
-lv_obj_t * arc1;
-lv_obj_t * arc2;
-lv_obj_t * arc3;
-QueueHandle_t xEncoderAQueue;
-QueueHandle_t xEncoderBQueue;
+/* LVGL, and everything its callbacks read (uiState), belong to displayTask alone.
+ * Other tasks change the screen by posting to the UI command queue (app_ui_cmd),
+ * never by calling lvgl functions or writing what the UI reads. */
+QueueHandle_t xInputQueue;     // Shared by both encoders, see inputTask
 rotary_encoder_info_t encA = { 0 };
 rotary_encoder_info_t encB = { 0 };
-rotary_encoder_event_t eventA = { 0 };
-rotary_encoder_event_t eventB = { 0 };
-rotary_encoder_state_t stateA = { 0 };
-rotary_encoder_state_t stateB = { 0 };
-
-lv_obj_t * vbatLabel;
-static lv_style_t vbatLabel_style;
-lv_obj_t * chanSelect_label;
-lv_obj_t * app_images[2];
-bool activeImage = true;
 
 // These vars are defined in app_spi.c
 extern const char * batteryStateNames[4];
@@ -63,8 +59,6 @@ extern uint32_t textColors[2];    // Declare as extern
 extern uint32_t batteryColors[3]; // Declare as extern
 extern const char app_icons[][4]; // Declare as extern
 extern const char * gpio_status_names[2];
-extern const char * keypress_combo_names[NUM_COMBOS];
-extern int keypress_combos[NUM_COMBOS][KEYPRESS_COMBO_LENGTH];
 
 int posA = 0; // Azimuth angle, -30 -> 30
 int posB = 0; // Elevation angle, -30 -> 30
@@ -92,11 +86,75 @@ adc_filter_t vpotc_filt_handle = {0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 10, fals
 
 disp_backlight_h bl;
 
-volatile bool timerAFlag = false;
-volatile bool timerBFlag = false;
+app_press_tracker_t pressA;
+app_press_tracker_t pressB;
 volatile bool change_channel_flag = false;
 volatile bool toggle_on_off_flag = false;
 
+static app_gesture_matcher_t gestureMatcher;
+
+static TaskHandle_t displayTaskHandle = NULL;
+
+// Display task profile, logged with the heartbeat when VERBOSE
+static struct {
+    uint32_t wakeups;           // Loop passes (paced: wakes from the notification wait)
+    uint32_t wake_input;        // ... of which woken early by an input
+    uint32_t wake_model;        // ... of which woken early by a UI model change
+    uint64_t busy_us;           // Time spent awake in the loop
+    int64_t window_start_us;
+    uint32_t busy_permille;     // Busy share of one core over the last window
+    uint32_t wakeups_per_s;
+} displayStats;
+
+// Input task profile, logged with the heartbeat when VERBOSE
+static struct {
+    uint32_t wakeups;           // Times the input task left the blocked state
+    uint32_t steps;             // Encoder steps published to posA/posB
+    uint32_t latency_max_us;    // Quadrature ISR to published position
+    uint64_t latency_total_us;
+} inputStats;
+
+typedef enum {
+    GESTURE_TOGGLE_ON_OFF = 0,
+    GESTURE_CHANGE_CHANNEL,
+    GESTURE_SWAP_IMAGE
+} app_gesture_id_t;
+
+// Key combos. Two quick taps of the same key arrive as a double click, so each 3 tap combo has a double click spelling too.
+static const app_gesture_def_t gestureTable[] = {
+    {GESTURE_TOGGLE_ON_OFF,  "on off",      3, {APP_GESTURE_SYM_TAP_A, APP_GESTURE_SYM_TAP_A, APP_GESTURE_SYM_TAP_B}},
+    {GESTURE_TOGGLE_ON_OFF,  "on off",      2, {APP_GESTURE_SYM_DOUBLE_A, APP_GESTURE_SYM_TAP_B}},
+    {GESTURE_CHANGE_CHANNEL, "change chan", 3, {APP_GESTURE_SYM_TAP_A, APP_GESTURE_SYM_TAP_B, APP_GESTURE_SYM_TAP_B}},
+    {GESTURE_CHANGE_CHANNEL, "change chan", 2, {APP_GESTURE_SYM_TAP_A, APP_GESTURE_SYM_DOUBLE_B}},
+    {GESTURE_SWAP_IMAGE,     "swap image",  1, {APP_GESTURE_SYM_CHORD_AB}},
+};
+
+// UI command targets (app_ui_cmd), per command type
+typedef enum {
+    UI_VALUE_ENC_A = 0,         // Encoder position, in app_ui_enc_t order
+    UI_VALUE_ENC_B,
+    UI_VALUE_POT_C,             // Pot, percent, in app_ui_pot_t order
+    UI_VALUE_POT_D,
+    UI_VALUE_VBAT_CV,           // Battery voltage, centivolts
+} app_ui_value_id_t;
+
+typedef enum {
+    UI_STATE_SW_A = 0,          // Encoder switch held, in app_ui_enc_t order
+    UI_STATE_SW_B,
+    UI_STATE_BATTERY,           // battery_states_t
+} app_ui_state_id_t;
+
+// What the screen shows: written by the UI command drain and read by the LVGL callbacks, display task only
+static struct {
+    int enc_pos[APP_UI_NUM_ENC];
+    bool enc_pressed[APP_UI_NUM_ENC];
+    int pot_pct[APP_UI_NUM_POT];
+    int vbat_cv;
+    battery_states_t battery;
+} uiState = {.battery = BAT_LOW};
+
+static int uiImage = 1;         // Image the input task wants shown, app_display_init starts on image 1
+
 SemaphoreHandle_t xChannelFlagSemaphore;
 SemaphoreHandle_t xToggleOnOffFlagSemaphore;
 
@@ -258,6 +316,53 @@ static void rxTask(void *arg) {
     free(data);
 }
 
+/*---------------------------------------------------------------
+    Wake the display task ahead of its next LVGL timer
+---------------------------------------------------------------*/
+static void displayWake(uint32_t reason) {
+    if (displayTaskHandle != NULL) {
+        xTaskNotify(displayTaskHandle, reason, eSetBits);
+    }
+}
+
+/*---------------------------------------------------------------
+    Post a UI command if its value moved since the last one
+    posted for it. A full queue leaves *last alone, so the value
+    goes again with the producer's next call
+---------------------------------------------------------------*/
+static bool uiPost(app_ui_cmd_type_t type, uint8_t target, int32_t value, int32_t * last) {
+    if (value == *last || !app_ui_cmd_post(type, target, value)) {
+        return false;
+    }
+    *last = value;
+    return true;
+}
+
+/*---------------------------------------------------------------
+    ADC samples as displayed (app_ui_io_t units). Posted, and the
+    display woken, only when the quantized value moves
+---------------------------------------------------------------*/
+static void vpotcSample(int vfilt) {
+    static int32_t last = INT32_MIN;
+    if (uiPost(APP_UI_CMD_SET_VALUE, UI_VALUE_POT_C, SCALE_VPOT_INVERT(vfilt), &last)) {
+        displayWake(DISPLAY_WAKE_MODEL);
+    }
+}
+
+static void vpotdSample(int vfilt) {
+    static int32_t last = INT32_MIN;
+    if (uiPost(APP_UI_CMD_SET_VALUE, UI_VALUE_POT_D, SCALE_VPOT_INVERT(vfilt), &last)) {
+        displayWake(DISPLAY_WAKE_MODEL);
+    }
+}
+
+static void vbatSample(int vfilt) {
+    static int32_t last = INT32_MIN;
+    if (uiPost(APP_UI_CMD_SET_VALUE, UI_VALUE_VBAT_CV, (int32_t)(SCALE_VBAT(vfilt) * 100 + 0.5f), &last)) {
+        displayWake(DISPLAY_WAKE_MODEL);
+    }
+}
+
 /*---------------------------------------------------------------
     ADC Oneshot-Mode Continuous Read Task
     
@@ -307,6 +412,9 @@ static void adcTask(void * pvParameters) {
             if (err == ESP_OK) {
 
                 *vfilt = adc_filter(*vcal, filt);
+                if (params->on_sample != NULL) {
+                    params->on_sample(*vfilt);
+                }
             
                 if (VERBOSE_FLAG) {
                     ESP_LOGI(TAG, "ADC%d_%d raw  : %d counts", unit + 1, chan, *vraw);
@@ -324,127 +432,6 @@ static void adcTask(void * pvParameters) {
     adc_calibration_deinit(*cali_handle);
 }
 
-/*---------------------------------------------------------------
-    LCD object x-position set. Used for scrolling LVGL objects.
----------------------------------------------------------------*/
-static void set_x(void * var, int32_t v) {
-    lv_obj_set_x(var, v);
-}
-
-/*---------------------------------------------------------------
-    LVGL Encoder Input Device Read Callback
----------------------------------------------------------------*/
-static void lv_indev_encA_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data) {
-    // Keep a temp count here, and grab current count from ISR
-    // do the differencing and set the encoder_diff value
-
-    const char * TAG = "ENC_RD_CB_A";
-
-    static int temp = 0;
-    
-    if (posA > temp) {
-        data->enc_diff = posA - temp;
-    }
-    else if (posA < temp) {
-        data->enc_diff = -(temp - posA);
-    }
-
-    temp = posA;
-
-}
-
-/*---------------------------------------------------------------
-    LVGL Encoder Input Device Read Callback
----------------------------------------------------------------*/
-static void lv_indev_encB_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data) {
-    // Keep a temp count here, and grab current count from ISR
-    // do the differencing and set the encoder_diff value
-
-    const char * TAG = "ENC_RD_CB_B";
-
-    static int temp = 0;
-    
-    // Me thinks we should probably use a queue here with 0 timeout,
-    // then check with the static temp value, and update accordingly.
-
-    if (posB > temp) {
-        data->enc_diff = posB - temp;
-    }
-    else if (posB < temp) {
-        data->enc_diff = -(temp - posB);
-    }
-    temp = posB;
-
-}
-
-/*---------------------------------------------------------------
-    LCD callback function for updating arc rotation
----------------------------------------------------------------*/
-static void arc_encA_event_cb(lv_event_t * e) {
-
-    const char * TAG = "LV_ARC_CHNG_A";
-
-    lv_event_code_t event_code = lv_event_get_code(e);
-    lv_obj_t * arc = lv_event_get_target(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
-
-    lv_arc_set_value(arc, posA * 2);
-    lv_label_set_text_fmt(label, /*"%" LV_PRId32 "%%"*/"%d", lv_arc_get_value(arc) / 2);
-
-}
-
-/*---------------------------------------------------------------
-    LCD callback function for updating arc rotation
----------------------------------------------------------------*/
-static void arc_encB_event_cb(lv_event_t * e) {
-
-    const char * TAG = "LV_ARC_CHNG_B";
-
-    lv_event_code_t event_code = lv_event_get_code(e);
-    lv_obj_t * arc = lv_event_get_target(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
-
-    lv_arc_set_value(arc, posB * 2);
-    lv_label_set_text_fmt(label, "%d", lv_arc_get_value(arc) / 2);
-
-}
-
-/*---------------------------------------------------------------
-    LCD callback function for updating arc rotation ON POTS
----------------------------------------------------------------*/
-static void arc_potC_event_cb(lv_event_t * e) {
-
-    const char * TAG = "LV_ARC_CHNG_C";
-
-    lv_event_code_t event_code = lv_event_get_code(e);
-    lv_obj_t * arc = lv_event_get_target(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
-
-    //ESP_LOGI(TAG, "E: %d", event_code);
-
-    lv_arc_set_value(arc, (int16_t)SCALE_VPOT_INVERT(vpotc_filt));
-    lv_label_set_text_fmt(label, "%d", lv_arc_get_value(arc));
-
-}
-
-/*---------------------------------------------------------------
-    LCD callback function for updating arc rotation ON POTS
----------------------------------------------------------------*/
-static void arc_potD_event_cb(lv_event_t * e) {
-
-    const char * TAG = "LV_ARC_CHNG_C";
-
-    lv_event_code_t event_code = lv_event_get_code(e);
-    lv_obj_t * arc = lv_event_get_target(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
-
-    //ESP_LOGI(TAG, "E: %d", event_code);
-
-    lv_arc_set_value(arc, (int16_t)SCALE_VPOT_INVERT(vpotd_filt));
-    lv_label_set_text_fmt(label, "%d", lv_arc_get_value(arc));
-
-}
-
 /*---------------------------------------------------------------
     Vbat event for updating battery voltage readout and text color
 ---------------------------------------------------------------*/
@@ -469,161 +456,103 @@ static void vbat_assign_state(battery_states_t * state, float value) {
 }
 
 /*---------------------------------------------------------------
-    Vbat event for updating battery voltage readout and text color
+    Application state as shown by the UI (app_ui_io_t), from the
+    display task's own copy
 ---------------------------------------------------------------*/
-static void value_changed_event_vbat(lv_event_t * e) {
+static int uiEncPos(app_ui_enc_t enc) {
+    return uiState.enc_pos[enc];
+}
 
-    const char * TAG = "LVGL_VBAT_CHNG";
+static bool uiEncPressed(app_ui_enc_t enc) {
+    return uiState.enc_pressed[enc];
+}
+
+static int uiPotPct(app_ui_pot_t pot) {
+    return uiState.pot_pct[pot];
+}
+
+static int uiVbatCentivolts(void) {
+    return uiState.vbat_cv;
+}
 
-    lv_event_code_t event_code = lv_event_get_code(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
+static battery_states_t uiBatteryState(void) {
+    return uiState.battery;
+}
 
-    lv_style_set_text_color(&vbatLabel_style, lv_color_hex(batteryColors[batteryState]));
-    lv_label_set_text_fmt(vbatLabel, "%s %3.2fV", app_icons[batteryState], SCALE_VBAT(vbat_filt));
+static void uiSetBacklight(int pct) {
+    app_disp_power_set_brightness(pct, esp_timer_get_time());     // Shown while the display is on
+}
 
+/*---------------------------------------------------------------
+    UI command drain: the latest posted value of each target into
+    the display task's copy, or onto the screen
+---------------------------------------------------------------*/
+static void uiApply(app_ui_cmd_type_t type, uint8_t target, int32_t value) {
+    switch (type) {
+        case APP_UI_CMD_SET_VALUE:
+            switch (target) {
+                case UI_VALUE_ENC_A:
+                case UI_VALUE_ENC_B:    uiState.enc_pos[target - UI_VALUE_ENC_A] = value; break;
+                case UI_VALUE_POT_C:
+                case UI_VALUE_POT_D:    uiState.pot_pct[target - UI_VALUE_POT_C] = value; break;
+                case UI_VALUE_VBAT_CV:  uiState.vbat_cv = value; break;
+                default: break;
+            }
+            break;
+        case APP_UI_CMD_SET_STATE:
+            switch (target) {
+                case UI_STATE_SW_A:
+                case UI_STATE_SW_B:     uiState.enc_pressed[target - UI_STATE_SW_A] = (value != 0); break;
+                case UI_STATE_BATTERY:  uiState.battery = (battery_states_t)value; break;
+                default: break;
+            }
+            break;
+        case APP_UI_CMD_SHOW_SCREEN:
+            app_display_show_image(value);
+            break;
+        default:
+            break;
+    }
 }
 
+static const app_ui_io_t uiIo = {
+    .enc_pos = uiEncPos,
+    .enc_pressed = uiEncPressed,
+    .pot_pct = uiPotPct,
+    .vbat_cv = uiVbatCentivolts,
+    .battery_state = uiBatteryState,
+    .set_backlight = uiSetBacklight,
+};
+
 /*---------------------------------------------------------------
-    LCD LVGL main application init code (plot main objects)
+    Display power manager hardware: LEDC backlight (hardware
+    fades) and ILI9341 sleep
 ---------------------------------------------------------------*/
-void app_display_init(void) {
-
-    int offset = 30;
-
-    //------------- University Crest Image ---------------//
-    app_images[0] = lv_img_create(lv_scr_act());
-    app_images[1] = lv_img_create(lv_scr_act());
-    LV_IMG_DECLARE(app_img_universityCrest160x160);
-    LV_IMG_DECLARE(app_img_directivity160x160);
-    lv_img_set_src(app_images[0], &app_img_universityCrest160x160);
-    lv_img_set_src(app_images[1], &app_img_directivity160x160);
-    //lv_img_set_angle(icon, -900);
-    lv_obj_align(app_images[0], LV_ALIGN_CENTER, -70, 32);
-    lv_obj_align(app_images[1], LV_ALIGN_CENTER, -70, 32);
-
-    //lv_obj_set_style_img_recolor_opa(icon, 255, LV_PART_MAIN);
-    //lv_obj_set_style_img_recolor(icon, lv_color_hex(/*COLOR_UNH_NAVY*/0xFFFFFF), LV_PART_MAIN);
-    lv_obj_add_flag(app_images[0], LV_OBJ_FLAG_HIDDEN);
-    //lv_obj_clear_flag(icon, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(app_images[1], LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(app_images[1], LV_OBJ_FLAG_HIDDEN);
-
-    //------------- Main display label (scrolling text) ---------------//
-    lv_obj_t * obj = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(obj, 100, 30);  // width taken care of by below call
-    lv_obj_center(obj);
-
-    lv_obj_t * label = lv_label_create(obj);
-    lv_label_set_text(label, "Sound Steering - Remote Module                By K. Harper");
-    lv_obj_add_flag(label, LV_OBJ_FLAG_FLOATING); /*To be ignored by scrollbars*/
-    lv_obj_center(label);
-    lv_obj_update_layout(obj);    /*To have the correct size for lv_obj_get_width*/
-    lv_obj_align(obj, LV_ALIGN_CENTER, -70, -75);
-
-    //------------- Enc A - Azimuth Encoder Arc ---------------//
-    arc0 = app_arc_create(lv_scr_act(), PARTIAL_ARC, APP_ARC_SIZE, LV_ALIGN_TOP_RIGHT, -10, 10, true);
-    lv_obj_t * label_arc0 = lv_label_create(lv_scr_act());
-    lv_obj_t * label_data_arc0 = lv_label_create(arc0); // set parent to arc object
-    lv_label_set_text(label_arc0, "Azim. Enc.");
-    lv_obj_align(label_arc0, LV_ALIGN_TOP_RIGHT, -70, 30);
-    lv_obj_align(label_data_arc0, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_add_event_cb(arc0, arc_encA_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, label_data_arc0);
-    //lv_obj_add_event_cb(arc0, sw_pressed_cbA, LV_EVENT_PRESSED, NULL);
-    lv_event_send(arc0, LV_EVENT_VALUE_CHANGED, 160);
-
-    //------------- Enc B - Elevation Encoder Arc ---------------//
-    arc1 = app_arc_create(lv_scr_act(), PARTIAL_ARC, APP_ARC_SIZE, LV_ALIGN_RIGHT_MID, -10, -offset, true);
-    lv_obj_t * label_arc1 = lv_label_create(lv_scr_act());
-    lv_obj_t * label_data_arc1 = lv_label_create(arc1);
-    lv_label_set_text(label_arc1, "Elev. Enc.");
-    lv_obj_align(label_arc1, LV_ALIGN_RIGHT_MID, -70, -offset);
-    lv_obj_align(label_data_arc1, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_add_event_cb(arc1, arc_encB_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, label_data_arc1);
-    lv_event_send(arc1, LV_EVENT_VALUE_CHANGED, 160);
-
-    //------------- Pot C - Volume Potentiometer Arc ---------------//
-    arc2 = app_arc_create(lv_scr_act(), PARTIAL_ARC, APP_ARC_SIZE, LV_ALIGN_RIGHT_MID, -10, +offset, false);
-    lv_obj_t * label_arc2 = lv_label_create(lv_scr_act());
-    lv_obj_t * label_data_arc2 = lv_label_create(arc2);
-    lv_label_set_text(label_arc2, "Volm. Pot.");
-    lv_obj_align(label_arc2, LV_ALIGN_RIGHT_MID, -70, +offset);
-    lv_label_set_text(label_data_arc2, "0");
-    lv_obj_align(label_data_arc2, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_add_event_cb(arc2, arc_potC_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, label_data_arc2);
-    lv_event_send(arc2, LV_EVENT_VALUE_CHANGED, NULL);
-
-    //------------- Pot D - Volume Potentiometer Arc ---------------//
-    arc3 = app_arc_create(lv_scr_act(), PARTIAL_ARC, APP_ARC_SIZE, LV_ALIGN_BOTTOM_RIGHT, -10, -10, false);
-    lv_obj_t * label_arc3 = lv_label_create(lv_scr_act());
-    lv_obj_t * label_data_arc3 = lv_label_create(arc3);
-    lv_label_set_text(label_arc3, "Dist. Pot.");
-    lv_obj_align(label_arc3, LV_ALIGN_BOTTOM_RIGHT, -70, -30);
-    lv_label_set_text(label_data_arc3, "0");
-    lv_obj_align(label_data_arc3, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_add_event_cb(arc3, arc_potD_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, label_data_arc3);
-    lv_event_send(arc3, LV_EVENT_VALUE_CHANGED, NULL);
-
-    //------------- Battery Voltage Readout ---------------//
-    vbatLabel = lv_label_create(lv_scr_act());
-    lv_style_init(&vbatLabel_style);
-    lv_style_set_text_color(&vbatLabel_style, lv_color_hex(batteryColors[batteryState]));
-    lv_label_set_text_fmt(vbatLabel, LV_SYMBOL_BATTERY_EMPTY" %3.2fV", SCALE_VBAT(vbat_filt));
-    lv_obj_add_style(vbatLabel, &vbatLabel_style, 0);
-    lv_obj_align(vbatLabel, LV_ALIGN_TOP_LEFT, 25, 5);
-    lv_obj_add_event_cb(vbatLabel, value_changed_event_vbat, LV_EVENT_VALUE_CHANGED, NULL);
-    lv_event_send(vbatLabel, LV_EVENT_VALUE_CHANGED, NULL);
-    
-    //------------- Controller Audio Chan Select 1 Indicator ---------------//
-    chanSelect_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(chanSelect_label, " C1|C2|C3");
-    lv_obj_align(chanSelect_label, LV_ALIGN_TOP_LEFT, 95, 5);
-
-    //------------- Map arc0 and encA to LVGL input device and place into LVGL object group ---------------//
-    //lv_disp_drv_register(&disp_drv); // Taken care of in init section of displayTask
-    static lv_indev_drv_t indev_drv0;
-    lv_indev_drv_init(&indev_drv0);         
-    indev_drv0.type = LV_INDEV_TYPE_ENCODER; 
-    indev_drv0.read_cb = lv_indev_encA_read_cb;      
-
-    //Register the driver in LVGL and save the created input device object
-    lv_indev_t * my_indev0 = lv_indev_drv_register(&indev_drv0);
-    lv_group_t * encA_group = lv_group_create();
-    lv_group_add_obj(encA_group, arc0);
-    lv_indev_set_group(my_indev0, encA_group);
-    lv_group_focus_obj(arc0);
-    lv_group_set_editing(encA_group, true);
-
-    //------------- Map arc1 and encB to LVGL input device and place into LVGL object group ---------------//
-    static lv_indev_drv_t indev_drv1;
-    lv_indev_drv_init(&indev_drv1);         
-    indev_drv1.type = LV_INDEV_TYPE_ENCODER; 
-    indev_drv1.read_cb = lv_indev_encB_read_cb;      
-
-    //Register the driver in LVGL and save the created input device object
-    lv_indev_t * my_indev1 = lv_indev_drv_register(&indev_drv1);
-    lv_group_t * encB_group = lv_group_create();
-    lv_group_add_obj(encB_group, arc1);
-    lv_indev_set_group(my_indev1, encB_group);
-    lv_group_focus_obj(arc1);
-    lv_group_set_editing(encB_group, true);
-
-    //------------- Scrolling text animation ---------------//
-    lv_anim_t anim;
-    lv_anim_init(&anim);
-    lv_anim_set_var(&anim, label);
-    lv_anim_set_values(&anim, lv_obj_get_width(obj) + 160, -lv_obj_get_width(label) - 20);
-    lv_anim_set_time(&anim, ANIM_PERIOD_MS);
-    lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_set_exec_cb(&anim, set_x);
-    lv_anim_start(&anim);
+static void displayBacklight(int pct, uint32_t fade_ms) {
+    disp_backlight_fade(bl, pct, fade_ms);
 }
 
+static void displayPanelSleep(bool sleep) {
+    if (sleep) {
+        ili9341_sleep_in();     // Waits out the last flush
+    }
+    else {
+        ili9341_sleep_out();
+        esp_rom_delay_us(DISPLAY_SLPOUT_US);
+    }
+}
+
+static const app_disp_power_io_t dispPowerIo = {
+    .backlight = displayBacklight,
+    .panel_sleep = displayPanelSleep,
+};
+
 /*---------------------------------------------------------------
-    LCD LVGL FreeRTOS tick timer callback
+    LCD LVGL refresh monitor: frame timing and invalidated pixels
 ---------------------------------------------------------------*/
-static void tickInc(void *arg) {
-    (void)arg;
-    lv_tick_inc(LV_TICK_PERIOD_MS);
+static void displayMonitor(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+    app_disp_pipe_monitor_cb(disp_drv, time_ms, px);
+    app_ui_model_monitor_cb(disp_drv, time_ms, px);
 }
 
 /*---------------------------------------------------------------
@@ -634,34 +563,18 @@ static void displayTask(void *pvParameter) {
     static const char *DISPLAY_TASK_TAG = "DISPLAY";
 
     (void)pvParameter;
-    xGuiSemaphore = xSemaphoreCreateMutex();
-
-    lv_init();
-
-    const esp_timer_create_args_t periodic_timer_args = {
-        .callback = &tickInc,
-        .name = "lvgl_tick_inc",
-    };
 
-    esp_timer_handle_t periodic_timer;
-    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &periodic_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(periodic_timer, LV_TICK_PERIOD_MS * 1000));
-
-    size_t display_buffer_size = DISP_BUF_SIZE;
-    lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(display_buffer_size * sizeof(lv_color_t), MALLOC_CAP_DMA);
-    assert(buf1 != NULL);
+    lv_init();    // Tick comes from esp_timer_get_time() (LV_TICK_CUSTOM), no periodic tick interrupt
 
     static lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, buf1, NULL, display_buffer_size);
-
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
-    disp_drv.draw_buf = &draw_buf;
-    disp_drv.flush_cb = disp_driver_flush;
+    ESP_ERROR_CHECK(app_disp_pipe_init(&disp_drv, &draw_buf));     // Two DMA strip buffers, render overlaps flush
     disp_drv.hor_res = 240;
     disp_drv.ver_res = 320;
     disp_drv.rotated = LV_DISP_ROT_270;
-    lv_disp_drv_register(&disp_drv);
+    disp_drv.monitor_cb = displayMonitor;
+    lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
 
     lvgl_driver_init();
     disp_driver_init();
@@ -677,167 +590,283 @@ static void displayTask(void *pvParameter) {
     };
 
     bl = disp_backlight_new(&disp_bl_cfg);
-    disp_backlight_set(bl, 85);
+    app_disp_power_init(&dispPowerIo, 85, esp_timer_get_time());  // Pot D's setting takes over on the first UI sync
+
+    app_display_init(&uiIo);
+    ESP_ERROR_CHECK(app_disp_pipe_start(disp));    // Picks the strip height by timing redraws of the screen just built
+#if APP_RENDER_PROF_ENABLE
+    ESP_ERROR_CHECK(app_render_prof_init(disp, CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ));  // After the sweep, so it only sees real frames
+    app_render_prof_attach(lv_scr_act());
+#endif
+
+#if DISPLAY_PACED
+    // Encoders are read when the input task says they moved, not polled by LVGL every LV_INDEV_DEF_READ_PERIOD
+    for (lv_indev_t * indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+        lv_timer_pause(indev->driver->read_timer);
+    }
+#endif
 
-    app_display_init();
+    uint32_t sleep_ms = 0;
+    uint64_t window_busy_us = 0;
+    uint32_t window_wakeups = 0;
+    displayStats.window_start_us = esp_timer_get_time();
 
     // LVGL TASK LOOP
     while (1) {
+        uint32_t wake = 0;
+#if DISPLAY_PACED
+        // Sleep until LVGL's next timer is due, or until an input or a displayed value changes. Panel asleep: until an input
+        TickType_t ticks = app_disp_power_rendering() ? (sleep_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS : portMAX_DELAY;
+        xTaskNotifyWait(0, UINT32_MAX, &wake, ticks);
+#else
         /* Delay 1 tick (assumes FreeRTOS tick is 10ms */
         vTaskDelay(1);
-        //pdTICKS_TO_MS
-        /*vTaskDelay(pdMS_TO_TICKS(10));*/
-        lv_event_send(vbatLabel, LV_EVENT_VALUE_CHANGED, NULL);
-        disp_backlight_set(bl, SCALE_VPOT_INVERT(vpotd_filt));
-        lv_event_send(arc2, LV_EVENT_VALUE_CHANGED, NULL);
-        lv_event_send(arc3, LV_EVENT_VALUE_CHANGED, NULL);
-        lv_obj_set_style_bg_color(arc0, lv_color_hex(knobColors[encA.state.sw_status]), LV_PART_KNOB);
-        lv_obj_set_style_bg_color(arc1, lv_color_hex(knobColors[encB.state.sw_status]), LV_PART_KNOB);
-
-        
-        if (encA.state.sw_status && encB.state.sw_status) {
-        //if (encA.state.sw_status && stateB.sw_status) { // Swap the displayed image on concurrent encoder switch presses
-            lv_obj_add_flag(app_images[activeImage], LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(app_images[!activeImage], LV_OBJ_FLAG_HIDDEN);
-            activeImage = !activeImage;
+        xTaskNotifyWait(0, UINT32_MAX, &wake, 0);
+#endif
+        int64_t awake_us = esp_timer_get_time();
+        displayStats.wakeups++;
+        displayStats.wake_input += (wake & DISPLAY_WAKE_INPUT) ? 1 : 0;
+        displayStats.wake_model += (wake & DISPLAY_WAKE_MODEL) ? 1 : 0;
+
+        // Inputs keep the display on and wake it (panel and backlight) before this pass renders
+        if (wake & DISPLAY_WAKE_INPUT) {
+            app_disp_power_activity(awake_us);
         }
+        uint32_t power_ms = app_disp_power_poll(awake_us);
 
-        /* Try to take the semaphore, call lvgl related function on success */
-        if (pdTRUE == xSemaphoreTake(xGuiSemaphore, portMAX_DELAY)) {
-            lv_task_handler();
-            xSemaphoreGive(xGuiSemaphore);
+        // What the other tasks posted since the last pass, one update per target. Asleep too, so the queue never backs up
+        app_ui_cmd_drain(uiApply);
+
+        /* This task is LVGL's only caller, nothing to lock. Nothing while the panel sleeps */
+        if (app_disp_power_rendering()) {
+#if DISPLAY_PACED
+            if (wake & DISPLAY_WAKE_INPUT) {
+                for (lv_indev_t * indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev)) {
+                    lv_indev_read_timer_cb(indev->driver->read_timer);
+                }
+            }
+#endif
+            app_ui_model_sync();    // Only widgets whose bound value changed are touched
+            sleep_ms = lv_timer_handler();  // Time until the next LVGL timer, LV_NO_TIMER_READY if none
+        }
+        sleep_ms = LV_MIN(sleep_ms, DISPLAY_MAX_SLEEP_MS);
+        sleep_ms = LV_MIN(sleep_ms, power_ms);
+
+        int64_t now_us = esp_timer_get_time();
+        window_busy_us += now_us - awake_us;
+        window_wakeups++;
+        if (now_us - displayStats.window_start_us >= 1000000) {
+            displayStats.busy_us += window_busy_us;
+            displayStats.busy_permille = (uint32_t)(window_busy_us * 1000 / (now_us - displayStats.window_start_us));
+            displayStats.wakeups_per_s = (uint32_t)((uint64_t)window_wakeups * 1000000 / (now_us - displayStats.window_start_us));
+            displayStats.window_start_us = now_us;
+            window_busy_us = 0;
+            window_wakeups = 0;
         }
     }
 
     /* A task should NEVER return */
-    free(buf1);
     vTaskDelete(NULL);
 }
 
-// should definitely refactor these and pass parameters to the callback function on task creation
-static void gptimerB_callback(void) {
-    timerAFlag = true;
-}
+/*---------------------------------------------------------------
+    Act on a completed gesture (key combo)
+---------------------------------------------------------------*/
+static void inputGesture(const char * TAG, int gesture) {
+
+    static const bool VERBOSE = false;
 
-static void gptimerA_callback(void) {
-    timerBFlag = true;
+    if (gesture == APP_GESTURE_NONE) {
+        return;
+    }
+    if (VERBOSE) ESP_LOGI(TAG, "GOT COMBO! '%s'", app_gesture_name(&gestureMatcher, gesture));
+
+    switch (gesture) {
+        case GESTURE_TOGGLE_ON_OFF:
+            toggle_on_off_flag = true;
+            break;
+        case GESTURE_CHANGE_CHANNEL:
+            change_channel_flag = true;
+            break;
+        case GESTURE_SWAP_IMAGE:
+            uiImage = !uiImage;     // Posted with the encoder state, see inputPostUi
+            break;
+        default:
+            break;
+    }
 }
 
 /*---------------------------------------------------------------
-    Rotary Encoder task
-    Generic, pass params for particular behavior
+    Encoder switch press result handler (taps, long presses).
+    Taps and long presses are fed to the gesture matcher.
 ---------------------------------------------------------------*/
-static void encTask(void * pvParameters) {
-    
+static void encPressResult(const char * TAG, const app_press_result_t * result) {
+
     static const bool VERBOSE = false;
-    const int timer_flag_thresh = 32;
 
-    encParams_t * params = (encParams_t *) pvParameters;
-    char * TAG = params->TAG;
-    rotary_encoder_info_t * encoder = params->encoder;
-    rotary_encoder_event_t * event = params->event;
-    rotary_encoder_state_t * state = params->state;
-    gptimer_handle_t * timer_handle = params->timer_handle;
-    void (*timer_cb)(int) = params->timer_cb;
-    uint32_t timer_top = params->timer_top;
-    volatile bool * timerFlag = params->timerFlag;
-    gpio_num_t pinA = params->pinA;
-    gpio_num_t pinB = params->pinB;
-    gpio_num_t pinSW = params->pinSW;
-    circularBuffer * circBuff = params->comboBuff;
-    int id = params->id;
-    int * pos = params->pos;
-    int delay_ms = params->delay_ms;
-    QueueHandle_t queue = params->queue;
+    switch (result->kind) {
+        case APP_PRESS_CLICK:
+            if (VERBOSE) ESP_LOGI(TAG, "%d CLICK(S), last held %lu us", result->clicks, result->duration_us);
+            inputGesture(TAG, app_gesture_feed_press(&gestureMatcher, result->id, result->clicks, false, result->timestamp_us));
+            break;
+        case APP_PRESS_LONG:
+            if (VERBOSE) ESP_LOGI(TAG, "LONG PRESS DETECTED");
+            inputGesture(TAG, app_gesture_feed_press(&gestureMatcher, result->id, 0, true, result->timestamp_us));
+            break;
+        case APP_PRESS_LONG_RELEASE:
+            if (VERBOSE) ESP_LOGI(TAG, "LONG PRESS RELEASED after %lu us", result->duration_us);
+            break;
+        default:
+            break;
+    }
+}
 
-    bool change_flag = true;
-    bool sw_level = LOW;
-    int push_count = 0;
+/*---------------------------------------------------------------
+    Post what the input task changed to the UI: positions, switch
+    states and the image to show. True if the full queue refused
+    any of it: the input task retries after INPUT_UI_RETRY_MS
+---------------------------------------------------------------*/
+static bool inputPostUi(const encParams_t * params) {
 
-    uint32_t timer_count = 0;
+    static int32_t postedPos[NUM_ENCODERS] = {INT32_MIN, INT32_MIN};
+    static int32_t postedSw[NUM_ENCODERS] = {INT32_MIN, INT32_MIN};
+    static int32_t postedImage = 1;
 
-    esp_err_t ret = ESP_OK;
+    bool pending = false;
 
-    gptimer_state_t timer_state = {
-        .timerHandle = timer_handle,
-        .running = false
-    };
+    for (int i = 0; i < NUM_ENCODERS; i++) {
+        int32_t sw = params[i].encoder->state.sw_status;
+        uiPost(APP_UI_CMD_SET_VALUE, UI_VALUE_ENC_A + i, *params[i].pos, &postedPos[i]);
+        uiPost(APP_UI_CMD_SET_STATE, UI_STATE_SW_A + i, sw, &postedSw[i]);
+        pending |= (postedPos[i] != *params[i].pos) || (postedSw[i] != sw);
+    }
+    uiPost(APP_UI_CMD_SHOW_SCREEN, 0, uiImage, &postedImage);
+    return pending || (postedImage != uiImage);
+}
+
+/*---------------------------------------------------------------
+    Input FreeRTOS task. Services both rotary encoders, both
+    switches and the press deadlines from one queue set: decoding,
+    press classification, gesture matching and publishing the
+    positions all happen here. Blocks indefinitely when idle.
+---------------------------------------------------------------*/
+static void inputTask(void * pvParameters) {
 
-    ret = app_initTimer(timer_handle, timer_cb, timer_top, false);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Couldn't initialize timer!");
+    static const char * INPUT_TAG = "INPUT";
+    static const bool VERBOSE = false;
+
+    encParams_t * params = (encParams_t *) pvParameters;
+    rotary_encoder_event_t event;
+    app_press_result_t result;
+
+    ESP_ERROR_CHECK(app_gesture_compile(&gestureMatcher, gestureTable, sizeof(gestureTable) / sizeof(gestureTable[0])));
+
+    // One event queue for both encoders plus one deadline semaphore per switch.
+    // Members must be empty when added, so the set is built before any ISR is enabled.
+    xInputQueue = rotary_encoder_create_queue();
+    QueueSetHandle_t waitSet = xQueueCreateSet(ROTARY_ENCODER_EVENT_QUEUE_LENGTH + NUM_ENCODERS);
+    xQueueAddToSet(xInputQueue, waitSet);
+
+    for (int i = 0; i < NUM_ENCODERS; i++) {
+        app_press_tracker_init(params[i].press, params[i].id);
+        ESP_ERROR_CHECK(app_press_register(params[i].press));
+        xQueueAddToSet(params[i].press->wake, waitSet);
+        encoder_init(params[i].encoder, params[i].pinA, params[i].pinB, params[i].pinSW, false, true);
+        ESP_ERROR_CHECK(rotary_encoder_set_queue(params[i].encoder, xInputQueue));
     }
 
-    encoder_init(encoder, pinA, pinB, pinSW, false, true);
+    bool uiPending = false;     // A UI post the full queue refused, retried without waiting for more input
 
-    // Create a queue for events from the rotary encoder driver.
-    // Tasks can read from this queue to receive up to date position information.
-    queue = rotary_encoder_create_queue();
-    ESP_ERROR_CHECK(rotary_encoder_set_queue(encoder, queue));
+    while (1) {
 
-    while(1) {
+        QueueSetMemberHandle_t ready = xQueueSelectFromSet(waitSet, uiPending ? pdMS_TO_TICKS(INPUT_UI_RETRY_MS) : portMAX_DELAY);
+        inputStats.wakeups++;
 
-        // Wait for incoming events on the event queue.
-        if (xQueueReceive(queue, event, pdMS_TO_TICKS(delay_ms))) {
-            *pos = (int)event->state.position;
+        // Retry timeout: the display has had a frame to drain the queue
+        if (ready == NULL) {
+            uiPending = inputPostUi(params);
+            displayWake(DISPLAY_WAKE_MODEL);    // Not input: a retry must not keep the display awake
+            continue;
         }
-        // update gpio state
-        rotary_encoder_poll_switch(encoder);
-        change_flag = (sw_level == (encoder->state.sw_status)) ? false : true;
-        switch(change_flag) {
-            // Button is actuated
-            case(true): 
-                if (VERBOSE) ESP_LOGI(TAG, "CHANGE FLAG REGISTERED");
-                change_flag = false;
-                timer_count = 0;                                   // Reset the timer counts
-                sw_level = encoder->state.sw_status;               // Assign new level to temp var
-                app_toggleTimerRun(timer_handle, &timer_state);    // Start encoder switch timer
-                if (push_count % 2 == 0 || push_count == 0) {      // Register every other edge
-                    push_key(circBuff, id);                        // Push recent press to circular buffer
-                    if (VERBOSE) ESP_LOGI(TAG, "PUSHED KEY: %d", id);
-                    // Debug print the circular buffer entries
-                    int start = circBuff->head;
-                    //ESP_LOGI(TAG, "BUFF ENTRIES:");
-                    for (int i = 0; i < KEYPRESS_COMBO_LENGTH; i++) {
-                        //ESP_LOGI(TAG, "Buffer Entry %d: %d", start, circBuff->buffer[start]);
-                        start = (start + 1) % KEYPRESS_COMBO_LENGTH;
+
+        // Incoming events on the event queue. Switch edges arrive here already debounced by the driver.
+        if (ready == xInputQueue) {
+            if (!xQueueReceive(xInputQueue, &event, 0)) {
+                continue;
+            }
+            encParams_t * enc = NULL;
+            for (int i = 0; i < NUM_ENCODERS; i++) {
+                if (event.source == params[i].encoder) {
+                    enc = &params[i];
+                }
+            }
+            if (enc == NULL) {
+                continue;
+            }
+
+            switch (event.type) {
+                case ROTARY_ENCODER_EVENT_STEP: {
+                    *enc->pos = (int)event.state.position;
+                    uint32_t latency_us = (uint32_t)(esp_timer_get_time() - event.timestamp_us);
+                    inputStats.steps++;
+                    inputStats.latency_total_us += latency_us;
+                    if (latency_us > inputStats.latency_max_us) {
+                        inputStats.latency_max_us = latency_us;
                     }
+                    break;
                 }
-                push_count++;
-                break;
-            // Button is not actuated
-            default:
-                if (timer_count >= timer_flag_thresh) {
-                    if (VERBOSE) ESP_LOGI(TAG, "LONG PRESS DETECTED");
-                    timer_count = 0;
+                // Button is actuated or released, durations come from the edge timestamps
+                case ROTARY_ENCODER_EVENT_SW_PRESS:
+                case ROTARY_ENCODER_EVENT_SW_RELEASE: {
+                    bool pressed = (event.type == ROTARY_ENCODER_EVENT_SW_PRESS);
+                    if (VERBOSE) ESP_LOGI(enc->TAG, "%s @ %lld us", gpio_status_names[event.state.sw_status], event.timestamp_us);
+                    inputGesture(enc->TAG, app_gesture_feed_switch(&gestureMatcher, enc->id, pressed, event.timestamp_us));  // Chords come from the raw edges
+                    if (app_press_on_edge(enc->press, pressed, event.timestamp_us, &result)) {
+                        encPressResult(enc->TAG, &result);
+                    }
+                    break;
                 }
-                break;
+                default:
+                    break;
+            }
+            app_disp_pipe_mark_input(event.timestamp_us);   // Input to photon latency starts at the ISR edge
+            uiPending = inputPostUi(params);
+            displayWake(DISPLAY_WAKE_INPUT);
         }
 
-        int target[] = {1, 1, 2};
-        int target2[] = {1, 2, 2};
-        
-        if(check_combo(circBuff, target)) {
-            if (VERBOSE) ESP_LOGI(TAG, "GOT COMBO! '%s'", "on off"/*keypress_combo_names[7]*/);
-            toggle_on_off_flag = true;
-            clear_buffer(circBuff);
-        }
-        else if(check_combo(circBuff, target2)) {
-            if (VERBOSE) ESP_LOGI(TAG, "GOT COMBO! '%s'", "change chan"/*keypress_combo_names[7]*/);
-            change_channel_flag = true;
-            clear_buffer(circBuff);         // This is mutexed, circbuff entries are cleared to 0, so dont use 0 for a key
-        }
-        
-        if (VERBOSE) ESP_LOGI(TAG, "SW POLL - %s", gpio_status_names[encoder->state.sw_status]);
-        
-        if (*timerFlag) {
-            timer_count+=1; // Increment count pre-emptively, as the timer is enabled and we wait for the flag to be initially set indicating a timer clock increment has passed
-            if (VERBOSE) ESP_LOGI(TAG, "TIMER TRIG: %lu", timer_count);
-            *timerFlag = false; // poll the switch and reset flags as necessary
+        // Press deadline passed (long press threshold or end of a multi-click window)
+        else {
+            for (int i = 0; i < NUM_ENCODERS; i++) {
+                if (ready == params[i].press->wake) {
+                    xSemaphoreTake(params[i].press->wake, 0);
+                    if (app_press_on_deadline(params[i].press, esp_timer_get_time(), &result)) {
+                        encPressResult(params[i].TAG, &result);
+                        uiPending = inputPostUi(params);
+                        displayWake(DISPLAY_WAKE_INPUT);
+                    }
+                }
+            }
         }
     }
 }
 
+/*---------------------------------------------------------------
+    Display task profile dump
+---------------------------------------------------------------*/
+static void displayLogStats(const char * TAG) {
+    ESP_LOGI(TAG, "Display task: %lu wakeups/s (%lu total, %lu input, %lu model), busy %lu.%lu%% of a core, %llu us awake total%s",
+             displayStats.wakeups_per_s, displayStats.wakeups, displayStats.wake_input, displayStats.wake_model,
+             displayStats.busy_permille / 10, displayStats.busy_permille % 10, displayStats.busy_us, DISPLAY_PACED ? "" : " (tick polled)");
+}
+
+/*---------------------------------------------------------------
+    Input task profile dump
+---------------------------------------------------------------*/
+static void inputLogStats(const char * TAG) {
+    ESP_LOGI(TAG, "Input task: %lu wakeups, %lu steps, ISR->pos latency mean %lu us max %lu us", inputStats.wakeups, inputStats.steps,
+             inputStats.steps ? (uint32_t)(inputStats.latency_total_us / inputStats.steps) : 0, inputStats.latency_max_us);
+}
+
 /*============================================ APP_MAIN ============================================*/
 
 /*---------------------------------------------------------------
@@ -854,54 +883,36 @@ void app_main(void) {
     esp_err_t ret = ESP_OK;
     
     static battery_states_t temp_battery_state;
+    static int32_t postedBatteryState = INT32_MIN;
 
     // Init UART2 for development port (to be replaced with/accompanied by BT)
     uart2_init(U2_BAUD);
     app_gpio_init();
 
-    circularBuffer keyPress_combo_buff = {0};
-    init_buffer(&keyPress_combo_buff);
-
-    gptimer_handle_t gptimerA = NULL;
-    gptimer_handle_t gptimerB = NULL;
-
-    encParams_t encAParams = {
-        .TAG = "ENC_A",
-        .encoder = &encA,
-        .event = &eventA,
-        .state = &stateA,
-        .timer_handle = &gptimerA,
-        .timer_cb = &gptimerA_callback,
-        .timer_top = 1, // Timer compare match will reset this when reached. Use to count a number of elapsed timer cycles, and signify button press durations, or a count of presses within a duration
-        .timerFlag = &timerAFlag,
-        .pinA = ENCA_CHA_PIN,
-        .pinB = ENCA_CHB_PIN,
-        .pinSW = ENCA_SW_PIN,
-        .comboBuff = &keyPress_combo_buff,
-        .id = 1, // Using nonzero id's is essential as the circular buffer resets to zero
-        .delay_ms = ENC_QUEUE_DELAY,
-        .pos = &posA,
-        .queue = xEncoderAQueue
-    };
-
-    // Create an instance of encParams_t for encoder B
-    encParams_t encBParams = {
-        .TAG = "ENC_B",
-        .encoder = &encB,
-        .event = &eventB,
-        .state = &stateB,
-        .timer_handle = &gptimerB,
-        .timer_cb = &gptimerB_callback,
-        .timer_top = 1, // 1uS software timer, 1000 ticks per 1mS
-        .timerFlag = &timerBFlag,
-        .pinA = ENCB_CHA_PIN,
-        .pinB = ENCB_CHB_PIN,
-        .pinSW = ENCB_SW_PIN,
-        .comboBuff = &keyPress_combo_buff,
-        .id = 2,                    // used for filling the button keypress combo circ buff
-        .pos = &posB,
-        .delay_ms = ENC_QUEUE_DELAY,
-        .queue = xEncoderBQueue
+    ESP_ERROR_CHECK(app_timer_init());     // Software timers (press deadlines) on one gptimer
+    app_ui_cmd_init();                      // Before any task posts
+
+    encParams_t encParams[NUM_ENCODERS] = {
+        {
+            .TAG = "ENC_A",
+            .encoder = &encA,
+            .press = &pressA,   // Press durations are measured from edge timestamps, no hardware timer needed
+            .pinA = ENCA_CHA_PIN,
+            .pinB = ENCA_CHB_PIN,
+            .pinSW = ENCA_SW_PIN,
+            .id = APP_GESTURE_KEY_A,
+            .pos = &posA,
+        },
+        {
+            .TAG = "ENC_B",
+            .encoder = &encB,
+            .press = &pressB,
+            .pinA = ENCB_CHA_PIN,
+            .pinB = ENCB_CHB_PIN,
+            .pinSW = ENCB_SW_PIN,
+            .id = APP_GESTURE_KEY_B,
+            .pos = &posB,
+        },
     };
 
     adc_oneshot_unit_handle_t adc1_handle = NULL;
@@ -923,6 +934,7 @@ void app_main(void) {
         .vraw = &vbat_raw,
         .vcal = &vbat_cali,
         .vfilt = &vbat_filt,
+        .on_sample = vbatSample,
     };
 
     adcOneshotParams_t vpotcParams = {
@@ -937,6 +949,7 @@ void app_main(void) {
         .vraw = &vpotc_raw,
         .vcal = &vpotc_cali,
         .vfilt = &vpotc_filt,
+        .on_sample = vpotcSample,
     };
 
     adcOneshotParams_t vpotdParams = {
@@ -951,6 +964,7 @@ void app_main(void) {
         .vraw = &vpotd_raw,
         .vcal = &vpotd_cali,
         .vfilt = &vpotd_filt,
+        .on_sample = vpotdSample,
     };
 
     // Create FreeRTOS tasks to handle various peripherals/functions
@@ -959,11 +973,16 @@ void app_main(void) {
     xTaskCreate(adcTask, "vpotd_task", 1024*2, (void *)&vpotdParams, configMAX_PRIORITIES - 2,  NULL);
     xTaskCreate(adcTask, "vpotc_task", 1024*2, (void *)&vpotcParams, configMAX_PRIORITIES - 2,  NULL);
     xTaskCreate(adcTask, "vbat_task", 1024*2, (void *)&vbatParams, configMAX_PRIORITIES - 2,  NULL);
-    xTaskCreate(displayTask, "display_task", 4096 * 2, NULL, configMAX_PRIORITIES, NULL);
-
+#if APP_RENDER_PROF_ENABLE
+    // Cycle counters are per core, keep a frame's timestamps on one
+    xTaskCreatePinnedToCore(displayTask, "display_task", 4096 * 2, NULL, configMAX_PRIORITIES, &displayTaskHandle, 1);
+#else
+    xTaskCreate(displayTask, "display_task", 4096 * 2, NULL, configMAX_PRIORITIES, &displayTaskHandle);
+#endif
+
+    // One task for both encoders, switches and press deadlines. Replaces two 8 KB encoder tasks.
     // Play with half step resolution to register direction change immediately
-    xTaskCreate(encTask, "encA", 2048*4, (void *)&encAParams, configMAX_PRIORITIES - 1, NULL);
-    xTaskCreate(encTask, "encB", 2048*4, (void *)&encBParams, configMAX_PRIORITIES - 1, NULL);
+    xTaskCreate(inputTask, "input_task", 1024*3, (void *)encParams, configMAX_PRIORITIES - 1, NULL);
 
     //temp_battery_state = BAT_LOW;
 
@@ -971,6 +990,9 @@ void app_main(void) {
     while(1) {
 
         vbat_assign_state(&batteryState, SCALE_VBAT(vbat_filt));
+        if (uiPost(APP_UI_CMD_SET_STATE, UI_STATE_BATTERY, batteryState, &postedBatteryState)) {
+            displayWake(DISPLAY_WAKE_MODEL);
+        }
         if (temp_battery_state != batteryState) {
             temp_battery_state = batteryState;
             if (temp_battery_state == BAT_LOW) {
@@ -984,6 +1006,20 @@ void app_main(void) {
         if (VERBOSE) {
             ESP_LOGI(TAG, "Battery State   : %s", batteryStateNames[batteryState]);
             ESP_LOGI(TAG, "Heartbeat State : %s", gpio_status_names[pin]);
+            encoder_log_isr_stats("ENC_A", &encA);
+            encoder_log_isr_stats("ENC_B", &encB);
+            inputLogStats(TAG);
+            displayLogStats(TAG);
+            app_ui_model_log_stats(TAG);
+            app_ui_cmd_log_stats(TAG);
+            app_disp_pipe_log_stats(TAG);
+            app_glyph_cache_log_stats(TAG);
+            app_num_label_log_stats(TAG);
+            app_banner_log_stats(TAG);
+            app_disp_power_log_stats(TAG, esp_timer_get_time());
+#if APP_RENDER_PROF_ENABLE
+            app_render_prof_log_stats(TAG);
+#endif
         }
 
         gpio_set_level(HEARTBEAT_LED_PIN, pin);
@@ -0,0 +1,108 @@
+/*
+ * @file app_num_label.c
+ * @brief Numeric labels on static text buffers, see app_num_label.h.
+ *
+ */
+
+#include <string.h>
+#include "app_include/app_num_label.h"
+
+#define TEXT_MAX    64          // Formatting scratch: prefix, number and suffix before they are checked to fit
+#define DIGITS_MAX  12          // A 32 bit magnitude's 10 digits, the point and the sign
+
+// Up to 9 decimals the zeros padding to the point never outnumber a 32 bit magnitude's digits
+_Static_assert(APP_NUM_LABEL_MAX_DECIMALS <= 9, "append_number() digits buffer");
+
+static app_num_label_stats_t stats;
+
+// Append src at *len, as much as fits
+static void append(char * buf, uint32_t * len, const char * src) {
+    while (src != NULL && *src && *len < TEXT_MAX - 1) {
+        buf[(*len)++] = *src++;
+    }
+    buf[*len] = '\0';
+}
+
+/*---------------------------------------------------------------
+    value / 10^decimals, decimals places shown: 370, 2 -> "3.70".
+    decimals is clamped to APP_NUM_LABEL_MAX_DECIMALS
+---------------------------------------------------------------*/
+static void append_number(char * buf, uint32_t * len, int32_t value, uint8_t decimals) {
+
+    char digits[DIGITS_MAX];
+    uint32_t n = 0;
+    uint32_t mag = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+
+    if (decimals > APP_NUM_LABEL_MAX_DECIMALS) {
+        decimals = APP_NUM_LABEL_MAX_DECIMALS;
+    }
+
+    // Least significant first, at least one digit left of the point
+    do {
+        if (decimals && n == decimals) {
+            digits[n++] = '.';
+        }
+        digits[n++] = '0' + mag % 10;
+        mag /= 10;
+    } while (mag || n <= decimals);
+    if (value < 0) {
+        digits[n++] = '-';
+    }
+    while (n && *len < TEXT_MAX - 1) {
+        buf[(*len)++] = digits[--n];
+    }
+    buf[*len] = '\0';
+}
+
+void app_num_label_init(app_num_label_t * nl, lv_obj_t * label) {
+    nl->label = label;
+    nl->text[0] = '\0';
+    lv_label_set_text_static(label, nl->text);
+}
+
+/*---------------------------------------------------------------
+    Format and show, if the text changed
+---------------------------------------------------------------*/
+void app_num_label_set(app_num_label_t * nl, const char * prefix, int32_t value, uint8_t decimals, const char * suffix) {
+
+    char text[TEXT_MAX];
+    uint32_t len = 0;
+
+    stats.updates++;
+    text[0] = '\0';
+    if (prefix != NULL && *prefix) {
+        append(text, &len, prefix);
+        append(text, &len, " ");
+    }
+    append_number(text, &len, value, decimals);
+    append(text, &len, suffix);
+
+    if (strcmp(text, nl->text) == 0) {
+        stats.unchanged++;
+        return;
+    }
+    stats.invalidations++;
+    if (len < APP_NUM_LABEL_CAP) {
+        memcpy(nl->text, text, len + 1);
+        lv_label_set_text_static(nl->label, nl->text);
+    }
+    else {
+        nl->text[0] = '\0';     // Shows something else now, compare against nothing
+        stats.allocations++;
+        lv_label_set_text(nl->label, text);
+    }
+}
+
+void app_num_label_get_stats(app_num_label_stats_t * out) {
+    *out = stats;
+}
+
+void app_num_label_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void app_num_label_log_stats(const char * TAG) {
+    ESP_LOGI(TAG, "Number labels: %lu updates, %lu unchanged, %lu invalidations, %lu allocations",
+             (unsigned long)stats.updates, (unsigned long)stats.unchanged, (unsigned long)stats.invalidations,
+             (unsigned long)stats.allocations);
+}
@@ -0,0 +1,137 @@
+/*
+ * @file app_press.c
+ * @brief Press duration, long-press and multi-click classification from edge timestamps.
+ *
+ */
+
+#include "app_include/app_press.h"
+
+static const char * PRESS_TAG = "PRESS";
+
+/*---------------------------------------------------------------
+    Deadlines are only touched by the owning task; the timer just
+    wakes it, app_press_on_deadline() re-checks the deadline.
+---------------------------------------------------------------*/
+static void set_deadline(app_press_tracker_t * tracker, int64_t deadline_us) {
+    tracker->deadline_us = deadline_us;
+    if (deadline_us) {
+        app_timer_arm_at(&tracker->deadline_timer, deadline_us);
+    }
+    else {
+        app_timer_cancel(&tracker->deadline_timer);
+    }
+}
+
+/*---------------------------------------------------------------
+    Press tracker init
+---------------------------------------------------------------*/
+void app_press_tracker_init(app_press_tracker_t * tracker, int id) {
+    memset(tracker, 0, sizeof(app_press_tracker_t));
+    tracker->id = id;
+}
+
+/*---------------------------------------------------------------
+    Debounced switch edge. Returns true if a result was produced.
+---------------------------------------------------------------*/
+bool app_press_on_edge(app_press_tracker_t * tracker, bool pressed, int64_t timestamp_us, app_press_result_t * result) {
+
+    bool ret = false;
+
+    if (pressed == tracker->pressed) {
+        return false;   // Not an edge, nothing to do
+    }
+    tracker->pressed = pressed;
+
+    if (pressed) {
+        tracker->press_us = timestamp_us;
+        tracker->long_fired = false;
+        set_deadline(tracker, timestamp_us + APP_PRESS_LONG_US);
+    }
+    else {
+        uint32_t duration_us = (uint32_t)(timestamp_us - tracker->press_us);
+        tracker->release_us = timestamp_us;
+        set_deadline(tracker, 0);
+
+        result->id = tracker->id;
+        result->duration_us = duration_us;
+        result->timestamp_us = timestamp_us;
+
+        if (tracker->long_fired || duration_us >= APP_PRESS_LONG_US) {
+            // Long press ends any click sequence in progress
+            result->kind = APP_PRESS_LONG_RELEASE;
+            result->clicks = 0;
+            tracker->clicks = 0;
+            ret = true;
+        }
+        else if (++tracker->clicks >= APP_PRESS_MAX_CLICKS) {
+            // No higher count to wait for, report now instead of at the end of the window
+            result->kind = APP_PRESS_CLICK;
+            result->clicks = tracker->clicks;
+            tracker->clicks = 0;
+            ret = true;
+        }
+        else {
+            set_deadline(tracker, timestamp_us + APP_PRESS_MULTICLICK_US);
+        }
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------
+    Deadline expiry. Returns true if a result was produced.
+---------------------------------------------------------------*/
+bool app_press_on_deadline(app_press_tracker_t * tracker, int64_t now_us, app_press_result_t * result) {
+
+    bool ret = false;
+
+    if (tracker->deadline_us == 0 || now_us < tracker->deadline_us) {
+        return false;   // Spurious or early wakeup
+    }
+    set_deadline(tracker, 0);
+
+    result->id = tracker->id;
+    result->timestamp_us = now_us;
+
+    if (tracker->pressed && !tracker->long_fired) {
+        tracker->long_fired = true;
+        result->kind = APP_PRESS_LONG;
+        result->clicks = 0;
+        result->duration_us = (uint32_t)(now_us - tracker->press_us);
+        ret = true;
+    }
+    else if (!tracker->pressed && tracker->clicks) {
+        result->kind = APP_PRESS_CLICK;
+        result->clicks = tracker->clicks;
+        result->duration_us = (uint32_t)(tracker->release_us - tracker->press_us);
+        tracker->clicks = 0;
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------
+    Deadline timer expiry (timer task)
+---------------------------------------------------------------*/
+static void deadline_timer_cb(void * arg) {
+    app_press_tracker_t * tracker = (app_press_tracker_t *)arg;
+    xSemaphoreGive(tracker->wake);
+}
+
+/*---------------------------------------------------------------
+    Create the tracker's wake semaphore, so the owner can add it
+    to a queue set, and its deadline timer. app_timer_init() must
+    have been called.
+---------------------------------------------------------------*/
+esp_err_t app_press_register(app_press_tracker_t * tracker) {
+
+    tracker->wake = xSemaphoreCreateBinary();
+    if (tracker->wake == NULL) {
+        ESP_LOGE(PRESS_TAG, "Couldn't create wake semaphore!");
+        return ESP_ERR_NO_MEM;
+    }
+    app_timer_setup(&tracker->deadline_timer, deadline_timer_cb, tracker);
+
+    return ESP_OK;
+}
@@ -0,0 +1,418 @@
+/*
+ * @file app_render_prof.c
+ * @brief Per frame render profiler, see app_render_prof.h.
+ *
+ */
+
+#include <stdio.h>
+#include "app_include/app_render_prof.h"
+#include "src/draw/sw/lv_draw_sw.h"     // Software draw context, not exported by lvgl.h
+
+static portMUX_TYPE prof_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t prof_cycles_per_us = 1;
+
+// Wrapped driver callbacks and draw context functions
+static lv_disp_drv_t * prof_drv = NULL;
+static void (*orig_flush_cb)(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void (*orig_render_start_cb)(lv_disp_drv_t * disp_drv);
+static void (*orig_monitor_cb)(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px);
+static void (*orig_draw_rect)(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
+static void (*orig_draw_bg)(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
+static void (*orig_draw_arc)(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center,
+                             uint16_t radius, uint16_t start_angle, uint16_t end_angle);
+static void (*orig_draw_img_decoded)(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                                     const uint8_t * map_p, lv_img_cf_t color_format);
+static void (*orig_draw_letter)(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                                uint32_t letter);
+static void (*orig_draw_line)(lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc, const lv_point_t * point1,
+                              const lv_point_t * point2);
+static void (*orig_draw_polygon)(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_point_t * points,
+                                 uint16_t point_cnt);
+static void (*orig_blend)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+// Frame being rendered, display task only
+static app_render_prof_frame_t cur;
+static bool in_frame = false;
+static uint32_t frame_start;
+static uint32_t span_start;             // Object draw phase (MAIN or POST) in progress
+static uint32_t prim_depth;             // Primitives call each other (arc -> rect), only the outermost is timed
+static uint32_t prim_start;
+static uint32_t prim_cycles;
+static uint32_t blend_in_prim_cycles;
+
+// Published under prof_mux
+static app_render_prof_frame_t ring[APP_RENDER_PROF_RING];
+static uint32_t ring_count = 0;
+static app_render_prof_obj_t objs[APP_RENDER_PROF_MAX_OBJS];
+static int num_objs = 0;
+
+static const char * const class_names[APP_RENDER_PROF_NUM_CLASSES] = {"obj", "label", "arc", "img", "gauge", "other"};
+
+static app_render_prof_class_t obj_class(const lv_obj_t * obj) {
+    if (obj->class_p == &lv_obj_class) {
+        return APP_RENDER_PROF_OBJ;
+    }
+    if (obj->class_p == &lv_label_class) {
+        return APP_RENDER_PROF_LABEL;
+    }
+    if (obj->class_p == &lv_arc_class) {
+        return APP_RENDER_PROF_ARC;
+    }
+    if (obj->class_p == &lv_img_class) {
+        return APP_RENDER_PROF_IMG;
+    }
+    if (obj->class_p == &app_gauge_class) {
+        return APP_RENDER_PROF_GAUGE;
+    }
+    return APP_RENDER_PROF_OTHER;
+}
+
+/*---------------------------------------------------------------
+    Object draw events. Children are drawn between MAIN_END and
+    POST_BEGIN, so the two phases together are the object's own
+    draw time.
+---------------------------------------------------------------*/
+static void draw_begin_cb(lv_event_t * e) {
+    span_start = esp_cpu_get_cycle_count();
+}
+
+static void draw_end_cb(lv_event_t * e) {
+
+    uint32_t cycles = esp_cpu_get_cycle_count() - span_start;
+    lv_obj_t * obj = lv_event_get_target(e);
+    app_render_prof_obj_t * slot = lv_event_get_user_data(e);
+    app_render_prof_class_t cls = slot ? slot->cls : obj_class(obj);
+    bool main_phase = (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_END);
+
+    if (!in_frame) {
+        return;
+    }
+    cur.class_cycles[cls] += cycles;
+    cur.class_draws[cls] += main_phase ? 1 : 0;
+
+    if (slot != NULL) {
+        portENTER_CRITICAL(&prof_mux);
+        slot->cycles += cycles;
+        slot->draws += main_phase ? 1 : 0;
+        slot->coords = obj->coords;
+        portEXIT_CRITICAL(&prof_mux);
+    }
+}
+
+/*---------------------------------------------------------------
+    Draw context wrappers
+---------------------------------------------------------------*/
+static inline void prim_enter(void) {
+    if (prim_depth++ == 0) {
+        prim_start = esp_cpu_get_cycle_count();
+    }
+}
+
+static inline void prim_exit(void) {
+    if (--prim_depth == 0) {
+        prim_cycles += esp_cpu_get_cycle_count() - prim_start;
+    }
+}
+
+static void prof_draw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords) {
+    prim_enter();
+    orig_draw_rect(draw_ctx, dsc, coords);
+    prim_exit();
+}
+
+static void prof_draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords) {
+    prim_enter();
+    orig_draw_bg(draw_ctx, dsc, coords);
+    prim_exit();
+}
+
+static void prof_draw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center,
+                          uint16_t radius, uint16_t start_angle, uint16_t end_angle) {
+    prim_enter();
+    orig_draw_arc(draw_ctx, dsc, center, radius, start_angle, end_angle);
+    prim_exit();
+}
+
+static void prof_draw_img_decoded(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const lv_area_t * coords,
+                                  const uint8_t * map_p, lv_img_cf_t color_format) {
+    prim_enter();
+    orig_draw_img_decoded(draw_ctx, dsc, coords, map_p, color_format);
+    prim_exit();
+}
+
+static void prof_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                             uint32_t letter) {
+    prim_enter();
+    orig_draw_letter(draw_ctx, dsc, pos_p, letter);
+    prim_exit();
+}
+
+static void prof_draw_line(lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc, const lv_point_t * point1,
+                           const lv_point_t * point2) {
+    prim_enter();
+    orig_draw_line(draw_ctx, dsc, point1, point2);
+    prim_exit();
+}
+
+static void prof_draw_polygon(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_point_t * points,
+                              uint16_t point_cnt) {
+    prim_enter();
+    orig_draw_polygon(draw_ctx, dsc, points, point_cnt);
+    prim_exit();
+}
+
+static void prof_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc) {
+    uint32_t start = esp_cpu_get_cycle_count();
+    orig_blend(draw_ctx, dsc);
+    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    cur.blend_cycles += cycles;
+    blend_in_prim_cycles += prim_depth ? cycles : 0;
+}
+
+/*---------------------------------------------------------------
+    Driver callback wrappers: frame start (after the app's own
+    render start, which may re-plan the areas), flush, frame end
+---------------------------------------------------------------*/
+static void prof_render_start_cb(lv_disp_drv_t * disp_drv) {
+
+    if (orig_render_start_cb != NULL) {
+        orig_render_start_cb(disp_drv);
+    }
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    memset(&cur, 0, sizeof(cur));
+    cur.seq = ring_count;
+    cur.tick_ms = lv_tick_get();
+    for (int i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        const lv_area_t * area = &disp->inv_areas[i];
+        if (cur.areas < APP_RENDER_PROF_MAX_AREAS) {
+            cur.area[cur.areas] = (app_render_prof_area_t){area->x1, area->y1, area->x2, area->y2};
+        }
+        cur.areas++;
+        cur.area_px += lv_area_get_size(area);
+    }
+
+    prim_depth = 0;
+    prim_cycles = 0;
+    blend_in_prim_cycles = 0;
+    in_frame = true;
+    frame_start = esp_cpu_get_cycle_count();
+}
+
+static void prof_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p) {
+    uint32_t start = esp_cpu_get_cycle_count();
+    orig_flush_cb(disp_drv, area, color_p);
+    cur.flush_cycles += esp_cpu_get_cycle_count() - start;
+    cur.flushes++;
+}
+
+static void prof_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+
+    if (in_frame) {
+        cur.total_cycles = esp_cpu_get_cycle_count() - frame_start;
+        cur.shape_cycles = prim_cycles - blend_in_prim_cycles;
+        in_frame = false;
+
+        portENTER_CRITICAL(&prof_mux);
+        ring[ring_count % APP_RENDER_PROF_RING] = cur;
+        ring_count++;
+        portEXIT_CRITICAL(&prof_mux);
+    }
+
+    if (orig_monitor_cb != NULL) {
+        orig_monitor_cb(disp_drv, time_ms, px);
+    }
+}
+
+/*---------------------------------------------------------------
+    Hook the display, after lv_disp_drv_register() and after the
+    app has set its own driver callbacks. cycles_per_us converts
+    esp_cpu_get_cycle_count() for printing (CPU MHz on the device).
+---------------------------------------------------------------*/
+esp_err_t app_render_prof_init(lv_disp_t * disp, uint32_t cycles_per_us) {
+
+    lv_disp_drv_t * drv = disp->driver;
+    lv_draw_sw_ctx_t * sw = (lv_draw_sw_ctx_t *)drv->draw_ctx;
+
+    if (prof_drv != NULL || drv->flush_cb == NULL || drv->draw_ctx_size != sizeof(lv_draw_sw_ctx_t)) {
+        return ESP_ERR_INVALID_STATE;   // Already hooked, or not the software renderer
+    }
+
+    prof_drv = drv;
+    prof_cycles_per_us = cycles_per_us ? cycles_per_us : 1;
+
+    orig_flush_cb = drv->flush_cb;
+    orig_render_start_cb = drv->render_start_cb;
+    orig_monitor_cb = drv->monitor_cb;
+    drv->flush_cb = prof_flush_cb;
+    drv->render_start_cb = prof_render_start_cb;
+    drv->monitor_cb = prof_monitor_cb;
+
+    orig_draw_rect = sw->base_draw.draw_rect;
+    orig_draw_bg = sw->base_draw.draw_bg;
+    orig_draw_arc = sw->base_draw.draw_arc;
+    orig_draw_img_decoded = sw->base_draw.draw_img_decoded;
+    orig_draw_letter = sw->base_draw.draw_letter;
+    orig_draw_line = sw->base_draw.draw_line;
+    orig_draw_polygon = sw->base_draw.draw_polygon;
+    orig_blend = sw->blend;
+    sw->base_draw.draw_rect = prof_draw_rect;
+    sw->base_draw.draw_bg = prof_draw_bg;
+    sw->base_draw.draw_arc = prof_draw_arc;
+    sw->base_draw.draw_img_decoded = prof_draw_img_decoded;
+    sw->base_draw.draw_letter = prof_draw_letter;
+    sw->base_draw.draw_line = prof_draw_line;
+    sw->base_draw.draw_polygon = prof_draw_polygon;
+    sw->blend = prof_blend;
+
+    app_render_prof_reset();
+    return ESP_OK;
+}
+
+/*---------------------------------------------------------------
+    Instrument root and all its descendants. Objects created later
+    are not profiled until attached themselves.
+---------------------------------------------------------------*/
+void app_render_prof_attach(lv_obj_t * root) {
+
+    app_render_prof_obj_t * slot = NULL;
+
+    if (num_objs < APP_RENDER_PROF_MAX_OBJS) {
+        slot = &objs[num_objs++];
+        memset(slot, 0, sizeof(*slot));
+        slot->obj = root;
+        slot->cls = obj_class(root);
+        slot->coords = root->coords;
+    }
+
+    lv_obj_add_event_cb(root, draw_begin_cb, LV_EVENT_DRAW_MAIN_BEGIN | LV_EVENT_PREPROCESS, slot);
+    lv_obj_add_event_cb(root, draw_end_cb, LV_EVENT_DRAW_MAIN_END, slot);
+    lv_obj_add_event_cb(root, draw_begin_cb, LV_EVENT_DRAW_POST_BEGIN | LV_EVENT_PREPROCESS, slot);
+    lv_obj_add_event_cb(root, draw_end_cb, LV_EVENT_DRAW_POST_END, slot);
+
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(root); i++) {
+        app_render_prof_attach(lv_obj_get_child(root, i));
+    }
+}
+
+/*---------------------------------------------------------------
+    Clear the ring and the per object totals
+---------------------------------------------------------------*/
+void app_render_prof_reset(void) {
+    portENTER_CRITICAL(&prof_mux);
+    ring_count = 0;
+    for (int i = 0; i < num_objs; i++) {
+        objs[i].draws = 0;
+        objs[i].cycles = 0;
+    }
+    portEXIT_CRITICAL(&prof_mux);
+}
+
+/*---------------------------------------------------------------
+    Copy out up to max_frames of the most recent frames, oldest
+    first. Returns the number copied.
+---------------------------------------------------------------*/
+int app_render_prof_get_frames(app_render_prof_frame_t * frames, int max_frames) {
+
+    portENTER_CRITICAL(&prof_mux);
+    uint32_t avail = LV_MIN(ring_count, APP_RENDER_PROF_RING);
+    int n = LV_MIN((int)avail, max_frames);
+    for (int i = 0; i < n; i++) {
+        frames[i] = ring[(ring_count - n + i) % APP_RENDER_PROF_RING];
+    }
+    portEXIT_CRITICAL(&prof_mux);
+
+    return n;
+}
+
+/*---------------------------------------------------------------
+    Copy out the per object totals, most expensive first. Returns
+    the number copied.
+---------------------------------------------------------------*/
+int app_render_prof_get_objs(app_render_prof_obj_t * out, int max_objs) {
+
+    portENTER_CRITICAL(&prof_mux);
+    int n = LV_MIN(num_objs, max_objs);
+    bool taken[APP_RENDER_PROF_MAX_OBJS] = {false};
+    for (int k = 0; k < n; k++) {
+        int best = -1;
+        for (int i = 0; i < num_objs; i++) {
+            if (!taken[i] && (best < 0 || objs[i].cycles > objs[best].cycles)) {
+                best = i;
+            }
+        }
+        taken[best] = true;
+        out[k] = objs[best];
+    }
+    portEXIT_CRITICAL(&prof_mux);
+
+    return n;
+}
+
+static inline uint32_t to_us(uint64_t cycles) {
+    return (uint32_t)(cycles / prof_cycles_per_us);
+}
+
+/*---------------------------------------------------------------
+    One frame: areas, per class draw time, blend, shapes, flush
+---------------------------------------------------------------*/
+void app_render_prof_log_frame(const char * TAG, const app_render_prof_frame_t * frame) {
+
+    char line[160];
+    int len = 0;
+
+    ESP_LOGI(TAG, "Frame %lu @ %lu ms: %lu us, %u areas %lu px, blend %lu us, shapes %lu us, flush %lu us in %lu",
+             (unsigned long)frame->seq, (unsigned long)frame->tick_ms, (unsigned long)to_us(frame->total_cycles),
+             frame->areas, (unsigned long)frame->area_px, (unsigned long)to_us(frame->blend_cycles),
+             (unsigned long)to_us(frame->shape_cycles), (unsigned long)to_us(frame->flush_cycles),
+             (unsigned long)frame->flushes);
+
+    for (int c = 0; c < APP_RENDER_PROF_NUM_CLASSES; c++) {
+        if (frame->class_draws[c] > 0) {
+            len += snprintf(line + len, sizeof(line) - len, " %s %lu us/%u", class_names[c],
+                            (unsigned long)to_us(frame->class_cycles[c]), frame->class_draws[c]);
+        }
+    }
+    ESP_LOGI(TAG, "  draw:%s", len ? line : " none");
+
+    len = 0;
+    for (int i = 0; i < LV_MIN(frame->areas, APP_RENDER_PROF_MAX_AREAS); i++) {
+        const app_render_prof_area_t * a = &frame->area[i];
+        len += snprintf(line + len, sizeof(line) - len, " (%d,%d %dx%d)", a->x1, a->y1, a->x2 - a->x1 + 1, a->y2 - a->y1 + 1);
+        if (len >= (int)sizeof(line) - 1) {
+            break;
+        }
+    }
+    ESP_LOGI(TAG, "  areas:%s%s", len ? line : " none", frame->areas > APP_RENDER_PROF_MAX_AREAS ? " ..." : "");
+}
+
+/*---------------------------------------------------------------
+    Dump the most recent frames and the most expensive objects
+---------------------------------------------------------------*/
+void app_render_prof_log_stats(const char * TAG) {
+
+    static app_render_prof_frame_t frames[APP_RENDER_PROF_DUMP_FRAMES];
+    static app_render_prof_obj_t top[APP_RENDER_PROF_TOP_OBJS];
+
+    if (prof_drv == NULL) {
+        ESP_LOGI(TAG, "Render profiler not attached");
+        return;
+    }
+
+    int n = app_render_prof_get_frames(frames, APP_RENDER_PROF_DUMP_FRAMES);
+    for (int i = 0; i < n; i++) {
+        app_render_prof_log_frame(TAG, &frames[i]);
+    }
+
+    n = app_render_prof_get_objs(top, APP_RENDER_PROF_TOP_OBJS);
+    ESP_LOGI(TAG, "Most expensive objects since reset:");
+    for (int i = 0; i < n && top[i].draws > 0; i++) {
+        ESP_LOGI(TAG, "  %-5s (%d,%d %dx%d) %lu us over %lu draws, %lu us each", class_names[top[i].cls],
+                 (int)top[i].coords.x1, (int)top[i].coords.y1, (int)lv_area_get_width(&top[i].coords),
+                 (int)lv_area_get_height(&top[i].coords), (unsigned long)to_us(top[i].cycles),
+                 (unsigned long)top[i].draws, (unsigned long)(to_us(top[i].cycles) / top[i].draws));
+    }
+}
@@ -83,4 +83,30 @@ lv_obj_t * app_arc_create(lv_obj_t * comp_parent, app_arc_t arc_t, lv_coord_t r,
     lv_obj_set_style_pad_bottom(newArc, 2, LV_PART_KNOB | LV_STATE_DEFAULT);
 
     return newArc;
+}
+
+/*---------------------------------------------------------------
+    Same look as a PARTIAL_ARC from app_arc_create, as an app_gauge:
+    track and knob rendered once, only the changed sector redrawn.
+---------------------------------------------------------------*/
+lv_obj_t * app_arc_gauge_create(lv_obj_t * comp_parent, lv_coord_t r,
+                                lv_align_t align, lv_coord_t x_offs, lv_coord_t y_offs,
+                                bool symmetric_mode) {
+
+    lv_obj_t * newGauge = app_gauge_create(comp_parent);
+
+    lv_obj_set_size(newGauge, r, r);
+    lv_obj_align(newGauge, align, x_offs, y_offs);
+    if (symmetric_mode) {
+        app_gauge_set_range(newGauge, -60, 60);
+        app_gauge_set_mode(newGauge, APP_GAUGE_MODE_SYMMETRICAL);
+        app_gauge_set_value(newGauge, 50);
+    }
+    else {
+        app_gauge_set_value(newGauge, 10);
+    }
+    app_gauge_set_colors(newGauge, lv_palette_lighten(LV_PALETTE_GREY, 2), lv_color_hex(APP_COLOR_UNH_NAVY_ALT));
+    app_gauge_set_knob_color(newGauge, lv_color_hex(APP_COLOR_UNH_GOLD));
+
+    return newGauge;
 }
\ No newline at end of file
@@ -1,98 +1,313 @@
+/*
+ * @file app_timer.c
+ * @brief Timer wheel service on one gptimer, plus the deferred-work task that runs timer callbacks.
+ *
+ */
+
 #include "app_include/app_timer.h"
 
-gptimer_state_t GPTIMER_DEFAULT_STATE = {
-    .timerHandle = -1,
-    .running = false
-};
+static const char * TIMER_TAG = "TIMER";
 
-esp_err_t app_reconfigTimerAlarm(gptimer_handle_t * timerHandle, gptimer_state_t * state, uint16_t time_ms, bool oneShot) {
+static gptimer_handle_t hw_timer = NULL;
+static QueueHandle_t work_queue = NULL;
+static app_timer_wheel_t wheel;
+static portMUX_TYPE wheel_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t alarm_tick = APP_TIMER_NEVER;   // Wheel tick the alarm is programmed for
+static volatile bool service_pending = false;   // Wheel needs servicing, checked by the task after every work item
 
-    esp_err_t ret = ESP_OK;
+/*---------------------------------------------------------------
+    Round a time up to a wheel tick so timers never fire early
+---------------------------------------------------------------*/
+static uint64_t us_to_tick(int64_t time_us) {
+    return (time_us <= 0) ? 0 : ((uint64_t)time_us + APP_TIMER_TICK_US - 1) / APP_TIMER_TICK_US;
+}
+
+/*---------------------------------------------------------------
+    Flag the wheel for servicing and wake the task. If the queue
+    is full the wakeup item is dropped, which is fine: the task
+    checks the flag after each of the items already queued.
+---------------------------------------------------------------*/
+static void request_service(void) {
+
+    bool wake;
 
-    if (state->running && state) { // Don't allow a reconfiguration if the timer is currently running...
-        ret = ESP_FAIL;
+    portENTER_CRITICAL(&wheel_mux);
+    wake = !service_pending;
+    service_pending = true;
+    portEXIT_CRITICAL(&wheel_mux);
+
+    if (wake) {
+        app_work_submit(NULL, NULL);
     }
-    else {
-        gptimer_alarm_config_t gptimer_config = {
-            .alarm_count = GPTIMER_MS_TO_TICKS(time_ms),
-            .reload_count = 0,
-            .flags.auto_reload_on_alarm = false ? oneShot : true
-        };
+}
+
+/*---------------------------------------------------------------
+    Alarm ISR, no wheel work here
+---------------------------------------------------------------*/
+static bool IRAM_ATTR alarm_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t * edata, void * user_ctx) {
+
+    bool wake;
+    bool woken = false;
 
-        ret = gptimer_set_alarm_action(*timerHandle, &gptimer_config);
+    portENTER_CRITICAL_ISR(&wheel_mux);
+    wake = !service_pending;
+    service_pending = true;
+    portEXIT_CRITICAL_ISR(&wheel_mux);
+
+    if (wake) {
+        woken = app_work_submit_from_isr(NULL, NULL);
     }
 
-    if (ret != ESP_OK) {
-        ESP_LOGI((const char *) "DEBUG", "Couldn't initialize timer!");
+    return woken;
+}
+
+/*---------------------------------------------------------------
+    Program the one-shot alarm for the next tick the wheel needs
+    serviced, or disable it if there are no timers. Returns false
+    if that tick has (or may have) already passed.
+---------------------------------------------------------------*/
+static bool program_alarm(void) {
+
+    uint64_t tick;
+    uint64_t count = 0;
+
+    portENTER_CRITICAL(&wheel_mux);
+    tick = app_timer_wheel_next(&wheel);
+    alarm_tick = tick;
+    portEXIT_CRITICAL(&wheel_mux);
+
+    if (tick == APP_TIMER_NEVER) {
+        gptimer_set_alarm_action(hw_timer, NULL);
+        return true;
     }
-    else {
-       ESP_LOGI((const char *) "DEBUG", "Time intialized!"); 
+
+    gptimer_get_raw_count(hw_timer, &count);
+    int64_t delay_us = (int64_t)(tick * APP_TIMER_TICK_US) - esp_timer_get_time();
+    if (delay_us < APP_TIMER_MIN_ALARM_US) {
+        return false;
     }
 
-    return ret;
+    gptimer_alarm_config_t alarm_config = {
+        .alarm_count = count + (uint64_t)delay_us,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = false     // One-shot, reprogrammed after every expiry
+    };
+    gptimer_set_alarm_action(hw_timer, &alarm_config);
+
+    gptimer_get_raw_count(hw_timer, &count);    // Counter may have overtaken the alarm while it was being set
+    return count < alarm_config.alarm_count;
+}
+
+/*---------------------------------------------------------------
+    Expire due timers and run their callbacks one at a time, so a
+    callback may arm or cancel any timer, then re-program the alarm.
+---------------------------------------------------------------*/
+static void timer_service(void) {
+
+    portENTER_CRITICAL(&wheel_mux);
+    service_pending = false;
+    portEXIT_CRITICAL(&wheel_mux);
+
+    do {
+        for (;;) {
+            uint64_t now_tick = (uint64_t)esp_timer_get_time() / APP_TIMER_TICK_US;
+            app_timer_cb_t cb = NULL;
+            void * arg = NULL;
+
+            portENTER_CRITICAL(&wheel_mux);
+            app_timer_wheel_advance(&wheel, now_tick);
+            app_timer_t * timer = app_timer_wheel_pop(&wheel);
+            if (timer) {
+                cb = timer->cb;
+                arg = timer->arg;
+                if (timer->period) {
+                    // Re-armed before the callback runs so the callback can cancel it. Missed periods are skipped, not burst.
+                    timer->expires += timer->period;
+                    if (timer->expires <= now_tick) {
+                        timer->expires = now_tick + timer->period;
+                    }
+                    app_timer_wheel_add(&wheel, timer);
+                }
+            }
+            portEXIT_CRITICAL(&wheel_mux);
+
+            if (timer == NULL) {
+                break;
+            }
+            cb(arg);
+        }
+    } while (!program_alarm());
 }
 
-// Initialize a timer with a predeclared NULL timerHandle. Allows a user to specify a callback in the main application source file 
-esp_err_t app_initTimer(gptimer_handle_t * timerHandle, void (*cb)(int), uint16_t time_ms, bool oneShot) {
+/*---------------------------------------------------------------
+    Deferred-work task: submitted work items and the timer wheel
+---------------------------------------------------------------*/
+static void timerTask(void * pvParameters) {
+
+    app_work_item_t item;
+
+    for (;;) {
+        if (xQueueReceive(work_queue, &item, portMAX_DELAY) == pdTRUE && item.fn) {
+            item.fn(item.arg);
+        }
+        if (service_pending) {
+            timer_service();
+        }
+    }
+}
+
+/*---------------------------------------------------------------
+    Timer service init: gptimer free running at 1 MHz, alarm off
+    until the first timer is armed.
+---------------------------------------------------------------*/
+esp_err_t app_timer_init(void) {
 
     esp_err_t ret = ESP_OK;
 
+    if (hw_timer != NULL) {
+        return ESP_OK;
+    }
+
+    app_timer_wheel_init(&wheel, us_to_tick(esp_timer_get_time()));
+
+    work_queue = xQueueCreate(APP_TIMER_WORK_QUEUE_LENGTH, sizeof(app_work_item_t));
+    if (work_queue == NULL) {
+        ESP_LOGE(TIMER_TAG, "Couldn't create work queue!");
+        return ESP_ERR_NO_MEM;
+    }
+
     gptimer_config_t timer_config = {
         .clk_src = GPTIMER_CLK_SRC_DEFAULT,
         .direction = GPTIMER_COUNT_UP,
-        .resolution_hz = GPTIMER_BASE_TICK_FREQ_HZ, // 1MHz, 1 tick = 1us
+        .resolution_hz = APP_TIMER_RESOLUTION_HZ,
     };
-    
-    ret = gptimer_new_timer(&timer_config, timerHandle);
-
-    /*
-    gptimer_alarm_config_t gptimer_alarm_config = {
-        .alarm_count = GPTIMER_MS_TO_TICKS(time_ms),
-        .reload_count = 0,
-        .flags.auto_reload_on_alarm = false ? oneShot : true
-    };
-    ret = gptimer_set_alarm_action(*timerHandle, &gptimer_alarm_config);
-    */
-    ret = app_reconfigTimerAlarm(timerHandle, &GPTIMER_DEFAULT_STATE, time_ms, oneShot);
-    
     gptimer_event_callbacks_t cbs = {
-        .on_alarm = cb, // register user callback
+        .on_alarm = alarm_isr,
     };
 
-    ret = gptimer_register_event_callbacks(*timerHandle, &cbs, NULL);
-    ret = gptimer_enable(*timerHandle);
+    ret = gptimer_new_timer(&timer_config, &hw_timer);
+    if (ret == ESP_OK) {
+        ret = gptimer_register_event_callbacks(hw_timer, &cbs, NULL);
+    }
+    if (ret == ESP_OK) {
+        ret = gptimer_enable(hw_timer);
+    }
+    if (ret == ESP_OK) {
+        ret = gptimer_start(hw_timer);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TIMER_TAG, "Couldn't initialize timer!");
+        return ret;
+    }
+
+    if (xTaskCreate(timerTask, "timer_task", APP_TIMER_TASK_STACK, NULL, APP_TIMER_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TIMER_TAG, "Couldn't create timer task!");
+        ret = ESP_ERR_NO_MEM;
+    }
+
     return ret;
 }
 
-esp_err_t app_toggleTimerRun(gptimer_handle_t * timerHandle, gptimer_state_t * state) {
+/*---------------------------------------------------------------
+    Bind a callback to a timer, which starts out disarmed. The
+    callback runs in the timer task, keep it short.
+---------------------------------------------------------------*/
+void app_timer_setup(app_timer_t * timer, app_timer_cb_t cb, void * arg) {
+    memset(timer, 0, sizeof(app_timer_t));
+    timer->cb = cb;
+    timer->arg = arg;
+}
 
-    esp_err_t ret = ESP_OK;
+static esp_err_t arm_tick(app_timer_t * timer, uint64_t expires, uint32_t period) {
 
-    if (state->running == true) {
-        ret = gptimer_stop(*timerHandle);
-        state->running = false;
+    bool wake;
+
+    if (timer == NULL || timer->cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
     }
-    else {
-        ret = gptimer_start(*timerHandle);
-        state->running = true;
+    if (hw_timer == NULL) {
+        return ESP_ERR_INVALID_STATE;
     }
 
-    return ret;
+    portENTER_CRITICAL(&wheel_mux);
+    timer->expires = expires;
+    timer->period = period;
+    app_timer_wheel_add(&wheel, timer);
+    wake = app_timer_wheel_next(&wheel) < alarm_tick;
+    portEXIT_CRITICAL(&wheel_mux);
+
+    if (wake) {
+        request_service();  // New earliest deadline, the alarm has to be brought forward
+    }
+
+    return ESP_OK;
 }
 
-esp_err_t app_setTimerCount(gptimer_handle_t * timerHandle, uint64_t value) {
+/*---------------------------------------------------------------
+    (Re-)arm a timer relative to now. period_us = 0 for one-shot.
+---------------------------------------------------------------*/
+esp_err_t app_timer_arm(app_timer_t * timer, uint32_t delay_us, uint32_t period_us) {
+    uint32_t period = period_us ? (uint32_t)us_to_tick(period_us) : 0;
+    return arm_tick(timer, us_to_tick(esp_timer_get_time() + delay_us), period);
+}
 
-    esp_err_t ret = ESP_OK;
-    ret = gptimer_set_raw_count(*timerHandle, value);
+/*---------------------------------------------------------------
+    (Re-)arm a one-shot timer for an esp_timer_get_time() deadline
+---------------------------------------------------------------*/
+esp_err_t app_timer_arm_at(app_timer_t * timer, int64_t deadline_us) {
+    return arm_tick(timer, us_to_tick(deadline_us), 0);
+}
 
-    return ret;
+/*---------------------------------------------------------------
+    Cancel a timer. A callback that is already running can't be
+    recalled, owners that race the timer task should re-check
+    their own state in the callback.
+---------------------------------------------------------------*/
+void app_timer_cancel(app_timer_t * timer) {
+    portENTER_CRITICAL(&wheel_mux);
+    app_timer_wheel_remove(&wheel, timer);
+    portEXIT_CRITICAL(&wheel_mux);
 }
 
-esp_err_t app_getTimerCount(gptimer_handle_t * timerHandle, uint64_t * value) {
+bool app_timer_is_armed(app_timer_t * timer) {
+    bool armed;
+    portENTER_CRITICAL(&wheel_mux);
+    armed = timer->armed;
+    portEXIT_CRITICAL(&wheel_mux);
+    return armed;
+}
 
-    esp_err_t ret = ESP_OK;
-    ret = gptimer_get_raw_count(*timerHandle, *value);
+/*---------------------------------------------------------------
+    Queue a function to run in the timer task. Never blocks, so
+    it is safe to call from a timer callback.
+---------------------------------------------------------------*/
+esp_err_t app_work_submit(app_work_fn_t fn, void * arg) {
 
-    return ret;
+    app_work_item_t item = {
+        .fn = fn,
+        .arg = arg
+    };
+
+    if (work_queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    return (xQueueSend(work_queue, &item, 0) == pdTRUE) ? ESP_OK : ESP_ERR_TIMEOUT;
 }
 
+/*---------------------------------------------------------------
+    ISR variant. Returns true if a context switch is needed; the
+    item is dropped if the queue is full.
+---------------------------------------------------------------*/
+bool IRAM_ATTR app_work_submit_from_isr(app_work_fn_t fn, void * arg) {
+
+    BaseType_t woken = pdFALSE;
+    app_work_item_t item = {
+        .fn = fn,
+        .arg = arg
+    };
+
+    xQueueSendFromISR(work_queue, &item, &woken);
+
+    return woken == pdTRUE;
+}
@@ -0,0 +1,231 @@
+/*
+ * @file app_timer_wheel.c
+ * @brief Hierarchical timer wheel, see app_timer_wheel.h.
+ *
+ */
+
+#include "app_include/app_timer_wheel.h"
+
+#define SLOT_MASK               (APP_TIMER_WHEEL_SLOTS - 1)
+#define LEVEL_SHIFT(level)      ((level) * APP_TIMER_WHEEL_BITS)
+#define EXPIRED_LEVEL           APP_TIMER_WHEEL_LEVELS      // timer->level while waiting on the expired list
+
+/*---------------------------------------------------------------
+    Slot list helpers
+---------------------------------------------------------------*/
+static void link_timer(app_timer_wheel_t * wheel, app_timer_t * timer, int level, int slot) {
+    app_timer_t * head = wheel->slots[level][slot];
+    timer->level = (uint8_t)level;
+    timer->slot = (uint8_t)slot;
+    timer->prev = NULL;
+    timer->next = head;
+    if (head) {
+        head->prev = timer;
+    }
+    wheel->slots[level][slot] = timer;
+    wheel->occupied[level] |= (1ull << slot);
+}
+
+static void unlink_timer(app_timer_wheel_t * wheel, app_timer_t * timer) {
+
+    if (timer->level == EXPIRED_LEVEL) {
+        if (timer->prev) {
+            timer->prev->next = timer->next;
+        }
+        else {
+            wheel->expired = timer->next;
+        }
+        if (timer->next) {
+            timer->next->prev = timer->prev;
+        }
+        else {
+            wheel->expired_tail = timer->prev;
+        }
+    }
+    else {
+        if (timer->prev) {
+            timer->prev->next = timer->next;
+        }
+        else {
+            wheel->slots[timer->level][timer->slot] = timer->next;
+        }
+        if (timer->next) {
+            timer->next->prev = timer->prev;
+        }
+        if (wheel->slots[timer->level][timer->slot] == NULL) {
+            wheel->occupied[timer->level] &= ~(1ull << timer->slot);
+        }
+    }
+    timer->next = NULL;
+    timer->prev = NULL;
+}
+
+// Due timers wait in FIFO order until popped, still armed so they can be cancelled in the meantime
+static void queue_expired(app_timer_wheel_t * wheel, app_timer_t * timer) {
+    timer->level = EXPIRED_LEVEL;
+    timer->next = NULL;
+    timer->prev = wheel->expired_tail;
+    if (wheel->expired_tail) {
+        wheel->expired_tail->next = timer;
+    }
+    else {
+        wheel->expired = timer;
+    }
+    wheel->expired_tail = timer;
+}
+
+// Place a timer by its distance from 'now'. Anything already due goes in the slot processed next.
+static void place(app_timer_wheel_t * wheel, app_timer_t * timer) {
+
+    uint64_t expires = timer->expires;
+    if (expires < wheel->now) {
+        expires = wheel->now;
+    }
+    uint64_t delta = expires - wheel->now;
+    if (delta >= APP_TIMER_WHEEL_RANGE) {
+        expires = wheel->now + APP_TIMER_WHEEL_RANGE - 1;   // Parked at the far end, re-placed on cascade
+        delta = APP_TIMER_WHEEL_RANGE - 1;
+    }
+
+    int level = 0;
+    while (level < APP_TIMER_WHEEL_LEVELS - 1 && delta >= (1ull << LEVEL_SHIFT(level + 1))) {
+        level++;
+    }
+    link_timer(wheel, timer, level, (int)((expires >> LEVEL_SHIFT(level)) & SLOT_MASK));
+}
+
+/*---------------------------------------------------------------
+    Wheel init. 'now_tick' is the first tick to be processed.
+---------------------------------------------------------------*/
+void app_timer_wheel_init(app_timer_wheel_t * wheel, uint64_t now_tick) {
+    for (int level = 0; level < APP_TIMER_WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < APP_TIMER_WHEEL_SLOTS; slot++) {
+            wheel->slots[level][slot] = NULL;
+        }
+        wheel->occupied[level] = 0;
+    }
+    wheel->expired = NULL;
+    wheel->expired_tail = NULL;
+    wheel->now = now_tick;
+}
+
+/*---------------------------------------------------------------
+    Arm (timer->expires must be set). O(1).
+---------------------------------------------------------------*/
+void app_timer_wheel_add(app_timer_wheel_t * wheel, app_timer_t * timer) {
+    if (timer->armed) {
+        unlink_timer(wheel, timer);
+    }
+    timer->armed = true;
+    place(wheel, timer);
+}
+
+/*---------------------------------------------------------------
+    Cancel. O(1), harmless if the timer is not armed. A timer that
+    is due but not yet popped is cancelled too.
+---------------------------------------------------------------*/
+void app_timer_wheel_remove(app_timer_wheel_t * wheel, app_timer_t * timer) {
+    if (timer->armed) {
+        unlink_timer(wheel, timer);
+        timer->armed = false;
+    }
+}
+
+/*---------------------------------------------------------------
+    Earliest tick at which advance() has work to do: a level 0
+    slot to expire or a higher level slot to cascade. This may be
+    earlier than the earliest expiry, never later.
+---------------------------------------------------------------*/
+uint64_t app_timer_wheel_next(const app_timer_wheel_t * wheel) {
+
+    uint64_t next = APP_TIMER_NEVER;
+
+    for (int level = 0; level < APP_TIMER_WHEEL_LEVELS; level++) {
+        uint64_t bits = wheel->occupied[level];
+        if (bits == 0) {
+            continue;
+        }
+        // First tick at or after 'now' that lands on a slot boundary of this level
+        uint64_t granule = 1ull << LEVEL_SHIFT(level);
+        uint64_t boundary = (wheel->now + granule - 1) & ~(granule - 1);
+        int index = (int)((boundary >> LEVEL_SHIFT(level)) & SLOT_MASK);
+
+        // Rotate so bit 0 is the slot reached at 'boundary', then count slots to the first occupied one
+        uint64_t rotated = index ? ((bits >> index) | (bits << (APP_TIMER_WHEEL_SLOTS - index))) : bits;
+        uint64_t tick = boundary + ((uint64_t)__builtin_ctzll(rotated) << LEVEL_SHIFT(level));
+        if (tick < next) {
+            next = tick;
+        }
+    }
+
+    return next;
+}
+
+/*---------------------------------------------------------------
+    Process every tick up to and including 'now_tick', skipping
+    ticks with nothing to do. Due timers are moved to the expired
+    list, oldest first, to be collected with app_timer_wheel_pop().
+---------------------------------------------------------------*/
+void app_timer_wheel_advance(app_timer_wheel_t * wheel, uint64_t now_tick) {
+
+    while (wheel->now <= now_tick) {
+
+        uint64_t tick = app_timer_wheel_next(wheel);
+        if (tick > now_tick) {
+            break;
+        }
+        wheel->now = tick;
+
+        // Cascade from the highest level whose slot boundary this is, so timers can fall more than one level
+        for (int level = APP_TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+            if (tick & ((1ull << LEVEL_SHIFT(level)) - 1)) {
+                continue;
+            }
+            int slot = (int)((tick >> LEVEL_SHIFT(level)) & SLOT_MASK);
+            app_timer_t * timer = wheel->slots[level][slot];
+            wheel->slots[level][slot] = NULL;
+            wheel->occupied[level] &= ~(1ull << slot);
+            while (timer) {
+                app_timer_t * next = timer->next;
+                place(wheel, timer);
+                timer = next;
+            }
+        }
+
+        // Expire level 0
+        int slot = (int)(tick & SLOT_MASK);
+        app_timer_t * timer = wheel->slots[0][slot];
+        wheel->slots[0][slot] = NULL;
+        wheel->occupied[0] &= ~(1ull << slot);
+        wheel->now = tick + 1;
+        while (timer) {
+            app_timer_t * next = timer->next;
+            if (timer->expires > tick) {
+                place(wheel, timer);    // Was parked beyond the wheel's range, not due yet
+            }
+            else {
+                queue_expired(wheel, timer);
+            }
+            timer = next;
+        }
+    }
+
+    if (wheel->now <= now_tick) {
+        wheel->now = now_tick + 1;
+    }
+}
+
+/*---------------------------------------------------------------
+    Take the oldest expired timer off the expired list, disarmed.
+    NULL once the list is empty.
+---------------------------------------------------------------*/
+app_timer_t * app_timer_wheel_pop(app_timer_wheel_t * wheel) {
+
+    app_timer_t * timer = wheel->expired;
+    if (timer) {
+        unlink_timer(wheel, timer);
+        timer->armed = false;
+    }
+
+    return timer;
+}
@@ -0,0 +1,326 @@
+/*
+ * @file app_ui.c
+ * @brief The remote's main screen and its input devices, see app_ui.h.
+ *
+ */
+
+#include "app_include/app_ui.h"
+
+static const app_ui_io_t * ui_io = NULL;
+
+static lv_obj_t * arc0;
+static lv_obj_t * arc1;
+static lv_obj_t * arc2;
+static lv_obj_t * arc3;
+static lv_obj_t * vbatLabel;
+static app_num_label_t vbatText;
+static app_num_label_t dialText[4];     // Value labels of arc0..arc3
+static lv_style_t vbatLabel_style;
+static lv_obj_t * chanSelect_label;
+static lv_obj_t * app_images[2];
+static bool activeImage = true;
+
+/*---------------------------------------------------------------
+    LVGL Encoder Input Device Read Callback
+---------------------------------------------------------------*/
+static void lv_indev_encA_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data) {
+    // Keep a temp count here, and grab current count from ISR
+    // do the differencing and set the encoder_diff value
+
+    static int temp = 0;
+    int pos = ui_io->enc_pos(APP_UI_ENC_A);
+
+    if (pos > temp) {
+        data->enc_diff = pos - temp;
+    }
+    else if (pos < temp) {
+        data->enc_diff = -(temp - pos);
+    }
+
+    temp = pos;
+
+}
+
+/*---------------------------------------------------------------
+    LVGL Encoder Input Device Read Callback
+---------------------------------------------------------------*/
+static void lv_indev_encB_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data) {
+    // Keep a temp count here, and grab current count from ISR
+    // do the differencing and set the encoder_diff value
+
+    static int temp = 0;
+    int pos = ui_io->enc_pos(APP_UI_ENC_B);
+
+    // Me thinks we should probably use a queue here with 0 timeout,
+    // then check with the static temp value, and update accordingly.
+
+    if (pos > temp) {
+        data->enc_diff = pos - temp;
+    }
+    else if (pos < temp) {
+        data->enc_diff = -(temp - pos);
+    }
+    temp = pos;
+
+}
+
+/*---------------------------------------------------------------
+    LCD callback function for updating arc rotation
+---------------------------------------------------------------*/
+static void arc_encA_event_cb(lv_event_t * e) {
+
+    lv_obj_t * arc = lv_event_get_target(e);
+    app_num_label_t * text = lv_event_get_user_data(e);
+
+    app_gauge_set_value(arc, ui_io->enc_pos(APP_UI_ENC_A) * 2);
+    app_num_label_set(text, NULL, app_gauge_get_value(arc) / 2, 0, NULL);
+
+}
+
+/*---------------------------------------------------------------
+    LCD callback function for updating arc rotation
+---------------------------------------------------------------*/
+static void arc_encB_event_cb(lv_event_t * e) {
+
+    lv_obj_t * arc = lv_event_get_target(e);
+    app_num_label_t * text = lv_event_get_user_data(e);
+
+    app_gauge_set_value(arc, ui_io->enc_pos(APP_UI_ENC_B) * 2);
+    app_num_label_set(text, NULL, app_gauge_get_value(arc) / 2, 0, NULL);
+
+}
+
+/*---------------------------------------------------------------
+    UI bindings. Readers return the quantity as displayed, so ADC
+    noise below the display resolution never causes a redraw.
+---------------------------------------------------------------*/
+static int32_t ui_read_vbat(void * ctx) {
+    // Battery state in the upper half, centivolts in the lower
+    return ((int32_t)ui_io->battery_state() << 16) | (int32_t)ui_io->vbat_cv();
+}
+
+static void ui_render_vbat(void * ctx, int32_t value) {
+    battery_states_t state = (battery_states_t)(value >> 16);
+    int centivolts = value & 0xFFFF;
+    lv_style_set_text_color(&vbatLabel_style, lv_color_hex(batteryColors[state]));
+    lv_obj_report_style_change(&vbatLabel_style);
+    app_num_label_set((app_num_label_t *)ctx, app_icons[state], centivolts, 2, "V");
+}
+
+static int32_t ui_read_potc(void * ctx) {
+    return ui_io->pot_pct(APP_UI_POT_C);
+}
+
+static int32_t ui_read_potd(void * ctx) {
+    return ui_io->pot_pct(APP_UI_POT_D);
+}
+
+static void ui_render_pot_arc(void * ctx, int32_t value) {
+    app_num_label_t * text = (app_num_label_t *)ctx;
+    lv_obj_t * arc = lv_obj_get_parent(text->label);   // Value label is the arc's only child
+    app_gauge_set_value(arc, (int16_t)value);
+    app_num_label_set(text, NULL, app_gauge_get_value(arc), 0, NULL);
+}
+
+static void ui_render_backlight(void * ctx, int32_t value) {
+    if (ui_io->set_backlight != NULL) {
+        ui_io->set_backlight(value);
+    }
+}
+
+static int32_t ui_read_swA(void * ctx) {
+    return ui_io->enc_pressed(APP_UI_ENC_A);
+}
+
+static int32_t ui_read_swB(void * ctx) {
+    return ui_io->enc_pressed(APP_UI_ENC_B);
+}
+
+static void ui_render_knob(void * ctx, int32_t value) {
+    app_gauge_set_knob_color((lv_obj_t *)ctx, lv_color_hex(knobColors[value]));
+}
+
+typedef enum {
+    UI_BIND_VBAT = 0,
+    UI_BIND_VOLUME,
+    UI_BIND_DISTANCE,
+    UI_BIND_BACKLIGHT,
+    UI_BIND_KNOB_A,
+    UI_BIND_KNOB_B,
+    UI_NUM_BINDINGS
+} app_ui_bind_id_t;
+
+// Widget targets (ctx) are filled in by app_display_init once the objects exist
+static app_ui_binding_t uiBindings[UI_NUM_BINDINGS] = {
+    [UI_BIND_VBAT]      = {.name = "vbat",      .read = ui_read_vbat, .render = ui_render_vbat},
+    [UI_BIND_VOLUME]    = {.name = "volume",    .read = ui_read_potc, .render = ui_render_pot_arc},
+    [UI_BIND_DISTANCE]  = {.name = "distance",  .read = ui_read_potd, .render = ui_render_pot_arc},
+    [UI_BIND_BACKLIGHT] = {.name = "backlight", .read = ui_read_potd, .render = ui_render_backlight},
+    [UI_BIND_KNOB_A]    = {.name = "knob A",    .read = ui_read_swA,  .render = ui_render_knob},
+    [UI_BIND_KNOB_B]    = {.name = "knob B",    .read = ui_read_swB,  .render = ui_render_knob},
+};
+
+/*---------------------------------------------------------------
+    LCD LVGL main application init code (plot main objects)
+---------------------------------------------------------------*/
+void app_display_init(const app_ui_io_t * io) {
+
+    int offset = 30;
+
+    ui_io = io;
+
+    // LV_FONT_DEFAULT: montserrat 14 cut down by host/font_subset to the characters this file and app_spi.c print
+    lv_obj_set_style_text_font(lv_scr_act(), &app_font_ui, 0);
+
+    //------------- University Crest Image ---------------//
+    app_img_rle_init();
+    app_glyph_cache_init();
+    app_blend_565_init();
+    app_images[0] = lv_img_create(lv_scr_act());
+    app_images[1] = lv_img_create(lv_scr_act());
+    LV_IMG_DECLARE(app_img_universityCrest160x160);
+    LV_IMG_DECLARE(app_img_directivity160x160);
+    lv_img_set_src(app_images[0], &app_img_universityCrest160x160);
+    lv_img_set_src(app_images[1], &app_img_directivity160x160);
+    //lv_img_set_angle(icon, -900);
+    lv_obj_align(app_images[0], LV_ALIGN_CENTER, -70, 32);
+    lv_obj_align(app_images[1], LV_ALIGN_CENTER, -70, 32);
+
+    //lv_obj_set_style_img_recolor_opa(icon, 255, LV_PART_MAIN);
+    //lv_obj_set_style_img_recolor(icon, lv_color_hex(/*COLOR_UNH_NAVY*/0xFFFFFF), LV_PART_MAIN);
+    lv_obj_add_flag(app_images[0], LV_OBJ_FLAG_HIDDEN);
+    //lv_obj_clear_flag(icon, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(app_images[1], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(app_images[1], LV_OBJ_FLAG_HIDDEN);
+
+    //------------- Main display label (scrolling text) ---------------//
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 100, 30);  // width taken care of by below call
+    lv_obj_center(obj);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Sound Steering - Remote Module                By K. Harper");
+    lv_obj_add_flag(label, LV_OBJ_FLAG_FLOATING); /*To be ignored by scrollbars*/
+    lv_obj_center(label);
+    lv_obj_update_layout(obj);    /*To have the correct size for lv_obj_get_width*/
+    lv_obj_align(obj, LV_ALIGN_CENTER, -70, -75);
+
+    //------------- Enc A - Azimuth Encoder Arc ---------------//
+    arc0 = app_arc_gauge_create(lv_scr_act(), APP_ARC_SIZE, LV_ALIGN_TOP_RIGHT, -10, 10, true);
+    lv_obj_t * label_arc0 = lv_label_create(lv_scr_act());
+    lv_obj_t * label_data_arc0 = lv_label_create(arc0); // set parent to arc object
+    lv_label_set_text(label_arc0, "Azim. Enc.");
+    lv_obj_align(label_arc0, LV_ALIGN_TOP_RIGHT, -70, 30);
+    lv_obj_align(label_data_arc0, LV_ALIGN_CENTER, 0, 0);
+    app_num_label_init(&dialText[0], label_data_arc0);
+    lv_obj_add_event_cb(arc0, arc_encA_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, &dialText[0]);
+    //lv_obj_add_event_cb(arc0, sw_pressed_cbA, LV_EVENT_PRESSED, NULL);
+    lv_event_send(arc0, LV_EVENT_VALUE_CHANGED, NULL);
+
+    //------------- Enc B - Elevation Encoder Arc ---------------//
+    arc1 = app_arc_gauge_create(lv_scr_act(), APP_ARC_SIZE, LV_ALIGN_RIGHT_MID, -10, -offset, true);
+    lv_obj_t * label_arc1 = lv_label_create(lv_scr_act());
+    lv_obj_t * label_data_arc1 = lv_label_create(arc1);
+    lv_label_set_text(label_arc1, "Elev. Enc.");
+    lv_obj_align(label_arc1, LV_ALIGN_RIGHT_MID, -70, -offset);
+    lv_obj_align(label_data_arc1, LV_ALIGN_CENTER, 0, 0);
+    app_num_label_init(&dialText[1], label_data_arc1);
+    lv_obj_add_event_cb(arc1, arc_encB_event_cb, /*LV_EVENT_KEY*/ LV_EVENT_VALUE_CHANGED /*| LV_EVENT_PRESSED*/, &dialText[1]);
+    lv_event_send(arc1, LV_EVENT_VALUE_CHANGED, NULL);
+
+    //------------- Pot C - Volume Potentiometer Arc ---------------//
+    arc2 = app_arc_gauge_create(lv_scr_act(), APP_ARC_SIZE, LV_ALIGN_RIGHT_MID, -10, +offset, false);
+    lv_obj_t * label_arc2 = lv_label_create(lv_scr_act());
+    lv_obj_t * label_data_arc2 = lv_label_create(arc2);
+    lv_label_set_text(label_arc2, "Volm. Pot.");
+    lv_obj_align(label_arc2, LV_ALIGN_RIGHT_MID, -70, +offset);
+    app_num_label_init(&dialText[2], label_data_arc2);
+    app_num_label_set(&dialText[2], NULL, 0, 0, NULL);
+    lv_obj_align(label_data_arc2, LV_ALIGN_CENTER, 0, 0);
+
+    //------------- Pot D - Volume Potentiometer Arc ---------------//
+    arc3 = app_arc_gauge_create(lv_scr_act(), APP_ARC_SIZE, LV_ALIGN_BOTTOM_RIGHT, -10, -10, false);
+    lv_obj_t * label_arc3 = lv_label_create(lv_scr_act());
+    lv_obj_t * label_data_arc3 = lv_label_create(arc3);
+    lv_label_set_text(label_arc3, "Dist. Pot.");
+    lv_obj_align(label_arc3, LV_ALIGN_BOTTOM_RIGHT, -70, -30);
+    app_num_label_init(&dialText[3], label_data_arc3);
+    app_num_label_set(&dialText[3], NULL, 0, 0, NULL);
+    lv_obj_align(label_data_arc3, LV_ALIGN_CENTER, 0, 0);
+
+    //------------- Battery Voltage Readout ---------------//
+    int centivolts = io->vbat_cv();
+    vbatLabel = lv_label_create(lv_scr_act());
+    lv_style_init(&vbatLabel_style);
+    lv_style_set_text_color(&vbatLabel_style, lv_color_hex(batteryColors[io->battery_state()]));
+    app_num_label_init(&vbatText, vbatLabel);
+    app_num_label_set(&vbatText, LV_SYMBOL_BATTERY_EMPTY, centivolts, 2, "V");
+    lv_obj_add_style(vbatLabel, &vbatLabel_style, 0);
+    lv_obj_align(vbatLabel, LV_ALIGN_TOP_LEFT, 25, 5);
+
+    //------------- Controller Audio Chan Select 1 Indicator ---------------//
+    chanSelect_label = lv_label_create(lv_scr_act());
+    lv_label_set_text(chanSelect_label, " C1|C2|C3");
+    lv_obj_align(chanSelect_label, LV_ALIGN_TOP_LEFT, 95, 5);
+
+    //------------- Map arc0 and encA to LVGL input device and place into LVGL object group ---------------//
+    //lv_disp_drv_register(&disp_drv); // Taken care of in init section of displayTask
+    static lv_indev_drv_t indev_drv0;
+    lv_indev_drv_init(&indev_drv0);
+    indev_drv0.type = LV_INDEV_TYPE_ENCODER;
+    indev_drv0.read_cb = lv_indev_encA_read_cb;
+
+    //Register the driver in LVGL and save the created input device object
+    lv_indev_t * my_indev0 = lv_indev_drv_register(&indev_drv0);
+    lv_group_t * encA_group = lv_group_create();
+    lv_group_add_obj(encA_group, arc0);
+    lv_indev_set_group(my_indev0, encA_group);
+    lv_group_focus_obj(arc0);
+    lv_group_set_editing(encA_group, true);
+
+    //------------- Map arc1 and encB to LVGL input device and place into LVGL object group ---------------//
+    static lv_indev_drv_t indev_drv1;
+    lv_indev_drv_init(&indev_drv1);
+    indev_drv1.type = LV_INDEV_TYPE_ENCODER;
+    indev_drv1.read_cb = lv_indev_encB_read_cb;
+
+    //Register the driver in LVGL and save the created input device object
+    lv_indev_t * my_indev1 = lv_indev_drv_register(&indev_drv1);
+    lv_group_t * encB_group = lv_group_create();
+    lv_group_add_obj(encB_group, arc1);
+    lv_indev_set_group(my_indev1, encB_group);
+    lv_group_focus_obj(arc1);
+    lv_group_set_editing(encB_group, true);
+
+    //------------- Bind application values to widgets, rendered on change only ---------------//
+    uiBindings[UI_BIND_VBAT].ctx = &vbatText;
+    uiBindings[UI_BIND_VOLUME].ctx = &dialText[2];
+    uiBindings[UI_BIND_DISTANCE].ctx = &dialText[3];
+    uiBindings[UI_BIND_KNOB_A].ctx = arc0;
+    uiBindings[UI_BIND_KNOB_B].ctx = arc1;
+    app_ui_model_init(uiBindings, UI_NUM_BINDINGS);
+
+    //------------- Scrolling text animation ---------------//
+    app_banner_start(label, lv_obj_get_width(obj) + 160, -lv_obj_get_width(label) - 20, ANIM_PERIOD_MS,
+                     APP_BANNER_PRERENDER);
+}
+
+/*---------------------------------------------------------------
+    Show image 0 or 1. Showing the one already shown is free
+---------------------------------------------------------------*/
+void app_display_show_image(int index) {
+    index = (index != 0);
+    if (index == activeImage) {
+        return;
+    }
+    lv_obj_add_flag(app_images[activeImage], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(app_images[index], LV_OBJ_FLAG_HIDDEN);
+    activeImage = index;
+}
+
+/*---------------------------------------------------------------
+    Show the other image
+---------------------------------------------------------------*/
+void app_display_swap_image(void) {
+    app_display_show_image(!activeImage);
+}
@@ -0,0 +1,166 @@
+/*
+ * @file app_ui_cmd.c
+ * @brief UI command queue, see app_ui_cmd.h.
+ *
+ *        The ring is the bounded MPMC queue of D. Vyukov cut down to one consumer. Cell i starts with sequence i.
+ *        A producer may fill the cell at position pos when its sequence is pos, and publishes it as pos + 1; the
+ *        consumer takes it at that value and hands the cell to the next lap as pos + QUEUE_LEN. A sequence behind
+ *        pos means the consumer hasn't freed the cell yet: the queue is full. A producer that has claimed a cell but
+ *        not yet published it holds up the cells behind it until the next drain, it never loses them.
+ *        32 bit atomics only, which the ESP32 does natively (S32C1I).
+ *
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+#include "app_include/app_ui_cmd.h"
+
+#define QUEUE_MASK      (APP_UI_CMD_QUEUE_LEN - 1)
+#define NUM_KEYS        (APP_UI_CMD_NUM_TYPES * APP_UI_CMD_MAX_TARGETS)
+
+_Static_assert((APP_UI_CMD_QUEUE_LEN & QUEUE_MASK) == 0, "APP_UI_CMD_QUEUE_LEN must be a power of two");
+_Static_assert(NUM_KEYS <= 32, "one dirty bit per type and target");
+
+typedef struct {
+    atomic_uint seq;
+    app_ui_cmd_t cmd;
+} cell_t;
+
+static cell_t cells[APP_UI_CMD_QUEUE_LEN];
+static atomic_uint enqueue_pos;
+static unsigned dequeue_pos;            // Consumer only
+
+static atomic_uint posted;
+static atomic_uint dropped;
+static app_ui_cmd_stats_t stats;        // Consumer side counters
+
+/*---------------------------------------------------------------
+    Empty queue, counters cleared. Before any task posts
+---------------------------------------------------------------*/
+void app_ui_cmd_init(void) {
+    for (unsigned i = 0; i < APP_UI_CMD_QUEUE_LEN; i++) {
+        atomic_init(&cells[i].seq, i);
+    }
+    atomic_init(&enqueue_pos, 0);
+    atomic_init(&posted, 0);
+    atomic_init(&dropped, 0);
+    dequeue_pos = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+/*---------------------------------------------------------------
+    Queue a command, from any task. False if the queue is full
+    (counted) or the command is malformed
+---------------------------------------------------------------*/
+bool app_ui_cmd_post(app_ui_cmd_type_t type, uint8_t target, int32_t value) {
+
+    if ((unsigned)type >= APP_UI_CMD_NUM_TYPES || target >= APP_UI_CMD_MAX_TARGETS) {
+        return false;
+    }
+
+    cell_t * cell;
+    unsigned pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+
+    while (1) {
+        cell = &cells[pos & QUEUE_MASK];
+        unsigned seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            // Free for this lap: claim it. On failure pos is reloaded with the current position
+            if (atomic_compare_exchange_weak_explicit(&enqueue_pos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            return false;
+        }
+        else {
+            pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);    // Another producer took it
+        }
+    }
+
+    cell->cmd.type = (uint8_t)type;
+    cell->cmd.target = target;
+    cell->cmd.value = value;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    atomic_fetch_add_explicit(&posted, 1, memory_order_relaxed);
+    return true;
+}
+
+// Next published command, consumer only
+static bool pop(app_ui_cmd_t * out) {
+
+    cell_t * cell = &cells[dequeue_pos & QUEUE_MASK];
+
+    if ((int)(atomic_load_explicit(&cell->seq, memory_order_acquire) - (dequeue_pos + 1)) < 0) {
+        return false;
+    }
+    *out = cell->cmd;
+    atomic_store_explicit(&cell->seq, dequeue_pos + APP_UI_CMD_QUEUE_LEN, memory_order_release);
+    dequeue_pos++;
+    return true;
+}
+
+/*---------------------------------------------------------------
+    Take everything queued (at most one queue's worth, so fast
+    producers can't hold the frame up) and apply the latest value
+    of each type and target once. Returns the commands taken
+---------------------------------------------------------------*/
+uint32_t app_ui_cmd_drain(app_ui_cmd_apply_t apply) {
+
+    static int32_t latest[NUM_KEYS];
+    uint32_t dirty = 0;
+    uint32_t taken = 0;
+    app_ui_cmd_t cmd;
+
+    unsigned depth = atomic_load_explicit(&enqueue_pos, memory_order_relaxed) - dequeue_pos;
+    if (depth > stats.high_water) {
+        stats.high_water = depth;
+    }
+
+    while (taken < APP_UI_CMD_QUEUE_LEN && pop(&cmd)) {
+        unsigned key = cmd.type * APP_UI_CMD_MAX_TARGETS + cmd.target;
+        if (dirty & (1u << key)) {
+            stats.collapsed++;
+        }
+        dirty |= 1u << key;
+        latest[key] = cmd.value;
+        taken++;
+    }
+    if (taken == 0) {
+        return 0;
+    }
+
+    for (unsigned key = 0; dirty != 0; key++, dirty >>= 1) {
+        if (dirty & 1) {
+            apply((app_ui_cmd_type_t)(key / APP_UI_CMD_MAX_TARGETS), (uint8_t)(key % APP_UI_CMD_MAX_TARGETS),
+                  latest[key]);
+            stats.applied++;
+        }
+    }
+
+    stats.drained += taken;
+    stats.batches++;
+    if (taken > stats.max_batch) {
+        stats.max_batch = taken;
+    }
+    return taken;
+}
+
+void app_ui_cmd_get_stats(app_ui_cmd_stats_t * out) {
+    *out = stats;
+    out->posted = atomic_load_explicit(&posted, memory_order_relaxed);
+    out->dropped = atomic_load_explicit(&dropped, memory_order_relaxed);
+}
+
+void app_ui_cmd_log_stats(const char * TAG) {
+
+    app_ui_cmd_stats_t s;
+    app_ui_cmd_get_stats(&s);
+    ESP_LOGI(TAG, "UI commands: %lu posted, %lu dropped (full), %lu applied in %lu batches (max %lu), %lu collapsed, "
+             "depth max %lu of %d", (unsigned long)s.posted, (unsigned long)s.dropped, (unsigned long)s.applied,
+             (unsigned long)s.batches, (unsigned long)s.max_batch, (unsigned long)s.collapsed,
+             (unsigned long)s.high_water, APP_UI_CMD_QUEUE_LEN);
+}
@@ -0,0 +1,118 @@
+/*
+ * @file app_ui_model.c
+ * @brief Change-driven widget bindings and invalidated pixel accounting, see app_ui_model.h.
+ *
+ */
+
+#include "app_include/app_ui_model.h"
+
+static app_ui_binding_t * ui_bindings = NULL;
+static int ui_num_bindings = 0;
+
+// Counters for the current window, folded into ui_stats when the window closes
+static struct {
+    uint32_t start_ms;
+    uint32_t px;
+    uint32_t refr;
+    uint32_t renders;
+    uint32_t syncs;
+} ui_window;
+static app_ui_stats_t ui_stats;
+
+/*---------------------------------------------------------------
+    Close the stats window once it has run its length
+---------------------------------------------------------------*/
+static void window_roll(void) {
+
+    uint32_t elapsed = lv_tick_elaps(ui_window.start_ms);
+    if (elapsed < APP_UI_MODEL_WINDOW_MS) {
+        return;
+    }
+
+    ui_stats.px_per_s = (uint32_t)((uint64_t)ui_window.px * 1000 / elapsed);
+    ui_stats.refr_per_s = ui_window.refr * 1000 / elapsed;
+    ui_stats.renders_per_s = ui_window.renders * 1000 / elapsed;
+    ui_stats.syncs_per_s = ui_window.syncs * 1000 / elapsed;
+
+    ui_window.start_ms = lv_tick_get();
+    ui_window.px = 0;
+    ui_window.refr = 0;
+    ui_window.renders = 0;
+    ui_window.syncs = 0;
+}
+
+/*---------------------------------------------------------------
+    Bind the table. Nothing is rendered until the first sync.
+---------------------------------------------------------------*/
+void app_ui_model_init(app_ui_binding_t * bindings, int num_bindings) {
+    ui_bindings = bindings;
+    ui_num_bindings = num_bindings;
+    app_ui_model_invalidate();
+    memset(&ui_stats, 0, sizeof(ui_stats));
+    memset(&ui_window, 0, sizeof(ui_window));
+    ui_window.start_ms = lv_tick_get();
+}
+
+/*---------------------------------------------------------------
+    Sample every binding and render the ones whose value changed.
+    Returns the number of bindings rendered.
+---------------------------------------------------------------*/
+int app_ui_model_sync(void) {
+
+    int rendered = 0;
+
+    for (int i = 0; i < ui_num_bindings; i++) {
+        app_ui_binding_t * binding = &ui_bindings[i];
+        int32_t value = binding->read(binding->ctx);
+        if (!APP_UI_MODEL_ALWAYS_RENDER && binding->valid && value == binding->last) {
+            continue;
+        }
+        binding->render(binding->ctx, value);
+        binding->last = value;
+        binding->valid = true;
+        binding->renders++;
+        rendered++;
+    }
+
+    ui_window.renders += rendered;
+    ui_window.syncs++;
+    window_roll();
+
+    return rendered;
+}
+
+/*---------------------------------------------------------------
+    Force every binding to render on the next sync (e.g. after the
+    screen has been rebuilt)
+---------------------------------------------------------------*/
+void app_ui_model_invalidate(void) {
+    for (int i = 0; i < ui_num_bindings; i++) {
+        ui_bindings[i].valid = false;
+    }
+}
+
+/*---------------------------------------------------------------
+    lv_disp_drv_t.monitor_cb: called after each refresh that drew
+    something, with the number of pixels re-rendered
+---------------------------------------------------------------*/
+void app_ui_model_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time_ms, uint32_t px) {
+    ui_window.px += px;
+    ui_window.refr++;
+    ui_stats.px_total += px;
+}
+
+void app_ui_model_get_stats(app_ui_stats_t * stats) {
+    *stats = ui_stats;
+}
+
+/*---------------------------------------------------------------
+    Stats dump, per binding render counts included
+---------------------------------------------------------------*/
+void app_ui_model_log_stats(const char * TAG) {
+
+    ESP_LOGI(TAG, "UI: %lu px/s invalidated, %lu refr/s, %lu renders/s over %lu syncs/s%s", ui_stats.px_per_s, ui_stats.refr_per_s,
+             ui_stats.renders_per_s, ui_stats.syncs_per_s, APP_UI_MODEL_ALWAYS_RENDER ? " (always render)" : "");
+    for (int i = 0; i < ui_num_bindings; i++) {
+        ESP_LOGI(TAG, "UI:   %-12s %lu renders", ui_bindings[i].name, ui_bindings[i].renders);
+    }
+}